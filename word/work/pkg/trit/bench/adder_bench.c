@@ -0,0 +1,312 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Multi-Trit Adders
+// Key: B-word-work-pkg-trit-adder-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for adder and packed arithmetic operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Multi-Trit Addition]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for adder.c - measures, does not judge.
+//
+// adder_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            a carry network buys over the ripple it replaces.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for the multi-trit adders.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare ripple and carry-lookahead adders (unpacked and
+//          bitsliced) against packed trit27_add on the same int27 pairs.
+//
+// Core Design: One buffer, many repetitions, best-of-N wall time.
+//   - Reports million additions per second and ns per addition
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-adder
+// Run:         ./build/bench_adder [additions]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "trit.h"     // adder.c operations
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_WORDS  (2u * 1000u * 1000u)   // 2M additions
+#define BENCH_REPEATS        5                      // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main): the same int27 pairs three ways
+static trit27_t *bench_a = NULL;       // packed
+static trit27_t *bench_b = NULL;
+static trit27_t *bench_out = NULL;
+static trit_t *bench_ta = NULL;        // 27 trits per number, MST-first
+static trit_t *bench_tb = NULL;
+static trit_t *bench_tout = NULL;
+static trit64b_t *bench_va = NULL;     // one number per vector, lanes 0-26
+static trit64b_t *bench_vb = NULL;
+static trit64b_t *bench_vout = NULL;
+static size_t bench_n = 0;
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: adds per second and time per add
+static void report(const char *name, double seconds) {
+    double madds = (double)bench_n / seconds / 1e6;
+    printf("  %-40s %9.1f Madd/s  %7.2f ns/add\n", name, madds, seconds * 1e9 / (double)bench_n);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- Unpacked: ripple over trit arrays ---
+
+static void case_ripple_trits(void) {
+    trit_t c = 0;
+    for (size_t w = 0; w < bench_n; w++) {
+        c ^= trit_ripple_add(bench_ta + 27 * w, bench_tb + 27 * w, 27, TRIT_ZERO, bench_tout + 27 * w);
+    }
+    bench_sink += (unsigned)(c + bench_tout[27 * (bench_n / 2)]);
+}
+
+//--- Bitsliced: ripple vs carry-lookahead ---
+
+// The same bit logic as trit64b_add_carry's sum, but the carry walks one
+// lane per step: 27 dependent steps for int27.
+static trit64b_t ripple_planes(trit64b_t a, trit64b_t b) {
+    uint64_t cp = 0, cn = 0;
+    trit64b_t r = { 0, 0 };
+    for (unsigned i = 0; i < 27; i++) {
+        int s = (int)((a.pos >> i) & 1) - (int)((a.neg >> i) & 1)
+              + (int)((b.pos >> i) & 1) - (int)((b.neg >> i) & 1)
+              + (int)cp - (int)cn;
+        int carry = (s > 1) - (s < -1);
+        s -= 3 * carry;
+        r.pos |= (uint64_t)(s > 0) << i;
+        r.neg |= (uint64_t)(s < 0) << i;
+        cp = (uint64_t)(carry > 0);
+        cn = (uint64_t)(carry < 0);
+    }
+    return r;
+}
+
+static void case_ripple_planes(void) {
+    for (size_t w = 0; w < bench_n; w++) {
+        bench_vout[w] = ripple_planes(bench_va[w], bench_vb[w]);
+    }
+    bench_sink += (unsigned)bench_vout[bench_n / 2].pos;
+}
+
+static void case_lookahead_planes(void) {
+    for (size_t w = 0; w < bench_n; w++) {
+        bench_vout[w] = trit64b_add_carry(bench_va[w], bench_vb[w], 27, TRIT_ZERO, NULL);
+    }
+    bench_sink += (unsigned)bench_vout[bench_n / 2].pos;
+}
+
+//--- Packed domain ---
+
+static void case_add_packed(void) {
+    for (size_t w = 0; w < bench_n; w++) {
+        bench_out[w] = trit27_add(bench_a[w], bench_b[w], NULL);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_WORDS;
+
+    bench_a = malloc(bench_n * sizeof(trit27_t));
+    bench_b = malloc(bench_n * sizeof(trit27_t));
+    bench_out = malloc(bench_n * sizeof(trit27_t));
+    bench_ta = malloc(27 * bench_n);
+    bench_tb = malloc(27 * bench_n);
+    bench_tout = malloc(27 * bench_n);
+    bench_va = malloc(bench_n * sizeof(trit64b_t));
+    bench_vb = malloc(bench_n * sizeof(trit64b_t));
+    bench_vout = malloc(bench_n * sizeof(trit64b_t));
+    if (!bench_a || !bench_b || !bench_out || !bench_ta || !bench_tb || !bench_tout ||
+        !bench_va || !bench_vb || !bench_vout) {
+        printf("✗ Allocation failed for %zu words\n", bench_n);
+        return 1;
+    }
+
+    // Deterministic pseudo-random int27 words (LCG), loaded into every layout
+    uint64_t seed = 12345u;
+    for (size_t i = 0; i < bench_n; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        bench_a[i] = (seed >> 11) % TRIT27_STATES;
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        bench_b[i] = (seed >> 11) % TRIT27_STATES;
+        trit27_unpack(bench_a[i], bench_ta + 27 * i);
+        trit27_unpack(bench_b[i], bench_tb + 27 * i);
+        bench_va[i] = trit64b_from_trit27(bench_a[i]);
+        bench_vb[i] = trit64b_from_trit27(bench_b[i]);
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit adder benchmarks: %zu int27 additions\n", bench_n);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    printf("\n  int27 add, operands already in each layout:\n");
+    report("trit_ripple_add (27 trit_t)", time_best(case_ripple_trits));
+    report("bitsliced ripple (27 lane steps)", time_best(case_ripple_planes));
+    report("trit64b_add_carry (5 prefix levels)", time_best(case_lookahead_planes));
+    report("trit27_add (packed)", time_best(case_add_packed));
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    free(bench_a);
+    free(bench_b);
+    free(bench_out);
+    free(bench_ta);
+    free(bench_tb);
+    free(bench_tout);
+    free(bench_va);
+    free(bench_vb);
+    free(bench_vout);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + report line in main)
+//   ✅ Buffer size and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,281 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Packed-Domain Arithmetic
+// Key: B-word-work-pkg-trit-arith-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for pack/unpack operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/core/primitives.toml [int27]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for arith.c - measures, does not judge.
+//
+// arith_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            each int27 add costs with and without unpacking.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for packed-domain integer operations.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare trit27_add on packed words against the unpack, per-trit
+//          ripple-carry add, repack path it replaces.
+//
+// Core Design: One buffer, many repetitions, best-of-N wall time.
+//   - Reports Mtrit/s (and t5b1 MB/s equivalent) for each case
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-arith
+// Run:         ./build/bench_arith [trits]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "trit.h"     // arith.c operations
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_WORDS  (4u * 1000u * 1000u)   // 4M word pairs
+#define BENCH_REPEATS        5                      // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main)
+static trit27_t *bench_a = NULL;
+static trit27_t *bench_b = NULL;
+static trit27_t *bench_out = NULL;
+static size_t bench_n = 0;   // words
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: word operations per second
+static void report(const char *name, double seconds) {
+    double mops = (double)bench_n / seconds / 1e6;
+    printf("  %-36s %9.1f Mop/s  %7.2f ns/op\n", name, mops, seconds * 1e9 / (double)bench_n);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- Baseline: unpack, ripple-carry per trit, repack ---
+
+// What callers had to write before arith.c: 27 trits each side, a digit
+// sum with carry per position, then Horner back into a word.
+static void case_add_unpacked(void) {
+    for (size_t w = 0; w < bench_n; w++) {
+        trit_t ta[27], tb[27], tr[27];
+        trit27_unpack(bench_a[w], ta);
+        trit27_unpack(bench_b[w], tb);
+        int carry = 0;
+        for (int i = 26; i >= 0; i--) {
+            int s = ta[i] + tb[i] + carry;
+            carry = (s > 1) - (s < -1);
+            tr[i] = (trit_t)(s - 3 * carry);
+        }
+        bench_out[w] = trit27_pack(tr);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+//--- Packed domain ---
+
+static void case_add_packed(void) {
+    for (size_t w = 0; w < bench_n; w++) {
+        bench_out[w] = trit27_add(bench_a[w], bench_b[w], NULL);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_sub_packed(void) {
+    for (size_t w = 0; w < bench_n; w++) {
+        bench_out[w] = trit27_sub(bench_a[w], bench_b[w], NULL);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_cmp_packed(void) {
+    int acc = 0;
+    for (size_t w = 0; w < bench_n; w++) {
+        acc += trit27_cmp(bench_a[w], bench_b[w]);
+    }
+    bench_sink += (unsigned)acc;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_WORDS;
+
+    bench_a = malloc(bench_n * sizeof(trit27_t));
+    bench_b = malloc(bench_n * sizeof(trit27_t));
+    bench_out = malloc(bench_n * sizeof(trit27_t));
+    if (!bench_a || !bench_b || !bench_out) {
+        printf("✗ Allocation failed for %zu words\n", bench_n);
+        return 1;
+    }
+
+    // Deterministic pseudo-random int27 words (LCG)
+    uint64_t seed = 12345u;
+    for (size_t i = 0; i < bench_n; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        bench_a[i] = (seed >> 11) % TRIT27_STATES;
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        bench_b[i] = (seed >> 11) % TRIT27_STATES;
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit arith benchmarks: %zu int27 word pairs\n", bench_n);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    printf("\n  int27 add:\n");
+    report("unpack + ripple + repack", time_best(case_add_unpacked));
+    report("trit27_add (packed)", time_best(case_add_packed));
+
+    printf("\n  int27 other:\n");
+    report("trit27_sub (packed)", time_best(case_sub_packed));
+    report("trit27_cmp (packed)", time_best(case_cmp_packed));
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    free(bench_a);
+    free(bench_b);
+    free(bench_out);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + report line in main)
+//   ✅ Buffer size and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,312 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Element-wise Array Kernels
+// Key: B-word-work-pkg-trit-array-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for array kernels and backend dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Single-Trit Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for array.c - measures, does not judge.
+//
+// array_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            int8 lane arithmetic saves over one call and table lookup
+//            per trit.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for per-call vs bulk element-wise trit
+//       operations on each backend.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare a per-call loop (trit_negate/add/multiply/navigate)
+//          against trit_*_array on every backend this CPU supports.
+//
+// Core Design: One buffer, many repetitions, best-of-N wall time.
+//   - Reports Mtrit/s and the speedup over the per-call loop
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-array
+// Run:         ./build/bench_array [trits]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "trit.h"     // per-call and array operations, backends
+#include "dimension.h" // trit_navigate, trit_navigate_array
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_TRITS  (4u * 1000u * 1000u)   // 4M trits
+#define BENCH_REPEATS        5                      // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main)
+static trit_t *bench_a = NULL;
+static trit_t *bench_b = NULL;
+static trit_t *bench_out = NULL;
+static size_t bench_n = 0;
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: trit rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double mtrits = (double)bench_n / seconds / 1e6;
+    printf("  %-36s %9.1f Mtrit/s  %6.1fx\n", name, mtrits, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- Per-call baseline: one call per trit ---
+
+static void case_negate_loop(void) {
+    for (size_t i = 0; i < bench_n; i++) {
+        bench_out[i] = trit_negate(bench_a[i]);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_add_loop(void) {
+    for (size_t i = 0; i < bench_n; i++) {
+        bench_out[i] = trit_add(bench_a[i], bench_b[i]);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_multiply_loop(void) {
+    for (size_t i = 0; i < bench_n; i++) {
+        bench_out[i] = trit_multiply(bench_a[i], bench_b[i]);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_navigate_loop(void) {
+    for (size_t i = 0; i < bench_n; i++) {
+        bench_out[i] = trit_navigate(bench_a[i], DIR_BUILD_UP);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+//--- Bulk: active backend ---
+
+static void case_negate_array(void) {
+    trit_negate_array(bench_a, bench_n, bench_out);
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_add_array(void) {
+    trit_add_array(bench_a, bench_b, bench_n, bench_out);
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_multiply_array(void) {
+    trit_multiply_array(bench_a, bench_b, bench_n, bench_out);
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_navigate_array(void) {
+    trit_navigate_array(bench_a, bench_n, DIR_BUILD_UP, bench_out);
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+// run_op times one operation's per-call loop, then its array form on each
+// supported backend.
+static void run_op(const char *op, void (*loop)(void), void (*array)(void)) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+
+    printf("\n  %s:\n", op);
+    double baseline = time_best(loop);
+    snprintf(name, sizeof(name), "trit_%s (per call)", op);
+    report(name, baseline, baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "trit_%s_array [%s]", op, trit_backend_name(backends[i]));
+        report(name, time_best(array), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_TRITS;
+
+    bench_a = malloc(bench_n);
+    bench_b = malloc(bench_n);
+    bench_out = malloc(bench_n);
+    if (!bench_a || !bench_b || !bench_out) {
+        printf("✗ Allocation failed for %zu trits\n", bench_n);
+        return 1;
+    }
+
+    // Deterministic pseudo-random trits (LCG)
+    uint32_t seed = 12345u;
+    for (size_t i = 0; i < bench_n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bench_a[i] = (trit_t)((seed >> 16) % 3) - 1;
+        seed = seed * 1103515245u + 12345u;
+        bench_b[i] = (trit_t)((seed >> 16) % 3) - 1;
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit array benchmarks: %zu trits (auto backend: %s)\n",
+           bench_n, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    run_op("negate", case_negate_loop, case_negate_array);
+    run_op("add", case_add_loop, case_add_array);
+    run_op("multiply", case_multiply_loop, case_multiply_array);
+    run_op("navigate", case_navigate_loop, case_navigate_array);
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    free(bench_a);
+    free(bench_b);
+    free(bench_out);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + report line in main)
+//   ✅ Buffer size and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
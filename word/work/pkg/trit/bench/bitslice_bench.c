@@ -0,0 +1,327 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Bitsliced Vectors
+// Key: B-word-work-pkg-trit-bitslice-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for pack/unpack operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 2: BCT Parallel]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for bitslice.c - measures, does not judge.
+//
+// bitslice_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            lane-parallel logic saves over one table lookup per trit.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for scalar vs bitsliced trit operations.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare trit_add/trit_multiply per trit against trit64b_add/
+//          trit64b_multiply per 64 lanes, and measure transcoding into and
+//          out of the bitsliced form (trit_t arrays and t5b1 streams).
+//
+// Core Design: One buffer, many repetitions, best-of-N wall time.
+//   - Reports Mtrit/s (and t5b1 MB/s equivalent) for each case
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-bitslice
+// Run:         ./build/bench_bitslice [trits]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "trit.h"     // scalar and bitsliced operations
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_TRITS  (16u * 1000u * 1000u)  // 16M trits
+#define BENCH_REPEATS        5                      // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main)
+static trit_t *bench_a = NULL;
+static trit_t *bench_b = NULL;
+static trit_t *bench_out = NULL;
+static uint8_t *bench_bytes = NULL;
+static trit64b_t *bench_va = NULL;
+static trit64b_t *bench_vb = NULL;
+static trit64b_t *bench_vout = NULL;
+static size_t bench_n = 0;
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: trit rate and packed-byte rate
+static void report(const char *name, double seconds) {
+    double mtrits = (double)bench_n / seconds / 1e6;
+    double mbytes = (double)TRIT5_PACKED_SIZE(bench_n) / seconds / 1e6;
+    printf("  %-36s %9.1f Mtrit/s  %8.1f MB/s packed\n", name, mtrits, mbytes);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- Scalar baseline: one table lookup per trit ---
+
+static void case_add_scalar(void) {
+    for (size_t i = 0; i < bench_n; i++) {
+        bench_out[i] = trit_add(bench_a[i], bench_b[i]);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_multiply_scalar(void) {
+    for (size_t i = 0; i < bench_n; i++) {
+        bench_out[i] = trit_multiply(bench_a[i], bench_b[i]);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+//--- Bitsliced: 64 lanes per call ---
+
+static void case_add_bitsliced(void) {
+    size_t nvec = TRIT64B_COUNT(bench_n);
+    for (size_t k = 0; k < nvec; k++) {
+        bench_vout[k] = trit64b_add(bench_va[k], bench_vb[k]);
+    }
+    bench_sink += (unsigned)bench_vout[nvec / 2].pos;
+}
+
+static void case_multiply_bitsliced(void) {
+    size_t nvec = TRIT64B_COUNT(bench_n);
+    for (size_t k = 0; k < nvec; k++) {
+        bench_vout[k] = trit64b_multiply(bench_va[k], bench_vb[k]);
+    }
+    bench_sink += (unsigned)bench_vout[nvec / 2].pos;
+}
+
+//--- Transcoding ---
+
+static void case_from_trits(void) {
+    size_t nvec = TRIT64B_COUNT(bench_n);
+    for (size_t k = 0; k < nvec; k++) {
+        bench_vout[k] = trit64b_from_trits(bench_a + 64 * k, 64);
+    }
+    bench_sink += (unsigned)bench_vout[nvec / 2].neg;
+}
+
+static void case_to_trits(void) {
+    size_t nvec = TRIT64B_COUNT(bench_n);
+    for (size_t k = 0; k < nvec; k++) {
+        trit64b_to_trits(bench_va[k], 64, bench_out + 64 * k);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_trit5_to_planes(void) {
+    trit5_to_trit64b_array(bench_bytes, bench_n, bench_vout);
+    bench_sink += (unsigned)bench_vout[0].pos;
+}
+
+static void case_planes_to_trit5(void) {
+    trit64b_to_trit5_array(bench_va, bench_n, bench_bytes);
+    bench_sink += bench_bytes[bench_n / 10];
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_TRITS;
+    bench_n -= bench_n % 64;  // whole vectors so scalar and bitsliced do equal work
+
+    size_t nvec = TRIT64B_COUNT(bench_n);
+    bench_a = malloc(bench_n);
+    bench_b = malloc(bench_n);
+    bench_out = malloc(bench_n);
+    bench_bytes = malloc(TRIT5_PACKED_SIZE(bench_n));
+    bench_va = malloc(nvec * sizeof(trit64b_t));
+    bench_vb = malloc(nvec * sizeof(trit64b_t));
+    bench_vout = malloc(nvec * sizeof(trit64b_t));
+    if (!bench_a || !bench_b || !bench_out || !bench_bytes ||
+        !bench_va || !bench_vb || !bench_vout) {
+        printf("✗ Allocation failed for %zu trits\n", bench_n);
+        return 1;
+    }
+
+    // Deterministic pseudo-random trits (LCG)
+    uint32_t seed = 12345u;
+    for (size_t i = 0; i < bench_n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bench_a[i] = (trit_t)((seed >> 16) % 3) - 1;
+        seed = seed * 1103515245u + 12345u;
+        bench_b[i] = (trit_t)((seed >> 16) % 3) - 1;
+    }
+    for (size_t k = 0; k < nvec; k++) {
+        bench_va[k] = trit64b_from_trits(bench_a + 64 * k, 64);
+        bench_vb[k] = trit64b_from_trits(bench_b + 64 * k, 64);
+    }
+    trit5_pack_array(bench_a, bench_n, bench_bytes);
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit bitslice benchmarks: %zu trits (%zu vectors)\n", bench_n, nvec);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    printf("\n  add (no carry):\n");
+    report("trit_add (per trit)", time_best(case_add_scalar));
+    report("trit64b_add (per 64 lanes)", time_best(case_add_bitsliced));
+
+    printf("\n  multiply:\n");
+    report("trit_multiply (per trit)", time_best(case_multiply_scalar));
+    report("trit64b_multiply (per 64 lanes)", time_best(case_multiply_bitsliced));
+
+    printf("\n  transcoding:\n");
+    report("trit64b_from_trits", time_best(case_from_trits));
+    report("trit64b_to_trits", time_best(case_to_trits));
+    report("trit5_to_trit64b_array", time_best(case_trit5_to_planes));
+    report("trit64b_to_trit5_array", time_best(case_planes_to_trit5));
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    free(bench_a);
+    free(bench_b);
+    free(bench_out);
+    free(bench_bytes);
+    free(bench_va);
+    free(bench_vb);
+    free(bench_vout);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + report line in main)
+//   ✅ Buffer size and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,355 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Three-Valued Logic
+// Key: B-word-work-pkg-trit-logic-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for the bulk connectives and dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/tritop_bench.c (structure)
+// See: word/research/ternary/ternary-logic-algorithms.adoc [Dyadic Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for logic.h / logic.c - measures, does not judge.
+//
+// logic_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            a branch per value costs against straight-line logic.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for Kleene connectives: the logic doc's
+//       branching pseudocode, the inline scalar forms, bool3_apply per
+//       backend and bitsliced masks.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Show what replacing branch-emulated predicate masks with the
+//          bool3 forms buys, connective by connective.
+//
+// Core Design: One buffer of random values (so branches mispredict as
+//   real masks do), many repetitions, best-of-N wall time.
+//   - Reports Mvalue/s and the speedup over the branching version
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-logic
+// Run:         ./build/bench_logic [values]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "logic.h"    // bool3 connectives, bulk forms
+#include "trit.h"     // trit64b_from_trits, backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_VALUES  (4u * 1000u * 1000u)   // 4M values
+#define BENCH_REPEATS         5                      // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main): the same values as bytes and planes
+static bool3_t *bench_a = NULL;
+static bool3_t *bench_b = NULL;
+static bool3_t *bench_out = NULL;
+static bool3x64_t *bench_va = NULL;
+static bool3x64_t *bench_vb = NULL;
+static bool3x64_t *bench_vout = NULL;
+static size_t bench_n = 0;      // values (multiple of 64)
+static size_t bench_vn = 0;     // words
+
+// Connective under test
+static bool3_op_t bench_op = BOOL3_OP_AND;
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: value rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double mvalues = (double)bench_n / seconds / 1e6;
+    printf("  %-36s %9.1f Mvalue/s  %6.2fx\n", name, mvalues, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Branching References (the logic doc's pseudocode)
+// ────────────────────────────────────────────────────────────────
+
+static bool3_t branch_and(bool3_t a, bool3_t b) {
+    if (a == BOOL3_FALSE || b == BOOL3_FALSE) return BOOL3_FALSE;
+    if (a == BOOL3_UNKNOWN || b == BOOL3_UNKNOWN) return BOOL3_UNKNOWN;
+    return BOOL3_TRUE;
+}
+
+static bool3_t branch_xor(bool3_t a, bool3_t b) {
+    if (a == BOOL3_UNKNOWN || b == BOOL3_UNKNOWN) return BOOL3_UNKNOWN;
+    if (a == b) return BOOL3_FALSE;
+    return BOOL3_TRUE;
+}
+
+static bool3_t branch_implies(bool3_t a, bool3_t b) {
+    if (a == BOOL3_FALSE || b == BOOL3_TRUE) return BOOL3_TRUE;
+    if (a == BOOL3_UNKNOWN || b == BOOL3_UNKNOWN) return BOOL3_UNKNOWN;
+    return BOOL3_FALSE;
+}
+
+static bool3_t branch_compare(bool3_t a, bool3_t b) {
+    if (a < b) return BOOL3_FALSE;
+    if (a == b) return BOOL3_UNKNOWN;
+    return BOOL3_TRUE;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- Per-value loops ---
+
+static void case_branch(void) {
+    bool3_t (*fn)(bool3_t, bool3_t) = bench_op == BOOL3_OP_AND ? branch_and
+                                    : bench_op == BOOL3_OP_XOR ? branch_xor
+                                    : bench_op == BOOL3_OP_IMPLIES ? branch_implies
+                                    : branch_compare;
+    for (size_t i = 0; i < bench_n; i++) {
+        bench_out[i] = fn(bench_a[i], bench_b[i]);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_inline(void) {
+    switch (bench_op) {
+    case BOOL3_OP_AND:
+        for (size_t i = 0; i < bench_n; i++) bench_out[i] = bool3_and(bench_a[i], bench_b[i]);
+        break;
+    case BOOL3_OP_XOR:
+        for (size_t i = 0; i < bench_n; i++) bench_out[i] = bool3_xor(bench_a[i], bench_b[i]);
+        break;
+    case BOOL3_OP_IMPLIES:
+        for (size_t i = 0; i < bench_n; i++) bench_out[i] = bool3_implies(bench_a[i], bench_b[i]);
+        break;
+    default:
+        for (size_t i = 0; i < bench_n; i++) bench_out[i] = bool3_compare(bench_a[i], bench_b[i]);
+        break;
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+//--- Bulk forms ---
+
+static void case_apply(void) {
+    bool3_apply(bench_op, bench_a, bench_b, bench_n, bench_out);
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_apply64(void) {
+    bool3x64_apply(bench_op, bench_va, bench_vb, bench_vn, bench_vout);
+    bench_sink += (unsigned)bench_vout[bench_vn / 2].pos;
+}
+
+// run_op times one connective: branching loop (baseline), inline scalar
+// loop, bool3_apply on each supported backend, bool3x64_apply.
+static void run_op(const char *op, bool3_op_t id) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+
+    bench_op = id;
+    printf("\n  %s:\n", op);
+
+    double baseline = time_best(case_branch);
+    report("branching (logic doc pseudocode)", baseline, baseline);
+    snprintf(name, sizeof(name), "bool3_%s loop (inline)", op);
+    report(name, time_best(case_inline), baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "bool3_apply [%s]", trit_backend_name(backends[i]));
+        report(name, time_best(case_apply), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+    report("bool3x64_apply (bitsliced)", time_best(case_apply64), baseline);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_VALUES;
+    bench_n = (bench_n + 63) / 64 * 64;
+    bench_vn = TRIT64B_COUNT(bench_n);
+
+    bench_a = malloc(bench_n);
+    bench_b = malloc(bench_n);
+    bench_out = malloc(bench_n);
+    bench_va = malloc(bench_vn * sizeof(bool3x64_t));
+    bench_vb = malloc(bench_vn * sizeof(bool3x64_t));
+    bench_vout = malloc(bench_vn * sizeof(bool3x64_t));
+    if (!bench_a || !bench_b || !bench_out || !bench_va || !bench_vb || !bench_vout) {
+        printf("✗ Allocation failed for %zu values\n", bench_n);
+        return 1;
+    }
+
+    // Deterministic pseudo-random values (LCG)
+    uint32_t seed = 12345u;
+    for (size_t i = 0; i < bench_n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bench_a[i] = (bool3_t)((seed >> 16) % 3) - 1;
+        seed = seed * 1103515245u + 12345u;
+        bench_b[i] = (bool3_t)((seed >> 16) % 3) - 1;
+    }
+    for (size_t v = 0; v < bench_vn; v++) {
+        bench_va[v] = trit64b_from_trits(bench_a + v * 64, 64);
+        bench_vb[v] = trit64b_from_trits(bench_b + v * 64, 64);
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit three-valued logic benchmarks: %zu values (auto backend: %s)\n",
+           bench_n, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    run_op("and", BOOL3_OP_AND);
+    run_op("xor", BOOL3_OP_XOR);
+    run_op("implies", BOOL3_OP_IMPLIES);
+    run_op("compare", BOOL3_OP_COMPARE);
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    free(bench_a);
+    free(bench_b);
+    free(bench_out);
+    free(bench_va);
+    free(bench_vb);
+    free(bench_vout);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add connectives (a branch_* reference, a case_inline arm, a run_op line)
+//   ✅ Buffer size and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,368 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Packing Throughput
+// Key: B-word-work-pkg-trit-pack-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for pack/unpack operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for pack.c - measures, does not judge.
+//
+// pack_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            each pack/unpack path costs so callers can choose wisely.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for packing paths (per-call vs bulk).
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare per-call trit5_pack/unpack loops against the bulk
+//          trit5_pack_array/unpack_array stream API, and each decode
+//          backend (scalar, table, SSE4.1, AVX2, AVX-512) against the
+//          others. Per-call table decode is measured against division.
+//
+// Core Design: One buffer, many repetitions, best-of-N wall time.
+//   - Reports Mtrit/s and packed MB/s for each case
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench
+// Run:         ./build/bench_pack [trits]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "trit.h"     // pack/unpack operations
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_TRITS  (50u * 1000u * 1000u)  // 50M trits = 10 MB packed
+#define BENCH_REPEATS        5                      // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main)
+static trit_t *bench_trits = NULL;
+static trit_t *bench_out = NULL;
+static uint8_t *bench_bytes = NULL;
+static trit9_t *bench_words = NULL;
+static trit27_t *bench_words27 = NULL;
+static trit40_t *bench_words40 = NULL;
+static size_t bench_n = 0;
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: trit rate and packed-byte rate
+static void report(const char *name, double seconds) {
+    double mtrits = (double)bench_n / seconds / 1e6;
+    double mbytes = (double)TRIT5_PACKED_SIZE(bench_n) / seconds / 1e6;
+    printf("  %-36s %9.1f Mtrit/s  %8.1f MB/s packed\n", name, mtrits, mbytes);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- trit5 per-call baseline ---
+
+static void case_pack_per_call(void) {
+    size_t groups = bench_n / 5;
+    for (size_t g = 0; g < groups; g++) {
+        bench_bytes[g] = trit5_pack(bench_trits + 5 * g);
+    }
+    bench_sink += bench_bytes[groups / 2];
+}
+
+static void case_unpack_per_call(void) {
+    size_t groups = bench_n / 5;
+    for (size_t g = 0; g < groups; g++) {
+        trit5_unpack(bench_bytes[g], bench_out + 5 * g);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_unpack_table_per_call(void) {
+    size_t groups = bench_n / 5;
+    for (size_t g = 0; g < groups; g++) {
+        trit5_unpack_table(bench_bytes[g], bench_out + 5 * g);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+//--- trit9 per-call: division vs two-stage table ---
+// bench_words is the same trit stream packed 9 trits per word
+
+static void case_trit9_unpack_per_call(void) {
+    size_t words = bench_n / 9;
+    for (size_t w = 0; w < words; w++) {
+        trit9_unpack(bench_words[w], bench_out + 9 * w);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_trit9_unpack_table_per_call(void) {
+    size_t words = bench_n / 9;
+    for (size_t w = 0; w < words; w++) {
+        trit9_unpack_table(bench_words[w], bench_out + 9 * w);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+//--- trit27 per-call: division chain vs chunked reciprocal ---
+
+static void case_trit27_unpack_per_call(void) {
+    size_t words = bench_n / 27;
+    for (size_t w = 0; w < words; w++) {
+        trit27_unpack(bench_words27[w], bench_out + 27 * w);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_trit27_unpack_table_per_call(void) {
+    size_t words = bench_n / 27;
+    for (size_t w = 0; w < words; w++) {
+        trit27_unpack_table(bench_words27[w], bench_out + 27 * w);
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+//--- t5b1 bytes ↔ trit40 words ---
+
+static void case_trit5_to_trit40(void) {
+    trit5_to_trit40_array(bench_bytes, bench_n, bench_words40);
+    bench_sink += (unsigned)bench_words40[bench_n / 80];
+}
+
+static void case_trit40_to_trit5(void) {
+    trit40_to_trit5_array(bench_words40, bench_n, bench_bytes);
+    bench_sink += bench_bytes[bench_n / 10];
+}
+
+//--- trit5 bulk stream API ---
+
+static void case_pack_array(void) {
+    trit5_pack_array(bench_trits, bench_n, bench_bytes);
+    bench_sink += bench_bytes[bench_n / 10];
+}
+
+static void case_unpack_array(void) {
+    trit5_unpack_array(bench_bytes, bench_n, bench_out);
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_TRITS;
+    bench_n -= bench_n % 5;  // whole groups so per-call and bulk do equal work
+
+    bench_trits = malloc(bench_n);
+    bench_out = malloc(bench_n);
+    bench_bytes = malloc(TRIT5_PACKED_SIZE(bench_n));
+    bench_words = malloc((bench_n / 9 + 1) * sizeof(trit9_t));
+    bench_words27 = malloc((bench_n / 27 + 1) * sizeof(trit27_t));
+    bench_words40 = malloc(TRIT40_PACKED_SIZE(bench_n) * sizeof(trit40_t));
+    if (!bench_trits || !bench_out || !bench_bytes || !bench_words ||
+        !bench_words27 || !bench_words40) {
+        printf("✗ Allocation failed for %zu trits\n", bench_n);
+        return 1;
+    }
+
+    // Deterministic pseudo-random trits (LCG)
+    uint32_t seed = 12345u;
+    for (size_t i = 0; i < bench_n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bench_trits[i] = (trit_t)((seed >> 16) % 3) - 1;
+    }
+    trit5_pack_array(bench_trits, bench_n, bench_bytes);
+    for (size_t w = 0; w < bench_n / 9; w++) {
+        bench_words[w] = trit9_pack(bench_trits + 9 * w);
+    }
+    for (size_t w = 0; w < bench_n / 27; w++) {
+        bench_words27[w] = trit27_pack(bench_trits + 27 * w);
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit pack benchmarks: %zu trits (%zu bytes packed)\n",
+           bench_n, (size_t)TRIT5_PACKED_SIZE(bench_n));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    printf("\n  trit5 pack:\n");
+    report("trit5_pack (per call)", time_best(case_pack_per_call));
+    report("trit5_pack_array", time_best(case_pack_array));
+
+    printf("\n  trit5 unpack:\n");
+    report("trit5_unpack (per call)", time_best(case_unpack_per_call));
+    report("trit5_unpack_table (per call)", time_best(case_unpack_table_per_call));
+    report("trit5_unpack_array", time_best(case_unpack_array));
+
+    printf("\n  trit9 unpack:\n");
+    report("trit9_unpack (per call)", time_best(case_trit9_unpack_per_call));
+    report("trit9_unpack_table (per call)", time_best(case_trit9_unpack_table_per_call));
+
+    printf("\n  trit27 unpack:\n");
+    report("trit27_unpack (per call)", time_best(case_trit27_unpack_per_call));
+    report("trit27_unpack_table (per call)", time_best(case_trit27_unpack_table_per_call));
+
+    printf("\n  t5b1 ↔ trit40 words (no trit expansion):\n");
+    report("trit5_to_trit40_array", time_best(case_trit5_to_trit40));
+    report("trit40_to_trit5_array", time_best(case_trit40_to_trit5));
+
+    printf("\n  trit5_unpack_array by backend (active: %s):\n",
+           trit_backend_name(trit_backend_active()));
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        if (!trit_backend_select(backends[b])) continue;
+        report(trit_backend_name(backends[b]), time_best(case_unpack_array));
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    free(bench_trits);
+    free(bench_out);
+    free(bench_bytes);
+    free(bench_words);
+    free(bench_words27);
+    free(bench_words40);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + report line in main)
+//   ✅ Buffer size and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
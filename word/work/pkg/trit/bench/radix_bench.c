@@ -0,0 +1,353 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Binary ↔ Ternary Radix Conversion
+// Key: B-word-work-pkg-trit-radix-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for radix conversion.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/research/ternary/ternary-conversion-algorithms.adoc [Binary Conversions]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Timing benchmarks for radix.c - measures, does not judge.
+//
+// radix_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            the power tree buys over digit-at-a-time conversion.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Timing for binary ↔ ternary conversion.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare power-tree conversion against the quadratic methods
+//          it replaces, from 1K to 1M bits, in both directions.
+//
+// Core Design: Random binary integers, best-of-N wall time.
+//   - Per-trit: one "% 3" pass over all limbs per trit (binary → ternary)
+//   - Limb Horner: whole 3^27 / 2^16 steps, still O(n^2) (both directions)
+//   - Power tree: tritbig_from_binary / tritbig_to_binary
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-radix
+// Run:         ./build/bench_radix [max bits]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <string.h>   // memcpy, memset
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "tritbig.h"  // radix conversion, tritbig_t
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_BITS   1000000u   // largest size in the table
+#define BENCH_TRIT_BITS      10000u     // per-trit loop stops here (O(n^2), slow divides)
+#define BENCH_HORNER_BITS    100000u    // limb Horner stops here
+#define BENCH_REPEATS        5          // best-of-N
+#define BENCH_MIN_SECONDS    0.02       // small cases loop at least this long
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+__extension__ typedef unsigned __int128 bench_uwide;
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up per size in main)
+static uint64_t *bench_bin = NULL;      // input, n limbs
+static uint64_t *bench_out = NULL;      // binary output
+static uint64_t *bench_tmp = NULL;      // scratch limbs
+static uint64_t *bench_dig = NULL;      // unsigned 3^27 digits
+static trit_t *bench_trits = NULL;      // per-trit output
+static size_t bench_n = 0;              // binary limbs
+static size_t bench_digits = 0;         // ternary limbs of the value
+static tritbig_t bench_x = TRITBIG_INIT;
+static size_t bench_loops = 1;          // calls per timed run
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static double time_best(void (*fn)(void));
+static void print_time(double seconds);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time per call.
+// bench_loops is first raised until one run lasts BENCH_MIN_SECONDS.
+static double time_best(void (*fn)(void)) {
+    bench_loops = 1;
+    for (;;) {
+        double t0 = now_seconds();
+        fn();
+        if (now_seconds() - t0 >= BENCH_MIN_SECONDS || bench_loops >= (1u << 20)) break;
+        bench_loops *= 4;
+    }
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best / (double)bench_loops;
+}
+
+// Format a time with a unit that keeps 3-4 significant digits
+static void print_time(double seconds) {
+    if (seconds < 1e-3) printf(" %9.2f µs", seconds * 1e6);
+    else if (seconds < 1.0) printf(" %9.2f ms", seconds * 1e3);
+    else printf(" %9.2f s ", seconds);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- Binary → ternary ---
+
+// One "% 3" pass over every limb per trit
+static void case_to_tern_per_trit(void) {
+    size_t count = TRITBIG_TRITS_FOR_BINARY(bench_n);
+    for (size_t l = 0; l < bench_loops; l++) {
+        memcpy(bench_tmp, bench_bin, bench_n * sizeof(uint64_t));
+        size_t top = bench_n;
+        for (size_t t = count; t-- > 0 && top > 0;) {
+            uint64_t rem = 0;
+            for (size_t i = top; i-- > 0;) {
+                bench_uwide cur = ((bench_uwide)rem << 64) | bench_tmp[i];
+                bench_tmp[i] = (uint64_t)(cur / 3);
+                rem = (uint64_t)(cur % 3);
+            }
+            bench_trits[t] = (rem == 2) ? TRIT_NEG : (trit_t)rem;
+            if (rem == 2) {
+                for (size_t i = 0; i < bench_n && ++bench_tmp[i] == 0; i++) {
+                }
+            }
+            while (top > 0 && bench_tmp[top - 1] == 0) top--;
+        }
+    }
+    bench_sink += (unsigned)bench_trits[count / 2];
+}
+
+// Horner over 16-bit chunks into 3^27 digits
+static void case_to_tern_horner(void) {
+    for (size_t l = 0; l < bench_loops; l++) {
+        size_t len = 0;
+        for (size_t i = bench_n; i-- > 0;) {
+            for (int shift = 48; shift >= 0; shift -= 16) {
+                uint64_t carry = (bench_bin[i] >> shift) & 0xFFFFu;
+                for (size_t j = 0; j < len; j++) {
+                    uint64_t t = (bench_dig[j] << 16) + carry;
+                    bench_dig[j] = t % TRIT27_STATES;
+                    carry = t / TRIT27_STATES;
+                }
+                if (carry) bench_dig[len++] = carry;
+            }
+        }
+        bench_digits = len;
+    }
+    bench_sink += (unsigned)bench_dig[bench_digits / 2];
+}
+
+static void case_to_tern_tree(void) {
+    for (size_t l = 0; l < bench_loops; l++) tritbig_from_binary(&bench_x, bench_bin, bench_n);
+    bench_sink += (unsigned)bench_x.len;
+}
+
+//--- Ternary → binary (value set up by case_to_tern_horner / tree) ---
+
+// Horner: out = out·3^27 + digit, top digit first
+static void case_to_bin_horner(void) {
+    for (size_t l = 0; l < bench_loops; l++) {
+        size_t len = 0;
+        for (size_t i = bench_digits; i-- > 0;) {
+            uint64_t carry = bench_dig[i];
+            for (size_t j = 0; j < len; j++) {
+                bench_uwide t = (bench_uwide)bench_out[j] * TRIT27_STATES + carry;
+                bench_out[j] = (uint64_t)t;
+                carry = (uint64_t)(t >> 64);
+            }
+            if (carry) bench_out[len++] = carry;
+        }
+    }
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_to_bin_tree(void) {
+    for (size_t l = 0; l < bench_loops; l++) tritbig_to_binary(&bench_x, bench_out, bench_n);
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    size_t max_bits = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_BITS;
+    if (max_bits < 1000) max_bits = 1000;
+    size_t max_n = max_bits / 64 + 1;
+
+    bench_bin = malloc(max_n * sizeof(uint64_t));
+    bench_out = malloc((max_n + 1) * sizeof(uint64_t));
+    bench_tmp = malloc(max_n * sizeof(uint64_t));
+    bench_dig = malloc((max_n * 2 + 2) * sizeof(uint64_t));
+    bench_trits = malloc(TRITBIG_TRITS_FOR_BINARY(max_n));
+    if (!bench_bin || !bench_out || !bench_tmp || !bench_dig || !bench_trits) {
+        printf("✗ Allocation failed for %zu bits\n", max_bits);
+        return 1;
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit radix conversion benchmarks (unsigned binary ↔ balanced ternary)\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    printf("\n  %9s │ %12s %12s %12s │ %12s %12s\n", "", "binary →", "ternary", "",
+           "ternary →", "binary");
+    printf("  %9s │ %12s %12s %12s │ %12s %12s\n", "bits", "per-trit", "horner", "tree",
+           "horner", "tree");
+    uint64_t seed = 12345u;
+    for (size_t bits = 1000; bits <= max_bits; bits *= 10) {
+        bench_n = (bits + 63) / 64;
+        for (size_t i = 0; i < bench_n; i++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            bench_bin[i] = seed;
+        }
+        printf("  %9zu │", bits);
+        if (bits <= BENCH_TRIT_BITS) print_time(time_best(case_to_tern_per_trit));
+        else printf(" %12s", "-");
+        bench_loops = 1;
+        case_to_tern_horner();              // digits for the Horner reverse case
+        if (bits <= BENCH_HORNER_BITS) print_time(time_best(case_to_tern_horner));
+        else printf(" %12s", "-");
+        print_time(time_best(case_to_tern_tree));
+        printf(" │");
+        if (bits <= BENCH_HORNER_BITS) print_time(time_best(case_to_bin_horner));
+        else printf(" %12s", "-");
+        print_time(time_best(case_to_bin_tree));
+        printf("\n");
+    }
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    tritbig_free(&bench_x);
+    free(bench_bin);
+    free(bench_out);
+    free(bench_tmp);
+    free(bench_dig);
+    free(bench_trits);
+    return 0;
+}
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + a column in main)
+//   ✅ Size limits, repeat count, minimum run time
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
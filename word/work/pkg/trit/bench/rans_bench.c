@@ -0,0 +1,332 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Entropy-Coded Trit Streams
+// Key: B-word-work-pkg-trit-rans-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for rANS streams and backend dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/reduce_bench.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for rans.c - measures, does not judge.
+//
+// rans_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            every saved bit costs next to packing five trits a byte.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Size and throughput of trit_rans_* / trit5_rans_* on each
+//       backend, against trit5_pack_array / trit5_unpack_array.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Time encode and decode of trit_t and t5b1 buffers at three
+//          zero fractions (uniform, 90%, 99%), on every backend this CPU
+//          supports.
+//
+// Core Design: One trit buffer per skew, best-of-N wall time.
+//   - Reports M trits/s and the speedup over t5b1 packing
+//   - Prints bits per trit for each skew
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-rans
+// Run:         ./build/bench_rans [trits]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed or a round-trip differed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <string.h>   // memcmp
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "tritrans.h" // trit_rans_*
+#include "trit.h"     // trit5_pack_array, backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_TRITS  (20u * 1000u * 1000u)  // 20M trits (4 MB t5b1)
+#define BENCH_REPEATS        5                      // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main, refilled per skew)
+static trit_t *bench_trits = NULL;
+static trit_t *bench_back = NULL;
+static uint8_t *bench_packed = NULL;
+static uint8_t *bench_packed_back = NULL;
+static uint8_t *bench_enc = NULL;
+static uint8_t *bench_scratch = NULL;
+static size_t bench_enc_n = 0;
+static size_t bench_n = 0;
+
+// Sink keeps results observable
+static volatile size_t bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: trit rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double mts = (double)bench_n / seconds / 1e6;
+    printf("  %-36s %9.1f Mtrit/s  %6.2fx\n", name, mts, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+static uint32_t rng_state = 12345u;
+
+static uint32_t rng(void) {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+// fill writes trits that are zero with probability zero_pct / 100, else
+// ±1 with equal odds; zero_pct 0 means uniform over {-1, 0, +1}.
+static void fill(trit_t *t, size_t n, uint32_t zero_pct) {
+    for (size_t i = 0; i < n; i++) {
+        if (zero_pct == 0) {
+            t[i] = (trit_t)((int)(rng() % 3) - 1);
+        } else {
+            t[i] = rng() % 100u < zero_pct ? TRIT_ZERO
+                 : (rng() & 1) ? TRIT_POS : TRIT_NEG;
+        }
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+static void case_pack(void) {
+    trit5_pack_array(bench_trits, bench_n, bench_scratch);
+    bench_sink += bench_scratch[bench_n / 10];
+}
+
+static void case_unpack(void) {
+    trit5_unpack_array(bench_packed, bench_n, bench_back);
+    bench_sink += (size_t)(bench_back[bench_n / 2] + 1);
+}
+
+static void case_encode(void) {
+    bench_sink += trit_rans_encode(bench_trits, bench_n, bench_scratch);
+}
+
+static void case_encode5(void) {
+    bench_sink += trit5_rans_encode(bench_packed, bench_n, bench_scratch);
+}
+
+static void case_decode(void) {
+    bench_sink += trit_rans_decode(bench_enc, bench_enc_n, bench_back, bench_n);
+}
+
+static void case_decode5(void) {
+    bench_sink += trit5_rans_decode(bench_enc, bench_enc_n, bench_packed_back, bench_n);
+}
+
+// run_op times the t5b1 baseline, then fn on each supported backend.
+static void run_op(const char *title, const char *fn_name, void (*fn)(void),
+                   const char *base_name, void (*base)(void)) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+
+    printf("\n  %s:\n", title);
+    double baseline = time_best(base);
+    report(base_name, baseline, baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s [%s]", fn_name, trit_backend_name(backends[i]));
+        report(name, time_best(fn), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    static const uint32_t skews[] = { 0, 90, 99 };
+
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_TRITS;
+
+    bench_trits = malloc(bench_n + 1);
+    bench_back = malloc(bench_n + 1);
+    bench_packed = malloc(TRIT5_PACKED_SIZE(bench_n) + 1);
+    bench_packed_back = malloc(TRIT5_PACKED_SIZE(bench_n) + 1);
+    bench_enc = malloc(TRIT_RANS_BOUND(bench_n));
+    bench_scratch = malloc(TRIT_RANS_BOUND(bench_n));
+    if (!bench_trits || !bench_back || !bench_packed || !bench_packed_back ||
+        !bench_enc || !bench_scratch) {
+        printf("✗ Allocation failed for %zu trits\n", bench_n);
+        return 1;
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit rANS benchmarks: %zu trits (auto backend: %s)\n",
+           bench_n, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    for (size_t k = 0; k < sizeof(skews) / sizeof(skews[0]); k++) {
+        char title[96];
+
+        // Deterministic data per skew; checked once before timing
+        fill(bench_trits, bench_n, skews[k]);
+        trit5_pack_array(bench_trits, bench_n, bench_packed);
+        bench_enc_n = trit_rans_encode(bench_trits, bench_n, bench_enc);
+        if (trit_rans_decode(bench_enc, bench_enc_n, bench_back, bench_n) != bench_n ||
+            memcmp(bench_back, bench_trits, bench_n) != 0) {
+            printf("✗ Round-trip differs at %u%% zeros\n", (unsigned)skews[k]);
+            return 1;
+        }
+
+        const char *label = skews[k] == 0 ? "uniform" : skews[k] == 90 ? "90% zeros" : "99% zeros";
+        printf("\n%s → %zu bytes, %.4f bits/trit (t5b1: 1.6)\n",
+               label, bench_enc_n, 8.0 * (double)bench_enc_n / (double)bench_n);
+
+        snprintf(title, sizeof(title), "%s trit_t encode", label);
+        run_op(title, "trit_rans_encode", case_encode, "trit5_pack_array", case_pack);
+        snprintf(title, sizeof(title), "%s trit_t decode", label);
+        run_op(title, "trit_rans_decode", case_decode, "trit5_unpack_array", case_unpack);
+        snprintf(title, sizeof(title), "%s t5b1 encode", label);
+        run_op(title, "trit5_rans_encode", case_encode5, "trit5_pack_array", case_pack);
+        snprintf(title, sizeof(title), "%s t5b1 decode", label);
+        run_op(title, "trit5_rans_decode", case_decode5, "trit5_unpack_array", case_unpack);
+    }
+
+    printf("\n  (sink %zu)\n", (size_t)bench_sink);
+
+    free(bench_trits);
+    free(bench_back);
+    free(bench_packed);
+    free(bench_packed_back);
+    free(bench_enc);
+    free(bench_scratch);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + run_op line in main)
+//   ✅ Buffer size and the skews list in main
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
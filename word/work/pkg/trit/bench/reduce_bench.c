@@ -0,0 +1,332 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Sum, Histogram and Balance Reductions
+// Key: B-word-work-pkg-trit-reduce-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for reductions and backend dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/array_bench.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for reduce.c - measures, does not judge.
+//
+// reduce_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            reducing in the packed domain saves over unpacking first.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for unpack-and-loop vs packed reductions
+//       on each backend.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare trit5_unpack_array + a per-trit loop against
+//          trit5_count_array / trit5_stats_array, and a per-trit loop
+//          against trit_count_array / trit_stats_array, on every backend
+//          this CPU supports.
+//
+// Core Design: One random-walk buffer, best-of-N wall time.
+//   - Reports Mtrit/s and the speedup over the loop
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-reduce
+// Run:         ./build/bench_reduce [trits]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "tritreduce.h" // reductions
+#include "trit.h"     // trit5_pack_array / unpack_array, backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_TRITS  (50u * 1000u * 1000u)  // 50M trits (10 MB packed)
+#define BENCH_REPEATS        5                      // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main)
+static trit_t *bench_trits = NULL;
+static uint8_t *bench_packed = NULL;
+static trit_t *bench_scratch = NULL;
+static size_t bench_n = 0;
+
+// Sink keeps results observable
+static volatile int64_t bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: trit rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double mtrits = (double)bench_n / seconds / 1e6;
+    printf("  %-36s %9.1f Mtrit/s  %6.1fx\n", name, mtrits, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// walk_loop is the per-trit reference: counts, sum and extremes.
+static int64_t walk_loop(const trit_t *t, size_t n) {
+    uint64_t count[3] = { 0, 0, 0 };
+    int64_t bal = 0, lo = 0, hi = 0;
+    for (size_t i = 0; i < n; i++) {
+        bal += t[i];
+        count[TRIT_TO_UNSIGNED(t[i])]++;
+        lo = bal < lo ? bal : lo;
+        hi = bal > hi ? bal : hi;
+    }
+    return bal + lo + hi + (int64_t)count[0];
+}
+
+// count_loop is the per-trit histogram.
+static int64_t count_loop(const trit_t *t, size_t n) {
+    uint64_t count[3] = { 0, 0, 0 };
+    for (size_t i = 0; i < n; i++) {
+        count[TRIT_TO_UNSIGNED(t[i])]++;
+    }
+    return (int64_t)(count[0] + 2 * count[2]);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- t5b1: unpack the whole buffer, then loop ---
+
+static void case_unpack_count(void) {
+    trit5_unpack_array(bench_packed, bench_n, bench_scratch);
+    bench_sink += count_loop(bench_scratch, bench_n);
+}
+
+static void case_unpack_stats(void) {
+    trit5_unpack_array(bench_packed, bench_n, bench_scratch);
+    bench_sink += walk_loop(bench_scratch, bench_n);
+}
+
+//--- t5b1: packed domain ---
+
+static void case_trit5_count(void) {
+    uint64_t c[3];
+    trit5_count_array(bench_packed, bench_n, c);
+    bench_sink += (int64_t)(c[0] + 2 * c[2]);
+}
+
+static void case_trit5_stats(void) {
+    trit_stats_t s = trit5_stats_array(bench_packed, bench_n);
+    bench_sink += s.sum + s.min_prefix + s.max_prefix + (int64_t)s.count[0];
+}
+
+//--- trit_t arrays ---
+
+static void case_loop_count(void) {
+    bench_sink += count_loop(bench_trits, bench_n);
+}
+
+static void case_loop_stats(void) {
+    bench_sink += walk_loop(bench_trits, bench_n);
+}
+
+static void case_trit_count(void) {
+    uint64_t c[3];
+    trit_count_array(bench_trits, bench_n, c);
+    bench_sink += (int64_t)(c[0] + 2 * c[2]);
+}
+
+static void case_trit_stats(void) {
+    trit_stats_t s = trit_stats_array(bench_trits, bench_n);
+    bench_sink += s.sum + s.min_prefix + s.max_prefix + (int64_t)s.count[0];
+}
+
+// run_op times a baseline, then fn on each supported backend (the
+// baseline runs on the auto backend).
+static void run_op(const char *title, const char *base_name, void (*base)(void),
+                   const char *fn_name, void (*fn)(void)) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+
+    printf("\n  %s:\n", title);
+    double baseline = time_best(base);
+    report(base_name, baseline, baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s [%s]", fn_name, trit_backend_name(backends[i]));
+        report(name, time_best(fn), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_TRITS;
+
+    bench_trits = malloc(bench_n + 1);
+    bench_scratch = malloc(bench_n + 1);
+    bench_packed = malloc(TRIT5_PACKED_SIZE(bench_n) + 1);
+    if (!bench_trits || !bench_scratch || !bench_packed) {
+        printf("✗ Allocation failed for %zu trits\n", bench_n);
+        return 1;
+    }
+
+    // Deterministic pseudo-random trits (LCG): a random walk
+    uint32_t seed = 12345u;
+    for (size_t i = 0; i < bench_n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bench_trits[i] = (trit_t)((seed >> 16) % 3) - 1;
+    }
+    trit5_pack_array(bench_trits, bench_n, bench_packed);
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit reduction benchmarks: %zu trits (auto backend: %s)\n",
+           bench_n, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    run_op("t5b1 histogram + sum", "unpack_array + loop", case_unpack_count,
+           "trit5_count_array", case_trit5_count);
+    run_op("t5b1 stats (with balance extremes)", "unpack_array + loop", case_unpack_stats,
+           "trit5_stats_array", case_trit5_stats);
+    run_op("trit_t histogram + sum", "loop", case_loop_count,
+           "trit_count_array", case_trit_count);
+    run_op("trit_t stats (with balance extremes)", "loop", case_loop_stats,
+           "trit_stats_array", case_trit_stats);
+
+    printf("\n  (sink %lld)\n", (long long)bench_sink);
+
+    free(bench_trits);
+    free(bench_scratch);
+    free(bench_packed);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + run_op line in main)
+//   ✅ Buffer size and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
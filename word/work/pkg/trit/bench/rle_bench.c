@@ -0,0 +1,325 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Run-Length Streams
+// Key: B-word-work-pkg-trit-rle-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for run-length streams and backend dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/reduce_bench.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for rle.c - measures, does not judge.
+//
+// rle_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            folding runs costs next to copying the bytes as they are.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for trit5_rle_encode / trit5_rle_decode
+//       on each backend, against memcpy of the same bytes.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Time encode and decode of a zero-heavy t5b1 buffer (long runs
+//          of byte 121 between short random stretches) and of random
+//          t5b1 (incompressible), on every backend this CPU supports.
+//
+// Core Design: Two buffers, best-of-N wall time.
+//   - Reports GB/s of uncompressed bytes and the speedup over memcpy
+//   - Prints each buffer's compressed size
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-rle
+// Run:         ./build/bench_rle [bytes]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed or a round-trip differed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <string.h>   // memcpy, memcmp
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "tritrle.h"  // trit5_rle_*
+#include "trit.h"     // backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_BYTES  (64u * 1000u * 1000u)  // 64 MB (320M trits)
+#define BENCH_REPEATS        5                      // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main); bench_in / bench_enc / bench_enc_n
+// point at the data set being measured
+static uint8_t *bench_zeros = NULL;
+static uint8_t *bench_random = NULL;
+static uint8_t *bench_zeros_enc = NULL;
+static uint8_t *bench_random_enc = NULL;
+static size_t bench_zeros_n = 0;
+static size_t bench_random_n = 0;
+static uint8_t *bench_out = NULL;
+static size_t bench_n = 0;
+
+static const uint8_t *bench_in = NULL;
+static const uint8_t *bench_enc = NULL;
+static size_t bench_enc_n = 0;
+
+// Sink keeps results observable
+static volatile size_t bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: uncompressed byte rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double gbs = (double)bench_n / seconds / 1e9;
+    printf("  %-36s %9.2f GB/s    %6.2fx\n", name, gbs, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+static uint32_t rng_state = 12345u;
+
+static uint32_t rng(void) {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+// fill_zeros writes runs of 121 (mean ~1000 bytes) between random
+// stretches (mean ~30 bytes): about 97% all-zero groups.
+static void fill_zeros(uint8_t *buf, size_t n) {
+    size_t i = 0;
+    while (i < n) {
+        size_t run = 1 + rng() % 2000;
+        size_t lit = 1 + rng() % 60;
+        for (size_t k = 0; k < run && i < n; k++, i++) {
+            buf[i] = TRIT5_BIAS;
+        }
+        for (size_t k = 0; k < lit && i < n; k++, i++) {
+            buf[i] = (uint8_t)(rng() % 243);
+        }
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+static void case_memcpy(void) {
+    memcpy(bench_out, bench_in, bench_n);
+    bench_sink += bench_out[bench_n / 2];
+}
+
+static void case_encode(void) {
+    bench_sink += trit5_rle_encode(bench_in, bench_n, bench_out, NULL);
+}
+
+static void case_decode(void) {
+    bench_sink += trit5_rle_decode(bench_enc, bench_enc_n, bench_out, bench_n, NULL);
+}
+
+// run_op times memcpy, then fn on each supported backend.
+static void run_op(const char *title, const char *fn_name, void (*fn)(void)) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+
+    printf("\n  %s:\n", title);
+    double baseline = time_best(case_memcpy);
+    report("memcpy", baseline, baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s [%s]", fn_name, trit_backend_name(backends[i]));
+        report(name, time_best(fn), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// use_set points the cases at one data set.
+static void use_set(const uint8_t *in, const uint8_t *enc, size_t enc_n) {
+    bench_in = in;
+    bench_enc = enc;
+    bench_enc_n = enc_n;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_BYTES;
+
+    bench_zeros = malloc(bench_n + 1);
+    bench_random = malloc(bench_n + 1);
+    bench_zeros_enc = malloc(TRIT5_RLE_BOUND(bench_n) + 1);
+    bench_random_enc = malloc(TRIT5_RLE_BOUND(bench_n) + 1);
+    bench_out = malloc(TRIT5_RLE_BOUND(bench_n) + 1);
+    if (!bench_zeros || !bench_random || !bench_zeros_enc || !bench_random_enc || !bench_out) {
+        printf("✗ Allocation failed for %zu bytes\n", bench_n);
+        return 1;
+    }
+
+    // Deterministic data: zero-heavy, and uniform t5b1 bytes
+    fill_zeros(bench_zeros, bench_n);
+    for (size_t i = 0; i < bench_n; i++) {
+        bench_random[i] = (uint8_t)(rng() % 243);
+    }
+    bench_zeros_n = trit5_rle_encode(bench_zeros, bench_n, bench_zeros_enc, NULL);
+    bench_random_n = trit5_rle_encode(bench_random, bench_n, bench_random_enc, NULL);
+    if (trit5_rle_decode(bench_zeros_enc, bench_zeros_n, bench_out, bench_n, NULL) != bench_n ||
+        memcmp(bench_out, bench_zeros, bench_n) != 0) {
+        printf("✗ Zero-heavy round-trip differs\n");
+        return 1;
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit run-length benchmarks: %zu bytes (auto backend: %s)\n",
+           bench_n, trit_backend_name(trit_backend_active()));
+    printf("  zero-heavy → %zu bytes (%.2f%%), random → %zu bytes (%.2f%%)\n",
+           bench_zeros_n, 100.0 * (double)bench_zeros_n / (double)bench_n,
+           bench_random_n, 100.0 * (double)bench_random_n / (double)bench_n);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    use_set(bench_zeros, bench_zeros_enc, bench_zeros_n);
+    run_op("zero-heavy t5b1 encode", "trit5_rle_encode", case_encode);
+    run_op("zero-heavy t5b1 decode", "trit5_rle_decode", case_decode);
+
+    use_set(bench_random, bench_random_enc, bench_random_n);
+    run_op("random t5b1 encode (incompressible)", "trit5_rle_encode", case_encode);
+    run_op("random t5b1 decode (incompressible)", "trit5_rle_decode", case_decode);
+
+    printf("\n  (sink %zu)\n", (size_t)bench_sink);
+
+    free(bench_zeros);
+    free(bench_random);
+    free(bench_zeros_enc);
+    free(bench_random_enc);
+    free(bench_out);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + run_op line in main)
+//   ✅ Buffer size, run and stretch lengths in fill_zeros
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,384 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Prefix Sums and Navigation Scans
+// Key: B-word-work-pkg-trit-scan-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for scans and backend dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/reduce_bench.c (structure)
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Carry Propagation]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for scan.c - measures, does not judge.
+//
+// scan_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            scanning in blocks saves over folding one trit at a time.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for serial folds vs the SIMD scans on
+//       each backend, and the cost of the blocked two-pass form.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare a per-trit running sum against trit_prefix_sum_i32 /
+//          _i64, and a per-trit trit_navigate fold against
+//          trit_navigate_scan, on every backend this CPU supports; then
+//          time both passes of the blocked form on one thread, and the
+//          _mt scans at 1, 2, 4 and 8 threads.
+//
+// Core Design: One random buffer, best-of-N wall time.
+//   - Reports Mtrit/s and the speedup over the loop
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-scan
+// Run:         ./build/bench_scan [trits]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <time.h>     // clock_gettime
+
+//--- Platform ---
+#include <unistd.h>   // sysconf
+
+//--- Project Headers ---
+#include "tritscan.h"   // prefix sums
+#include "tritreduce.h" // trit_sum_array
+#include "trit.h"       // backends
+#include "dimension.h"  // trit_navigate, trit_navigate_scan / _map
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_TRITS  (20u * 1000u * 1000u)  // 20M trits (160 MB of int64)
+#define BENCH_REPEATS        5                      // best-of-N
+#define BENCH_BLOCK          (1u << 16)             // trits per block, blocked form
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main)
+static trit_t *bench_trits = NULL;
+static trit_t *bench_nav = NULL;
+static int32_t *bench_sum32 = NULL;
+static int64_t *bench_sum64 = NULL;
+static size_t bench_n = 0;
+static unsigned bench_threads = 1;
+
+// Sink keeps results observable
+static volatile int64_t bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: trit rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double mtrits = (double)bench_n / seconds / 1e6;
+    printf("  %-36s %9.1f Mtrit/s  %6.1fx\n", name, mtrits, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- Serial folds ---
+
+static void case_loop_sum32(void) {
+    int32_t acc = 0;
+    for (size_t i = 0; i < bench_n; i++) {
+        acc += bench_trits[i];
+        bench_sum32[i] = acc;
+    }
+    bench_sink += bench_sum32[bench_n / 2];
+}
+
+static void case_loop_sum64(void) {
+    int64_t acc = 0;
+    for (size_t i = 0; i < bench_n; i++) {
+        acc += bench_trits[i];
+        bench_sum64[i] = acc;
+    }
+    bench_sink += bench_sum64[bench_n / 2];
+}
+
+static void case_loop_nav(void) {
+    trit_t s = TRIT_ZERO;
+    for (size_t i = 0; i < bench_n; i++) {
+        s = trit_navigate(s, (direction_t)bench_trits[i]);
+        bench_nav[i] = s;
+    }
+    bench_sink += bench_nav[bench_n / 2];
+}
+
+//--- Library scans ---
+
+static void case_sum32(void) {
+    bench_sink += trit_prefix_sum_i32(bench_trits, bench_n, 0, bench_sum32);
+}
+
+static void case_sum64(void) {
+    bench_sink += trit_prefix_sum_i64(bench_trits, bench_n, 0, bench_sum64);
+}
+
+static void case_nav(void) {
+    bench_sink += trit_navigate_scan(bench_trits, bench_n, TRIT_ZERO, bench_nav);
+}
+
+//--- Blocked two-pass form (one thread; each pass splits across threads) ---
+
+static void case_blocked_sum64(void) {
+    int64_t carry = 0;
+    for (size_t at = 0; at < bench_n; at += BENCH_BLOCK) {
+        size_t len = bench_n - at < BENCH_BLOCK ? bench_n - at : BENCH_BLOCK;
+        bench_sum64[at] = carry;  // the per-block carry a pass two would read
+        carry += trit_sum_array(bench_trits + at, len);
+    }
+    for (size_t at = 0; at < bench_n; at += BENCH_BLOCK) {
+        size_t len = bench_n - at < BENCH_BLOCK ? bench_n - at : BENCH_BLOCK;
+        trit_prefix_sum_i64(bench_trits + at, len, bench_sum64[at], bench_sum64 + at);
+    }
+    bench_sink += carry;
+}
+
+static void case_blocked_nav(void) {
+    trit_t s = TRIT_ZERO;
+    for (size_t at = 0; at < bench_n; at += BENCH_BLOCK) {
+        size_t len = bench_n - at < BENCH_BLOCK ? bench_n - at : BENCH_BLOCK;
+        trit_t map[3];
+        trit_navigate_map(bench_trits + at, len, map);
+        bench_nav[at] = s;
+        s = map[TRIT_TO_UNSIGNED(s)];
+    }
+    for (size_t at = 0; at < bench_n; at += BENCH_BLOCK) {
+        size_t len = bench_n - at < BENCH_BLOCK ? bench_n - at : BENCH_BLOCK;
+        trit_navigate_scan(bench_trits + at, len, bench_nav[at], bench_nav + at);
+    }
+    bench_sink += s;
+}
+
+//--- Threaded scans ---
+
+static void case_sum64_mt(void) {
+    bench_sink += trit_prefix_sum_i64_mt(bench_trits, bench_n, 0, bench_sum64, bench_threads);
+}
+
+static void case_nav_mt(void) {
+    bench_sink += trit_navigate_scan_mt(bench_trits, bench_n, TRIT_ZERO, bench_nav, bench_threads);
+}
+
+// run_threads times fn at 1, 2, 4 and 8 threads on the auto backend,
+// against a baseline.
+static void run_threads(const char *title, const char *base_name, void (*base)(void),
+                        const char *fn_name, void (*fn)(void)) {
+    static const unsigned counts[] = { 1, 2, 4, 8 };
+    char name[64];
+
+    printf("\n  %s:\n", title);
+    double baseline = time_best(base);
+    report(base_name, baseline, baseline);
+    for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+        bench_threads = counts[i];
+        snprintf(name, sizeof(name), "%s [%u threads]", fn_name, counts[i]);
+        report(name, time_best(fn), baseline);
+    }
+}
+
+// run_op times a baseline, then fn on each supported backend (the
+// baseline runs on the auto backend).
+static void run_op(const char *title, const char *base_name, void (*base)(void),
+                   const char *fn_name, void (*fn)(void)) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+
+    printf("\n  %s:\n", title);
+    double baseline = time_best(base);
+    report(base_name, baseline, baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s [%s]", fn_name, trit_backend_name(backends[i]));
+        report(name, time_best(fn), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_TRITS;
+
+    bench_trits = malloc(bench_n + 1);
+    bench_nav = malloc(bench_n + 1);
+    bench_sum32 = malloc((bench_n + 1) * sizeof(int32_t));
+    bench_sum64 = malloc((bench_n + 1) * sizeof(int64_t));
+    if (!bench_trits || !bench_nav || !bench_sum32 || !bench_sum64) {
+        printf("✗ Allocation failed for %zu trits\n", bench_n);
+        return 1;
+    }
+
+    // Deterministic pseudo-random trits (LCG)
+    uint32_t seed = 12345u;
+    for (size_t i = 0; i < bench_n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bench_trits[i] = (trit_t)((seed >> 16) % 3) - 1;
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit scan benchmarks: %zu trits (auto backend: %s)\n",
+           bench_n, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    run_op("inclusive prefix sum -> int32", "loop", case_loop_sum32,
+           "trit_prefix_sum_i32", case_sum32);
+    run_op("inclusive prefix sum -> int64", "loop", case_loop_sum64,
+           "trit_prefix_sum_i64", case_sum64);
+    run_op("int64, blocked two-pass (sum, then scan)", "loop", case_loop_sum64,
+           "two-pass", case_blocked_sum64);
+    run_op("navigation scan (saturating balance)", "trit_navigate loop", case_loop_nav,
+           "trit_navigate_scan", case_nav);
+    run_op("navigation, blocked two-pass (map, then scan)", "trit_navigate loop", case_loop_nav,
+           "two-pass", case_blocked_nav);
+
+    printf("\n  Thread scaling (%ld online CPUs):\n", sysconf(_SC_NPROCESSORS_ONLN));
+    run_threads("int64 prefix sum, threads", "loop", case_loop_sum64,
+                "trit_prefix_sum_i64_mt", case_sum64_mt);
+    run_threads("navigation scan, threads", "trit_navigate loop", case_loop_nav,
+                "trit_navigate_scan_mt", case_nav_mt);
+
+    printf("\n  (sink %lld)\n", (long long)bench_sink);
+
+    free(bench_trits);
+    free(bench_nav);
+    free(bench_sum32);
+    free(bench_sum64);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + run_op line in main)
+//   ✅ Buffer size, block size and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,304 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Arbitrary-Precision Integers
+// Key: B-word-work-pkg-trit-tritbig-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for tritbig operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Division]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Timing benchmarks for tritbig.c - measures, does not judge.
+//
+// tritbig_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show where
+//            each multiplication algorithm starts paying for itself.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Timing for tritbig multiplication and division.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Find the schoolbook/Karatsuba/Toom-3 crossovers and time
+//          mul and divmod from 1K to 1M trits.
+//
+// Core Design: Random operands, best-of-N wall time.
+//   - Crossover table: each algorithm forced via tritbig_set_mul_thresholds
+//   - Size table: schoolbook, Karatsuba-only and default (Toom-3) mul,
+//     then divmod of a 2n-trit dividend by an n-trit divisor
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-tritbig
+// Run:         ./build/bench_tritbig [max trits]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "tritbig.h"  // tritbig operations
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_TRITS  1000000u   // largest size in the size table
+#define BENCH_SCHOOL_TRITS   100000u    // schoolbook stops here (O(n^2))
+#define BENCH_DIV_TRITS      100000u    // divmod stops here (O(n·m))
+#define BENCH_REPEATS        5          // best-of-N
+#define BENCH_MIN_SECONDS    0.02       // small cases loop at least this long
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared operands (set up per size in main)
+static tritbig_t bench_a = TRITBIG_INIT;
+static tritbig_t bench_b = TRITBIG_INIT;
+static tritbig_t bench_r = TRITBIG_INIT;
+static tritbig_t bench_q = TRITBIG_INIT;
+static size_t bench_loops = 1;         // calls per timed run
+static trit_t *bench_trits = NULL;     // scratch for random operands
+static uint64_t bench_seed = 12345u;
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static double time_best(void (*fn)(void));
+static void rand_operand(tritbig_t *x, size_t trits);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time per call.
+// bench_loops is first raised until one run lasts BENCH_MIN_SECONDS.
+static double time_best(void (*fn)(void)) {
+    bench_loops = 1;
+    for (;;) {
+        double t0 = now_seconds();
+        fn();
+        if (now_seconds() - t0 >= BENCH_MIN_SECONDS || bench_loops >= (1u << 20)) break;
+        bench_loops *= 4;
+    }
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best / (double)bench_loops;
+}
+
+// Set x to a random number of exactly `trits` trits (top trit nonzero)
+static void rand_operand(tritbig_t *x, size_t trits) {
+    for (size_t i = 0; i < trits; i++) {
+        bench_seed = bench_seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        bench_trits[i] = (trit_t)((int)((bench_seed >> 33) % 3) - 1);
+    }
+    bench_trits[0] = TRIT_POS;
+    tritbig_from_trits(x, bench_trits, trits);
+}
+
+// Format a time with a unit that keeps 3-4 significant digits
+static void print_time(double seconds) {
+    if (seconds < 1e-3) printf(" %9.2f µs", seconds * 1e6);
+    else if (seconds < 1.0) printf(" %9.2f ms", seconds * 1e3);
+    else printf(" %9.2f s ", seconds);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+static void case_mul(void) {
+    for (size_t i = 0; i < bench_loops; i++) tritbig_mul(&bench_r, &bench_a, &bench_b);
+    bench_sink += (unsigned)bench_r.len;
+}
+
+static void case_divmod(void) {
+    for (size_t i = 0; i < bench_loops; i++) tritbig_divmod(&bench_q, &bench_r, &bench_a, &bench_b);
+    bench_sink += (unsigned)(bench_q.len + bench_r.len);
+}
+
+// Time mul under one threshold pair (then restore defaults)
+static double time_mul(size_t karatsuba, size_t toom3) {
+    tritbig_set_mul_thresholds(karatsuba, toom3);
+    double t = time_best(case_mul);
+    tritbig_set_mul_thresholds(0, 0);
+    return t;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    size_t max_trits = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_TRITS;
+    if (max_trits < 1000) max_trits = 1000;
+
+    bench_trits = malloc(2 * max_trits);
+    if (!bench_trits) {
+        printf("✗ Allocation failed for %zu trits\n", max_trits);
+        return 1;
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit tritbig benchmarks (defaults: Karatsuba ≥ %u limbs, Toom-3 ≥ %u limbs)\n",
+           TRITBIG_KARATSUBA_THRESHOLD, TRITBIG_TOOM3_THRESHOLD);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    //--- Crossovers: n × n limbs, each algorithm forced at the top level ---
+    printf("\n  mul crossover, n × n limbs (%d trits each):\n", TRITBIG_LIMB_TRITS);
+    printf("  %6s %12s %12s %12s\n", "limbs", "schoolbook", "karatsuba", "toom-3");
+    static const size_t cross[] = { 32, 64, 96, 128, 192, 256, 384, 512, 768, 1024 };
+    for (size_t c = 0; c < sizeof(cross) / sizeof(cross[0]); c++) {
+        size_t n = cross[c];
+        if (n * TRITBIG_LIMB_TRITS > max_trits) break;
+        rand_operand(&bench_a, n * TRITBIG_LIMB_TRITS);
+        rand_operand(&bench_b, n * TRITBIG_LIMB_TRITS);
+        // One level of the forced algorithm, schoolbook below it
+        printf("  %6zu", n);
+        print_time(time_mul(SIZE_MAX, SIZE_MAX));
+        print_time(time_mul(n, SIZE_MAX));
+        print_time(time_mul(n, n));
+        printf("\n");
+    }
+
+    //--- Sizes: 1K .. max trits ---
+    printf("\n  n × n trits (defaults below the forced top level):\n");
+    printf("  %9s %12s %12s %12s %12s\n", "trits", "schoolbook", "karatsuba", "default", "divmod 2n/n");
+    for (size_t n = 1000; n <= max_trits; n *= 10) {
+        rand_operand(&bench_a, n);
+        rand_operand(&bench_b, n);
+        printf("  %9zu", n);
+        if (n <= BENCH_SCHOOL_TRITS) print_time(time_mul(SIZE_MAX, SIZE_MAX));
+        else printf(" %12s", "-");
+        print_time(time_mul(0, SIZE_MAX));
+        print_time(time_mul(0, 0));
+        if (n <= BENCH_DIV_TRITS) {
+            rand_operand(&bench_a, 2 * n);
+            print_time(time_best(case_divmod));
+        } else {
+            printf(" %12s", "-");
+        }
+        printf("\n");
+    }
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    tritbig_free(&bench_a);
+    tritbig_free(&bench_b);
+    tritbig_free(&bench_r);
+    tritbig_free(&bench_q);
+    free(bench_trits);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + a column in main)
+//   ✅ Size tables, repeat count, minimum run time
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Retune TRITBIG_*_THRESHOLD from the
+// crossover table on the target machine. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,356 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Delta-Coded Integer Columns
+// Key: B-word-work-pkg-trit-tritcol-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for tritcol.h and backend dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/vartrit_bench.c (structure)
+// See: word/scripture/kjv-ordinal-index.adoc (monotone verse ordinals)
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for tritcol.c - measures, does not judge.
+//
+// tritcol_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            a delta-coded column costs next to a plain int64 array.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Size, scan and range-count throughput of tritcol columns on
+//       each backend, against the same values as a plain int64 array.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Time a full scan (sum of every value), a range count over
+//          about 1% of the value range, and encoding, for three column
+//          shapes: sorted postings, a score walk, and timestamps.
+//
+// Core Design: One value array and one column per shape, best-of-N wall
+//   time.
+//   - Reports M values/s and the speedup over the plain array
+//   - Prints bytes per value of the column (the array takes 8)
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-tritcol
+// Run:         ./build/bench_tritcol [values]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed or a round-trip differed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <string.h>   // memcpy, memcmp
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "tritcol.h"  // tritcol_*, TRITCOL_*
+#include "trit.h"     // backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_VALUES  (8u * 1000u * 1000u)  // 8M int64 (64 MB)
+#define BENCH_REPEATS         5                     // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main, refilled per shape)
+static int64_t *bench_values = NULL;
+static int64_t *bench_back = NULL;
+static uint8_t *bench_col = NULL;
+static uint8_t *bench_scratch = NULL;
+static size_t bench_col_n = 0;
+static size_t bench_n = 0;
+static int64_t bench_lo = 0;
+static int64_t bench_hi = 0;
+
+// Sink keeps results observable
+static volatile size_t bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: value rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double mvs = (double)bench_n / seconds / 1e6;
+    printf("  %-36s %9.1f Mval/s   %6.2fx\n", name, mvs, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+static uint64_t rng_state = 12345u;
+
+static uint64_t rng(void) {
+    rng_state = rng_state * 6364136223846793005u + 1442695040888963407u;
+    return rng_state >> 11;
+}
+
+// fill writes one shape: 0 = postings (sorted, gaps 1-12), 1 = score
+// walk (±3 per step), 2 = timestamps (every 60 s, ±2 s jitter).
+static void fill(int64_t *v, size_t n, int shape) {
+    int64_t x = shape == 2 ? INT64_C(1765670400) : 0;
+    for (size_t i = 0; i < n; i++) {
+        if (shape == 0) {
+            x += 1 + (int64_t)(rng() % 12);
+            v[i] = x;
+        } else if (shape == 1) {
+            x += (int64_t)(rng() % 7) - 3;
+            v[i] = x;
+        } else {
+            v[i] = x + 60 * (int64_t)i + (int64_t)(rng() % 5) - 2;
+        }
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+static void case_plain_sum(void) {
+    uint64_t s = 0;
+    for (size_t i = 0; i < bench_n; i++) {
+        s += (uint64_t)bench_values[i];
+    }
+    bench_sink += (size_t)s;
+}
+
+static void case_sum(void) {
+    tritcol_reader_t r;
+    int64_t block[TRITCOL_BLOCK];
+    uint64_t s = 0;
+    tritcol_reader_init(&r, bench_col, bench_col_n);
+    while (tritcol_next(&r)) {
+        size_t n = tritcol_read(&r, block);
+        for (size_t i = 0; i < n; i++) {
+            s += (uint64_t)block[i];
+        }
+    }
+    bench_sink += (size_t)s;
+}
+
+static void case_plain_range(void) {
+    size_t c = 0;
+    for (size_t i = 0; i < bench_n; i++) {
+        c += (size_t)((bench_values[i] >= bench_lo) & (bench_values[i] <= bench_hi));
+    }
+    bench_sink += c;
+}
+
+static void case_range(void) {
+    bench_sink += tritcol_count_range(bench_col, bench_col_n, bench_lo, bench_hi);
+}
+
+static void case_memcpy(void) {
+    memcpy(bench_back, bench_values, bench_n * sizeof(int64_t));
+    bench_sink += (size_t)bench_back[bench_n / 2];
+}
+
+static void case_encode(void) {
+    bench_sink += tritcol_encode(bench_values, bench_n, TRITCOL_AUTO, bench_scratch);
+}
+
+// run_op times the plain-array baseline, then fn on each supported backend.
+static void run_op(const char *title, const char *fn_name, void (*fn)(void),
+                   const char *base_name, void (*base)(void)) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+
+    printf("\n  %s:\n", title);
+    double baseline = time_best(base);
+    report(base_name, baseline, baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s [%s]", fn_name, trit_backend_name(backends[i]));
+        report(name, time_best(fn), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    static const char *const labels[] = { "postings", "score walk", "timestamps" };
+
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_VALUES;
+
+    bench_values = malloc(bench_n * sizeof(int64_t) + 1);
+    bench_back = malloc(bench_n * sizeof(int64_t) + 1);
+    bench_col = malloc(TRITCOL_BOUND(bench_n) + 1);
+    bench_scratch = malloc(TRITCOL_BOUND(bench_n) + 1);
+    if (!bench_values || !bench_back || !bench_col || !bench_scratch || bench_n < 200) {
+        printf("✗ Allocation failed for %zu values (or fewer than 200)\n", bench_n);
+        return 1;
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit column benchmarks: %zu int64 values (auto backend: %s)\n",
+           bench_n, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    for (int k = 0; k < 3; k++) {
+        char title[96];
+
+        // Deterministic data per shape; checked once before timing
+        fill(bench_values, bench_n, k);
+        bench_col_n = tritcol_encode(bench_values, bench_n, TRITCOL_AUTO, bench_col);
+        if (tritcol_decode(bench_col, bench_col_n, bench_back, bench_n) != bench_n ||
+            memcmp(bench_back, bench_values, bench_n * sizeof(int64_t)) != 0) {
+            printf("✗ Round-trip differs for %s\n", labels[k]);
+            return 1;
+        }
+
+        // Range: about 1% of the spread of values, from the middle
+        int64_t lo = bench_values[0], hi = bench_values[0];
+        for (size_t i = 0; i < bench_n; i++) {
+            lo = bench_values[i] < lo ? bench_values[i] : lo;
+            hi = bench_values[i] > hi ? bench_values[i] : hi;
+        }
+        bench_lo = lo + (hi - lo) / 2;
+        bench_hi = bench_lo + (hi - lo) / 100;
+        size_t hits = tritcol_count_range(bench_col, bench_col_n, bench_lo, bench_hi);
+
+        printf("\n%s: %.3f bytes/value (int64 array 8), range keeps %.2f%% of values\n",
+               labels[k], (double)bench_col_n / (double)bench_n,
+               100.0 * (double)hits / (double)bench_n);
+
+        snprintf(title, sizeof(title), "%s full scan (sum)", labels[k]);
+        run_op(title, "tritcol reader + sum", case_sum, "int64 array sum", case_plain_sum);
+        snprintf(title, sizeof(title), "%s range count", labels[k]);
+        run_op(title, "tritcol_count_range", case_range, "int64 array count", case_plain_range);
+        snprintf(title, sizeof(title), "%s encode", labels[k]);
+        run_op(title, "tritcol_encode (AUTO)", case_encode, "memcpy", case_memcpy);
+    }
+
+    printf("\n  (sink %zu)\n", (size_t)bench_sink);
+
+    free(bench_values);
+    free(bench_back);
+    free(bench_col);
+    free(bench_scratch);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + run_op line in main)
+//   ✅ Value count, shapes and range width in main
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
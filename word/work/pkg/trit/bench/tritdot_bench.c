@@ -0,0 +1,304 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Ternary × Ternary Products
+// Key: B-word-work-pkg-trit-tritdot-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for popcount products and backend dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/array_bench.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 2: BCT Parallel]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for tritdot.c - measures, does not judge.
+//
+// tritdot_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            popcounting bit-planes saves over one trit_multiply per pair.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for similarity scoring: one query (GEMV)
+//       or a block of queries (GEMM) against a ternary collection.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare a trit_multiply loop over trit_t rows against
+//          tritmat_gemv_t64b / tritmat_gemm_t64b on every backend.
+//
+// Core Design: One collection, best-of-N wall time.
+//   - Reports G trit products/s and the speedup over the loop
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-tritdot
+// Run:         ./build/bench_tritdot [rows] [cols]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <string.h>   // memset
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "trit.h"     // trit_multiply, backends
+#include "tritmat.h"  // tritmat_pack_t64b, gemv/gemm_t64b
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_ROWS   20000      // collection size
+#define BENCH_DEFAULT_COLS   1024       // trits per vector
+#define BENCH_BATCH          16         // GEMM queries (one batch block)
+#define BENCH_REPEATS        5          // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main)
+static trit_t *bench_w = NULL;          // collection as trit_t
+static trit_t *bench_x = NULL;          // queries as trit_t
+static trit64b_t *bench_wv = NULL;      // collection as planes
+static trit64b_t *bench_xv = NULL;      // queries as planes
+static int32_t *bench_y = NULL;
+static size_t bench_rows = 0;
+static size_t bench_cols = 0;
+static size_t bench_batch = 1;
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: product rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double gops = (double)bench_rows * (double)bench_cols * (double)bench_batch / seconds / 1e9;
+    printf("  %-36s %8.2f Gtrit/s  %7.1fx\n", name, gops, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- Baseline: one trit_multiply per pair ---
+
+static void case_loop(void) {
+    for (size_t r = 0; r < bench_rows; r++) {
+        for (size_t b = 0; b < bench_batch; b++) {
+            const trit_t *w = bench_w + r * bench_cols;
+            const trit_t *x = bench_x + b * bench_cols;
+            int32_t acc = 0;
+            for (size_t c = 0; c < bench_cols; c++) {
+                acc += trit_multiply(w[c], x[c]);
+            }
+            bench_y[r * bench_batch + b] = acc;
+        }
+    }
+    bench_sink += (unsigned)bench_y[bench_rows / 2];
+}
+
+//--- Popcount: active backend ---
+
+static void case_gemv(void) {
+    tritmat_gemv_t64b(bench_wv, bench_rows, bench_cols, bench_xv, bench_y);
+    bench_sink += (unsigned)bench_y[bench_rows / 2];
+}
+
+static void case_gemm(void) {
+    tritmat_gemm_t64b(bench_wv, bench_rows, bench_cols, bench_xv, bench_batch, bench_y);
+    bench_sink += (unsigned)bench_y[bench_rows / 2];
+}
+
+// run_op times the loop, then the popcount form on each supported backend.
+static void run_op(const char *op, void (*fn)(void)) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+
+    printf("\n  %s (%zu×%zu, batch %zu):\n", op, bench_rows, bench_cols, bench_batch);
+    double baseline = time_best(case_loop);
+    report("trit_multiply loop", baseline, baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "tritmat_%s_t64b [%s]", op, trit_backend_name(backends[i]));
+        report(name, time_best(fn), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_rows = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_ROWS;
+    bench_cols = (argc > 2) ? (size_t)strtoul(argv[2], NULL, 10) : BENCH_DEFAULT_COLS;
+
+    size_t nv = TRITMAT_ROW_VECTORS(bench_cols);
+    bench_w = malloc(bench_rows * bench_cols);
+    bench_x = malloc(BENCH_BATCH * bench_cols);
+    bench_wv = malloc(bench_rows * nv * sizeof(trit64b_t));
+    bench_xv = malloc(BENCH_BATCH * nv * sizeof(trit64b_t));
+    bench_y = malloc(bench_rows * BENCH_BATCH * sizeof(int32_t));
+    if (!bench_w || !bench_x || !bench_wv || !bench_xv || !bench_y) {
+        printf("✗ Allocation failed for %zu×%zu\n", bench_rows, bench_cols);
+        return 1;
+    }
+    memset(bench_y, 0, bench_rows * BENCH_BATCH * sizeof(int32_t));
+
+    // Deterministic pseudo-random trits (LCG)
+    uint32_t seed = 12345u;
+    for (size_t i = 0; i < bench_rows * bench_cols; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bench_w[i] = (trit_t)((seed >> 16) % 3) - 1;
+    }
+    for (size_t i = 0; i < BENCH_BATCH * bench_cols; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bench_x[i] = (trit_t)((seed >> 16) % 3) - 1;
+    }
+    tritmat_pack_t64b(bench_w, bench_rows, bench_cols, bench_wv);
+    tritmat_pack_t64b(bench_x, BENCH_BATCH, bench_cols, bench_xv);
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit ternary dot benchmarks: %zu vectors × %zu trits (auto backend: %s)\n",
+           bench_rows, bench_cols, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    bench_batch = 1;
+    run_op("gemv", case_gemv);
+    bench_batch = BENCH_BATCH;
+    run_op("gemm", case_gemm);
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    free(bench_w);
+    free(bench_x);
+    free(bench_wv);
+    free(bench_xv);
+    free(bench_y);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + run_op entry)
+//   ✅ Collection size, batch and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,384 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Memory-Mapped .t5 Trit Files
+// Key: B-word-work-pkg-trit-tritfile-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for tritfile.h and backend dispatch. Writes
+//   and removes build/tritfile_bench.t5.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/tritcol_bench.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Memory Alignment]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for tritfile.c - measures, does not judge.
+//
+// tritfile_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            a mapped .t5 file costs next to reading and unpacking it.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Open, random-access, slice and full-pass costs of a mapped .t5
+//       file, against fread + trit5_unpack_array into a trit_t array.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Time (1) opening a file and reading one trit, (2) random
+//          single-trit reads, (3) random 4096-trit slices, and (4) a sum
+//          over every trit, each against the fread-and-unpack path.
+//
+// Core Design: One file written once, best-of-N wall time. The file is in
+//   the page cache after writing, so these are warm-cache numbers; a cold
+//   file adds disk reads to both paths (all of them to fread, only the
+//   touched pages to the mapping).
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-tritfile
+// Run:         ./build/bench_tritfile [trits]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation, write or open failed, or a read-back differed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>     // printf, fopen, fread, remove
+#include <stdlib.h>    // malloc, free, strtoul
+#include <string.h>    // memcpy, memcmp
+#include <time.h>      // clock_gettime
+
+//--- Project Headers ---
+#include "tritfile.h"  // tritfile_*, TRITFILE_*
+#include "tritreduce.h" // trit5_sum_array, trit_sum_array
+#include "trit.h"      // trit5_*, backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_PATH            "build/tritfile_bench.t5"
+#define BENCH_DEFAULT_TRITS   (100u * 1000u * 1000u)  // 100M trits (20 MB file)
+#define BENCH_REPEATS         5                       // best-of-N
+#define BENCH_GETS            (1u << 20)              // random single-trit reads
+#define BENCH_SLICES          2048                    // random slices
+#define BENCH_SLICE_TRITS     4096                    // trits per slice
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main)
+static trit_t *bench_trits = NULL;     // unpacked source (the fread path's result)
+static uint8_t *bench_packed = NULL;   // t5b1 source, reused as fread buffer
+static trit_t *bench_out = NULL;       // slice output
+static uint64_t *bench_index = NULL;   // random positions
+static tritfile_t bench_file;
+static size_t bench_n = 0;
+
+// Sink keeps results observable
+static volatile size_t bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double count, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: wall time, trit rate and speedup over baseline
+static void report(const char *name, double count, double seconds, double baseline) {
+    printf("  %-36s %9.3f ms %9.1f Mtrit/s   %8.2fx\n", name, seconds * 1e3,
+           count / seconds / 1e6, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+static uint64_t rng_state = 12345u;
+
+static uint64_t rng(void) {
+    rng_state = rng_state * 6364136223846793005u + 1442695040888963407u;
+    return rng_state >> 11;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+// The path without a mapping: read the file, unpack it, then look
+static void case_fread_unpack(void) {
+    FILE *fp = fopen(BENCH_PATH, "rb");
+    if (fp == NULL) {
+        return;
+    }
+    uint8_t head[TRITFILE_HEAD];
+    size_t got = fread(head, 1, TRITFILE_HEAD, fp);
+    long offset = (long)head[32] | (long)head[33] << 8 | (long)head[34] << 16 | (long)head[35] << 24;
+    fseek(fp, offset, SEEK_SET);
+    got += fread(bench_packed, 1, TRIT5_PACKED_SIZE(bench_n), fp);
+    fclose(fp);
+    trit5_unpack_array(bench_packed, bench_n, bench_trits);
+    bench_sink += got + (size_t)(bench_trits[bench_n / 2] + 1);
+}
+
+static void case_open_get(void) {
+    tritfile_t f;
+    if (tritfile_open(&f, BENCH_PATH) != TRITFILE_OK) {
+        return;
+    }
+    bench_sink += (size_t)(tritfile_get(&f, bench_n / 2) + 1);
+    tritfile_close(&f);
+}
+
+static void case_array_gets(void) {
+    size_t s = 0;
+    for (size_t i = 0; i < BENCH_GETS; i++) {
+        s += (size_t)(bench_trits[bench_index[i]] + 1);
+    }
+    bench_sink += s;
+}
+
+static void case_file_gets(void) {
+    size_t s = 0;
+    for (size_t i = 0; i < BENCH_GETS; i++) {
+        s += (size_t)(tritfile_get(&bench_file, bench_index[i]) + 1);
+    }
+    bench_sink += s;
+}
+
+static void case_array_slices(void) {
+    for (size_t i = 0; i < BENCH_SLICES; i++) {
+        memcpy(bench_out, bench_trits + bench_index[i], BENCH_SLICE_TRITS);
+        bench_sink += (size_t)(bench_out[i] + 1);
+    }
+}
+
+static void case_file_slices(void) {
+    for (size_t i = 0; i < BENCH_SLICES; i++) {
+        bench_sink += tritfile_slice(&bench_file, bench_index[i], BENCH_SLICE_TRITS, bench_out);
+    }
+}
+
+static void case_array_sum(void) {
+    bench_sink += (size_t)trit_sum_array(bench_trits, bench_n);
+}
+
+static void case_chunk_sum(void) {
+    int64_t s = 0;
+    for (size_t k = 0; k < bench_file.chunks; k++) {
+        size_t n;
+        const uint8_t *p = tritfile_chunk(&bench_file, k, &n);
+        s += trit5_sum_array(p, n);
+    }
+    bench_sink += (size_t)s;
+}
+
+static void case_verify(void) {
+    size_t ok = 0;
+    for (size_t k = 0; k < bench_file.chunks; k++) {
+        ok += tritfile_verify(&bench_file, k);
+    }
+    bench_sink += ok;
+}
+
+// run_op times the baseline, then fn on each supported backend.
+static void run_op(const char *title, double count, const char *fn_name, void (*fn)(void),
+                   const char *base_name, void (*base)(void)) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+
+    printf("\n  %s:\n", title);
+    double baseline = time_best(base);
+    report(base_name, count, baseline, baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s [%s]", fn_name, trit_backend_name(backends[i]));
+        report(name, count, time_best(fn), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_TRITS;
+
+    bench_trits = malloc(bench_n + 1);
+    bench_packed = malloc(TRIT5_PACKED_SIZE(bench_n) + 1);
+    bench_out = malloc(BENCH_SLICE_TRITS);
+    bench_index = malloc(BENCH_GETS * sizeof(uint64_t));
+    if (!bench_trits || !bench_packed || !bench_out || !bench_index ||
+        bench_n < 2 * BENCH_SLICE_TRITS) {
+        printf("✗ Allocation failed for %zu trits (or fewer than %d)\n", bench_n,
+               2 * BENCH_SLICE_TRITS);
+        return 1;
+    }
+
+    for (size_t i = 0; i < bench_n; i++) {
+        bench_trits[i] = (trit_t)((int)(rng() % 3) - 1);
+    }
+    trit5_pack_array(bench_trits, bench_n, bench_packed);
+    for (size_t i = 0; i < BENCH_GETS; i++) {
+        bench_index[i] = rng() % (bench_n - BENCH_SLICE_TRITS);
+    }
+    if (tritfile_write(BENCH_PATH, bench_packed, bench_n, 0) != TRITFILE_OK ||
+        tritfile_open(&bench_file, BENCH_PATH) != TRITFILE_OK) {
+        printf("✗ Could not write and open %s\n", BENCH_PATH);
+        return 1;
+    }
+    int ok = 1;
+    for (size_t i = 0; i < bench_n && ok; i += 997) {
+        ok = tritfile_get(&bench_file, i) == bench_trits[i];
+    }
+    if (!ok) {
+        printf("✗ Mapped trits differ from the source\n");
+        return 1;
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit .t5 file benchmarks: %zu trits, %zu chunks (auto backend: %s)\n",
+           bench_n, bench_file.chunks, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    printf("\n  open, then read one trit (warm page cache):\n");
+    double base = time_best(case_fread_unpack);
+    report("fread + trit5_unpack_array", (double)bench_n, base, base);
+    report("tritfile_open + tritfile_get", (double)bench_n, time_best(case_open_get), base);
+
+    printf("\n  %u random single-trit reads:\n", BENCH_GETS);
+    base = time_best(case_array_gets);
+    report("trit_t array index", BENCH_GETS, base, base);
+    report("tritfile_get", BENCH_GETS, time_best(case_file_gets), base);
+
+    run_op("random 4096-trit slices", (double)BENCH_SLICES * BENCH_SLICE_TRITS,
+           "tritfile_slice", case_file_slices, "memcpy from trit_t array", case_array_slices);
+    run_op("sum of every trit", (double)bench_n, "trit5_sum_array per chunk", case_chunk_sum,
+           "trit_sum_array (unpacked)", case_array_sum);
+
+    printf("\n  verify every chunk:\n");
+    base = time_best(case_verify);
+    report("tritfile_verify", (double)bench_n, base, base);
+
+    printf("\n  (sink %zu)\n", (size_t)bench_sink);
+
+    tritfile_close(&bench_file);
+    remove(BENCH_PATH);
+    free(bench_trits);
+    free(bench_packed);
+    free(bench_out);
+    free(bench_index);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + a report or run_op line)
+//   ✅ Trit count, slice size and read counts
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,332 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Three-Valued Column Filters
+// Key: B-word-work-pkg-trit-tritfilter-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for the filter engine and dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/logic_bench.c (structure)
+// See: word/research/ternary/ternary-logic-algorithms.adoc [Dyadic Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for tritfilter.c - measures, does not judge.
+//
+// tritfilter_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            a branch per row costs against chunked bit-plane filtering.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for one three-column predicate, evaluated
+//       row by row with branches and by tritfilter on each backend.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Time  c0 AND (c1 = +1 OR NOT c2)  producing selection vectors
+//          of true and unknown rows, on uniform data (no chunk skips) and
+//          clustered data (c0 false in 15 of every 16 chunks).
+//
+// Core Design: One set of columns, many repetitions, best-of-N wall time.
+//   - Reports Mrow/s and the speedup over the branching loop
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-tritfilter
+// Run:         ./build/bench_tritfilter [rows]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>        // printf
+#include <stdlib.h>       // malloc, free, strtoul
+#include <time.h>         // clock_gettime
+
+//--- Project Headers ---
+#include "tritfilter.h"   // tritfilter_t, builders, evaluation
+#include "trit.h"         // backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_ROWS  (4u * 1000u * 1000u)   // 4M rows
+#define BENCH_REPEATS       5                      // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main)
+static trit_t *bench_col[3] = { NULL, NULL, NULL };
+static uint32_t *bench_sel_true = NULL;
+static uint32_t *bench_sel_unknown = NULL;
+static uint64_t *bench_bits_true = NULL;
+static uint64_t *bench_bits_unknown = NULL;
+static size_t bench_n = 0;
+
+// Filter under test: c0 AND (c1 = +1 OR NOT c2)
+static tritfilter_t bench_filter;
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: row rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double mrows = (double)bench_n / seconds / 1e6;
+    printf("  %-36s %9.1f Mrow/s  %6.2fx\n", name, mrows, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+// case_branch is the emulation tritfilter replaces: Kleene logic as
+// branches, one row at a time, short-circuiting per row.
+static void case_branch(void) {
+    size_t nt = 0, nu = 0;
+    for (size_t i = 0; i < bench_n; i++) {
+        trit_t a = bench_col[0][i], r;
+        if (a == BOOL3_FALSE) {
+            continue;
+        }
+        trit_t b = bench_col[1][i] == TRIT_POS ? BOOL3_TRUE : BOOL3_FALSE;
+        if (b == BOOL3_TRUE) {
+            r = BOOL3_TRUE;
+        } else {
+            trit_t c = bench_col[2][i];
+            r = (c == BOOL3_FALSE) ? BOOL3_TRUE : (c == BOOL3_UNKNOWN) ? BOOL3_UNKNOWN : BOOL3_FALSE;
+        }
+        if (r == BOOL3_TRUE && a == BOOL3_UNKNOWN) {
+            r = BOOL3_UNKNOWN;
+        }
+        if (r == BOOL3_TRUE) {
+            bench_sel_true[nt++] = (uint32_t)i;
+        } else if (r == BOOL3_UNKNOWN) {
+            bench_sel_unknown[nu++] = (uint32_t)i;
+        }
+    }
+    bench_sink += (unsigned)(nt + nu);
+}
+
+static void case_select(void) {
+    size_t nu = 0;
+    const trit_t *const *cols = (const trit_t *const *)bench_col;
+    size_t nt = tritfilter_select(&bench_filter, cols, bench_n, bench_sel_true, bench_sel_unknown, &nu);
+    bench_sink += (unsigned)(nt + nu);
+}
+
+static void case_bitmap(void) {
+    const trit_t *const *cols = (const trit_t *const *)bench_col;
+    tritfilter_bitmap(&bench_filter, cols, bench_n, bench_bits_true, bench_bits_unknown);
+    bench_sink += (unsigned)bench_bits_true[bench_n / 128];
+}
+
+// run_data times the branching loop (baseline) against tritfilter_select
+// on each supported backend and tritfilter_bitmap on the auto backend.
+static void run_data(const char *label) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+    size_t nu = 0;
+    const trit_t *const *cols = (const trit_t *const *)bench_col;
+    size_t nt = tritfilter_select(&bench_filter, cols, bench_n, NULL, NULL, &nu);
+
+    printf("\n  %s (%.1f%% true, %.1f%% unknown):\n", label,
+           100.0 * (double)nt / (double)bench_n, 100.0 * (double)nu / (double)bench_n);
+    double baseline = time_best(case_branch);
+    report("branching per row", baseline, baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "tritfilter_select [%s]", trit_backend_name(backends[i]));
+        report(name, time_best(case_select), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+    snprintf(name, sizeof(name), "tritfilter_bitmap [%s]", trit_backend_name(trit_backend_active()));
+    report(name, time_best(case_bitmap), baseline);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_ROWS;
+
+    for (int c = 0; c < 3; c++) {
+        bench_col[c] = malloc(bench_n);
+    }
+    bench_sel_true = malloc(bench_n * sizeof(uint32_t));
+    bench_sel_unknown = malloc(bench_n * sizeof(uint32_t));
+    bench_bits_true = malloc(TRITFILTER_BITMAP_WORDS(bench_n) * sizeof(uint64_t));
+    bench_bits_unknown = malloc(TRITFILTER_BITMAP_WORDS(bench_n) * sizeof(uint64_t));
+    if (!bench_col[0] || !bench_col[1] || !bench_col[2] || !bench_sel_true || !bench_sel_unknown ||
+        !bench_bits_true || !bench_bits_unknown) {
+        printf("✗ Allocation failed for %zu rows\n", bench_n);
+        return 1;
+    }
+
+    // Deterministic pseudo-random values (LCG)
+    uint32_t seed = 12345u;
+    for (int c = 0; c < 3; c++) {
+        for (size_t i = 0; i < bench_n; i++) {
+            seed = seed * 1103515245u + 12345u;
+            bench_col[c][i] = (trit_t)((seed >> 16) % 3) - 1;
+        }
+    }
+
+    tritfilter_init(&bench_filter);
+    int c0 = tritfilter_column(&bench_filter, 0, TRIT_OP1_IDENTITY);
+    int c1 = tritfilter_column(&bench_filter, 1, TRIT_OP1_ID(-1, -1, 1));
+    int c2 = tritfilter_not(&bench_filter, tritfilter_column(&bench_filter, 2, TRIT_OP1_IDENTITY));
+    tritfilter_and(&bench_filter, c0, tritfilter_or(&bench_filter, c1, c2));
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit column filter benchmarks: %zu rows (auto backend: %s)\n",
+           bench_n, trit_backend_name(trit_backend_active()));
+    printf("  filter: c0 AND (c1 = +1 OR NOT c2)\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    run_data("uniform");
+
+    // Clustered: c0 false everywhere except one chunk in 16
+    for (size_t i = 0; i < bench_n; i++) {
+        if ((i / TRITFILTER_CHUNK) % 16 != 0) {
+            bench_col[0][i] = BOOL3_FALSE;
+        }
+    }
+    run_data("clustered");
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    for (int c = 0; c < 3; c++) {
+        free(bench_col[c]);
+    }
+    free(bench_sel_true);
+    free(bench_sel_unknown);
+    free(bench_bits_true);
+    free(bench_bits_unknown);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Filter shape and data distributions (keep case_branch in step)
+//   ✅ Row count and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
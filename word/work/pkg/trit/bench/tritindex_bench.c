@@ -0,0 +1,415 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Nearest-Neighbour Search
+// Key: B-word-work-pkg-trit-tritindex-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for the search index and backend dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/array_bench.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 2: BCT Parallel]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for tritindex.c - measures, does not judge.
+//
+// tritindex_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            exhaustive and list search cost, and what lists give up.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Query throughput and recall over a 1M × 256-trit collection.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare an unpack + trit_multiply scan against exhaustive
+//          tritindex_search on every backend, single and batched, then
+//          list search by nprobe with recall@k against exhaustive, and
+//          tritindex_search_mt at 1-8 threads.
+//
+// Core Design: Clustered t5b1 collection (so lists mean something),
+//   queries are perturbed stored vectors, best-of-N wall time.
+//   - Reports queries/s and the speedup over the scan
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-tritindex
+// Run:         ./build/bench_tritindex [vectors] [cols] [nlist]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>       // printf
+#include <stdlib.h>      // malloc, free, strtoul
+#include <time.h>        // clock_gettime
+
+//--- Platform ---
+#include <unistd.h>      // sysconf
+
+//--- Project Headers ---
+#include "trit.h"        // trit_multiply, trit5_unpack_array, backends
+#include "tritindex.h"   // search index
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_VECS   1000000    // collection size
+#define BENCH_DEFAULT_COLS   256        // trits per vector
+#define BENCH_DEFAULT_NLIST  1024       // coarse lists
+#define BENCH_CENTERS        4096       // clusters in the generated data
+#define BENCH_QUERIES        128        // batched queries (8 blocks of 16)
+#define BENCH_K              10         // results per query
+#define BENCH_REPEATS        3          // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main)
+static uint8_t *bench_rows = NULL;          // collection as t5b1 rows
+static uint8_t *bench_queries = NULL;       // queries as t5b1 rows
+static tritindex_t bench_idx;
+static tritindex_hit_t *bench_hits = NULL;  // BENCH_QUERIES × BENCH_K
+static tritindex_hit_t *bench_exact = NULL; // exhaustive answers for recall
+static size_t bench_vecs = 0;
+static size_t bench_cols = 0;
+static size_t bench_nq = 1;
+static size_t bench_nprobe = 0;
+static unsigned bench_threads = 1;
+static tritindex_metric_t bench_metric = TRITINDEX_DOT;
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: query rate and speedup over baseline (both per
+// query)
+static void report(const char *name, double seconds, double baseline) {
+    double per_query = seconds / (double)bench_nq;
+    printf("  %-40s %10.1f q/s  %7.1fx\n", name, 1.0 / per_query, baseline / per_query);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// recall returns the fraction of exhaustive top-k ids found in bench_hits.
+static double recall(void) {
+    size_t found = 0;
+    for (size_t q = 0; q < bench_nq; q++) {
+        for (size_t i = 0; i < BENCH_K; i++) {
+            for (size_t j = 0; j < BENCH_K; j++) {
+                if (bench_hits[q * BENCH_K + i].id == bench_exact[q * BENCH_K + j].id) {
+                    found++;
+                    break;
+                }
+            }
+        }
+    }
+    return (double)found / (double)(bench_nq * BENCH_K);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- Baseline: unpack each row, one trit_multiply per pair ---
+
+static void case_scan(void) {
+    trit_t *row = malloc(bench_cols), *query = malloc(bench_cols);
+    size_t best_id = 0;
+    int32_t best = INT32_MIN;
+    if (!row || !query) {
+        free(row);
+        free(query);
+        return;
+    }
+    trit5_unpack_array(bench_queries, bench_cols, query);
+    for (size_t r = 0; r < bench_vecs; r++) {
+        trit5_unpack_array(bench_rows + r * TRITMAT_ROW_BYTES(bench_cols), bench_cols, row);
+        int32_t acc = 0;
+        for (size_t c = 0; c < bench_cols; c++) {
+            acc += trit_multiply(row[c], query[c]);
+        }
+        if (acc > best) {
+            best = acc;
+            best_id = r;
+        }
+    }
+    bench_sink += (unsigned)best_id;
+    free(row);
+    free(query);
+}
+
+//--- Index: active backend ---
+
+static void case_search(void) {
+    tritindex_search(&bench_idx, bench_queries, bench_nq, bench_metric, BENCH_K, bench_nprobe,
+                     bench_hits);
+    bench_sink += (unsigned)bench_hits[0].id;
+}
+
+static void case_search_mt(void) {
+    tritindex_search_mt(&bench_idx, bench_queries, bench_nq, bench_metric, BENCH_K, bench_nprobe,
+                        bench_hits, bench_threads);
+    bench_sink += (unsigned)bench_hits[0].id;
+}
+
+// run_threads times tritindex_search_mt at 1, 2, 4 and 8 threads on the
+// active backend, against tritindex_search.
+static void run_threads(const char *op, double baseline) {
+    static const unsigned counts[] = { 1, 2, 4, 8 };
+    char name[64];
+
+    printf("\n  %s threads (%zu queries, k = %d, %s):\n", op, bench_nq, BENCH_K,
+           trit_backend_name(trit_backend_active()));
+    report("tritindex_search", time_best(case_search), baseline);
+    for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+        bench_threads = counts[i];
+        snprintf(name, sizeof(name), "tritindex_search_mt [%u threads]", counts[i]);
+        report(name, time_best(case_search_mt), baseline);
+    }
+}
+
+// run_op times exhaustive search on each supported backend.
+static void run_op(const char *op, double baseline) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+
+    printf("\n  %s (%zu queries, k = %d):\n", op, bench_nq, BENCH_K);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "exhaustive [%s]", trit_backend_name(backends[i]));
+        report(name, time_best(case_search), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_vecs = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_VECS;
+    bench_cols = (argc > 2) ? (size_t)strtoul(argv[2], NULL, 10) : BENCH_DEFAULT_COLS;
+    size_t nlist = (argc > 3) ? (size_t)strtoul(argv[3], NULL, 10) : BENCH_DEFAULT_NLIST;
+
+    size_t row_bytes = TRITMAT_ROW_BYTES(bench_cols);
+    trit_t *centers = malloc(BENCH_CENTERS * bench_cols);
+    trit_t *trits = malloc(bench_cols);
+    bench_rows = malloc(bench_vecs * row_bytes + 1);
+    bench_queries = malloc(BENCH_QUERIES * row_bytes + 1);
+    bench_hits = malloc(BENCH_QUERIES * BENCH_K * sizeof(tritindex_hit_t));
+    bench_exact = malloc(BENCH_QUERIES * BENCH_K * sizeof(tritindex_hit_t));
+    if (!centers || !trits || !bench_rows || !bench_queries || !bench_hits || !bench_exact) {
+        printf("✗ Allocation failed for %zu×%zu\n", bench_vecs, bench_cols);
+        return 1;
+    }
+
+    // Deterministic clustered data (LCG): each vector is a random center
+    // with about 1 trit in 5 redrawn; queries redraw 1 in 10 of a vector
+    uint32_t seed = 12345u;
+    for (size_t i = 0; i < BENCH_CENTERS * bench_cols; i++) {
+        seed = seed * 1103515245u + 12345u;
+        centers[i] = (trit_t)((seed >> 16) % 3) - 1;
+    }
+    for (size_t r = 0; r < bench_vecs; r++) {
+        seed = seed * 1103515245u + 12345u;
+        const trit_t *center = centers + ((seed >> 8) % BENCH_CENTERS) * bench_cols;
+        for (size_t c = 0; c < bench_cols; c++) {
+            seed = seed * 1103515245u + 12345u;
+            trits[c] = ((seed >> 16) % 5 == 0) ? (trit_t)((seed >> 20) % 3) - 1 : center[c];
+        }
+        trit5_pack_array(trits, bench_cols, bench_rows + r * row_bytes);
+    }
+    for (size_t q = 0; q < BENCH_QUERIES; q++) {
+        seed = seed * 1103515245u + 12345u;
+        trit5_unpack_array(bench_rows + ((seed >> 4) % bench_vecs) * row_bytes, bench_cols, trits);
+        for (size_t c = 0; c < bench_cols; c++) {
+            seed = seed * 1103515245u + 12345u;
+            if ((seed >> 16) % 10 == 0) trits[c] = (trit_t)((seed >> 20) % 3) - 1;
+        }
+        trit5_pack_array(trits, bench_cols, bench_queries + q * row_bytes);
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit search benchmarks: %zu vectors × %zu trits (auto backend: %s)\n",
+           bench_vecs, bench_cols, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    tritindex_init(&bench_idx, bench_cols);
+    double t0 = now_seconds();
+    if (!tritindex_add_t5(&bench_idx, bench_rows, bench_vecs)) {
+        printf("✗ Allocation failed for the index\n");
+        return 1;
+    }
+    printf("\n  tritindex_add_t5: %.3f s (%.1f M vectors/s)\n", now_seconds() - t0,
+           (double)bench_vecs / (now_seconds() - t0) / 1e6);
+
+    bench_nq = 1;
+    printf("\n  baseline (1 query, top-1):\n");
+    double baseline = time_best(case_scan);
+    report("unpack + trit_multiply scan", baseline, baseline);
+
+    run_op("dot, single query", baseline);
+    bench_nq = BENCH_QUERIES;
+    run_op("dot, batched", baseline);
+
+    printf("\n  hamming (%zu queries, k = %d):\n", bench_nq, BENCH_K);
+    bench_metric = TRITINDEX_HAMMING;
+    report("exhaustive [auto]", time_best(case_search), baseline);
+    bench_metric = TRITINDEX_DOT;
+
+    printf("\n  Thread scaling (%ld online CPUs):\n", sysconf(_SC_NPROCESSORS_ONLN));
+    run_threads("dot, exhaustive", baseline);
+
+    // Lists: exhaustive answers first, then recall by nprobe
+    tritindex_search(&bench_idx, bench_queries, bench_nq, TRITINDEX_DOT, BENCH_K, 0, bench_exact);
+    t0 = now_seconds();
+    if (!tritindex_train(&bench_idx, nlist, 0, TRITINDEX_DOT)) {
+        printf("✗ Allocation failed for %zu lists\n", nlist);
+        return 1;
+    }
+    printf("\n  coarse lists (nlist %zu, trained in %.2f s), %zu queries, k = %d:\n",
+           bench_idx.nlist, now_seconds() - t0, bench_nq, BENCH_K);
+    static const size_t probes[] = { 1, 4, 16, 64 };
+    for (size_t i = 0; i < sizeof(probes) / sizeof(probes[0]); i++) {
+        char name[64];
+        bench_nprobe = probes[i];
+        double t = time_best(case_search);
+        snprintf(name, sizeof(name), "nprobe %3zu (recall@%d %.3f)", bench_nprobe, BENCH_K, recall());
+        report(name, t, baseline);
+    }
+    bench_nprobe = 4;
+    run_threads("dot, nprobe 4", baseline);
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    tritindex_free(&bench_idx);
+    free(centers);
+    free(trits);
+    free(bench_rows);
+    free(bench_queries);
+    free(bench_hits);
+    free(bench_exact);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + a report line)
+//   ✅ Collection size, clustering, nprobe list and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,413 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Ternary-Weight Matrix Products
+// Key: B-word-work-pkg-trit-tritmat-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for tritmat products and backend dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/array_bench.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 1: t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for tritmat.c - measures, does not judge.
+//
+// tritmat_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            decode-on-the-fly and sign-select save over unpacking every
+//            byte and multiplying every weight.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for the byte-at-a-time baseline vs
+//       tritmat GEMV/GEMM on each backend.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare trit5_unpack per byte + multiply per weight against
+//          tritmat_gemv_* and tritmat_gemm_* on every supported backend,
+//          then tritmat_gem{v,m}_*_mt at 1-8 threads against one thread.
+//
+// Core Design: One weight matrix, best-of-N wall time.
+//   - Reports G weight-ops/s (rows · cols · batch per second) and the
+//     speedup over the baseline
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-tritmat
+// Run:         ./build/bench_tritmat [rows] [cols]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <string.h>   // memset
+#include <time.h>     // clock_gettime
+
+//--- Platform ---
+#include <unistd.h>   // sysconf
+
+//--- Project Headers ---
+#include "trit.h"     // trit5_unpack, backends
+#include "tritmat.h"  // tritmat_pack, gemv, gemm
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_ROWS   4096
+#define BENCH_DEFAULT_COLS   4096
+#define BENCH_BATCH          64         // GEMM vectors (one batch block)
+#define BENCH_REPEATS        5          // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main)
+static uint8_t *bench_w = NULL;
+static int8_t *bench_x8 = NULL;
+static int16_t *bench_x16 = NULL;
+static float *bench_xf = NULL;
+static int32_t *bench_y = NULL;
+static float *bench_yf = NULL;
+static size_t bench_rows = 0;
+static size_t bench_cols = 0;
+static size_t bench_batch = 1;
+static unsigned bench_threads = 1;
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: weight-op rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double gops = (double)bench_rows * (double)bench_cols * (double)bench_batch / seconds / 1e9;
+    printf("  %-36s %8.2f Gop/s  %7.1fx\n", name, gops, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- Baseline: trit5_unpack per byte, multiply per weight ---
+
+static void case_gemv_baseline(void) {
+    size_t row_bytes = TRITMAT_ROW_BYTES(bench_cols);
+    for (size_t r = 0; r < bench_rows; r++) {
+        const uint8_t *row = bench_w + r * row_bytes;
+        int32_t acc = 0;
+        for (size_t c = 0; c < bench_cols; c += 5) {
+            trit_t t[5];
+            trit5_unpack(row[c / 5], t);
+            for (size_t k = 0; k < 5 && c + k < bench_cols; k++) {
+                acc += t[k] * bench_x8[c + k];
+            }
+        }
+        bench_y[r] = acc;
+    }
+    bench_sink += (unsigned)bench_y[bench_rows / 2];
+}
+
+static void case_gemm_baseline(void) {
+    size_t row_bytes = TRITMAT_ROW_BYTES(bench_cols);
+    for (size_t r = 0; r < bench_rows; r++) {
+        const uint8_t *row = bench_w + r * row_bytes;
+        for (size_t b = 0; b < bench_batch; b++) {
+            const int8_t *x = bench_x8 + b * bench_cols;
+            int32_t acc = 0;
+            for (size_t c = 0; c < bench_cols; c += 5) {
+                trit_t t[5];
+                trit5_unpack(row[c / 5], t);
+                for (size_t k = 0; k < 5 && c + k < bench_cols; k++) {
+                    acc += t[k] * x[c + k];
+                }
+            }
+            bench_y[r * bench_batch + b] = acc;
+        }
+    }
+    bench_sink += (unsigned)bench_y[bench_rows / 2];
+}
+
+//--- tritmat: active backend ---
+
+static void case_gemv_i8(void) {
+    tritmat_gemv_i8(bench_w, bench_rows, bench_cols, bench_x8, bench_y);
+    bench_sink += (unsigned)bench_y[bench_rows / 2];
+}
+
+static void case_gemv_i16(void) {
+    tritmat_gemv_i16(bench_w, bench_rows, bench_cols, bench_x16, bench_y);
+    bench_sink += (unsigned)bench_y[bench_rows / 2];
+}
+
+static void case_gemv_f32(void) {
+    tritmat_gemv_f32(bench_w, bench_rows, bench_cols, bench_xf, bench_yf);
+    bench_sink += (unsigned)(int32_t)bench_yf[bench_rows / 2];
+}
+
+static void case_gemm_i8(void) {
+    tritmat_gemm_i8(bench_w, bench_rows, bench_cols, bench_x8, bench_batch, bench_y);
+    bench_sink += (unsigned)bench_y[bench_rows / 2];
+}
+
+static void case_gemm_i16(void) {
+    tritmat_gemm_i16(bench_w, bench_rows, bench_cols, bench_x16, bench_batch, bench_y);
+    bench_sink += (unsigned)bench_y[bench_rows / 2];
+}
+
+static void case_gemm_f32(void) {
+    tritmat_gemm_f32(bench_w, bench_rows, bench_cols, bench_xf, bench_batch, bench_yf);
+    bench_sink += (unsigned)(int32_t)bench_yf[bench_rows / 2];
+}
+
+//--- tritmat: threaded (bench_threads) ---
+
+static void case_gemv_i8_mt(void) {
+    tritmat_gemv_i8_mt(bench_w, bench_rows, bench_cols, bench_x8, bench_y, bench_threads);
+    bench_sink += (unsigned)bench_y[bench_rows / 2];
+}
+
+static void case_gemm_i8_mt(void) {
+    tritmat_gemm_i8_mt(bench_w, bench_rows, bench_cols, bench_x8, bench_batch, bench_y,
+                       bench_threads);
+    bench_sink += (unsigned)bench_y[bench_rows / 2];
+}
+
+static void case_gemm_f32_mt(void) {
+    tritmat_gemm_f32_mt(bench_w, bench_rows, bench_cols, bench_xf, bench_batch, bench_yf,
+                        bench_threads);
+    bench_sink += (unsigned)(int32_t)bench_yf[bench_rows / 2];
+}
+
+// run_threads times a threaded case at 1, 2, 4 and 8 threads against
+// the single-threaded call on the active backend.
+static void run_threads(const char *op, void (*single_fn)(void), void (*mt_fn)(void)) {
+    static const unsigned counts[] = { 1, 2, 4, 8 };
+    char name[64];
+
+    printf("\n  %s threads (%zu×%zu, batch %zu, %s):\n", op, bench_rows, bench_cols,
+           bench_batch, trit_backend_name(trit_backend_active()));
+    double single = time_best(single_fn);
+    snprintf(name, sizeof(name), "tritmat_%s", op);
+    report(name, single, single);
+    for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+        bench_threads = counts[i];
+        snprintf(name, sizeof(name), "tritmat_%s_mt [%u threads]", op, counts[i]);
+        report(name, time_best(mt_fn), single);
+    }
+}
+
+// run_op times the baseline, then each tritmat case on each supported
+// backend.
+static void run_op(const char *op, void (*baseline_fn)(void), void (*cases[3])(void)) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    static const char *types[] = { "i8", "i16", "f32" };
+    char name[64];
+
+    printf("\n  %s (%zu×%zu, batch %zu):\n", op, bench_rows, bench_cols, bench_batch);
+    double baseline = time_best(baseline_fn);
+    report("unpack + multiply (i8)", baseline, baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        for (int t = 0; t < 3; t++) {
+            snprintf(name, sizeof(name), "tritmat_%s_%s [%s]", op, types[t],
+                     trit_backend_name(backends[i]));
+            report(name, time_best(cases[t]), baseline);
+        }
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_rows = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_ROWS;
+    bench_cols = (argc > 2) ? (size_t)strtoul(argv[2], NULL, 10) : BENCH_DEFAULT_COLS;
+
+    size_t n = bench_rows * bench_cols;
+    trit_t *trits = malloc(n);
+    bench_w = malloc(bench_rows * TRITMAT_ROW_BYTES(bench_cols));
+    bench_x8 = malloc(BENCH_BATCH * bench_cols);
+    bench_x16 = malloc(BENCH_BATCH * bench_cols * sizeof(int16_t));
+    bench_xf = malloc(BENCH_BATCH * bench_cols * sizeof(float));
+    bench_y = malloc(bench_rows * BENCH_BATCH * sizeof(int32_t));
+    bench_yf = malloc(bench_rows * BENCH_BATCH * sizeof(float));
+    if (!trits || !bench_w || !bench_x8 || !bench_x16 || !bench_xf || !bench_y || !bench_yf) {
+        printf("✗ Allocation failed for %zu×%zu\n", bench_rows, bench_cols);
+        return 1;
+    }
+
+    // Fault the output pages in before timing
+    memset(bench_y, 0, bench_rows * BENCH_BATCH * sizeof(int32_t));
+    memset(bench_yf, 0, bench_rows * BENCH_BATCH * sizeof(float));
+
+    // Deterministic pseudo-random weights and activations (LCG)
+    uint32_t seed = 12345u;
+    for (size_t i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        trits[i] = (trit_t)((seed >> 16) % 3) - 1;
+    }
+    tritmat_pack(trits, bench_rows, bench_cols, bench_w);
+    free(trits);
+    for (size_t i = 0; i < BENCH_BATCH * bench_cols; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bench_x8[i] = (int8_t)(seed >> 24);
+        bench_x16[i] = (int16_t)(seed >> 16);
+        bench_xf[i] = (float)(int8_t)(seed >> 24) * 0.125f;
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit matrix benchmarks: %zu×%zu weights (auto backend: %s)\n",
+           bench_rows, bench_cols, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    void (*gemv_cases[3])(void) = { case_gemv_i8, case_gemv_i16, case_gemv_f32 };
+    void (*gemm_cases[3])(void) = { case_gemm_i8, case_gemm_i16, case_gemm_f32 };
+    bench_batch = 1;
+    run_op("gemv", case_gemv_baseline, gemv_cases);
+    bench_batch = BENCH_BATCH;
+    run_op("gemm", case_gemm_baseline, gemm_cases);
+
+    printf("\n  Thread scaling (%ld online CPUs):\n", sysconf(_SC_NPROCESSORS_ONLN));
+    bench_batch = 1;
+    run_threads("gemv_i8", case_gemv_i8, case_gemv_i8_mt);
+    bench_batch = BENCH_BATCH;
+    run_threads("gemm_i8", case_gemm_i8, case_gemm_i8_mt);
+    run_threads("gemm_f32", case_gemm_f32, case_gemm_f32_mt);
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    free(bench_w);
+    free(bench_x8);
+    free(bench_x16);
+    free(bench_xf);
+    free(bench_y);
+    free(bench_yf);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + run_op entry)
+//   ✅ Matrix size, batch and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,348 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Truth-Table Operators
+// Key: B-word-work-pkg-trit-tritop-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for operators, bitsliced kernels and dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/array_bench.c (structure)
+// See: word/research/ternary/ternary-logic-algorithms.adoc [Dyadic Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for tritop.c - measures, does not judge.
+//
+// tritop_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            a table ID costs against a kernel written by hand.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for compiled truth tables vs the
+//       hand-written bitsliced and array kernels on each backend.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare trit64b_op_run with trit64b_add/multiply loops, and
+//          trit_op2_apply with trit_add/multiply_array, on every backend
+//          this CPU supports; EQUALITY and IMPLIES show unnamed-kernel
+//          tables against the scalar program.
+//
+// Core Design: One buffer, many repetitions, best-of-N wall time.
+//   - Reports Mtrit/s and the speedup over the hand-written kernel
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-tritop
+// Run:         ./build/bench_tritop [trits]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "tritop.h"   // operators
+#include "trit.h"     // bitsliced and array kernels, backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_TRITS  (4u * 1000u * 1000u)   // 4M trits
+#define BENCH_REPEATS        5                      // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main): the same trits as bytes and planes
+static trit_t *bench_a = NULL;
+static trit_t *bench_b = NULL;
+static trit_t *bench_out = NULL;
+static trit64b_t *bench_va = NULL;
+static trit64b_t *bench_vb = NULL;
+static trit64b_t *bench_vout = NULL;
+static size_t bench_n = 0;      // trits (multiple of 64)
+static size_t bench_vn = 0;     // vectors
+
+// Operator under test
+static trit9_t bench_table = 0;
+static trit_op_t bench_op;
+
+// Sink keeps results observable
+static volatile unsigned bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: trit rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double mtrits = (double)bench_n / seconds / 1e6;
+    printf("  %-36s %9.1f Mtrit/s  %6.2fx\n", name, mtrits, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- Hand-written kernels ---
+
+static void case_vec_add(void) {
+    for (size_t i = 0; i < bench_vn; i++) {
+        bench_vout[i] = trit64b_add(bench_va[i], bench_vb[i]);
+    }
+    bench_sink += (unsigned)bench_vout[bench_vn / 2].pos;
+}
+
+static void case_vec_multiply(void) {
+    for (size_t i = 0; i < bench_vn; i++) {
+        bench_vout[i] = trit64b_multiply(bench_va[i], bench_vb[i]);
+    }
+    bench_sink += (unsigned)bench_vout[bench_vn / 2].pos;
+}
+
+static void case_add_array(void) {
+    trit_add_array(bench_a, bench_b, bench_n, bench_out);
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+static void case_multiply_array(void) {
+    trit_multiply_array(bench_a, bench_b, bench_n, bench_out);
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+//--- Truth-table operators (bench_table / bench_op) ---
+
+static void case_op_run(void) {
+    trit64b_op_run(&bench_op, bench_va, bench_vb, bench_vn, bench_vout);
+    bench_sink += (unsigned)bench_vout[bench_vn / 2].pos;
+}
+
+static void case_op_apply(void) {
+    trit_op2_apply(bench_table, bench_a, bench_b, bench_n, bench_out);
+    bench_sink += (unsigned)bench_out[bench_n / 2];
+}
+
+// run_table times one table: compiled program vs the hand-written
+// trit64b kernel, then table lookup vs the trit_*_array kernel, on each
+// supported backend. A NULL kernel uses the scalar backend's operator
+// as the baseline instead.
+static void run_table(const char *op, trit9_t table, void (*vec_hand)(void), void (*array_hand)(void)) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+    double baseline;
+
+    bench_table = table;
+    trit_op2_compile(table, &bench_op);
+    printf("\n  %s (table %u, %u-instruction program):\n", op, (unsigned)table, (unsigned)bench_op.len);
+
+    trit_backend_select(TRIT_BACKEND_AUTO);
+    if (vec_hand != NULL) {
+        baseline = time_best(vec_hand);
+        snprintf(name, sizeof(name), "trit64b_%s (hand-written)", op);
+        report(name, baseline, baseline);
+    } else {
+        trit_backend_select(TRIT_BACKEND_SCALAR);
+        baseline = time_best(case_op_run);
+    }
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (backends[i] == TRIT_BACKEND_SSE41 || !trit_backend_select(backends[i])) {
+            continue;   // programs run generic below AVX2
+        }
+        snprintf(name, sizeof(name), "trit64b_op_run [%s]", trit_backend_name(backends[i]));
+        report(name, time_best(case_op_run), baseline);
+    }
+
+    trit_backend_select(TRIT_BACKEND_AUTO);
+    if (array_hand != NULL) {
+        baseline = time_best(array_hand);
+        snprintf(name, sizeof(name), "trit_%s_array [%s]", op, trit_backend_name(trit_backend_active()));
+        report(name, baseline, baseline);
+    } else {
+        trit_backend_select(TRIT_BACKEND_SCALAR);
+        baseline = time_best(case_op_apply);
+    }
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "trit_op2_apply [%s]", trit_backend_name(backends[i]));
+        report(name, time_best(case_op_apply), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_TRITS;
+    bench_n = (bench_n + 63) / 64 * 64;
+    bench_vn = TRIT64B_COUNT(bench_n);
+
+    bench_a = malloc(bench_n);
+    bench_b = malloc(bench_n);
+    bench_out = malloc(bench_n);
+    bench_va = malloc(bench_vn * sizeof(trit64b_t));
+    bench_vb = malloc(bench_vn * sizeof(trit64b_t));
+    bench_vout = malloc(bench_vn * sizeof(trit64b_t));
+    if (!bench_a || !bench_b || !bench_out || !bench_va || !bench_vb || !bench_vout) {
+        printf("✗ Allocation failed for %zu trits\n", bench_n);
+        return 1;
+    }
+
+    // Deterministic pseudo-random trits (LCG)
+    uint32_t seed = 12345u;
+    for (size_t i = 0; i < bench_n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bench_a[i] = (trit_t)((seed >> 16) % 3) - 1;
+        seed = seed * 1103515245u + 12345u;
+        bench_b[i] = (trit_t)((seed >> 16) % 3) - 1;
+    }
+    for (size_t v = 0; v < bench_vn; v++) {
+        bench_va[v] = trit64b_from_trits(bench_a + v * 64, 64);
+        bench_vb[v] = trit64b_from_trits(bench_b + v * 64, 64);
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit operator benchmarks: %zu trits (auto backend: %s)\n",
+           bench_n, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    run_table("add", TRIT_OP2_ADD, case_vec_add, case_add_array);
+    run_table("multiply", TRIT_OP2_MULTIPLY, case_vec_multiply, case_multiply_array);
+    run_table("equality", TRIT_OP2_EQUALITY, NULL, NULL);
+    run_table("implies", TRIT_OP2_IMPLIES, NULL, NULL);
+
+    printf("\n  (sink %u)\n", bench_sink);
+
+    free(bench_a);
+    free(bench_b);
+    free(bench_out);
+    free(bench_va);
+    free(bench_vb);
+    free(bench_vout);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add tables (one run_table line in main)
+//   ✅ Buffer size and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,394 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Majority and Consensus Votes
+// Key: B-word-work-pkg-trit-tritvote-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for tallies and backend dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/reduce_bench.c (structure)
+// See: word/research/ternary/ternary-logic-algorithms.adoc [CONSENSUS (Agreement)]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for tritvote.c - measures, does not judge.
+//
+// tritvote_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            counting on bit-planes saves over counting per position.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Throughput measurement for per-position vote loops vs bitsliced
+//       tallies on each backend.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Compare a trit_add loop (saturating, the old approach) and a
+//          per-position counting loop against tritvote_add_t64b /
+//          tritvote_add_t5 followed by tritvote_majority, on every
+//          backend this CPU supports; then the _mt adds at 1, 2, 4 and
+//          8 threads.
+//
+// Core Design: One set of vectors, best-of-N wall time.
+//   - Reports Mtrit/s (vectors × length) and the speedup over the
+//     counting loop
+//   - Checksums results so the optimizer cannot drop the work
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-tritvote
+// Run:         ./build/bench_tritvote [vectors] [trits]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>      // printf
+#include <stdlib.h>     // malloc, free, strtoul
+#include <time.h>       // clock_gettime
+
+//--- Platform ---
+#include <unistd.h>     // sysconf
+
+//--- Project Headers ---
+#include "tritvote.h"   // tritvote_t, tallies
+#include "trit.h"       // trit_add, trit64b_from_trits, trit5_pack_array, backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_VECS   512u    // vectors voting
+#define BENCH_DEFAULT_TRITS  4096u   // trits per vector
+#define BENCH_REPEATS        5       // best-of-N
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main)
+static trit_t *bench_trits = NULL;      // vecs × len, row-major
+static trit64b_t *bench_planes = NULL;  // vecs × TRIT64B_COUNT(len)
+static uint8_t *bench_rows = NULL;      // vecs × TRIT5_PACKED_SIZE(len)
+static trit_t *bench_acc = NULL;        // len (trit_add loop)
+static uint32_t *bench_pos = NULL;      // len (counting loop)
+static uint32_t *bench_neg = NULL;
+static trit64b_t *bench_out = NULL;     // TRIT64B_COUNT(len)
+static size_t bench_vecs = 0;
+static size_t bench_len = 0;
+static size_t bench_n = 0;              // vecs × len
+static unsigned bench_threads = 1;      // _mt cases
+
+// Sink keeps results observable
+static volatile int64_t bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: trit rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double mtrits = (double)bench_n / seconds / 1e6;
+    printf("  %-36s %9.1f Mtrit/s  %6.1fx\n", name, mtrits, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+//--- Per-position loops ---
+
+// case_loop_add folds trit_add over the vectors: saturates, so it is
+// not a vote, but it is what the loop cost.
+static void case_loop_add(void) {
+    for (size_t i = 0; i < bench_len; i++) {
+        bench_acc[i] = TRIT_ZERO;
+    }
+    for (size_t k = 0; k < bench_vecs; k++) {
+        const trit_t *t = bench_trits + k * bench_len;
+        for (size_t i = 0; i < bench_len; i++) {
+            bench_acc[i] = trit_add(bench_acc[i], t[i]);
+        }
+    }
+    bench_sink += bench_acc[bench_len / 2];
+}
+
+// case_loop_count counts +1 and -1 per position, then takes the sign.
+static void case_loop_count(void) {
+    for (size_t i = 0; i < bench_len; i++) {
+        bench_pos[i] = 0;
+        bench_neg[i] = 0;
+    }
+    for (size_t k = 0; k < bench_vecs; k++) {
+        const trit_t *t = bench_trits + k * bench_len;
+        for (size_t i = 0; i < bench_len; i++) {
+            bench_pos[i] += t[i] == TRIT_POS;
+            bench_neg[i] += t[i] == TRIT_NEG;
+        }
+    }
+    int64_t s = 0;
+    for (size_t i = 0; i < bench_len; i++) {
+        s += bench_pos[i] > bench_neg[i] ? 1 : bench_neg[i] > bench_pos[i] ? -1 : 0;
+    }
+    bench_sink += s;
+}
+
+//--- Bitsliced tallies ---
+
+static void case_tally_t64b(void) {
+    tritvote_t v;
+    tritvote_init(&v, bench_len);
+    tritvote_add_t64b(&v, bench_planes, bench_vecs);
+    tritvote_majority(&v, bench_out);
+    bench_sink += (int64_t)(bench_out[0].pos ^ bench_out[0].neg);
+    tritvote_free(&v);
+}
+
+static void case_tally_t5(void) {
+    tritvote_t v;
+    tritvote_init(&v, bench_len);
+    tritvote_add_t5(&v, bench_rows, bench_vecs);
+    tritvote_majority(&v, bench_out);
+    bench_sink += (int64_t)(bench_out[0].pos ^ bench_out[0].neg);
+    tritvote_free(&v);
+}
+
+static void case_tally_t64b_mt(void) {
+    tritvote_t v;
+    tritvote_init(&v, bench_len);
+    tritvote_add_t64b_mt(&v, bench_planes, bench_vecs, bench_threads);
+    tritvote_majority(&v, bench_out);
+    bench_sink += (int64_t)(bench_out[0].pos ^ bench_out[0].neg);
+    tritvote_free(&v);
+}
+
+static void case_tally_t5_mt(void) {
+    tritvote_t v;
+    tritvote_init(&v, bench_len);
+    tritvote_add_t5_mt(&v, bench_rows, bench_vecs, bench_threads);
+    tritvote_majority(&v, bench_out);
+    bench_sink += (int64_t)(bench_out[0].pos ^ bench_out[0].neg);
+    tritvote_free(&v);
+}
+
+// run_threads times fn at 1, 2, 4 and 8 threads on the auto backend,
+// against a baseline.
+static void run_threads(const char *title, const char *base_name, void (*base)(void),
+                        const char *fn_name, void (*fn)(void)) {
+    static const unsigned counts[] = { 1, 2, 4, 8 };
+    char name[64];
+
+    printf("\n  %s:\n", title);
+    double baseline = time_best(base);
+    report(base_name, baseline, baseline);
+    for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+        bench_threads = counts[i];
+        snprintf(name, sizeof(name), "%s [%u threads]", fn_name, counts[i]);
+        report(name, time_best(fn), baseline);
+    }
+}
+
+// run_op times a baseline, then fn on each supported backend (the
+// baseline runs on the auto backend).
+static void run_op(const char *title, const char *base_name, void (*base)(void),
+                   const char *fn_name, void (*fn)(void)) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+
+    printf("\n  %s:\n", title);
+    double baseline = time_best(base);
+    report(base_name, baseline, baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s [%s]", fn_name, trit_backend_name(backends[i]));
+        report(name, time_best(fn), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    bench_vecs = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_VECS;
+    bench_len = (argc > 2) ? (size_t)strtoul(argv[2], NULL, 10) : BENCH_DEFAULT_TRITS;
+    bench_n = bench_vecs * bench_len;
+    size_t nv = TRIT64B_COUNT(bench_len), rb = TRIT5_PACKED_SIZE(bench_len);
+
+    bench_trits = malloc(bench_n + 1);
+    bench_planes = malloc((bench_vecs * nv + 1) * sizeof(trit64b_t));
+    bench_rows = malloc(bench_vecs * rb + 1);
+    bench_acc = malloc(bench_len + 1);
+    bench_pos = malloc((bench_len + 1) * sizeof(uint32_t));
+    bench_neg = malloc((bench_len + 1) * sizeof(uint32_t));
+    bench_out = malloc((nv + 1) * sizeof(trit64b_t));
+    if (!bench_trits || !bench_planes || !bench_rows || !bench_acc || !bench_pos ||
+        !bench_neg || !bench_out) {
+        printf("✗ Allocation failed for %zu × %zu trits\n", bench_vecs, bench_len);
+        return 1;
+    }
+
+    // Deterministic pseudo-random trits (LCG), packed both ways
+    uint32_t seed = 12345u;
+    for (size_t i = 0; i < bench_n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bench_trits[i] = (trit_t)((seed >> 16) % 3) - 1;
+    }
+    for (size_t k = 0; k < bench_vecs; k++) {
+        const trit_t *t = bench_trits + k * bench_len;
+        for (size_t w = 0; w < nv; w++) {
+            size_t lanes = bench_len - 64 * w < 64 ? bench_len - 64 * w : 64;
+            bench_planes[k * nv + w] = trit64b_from_trits(t + 64 * w, lanes);
+        }
+        trit5_pack_array(t, bench_len, bench_rows + k * rb);
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit vote benchmarks: %zu vectors × %zu trits (auto backend: %s)\n",
+           bench_vecs, bench_len, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    printf("\n  saturating fold (not a vote; the old loop):\n");
+    double add = time_best(case_loop_add);
+    report("trit_add loop", add, add);
+
+    run_op("majority from bit-planes", "counting loop", case_loop_count,
+           "tritvote_add_t64b + majority", case_tally_t64b);
+    run_op("majority from t5b1 rows", "counting loop", case_loop_count,
+           "tritvote_add_t5 + majority", case_tally_t5);
+
+    printf("\n  Thread scaling (%ld online CPUs):\n", sysconf(_SC_NPROCESSORS_ONLN));
+    run_threads("majority from bit-planes, threads", "counting loop", case_loop_count,
+                "tritvote_add_t64b_mt", case_tally_t64b_mt);
+    run_threads("majority from t5b1 rows, threads", "counting loop", case_loop_count,
+                "tritvote_add_t5_mt", case_tally_t5_mt);
+
+    printf("\n  (sink %lld)\n", (long long)bench_sink);
+
+    free(bench_trits);
+    free(bench_planes);
+    free(bench_rows);
+    free(bench_acc);
+    free(bench_pos);
+    free(bench_neg);
+    free(bench_out);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + run_op line in main)
+//   ✅ Vector count, length and repeat count
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
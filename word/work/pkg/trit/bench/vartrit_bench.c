@@ -0,0 +1,349 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Benchmarks - Variable-Length Integers
+// Key: B-word-work-pkg-trit-vartrit-bench
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for vartrit coding and backend dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/bench/reduce_bench.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Throughput benchmarks for vartrit.c - measures, does not judge.
+//
+// vartrit_bench - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "For which of you, intending to build a tower, sitteth not
+//            down first, and counteth the cost?" — Luke 14:28
+//
+// Principle: Count the cost before choosing a path. Benchmarks show what
+//            a ternary integer costs next to the binary one.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - measures and reports)
+//
+// Role: Size and throughput of trit_vartrit_encode_i64 /
+//       trit_vartrit_decode_i64 on each backend, against zig-zag LEB128.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Time encode and decode of int64 arrays at four magnitudes
+//          (|v| <= 4, about 60, about 3000, about 2^35), on every
+//          backend this CPU supports.
+//
+// Core Design: One value array per magnitude, best-of-N wall time.
+//   - Reports M values/s and the speedup over zig-zag LEB128
+//   - Prints bytes per value for both codes
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make bench-vartrit
+// Run:         ./build/bench_vartrit [values]
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = Benchmarks ran
+//   1 = Allocation failed or a round-trip differed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+//--- Standard Library ---
+#include <stdio.h>    // printf
+#include <stdlib.h>   // malloc, free, strtoul
+#include <string.h>   // memcmp
+#include <time.h>     // clock_gettime
+
+//--- Project Headers ---
+#include "vartrit.h"  // trit_vartrit_*
+#include "trit.h"     // backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define BENCH_DEFAULT_VALUES  (8u * 1000u * 1000u)  // 8M int64 (64 MB)
+#define BENCH_REPEATS         5                     // best-of-N
+#define LEB128_MAX            10                    // bytes of a 64-bit LEB128
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Shared buffers (set up once in main, refilled per magnitude)
+static int64_t *bench_values = NULL;
+static int64_t *bench_back = NULL;
+static uint8_t *bench_vt = NULL;
+static uint8_t *bench_leb = NULL;
+static uint8_t *bench_scratch = NULL;
+static size_t bench_vt_n = 0;
+static size_t bench_leb_n = 0;
+static size_t bench_n = 0;
+
+// Sink keeps results observable
+static volatile size_t bench_sink = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void);
+static void report(const char *name, double seconds, double baseline);
+static double time_best(void (*fn)(void));
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Print one result line: value rate and speedup over baseline
+static void report(const char *name, double seconds, double baseline) {
+    double mvs = (double)bench_n / seconds / 1e6;
+    printf("  %-36s %9.1f Mval/s   %6.2fx\n", name, mvs, baseline / seconds);
+}
+
+// Run fn BENCH_REPEATS times, return the fastest wall time
+static double time_best(void (*fn)(void)) {
+    double best = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_seconds();
+        fn();
+        double dt = now_seconds() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+static uint64_t rng_state = 12345u;
+
+static uint64_t rng(void) {
+    rng_state = rng_state * 6364136223846793005u + 1442695040888963407u;
+    return rng_state >> 11;
+}
+
+// fill writes n values, each the sum of four uniform draws in -d..d:
+// |v| <= 4d, most near 0, like the deltas of a smooth series.
+static void fill(int64_t *v, size_t n, int64_t d) {
+    uint64_t w = 2 * (uint64_t)d + 1;
+    for (size_t i = 0; i < n; i++) {
+        int64_t s = 0;
+        for (int k = 0; k < 4; k++) {
+            s += (int64_t)(rng() % w) - d;
+        }
+        v[i] = s;
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Baseline - Zig-Zag LEB128
+// ────────────────────────────────────────────────────────────────
+
+static size_t leb_encode(const int64_t *in, size_t n, uint8_t *out) {
+    size_t o = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t z = ((uint64_t)in[i] << 1) ^ (uint64_t)(in[i] >> 63);
+        while (z >= 0x80) {
+            out[o++] = (uint8_t)(z | 0x80);
+            z >>= 7;
+        }
+        out[o++] = (uint8_t)z;
+    }
+    return o;
+}
+
+static size_t leb_decode(const uint8_t *in, int64_t *out, size_t n) {
+    size_t p = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t z = 0;
+        unsigned s = 0;
+        uint8_t b;
+        do {
+            b = in[p++];
+            z |= (uint64_t)(b & 0x7F) << s;
+            s += 7;
+        } while (b & 0x80);
+        out[i] = (int64_t)(z >> 1) ^ -(int64_t)(z & 1);
+    }
+    return p;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Benchmark Cases
+// ────────────────────────────────────────────────────────────────
+
+static void case_leb_encode(void) {
+    bench_sink += leb_encode(bench_values, bench_n, bench_scratch);
+}
+
+static void case_leb_decode(void) {
+    bench_sink += leb_decode(bench_leb, bench_back, bench_n);
+}
+
+static void case_encode(void) {
+    bench_sink += trit_vartrit_encode_i64(bench_values, bench_n, bench_scratch);
+}
+
+static void case_decode(void) {
+    bench_sink += trit_vartrit_decode_i64(bench_vt, bench_vt_n, bench_back, bench_n);
+}
+
+// run_op times the LEB128 baseline, then fn on each supported backend.
+static void run_op(const char *title, const char *fn_name, void (*fn)(void),
+                   const char *base_name, void (*base)(void)) {
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+    char name[64];
+
+    printf("\n  %s:\n", title);
+    double baseline = time_best(base);
+    report(base_name, baseline, baseline);
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_select(backends[i])) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s [%s]", fn_name, trit_backend_name(backends[i]));
+        report(name, time_best(fn), baseline);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Entry Point
+// ────────────────────────────────────────────────────────────────
+
+int main(int argc, char **argv) {
+    static const int64_t spreads[] = { 1, 30, 1500, INT64_C(1) << 34 };
+    static const char *const labels[] = { "|v| <= 4", "|v| ~ 60", "|v| ~ 3000", "|v| ~ 2^35" };
+
+    bench_n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_VALUES;
+
+    bench_values = malloc(bench_n * sizeof(int64_t) + 1);
+    bench_back = malloc(bench_n * sizeof(int64_t) + 1);
+    bench_vt = malloc(bench_n * TRIT_VARTRIT_MAX64 + 1);
+    bench_leb = malloc(bench_n * LEB128_MAX + 1);
+    bench_scratch = malloc(bench_n * LEB128_MAX + 1);
+    if (!bench_values || !bench_back || !bench_vt || !bench_leb || !bench_scratch) {
+        printf("✗ Allocation failed for %zu values\n", bench_n);
+        return 1;
+    }
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit vartrit benchmarks: %zu int64 values (auto backend: %s)\n",
+           bench_n, trit_backend_name(trit_backend_active()));
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    for (size_t k = 0; k < sizeof(spreads) / sizeof(spreads[0]); k++) {
+        char title[96];
+
+        // Deterministic data per magnitude; checked once before timing
+        fill(bench_values, bench_n, spreads[k]);
+        bench_vt_n = trit_vartrit_encode_i64(bench_values, bench_n, bench_vt);
+        bench_leb_n = leb_encode(bench_values, bench_n, bench_leb);
+        if (trit_vartrit_decode_i64(bench_vt, bench_vt_n, bench_back, bench_n) != bench_vt_n ||
+            memcmp(bench_back, bench_values, bench_n * sizeof(int64_t)) != 0) {
+            printf("✗ Round-trip differs at %s\n", labels[k]);
+            return 1;
+        }
+
+        printf("\n%s: vartrit %.3f bytes/value, zig-zag LEB128 %.3f\n", labels[k],
+               (double)bench_vt_n / (double)bench_n, (double)bench_leb_n / (double)bench_n);
+
+        snprintf(title, sizeof(title), "%s encode", labels[k]);
+        run_op(title, "trit_vartrit_encode_i64", case_encode, "LEB128 encode", case_leb_encode);
+        snprintf(title, sizeof(title), "%s decode", labels[k]);
+        run_op(title, "trit_vartrit_decode_i64", case_decode, "LEB128 decode", case_leb_decode);
+    }
+
+    printf("\n  (sink %zu)\n", (size_t)bench_sink);
+
+    free(bench_values);
+    free(bench_back);
+    free(bench_vt);
+    free(bench_leb);
+    free(bench_scratch);
+    return 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add new cases (static void case_*(void) + run_op line in main)
+//   ✅ Value count and the spreads list in main
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Sink updates (without them the optimizer deletes the work)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// Numbers are machine-specific. Compare cases within one run, not across
+// machines. "Count the cost" — Luke 14:28
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
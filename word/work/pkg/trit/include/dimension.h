@@ -87,6 +87,7 @@
 //   - Standard Library: None beyond trit.h dependencies
 //   - External: None
 //   - Internal: trit.h (trit_t type definition)
+//   - Platform: POSIX threads for trit_navigate_scan_mt (link with -pthread)
 //
 // What Uses This:
 //
@@ -272,6 +273,53 @@ trit_t dimension_to_trit(dimension_t dim);
 //   trit_navigate(TRIT_POS, DIR_BUILD_UP) == TRIT_POS (clamped)
 trit_t trit_navigate(trit_t current, direction_t dir);
 
+// Navigate every trit of an array in the same direction (src/array.c).
+//
+// out[i] = trit_navigate(in[i], dir), computed as a clamped int8 add on
+// the active backend (see trit_backend_select). out may equal in.
+//
+// Parameters:
+//   in: n valid trits
+//   n: Element count
+//   dir: Direction applied to every element
+//   out: n trits
+void trit_navigate_array(const trit_t *in, size_t n, direction_t dir, trit_t *out);
+
+// Fold trit_navigate along a sequence of directions (src/scan.c).
+//
+// out[i] = trit_navigate(out[i - 1], dirs[i]), starting from start: a
+// running balance saturated to [-1, +1]. dirs holds direction values as
+// trit_t. out may equal dirs.
+//
+// Parameters:
+//   dirs: n valid trits (-1 BREAK_DOWN, 0 ANCHOR, +1 BUILD_UP)
+//   n: Element count
+//   start: Position before dirs[0]
+//   out: n trits
+//
+// Returns: the final position (start if n == 0), the start of the next
+//          block when a long sequence is scanned in pieces.
+trit_t trit_navigate_scan(const trit_t *dirs, size_t n, trit_t start, trit_t *out);
+
+// Where the fold over dirs ends from each start (src/scan.c).
+//
+// Sets map[TRIT_TO_UNSIGNED(s)] to trit_navigate_scan's result from start
+// s, without writing a scan. Pass one of a blocked parallel scan: map each
+// block (on any thread), chain the maps in order to get every block's
+// start, then scan the blocks.
+//
+// Parameters:
+//   dirs: n valid trits
+//   n: Element count
+//   map: 3 trits (the identity -1, 0, +1 for n == 0)
+void trit_navigate_map(const trit_t *dirs, size_t n, trit_t map[3]);
+
+// trit_navigate_scan run as the blocked scan above on up to `threads`
+// threads, started and joined inside the call (0 or 1: the caller only).
+// Same results as trit_navigate_scan.
+trit_t trit_navigate_scan_mt(const trit_t *dirs, size_t n, trit_t start, trit_t *out,
+                             unsigned threads);
+
 // Get the direction to navigate from one dimension to another.
 //
 // Answers: "What direction do I move to get from 'from' to 'to'?"
@@ -337,6 +385,10 @@ const char* dimension_phrase(dimension_t dim);
 //   ├── trit_to_dimension()   → interprets trit as dimension
 //   ├── dimension_to_trit()   → gets trit value from dimension
 //   ├── trit_navigate()       → moves through dimensional space
+//   ├── trit_navigate_array() → moves a whole array (src/array.c)
+//   ├── trit_navigate_scan()  → folds trit_navigate along a sequence (src/scan.c)
+//   ├── trit_navigate_map()   → end position per start, for blocked scans (src/scan.c)
+//   ├── trit_navigate_scan_mt() → trit_navigate_scan on threads (src/scan.c)
 //   ├── dimension_path()      → finds direction between dimensions
 //   ├── dimension_question()  → gets cognitive question ("when/where/what")
 //   └── dimension_phrase()    → gets Genesis 1:1 phrase
@@ -351,9 +403,9 @@ const char* dimension_phrase(dimension_t dim);
 //   Query: Entry → dimension_question() / dimension_phrase() → return string
 //
 // APUs (Available Processing Units):
-//   - 6 functions total
+//   - 10 functions total
 //   - 0 helpers (all public)
-//   - 6 public APIs
+//   - 10 public APIs
 //
 // Type Definitions:
 //   ├── dimension_t → cognitive dimension enum (TEMPORAL, SPATIAL, MATERIAL)
@@ -361,10 +413,12 @@ const char* dimension_phrase(dimension_t dim);
 //
 // Implementation Location:
 //   All function implementations in: src/dimension.c
+//   (trit_navigate_array in src/array.c, beside the other array kernels;
+//   trit_navigate_scan/map/scan_mt in src/scan.c, beside the prefix sums)
 //
 // Declared Units:
 // - 2 enums (dimension_t, direction_t)
-// - 6 function prototypes
+// - 10 function prototypes
 // - 0 extern variables
 
 // ────────────────────────────────────────────────────────────────
@@ -400,7 +454,9 @@ const char* dimension_phrase(dimension_t dim);
 //
 // Complete public interface declared in SETUP "Function Prototypes":
 //   - trit_to_dimension, dimension_to_trit (conversion)
-//   - trit_navigate, dimension_path (navigation)
+//   - trit_navigate, trit_navigate_array, trit_navigate_scan,
+//     trit_navigate_map, trit_navigate_scan_mt, dimension_path
+//     (navigation)
 //   - dimension_question, dimension_phrase (query)
 
 // ============================================================================
@@ -0,0 +1,387 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Three-Valued (Kleene) Logic
+// Key: B-word-work-pkg-trit-include-logic
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h, tritop.h)
+//   Depends on trit.h for trit_t and trit64b_t, tritop.h for the
+//   truth-table operators
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/research/ternary/ternary-logic-algorithms.adoc
+//      word/core/primitives.toml [bool3]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_LOGIC_H
+#define BERESHIT_LOGIC_H
+
+// bool3 (false / unknown / true) and the Kleene connectives: one value at
+// a time, a whole array at a time, or 64 values per bit-plane word.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "But let your yea be yea; and your nay, nay; lest ye fall
+//            into condemnation." — James 5:12
+//
+// Principle: Yea, nay, and the honest "not yet known" between them. A
+//            logic that cannot say "unknown" must guess.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: The bool3 primitive of word/core/primitives.toml and the
+//       operations ternary-logic-algorithms.adoc specifies for it.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Evaluate three-valued predicates and predicate masks without
+//          a branch per value.
+//
+// Core Design: A bool3_t is a trit_t: -1 false, 0 unknown, +1 true. The
+//   Kleene connectives are then integer operations:
+//
+//     NOT a          -a
+//     a AND b        min(a, b)           a NAND b   -min(a, b)
+//     a OR b         max(a, b)           a NOR b    -max(a, b)
+//     a XOR b        -(a·b)              CONSENSUS  a·b
+//     a EQ b         a == b ? +1 : -1    a → b      max(-a, b)
+//     COMPARE        sign(a - b)
+//
+//   Three forms of each:
+//     - bool3_*      inline scalar, branch-free
+//     - bool3x64_*   inline over a trit64b_t: 64 values in 1-6 bit ops
+//     - bool3_apply / bool3x64_apply  whole arrays (src/logic.c), on the
+//       active backend
+//
+//   bool3_op_t values are the operators' trit9 truth-table IDs
+//   (TRIT_OP2_ID), so any of them also works with trit_op2_apply and
+//   trit_op2_compile.
+//
+// Key Features:
+//
+//   - All nine connectives of the logic doc, including three-way compare
+//   - Scalar ops compile to min/max/neg/imul - no branches
+//   - Bitsliced ops are the plane formulas the operator search finds
+//   - Bulk forms run 16-64 values per instruction
+//
+// Philosophy: Unknown is a value, not an exception.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: trit.h (trit_t, trit64b_t), tritop.h (TRIT_OP2_* IDs)
+//
+// What Uses This:
+//
+//   - Predicate evaluation over three-valued masks (filters, health
+//     checks, contracts returning bool3)
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "logic.h"
+//
+// Integration Pattern:
+//
+//  1. One value: bool3_and(a, b), bool3_implies(a, b), ...
+//  2. Bitsliced masks: trit64b_from_trits / trit5_to_trit64b_array, then
+//     bool3x64_and(...) per word or bool3x64_apply(BOOL3_OP_AND, ...)
+//  3. bool3_t arrays: bool3_apply(BOOL3_OP_AND, a, b, n, out)
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None. Inline functions are defined here; the bulk forms live in
+// src/logic.c.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Defines → Types → Inline Operations → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"       // trit_t, trit64b_t
+#include "tritop.h"     // TRIT_OP2_* truth-table IDs
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+//--- Truth Values ---
+// See: word/core/primitives.toml [bool3]
+
+#define BOOL3_FALSE    TRIT_NEG    // -1: definite no
+#define BOOL3_UNKNOWN  TRIT_ZERO   //  0: indeterminate (the default)
+#define BOOL3_TRUE     TRIT_POS    // +1: definite yes
+
+// ────────────────────────────────────────────────────────────────
+// Type Definitions
+// ────────────────────────────────────────────────────────────────
+
+// bool3_t is one three-valued truth value (BOOL3_FALSE, _UNKNOWN, _TRUE).
+typedef trit_t bool3_t;
+
+// bool3x64_t is 64 truth values in bit-planes: pos = true, neg = false,
+// neither = unknown (the trit64b_t layout).
+typedef trit64b_t bool3x64_t;
+
+// bool3_op_t names a connective for the bulk forms. Each value is the
+// operator's trit9 truth-table ID; NOT ignores b.
+typedef enum {
+    BOOL3_OP_NOT       = TRIT_OP2_ID(1, 1, 1, 0, 0, 0, -1, -1, -1),
+    BOOL3_OP_AND       = TRIT_OP2_AND,
+    BOOL3_OP_OR        = TRIT_OP2_OR,
+    BOOL3_OP_NAND      = TRIT_OP2_NAND,
+    BOOL3_OP_NOR       = TRIT_OP2_NOR,
+    BOOL3_OP_XOR       = TRIT_OP2_XOR,
+    BOOL3_OP_CONSENSUS = TRIT_OP2_CONSENSUS,
+    BOOL3_OP_EQUAL     = TRIT_OP2_EQUALITY,
+    BOOL3_OP_IMPLIES   = TRIT_OP2_IMPLIES,
+    BOOL3_OP_COMPARE   = TRIT_OP2_COMPARE
+} bool3_op_t;
+
+// ────────────────────────────────────────────────────────────────
+// Inline Operations - Scalar
+// ────────────────────────────────────────────────────────────────
+//
+// Inputs must be valid (-1, 0, +1), as for trit_add.
+
+static inline bool3_t bool3_not(bool3_t a) { return (bool3_t)-a; }
+static inline bool3_t bool3_and(bool3_t a, bool3_t b) { return a < b ? a : b; }
+static inline bool3_t bool3_or(bool3_t a, bool3_t b) { return a > b ? a : b; }
+static inline bool3_t bool3_nand(bool3_t a, bool3_t b) { return (bool3_t)-(a < b ? a : b); }
+static inline bool3_t bool3_nor(bool3_t a, bool3_t b) { return (bool3_t)-(a > b ? a : b); }
+
+// XOR: unknown if either is unknown, true if the definite values differ.
+static inline bool3_t bool3_xor(bool3_t a, bool3_t b) { return (bool3_t)-(a * b); }
+
+// CONSENSUS: true if both agree, false if they disagree, else unknown.
+static inline bool3_t bool3_consensus(bool3_t a, bool3_t b) { return (bool3_t)(a * b); }
+
+// EQUALITY: structural - unknown equals unknown.
+static inline bool3_t bool3_equal(bool3_t a, bool3_t b) { return (bool3_t)(2 * (a == b) - 1); }
+
+// IMPLICATION: NOT a OR b.
+static inline bool3_t bool3_implies(bool3_t a, bool3_t b) { return (bool3_t)(-a > b ? -a : b); }
+
+// COMPARE: -1 if a < b, 0 if equal, +1 if a > b (false < unknown < true).
+static inline bool3_t bool3_compare(bool3_t a, bool3_t b) { return (bool3_t)((a > b) - (a < b)); }
+
+// ────────────────────────────────────────────────────────────────
+// Inline Operations - Bitsliced (64 values per call)
+// ────────────────────────────────────────────────────────────────
+//
+// Lane-wise over valid lanes (never both planes set). Every output lane
+// is valid, including lanes past the caller's n.
+
+static inline bool3x64_t bool3x64_not(bool3x64_t a) {
+    bool3x64_t r = { a.neg, a.pos };
+    return r;
+}
+
+static inline bool3x64_t bool3x64_and(bool3x64_t a, bool3x64_t b) {
+    bool3x64_t r = { a.pos & b.pos, a.neg | b.neg };
+    return r;
+}
+
+static inline bool3x64_t bool3x64_or(bool3x64_t a, bool3x64_t b) {
+    bool3x64_t r = { a.pos | b.pos, a.neg & b.neg };
+    return r;
+}
+
+static inline bool3x64_t bool3x64_nand(bool3x64_t a, bool3x64_t b) {
+    bool3x64_t r = { a.neg | b.neg, a.pos & b.pos };
+    return r;
+}
+
+static inline bool3x64_t bool3x64_nor(bool3x64_t a, bool3x64_t b) {
+    bool3x64_t r = { a.neg & b.neg, a.pos | b.pos };
+    return r;
+}
+
+// Definite and different → true; definite and alike → false.
+static inline bool3x64_t bool3x64_xor(bool3x64_t a, bool3x64_t b) {
+    bool3x64_t r = { (a.pos & b.neg) | (a.neg & b.pos), (a.pos & b.pos) | (a.neg & b.neg) };
+    return r;
+}
+
+static inline bool3x64_t bool3x64_consensus(bool3x64_t a, bool3x64_t b) {
+    bool3x64_t r = { (a.pos & b.pos) | (a.neg & b.neg), (a.pos & b.neg) | (a.neg & b.pos) };
+    return r;
+}
+
+// Equal lanes: both true, both false, or neither plane set in either.
+static inline bool3x64_t bool3x64_equal(bool3x64_t a, bool3x64_t b) {
+    uint64_t eq = (a.pos & b.pos) | (a.neg & b.neg) | ~(a.pos | a.neg | b.pos | b.neg);
+    bool3x64_t r = { eq, ~eq };
+    return r;
+}
+
+static inline bool3x64_t bool3x64_implies(bool3x64_t a, bool3x64_t b) {
+    bool3x64_t r = { a.neg | b.pos, a.pos & b.neg };
+    return r;
+}
+
+// a > b: a true and b not, or b false and a not.
+static inline bool3x64_t bool3x64_compare(bool3x64_t a, bool3x64_t b) {
+    bool3x64_t r = { (a.pos & ~b.pos) | (b.neg & ~a.neg), (b.pos & ~a.pos) | (a.neg & ~b.neg) };
+    return r;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Bulk Operations (src/logic.c) ---
+
+// out[i] = op(a[i], b[i]) over bool3_t arrays, one pshufb truth-table
+// lookup per 16-64 values on the active backend (trit_op2_apply).
+//
+// Parameters:
+//   op  - connective (its truth-table ID)
+//   a   - n valid values
+//   b   - n valid values; NULL for BOOL3_OP_NOT
+//   n   - element count
+//   out - n values (may equal a or b)
+void bool3_apply(bool3_op_t op, const bool3_t *a, const bool3_t *b, size_t n, bool3_t *out);
+
+// out[i] = op(a[i], b[i]) over n bitsliced words (64 values each), with
+// the bool3x64_* formula in a loop the compiler vectorizes.
+//
+// Parameters:
+//   op  - connective; any other truth-table ID runs as a compiled program
+//   a   - n words
+//   b   - n words; NULL for BOOL3_OP_NOT
+//   n   - word count
+//   out - n words (may equal a or b)
+void bool3x64_apply(bool3_op_t op, const bool3x64_t *a, const bool3x64_t *b, size_t n,
+                    bool3x64_t *out);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: Inline operations are defined in SETUP above. Bulk functions are
+// implemented in src/logic.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── Scalar:    bool3_{not, and, or, nand, nor, xor, consensus, equal,
+//   │              implies, compare}
+//   ├── Bitsliced: bool3x64_{...same ten}
+//   └── Bulk:      bool3_apply, bool3x64_apply
+//
+// Declared Units:
+// - 3 types (bool3_t, bool3x64_t, bool3_op_t)
+// - 3 #define constants
+// - 20 inline functions
+// - 2 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Strategy: None needed - every connective is total over valid values.
+//   Invalid inputs (outside -1..+1, or both planes set) give unspecified
+//   results, as for trit_add and trit64b_add.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "logic.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-logic   Benchmark: make bench-logic
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add connectives (scalar + bitsliced inline, enum ID, bulk case)
+//
+// Modify with Care:
+//   ⚠️ bool3_op_t values are truth-table IDs - tests check each against
+//      the scalar form
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_LOGIC_H)
+//   ❌ bool3_t = trit_t with -1 false, 0 unknown, +1 true (primitives.toml)
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// The bitsliced forms are the fastest: 2 bits per value and 1-6 word
+// operations per 64 values. bool3_apply on int8 values is bounded by
+// memory bandwidth on large arrays.
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   bool3_t v = bool3_implies(BOOL3_UNKNOWN, BOOL3_TRUE);   // true
+//   bool3x64_t m = bool3x64_and(mask_a, mask_b);             // 64 at once
+//   bool3_apply(BOOL3_OP_OR, a, b, n, out);
+//   bool3x64_apply(BOOL3_OP_NOT, masks, NULL, words, masks);
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_LOGIC_H
@@ -68,8 +68,11 @@
 //   - trit5_t: 5 trits packed to 1 byte (243 states)
 //   - trit9_t: 9 trits packed to 2 bytes (19,683 states)
 //   - trit27_t: 27 trits packed to 6 bytes (7.6 trillion states)
+//   - trit40_t: 40 trits packed to 8 bytes (full uint64 word, 1.6 bits/trit)
+//   - trit64b_t: 64 trits bitsliced into two uint64 planes (BCT, lane-parallel)
 //   - Conversion macros: balanced ↔ unsigned
 //   - Power constants: precomputed 3^n arrays
+//   - Module headers build on these types (listed in the chart below)
 //
 // Philosophy: Measure twice, cut once. Types reflect eternal structure.
 //
@@ -89,6 +92,7 @@
 //
 //   - Libraries: All ternary computing libraries in MillenniumOS
 //   - Commands: demo-trit, future trit utilities
+//   - Headers: every other libtrit header includes this one
 //
 // # Usage & Integration
 //
@@ -109,6 +113,8 @@
 //      trit5_t     - 5 trits packed (1 byte)
 //      trit9_t     - 9 trits packed (2 bytes)
 //      trit27_t    - 27 trits packed (6 bytes)
+//      trit40_t    - 40 trits packed (8 bytes)
+//      trit64b_t   - 64 trits bitsliced (16 bytes, pos/neg planes)
 //
 //    Macros:
 //      TRIT_TO_UNSIGNED(t)   - convert balanced to unsigned
@@ -138,6 +144,7 @@
 //--- Standard Library ---
 #include <stdint.h>     // int8_t, uint8_t, uint16_t, uint64_t
 #include <stdbool.h>    // bool, true, false
+#include <stddef.h>     // size_t (array pack/unpack lengths)
 
 //--- Project Headers ---
 // [Reserved: Foundational type - no internal dependencies]
@@ -182,6 +189,7 @@
 #define TRIT5_BYTES   1   // 5 trits fit in 1 byte (243 ≤ 256)
 #define TRIT9_BYTES   2   // 9 trits fit in 2 bytes (19,683 ≤ 65,536)
 #define TRIT27_BYTES  6   // 27 trits fit in 6 bytes (7.6T ≤ 281T)
+#define TRIT40_BYTES  8   // 40 trits fit in 8 bytes (1.2e19 ≤ 1.8e19)
 
 //--- State Counts ---
 // Total possible states for each packed type.
@@ -189,6 +197,7 @@
 #define TRIT5_STATES   243                  // 3^5
 #define TRIT9_STATES   19683                // 3^9
 #define TRIT27_STATES  7625597484987ULL     // 3^27
+#define TRIT40_STATES  12157665459056928801ULL  // 3^40
 
 //--- Max Values ---
 // Maximum unsigned packed values (states - 1).
@@ -196,6 +205,34 @@
 #define TRIT5_MAX    242                    // 3^5 - 1
 #define TRIT9_MAX    19682                  // 3^9 - 1
 #define TRIT27_MAX   7625597484986ULL       // 3^27 - 1
+#define TRIT40_MAX   12157665459056928800ULL  // 3^40 - 1
+
+//--- Bias Values ---
+// Packed value of signed zero: packed = value + BIAS, BIAS = (3^n - 1) / 2.
+// Also the largest signed value (int5, int9, int27 in primitives.toml;
+// int40 by the same rule).
+
+#define TRIT5_BIAS   121                    // (3^5 - 1) / 2
+#define TRIT9_BIAS   9841                   // (3^9 - 1) / 2
+#define TRIT27_BIAS  3812798742493ULL       // (3^27 - 1) / 2
+#define TRIT40_BIAS  6078832729528464400ULL   // (3^40 - 1) / 2
+
+//--- Array Sizing ---
+// Bytes needed to hold n trits in t5b1 layout (5 trits per byte, last
+// byte zero-padded). See trit5_pack_array.
+
+#define TRIT5_PACKED_SIZE(n)  (((n) + 4) / 5)
+
+// Words needed to hold n trits as trit40_t (40 per word, last word padded
+// with TRIT_ZERO). One word carries exactly 8 t5b1 bytes.
+// See trit5_to_trit40_array.
+
+#define TRIT40_PACKED_SIZE(n)  (((n) + 39) / 40)
+
+// Bitsliced vectors needed to hold n trits (64 lanes each).
+// See trit5_to_trit64b_array.
+
+#define TRIT64B_COUNT(n)  (((n) + 63) / 64)
 
 // ────────────────────────────────────────────────────────────────
 // Type Definitions
@@ -246,6 +283,55 @@ typedef uint16_t trit9_t;
 //   trit27_t word = 3812798742493ULL;  // Middle value (balanced zero)
 typedef uint64_t trit27_t;
 
+// trit40_t holds 40 trits packed into a full 64-bit word (3^40 states).
+//
+// 3^40 ≈ 1.2e19 fits below 2^64, so every bit of the word carries trits:
+// 48% more trits than trit27_t per 8 bytes, the same 1.6 bits/trit as
+// trit5_t. Eight t5b1 bytes convert to one word without unpacking.
+//
+// Example:
+//   trit40_t word = 6078832729528464400ULL;  // Middle value (balanced zero)
+typedef uint64_t trit40_t;
+
+// trit64b_t holds 64 trits as two bit-planes (Frieder-Luk BCT).
+//
+// Lane i is bit i of both planes: pos set → +1, neg set → -1, neither → 0.
+// Both set is invalid (check with trit64b_valid). Logic and single-trit
+// arithmetic become a few AND/OR instructions across all 64 lanes.
+//
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 2]
+//
+// Example:
+//   trit64b_t v = { 0x1ULL, 0x2ULL };  // lane 0 = +1, lane 1 = -1, rest 0
+typedef struct {
+    uint64_t pos;   // bit i set → lane i is +1
+    uint64_t neg;   // bit i set → lane i is -1
+} trit64b_t;
+
+//--- Backend Selection ---
+
+// trit_backend_t names an implementation of the bulk kernels (decode,
+// element-wise arrays and tritmat dot products).
+//
+// The library picks the widest kernel the running CPU supports when it
+// loads (AUTO); callers may pin one for benchmarking or testing.
+//
+// Values:
+//   - TRIT_BACKEND_AUTO: best available (resolved at load time)
+//   - TRIT_BACKEND_SCALAR: portable reference, constant division
+//   - TRIT_BACKEND_TABLE: portable, one TRIT5_DECODE_TABLE load per byte
+//   - TRIT_BACKEND_SSE41: 16 bytes per step (x86 SSE4.1)
+//   - TRIT_BACKEND_AVX2: 32 bytes per step (x86 AVX2)
+//   - TRIT_BACKEND_AVX512: 64 bytes per step (x86 AVX-512F + BW)
+typedef enum {
+    TRIT_BACKEND_AUTO = 0,
+    TRIT_BACKEND_SCALAR,
+    TRIT_BACKEND_TABLE,
+    TRIT_BACKEND_SSE41,
+    TRIT_BACKEND_AVX2,
+    TRIT_BACKEND_AVX512
+} trit_backend_t;
+
 // ────────────────────────────────────────────────────────────────
 // Power Constants
 // ────────────────────────────────────────────────────────────────
@@ -277,6 +363,20 @@ static const uint64_t TRIT27_POWERS[27] = {
     94143178827ULL, 282429536481ULL, 847288609443ULL, 2541865828329ULL
 };
 
+//--- Trit40 Powers ---
+// Powers of 3 for 40-trit operations: 3^0 through 3^39
+static const uint64_t TRIT40_POWERS[40] = {
+    1ULL, 3ULL, 9ULL, 27ULL, 81ULL, 243ULL, 729ULL, 2187ULL, 6561ULL,
+    19683ULL, 59049ULL, 177147ULL, 531441ULL, 1594323ULL, 4782969ULL,
+    14348907ULL, 43046721ULL, 129140163ULL, 387420489ULL, 1162261467ULL,
+    3486784401ULL, 10460353203ULL, 31381059609ULL, 94143178827ULL,
+    282429536481ULL, 847288609443ULL, 2541865828329ULL, 7625597484987ULL,
+    22876792454961ULL, 68630377364883ULL, 205891132094649ULL,
+    617673396283947ULL, 1853020188851841ULL, 5559060566555523ULL,
+    16677181699666569ULL, 50031545098999707ULL, 150094635296999121ULL,
+    450283905890997363ULL, 1350851717672992089ULL, 4052555153018976267ULL
+};
+
 // ────────────────────────────────────────────────────────────────
 // Function Prototypes
 // ────────────────────────────────────────────────────────────────
@@ -326,15 +426,188 @@ trit27_t trit27_pack(const trit_t trits[27]);
 // Unpack 6 bytes into 27 trits.
 void trit27_unpack(trit27_t packed, trit_t trits[27]);
 
+// Pack 40 trits into one 64-bit word (0 to 3^40-1).
+trit40_t trit40_pack(const trit_t trits[40]);
+
+// Unpack one 64-bit word into 40 trits.
+void trit40_unpack(trit40_t packed, trit_t trits[40]);
+
 // Check if trit5 value is in spare range (243-255).
 // Spare states reserved for Bible Rail (WEB variants).
 bool trit5_is_spare(trit5_t value);
 
+//--- Array Pack/Unpack Operations (src/pack.c) ---
+
+// Pack n trits into TRIT5_PACKED_SIZE(n) bytes (t5b1 layout).
+// Trit i lands in byte i/5 at position i%5 (MST first, as trit5_pack).
+// A short final group is padded with TRIT_ZERO. Returns bytes written.
+size_t trit5_pack_array(const trit_t *in, size_t n, uint8_t *out);
+
+// Unpack n trits from TRIT5_PACKED_SIZE(n) bytes (t5b1 layout).
+// Only n trits are written; padding in the final byte is discarded.
+// Returns bytes consumed.
+size_t trit5_unpack_array(const uint8_t *in, size_t n, trit_t *out);
+
+// Convert n trits of t5b1 bytes into TRIT40_PACKED_SIZE(n) trit40 words.
+// Every 8 bytes become one word (trit i → word i/40, position i%40, MST
+// first, as trit40_pack); missing bytes of the last word count as zeros.
+// Trits are never expanded. Returns words written.
+size_t trit5_to_trit40_array(const uint8_t *in, size_t n, trit40_t *out);
+
+// Convert n trits of trit40 words back into TRIT5_PACKED_SIZE(n) bytes.
+// Exact inverse of trit5_to_trit40_array. Returns bytes written.
+size_t trit40_to_trit5_array(const trit40_t *in, size_t n, uint8_t *out);
+
+//--- Packed-Domain Integer Arithmetic (src/arith.c) ---
+// Packed values are signed integers plus BIAS (int5/int9/int27). Results
+// wrap modulo 3^n like an n-trit adder dropping its carry; *overflow (may
+// be NULL) reports the wrap.
+
+// Add/subtract packed int27 values without unpacking.
+trit27_t trit27_add(trit27_t a, trit27_t b, bool *overflow);
+trit27_t trit27_sub(trit27_t a, trit27_t b, bool *overflow);
+
+// Negate a packed int27 value (TRIT27_MAX - a). Never overflows.
+trit27_t trit27_neg(trit27_t a);
+
+// Compare packed int27 values as signed integers: -1, 0, +1.
+int trit27_cmp(trit27_t a, trit27_t b);
+
+// Convert between packed int27 and int64 (out of range wraps, sets *overflow).
+int64_t trit27_to_int64(trit27_t a);
+trit27_t trit27_from_int64(int64_t value, bool *overflow);
+
+// int9 on trit9_t - same contract as the int27 functions.
+trit9_t trit9_add(trit9_t a, trit9_t b, bool *overflow);
+trit9_t trit9_sub(trit9_t a, trit9_t b, bool *overflow);
+trit9_t trit9_neg(trit9_t a);
+int trit9_cmp(trit9_t a, trit9_t b);
+int trit9_to_int(trit9_t a);
+trit9_t trit9_from_int(int value, bool *overflow);
+
+// int5 on trit5_t - same contract; spare states (243-255) are not integers.
+trit5_t trit5_add(trit5_t a, trit5_t b, bool *overflow);
+trit5_t trit5_sub(trit5_t a, trit5_t b, bool *overflow);
+trit5_t trit5_neg(trit5_t a);
+int trit5_cmp(trit5_t a, trit5_t b);
+int trit5_to_int(trit5_t a);
+trit5_t trit5_from_int(int value, bool *overflow);
+
+//--- Table-Driven Decode (src/table.c) ---
+
+// Unpack a byte into 5 trits with one TRIT5_DECODE_TABLE load.
+// Same result as trit5_unpack for 0-242; spare states give all zeros.
+void trit5_unpack_table(trit5_t packed, trit_t trits[5]);
+
+// Unpack a trit9 word in two table stages (v = hi·81 + lo).
+// Same result as trit9_unpack for 0-19682.
+void trit9_unpack_table(trit9_t packed, trit_t trits[9]);
+
+// Unpack a trit27 word as three trit9 chunks split by reciprocal multiply.
+// Same result as trit27_unpack for 0 to TRIT27_STATES-1.
+void trit27_unpack_table(trit27_t packed, trit_t trits[27]);
+
+//--- Bitsliced Vectors (src/bitslice.c) ---
+
+// Check that no lane is both positive and negative.
+bool trit64b_valid(trit64b_t v);
+
+// Read lane i (0-63). Out-of-range lanes read as TRIT_ZERO.
+trit_t trit64b_get(trit64b_t v, unsigned lane);
+
+// Lane-wise trit_negate (also Kleene NOT): swap the planes.
+trit64b_t trit64b_negate(trit64b_t a);
+
+// Lane-wise trit_add (no carry, clamped).
+trit64b_t trit64b_add(trit64b_t a, trit64b_t b);
+
+// Lane-wise trit_multiply.
+trit64b_t trit64b_multiply(trit64b_t a, trit64b_t b);
+
+// Lane-wise Kleene AND (minimum) and OR (maximum).
+trit64b_t trit64b_and(trit64b_t a, trit64b_t b);
+trit64b_t trit64b_or(trit64b_t a, trit64b_t b);
+
+// Load n (≤ 64) trits into lanes 0..n-1; other lanes are zero.
+trit64b_t trit64b_from_trits(const trit_t *in, size_t n);
+
+// Store lanes 0..n-1 (n ≤ 64) as trit values.
+void trit64b_to_trits(trit64b_t v, size_t n, trit_t *out);
+
+// Convert n trits of t5b1 bytes into TRIT64B_COUNT(n) vectors
+// (trit i → lane i%64 of vector i/64). Returns vectors written.
+size_t trit5_to_trit64b_array(const uint8_t *in, size_t n, trit64b_t *out);
+
+// Convert n trits of vectors back into TRIT5_PACKED_SIZE(n) bytes.
+// Exact inverse of trit5_to_trit64b_array. Returns bytes written.
+size_t trit64b_to_trit5_array(const trit64b_t *in, size_t n, uint8_t *out);
+
+//--- Multi-Trit Adders (src/adder.c) ---
+
+// Full adder: a + b + carry_in = 3·carry_out + sum. carry_out may be NULL.
+trit_t trit_full_add(trit_t a, trit_t b, trit_t carry_in, trit_t *carry_out);
+
+// Ripple-carry add of two n-trit MST-first numbers. out may alias a or b.
+// Returns the carry out of element 0 (the most significant trit).
+trit_t trit_ripple_add(const trit_t *a, const trit_t *b, size_t n,
+                       trit_t carry_in, trit_t *out);
+
+// Carry-lookahead add of two width-trit numbers (lane i = weight 3^i,
+// width ≤ 64). ceil(log2 width) prefix levels. carry_out may be NULL.
+trit64b_t trit64b_add_carry(trit64b_t a, trit64b_t b, unsigned width,
+                            trit_t carry_in, trit_t *carry_out);
+
+// Move a packed int27 into lanes 0..26 (lane i = weight 3^i) and back.
+trit64b_t trit64b_from_trit27(trit27_t value);
+trit27_t trit64b_to_trit27(trit64b_t v);
+
+//--- Vectorized Kernels and Dispatch (src/simd.c) ---
+
+// Unpack `groups` whole bytes into 5·groups trits with the active backend.
+// Division-free; trit5_unpack_array uses this for its full groups.
+void trit5_unpack_groups(const uint8_t *in, size_t groups, trit_t *out);
+
+// Backend currently installed (never TRIT_BACKEND_AUTO).
+trit_backend_t trit_backend_active(void);
+
+// Check whether the running CPU can execute a backend.
+bool trit_backend_supported(trit_backend_t backend);
+
+// Install a backend (AUTO = best). Returns false, keeping the current
+// backend, if this CPU cannot run it. Safe while other threads run
+// kernels: each call sees the old or the new backend, with the same
+// results (GCC/Clang; with other compilers select before starting threads).
+bool trit_backend_select(trit_backend_t backend);
+
+// Static display name for a backend ("scalar", "avx2", ...).
+const char *trit_backend_name(trit_backend_t backend);
+
+//--- Element-wise Array Kernels (src/array.c) ---
+// Bulk forms of the single-trit operations on the active backend (16-64
+// trits per instruction). out may equal an input; inputs must be valid.
+
+// out[i] = trit_negate(in[i]).
+void trit_negate_array(const trit_t *in, size_t n, trit_t *out);
+
+// out[i] = trit_add(a[i], b[i]) (clamped, no carry).
+void trit_add_array(const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+
+// out[i] = trit_multiply(a[i], b[i]).
+void trit_multiply_array(const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+
 // ────────────────────────────────────────────────────────────────
 // Extern Declarations
 // ────────────────────────────────────────────────────────────────
-//
-// [Reserved: No extern variables needed - all constants are #define or static const]
+
+//--- Decode Tables (src/table.c) ---
+// Built by the compiler from the trit5/trit4 place values - no runtime init.
+
+// Byte v → its 5 trits, MST first, padded to 8 for whole-row copies.
+// Rows 243-255 (spare states) are all TRIT_ZERO.
+extern const trit_t TRIT5_DECODE_TABLE[256][8];
+
+// Value v (0-80) → its 4 trits, MST first. Low stage of trit9 decode.
+extern const trit_t TRIT4_DECODE_TABLE[81][4];
 
 // ============================================================================
 // END SETUP
@@ -355,27 +628,58 @@ bool trit5_is_spare(trit5_t value);
 //   ├── trit_t      → single balanced ternary digit (-1, 0, +1)
 //   ├── trit5_t     → 5 trits packed (1 byte, 243 states)
 //   ├── trit9_t     → 9 trits packed (2 bytes, 19,683 states)
-//   └── trit27_t    → 27 trits packed (6 bytes, 7.6T states)
+//   ├── trit27_t    → 27 trits packed (6 bytes, 7.6T states)
+//   ├── trit40_t    → 40 trits packed (8 bytes, 1.2e19 states)
+//   ├── trit64b_t   → 64 trits bitsliced (pos/neg planes, 16 bytes)
+//   └── trit_backend_t → kernel implementation of the bulk operations
 //
 // Constants:
 //   ├── TRIT_NEG, TRIT_ZERO, TRIT_POS     → computational values
 //   ├── TRIT_MATTER, TRIT_TIME, TRIT_SPACE → dimensional aliases
 //   ├── TRIT_TO_UNSIGNED, UNSIGNED_TO_TRIT → conversion macros
-//   ├── TRIT5_BYTES, TRIT9_BYTES, TRIT27_BYTES → storage sizes
-//   ├── TRIT5_STATES, TRIT9_STATES, TRIT27_STATES → state counts
-//   ├── TRIT5_MAX, TRIT9_MAX, TRIT27_MAX → max packed values
-//   └── TRIT5_POWERS[], TRIT9_POWERS[], TRIT27_POWERS[] → power arrays
+//   ├── TRIT5_BYTES, TRIT9_BYTES, TRIT27_BYTES, TRIT40_BYTES → storage sizes
+//   ├── TRIT5_STATES, TRIT9_STATES, TRIT27_STATES, TRIT40_STATES → state counts
+//   ├── TRIT5_MAX, TRIT9_MAX, TRIT27_MAX, TRIT40_MAX → max packed values
+//   ├── TRIT5_BIAS, TRIT9_BIAS, TRIT27_BIAS, TRIT40_BIAS → packed value of signed zero
+//   ├── TRIT5_PACKED_SIZE(n) → bytes for an n-trit t5b1 array
+//   ├── TRIT40_PACKED_SIZE(n) → words for an n-trit trit40 array
+//   ├── TRIT64B_COUNT(n) → vectors for an n-trit bitsliced array
+//   └── TRIT5_POWERS[], TRIT9_POWERS[], TRIT27_POWERS[], TRIT40_POWERS[] → power arrays
 //
 // Functions:
 //   trit.c: trit_create, trit_valid, trit_value, trit_negate, trit_add, trit_multiply
-//   pack.c: trit5_pack, trit5_unpack, trit9_pack, trit9_unpack, trit27_pack, trit27_unpack, trit5_is_spare
+//   pack.c: trit5_pack, trit5_unpack, trit9_pack, trit9_unpack, trit27_pack, trit27_unpack,
+//           trit40_pack, trit40_unpack, trit5_is_spare,
+//           trit5_pack_array, trit5_unpack_array, trit5_to_trit40_array, trit40_to_trit5_array
+//   arith.c: trit{5,9,27}_add, _sub, _neg, _cmp, trit27_to_int64/from_int64,
+//            trit{5,9}_to_int/from_int
+//   table.c: trit5_unpack_table, trit9_unpack_table, trit27_unpack_table
+//   bitslice.c: trit64b_valid, trit64b_get, trit64b_negate, trit64b_add, trit64b_multiply,
+//               trit64b_and, trit64b_or, trit64b_from_trits, trit64b_to_trits,
+//               trit5_to_trit64b_array, trit64b_to_trit5_array
+//   adder.c: trit_full_add, trit_ripple_add, trit64b_add_carry,
+//            trit64b_from_trit27, trit64b_to_trit27
+//   simd.c: trit5_unpack_groups, trit_backend_active, trit_backend_supported,
+//           trit_backend_select, trit_backend_name
+//   array.c: trit_negate_array, trit_add_array, trit_multiply_array
+//
+// Module headers (each builds on this one):
+//   tritbig.h (tritbig.c, radix.c), tritmat.h (tritmat.c, tritdot.c),
+//   tritindex.h (tritindex.c), tritop.h (tritop.c), logic.h (logic.c),
+//   tritfilter.h (tritfilter.c), tritreduce.h (reduce.c),
+//   tritscan.h (scan.c), tritvote.h (tritvote.c), tritrle.h (rle.c),
+//   tritrans.h (rans.c), vartrit.h (vartrit.c), tritcol.h (tritcol.c),
+//   tritfile.h (tritfile.c)
 //
 // Declared Units:
-// - 4 types (trit_t, trit5_t, trit9_t, trit27_t)
-// - 15 #define constants
-// - 3 static const arrays
-// - 13 function prototypes (6 trit ops + 7 pack ops)
-// - 0 extern variables
+// - 7 types (trit_t, trit5_t, trit9_t, trit27_t, trit40_t, trit64b_t,
+//   trit_backend_t)
+// - 25 #define constants
+// - 4 static const arrays
+// - 64 function prototypes here (6 trit ops + 13 pack ops + 18 arith ops
+//   + 3 table ops + 11 bitslice ops + 5 adder ops + 5 dispatch ops + 3 array
+//   ops); the module headers listed above declare their own
+// - 2 extern const tables (TRIT5_DECODE_TABLE, TRIT4_DECODE_TABLE)
 
 // ────────────────────────────────────────────────────────────────
 // Helpers/Utilities
@@ -401,7 +705,38 @@ bool trit5_is_spare(trit5_t value);
 //   - trit5_pack/unpack: 5 trits ↔ 1 byte
 //   - trit9_pack/unpack: 9 trits ↔ 2 bytes
 //   - trit27_pack/unpack: 27 trits ↔ 6 bytes
+//   - trit40_pack/unpack: 40 trits ↔ 8 bytes (one full word)
 //   - trit5_is_spare: Check for Bible Rail range (243-255)
+//   - trit5_pack_array/unpack_array: n trits ↔ ceil(n/5) bytes in one call
+//   - trit5_to_trit40_array/trit40_to_trit5_array: 8 bytes ↔ 1 word
+//
+// Packed-Domain Arithmetic (src/arith.c):
+//   - trit{5,9,27}_add/sub: biased sum, wrapped modulo 3^n, overflow flag
+//   - trit{5,9,27}_neg/cmp: MAX - a / integer compare
+//   - to/from int: subtract/add BIAS
+//
+// Table-Driven Decode (src/table.c):
+//   - trit5_unpack_table: one load per byte
+//   - trit9_unpack_table: one multiply-shift + two loads per word
+//   - trit27_unpack_table: two reciprocal multiplies + three trit9 decodes
+//
+// Bitsliced Vectors (src/bitslice.c):
+//   - trit64b_negate/add/multiply/and/or: 64 lanes per call, pure bit logic
+//   - trit64b_from_trits/to_trits: trit_t arrays ↔ planes, 8 trits per step
+//   - trit5_to_trit64b_array/trit64b_to_trit5_array: t5b1 ↔ planes
+//
+// Multi-Trit Adders (src/adder.c):
+//   - trit_full_add: 27-entry full adder table with carry in/out
+//   - trit_ripple_add: n-trit arrays, carry ripples LST → MST
+//   - trit64b_add_carry: Kogge-Stone carry-lookahead, log2(width) levels
+//
+// Vectorized Kernels (src/simd.c):
+//   - trit5_unpack_groups: division-free bulk decode, backend-dispatched
+//   - trit_backend_*: query/select SCALAR, TABLE, SSE41, AVX2, AVX512 kernels
+//
+// Element-wise Array Kernels (src/array.c):
+//   - trit_negate/add/multiply_array: int8 lane arithmetic (sub, add +
+//     max/min clamp, psignb), backend-dispatched
 
 // ────────────────────────────────────────────────────────────────
 // Error Handling
@@ -411,14 +746,15 @@ bool trit5_is_spare(trit5_t value);
 //   - trit_create(invalid) → TRIT_ZERO
 //   - trit_valid(t) → bool for explicit checking
 //   - Pack/unpack assume valid input (undefined behavior if invalid)
+//   - Packed arithmetic wraps modulo 3^n; optional bool *overflow reports it
 
 // ────────────────────────────────────────────────────────────────
 // Public APIs
 // ────────────────────────────────────────────────────────────────
 //
 // Complete public interface:
-//   - Types: trit_t, trit5_t, trit9_t, trit27_t
-//   - Constants: TRIT_*, TRIT5_*, TRIT9_*, TRIT27_*
+//   - Types: trit_t, trit5_t, trit9_t, trit27_t, trit40_t, trit64b_t, trit_backend_t
+//   - Constants: TRIT_*, TRIT5_*, TRIT9_*, TRIT27_*, TRIT40_*
 //   - Macros: TRIT_TO_UNSIGNED, UNSIGNED_TO_TRIT
 //   - Functions: See "Function Prototypes" section above
 
@@ -461,8 +797,10 @@ bool trit5_is_spare(trit5_t value);
 // See METADATA "Purpose & Function" section above.
 //
 // Quick summary: Balanced ternary types with dimensional meaning from
-// Genesis 1:1. Four types (trit_t, trit5_t, trit9_t, trit27_t), conversion
-// macros, and precomputed power arrays.
+// Genesis 1:1. Six trit types (trit_t, trit5_t, trit9_t, trit27_t,
+// trit40_t, trit64b_t) plus trit_backend_t, conversion macros, precomputed
+// power arrays, and the pack, arithmetic, bitslice, adder and dispatch
+// functions every module header builds on.
 
 // ────────────────────────────────────────────────────────────────
 // Modification Policy
@@ -509,8 +847,11 @@ bool trit5_is_spare(trit5_t value);
 //   - trit5_t: 1 byte (uint8_t)
 //   - trit9_t: 2 bytes (uint16_t)
 //   - trit27_t: 8 bytes (uint64_t, 6 bytes used)
+//   - trit40_t: 8 bytes (uint64_t, 63.4 bits used - same density as trit5)
+//   - trit64b_t: 16 bytes (2 bits/trit - trades density for bit-parallel logic)
 //
 // Power Arrays: Static const, no runtime allocation.
+// Decode Tables: 2 KB + 324 bytes of .rodata, L1 resident.
 // Conversion Macros: Single arithmetic operation each.
 
 // ────────────────────────────────────────────────────────────────
@@ -547,7 +888,7 @@ bool trit5_is_spare(trit5_t value);
 //
 // Research:
 //   - Ternary arithmetic operations
-//   - SIMD-optimized trit27 operations
+//   - SIMD-optimized trit27 operations (trit5 decode done: src/simd.c)
 //   - Hardware trit support investigation
 
 // ────────────────────────────────────────────────────────────────
@@ -584,6 +925,7 @@ bool trit5_is_spare(trit5_t value);
 //   TRIT5_POWERS[i]   // 3^i for i in 0..4
 //   TRIT9_POWERS[i]   // 3^i for i in 0..8
 //   TRIT27_POWERS[i]  // 3^i for i in 0..26
+//   TRIT40_POWERS[i]  // 3^i for i in 0..39
 //
 // Compile:
 //   gcc -c -Wall -Wextra -std=c99 your_code.c
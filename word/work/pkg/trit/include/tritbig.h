@@ -0,0 +1,357 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Arbitrary-Precision Balanced Ternary Integers
+// Key: B-word-work-pkg-trit-include-tritbig
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//   Depends on trit.h for trit_t, trit27_t and the trit27 constants
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Division]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_TRITBIG_H
+#define BERESHIT_TRITBIG_H
+
+// Signed integers of any length, stored as int27 limbs.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "He telleth the number of the stars; he calleth them all by
+//            their names." — Psalm 147:4
+//
+// Principle: No number is too large to be counted exactly. Precision is
+//            limited by memory, never by word size.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Arbitrary-precision integer layer above the fixed-width int27
+//       arithmetic in arith.c.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: add, sub, mul, divmod and compare on balanced ternary integers
+//          of any length.
+//
+// Core Design: A tritbig_t is a little-endian array of limbs. Each limb is
+//   the signed value of one trit27 word (-TRIT27_BIAS .. +TRIT27_BIAS), so
+//   the number is Σ limb[i] · 3^(27·i) and a limb converts to a packed
+//   trit27_t by adding TRIT27_BIAS. Every value has exactly one limb form
+//   (no leading zero limbs; zero has len 0), and its sign is the sign of
+//   its top limb.
+//
+// Key Features:
+//
+//   - Multiplication: schoolbook → Karatsuba → Toom-3 by operand size
+//   - Toom-3 evaluates at 0, +1, -1, -2, ∞ - signed points need no sign
+//     bookkeeping when every digit is already signed
+//   - divmod keeps the remainder centered (|r| ≤ |b|/2), as in the
+//     research doc division algorithm
+//   - Conversions to and from trit arrays and trit27 word arrays
+//   - Binary ↔ ternary radix conversion by power trees (src/radix.c)
+//
+// Philosophy: Balanced digits make negative numbers free. Let the
+//             algorithms lean on that instead of tracking signs.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: trit.h (trit_t, trit27_t, TRIT27_BIAS)
+//   - Compiler: nothing beyond C99; __int128 is used where available,
+//     with a two-word fallback elsewhere
+//
+// What Uses This:
+//
+//   - radix.c (binary ↔ ternary conversion), exact arithmetic beyond int27
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "tritbig.h"
+//
+// Integration Pattern:
+//
+//  1. Declare tritbig_t x = TRITBIG_INIT (or call tritbig_init)
+//  2. Set it (tritbig_set_int64, tritbig_from_trits, ...)
+//  3. Combine with tritbig_add/sub/mul/divmod - results may alias inputs
+//  4. Call tritbig_free when done
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Memory: Limbs are heap-allocated and grow as needed. Functions that
+//         allocate return false if allocation fails and leave their
+//         outputs unchanged.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Defines → Types → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"       // trit_t, trit27_t, TRIT27_BIAS
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define TRITBIG_LIMB_TRITS 27                   // trits per limb (one trit27 word)
+#define TRITBIG_INIT { NULL, 0, 0 }             // empty (zero) tritbig_t
+
+// Radix conversion sizing: trits for any n-limb unsigned binary value, and
+// binary limbs for any nonnegative t-trit value (64·log3 2 < 41,
+// 27·log2 3 < 43)
+#define TRITBIG_TRITS_FOR_BINARY(n)  ((size_t)(n) * 41 + 1)
+#define TRITBIG_BINARY_FOR_TRITS(t)  ((size_t)(t) * 43 / (27 * 64) + 1)
+
+// Default multiplication crossovers, in limbs (tuned with make bench-tritbig).
+// Schoolbook sums each column in 128 bits and carries once per column, so
+// it stays competitive longer than a carry-per-product schoolbook would.
+#define TRITBIG_KARATSUBA_THRESHOLD 128         // ~3,500 trits
+#define TRITBIG_TOOM3_THRESHOLD     256         // ~6,900 trits
+
+// ────────────────────────────────────────────────────────────────
+// Type Definitions
+// ────────────────────────────────────────────────────────────────
+
+// tritbig_t is an arbitrary-precision balanced ternary integer.
+//
+// Fields:
+//   limb - signed trit27 values, least significant first
+//   len  - limbs in use (0 for zero); limb[len - 1] != 0
+//   cap  - limbs allocated
+typedef struct {
+    int64_t *limb;
+    size_t len;
+    size_t cap;
+} tritbig_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Lifetime (src/tritbig.c) ---
+
+// Initialize x to zero without allocating.
+void tritbig_init(tritbig_t *x);
+
+// Release x's limbs and reset it to zero.
+void tritbig_free(tritbig_t *x);
+
+// Copy src into dst. Returns false on allocation failure.
+bool tritbig_copy(tritbig_t *dst, const tritbig_t *src);
+
+//--- Conversion (src/tritbig.c) ---
+
+// Set x to a signed 64-bit value. Returns false on allocation failure.
+bool tritbig_set_int64(tritbig_t *x, int64_t value);
+
+// Read x as int64. Values outside int64 wrap modulo 2^64 and set
+// *overflow (may be NULL).
+int64_t tritbig_to_int64(const tritbig_t *x, bool *overflow);
+
+// Set x from n trits, MST-first (trits[0] most significant).
+bool tritbig_from_trits(tritbig_t *x, const trit_t *trits, size_t n);
+
+// Write the low n trits of x, MST-first. Returns false if x needs more
+// than n trits (the result is then x modulo 3^n, centered).
+bool tritbig_to_trits(const tritbig_t *x, trit_t *out, size_t n);
+
+// Set x from n packed trit27 words, most significant word first.
+bool tritbig_from_trit27_array(tritbig_t *x, const trit27_t *words, size_t n);
+
+// Write the low n limbs of x as packed trit27 words, most significant
+// first. Returns false if x needs more than n words.
+bool tritbig_to_trit27_array(const tritbig_t *x, trit27_t *out, size_t n);
+
+// Number of significant trits (0 for zero).
+size_t tritbig_trits(const tritbig_t *x);
+
+//--- Arithmetic (src/tritbig.c) ---
+// Results may alias operands. Each returns false on allocation failure.
+
+// Sign of x: -1, 0 or +1.
+int tritbig_sign(const tritbig_t *x);
+
+// Compare a and b: -1 if a < b, 0 if equal, +1 if a > b.
+int tritbig_cmp(const tritbig_t *a, const tritbig_t *b);
+
+bool tritbig_neg(tritbig_t *r, const tritbig_t *a);
+bool tritbig_add(tritbig_t *r, const tritbig_t *a, const tritbig_t *b);
+bool tritbig_sub(tritbig_t *r, const tritbig_t *a, const tritbig_t *b);
+
+// r = a · b. Schoolbook, Karatsuba or Toom-3 by operand size.
+bool tritbig_mul(tritbig_t *r, const tritbig_t *a, const tritbig_t *b);
+
+// a = q·b + rem with centered remainder: -|b|/2 < rem ≤ |b|/2.
+// q or rem may be NULL. Returns false for b = 0 (outputs unchanged).
+bool tritbig_divmod(tritbig_t *q, tritbig_t *rem, const tritbig_t *a, const tritbig_t *b);
+
+//--- Tuning (src/tritbig.c) ---
+
+// Set the Karatsuba and Toom-3 crossovers (in limbs) for this process.
+// 0 restores a default; SIZE_MAX disables that algorithm.
+void tritbig_set_mul_thresholds(size_t karatsuba, size_t toom3);
+
+//--- Radix Conversion (src/radix.c) ---
+// Binary integers are little-endian uint64_t limbs, read as unsigned.
+// Divide and conquer over power trees: O(M(n) log n), not O(n^2).
+// Each returns false on allocation failure or if the value does not fit.
+
+// Set x from n binary limbs.
+bool tritbig_from_binary(tritbig_t *x, const uint64_t *limbs, size_t n);
+
+// Write x modulo 2^(64n) (two's complement if negative). True only if
+// 0 ≤ x < 2^(64n).
+bool tritbig_to_binary(const tritbig_t *x, uint64_t *out, size_t n);
+
+// Binary ↔ packed trit27 words (most significant word first).
+bool binary_to_trit27_array(const uint64_t *in, size_t n, trit27_t *out, size_t words);
+bool trit27_to_binary_array(const trit27_t *in, size_t words, uint64_t *out, size_t n);
+
+// Binary ↔ `trits` trits in TRIT5_PACKED_SIZE(trits) t5b1 bytes (MST first).
+bool binary_to_trit5_array(const uint64_t *in, size_t n, uint8_t *out, size_t trits);
+bool trit5_to_binary_array(const uint8_t *in, size_t trits, uint64_t *out, size_t n);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: This header declares the interface. Functions implemented in
+// src/tritbig.c and src/radix.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── Lifetime:   tritbig_init, tritbig_free, tritbig_copy
+//   ├── Conversion: tritbig_set_int64, tritbig_to_int64, tritbig_from_trits,
+//   │               tritbig_to_trits, tritbig_from_trit27_array,
+//   │               tritbig_to_trit27_array, tritbig_trits
+//   ├── Arithmetic: tritbig_sign, tritbig_cmp, tritbig_neg, tritbig_add,
+//   │               tritbig_sub, tritbig_mul, tritbig_divmod
+//   ├── Tuning:     tritbig_set_mul_thresholds
+//   └── Radix:      tritbig_from_binary, tritbig_to_binary,
+//                   binary_to_trit27_array, trit27_to_binary_array,
+//                   binary_to_trit5_array, trit5_to_binary_array
+//
+// Declared Units:
+// - 1 type (tritbig_t)
+// - 7 #define constants
+// - 24 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Strategy: Return safe defaults rather than error codes.
+//   - Allocation failure → false, outputs unchanged
+//   - Division by zero → false, outputs unchanged
+//   - Narrowing conversions wrap and report it (false / *overflow)
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "tritbig.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-tritbig   Benchmark: make bench-tritbig
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// Every tritbig_t that was set must be released with tritbig_free.
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Threshold defaults (re-run make bench-tritbig)
+//   ✅ Add operations (follow the alias-safe "build, then install" pattern)
+//
+// Modify with Care:
+//   ⚠️ Limb = signed trit27 value (shared with trit27 array conversion)
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_TRITBIG_H)
+//   ❌ Canonical form (no leading zero limbs, zero has len 0)
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// mul: O(n^2) below the Karatsuba threshold, O(n^1.585) Karatsuba,
+//      O(n^1.465) Toom-3. divmod: O(n·m) limb-at-a-time long division.
+// Radix conversion: O(M(n) log n).
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   tritbig_t a = TRITBIG_INIT, b = TRITBIG_INIT, q = TRITBIG_INIT, r = TRITBIG_INIT;
+//   tritbig_set_int64(&a, -7);
+//   tritbig_set_int64(&b, 3);
+//   tritbig_divmod(&q, &r, &a, &b);   // q = -2, r = -1
+//   tritbig_free(&a); tritbig_free(&b); tritbig_free(&q); tritbig_free(&r);
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_TRITBIG_H
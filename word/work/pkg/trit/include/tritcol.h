@@ -0,0 +1,355 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Delta-Coded Integer Columns
+// Key: B-word-work-pkg-trit-include-tritcol
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: vartrit.h)
+//   Depends on vartrit.h for the vartrit encoders and decoders
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/scripture/kjv-ordinal-index.adoc (monotone verse ordinals)
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_TRITCOL_H
+#define BERESHIT_TRITCOL_H
+
+// int64 columns stored as deltas or deltas of deltas in vartrit form, in
+// blocks whose headers carry min and max so a scan can pass them by.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "So teach us to number our days, that we may apply our
+//            hearts unto wisdom." — Psalm 90:12
+//
+// Principle: A day is told from the day before it. Write down the step,
+//            not the whole count again.
+//
+// # CPI-SI Identity
+//
+// Component Type: Rungs (built on the vartrit layer)
+//
+// Role: Storage and scan format for sorted ids, ordinals and time series.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Keep an int64 column in about a byte per value when
+//          neighbouring values are close (postings, ordinals, score
+//          histories, regular timestamps), and let range scans skip
+//          blocks without decoding them.
+//
+// Core Design: A column is cut into blocks of TRITCOL_BLOCK values. Each
+//   block starts with a TRITCOL_HEAD-byte header: transform, value
+//   count, payload bytes, then the block's first value, min and max.
+//   The payload holds count - 1 vartrit numbers (vartrit.h):
+//
+//     TRITCOL_DELTA  v[i] - v[i-1]
+//     TRITCOL_DOD    v[1] - v[0], then (v[i] - v[i-1]) - (v[i-1] - v[i-2])
+//
+//   TRITCOL_AUTO picks whichever is shorter per block. Differences wrap
+//   modulo 2^64, so every int64 sequence round-trips. Blocks are
+//   independent and a column is just its blocks back to back, so two
+//   encoded columns concatenate into one.
+//
+// Key Features:
+//
+//   - 1 byte per value for steps up to ±6 (DELTA) or step changes up to
+//     ±6 (DOD), at most 9
+//   - min / max per block: range scans decode only blocks that straddle
+//     the range
+//   - Streaming reader: one block at a time into a caller buffer, nothing
+//     allocated
+//
+// Philosophy: Small differences are cheap to store and cheap to add back
+//             up; a block whose range cannot match is not opened.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: vartrit.h (trit_vartrit_*)
+//
+// What Uses This:
+//
+//   - Ordinal postings (word/scripture/kjv-ordinal-index.csv ordinals are
+//     monotone), .health score histories, timestamp columns
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "tritcol.h"
+//
+// Integration Pattern:
+//
+//  1. tritcol_encode(values, n, TRITCOL_AUTO, buf)  (TRITCOL_BOUND(n))
+//  2. Whole column: tritcol_decode(buf, len, out, cap)
+//  3. Streaming: tritcol_reader_init(&r, buf, len), then while
+//     tritcol_next(&r): look at r.block.min / max, and either
+//     tritcol_read(&r, vals) or move on; check r.error at the end
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: An encoded column is never written after tritcol_encode
+//   returns. Each tritcol_reader_t holds its own position, so readers on
+//   different threads may walk one buffer at once; a single reader is
+//   not safe to share between threads.
+//
+// Memory: None allocated. tritcol_encode and tritcol_count_range use
+//   about 8 KB of stack; a reader needs a TRITCOL_BLOCK-value buffer.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Defines → Types → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "vartrit.h" // TRIT_VARTRIT_MAX64, trit_vartrit_*
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define TRITCOL_BLOCK  1024          // values per block (the last may hold fewer)
+#define TRITCOL_HEAD   32            // header bytes per block
+#define TRITCOL_ERROR  SIZE_MAX      // malformed column
+
+// Largest encoding of n values: a header per block, at most
+// TRIT_VARTRIT_MAX64 bytes per value.
+#define TRITCOL_BOUND(n) \
+    (((n) + TRITCOL_BLOCK - 1) / TRITCOL_BLOCK * TRITCOL_HEAD + (n) * TRIT_VARTRIT_MAX64)
+
+// ────────────────────────────────────────────────────────────────
+// Type Definitions
+// ────────────────────────────────────────────────────────────────
+
+// How a block's payload is derived from its values.
+typedef enum {
+    TRITCOL_AUTO = 0,    // encoder only: the shorter of the two per block
+    TRITCOL_DELTA,       // first differences
+    TRITCOL_DOD          // first difference, then second differences
+} tritcol_transform_t;
+
+// tritcol_block_t is one block's header, as tritcol_next found it.
+//
+// Fields:
+//   row       - column row of the block's first value
+//   count     - values in the block (1 .. TRITCOL_BLOCK)
+//   transform - TRITCOL_DELTA or TRITCOL_DOD
+//   first     - the block's first value
+//   min, max  - smallest and largest value in the block
+typedef struct {
+    size_t row;
+    size_t count;
+    tritcol_transform_t transform;
+    int64_t first;
+    int64_t min;
+    int64_t max;
+} tritcol_block_t;
+
+// tritcol_reader_t walks a column one block at a time.
+//
+// Fields:
+//   in, len - the column
+//   pos     - offset of the current block's payload (after tritcol_next)
+//   next    - offset of the next block's header
+//   payload - current block's payload bytes
+//   block   - current block's header
+//   error   - set once a malformed header or payload is seen
+typedef struct {
+    const uint8_t *in;
+    size_t len;
+    size_t pos;
+    size_t next;
+    size_t payload;
+    tritcol_block_t block;
+    bool error;
+} tritcol_reader_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Encoding (src/tritcol.c) ---
+
+// Encode n values into out (TRITCOL_BOUND(n) bytes); returns bytes
+// written. n = 0 writes nothing.
+size_t tritcol_encode(const int64_t *in, size_t n, tritcol_transform_t transform,
+                      uint8_t *out);
+
+//--- Whole Columns (src/tritcol.c) ---
+
+// Values in a column of len bytes (headers only), or TRITCOL_ERROR if a
+// header is malformed or runs past len.
+size_t tritcol_count(const uint8_t *in, size_t len);
+
+// Decode a whole column into out; returns values written, or
+// TRITCOL_ERROR if the column is malformed or holds more than cap.
+size_t tritcol_decode(const uint8_t *in, size_t len, int64_t *out, size_t cap);
+
+// Values v with lo <= v <= hi. Blocks outside [lo, hi] are skipped and
+// blocks inside it counted from their headers; only blocks that
+// straddle a bound are decoded. TRITCOL_ERROR if the column is
+// malformed (as far as it was read).
+size_t tritcol_count_range(const uint8_t *in, size_t len, int64_t lo, int64_t hi);
+
+//--- Streaming (src/tritcol.c) ---
+
+// Start a reader before the first block of a column of len bytes.
+void tritcol_reader_init(tritcol_reader_t *r, const uint8_t *in, size_t len);
+
+// Move to the next block and fill r->block. Returns false at the end of
+// the column or on a malformed header (then r->error is set).
+bool tritcol_next(tritcol_reader_t *r);
+
+// Decode the current block into out (r->block.count values, at most
+// TRITCOL_BLOCK); returns the count, or TRITCOL_ERROR (and sets
+// r->error) if the payload does not match its header.
+size_t tritcol_read(tritcol_reader_t *r, int64_t *out);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: This header declares the interface. Functions implemented in
+// src/tritcol.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── Encoding:  tritcol_encode
+//   ├── Columns:   tritcol_count, tritcol_decode, tritcol_count_range
+//   └── Streaming: tritcol_reader_init, tritcol_next, tritcol_read
+//
+// Declared Units:
+// - 3 types (tritcol_transform_t, tritcol_block_t, tritcol_reader_t)
+// - 4 #define constants
+// - 7 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Strategy: Sentinel return values, nothing is trusted from the bytes.
+//   - Encoding cannot fail; an unknown transform is taken as AUTO
+//   - Headers are checked (transform, count, payload inside the column,
+//     min <= first <= max) before a block is offered
+//   - Payloads must hold exactly count - 1 vartrit numbers, and the
+//     decoded values must reach the header's min and max
+//   - A failure → TRITCOL_ERROR / false with r->error set; out may hold
+//     a partial result
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "tritcol.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-tritcol   Benchmark: make bench-tritcol
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// Nothing to release: readers hold only pointers into the caller's
+// column.
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add transforms (a new tag, its forward pass and its running sum)
+//   ✅ Add scans over the reader (sums, lookups) that skip by min / max
+//
+// Modify with Care:
+//   ⚠️ TRITCOL_BLOCK - bounds reader buffers and stack scratch, and
+//      existing columns may hold blocks up to the old size
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_TRITCOL_H)
+//   ❌ Header layout and transform tags - stored columns depend on them
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Headers cost 32 bytes per 1024 values (0.03 bytes/value). A block
+// whose payload is all one-byte numbers decodes in one pass of adds;
+// others go through the vartrit bulk decoder first. Range scans over
+// sorted columns touch one or two blocks; over unsorted data they skip
+// only blocks whose min / max miss the range.
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   uint8_t *buf = malloc(TRITCOL_BOUND(n));
+//   size_t len = tritcol_encode(values, n, TRITCOL_AUTO, buf);
+//
+//   tritcol_reader_t r;
+//   int64_t vals[TRITCOL_BLOCK];
+//   tritcol_reader_init(&r, buf, len);
+//   while (tritcol_next(&r)) {
+//       if (r.block.max < lo || r.block.min > hi) continue;
+//       size_t c = tritcol_read(&r, vals);
+//       ...
+//   }
+//   if (r.error) { ... }
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_TRITCOL_H
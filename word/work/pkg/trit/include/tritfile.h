@@ -0,0 +1,328 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Memory-Mapped .t5 Trit Files
+// Key: B-word-work-pkg-trit-include-tritfile
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//   Depends on trit.h for trit_t, TRIT5_DECODE_TABLE and the t5b1 unpackers
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Memory Alignment]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_TRITFILE_H
+#define BERESHIT_TRITFILE_H
+
+// On-disk t5b1 trit arrays behind a checked header, opened with a
+// read-only mmap so any trit is one byte load and one table load away.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "But thou, O Daniel, shut up the words, and seal the book,
+//            even to the time of the end: many shall run to and fro, and
+//            knowledge shall be increased." — Daniel 12:4
+//
+// Principle: A sealed book can still be opened at any page. Check the
+//            seal once, then read where you need to.
+//
+// # CPI-SI Identity
+//
+// Component Type: Rungs (built on the t5b1 layer)
+//
+// Role: Persistent storage for large trit arrays.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Open a multi-gigabyte trit dataset without reading it: the
+//          payload is the t5b1 bytes themselves, so the mapped file is
+//          the array.
+//
+// Core Design: A .t5 file is a TRITFILE_HEAD-byte header, a table of one
+//   checksum per chunk, zero padding to a 64-byte boundary, then
+//   TRIT5_PACKED_SIZE(count) payload bytes in trit5_pack_array layout.
+//   Trit i is in payload byte i/5 at position i%5 (most significant
+//   trit first). Chunks are chunk-bytes pieces of the payload (5 trits
+//   per byte; the last may be shorter). Opening checks the header and
+//   its checksum (which covers the chunk table) but not the payload;
+//   tritfile_verify checks one chunk on request.
+//
+// Key Features:
+//
+//   - tritfile_get: one payload load + one TRIT5_DECODE_TABLE load
+//   - tritfile_slice: any range into trit_t, whole bytes on the active
+//     unpack backend
+//   - tritfile_chunk: chunks as t5b1 pointers for the packed kernels
+//     (trit5_sum_array, trit5_rle_*, ... in tritreduce.h, tritrle.h) -
+//     nothing is copied
+//   - Adler-32 per chunk, checked only when asked
+//
+// Philosophy: The file is the array; opening it only reads the header.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: trit.h (TRIT5_DECODE_TABLE, trit5_unpack_array)
+//   - Platform: POSIX open / fstat / mmap (src/tritfile.c only)
+//
+// What Uses This:
+//
+//   - Datasets too large to fread and unpack before first use
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "tritfile.h"
+//
+// Integration Pattern:
+//
+//  1. trit5_pack_array(trits, n, buf), then
+//     tritfile_write("x.t5", buf, n, 0)  (0: TRITFILE_CHUNK)
+//  2. tritfile_open(&f, "x.t5"); check for TRITFILE_OK
+//  3. tritfile_get(&f, i) for i < f.count, tritfile_slice for ranges,
+//     tritfile_chunk(&f, k, &n) for k < f.chunks
+//  4. tritfile_close(&f)
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: Open and close a tritfile_t on one thread, and close it
+//   only after every reader is done. In between the mapping is
+//   read-only: tritfile_get, _slice, _chunk and _verify may run on any
+//   number of threads at once. tritfile_write shares nothing between
+//   calls.
+//
+// Memory: Nothing allocated; the file is mapped, and pages load on first
+//   touch. tritfile_write streams through stdio.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Defines → Types → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"    // trit_t, TRIT5_DECODE_TABLE, trit5_unpack_array
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define TRITFILE_MAGIC    "TRIT5\r\n\032"   // 8 bytes, no terminator stored
+#define TRITFILE_VERSION  1
+#define TRITFILE_HEAD     64                // header bytes
+#define TRITFILE_CHUNK    262144            // default chunk bytes (1,310,720 trits)
+
+// ────────────────────────────────────────────────────────────────
+// Type Definitions
+// ────────────────────────────────────────────────────────────────
+
+// Result of writing or opening a file.
+typedef enum {
+    TRITFILE_OK = 0,
+    TRITFILE_ERR_IO,          // open, stat, map or write failed (see errno)
+    TRITFILE_ERR_FORMAT,      // not a .t5 file, or fields disagree with its size
+    TRITFILE_ERR_VERSION,     // a version this library does not read
+    TRITFILE_ERR_CHECKSUM     // header or chunk table damaged
+} tritfile_status_t;
+
+// tritfile_t is an open .t5 file.
+//
+// Fields:
+//   map, map_len - the whole mapping (for tritfile_close)
+//   data         - t5b1 payload, TRIT5_PACKED_SIZE(count) bytes
+//   sums         - chunk checksums (little-endian u32 each)
+//   count        - trits in the file
+//   chunk        - payload bytes per chunk (5 trits each)
+//   chunks       - number of chunks
+typedef struct {
+    const uint8_t *map;
+    size_t map_len;
+    const uint8_t *data;
+    const uint8_t *sums;
+    uint64_t count;
+    size_t chunk;
+    size_t chunks;
+} tritfile_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Files (src/tritfile.c) ---
+
+// Write n trits of t5b1 bytes (TRIT5_PACKED_SIZE(n), as trit5_pack_array)
+// to path as a .t5 file with chunks of chunk bytes (0: TRITFILE_CHUNK).
+// TRITFILE_ERR_FORMAT if chunk or n cannot be represented.
+tritfile_status_t tritfile_write(const char *path, const uint8_t *t5, uint64_t n,
+                                 size_t chunk);
+
+// Map path read-only and check its header and chunk table; the payload
+// is not read. On any status but TRITFILE_OK, f holds nothing to close.
+tritfile_status_t tritfile_open(tritfile_t *f, const char *path);
+
+// Unmap the file; f is zeroed.
+void tritfile_close(tritfile_t *f);
+
+//--- Access ---
+
+// Trit i (i < f->count; not checked).
+static inline trit_t tritfile_get(const tritfile_t *f, uint64_t i) {
+    return TRIT5_DECODE_TABLE[f->data[i / 5]][i % 5];
+}
+
+// Copy trits i .. i+n-1 into out, stopping at the end of the file;
+// returns trits written (src/tritfile.c).
+size_t tritfile_slice(const tritfile_t *f, uint64_t i, size_t n, trit_t *out);
+
+// Chunk k (k < f->chunks) as t5b1 bytes holding *n trits, or NULL if k
+// is out of range (src/tritfile.c).
+const uint8_t *tritfile_chunk(const tritfile_t *f, size_t k, size_t *n);
+
+// True if chunk k's bytes match its stored checksum (src/tritfile.c).
+bool tritfile_verify(const tritfile_t *f, size_t k);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: This header declares the interface. tritfile_get is inline;
+// everything else is implemented in src/tritfile.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── Files:  tritfile_write, tritfile_open, tritfile_close
+//   └── Access: tritfile_get (inline), tritfile_slice, tritfile_chunk,
+//               tritfile_verify
+//
+// Declared Units:
+// - 2 types (tritfile_status_t, tritfile_t)
+// - 4 #define constants
+// - 1 inline function, 6 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Strategy: Status codes for files, sentinels for access.
+//   - tritfile_write / tritfile_open return a tritfile_status_t; errno
+//     is left as the failing call set it for TRITFILE_ERR_IO
+//   - Every header field is checked against the others and the file
+//     size before any payload pointer is formed
+//   - tritfile_slice clamps to the file, tritfile_chunk returns NULL past
+//     the last chunk; tritfile_get trusts its index like an array does
+//   - Payload damage shows only through tritfile_verify; a spare byte
+//     (243-255) reads as five zero trits
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "tritfile.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-tritfile   Benchmark: make bench-tritfile
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// tritfile_close releases the mapping. Pointers from tritfile_chunk die
+// with it.
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add readers over the mapping (packed scans per chunk, prefetch
+//      hints)
+//   ✅ TRITFILE_CHUNK - each file records its own chunk size
+//
+// Modify with Care:
+//   ⚠️ tritfile_t fields - tritfile_get reads data inline in callers
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_TRITFILE_H)
+//   ❌ Magic, header layout and checksum - stored files depend on them;
+//      a new layout takes a new TRITFILE_VERSION
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Opening costs one mmap and a checksum over the header and the chunk
+// table (4 bytes per chunk), whatever the payload size. After that, cost
+// is the page cache's: a cold page is a fault and a disk read; a warm
+// one is an ordinary memory load.
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   tritfile_t f;
+//   if (tritfile_open(&f, "data.t5") != TRITFILE_OK) { ... }
+//   trit_t t = tritfile_get(&f, i);
+//   for (size_t k = 0; k < f.chunks; k++) {
+//       size_t n;
+//       const uint8_t *p = tritfile_chunk(&f, k, &n);
+//       sum += trit5_sum_array(p, n);
+//   }
+//   tritfile_close(&f);
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_TRITFILE_H
@@ -0,0 +1,329 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Three-Valued Column Filters
+// Key: B-word-work-pkg-trit-include-tritfilter
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: logic.h, tritop.h, trit.h)
+//   Depends on logic.h for bool3 and the bitsliced Kleene connectives
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/research/ternary/ternary-logic-algorithms.adoc [Dyadic Operations]
+//      word/core/primitives.toml [bool3]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_TRITFILTER_H
+#define BERESHIT_TRITFILTER_H
+
+// Predicate trees over trit_t / bool3_t columns, evaluated a chunk of
+// rows at a time into bitmaps or selection vectors of true and unknown
+// rows.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Gather ye together first the tares, and bind them in
+//            bundles to burn them: but gather the wheat into my barn."
+//            — Matthew 13:30
+//
+// Principle: Sort what is known to be wheat from what is known to be
+//            tares, and keep what is not yet known apart from both.
+//
+// # CPI-SI Identity
+//
+// Component Type: Rungs (built on the logic layer)
+//
+// Role: The WHERE clause of a columnar scan, in three-valued logic.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Evaluate one predicate over many rows and report which rows
+//          are true and which are unknown, without a branch per row.
+//
+// Core Design: A tritfilter_t is a small tree of nodes, each referring
+//   only to nodes built before it; the last node built is the root. A
+//   node used as an operand twice is evaluated once per use.
+//
+//     COLUMN  column c mapped to bool3 by a monadic table (TRIT_OP1_*):
+//             TRIT_OP1_IDENTITY reads a bool3_t column as is, other
+//             tables turn a trit_t column into a predicate
+//     NOT     Kleene negation
+//     AND     Kleene min, short-circuits on false
+//     OR      Kleene max, short-circuits on true
+//
+//   Rows are evaluated in chunks of TRITFILTER_CHUNK. Each column chunk
+//   is split into bit-planes (one vector compare + movemask per 16, 32
+//   or 64 rows on the active backend), then the tree runs on bool3x64_t
+//   words. If the left operand of AND is false on every row of the chunk
+//   (its neg plane is all ones), the right subtree is not evaluated and
+//   its columns are not read; likewise OR on all-true.
+//
+// Key Features:
+//
+//   - Bitmaps (bit i = row i) or uint32_t selection vectors
+//   - True and unknown rows reported separately; false rows dropped
+//   - No allocation: the tree and chunk scratch are fixed-size
+//   - Backend-dispatched column split (trit_backend_select pins it)
+//
+// Philosophy: Unknown is neither selected nor discarded - it is
+//             reported, and the caller decides.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: logic.h (bool3_t, bool3x64_t, connectives), tritop.h
+//     (TRIT_OP1_* tables), trit.h (backend dispatch)
+//
+// What Uses This:
+//
+//   - Analytical scans that filter rows on three-valued predicates
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "tritfilter.h"
+//
+// Integration Pattern:
+//
+//  1. tritfilter_init(&f)
+//  2. Build bottom-up: tritfilter_column, tritfilter_not/and/or - each
+//     returns the node index, or -1 (which later calls pass through)
+//  3. tritfilter_select(&f, columns, n, sel_true, sel_unknown, &nu) or
+//     tritfilter_bitmap(&f, columns, n, is_true, is_unknown)
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: Building a filter (tritfilter_column / _not / _and / _or)
+//   writes it, so one thread builds it. A built filter is only read:
+//   tritfilter_bitmap and tritfilter_select may run on any number of
+//   threads at once. To split rows, pass column pointers offset by r0
+//   (a multiple of 64 rows for bitmaps) and add r0 to the selected
+//   indices.
+//
+// Memory: None allocated. Evaluation uses about 16 KB of stack.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Defines → Types → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "logic.h"      // bool3_t, bool3x64_t, Kleene connectives
+#include "trit.h"       // trit_t
+#include "tritop.h"     // TRIT_OP1_* tables
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define TRITFILTER_MAX_NODES  32      // nodes per filter (and tree depth bound)
+#define TRITFILTER_CHUNK      2048    // rows per evaluation chunk (32 words)
+
+// TRITFILTER_BITMAP_WORDS is the uint64_t count for an n-row bitmap.
+#define TRITFILTER_BITMAP_WORDS(n)  (((n) + 63) / 64)
+
+// ────────────────────────────────────────────────────────────────
+// Type Definitions
+// ────────────────────────────────────────────────────────────────
+
+// tritfilter_kind_t is a node's operation.
+typedef enum {
+    TRITFILTER_COLUMN = 0,   // a = column index, table = monadic map to bool3
+    TRITFILTER_NOT    = 1,   // a = operand
+    TRITFILTER_AND    = 2,   // a, b = operands (a evaluated first)
+    TRITFILTER_OR     = 3    // a, b = operands (a evaluated first)
+} tritfilter_kind_t;
+
+// tritfilter_node_t is one tree node. Operands index earlier nodes.
+typedef struct {
+    uint8_t kind;            // tritfilter_kind_t
+    uint8_t table;           // COLUMN: monadic table ID (0-26)
+    uint16_t a;              // COLUMN: column index; else first operand
+    uint16_t b;              // AND / OR: second operand
+} tritfilter_node_t;
+
+// tritfilter_t is a predicate tree. The last node is the root; with no
+// nodes every row is true.
+typedef struct {
+    tritfilter_node_t node[TRITFILTER_MAX_NODES];
+    size_t count;
+} tritfilter_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Building ---
+
+// Empty filter (selects every row as true).
+void tritfilter_init(tritfilter_t *f);
+
+// Adds a COLUMN node: row i's value is table(columns[column][i]). Use
+// TRIT_OP1_IDENTITY for a bool3_t column, e.g. TRIT_OP1_ID(-1, -1, 1)
+// for "trit column is +1". Returns the node index, or -1 if the filter
+// is full, column > 65535 or table > 26.
+int tritfilter_column(tritfilter_t *f, size_t column, uint8_t table);
+
+// Add NOT / AND / OR nodes over earlier nodes. Return the node index, or
+// -1 if the filter is full or an operand is not an existing node
+// (including -1 from an earlier failed call).
+int tritfilter_not(tritfilter_t *f, int a);
+int tritfilter_and(tritfilter_t *f, int a, int b);
+int tritfilter_or(tritfilter_t *f, int a, int b);
+
+//--- Evaluation ---
+
+// Sets bit i of is_true / is_unknown when row i is true / unknown. Each
+// array is TRITFILTER_BITMAP_WORDS(n) words, fully written (bits past n
+// are zero); either may be NULL.
+//
+// Parameters:
+//   f       - filter
+//   columns - columns[c] holds n valid values for every referenced c
+//   n       - row count
+void tritfilter_bitmap(const tritfilter_t *f, const trit_t *const *columns, size_t n,
+                       uint64_t *is_true, uint64_t *is_unknown);
+
+// Writes the ascending indices of true rows to sel_true and of unknown
+// rows to sel_unknown, each sized for n. Either may be NULL to count
+// those rows only. Stores the unknown count in *n_unknown if non-NULL.
+//
+// Parameters:
+//   f       - filter
+//   columns - as for tritfilter_bitmap
+//   n       - row count (≤ UINT32_MAX)
+//
+// Returns:
+//   number of true rows
+size_t tritfilter_select(const tritfilter_t *f, const trit_t *const *columns, size_t n,
+                         uint32_t *sel_true, uint32_t *sel_unknown, size_t *n_unknown);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: Header files declare interfaces only. Implementation lives in
+// src/tritfilter.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── Building:   tritfilter_init, tritfilter_column, tritfilter_not,
+//   │               tritfilter_and, tritfilter_or
+//   └── Evaluation: tritfilter_bitmap, tritfilter_select
+//
+// Declared Units:
+// - 3 types (tritfilter_kind_t, tritfilter_node_t, tritfilter_t)
+// - 3 #define constants/macros
+// - 7 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Strategy: Builders return -1 and leave the filter unchanged; passing
+//   -1 on makes later builders fail too, so one check of the root index
+//   covers the whole tree. Evaluation cannot fail. Invalid column values
+//   give unspecified (but valid) results, as for trit_add.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "tritfilter.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-tritfilter   Benchmark: make bench-tritfilter
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ TRITFILTER_CHUNK (multiple of 64; re-run make bench-tritfilter)
+//   ✅ Add node kinds (one builder, one case in the evaluator)
+//
+// Modify with Care:
+//   ⚠️ TRITFILTER_MAX_NODES sizes the evaluator's stack scratch
+//   ⚠️ Operands must index earlier nodes - the evaluator relies on it
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_TRITFILTER_H)
+//   ❌ False rows are never reported; true and unknown never mixed
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Put the most selective operand first in AND (the one most often false):
+// chunks where it is all false never read the rest of the tree's columns.
+// Selection vectors cost one ctz per selected row on top of the bitmap.
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   tritfilter_t f;
+//   tritfilter_init(&f);
+//   int paid  = tritfilter_column(&f, 0, TRIT_OP1_IDENTITY);     // bool3 column
+//   int north = tritfilter_column(&f, 1, TRIT_OP1_ID(-1, -1, 1)); // trit == +1
+//   int root  = tritfilter_and(&f, paid, tritfilter_not(&f, north));
+//   const trit_t *cols[2] = { paid_col, region_col };
+//   size_t nt = tritfilter_select(&f, cols, n, sel_true, sel_unknown, &nu);
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_TRITFILTER_H
@@ -0,0 +1,354 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Nearest-Neighbour Search over Ternary Vectors
+// Key: B-word-work-pkg-trit-include-tritindex
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritmat.h, trit.h)
+//   Depends on tritmat.h for the bitsliced dot and Hamming kernels
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 2: BCT Parallel]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_TRITINDEX_H
+#define BERESHIT_TRITINDEX_H
+
+// Top-k search over a collection of {-1, 0, +1} vectors by ternary inner
+// product or ternary Hamming distance, exhaustive or over coarse lists.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Seek, and ye shall find." — Matthew 7:7
+//
+// Principle: Finding starts with looking everywhere. Looking in the right
+//            places first is an optimization, and it must say so.
+//
+// # CPI-SI Identity
+//
+// Component Type: Rungs (built on the matrix layer)
+//
+// Role: Similarity search over ternary signatures stored as t5b1 rows.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Given query vectors, return the k stored vectors with the
+//          highest inner product or the lowest Hamming distance.
+//
+// Core Design: Vectors arrive as t5b1 rows (tritmat_pack layout, the
+//   storage format) and are kept as trit64b_t bit-planes (the compute
+//   format), TRITMAT_ROW_VECTORS(cols) per vector. An id is the order a
+//   vector was added in.
+//
+//   Exhaustive search streams every stored row once per block of 16
+//   queries through tritmat_gemm_t64b / tritmat_gemm_hamming_t64b and
+//   keeps a k-entry heap per query.
+//
+//   tritindex_train adds a coarse layer: nlist ternary centroids found by
+//   k-means with a per-trit majority vote as the mean, and the stored
+//   rows regrouped by nearest centroid. A search with nprobe > 0 scores
+//   the centroids, then scans only the nprobe best lists - approximate,
+//   about nprobe/nlist of the exhaustive work. Vectors added after
+//   training belong to no list and are always scanned.
+//
+//   Metrics:
+//     TRITINDEX_DOT      Σ a[i]·b[i], higher is better
+//     TRITINDEX_HAMMING  positions where a[i] != b[i], lower is better
+//
+// Key Features:
+//
+//   - Exact exhaustive scan at popcount speed on every backend
+//   - Batched queries share each pass over the stored rows
+//   - Coarse lists for sublinear search, nprobe trades recall for time
+//   - Deterministic results: ties go to the lower id
+//
+// Philosophy: The exhaustive answer is the definition; the fast answer
+//             is measured against it.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: tritmat.h (TRITMAT_ROW_BYTES, TRITMAT_ROW_VECTORS,
+//     tritmat_gemm_t64b, tritmat_gemm_hamming_t64b), trit.h
+//   - Platform: POSIX threads for the _mt searches (link with -pthread)
+//
+// What Uses This:
+//
+//   - Signature lookup, deduplication and retrieval over ternary codes
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "tritindex.h"
+//
+// Integration Pattern:
+//
+//  1. tritindex_init(&idx, cols)
+//  2. tritindex_add_t5 (or tritindex_add_trits) as vectors arrive
+//  3. Optionally tritindex_train(&idx, nlist, iters, metric)
+//  4. tritindex_search(&idx, queries, nq, metric, k, nprobe, hits), or
+//     tritindex_search_mt(..., hits, threads) for large query batches
+//  5. tritindex_free(&idx)
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: tritindex_search_mt / _t64b_mt start up to `threads`
+//   threads, each answering a run of whole 16-query blocks, and join
+//   them before returning. Everything else runs on the calling thread.
+//   Searches only read the index, so any number may run at once, and a
+//   caller can also split queries [q0, q1) over its own threads by
+//   passing queries + q0·TRITMAT_ROW_BYTES(cols), nq = q1 - q0 and
+//   hits + q0·k. Adding and training need exclusive access.
+//
+// Memory: Stored rows and lists are heap-allocated. Functions that
+//   allocate return false if allocation fails and leave the index (and
+//   hits) unchanged.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Defines → Types → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "tritmat.h"    // TRITMAT_ROW_BYTES, TRITMAT_ROW_VECTORS, trit64b_t
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define TRITINDEX_NO_ID        SIZE_MAX   // id of an unused hit slot
+#define TRITINDEX_TRAIN_ITERS  8          // k-means rounds when iters = 0
+
+// ────────────────────────────────────────────────────────────────
+// Type Definitions
+// ────────────────────────────────────────────────────────────────
+
+// Similarity measure for training and search.
+typedef enum {
+    TRITINDEX_DOT = 0,       // inner product, higher is better
+    TRITINDEX_HAMMING        // differing positions, lower is better
+} tritindex_metric_t;
+
+// One search result: a stored vector's id and its dot product or distance.
+typedef struct {
+    size_t id;
+    int32_t score;
+} tritindex_hit_t;
+
+// tritindex_t is a collection of ternary vectors of one length.
+//
+// Fields:
+//   cols       - trits per vector
+//   count      - vectors stored (ids 0 .. count - 1)
+//   cap        - vectors allocated in vec
+//   vec        - count·TRITMAT_ROW_VECTORS(cols) planes, in id order
+//   nlist      - coarse lists (0 until trained)
+//   trained    - vectors covered by the lists (ids below it)
+//   centroid   - nlist·TRITMAT_ROW_VECTORS(cols) planes
+//   list_start - nlist + 1 offsets into list_id and list_vec
+//   list_id    - ids grouped by list
+//   list_vec   - planes grouped by list, in list_id order
+typedef struct {
+    size_t cols;
+    size_t count;
+    size_t cap;
+    trit64b_t *vec;
+    size_t nlist;
+    size_t trained;
+    trit64b_t *centroid;
+    size_t *list_start;
+    size_t *list_id;
+    trit64b_t *list_vec;
+} tritindex_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Lifetime (src/tritindex.c) ---
+
+// Initialize an empty index of cols-trit vectors without allocating.
+void tritindex_init(tritindex_t *idx, size_t cols);
+
+// Release everything and reset to empty (cols is kept).
+void tritindex_free(tritindex_t *idx);
+
+//--- Adding (src/tritindex.c) ---
+// Each returns false on allocation failure.
+
+// Append n vectors given as t5b1 rows of TRITMAT_ROW_BYTES(cols) bytes.
+bool tritindex_add_t5(tritindex_t *idx, const uint8_t *rows, size_t n);
+
+// Append n vectors given as row-major trits (n·cols).
+bool tritindex_add_trits(tritindex_t *idx, const trit_t *trits, size_t n);
+
+//--- Coarse Lists (src/tritindex.c) ---
+
+// Build nlist lists (capped at count) with iters rounds of k-means under
+// metric (0 → TRITINDEX_TRAIN_ITERS). nlist = 0 drops the lists.
+// Returns false on allocation failure.
+bool tritindex_train(tritindex_t *idx, size_t nlist, size_t iters, tritindex_metric_t metric);
+
+//--- Search (src/tritindex.c) ---
+// hits[q·k .. q·k + k) receives query q's results, best first; slots past
+// the number of stored vectors get id TRITINDEX_NO_ID and score 0.
+// nprobe = 0 (or an untrained index) searches exhaustively; otherwise the
+// nprobe lists whose centroids score best are scanned.
+// Returns false on allocation failure.
+
+// Queries as t5b1 rows of TRITMAT_ROW_BYTES(cols) bytes.
+bool tritindex_search(const tritindex_t *idx, const uint8_t *queries, size_t nq,
+                      tritindex_metric_t metric, size_t k, size_t nprobe,
+                      tritindex_hit_t *hits);
+
+// Queries as TRITMAT_ROW_VECTORS(cols) planes each.
+bool tritindex_search_t64b(const tritindex_t *idx, const trit64b_t *queries, size_t nq,
+                           tritindex_metric_t metric, size_t k, size_t nprobe,
+                           tritindex_hit_t *hits);
+
+// As above, with the queries split across up to `threads` threads (0 or
+// 1: the calling thread only). Results equal the single-threaded calls.
+bool tritindex_search_mt(const tritindex_t *idx, const uint8_t *queries, size_t nq,
+                         tritindex_metric_t metric, size_t k, size_t nprobe,
+                         tritindex_hit_t *hits, unsigned threads);
+bool tritindex_search_t64b_mt(const tritindex_t *idx, const trit64b_t *queries, size_t nq,
+                              tritindex_metric_t metric, size_t k, size_t nprobe,
+                              tritindex_hit_t *hits, unsigned threads);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: This header declares the interface. Functions implemented in
+// src/tritindex.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── Lifetime: tritindex_init, tritindex_free
+//   ├── Adding:   tritindex_add_t5, tritindex_add_trits
+//   ├── Lists:    tritindex_train
+//   └── Search:   tritindex_search, tritindex_search_t64b,
+//                 tritindex_search_mt, tritindex_search_t64b_mt
+//
+// Declared Units:
+// - 3 types (tritindex_metric_t, tritindex_hit_t, tritindex_t)
+// - 2 #define constants
+// - 9 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Strategy: Return safe defaults rather than error codes.
+//   - Allocation failure → false, index and hits unchanged
+//   - k = 0 or nq = 0 → nothing written, true
+//   Rows must be valid t5b1 bytes (0-242), as for tritmat_pack.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "tritindex.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-tritindex   Benchmark: make bench-tritindex
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// Every initialized tritindex_t must be released with tritindex_free.
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Block sizes and TRITINDEX_TRAIN_ITERS (re-run make bench-tritindex)
+//   ✅ Add metrics (one gemm-shaped kernel + a key that sorts best-high)
+//
+// Modify with Care:
+//   ⚠️ Tie order (lower id wins) - tests compare against a full sort
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_TRITINDEX_H)
+//   ❌ nprobe = 0 is exact
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Exhaustive search reads 2 bits per stored trit per block of 16 queries:
+// a 1M × 256-trit index is 64 MB of planes. With lists, a query reads
+// nlist centroids plus about nprobe/nlist of the rows.
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   tritindex_t idx;
+//   tritindex_init(&idx, 256);
+//   tritindex_add_t5(&idx, rows, n);          // n × TRITMAT_ROW_BYTES(256)
+//   tritindex_train(&idx, 1024, 0, TRITINDEX_DOT);
+//   tritindex_hit_t hits[10];
+//   tritindex_search(&idx, query, 1, TRITINDEX_DOT, 10, 16, hits);
+//   tritindex_free(&idx);
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_TRITINDEX_H
@@ -0,0 +1,346 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Ternary-Weight Matrix Products
+// Key: B-word-work-pkg-trit-include-tritmat
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//   Depends on trit.h for trit_t, TRIT5_PACKED_SIZE and backend dispatch
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 1: t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_TRITMAT_H
+#define BERESHIT_TRITMAT_H
+
+// GEMV and GEMM with {-1, 0, +1} weights stored as t5b1 rows, and
+// ternary × ternary products on bitsliced rows.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Let your communication be, Yea, yea; Nay, nay: for whatsoever
+//            is more than these cometh of evil." — Matthew 5:37
+//
+// Principle: A weight that can only say yes, no or nothing needs no
+//            multiplier. Add, subtract or skip.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Matrix layer over packed trit5 storage - the main consumer of the
+//       t5b1 format.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: y = W·x for a ternary weight matrix W and int8, int16 or float
+//          activations, without unpacking W ahead of time.
+//
+// Core Design: W is rows × cols trits. Each row is packed on its own with
+//   trit5_pack_array into TRITMAT_ROW_BYTES(cols) bytes, rows back to back
+//   (tritmat_pack does this). A GEMM takes `batch` activation vectors of
+//   cols elements each, back to back, and writes
+//
+//     y[r·batch + b] = Σ_c W[r][c] · x[b·cols + c]
+//
+//   so each output row's batch results are contiguous. GEMV is batch = 1.
+//
+//   When activations are ternary too, rows are trit64b_t bit-planes
+//   instead (TRITMAT_ROW_VECTORS(cols) vectors per row, tritmat_pack_t64b)
+//   and each product term is a popcount:
+//
+//     a·b = popcount((Pa & Pb) | (Na & Nb)) - popcount((Pa & Nb) | (Na & Pb))
+//
+//   and the Hamming distance (positions that differ) is
+//
+//     d(a, b) = popcount((Pa ^ Pb) | (Na ^ Nb))
+//
+// Key Features:
+//
+//   - Weights decode a block at a time with the active trit5 backend, then
+//     feed add/subtract-only dot kernels (sign-select, no real multiply)
+//   - Each decoded weight block is reused across a block of activation
+//     vectors (cache blocking over rows, columns and batch)
+//   - Ternary × ternary: 64 trits per popcount pair, POPCNT, AVX2 nibble
+//     lookup or AVX-512 VPOPCNTDQ by backend and CPU
+//   - Row-partitioned threaded GEMV/GEMM (tritmat_gem{v,m}_*_mt), or
+//     row slices on the caller's own threads - see Threading below
+//
+// Philosophy: Storage format and compute format can be the same bytes.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: trit.h (trit_t, trit64b_t, TRIT5_PACKED_SIZE,
+//     TRIT64B_COUNT, trit5_unpack_array, trit_backend_active)
+//   - Platform: POSIX threads for tritmat_gem{v,m}_*_mt (link with -pthread)
+//
+// What Uses This:
+//
+//   - Ternary-weight models and anything else multiplying by {-1, 0, +1}
+//   - Similarity scoring over ternary vector collections (gemv_t64b: one
+//     query against every row); tritindex.h
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "tritmat.h"
+//
+// Integration Pattern:
+//
+//  1. Pack W once: tritmat_pack(trits, rows, cols, bytes)
+//  2. Call tritmat_gemv_* per vector, or tritmat_gemm_* per batch
+//     (the _mt forms spread the rows over threads)
+//  3. Pin a kernel with trit_backend_select() if needed (default: widest)
+//
+//  Ternary activations: tritmat_pack_t64b (or tritmat_t5_to_t64b from a
+//  tritmat_pack matrix), then tritmat_dot/gemv/gemm_t64b.
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: tritmat_gem{v,m}_*_mt start up to `threads` threads, give each
+//   a slice of output rows, and join them before returning; every other
+//   function runs on the calling thread only. Output rows are
+//   independent, so a caller with its own pool can do the same: pass
+//   w + r0·TRITMAT_ROW_BYTES(cols) (TRITMAT_ROW_VECTORS for bitsliced
+//   rows), rows = r1 - r0 and y + r0·batch. Calls share no state; each
+//   uses about 14 KB of stack per thread.
+//
+// Range: Integer sums are kept in int64 and saturate to INT32_MIN /
+//   INT32_MAX when stored, so results are exact while |Σ| < 2^31 -
+//   always for int8 activations below 16M columns and int16 below
+//   65,536 - and clamped beyond. Ternary × ternary results and distances
+//   are bounded by cols.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Defines → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"       // trit_t, trit64b_t, TRIT5_PACKED_SIZE, TRIT64B_COUNT
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+// Bytes per packed weight row (each row starts on a byte boundary)
+#define TRITMAT_ROW_BYTES(cols)  TRIT5_PACKED_SIZE(cols)
+
+// trit64b_t vectors per bitsliced row (lanes past cols are zero)
+#define TRITMAT_ROW_VECTORS(cols)  TRIT64B_COUNT(cols)
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Packing (src/tritmat.c) ---
+
+// Pack a row-major rows × cols trit matrix into rows·TRITMAT_ROW_BYTES(cols)
+// bytes. Returns bytes written.
+size_t tritmat_pack(const trit_t *w, size_t rows, size_t cols, uint8_t *out);
+
+//--- Matrix-Vector (src/tritmat.c) ---
+// y[r] = Σ_c W[r][c] · x[c] for r < rows. Integer sums saturate to
+// INT32_MIN / INT32_MAX when stored (exact while |Σ| < 2^31).
+
+void tritmat_gemv_i8(const uint8_t *w, size_t rows, size_t cols, const int8_t *x, int32_t *y);
+void tritmat_gemv_i16(const uint8_t *w, size_t rows, size_t cols, const int16_t *x, int32_t *y);
+void tritmat_gemv_f32(const uint8_t *w, size_t rows, size_t cols, const float *x, float *y);
+
+//--- Matrix-Matrix (src/tritmat.c) ---
+// y[r·batch + b] = Σ_c W[r][c] · x[b·cols + c] for r < rows, b < batch.
+// Integer sums saturate to INT32_MIN / INT32_MAX when stored (exact while
+// |Σ| < 2^31).
+
+void tritmat_gemm_i8(const uint8_t *w, size_t rows, size_t cols,
+                     const int8_t *x, size_t batch, int32_t *y);
+void tritmat_gemm_i16(const uint8_t *w, size_t rows, size_t cols,
+                      const int16_t *x, size_t batch, int32_t *y);
+void tritmat_gemm_f32(const uint8_t *w, size_t rows, size_t cols,
+                      const float *x, size_t batch, float *y);
+
+//--- Threaded Matrix-Vector and Matrix-Matrix (src/tritmat.c) ---
+// As tritmat_gemv_* / tritmat_gemm_*, with output rows split across up to
+// `threads` threads (0 or 1: the calling thread only). Results, int32
+// saturation included, are identical to the single-threaded calls.
+
+void tritmat_gemv_i8_mt(const uint8_t *w, size_t rows, size_t cols,
+                        const int8_t *x, int32_t *y, unsigned threads);
+void tritmat_gemv_i16_mt(const uint8_t *w, size_t rows, size_t cols,
+                         const int16_t *x, int32_t *y, unsigned threads);
+void tritmat_gemv_f32_mt(const uint8_t *w, size_t rows, size_t cols,
+                         const float *x, float *y, unsigned threads);
+
+void tritmat_gemm_i8_mt(const uint8_t *w, size_t rows, size_t cols,
+                        const int8_t *x, size_t batch, int32_t *y, unsigned threads);
+void tritmat_gemm_i16_mt(const uint8_t *w, size_t rows, size_t cols,
+                         const int16_t *x, size_t batch, int32_t *y, unsigned threads);
+void tritmat_gemm_f32_mt(const uint8_t *w, size_t rows, size_t cols,
+                         const float *x, size_t batch, float *y, unsigned threads);
+
+//--- Ternary × Ternary (src/tritdot.c) ---
+
+// Pack a row-major rows × cols trit matrix into rows·TRITMAT_ROW_VECTORS(cols)
+// vectors. Returns vectors written.
+size_t tritmat_pack_t64b(const trit_t *w, size_t rows, size_t cols, trit64b_t *out);
+
+// Convert a tritmat_pack matrix to bitsliced rows. Returns vectors written.
+size_t tritmat_t5_to_t64b(const uint8_t *w, size_t rows, size_t cols, trit64b_t *out);
+
+// Σ trit_multiply(a[i], b[i]) over n trits (TRIT64B_COUNT(n) vectors each).
+int64_t tritmat_dot_t64b(const trit64b_t *a, const trit64b_t *b, size_t n);
+
+// y[r] = Σ_c W[r][c] · x[c], and y[r·batch + b] = Σ_c W[r][c] · x_b[c]
+// with x_b = x + b·TRITMAT_ROW_VECTORS(cols). |y| ≤ cols, so int32 is
+// exact for cols < 2^31; no saturation.
+void tritmat_gemv_t64b(const trit64b_t *w, size_t rows, size_t cols,
+                       const trit64b_t *x, int32_t *y);
+void tritmat_gemm_t64b(const trit64b_t *w, size_t rows, size_t cols,
+                       const trit64b_t *x, size_t batch, int32_t *y);
+
+// Hamming distance: positions where a[i] != b[i] over n trits, and the
+// same per (row, x_b) pair in GEMM layout (0 to cols, exact in int32).
+int64_t tritmat_hamming_t64b(const trit64b_t *a, const trit64b_t *b, size_t n);
+void tritmat_gemm_hamming_t64b(const trit64b_t *w, size_t rows, size_t cols,
+                               const trit64b_t *x, size_t batch, int32_t *y);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: This header declares the interface. Functions implemented in
+// src/tritmat.c (t5b1 weights) and src/tritdot.c (ternary × ternary).
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── Packing:       tritmat_pack
+//   ├── Matrix-Vector: tritmat_gemv_i8, tritmat_gemv_i16, tritmat_gemv_f32
+//   ├── Matrix-Matrix: tritmat_gemm_i8, tritmat_gemm_i16, tritmat_gemm_f32
+//   ├── Threaded:      tritmat_gemv_i8_mt, tritmat_gemv_i16_mt,
+//   │                  tritmat_gemv_f32_mt, tritmat_gemm_i8_mt,
+//   │                  tritmat_gemm_i16_mt, tritmat_gemm_f32_mt
+//   └── Ternary × Ternary: tritmat_pack_t64b, tritmat_t5_to_t64b,
+//       tritmat_dot_t64b, tritmat_gemv_t64b, tritmat_gemm_t64b,
+//       tritmat_hamming_t64b, tritmat_gemm_hamming_t64b
+//
+// Declared Units:
+// - 2 #define macros
+// - 20 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Strategy: No error paths. Weights must be valid t5b1 bytes (0-242);
+//   spare bytes decode to undefined trits, as in trit5_unpack_array.
+//   Bitsliced inputs must be valid (no lane both +1 and -1) and zero in
+//   lanes past n or cols.
+//   Outputs must not overlap inputs.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "tritmat.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-tritmat test-tritdot
+// Benchmark: make bench-tritmat bench-tritdot
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Block sizes in src/tritmat.c (re-run make bench-tritmat)
+//   ✅ Add activation types (one dot kernel per backend + wrappers)
+//
+// Modify with Care:
+//   ⚠️ Output layout y[r·batch + b] (row slices rely on it)
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_TRITMAT_H)
+//   ❌ Row layout = trit5_pack_array per row, byte-aligned rows
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Packed weights are 1.6 bits each, so a GEMV reads 5x fewer weight bytes
+// than int8 weights. Decode runs once per weight block per batch block,
+// amortized over up to 64 activation vectors.
+//
+// Bitsliced rows are 2 bits per trit, but a ternary × ternary product of
+// 64 trits costs four ANDs, two ORs and two popcounts, with no decode.
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   uint8_t w[2 * TRITMAT_ROW_BYTES(3)];
+//   trit_t trits[6] = { 1, 0, -1,   -1, -1, 1 };
+//   tritmat_pack(trits, 2, 3, w);
+//   int8_t x[3] = { 10, 20, 30 };
+//   int32_t y[2];
+//   tritmat_gemv_i8(w, 2, 3, x, y);     // y = { -20, 0 }
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_TRITMAT_H
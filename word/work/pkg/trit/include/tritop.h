@@ -0,0 +1,314 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Truth-Table Operators
+// Key: B-word-work-pkg-trit-include-tritop
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//   Depends on trit.h for trit_t, trit9_t, trit64b_t and TRIT9_MAX
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/research/ternary/ternary-logic-algorithms.adoc [Dyadic Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_TRITOP_H
+#define BERESHIT_TRITOP_H
+
+// Any of the 19,683 dyadic and 27 monadic trit operators, named by its
+// truth table and run on trit_t arrays or compiled to bit-plane logic.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "And whatsoever Adam called every living creature, that was
+//            the name thereof." — Genesis 2:19
+//
+// Principle: An operator is its table. Name the table and the operator
+//            is known, whatever it is called elsewhere.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: One interface behind ADDITION_TABLE, MULTIPLICATION_TABLE, the
+//       Kleene connectives (logic.h) and every other table.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Evaluate, compile and apply operators given only their
+//          truth-table IDs.
+//
+// Core Design: A dyadic table is a trit9_t (TRIT_OP2_ID), a monadic one a
+//   3-trit ID (TRIT_OP1_ID). trit_t arrays go through a 9- or 3-entry
+//   byte lookup; bit-plane vectors go through a trit_op_t, a short
+//   AND / OR / XOR / AND-NOT program per output plane.
+//
+// Key Features:
+//
+//   - Named IDs for the common tables (TRIT_OP2_ADD, _AND, _CONSENSUS, ...)
+//   - Every ID valid: no operator needs its own kernel
+//   - Compiled programs of at most TRIT_OP_CODE_MAX instructions
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: trit.h (trit_t, trit9_t, trit64b_t, TRIT9_MAX)
+//   - Platform: POSIX threads (pthread_once; link with -pthread)
+//
+// What Uses This:
+//
+//   - logic.h (bool3 connectives are TRIT_OP2_* IDs), tritfilter.h
+//     (column tables are TRIT_OP1_* IDs)
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "tritop.h"
+//
+// Integration Pattern:
+//
+//  1. Name a table: TRIT_OP2_* / TRIT_OP1_*, or TRIT_OP2_ID(...)
+//  2. trit_op2_apply / trit_op1_apply on trit_t arrays, or
+//  3. trit_op2_compile once, then trit64b_op_run on bit-planes
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: Reentrant. The formula table behind compile is built once
+//   under pthread_once; a compiled trit_op_t is a plain value and may be
+//   shared and run by any number of threads.
+//
+// Memory: None allocated.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Defines → Types → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"    // trit_t, trit9_t, trit64b_t, TRIT9_MAX
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+//--- Truth-Table Operator IDs ---
+// A dyadic operator f(a, b) is named by its 3×3 truth table packed as a
+// trit9_t: digit 3·(a+1) + (b+1), MST first, holds f(a, b) - the rows
+// a = -1, 0, +1 in trit9_pack order. A monadic operator f(a) is named by
+// its trit3 ID 0-26, f(-1) most significant. Every one of the 19,683 and
+// 27 IDs is a valid operator; see trit_op2_apply and trit_op2_compile.
+//
+// See: word/research/ternary/ternary-logic-algorithms.adoc [Dyadic Operations]
+
+#define TRIT_OP2_ID(f0, f1, f2, f3, f4, f5, f6, f7, f8) \
+    ((trit9_t)(((f0) + 1) * 6561 + ((f1) + 1) * 2187 + ((f2) + 1) * 729 + \
+               ((f3) + 1) * 243 + ((f4) + 1) * 81 + ((f5) + 1) * 27 + \
+               ((f6) + 1) * 9 + ((f7) + 1) * 3 + ((f8) + 1)))
+#define TRIT_OP1_ID(f0, f1, f2)  ((uint8_t)(((f0) + 1) * 9 + ((f1) + 1) * 3 + ((f2) + 1)))
+#define TRIT_OP1_STATES  27     // 3^3 monadic operators
+
+#define TRIT_OP2_ADD        TRIT_OP2_ID(-1, -1,  0, -1,  0,  1,  0,  1,  1)  // trit_add
+#define TRIT_OP2_MULTIPLY   TRIT_OP2_ID( 1,  0, -1,  0,  0,  0, -1,  0,  1)  // trit_multiply
+#define TRIT_OP2_AND        TRIT_OP2_ID(-1, -1, -1, -1,  0,  0, -1,  0,  1)  // min(a, b)
+#define TRIT_OP2_OR         TRIT_OP2_ID(-1,  0,  1,  0,  0,  1,  1,  1,  1)  // max(a, b)
+#define TRIT_OP2_NAND       TRIT_OP2_ID( 1,  1,  1,  1,  0,  0,  1,  0, -1)  // -min(a, b)
+#define TRIT_OP2_NOR        TRIT_OP2_ID( 1,  0, -1,  0,  0, -1, -1, -1, -1)  // -max(a, b)
+#define TRIT_OP2_XOR        TRIT_OP2_ID(-1,  0,  1,  0,  0,  0,  1,  0, -1)  // -(a·b)
+#define TRIT_OP2_CONSENSUS  TRIT_OP2_MULTIPLY                                // agree +1, disagree -1
+#define TRIT_OP2_EQUALITY   TRIT_OP2_ID( 1, -1, -1, -1,  1, -1, -1, -1,  1)  // a == b
+#define TRIT_OP2_IMPLIES    TRIT_OP2_ID( 1,  1,  1,  0,  0,  1, -1,  0,  1)  // max(-a, b)
+#define TRIT_OP2_COMPARE    TRIT_OP2_ID( 0, -1, -1,  1,  0, -1,  1,  1,  0)  // sign(a - b)
+
+#define TRIT_OP1_IDENTITY   TRIT_OP1_ID(-1,  0,  1)
+#define TRIT_OP1_NEGATE     TRIT_OP1_ID( 1,  0, -1)  // trit_negate
+#define TRIT_OP1_INCREMENT  TRIT_OP1_ID( 0,  1,  1)  // saturating +1
+#define TRIT_OP1_DECREMENT  TRIT_OP1_ID(-1, -1,  0)  // saturating -1
+#define TRIT_OP1_ABSOLUTE   TRIT_OP1_ID( 1, -1,  1)  // certain → +1, unknown → -1
+
+// Instruction slots in a compiled operator (trit_op_t). The longest of the
+// 19,683 compiled tables fits; test/tritop_test.c checks every one.
+
+#define TRIT_OP_CODE_MAX  12
+
+// ────────────────────────────────────────────────────────────────
+// Type Definitions
+// ────────────────────────────────────────────────────────────────
+
+// trit_op_t is a truth-table operator compiled to bit-plane logic: a
+// straight-line program of AND / OR / XOR / AND-NOT over whole uint64
+// planes. Built by trit_op2_compile / trit_op1_compile, run by
+// trit64b_op_run; treat the fields as opaque.
+//
+// Registers 0-5 hold a.pos, a.neg, b.pos, b.neg, all-zeros and all-ones;
+// instruction i writes register 6 + i.
+typedef struct {
+    uint8_t len;                        // instructions in code
+    uint8_t pos;                        // register holding the result's pos plane
+    uint8_t neg;                        // register holding the result's neg plane
+    uint8_t code[TRIT_OP_CODE_MAX][3];  // {opcode, x, y}
+} trit_op_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Truth-Table Operators (src/tritop.c) ---
+// Any operator named by its truth-table ID (see TRIT_OP2_ID). Invalid IDs
+// (above TRIT9_MAX, or 26 for monadic) make eval return TRIT_ZERO and
+// compile/apply return false with the output untouched.
+
+// f(a, b) for one pair, read straight from the table's digits.
+trit_t trit_op2_eval(trit9_t table, trit_t a, trit_t b);
+
+// f(a) for one trit.
+trit_t trit_op1_eval(uint8_t table, trit_t a);
+
+// Compile a table to a minimal-size bit-plane program (formulas cached).
+bool trit_op2_compile(trit9_t table, trit_op_t *op);
+bool trit_op1_compile(uint8_t table, trit_op_t *op);
+
+// out[i] = op(a[i], b[i]) over n bitsliced vectors. b may be NULL for
+// monadic operators (b = a). out may equal a or b.
+void trit64b_op_run(const trit_op_t *op, const trit64b_t *a, const trit64b_t *b,
+                    size_t n, trit64b_t *out);
+
+// out[i] = f(a[i], b[i]) over trit_t arrays (one table lookup per lane on
+// the active backend, not the compiled program: trit_t data would first
+// have to be split into planes). out may equal a or b.
+bool trit_op2_apply(trit9_t table, const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+
+// out[i] = f(in[i]). out may equal in.
+bool trit_op1_apply(uint8_t table, const trit_t *in, size_t n, trit_t *out);
+
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: This header declares the interface. Functions implemented in
+// src/tritop.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── Evaluate: trit_op2_eval, trit_op1_eval
+//   ├── Compile:  trit_op2_compile, trit_op1_compile, trit64b_op_run
+//   └── Apply:    trit_op2_apply, trit_op1_apply
+//
+// Declared Units:
+// - 1 type (trit_op_t)
+// - 20 #define constants and macros
+// - 7 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations
+// ────────────────────────────────────────────────────────────────
+//
+//   - trit_op{1,2}_eval: one digit of the table ID
+//   - trit_op{1,2}_compile: minimal AND/OR/XOR/AND-NOT formula per plane
+//   - trit64b_op_run: compiled program over blocks of bitsliced vectors
+//   - trit_op{1,2}_apply: pshufb truth-table lookup on trit_t arrays
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Strategy: Return safe defaults rather than error codes.
+//   - Invalid ID (above TRIT9_MAX, or 26 for monadic) → eval TRIT_ZERO,
+//     compile / apply false with the output untouched
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "tritop.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-tritop   Benchmark: make bench-tritop
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add named IDs (TRIT_OP2_* / TRIT_OP1_*) for more tables
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_TRITOP_H)
+//   ❌ ID digit order (a = -1 row first, MST first) - IDs are stored
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// apply costs one lookup per trit on the active backend, whatever the
+// table; a compiled program costs its length in word operations per 64
+// trits. Compile once per table, not per call.
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   trit_t out[n];
+//   trit_op2_apply(TRIT_OP2_IMPLIES, a, b, n, out);
+//
+//   trit_op_t op;
+//   trit_op2_compile(TRIT_OP2_ID(1, 0, -1, 0, 0, 0, -1, 0, 1), &op);
+//   trit64b_op_run(&op, va, vb, nv, vout);
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_TRITOP_H
@@ -0,0 +1,253 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Entropy-Coded Trit Streams
+// Key: B-word-work-pkg-trit-include-tritrans
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//   Depends on trit.h for trit_t and TRIT5_PACKED_SIZE
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_TRITRANS_H
+#define BERESHIT_TRITRANS_H
+
+// rANS coding of trit sequences against per-block symbol frequencies,
+// from and to trit_t arrays or t5b1 buffers.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "He telleth the number of the stars; he calleth them all by
+//            their names." — Psalm 147:4
+//
+// Principle: Spend bits where the data is uncertain, none where it is
+//            not.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Archive format for trit data: as few bits per trit as each
+//       block's statistics allow.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Encode trit sequences near their entropy and decode them at
+//          hundreds of MB/s.
+//
+// Core Design: Each TRIT_RANS_BLOCK trits get their own frequencies and
+//   are coded with interleaved rANS states; a block that would not beat
+//   t5b1 is stored as t5b1. The stream records its trit count, and is
+//   the same whether written from trit_t or t5b1.
+//
+// Key Features:
+//
+//   - About -Σ p·log2(p) bits per trit
+//   - Never larger than TRIT_RANS_BOUND(n)
+//   - trit_t and t5b1 encoders and decoders read each other's streams
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: trit.h (trit_t, TRIT5_PACKED_SIZE)
+//
+// What Uses This:
+//
+//   - Archival of skewed trit data (sparse weights, mostly-zero logs)
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "tritrans.h"
+//
+// Integration Pattern:
+//
+//  1. trit_rans_encode / trit5_rans_encode into TRIT_RANS_BOUND(n) bytes
+//  2. trit_rans_count to size the output
+//  3. trit_rans_decode / trit5_rans_decode
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: Reentrant - tables and coder states are per call. A stream
+//   decodes serially; encode pieces as separate streams for parallel
+//   decode.
+//
+// Memory: None allocated; about 21 KB of stack per call.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Defines → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"    // trit_t, TRIT5_PACKED_SIZE
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+//--- Entropy-Coded Streams ---
+// Trits per independently modeled block (a multiple of 5, so blocks of a
+// t5b1 buffer start on byte boundaries), the worst-case stream size for
+// n trits (every block stored as t5b1), and the result of a malformed or
+// oversized decode.
+
+#define TRIT_RANS_BLOCK     40960
+#define TRIT_RANS_BOUND(n)  (8 + ((n) + TRIT_RANS_BLOCK - 1) / TRIT_RANS_BLOCK + TRIT5_PACKED_SIZE(n))
+#define TRIT_RANS_ERROR     SIZE_MAX
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Entropy-Coded Streams (src/rans.c) ---
+// rANS coding of trit sequences against per-block symbol frequencies:
+// about -Σ p·log2(p) bits per trit (log2(3) ≈ 1.585 for uniform trits,
+// far less when one value dominates). A block that would not beat t5b1
+// is stored as t5b1. Streams hold their trit count and are the same
+// whether written from trit_t arrays or t5b1 buffers, so either decoder
+// reads either. Block layout: see src/rans.c.
+
+// Encode n trits into out (TRIT_RANS_BOUND(n) bytes); returns bytes written.
+size_t trit_rans_encode(const trit_t *in, size_t n, uint8_t *out);
+size_t trit5_rans_encode(const uint8_t *in, size_t n, uint8_t *out);
+
+// Trits held by a stream of len bytes, or TRIT_RANS_ERROR if too short.
+size_t trit_rans_count(const uint8_t *in, size_t len);
+
+// Decode into out (cap trits; TRIT5_PACKED_SIZE(cap) bytes for t5b1);
+// returns trits written, or TRIT_RANS_ERROR if the stream is malformed
+// or holds more than cap trits.
+size_t trit_rans_decode(const uint8_t *in, size_t len, trit_t *out, size_t cap);
+size_t trit5_rans_decode(const uint8_t *in, size_t len, uint8_t *out, size_t cap);
+
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: This header declares the interface. Functions implemented in
+// src/rans.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── Encode: trit_rans_encode, trit5_rans_encode
+//   └── Decode: trit_rans_count, trit_rans_decode, trit5_rans_decode
+//
+// Declared Units:
+// - 3 #define constants and macros
+// - 5 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations
+// ────────────────────────────────────────────────────────────────
+//
+//   - trit_rans_encode: histogram per block, frequencies scaled to 4096,
+//     8 interleaved 32-bit rANS states, reciprocal multiply per trit
+//   - trit_rans_decode: one 4096-entry table load and multiply-add per
+//     trit, 8 states in flight
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Strategy: Return an error value rather than write past a buffer.
+//   - trit_rans_decode / trit5_rans_decode(malformed or too large) →
+//     TRIT_RANS_ERROR
+//   - trit_rans_count(too short) → TRIT_RANS_ERROR
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "tritrans.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-rans   Benchmark: make bench-rans
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ TRIT_RANS_BLOCK (a multiple of 5; old streams carry their own)
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_TRITRANS_H)
+//   ❌ Stream layout - streams are stored
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Encoding histograms each block, then codes; decoding is one table
+// load and multiply-add per trit with 8 states in flight.
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   uint8_t *z = malloc(TRIT_RANS_BOUND(n));
+//   size_t len = trit5_rans_encode(buf, n, z);
+//   trit5_rans_decode(z, len, back, n);
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_TRITRANS_H
@@ -0,0 +1,255 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Reductions over Trit Arrays
+// Key: B-word-work-pkg-trit-include-tritreduce
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//   Depends on trit.h for trit_t, TRIT5_PACKED_SIZE and TRIT_TO_UNSIGNED
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_TRITREDUCE_H
+#define BERESHIT_TRITREDUCE_H
+
+// Sum, histogram and running-balance extremes of trit_t arrays and t5b1
+// buffers, without expanding packed bytes.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Thou art weighed in the balances, and art found wanting."
+//            — Daniel 5:27
+//
+// Principle: Weigh the whole, and know where the balance swung.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Monitoring statistics over buffers of many GB.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Reduce a sequence to its sum, its counts of -1 / 0 / +1,
+//          and the lowest and highest running balance.
+//
+// Core Design: trit_stats_t describes a sequence as a walk; stats of
+//   consecutive pieces merge with trit_stats_merge, so buffers reduce in
+//   pieces, in any grouping, as long as the merge keeps their order.
+//
+// Key Features:
+//
+//   - trit_t arrays and t5b1 buffers, same results
+//   - Counts on the active backend
+//   - Associative merge for pieces and threads
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: trit.h (trit_t, TRIT5_PACKED_SIZE, TRIT_TO_UNSIGNED)
+//
+// What Uses This:
+//
+//   - scan.c (pass one of the blocked scans), rans.c (block histograms),
+//     tritfile.h callers summing chunks
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "tritreduce.h"
+//
+// Integration Pattern:
+//
+//  1. trit_sum_array / trit_count_array for one figure, or
+//  2. trit_stats_array / trit5_stats_array for all of them
+//  3. trit_stats_merge to join pieces in order
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: Reentrant; reductions only read. Pieces reduced on
+//   different threads combine with trit_stats_merge in sequence order.
+//
+// Memory: None allocated.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Types → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"    // trit_t, TRIT5_PACKED_SIZE, TRIT_TO_UNSIGNED
+
+// ────────────────────────────────────────────────────────────────
+// Type Definitions
+// ────────────────────────────────────────────────────────────────
+
+// trit_stats_t summarizes a trit sequence t[0..n-1] as a walk: the running
+// balance after k trits is t[0] + ... + t[k-1]. min_prefix / max_prefix
+// are its extremes over k = 0..n (the empty prefix counts, so min ≤ 0 ≤
+// max). Stats of consecutive pieces combine with trit_stats_merge; the
+// all-zero struct is the empty sequence.
+typedef struct {
+    int64_t sum;            // balance after all n trits (pos - neg)
+    uint64_t count[3];      // count[TRIT_TO_UNSIGNED(t)] = trits equal to t
+    int64_t min_prefix;     // lowest running balance
+    int64_t max_prefix;     // highest running balance
+} trit_stats_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Reductions (src/reduce.c) ---
+// Sum, histogram and balance walk of trit_t arrays and t5b1 buffers
+// (TRIT5_PACKED_SIZE(n) bytes holding n trits, as trit5_pack_array).
+// Packed bytes are never expanded to one trit per byte; counts run on the
+// active backend. Inputs must be valid; spare bytes count as unspecified
+// trits.
+
+// Σ in[i] / histogram (counts[TRIT_TO_UNSIGNED(t)] = trits equal to t).
+int64_t trit_sum_array(const trit_t *in, size_t n);
+void trit_count_array(const trit_t *in, size_t n, uint64_t counts[3]);
+
+// Sum, counts and min/max running balance in one pass.
+trit_stats_t trit_stats_array(const trit_t *in, size_t n);
+
+// The same over the first n trits of a t5b1 buffer.
+int64_t trit5_sum_array(const uint8_t *in, size_t n);
+void trit5_count_array(const uint8_t *in, size_t n, uint64_t counts[3]);
+trit_stats_t trit5_stats_array(const uint8_t *in, size_t n);
+
+// Stats of sequence a followed by sequence b. Associative, so a buffer
+// split into pieces (at multiples of 5 trits for t5b1) can be summarized
+// piece by piece - or on several threads - and merged in order.
+trit_stats_t trit_stats_merge(trit_stats_t a, trit_stats_t b);
+
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: This header declares the interface. Functions implemented in
+// src/reduce.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── trit_t arrays: trit_sum_array, trit_count_array, trit_stats_array
+//   ├── t5b1 buffers:  trit5_sum_array, trit5_count_array, trit5_stats_array
+//   └── Pieces:        trit_stats_merge
+//
+// Declared Units:
+// - 1 type (trit_stats_t)
+// - 7 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations
+// ────────────────────────────────────────────────────────────────
+//
+//   - trit_*_array: compare + byte-counter histogram, sum = pos - neg
+//   - trit5_*_array: per-byte summary table, or v/27 and v/9 by mulhi
+//     and three pshufb count lookups per byte
+//   - *_stats_array: table walk, with runs that cannot reach a new
+//     extreme counted by the histogram kernel instead
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Nothing can fail. Inputs must be valid trits / t5b1 bytes; a spare
+// byte (243-255) counts as unspecified trits.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "tritreduce.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-reduce   Benchmark: make bench-reduce
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add figures to trit_stats_t (merge must stay associative)
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_TRITREDUCE_H)
+//   ❌ The all-zero trit_stats_t is the empty sequence
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Sums and counts read each byte once at memory speed; stats walk a
+// table per byte and are several times slower on data that keeps
+// setting new extremes.
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   trit_stats_t s = trit5_stats_array(buf, n);
+//   trit_stats_t both = trit_stats_merge(s, trit5_stats_array(next, m));
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_TRITREDUCE_H
@@ -0,0 +1,269 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Run-Length Streams of t5b1 Buffers
+// Key: B-word-work-pkg-trit-include-tritrle
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//   Depends on trit.h for TRIT5_BIAS and the spare-state range
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/scripture/web-variant-index.adoc (spare states 243-255)
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_TRITRLE_H
+#define BERESHIT_TRITRLE_H
+
+// Byte runs of t5b1 buffers folded into escape tokens built from two
+// spare states; plain t5b1 data is already a valid stream.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Gather up the fragments that remain, that nothing be
+//            lost." — John 6:12
+//
+// Principle: Fold what repeats, keep everything else as it was.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Shrink t5b1 buffers dominated by all-zero groups for storage
+//       and transfer, at memory speed.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Encode and decode run-length streams of t5b1 bytes.
+//
+// Core Design: Two of the 13 spare states (243-255) become escapes:
+//   one for runs of TRIT5_BIAS (five zero trits), one for runs of any
+//   other byte. Every other byte stands for itself, so data without runs
+//   encodes to itself. trit5_rle_t picks the escapes.
+//
+// Key Features:
+//
+//   - Plain t5b1 buffers decode to themselves
+//   - Any escape pair; rail bytes in the input stay exact
+//   - Checked decode with a caller-given capacity
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: trit.h (TRIT5_BIAS)
+//
+// What Uses This:
+//
+//   - tritfile.h callers compressing chunks; storage and transfer of
+//     sparse t5b1 data
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "tritrle.h"
+//
+// Integration Pattern:
+//
+//  1. trit5_rle_encode(in, n, out, NULL) into TRIT5_RLE_BOUND(n) bytes
+//  2. trit5_rle_decoded_size to size the output
+//  3. trit5_rle_decode(stream, len, out, cap, NULL)
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: Reentrant. Pieces encoded separately concatenate into a
+//   valid stream of the whole buffer.
+//
+// Memory: None allocated.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Defines → Types → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"    // TRIT5_BIAS
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+//--- Run-Length Streams ---
+// Default escapes of trit5_rle_t: two of the 13 spare states (243-255).
+// Every spare state is a Bible Rail value (web-variant-index.adoc); any
+// pair may be chosen instead, and rail bytes in the input stay exact.
+
+#define TRIT5_RLE_ZERO_ESCAPE  255          // Z L:   L + 2 bytes of TRIT5_BIAS
+#define TRIT5_RLE_RUN_ESCAPE   254          // R L V: L + 3 bytes of V
+
+// Worst-case encoded size of n input bytes (every byte an escape), and
+// the result of a malformed or oversized decode.
+
+#define TRIT5_RLE_BOUND(n)  (2 * (n))
+#define TRIT5_RLE_ERROR     SIZE_MAX
+
+// ────────────────────────────────────────────────────────────────
+// Type Definitions
+// ────────────────────────────────────────────────────────────────
+
+// trit5_rle_t picks the escape bytes of a run-length stream (see
+// trit5_rle_encode). An escape that is not a spare state (243-255)
+// disables its token, as does run_escape equal to zero_escape; with both
+// disabled the stream is a plain copy. NULL means the defaults.
+typedef struct {
+    uint8_t zero_escape;    // runs of TRIT5_BIAS (all-zero groups)
+    uint8_t run_escape;     // runs of any other byte
+} trit5_rle_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Run-Length Streams (src/rle.c) ---
+// Byte runs of t5b1 buffers folded into escape tokens, with escapes e
+// chosen by trit5_rle_t (NULL: TRIT5_RLE_ZERO_ESCAPE / _RUN_ESCAPE):
+//   Z L      L = 1..255: TRIT5_BIAS repeated L + 2 times (3..257)
+//   R L V    L = 1..255: V repeated L + 3 times (4..258)
+//   e 0      the byte e itself
+//   other    itself
+// Input without runs or escape bytes - any plain t5b1 buffer without
+// repeats - encodes to itself, and every plain t5b1 buffer decodes to
+// itself. Any byte values round-trip, spare states included.
+
+// Encode n bytes into out (TRIT5_RLE_BOUND(n) bytes); returns bytes written.
+size_t trit5_rle_encode(const uint8_t *in, size_t n, uint8_t *out, const trit5_rle_t *codec);
+
+// Bytes that decoding in would produce, or TRIT5_RLE_ERROR if malformed.
+size_t trit5_rle_decoded_size(const uint8_t *in, size_t n, const trit5_rle_t *codec);
+
+// Decode n bytes into out (cap bytes); returns bytes written, or
+// TRIT5_RLE_ERROR if in is malformed or needs more than cap bytes.
+size_t trit5_rle_decode(const uint8_t *in, size_t n, uint8_t *out, size_t cap,
+                        const trit5_rle_t *codec);
+
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: This header declares the interface. Functions implemented in
+// src/rle.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── Encode: trit5_rle_encode
+//   └── Decode: trit5_rle_decoded_size, trit5_rle_decode
+//
+// Declared Units:
+// - 1 type (trit5_rle_t)
+// - 4 #define constants and macros
+// - 3 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations
+// ────────────────────────────────────────────────────────────────
+//
+//   - trit5_rle_encode: compare at offsets 0/1/2 finds the next run or
+//     escape byte; literals between are copied whole
+//   - trit5_rle_decode: compare finds the next escape; memcpy literals,
+//     memset runs
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Strategy: Return an error value rather than write past a buffer.
+//   - trit5_rle_decode(malformed or too large) → TRIT5_RLE_ERROR
+//   - trit5_rle_decoded_size(malformed) → TRIT5_RLE_ERROR
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "tritrle.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-rle   Benchmark: make bench-rle
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Default escapes (old streams then need the old codec passed in)
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_TRITRLE_H)
+//   ❌ Byte values outside the escapes mean themselves
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Both directions run at a few GB/s: literals move with memcpy, runs
+// with memset, and the search for the next token is a vector compare.
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   uint8_t *z = malloc(TRIT5_RLE_BOUND(n));
+//   size_t len = trit5_rle_encode(buf, n, z, NULL);
+//   trit5_rle_decode(z, len, back, n, NULL);
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_TRITRLE_H
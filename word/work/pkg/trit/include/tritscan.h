@@ -0,0 +1,240 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Prefix Sums of Trit Arrays
+// Key: B-word-work-pkg-trit-include-tritscan
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//   Depends on trit.h for trit_t; the _mt forms need POSIX threads
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Carry Propagation]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_TRITSCAN_H
+#define BERESHIT_TRITSCAN_H
+
+// Inclusive and exclusive running sums of trit_t arrays into int32 or
+// int64, in blocks that chain by carry.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Line upon line, line upon line; here a little, and there a
+//            little." — Isaiah 28:10
+//
+// Principle: Each step stands on all the steps before it.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Running totals of trit sequences for buffers of 100M+ elements.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: out[i] = carry + in[0] + ... + in[i] (or up to in[i - 1]),
+//          with the carry for the next block returned.
+//
+// Core Design: A long sequence scans block by block: sum each block
+//   (trit_sum_array, tritreduce.h), chain the carries, then scan each
+//   block from its carry. The _mt forms do exactly that on threads.
+//   The navigation scan (trit_navigate_scan) is declared in dimension.h.
+//
+// Key Features:
+//
+//   - int32 (wrapping) and int64 results, inclusive and exclusive
+//   - Every call returns the next block's carry
+//   - _mt forms split both passes over up to `threads` threads
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: trit.h (trit_t)
+//   - Platform: POSIX threads for trit_prefix_sum_*_mt (link with -pthread)
+//
+// What Uses This:
+//
+//   - Callers indexing or monitoring long trit streams
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "tritscan.h"
+//
+// Integration Pattern:
+//
+//  1. trit_prefix_sum_i64(in, n, 0, out) for one buffer
+//  2. Pass the returned carry into the next block's call
+//  3. trit_prefix_sum_*_mt for large buffers on several cores
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: The plain scans run on the caller. The _mt scans start and
+//   join their own threads inside the call.
+//
+// Memory: None allocated.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"    // trit_t
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Prefix Sums (src/scan.c) ---
+// Running sums of trit_t arrays into int32/int64 on the active backend.
+// Inclusive: out[i] = carry + in[0] + ... + in[i]. Exclusive (_excl):
+// out[i] = carry + in[0] + ... + in[i - 1], so out[0] = carry. Each
+// returns carry + Σ in, the carry for the next block: sum blocks with
+// trit_sum_array (pass one, any thread), chain the carries, then scan
+// each block with its carry (pass two). int32 results wrap modulo 2^32.
+
+int32_t trit_prefix_sum_i32(const trit_t *in, size_t n, int32_t carry, int32_t *out);
+int32_t trit_prefix_sum_excl_i32(const trit_t *in, size_t n, int32_t carry, int32_t *out);
+int64_t trit_prefix_sum_i64(const trit_t *in, size_t n, int64_t carry, int64_t *out);
+int64_t trit_prefix_sum_excl_i64(const trit_t *in, size_t n, int64_t carry, int64_t *out);
+
+// The same split across up to `threads` threads, started and joined
+// inside the call (0 or 1: the caller only). Results equal the calls
+// above.
+int32_t trit_prefix_sum_i32_mt(const trit_t *in, size_t n, int32_t carry, int32_t *out,
+                               unsigned threads);
+int32_t trit_prefix_sum_excl_i32_mt(const trit_t *in, size_t n, int32_t carry, int32_t *out,
+                                    unsigned threads);
+int64_t trit_prefix_sum_i64_mt(const trit_t *in, size_t n, int64_t carry, int64_t *out,
+                               unsigned threads);
+int64_t trit_prefix_sum_excl_i64_mt(const trit_t *in, size_t n, int64_t carry, int64_t *out,
+                                    unsigned threads);
+
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: This header declares the interface. Functions implemented in
+// src/scan.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── One thread: trit_prefix_sum_i32, _excl_i32, _i64, _excl_i64
+//   └── Threaded:   trit_prefix_sum_i32_mt, _excl_i32_mt, _i64_mt,
+//                   _excl_i64_mt
+//
+// Declared Units:
+// - 8 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations
+// ────────────────────────────────────────────────────────────────
+//
+//   - trit_prefix_sum_*: log-step int8 scan of 16 trits, widened to
+//     int32/int64 lanes, plus a broadcast carry
+//   - trit_prefix_sum_*_mt: block sums, chained carries, then the block
+//     scans, on thread.c threads
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Nothing can fail. int32 results wrap modulo 2^32 in unsigned
+// arithmetic, never overflowing in C terms.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "tritscan.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-scan   Benchmark: make bench-scan
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add narrower or wider result types (same carry contract)
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_TRITSCAN_H)
+//   ❌ Return value = carry + Σ in, for every form
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Results are 4-8 bytes per trit, so beyond cache the scans run at
+// store bandwidth; the _mt forms add one read pass (the block sums).
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   int64_t carry = 0;
+//   carry = trit_prefix_sum_i64(block0, n0, carry, out0);
+//   carry = trit_prefix_sum_i64(block1, n1, carry, out1);
+//   trit_prefix_sum_i64_mt(all, n, 0, out, 8);
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_TRITSCAN_H
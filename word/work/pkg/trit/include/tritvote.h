@@ -0,0 +1,326 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Majority and Consensus Votes across Ternary Vectors
+// Key: B-word-work-pkg-trit-include-tritvote
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//   Depends on trit.h for trit64b_t, TRIT64B_COUNT and TRIT5_PACKED_SIZE
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/research/ternary/ternary-logic-algorithms.adoc [CONSENSUS (Agreement)]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_TRITVOTE_H
+#define BERESHIT_TRITVOTE_H
+
+// Per-position vote counts, majority and consensus over any number of
+// {-1, 0, +1} vectors of one length, counted in bitsliced form.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "In the mouth of two or three witnesses shall every word be
+//            established." — 2 Corinthians 13:1
+//
+// Principle: Every witness is counted, none is clamped away. The verdict
+//            is read from the full tally.
+//
+// # CPI-SI Identity
+//
+// Component Type: Rungs (built on the bitsliced layer)
+//
+// Role: Reduce hundreds of ternary vectors to one per-position verdict.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Count, at every position, how many vectors hold +1 and how
+//          many hold -1, and read majority and consensus from the counts.
+//          A trit_add loop saturates at ±1 and cannot count.
+//
+// Core Design: A tritvote_t keeps two counters per position (votes for
+//   +1, votes for -1) as bit-planes: plane b holds bit b of every
+//   position's counts, laid out like trit64b_t (pos word, neg word per 64
+//   positions). Vectors arrive as trit64b_t planes or t5b1 rows and are
+//   added 15 at a time: a carry-save tree of full adders reduces 15
+//   planes to a 4-bit count, which one ripple pass adds to the counters.
+//   Counters widen as votes grow.
+//
+//   Verdicts (V = vectors added, P / N = votes for +1 / -1):
+//     majority   sign(P - N): zeros abstain, a tie is 0
+//     consensus  +1 if every vector holds the same non-zero value,
+//                 0 if any vector holds 0, -1 if the values disagree
+//                 (the n-ary form of CONSENSUS; V = 2 is the table)
+//     counts     P and N; zeros are V - P - N
+//
+// Key Features:
+//
+//   - About 15 bitwise operations per vector per 64 positions
+//   - Accumulators merge, so vectors can be split across threads
+//   - Verdicts computed on the bit-planes, never per position
+//
+// Philosophy: Count first, judge later - a tally can always be read
+//             again, a clamped sum cannot.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: trit.h (trit64b_t, TRIT64B_COUNT, TRIT5_PACKED_SIZE)
+//   - Platform: POSIX threads for tritvote_add_*_mt (link with -pthread)
+//
+// What Uses This:
+//
+//   - Ensembles, voting, and k-means style centroid updates over ternary
+//     codes
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "tritvote.h"
+//
+// Integration Pattern:
+//
+//  1. tritvote_init(&v, n)
+//  2. tritvote_add_t64b / tritvote_add_t5 as vectors arrive (the _mt
+//     forms for large batches)
+//  3. tritvote_majority / tritvote_consensus / tritvote_counts
+//  4. tritvote_free(&v) (or tritvote_clear to count again)
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: A tritvote_t belongs to one thread at a time; verdicts only
+//   read it, so several threads may read one tally. The _mt adds start
+//   and join their own threads. Each thread tallies a slice into a
+//   private tritvote_t, and the slices are merged with tritvote_merge.
+//   Callers with their own threads can do the same, merging in any
+//   order.
+//
+// Memory: Counters are heap-allocated, 2·⌈log2(V + 1)⌉ bits per
+//   position. Functions that allocate return false on failure and leave
+//   the tally unchanged.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Defines → Types → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"    // trit64b_t, TRIT64B_COUNT, TRIT5_PACKED_SIZE
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define TRITVOTE_MAX_VOTES  UINT32_MAX   // vectors one tally can hold
+
+// ────────────────────────────────────────────────────────────────
+// Type Definitions
+// ────────────────────────────────────────────────────────────────
+
+// tritvote_t is a running tally over vectors of n trits.
+//
+// Fields:
+//   n      - trits per vector
+//   votes  - vectors added (V)
+//   bits   - counter bit-planes allocated (0 before the first add)
+//   stride - words per plane: pos, neg for each 64 positions, padded
+//   count  - bits planes of stride words; plane b holds bit b of P and N
+typedef struct {
+    size_t n;
+    uint64_t votes;
+    unsigned bits;
+    size_t stride;
+    uint64_t *count;
+} tritvote_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Lifetime (src/tritvote.c) ---
+
+// Initialize an empty tally of n-trit vectors without allocating.
+void tritvote_init(tritvote_t *v, size_t n);
+
+// Release everything and reset to empty (n is kept).
+void tritvote_free(tritvote_t *v);
+
+// Set every count to zero, keeping the storage.
+void tritvote_clear(tritvote_t *v);
+
+//--- Adding (src/tritvote.c) ---
+// Each returns false on allocation failure, or if the tally would pass
+// TRITVOTE_MAX_VOTES vectors.
+
+// Add count vectors of TRIT64B_COUNT(n) planes each, back to back.
+bool tritvote_add_t64b(tritvote_t *v, const trit64b_t *vecs, size_t count);
+
+// Add count vectors as t5b1 rows of TRIT5_PACKED_SIZE(n) bytes each.
+bool tritvote_add_t5(tritvote_t *v, const uint8_t *rows, size_t count);
+
+// The same split across up to `threads` threads, started and joined
+// inside the call (0 or 1: the caller only): each thread tallies a slice
+// of the vectors, and the slices are merged into v. Counts equal the
+// calls above.
+bool tritvote_add_t64b_mt(tritvote_t *v, const trit64b_t *vecs, size_t count,
+                          unsigned threads);
+bool tritvote_add_t5_mt(tritvote_t *v, const uint8_t *rows, size_t count, unsigned threads);
+
+// Add src's tally to dst (same n). src is unchanged.
+bool tritvote_merge(tritvote_t *dst, const tritvote_t *src);
+
+//--- Verdicts (src/tritvote.c) ---
+// Each writes TRIT64B_COUNT(n) vectors; lanes past n are 0. With no
+// votes every position is 0.
+
+// out[i] = sign(P - N): the more common non-zero value, 0 on a tie.
+void tritvote_majority(const tritvote_t *v, trit64b_t *out);
+
+// out[i] = +1 if all V vectors hold the same non-zero value at i, 0 if
+// any holds 0, else -1.
+void tritvote_consensus(const tritvote_t *v, trit64b_t *out);
+
+//--- Counts (src/tritvote.c) ---
+
+// pos[i] = P and neg[i] = N at each of the n positions.
+void tritvote_counts(const tritvote_t *v, uint32_t *pos, uint32_t *neg);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: This header declares the interface. Functions implemented in
+// src/tritvote.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── Lifetime: tritvote_init, tritvote_free, tritvote_clear
+//   ├── Adding:   tritvote_add_t64b, tritvote_add_t5, tritvote_merge,
+//   │             tritvote_add_t64b_mt, tritvote_add_t5_mt
+//   ├── Verdicts: tritvote_majority, tritvote_consensus
+//   └── Counts:   tritvote_counts
+//
+// Declared Units:
+// - 1 type (tritvote_t)
+// - 1 #define constant
+// - 11 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Strategy: Return safe defaults rather than error codes.
+//   - Allocation failure or too many votes → false, tally unchanged
+//   - count = 0 → nothing added, true
+//   Vectors must be valid (no lane set in both planes, lanes past n
+//   zero), as trit5_to_trit64b_array and tritmat_pack_t64b produce;
+//   rows must be valid t5b1 bytes (0-242).
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "tritvote.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-tritvote   Benchmark: make bench-tritvote
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// Every initialized tritvote_t must be released with tritvote_free.
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Group and block sizes in tritvote.c (re-run make bench-tritvote)
+//   ✅ Add verdicts (bitsliced compares over the counter planes)
+//
+// Modify with Care:
+//   ⚠️ Counter layout - merge and every verdict read it directly
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_TRITVOTE_H)
+//   ❌ Counts are exact: no saturation at any number of votes
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Adding reads each vector once (2 bits per trit) and touches the
+// counters once per 15 vectors; for vectors up to a few thousand trits
+// the counters stay in L1. t5b1 rows pay a conversion to planes first.
+// Verdicts cost O(bits) word operations per 64 positions; counts are
+// extracted per position and are the slowest read.
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   tritvote_t v;
+//   tritvote_init(&v, 1024);
+//   tritvote_add_t5(&v, rows, 500);          // 500 × TRIT5_PACKED_SIZE(1024)
+//   trit64b_t maj[TRIT64B_COUNT(1024)];
+//   tritvote_majority(&v, maj);
+//   tritvote_free(&v);
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_TRITVOTE_H
@@ -0,0 +1,258 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Variable-Length Balanced-Ternary Integers
+// Key: B-word-work-pkg-trit-include-vartrit
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//   Depends on trit.h for the t5b1 byte range and spare states
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: word/scripture/web-variant-index.adoc (spare states 243-255)
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_VARTRIT_H
+#define BERESHIT_VARTRIT_H
+
+// Signed integers in balanced base 243: t5b1 bytes for the low groups,
+// one spare-state byte to end each value.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Let your communication be, Yea, yea; Nay, nay: for
+//            whatsoever is more than these cometh of evil." — Matthew 5:37
+//
+// Principle: A small value takes a small space, and says where it ends.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Serialize signed integers (deltas, IDs) in as many bytes as
+//       their size needs.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Encode and decode vartrit values, singly and in arrays.
+//
+// Core Design: Low groups are plain t5b1 bytes (0-242); the last byte
+//   is a spare state (243-255) holding a top digit -6..+6. Signs need no
+//   zig-zag, and value boundaries are the bytes >= 243.
+//
+// Key Features:
+//
+//   - |v| <= 6 in 1 byte, <= 1579 in 2, <= 383818 in 3
+//   - Self-delimiting values that concatenate
+//   - Bulk decode finds boundaries by vector compare
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: via trit.h (stdint.h, stdbool.h, stddef.h)
+//   - Internal: trit.h (TRIT5_STATES)
+//
+// What Uses This:
+//
+//   - tritcol.h (column payloads)
+//
+// # Usage & Integration
+//
+// Import:
+//
+//    #include "vartrit.h"
+//
+// Integration Pattern:
+//
+//  1. trit_vartrit_encode_i64(values, n, out) into n·TRIT_VARTRIT_MAX64
+//  2. trit_vartrit_count for the values a buffer holds
+//  3. trit_vartrit_decode_i64(in, len, out, n)
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: Reentrant. Buffers encoded on different threads
+//   concatenate; one buffer decodes front to back.
+//
+// Memory: None allocated.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+//
+// Section order: Includes → Defines → Function Prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"    // TRIT5_STATES
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+//--- Variable-Length Integers ---
+// Longest vartrit form of an int32 / int64 (bytes), and the result of a
+// malformed decode.
+
+#define TRIT_VARTRIT_MAX32   5
+#define TRIT_VARTRIT_MAX64   9
+#define TRIT_VARTRIT_ERROR   SIZE_MAX
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+//--- Variable-Length Integers (src/vartrit.c) ---
+// Signed integers in balanced base 243, low group first: plain t5b1
+// bytes (0-242), then one spare-state terminator (243-255) holding a top
+// digit -6..+6. |v| <= 6 takes 1 byte, |v| <= 1579 2, |v| <= 383818 3;
+// no zig-zag mapping. Values are self-delimiting and concatenate.
+
+// Write v in its shortest form (out: TRIT_VARTRIT_MAX64 bytes); returns
+// bytes written.
+size_t trit_vartrit_encode(int64_t v, uint8_t *out);
+
+// Bytes trit_vartrit_encode writes for v (1 to TRIT_VARTRIT_MAX64).
+size_t trit_vartrit_size(int64_t v);
+
+// Write n values back to back (out: n · TRIT_VARTRIT_MAX32 / _MAX64
+// bytes); returns bytes written.
+size_t trit_vartrit_encode_i32(const int32_t *in, size_t n, uint8_t *out);
+size_t trit_vartrit_encode_i64(const int64_t *in, size_t n, uint8_t *out);
+
+// Read the first value of in; returns bytes consumed, or
+// TRIT_VARTRIT_ERROR if it is cut short, too long or overflows.
+size_t trit_vartrit_decode(const uint8_t *in, size_t len, int64_t *v);
+
+// Read n values; returns bytes consumed, or TRIT_VARTRIT_ERROR if in
+// ends first or a value is too long or out of range for the type.
+size_t trit_vartrit_decode_i32(const uint8_t *in, size_t len, int32_t *out, size_t n);
+size_t trit_vartrit_decode_i64(const uint8_t *in, size_t len, int64_t *out, size_t n);
+
+// Terminators in len bytes: the values a well-formed buffer holds.
+size_t trit_vartrit_count(const uint8_t *in, size_t len);
+
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// NOTE: This header declares the interface. Functions implemented in
+// src/vartrit.c.
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Declared Interface Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── Encode: trit_vartrit_encode, trit_vartrit_size,
+//   │           trit_vartrit_encode_i32, trit_vartrit_encode_i64
+//   └── Decode: trit_vartrit_decode, trit_vartrit_decode_i32,
+//               trit_vartrit_decode_i64, trit_vartrit_count
+//
+// Declared Units:
+// - 3 #define constants
+// - 8 function prototypes
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations
+// ────────────────────────────────────────────────────────────────
+//
+//   - trit_vartrit_encode*: balanced remainder mod 243 per group (the
+//     division is a multiply), top digit into the terminator
+//   - trit_vartrit_decode_*: bytes >= 243 marked 64 at a time; ctz gives
+//     each value's length, Horner over its groups
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling
+// ────────────────────────────────────────────────────────────────
+//
+// Strategy: Return an error value rather than read past a buffer.
+//   - trit_vartrit_decode*(cut short, overlong, out of range) →
+//     TRIT_VARTRIT_ERROR
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Build Verification:
+//   echo '#include "vartrit.h"' | gcc -x c -fsyntax-only -std=c99 -I. -
+//
+// Testing: make test-vartrit   Benchmark: make bench-vartrit
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ More bulk forms (other integer widths)
+//
+// Never Modify:
+//   ❌ 4-block structure
+//   ❌ Include guard (BERESHIT_VARTRIT_H)
+//   ❌ Byte format - values are stored
+
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Encoding is a multiply per group; bulk decoding finds 64 boundaries
+// per compare and then sums each value's few groups.
+
+// ────────────────────────────────────────────────────────────────
+// Quick Reference
+// ────────────────────────────────────────────────────────────────
+//
+//   uint8_t buf[TRIT_VARTRIT_MAX64];
+//   size_t len = trit_vartrit_encode(-42, buf);
+//   int64_t v;
+//   trit_vartrit_decode(buf, len, &v);
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_VARTRIT_H
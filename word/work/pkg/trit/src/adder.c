@@ -0,0 +1,448 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// adder.c - Multi-Trit Adders (full adder, ripple, carry-lookahead)
+// Key: B-word-work-pkg-trit-src-adder
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Full Adder]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Real multi-trit addition with carry: the 27-entry full adder, a ripple
+// adder over trit arrays, and a parallel-prefix adder over bitsliced words.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Bear ye one another's burdens, and so fulfil the law of
+//            Christ." — Galatians 6:2
+//
+// Principle: Every position hands its carry to the next. Carry-lookahead
+//            works out the whole chain of burdens before anyone asks.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Multi-trit addition (trit_add in trit.c is the clamped no-carry
+//       table; this is the adder the research doc specifies).
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Add n-trit balanced ternary numbers with carry-in and carry-out.
+//
+// Core Design:
+//   - trit_full_add: FULL_ADDER tables, 27 entries (research doc table)
+//   - trit_ripple_add: trit arrays, MST-first like pack.c, carry from the
+//     last element (least significant) toward element 0
+//   - trit64b_add_carry: one trit64b_t is one number, lane i has weight
+//     3^i. Carries come from a Kogge-Stone prefix over carry maps, so a
+//     width-n add takes ceil(log2 n) levels (5 for int27, 6 for 64 trits)
+//     instead of an n-step ripple.
+//
+// Carry maps: with s = a_i + b_i, the carry out of lane i is a function
+// of the carry into it: f_s(c) = carry(s + c). Every f_s - and every
+// composition of them - is one of 7 monotone maps {-1,0,+1} → {-1,0,+1},
+// stored as its three outputs (lo = f(-1), mid = f(0), hi = f(+1)), each
+// a bitsliced trit. Composing two maps is three 3-way multiplexers.
+//
+// Key Features:
+//   - Wrap semantics match arith.c: dropping carry_out is addition mod 3^n
+//   - trit64b_from_trit27/to_trit27 move int27 values into adder lanes
+//
+// Philosophy: Only T+T and 1+1 carry - but a carry can still cross every
+//             trit. Resolve the chain in log time, not linear time.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Internal: trit.h (trit_t, trit27_t, trit64b_t)
+//   - Internal: table.c (trit27_unpack_table for lane loading)
+//
+// What Uses This:
+//   - Callers adding unpacked or bitsliced multi-trit integers
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// [OMIT: Pure functions - no state, no blocking]
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"    // trit_t, trit27_t, trit64b_t
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define TRIT27_TRITS 27   // lanes used by trit64b_from_trit27
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// carry_map_t is a carry transfer function for 64 lanes at once.
+// lo/mid/hi hold, per lane, the carry out when the carry in is -1/0/+1.
+typedef struct {
+    trit64b_t lo;
+    trit64b_t mid;
+    trit64b_t hi;
+} carry_map_t;
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Full adder from ternary-arithmetic-algorithms.adoc [Full Adder]:
+// FULL_ADDER_SUM/CARRY[a + 1][b + 1][carry_in + 1]
+static const trit_t FULL_ADDER_SUM[3][3][3] = {
+    { {  0,  1, -1 }, {  1, -1,  0 }, { -1,  0,  1 } },  // a = T
+    { {  1, -1,  0 }, { -1,  0,  1 }, {  0,  1, -1 } },  // a = 0
+    { { -1,  0,  1 }, {  0,  1, -1 }, {  1, -1,  0 } }   // a = 1
+};
+
+static const trit_t FULL_ADDER_CARRY[3][3][3] = {
+    { { -1, -1,  0 }, { -1,  0,  0 }, {  0,  0,  0 } },  // a = T
+    { { -1,  0,  0 }, {  0,  0,  0 }, {  0,  0,  1 } },  // a = 0
+    { {  0,  0,  0 }, {  0,  0,  1 }, {  0,  1,  1 } }   // a = 1
+};
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Internal helpers
+static trit64b_t lane_mask(unsigned width);
+static trit64b_t sum_mod3(trit64b_t x, trit64b_t y);
+static trit64b_t map_apply(const carry_map_t *g, const carry_map_t *d, trit64b_t c);
+static trit64b_t map_select(const carry_map_t *m, trit_t c);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── trit_full_add()       → FULL_ADDER_SUM / FULL_ADDER_CARRY
+//   ├── trit_ripple_add()     → trit_full_add() per position
+//   ├── trit64b_add_carry()   → lane carry maps
+//   │                           → log2(width) × map_apply() (Kogge-Stone)
+//   │                           → map_select() + sum_mod3()
+//   ├── trit64b_from_trit27() → trit27_unpack_table() + lane scatter
+//   └── trit64b_to_trit27()   → Horner over lanes 26..0
+//
+//   Helpers
+//   ├── lane_mask()  → lanes 0..width-1
+//   ├── sum_mod3()   → lane-wise (x + y) wrapped to one trit
+//   ├── map_apply()  → lane-wise g(c) for a bitsliced trit c
+//   └── map_select() → one output plane of a map for a scalar carry
+
+// ────────────────────────────────────────────────────────────────
+// Helpers/Utilities - Internal Support
+// ────────────────────────────────────────────────────────────────
+
+// lane_mask returns a vector with lanes 0..width-1 set in both planes.
+static trit64b_t lane_mask(unsigned width) {
+    uint64_t m = (width >= 64) ? ~(uint64_t)0 : (((uint64_t)1 << width) - 1);
+    trit64b_t r = { m, m };
+    return r;
+}
+
+// sum_mod3 adds two bitsliced trits lane-wise and keeps the low trit:
+// +2 → -1, -2 → +1 (the sum column of the no-carry-in half adder).
+static trit64b_t sum_mod3(trit64b_t x, trit64b_t y) {
+    uint64_t xz = ~(x.pos | x.neg);
+    uint64_t yz = ~(y.pos | y.neg);
+    trit64b_t r;
+    r.pos = (x.pos & yz) | (y.pos & xz) | (x.neg & y.neg);
+    r.neg = (x.neg & yz) | (y.neg & xz) | (x.pos & y.pos);
+    return r;
+}
+
+// map_apply evaluates carry map g at a per-lane carry c: a 3-way mux that
+// picks g.lo where c = -1, g.mid where c = 0 and g.hi where c = +1.
+//
+// c.neg and c.pos are disjoint, so the mux is mid ^ (neg & (lo ^ mid)) ^
+// (pos & (hi ^ mid)); the caller passes the two XOR differences in d so
+// three evaluations of one map share them.
+static trit64b_t map_apply(const carry_map_t *g, const carry_map_t *d, trit64b_t c) {
+    trit64b_t r;
+    r.pos = g->mid.pos ^ (c.neg & d->lo.pos) ^ (c.pos & d->hi.pos);
+    r.neg = g->mid.neg ^ (c.neg & d->lo.neg) ^ (c.pos & d->hi.neg);
+    return r;
+}
+
+// map_select returns the plane of map m for one carry value shared by
+// all lanes.
+static trit64b_t map_select(const carry_map_t *m, trit_t c) {
+    if (c < 0) return m->lo;
+    if (c > 0) return m->hi;
+    return m->mid;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+//--- Single-Position Full Adder ---
+
+// trit_full_add adds two trits and an incoming carry.
+//
+// Uses the 27-entry full adder table: a + b + carry_in = 3·carry_out + sum.
+//
+// Parameters:
+//   a, b      - trits to add (-1, 0, +1)
+//   carry_in  - carry from the next less significant position
+//   carry_out - receives the carry to the next more significant position
+//               (may be NULL)
+//
+// Returns: sum trit
+trit_t trit_full_add(trit_t a, trit_t b, trit_t carry_in, trit_t *carry_out) {
+    unsigned ia = TRIT_TO_UNSIGNED(a);
+    unsigned ib = TRIT_TO_UNSIGNED(b);
+    unsigned ic = TRIT_TO_UNSIGNED(carry_in);
+    if (carry_out) {
+        *carry_out = FULL_ADDER_CARRY[ia][ib][ic];
+    }
+    return FULL_ADDER_SUM[ia][ib][ic];
+}
+
+//--- Trit Arrays (ripple carry) ---
+
+// trit_ripple_add adds two n-trit numbers stored MST-first.
+//
+// Same order as pack.c: element 0 is the most significant trit, so the
+// carry ripples from element n-1 toward element 0. out may alias a or b.
+//
+// Parameters:
+//   a, b     - n trits each (MST-first)
+//   n        - number of trits
+//   carry_in - carry into the least significant position
+//   out      - receives n sum trits (MST-first)
+//
+// Returns: carry out of the most significant position (carry_in when n = 0)
+trit_t trit_ripple_add(const trit_t *a, const trit_t *b, size_t n,
+                       trit_t carry_in, trit_t *out) {
+    trit_t carry = carry_in;
+    for (size_t i = n; i-- > 0;) {
+        out[i] = trit_full_add(a[i], b[i], carry, &carry);
+    }
+    return carry;
+}
+
+//--- Bitsliced Words (carry-lookahead) ---
+
+// trit64b_add_carry adds two width-trit numbers held in bitsliced words.
+//
+// Lane i carries weight 3^i. The carry network is a Kogge-Stone prefix
+// over carry maps: after level k each lane holds the map of the 2^k lanes
+// ending at it, so ceil(log2 width) levels resolve every carry.
+//
+// Parameters:
+//   a, b      - addends in lanes 0..width-1 (higher lanes ignored)
+//   width     - trits per number (clamped to 64)
+//   carry_in  - carry into lane 0
+//   carry_out - receives the carry out of lane width-1 (may be NULL)
+//
+// Returns: sum in lanes 0..width-1, higher lanes zero
+trit64b_t trit64b_add_carry(trit64b_t a, trit64b_t b, unsigned width,
+                            trit_t carry_in, trit_t *carry_out) {
+    if (width > 64) {
+        width = 64;
+    }
+    trit64b_t zero = { 0, 0 };
+    if (width == 0) {
+        if (carry_out) {
+            *carry_out = carry_in;
+        }
+        return zero;
+    }
+
+    trit64b_t mask = lane_mask(width);
+    a.pos &= mask.pos; a.neg &= mask.neg;
+    b.pos &= mask.pos; b.neg &= mask.neg;
+
+    // Lane map for s = a + b: f(-1) = -1 iff s ≤ -1, f(0) = sign if |s| = 2,
+    // f(+1) = +1 iff s ≥ 1
+    carry_map_t m;
+    m.lo.pos = 0;
+    m.lo.neg = (a.neg & ~b.pos) | (b.neg & ~a.pos);
+    m.mid.pos = a.pos & b.pos;
+    m.mid.neg = a.neg & b.neg;
+    m.hi.pos = (a.pos & ~b.neg) | (b.pos & ~a.neg);
+    m.hi.neg = 0;
+
+    // Kogge-Stone: lane i composes its map after the map d lanes below.
+    // Lanes below d see the identity map (lo = -1, mid = 0, hi = +1).
+    for (unsigned d = 1; d < width; d <<= 1) {
+        uint64_t low = ((uint64_t)1 << d) - 1;
+        carry_map_t f;
+        f.lo.pos = m.lo.pos << d;
+        f.lo.neg = (m.lo.neg << d) | low;
+        f.mid.pos = m.mid.pos << d;
+        f.mid.neg = m.mid.neg << d;
+        f.hi.pos = (m.hi.pos << d) | low;
+        f.hi.neg = m.hi.neg << d;
+
+        carry_map_t g = m;
+        carry_map_t diff;
+        diff.lo.pos = g.lo.pos ^ g.mid.pos;
+        diff.lo.neg = g.lo.neg ^ g.mid.neg;
+        diff.hi.pos = g.hi.pos ^ g.mid.pos;
+        diff.hi.neg = g.hi.neg ^ g.mid.neg;
+        m.lo = map_apply(&g, &diff, f.lo);
+        m.mid = map_apply(&g, &diff, f.mid);
+        m.hi = map_apply(&g, &diff, f.hi);
+    }
+
+    // Lane i receives the prefix map of lanes 0..i-1 applied to carry_in
+    trit64b_t prefix = map_select(&m, carry_in);
+    trit64b_t carries;
+    carries.pos = (prefix.pos << 1) | (uint64_t)(carry_in > 0);
+    carries.neg = (prefix.neg << 1) | (uint64_t)(carry_in < 0);
+
+    if (carry_out) {
+        *carry_out = trit64b_get(prefix, width - 1);
+    }
+
+    trit64b_t sum = sum_mod3(sum_mod3(a, b), carries);
+    sum.pos &= mask.pos;
+    sum.neg &= mask.neg;
+    return sum;
+}
+
+// trit64b_from_trit27 loads a packed int27 into lanes 0..26 (lane i = 3^i).
+trit64b_t trit64b_from_trit27(trit27_t value) {
+    trit_t trits[TRIT27_TRITS];
+    trit27_unpack_table(value, trits);
+    trit64b_t r = { 0, 0 };
+    for (unsigned i = 0; i < TRIT27_TRITS; i++) {
+        trit_t t = trits[TRIT27_TRITS - 1 - i];   // MST-first → lane weight
+        r.pos |= (uint64_t)(t > 0) << i;
+        r.neg |= (uint64_t)(t < 0) << i;
+    }
+    return r;
+}
+
+// trit64b_to_trit27 packs lanes 0..26 back into an int27 word.
+// Lanes 27-63 are ignored.
+trit27_t trit64b_to_trit27(trit64b_t v) {
+    trit27_t r = 0;
+    for (unsigned i = TRIT27_TRITS; i-- > 0;) {
+        unsigned digit = 1u + (unsigned)((v.pos >> i) & 1u) - (unsigned)((v.neg >> i) & 1u);
+        r = r * 3u + digit;
+    }
+    return r;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-adder   # full adder table, ripple vs int arithmetic,
+//                     # lookahead vs ripple at every width
+//
+// Benchmark:
+//   make bench-adder  # ripple vs lookahead vs packed trit27_add
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// [OMIT: Pure functions - nothing to release.]
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Other prefix networks (Brent-Kung, Sklansky) - same carry maps
+//   ✅ Multi-word adds by chaining carry_out → carry_in
+//
+// Modify with Extreme Care:
+//   ⚠️ FULL_ADDER tables - must match the research doc row for row
+//   ⚠️ Identity fill in the Kogge-Stone shift (lanes below d)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Lane i = weight 3^i for trit64b_add_carry
+//   ❌ MST-first order for trit_ripple_add (shared with pack.c)
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// trit64b_add_carry: ~20 bit ops for lane maps and sums, plus ~36 per
+// prefix level. A ripple over the same word is ~10 dependent ops per lane.
+// The packed trit27_add is still cheaper for one number; the bitsliced
+// adder pays off when operands already live in planes (bitslice.c data).
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Bear ye one another's burdens." — Galatians 6:2
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
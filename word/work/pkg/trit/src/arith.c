@@ -0,0 +1,371 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// arith.c - Packed-Domain Integer Arithmetic (int5, int9, int27)
+// Key: B-word-work-pkg-trit-src-arith
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/core/primitives.toml [int9], [int27]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Signed arithmetic directly on packed trit5/trit9/trit27 values - no
+// unpacking, no per-trit loops.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "A false balance is abomination to the LORD: but a just weight
+//            is his delight." — Proverbs 11:1
+//
+// Principle: The bias is the balance point. Keep it exact and every sum,
+//            difference and comparison weighs true without unpacking.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Makes int9/int27 from primitives.toml real integer types over the
+//       existing packed encodings.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: add, sub, neg, cmp and integer conversion for packed values.
+//
+// Core Design: Horner packing of (trit + 1) digits is biased unsigned:
+//     packed = value + BIAS,  BIAS = (3^n - 1) / 2
+//   so the packed integer is an order-preserving image of the signed value.
+//   - neg:  packed' = MAX - packed          (1 subtraction, never overflows)
+//   - cmp:  compare packed integers          (bias cancels)
+//   - add:  a + b - BIAS, wrapped into [0, MAX] modulo 3^n
+//   - sub:  a + neg(b)
+// Overflow wraps modulo 3^n - exactly what an n-trit ripple adder does
+// when it drops its final carry - and is reported through an optional
+// bool *overflow.
+//
+// Key Features:
+//   - trit27_*: int27 (-3,812,798,742,493 .. +3,812,798,742,493)
+//   - trit9_*:  int9  (-9,841 .. +9,841)
+//   - trit5_*:  int5  (-121 .. +121)
+//
+// Philosophy: The encoding already is the number. Use it as one.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Internal: trit.h (packed types, *_STATES, *_BIAS)
+//
+// What Uses This:
+//   - Callers treating packed words as integers (int9/int27)
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// [OMIT: Pure functions - no state, no blocking]
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"    // packed types, state counts, biases
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+// [Reserved: All constants defined in trit.h]
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Internal helpers
+static uint64_t packed_add(uint64_t a, uint64_t b, uint64_t states, bool *overflow);
+static uint64_t packed_from_int(int64_t value, uint64_t states, bool *overflow);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (per width: trit5_, trit9_, trit27_)
+//   ├── *_add()      → packed_add()
+//   ├── *_sub()      → *_neg() + packed_add()
+//   ├── *_neg()      → MAX - packed
+//   ├── *_cmp()      → integer compare
+//   ├── *_to_int*()  → packed - BIAS
+//   └── *_from_int*() → packed_from_int()
+//
+//   Helpers
+//   ├── packed_add()      → biased sum, wrapped modulo states
+//   └── packed_from_int() → centered remainder modulo states, + BIAS
+
+// ────────────────────────────────────────────────────────────────
+// Helpers/Utilities - Internal Support
+// ────────────────────────────────────────────────────────────────
+
+// packed_add adds two biased values of one width and re-biases the sum.
+//
+// a + b carries two biases; removing one gives the packed result when it
+// lands in [0, states). Below that range the true sum was < -BIAS, above it
+// > +BIAS: one step of ±states wraps it back (|a+b| ≤ 2·BIAS < states).
+//
+// Parameters:
+//   a, b     - packed values in [0, states)
+//   states   - 3^n (odd), BIAS = (states - 1) / 2
+//   overflow - set to whether the result wrapped (may be NULL)
+//
+// Returns: packed (a + b) modulo 3^n, centered
+static uint64_t packed_add(uint64_t a, uint64_t b, uint64_t states, bool *overflow) {
+    uint64_t bias = states / 2;
+    uint64_t sum = a + b;
+    // Branch-free: random operands wrap often enough to defeat prediction
+    uint64_t under = (uint64_t)(sum < bias);
+    uint64_t r = sum - bias + (states & (0 - under));
+    uint64_t over = (uint64_t)(r >= states);
+    r -= states & (0 - over);
+    if (overflow) {
+        *overflow = (under | over) != 0;
+    }
+    return r;
+}
+
+// packed_from_int encodes a signed value, wrapping out-of-range values.
+//
+// Values inside [-BIAS, +BIAS] encode exactly. Others reduce to the
+// centered remainder modulo states (the low n balanced trits of the value)
+// and report overflow.
+static uint64_t packed_from_int(int64_t value, uint64_t states, bool *overflow) {
+    int64_t bias = (int64_t)(states / 2);
+    bool wrapped = false;
+    if (value > bias || value < -bias) {
+        int64_t m = value % (int64_t)states;     // (-states, states)
+        if (m > bias) m -= (int64_t)states;
+        if (m < -bias) m += (int64_t)states;
+        value = m;
+        wrapped = true;
+    }
+    if (overflow) {
+        *overflow = wrapped;
+    }
+    return (uint64_t)(value + bias);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+//--- int27 (trit27_t) ---
+
+// trit27_add adds two packed int27 values.
+//
+// Parameters:
+//   a, b     - packed values (0 to TRIT27_MAX)
+//   overflow - set true if the sum left the int27 range and wrapped (may be NULL)
+//
+// Returns: packed (a + b), wrapped modulo 3^27
+trit27_t trit27_add(trit27_t a, trit27_t b, bool *overflow) {
+    return packed_add(a, b, TRIT27_STATES, overflow);
+}
+
+// trit27_sub subtracts two packed int27 values: a + (-b).
+trit27_t trit27_sub(trit27_t a, trit27_t b, bool *overflow) {
+    return packed_add(a, TRIT27_MAX - b, TRIT27_STATES, overflow);
+}
+
+// trit27_neg negates a packed int27 value (flips every trit). Never overflows.
+trit27_t trit27_neg(trit27_t a) {
+    return TRIT27_MAX - a;
+}
+
+// trit27_cmp compares two packed int27 values.
+//
+// Returns: -1 if a < b, 0 if equal, +1 if a > b (as signed values)
+int trit27_cmp(trit27_t a, trit27_t b) {
+    return (a > b) - (a < b);
+}
+
+// trit27_to_int64 decodes a packed int27 to its signed value.
+int64_t trit27_to_int64(trit27_t a) {
+    return (int64_t)a - (int64_t)TRIT27_BIAS;
+}
+
+// trit27_from_int64 encodes a signed value as packed int27.
+//
+// Values outside ±TRIT27_BIAS keep their low 27 balanced trits (wrap
+// modulo 3^27) and set *overflow (may be NULL).
+trit27_t trit27_from_int64(int64_t value, bool *overflow) {
+    return packed_from_int(value, TRIT27_STATES, overflow);
+}
+
+//--- int9 (trit9_t) ---
+
+// trit9_add adds two packed int9 values, wrapping modulo 3^9.
+trit9_t trit9_add(trit9_t a, trit9_t b, bool *overflow) {
+    return (trit9_t)packed_add(a, b, TRIT9_STATES, overflow);
+}
+
+// trit9_sub subtracts two packed int9 values, wrapping modulo 3^9.
+trit9_t trit9_sub(trit9_t a, trit9_t b, bool *overflow) {
+    return (trit9_t)packed_add(a, (uint64_t)(TRIT9_MAX - b), TRIT9_STATES, overflow);
+}
+
+// trit9_neg negates a packed int9 value. Never overflows.
+trit9_t trit9_neg(trit9_t a) {
+    return (trit9_t)(TRIT9_MAX - a);
+}
+
+// trit9_cmp compares two packed int9 values (-1, 0, +1).
+int trit9_cmp(trit9_t a, trit9_t b) {
+    return (a > b) - (a < b);
+}
+
+// trit9_to_int decodes a packed int9 to its signed value.
+int trit9_to_int(trit9_t a) {
+    return (int)a - TRIT9_BIAS;
+}
+
+// trit9_from_int encodes a signed value as packed int9, wrapping out of
+// range values modulo 3^9 and setting *overflow (may be NULL).
+trit9_t trit9_from_int(int value, bool *overflow) {
+    return (trit9_t)packed_from_int(value, TRIT9_STATES, overflow);
+}
+
+//--- int5 (trit5_t) ---
+
+// trit5_add adds two packed int5 values, wrapping modulo 3^5.
+//
+// Note: Spare states (243-255) are not integers; results are undefined.
+trit5_t trit5_add(trit5_t a, trit5_t b, bool *overflow) {
+    return (trit5_t)packed_add(a, b, TRIT5_STATES, overflow);
+}
+
+// trit5_sub subtracts two packed int5 values, wrapping modulo 3^5.
+trit5_t trit5_sub(trit5_t a, trit5_t b, bool *overflow) {
+    return (trit5_t)packed_add(a, (uint64_t)(TRIT5_MAX - b), TRIT5_STATES, overflow);
+}
+
+// trit5_neg negates a packed int5 value. Never overflows.
+trit5_t trit5_neg(trit5_t a) {
+    return (trit5_t)(TRIT5_MAX - a);
+}
+
+// trit5_cmp compares two packed int5 values (-1, 0, +1).
+int trit5_cmp(trit5_t a, trit5_t b) {
+    return (a > b) - (a < b);
+}
+
+// trit5_to_int decodes a packed int5 to its signed value.
+int trit5_to_int(trit5_t a) {
+    return (int)a - TRIT5_BIAS;
+}
+
+// trit5_from_int encodes a signed value as packed int5, wrapping out of
+// range values modulo 3^5 and setting *overflow (may be NULL).
+trit5_t trit5_from_int(int value, bool *overflow) {
+    return (trit5_t)packed_from_int(value, TRIT5_STATES, overflow);
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-arith   # int5 exhaustive, int9/int27 vs int64 reference
+//
+// Benchmark:
+//   make bench-arith  # packed add vs unpack + per-trit ripple + repack
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// [OMIT: Pure functions - nothing to release.]
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add widths (trit40 needs 128-bit sums - not a drop-in)
+//   ✅ Add operations that stay in the packed domain
+//
+// Modify with Extreme Care:
+//   ⚠️ Wrap semantics - must stay "drop the carry out of trit n"
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ packed = value + BIAS (shared with pack.c Horner encoding)
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// add/sub: one add, one compare-subtract pair. neg/cmp/convert: one op.
+// trit27 sums stay below 2^45 - no 64-bit overflow anywhere.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "A just weight is his delight." — Proverbs 11:1
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,529 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// array.c - Element-Wise Trit Array Kernels
+// Key: B-word-work-pkg-trit-src-array
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h, dimension.h)
+//   Without TRIT_X86_SIMD (simd_internal.h) every backend runs the
+//   scalar loops.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Single-Trit Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Bulk trit_negate / trit_add / trit_multiply / trit_navigate over trit_t
+// arrays - 16, 32 or 64 trits per instruction on the active backend.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "And the whole multitude of them that believed were of one
+//            heart and of one soul." — Acts 4:32
+//
+// Principle: Many trits, one operation. What is true of one is done to
+//            all at once.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Array forms of the single-trit operations in trit.c and
+//       dimension.c, for buffers of millions of trit_t.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Element-wise trit operations without a call or table load
+//          per trit.
+//
+// Core Design: A trit_t is an int8_t, so the lookup tables become plain
+//   int8 lane arithmetic with no branches:
+//
+//   negate:    0 - a
+//   add:       clamp(a + b, -1, +1)          (max_epi8 then min_epi8)
+//   multiply:  sign(b, a) = b·sign(a)        (psignb; masks on AVX-512)
+//   navigate:  clamp(a + dir, -1, +1)        (dir broadcast to every lane)
+//
+//   Each public function dispatches on trit_backend_active(), so pinning a
+//   backend with trit_backend_select() covers these kernels too. TABLE
+//   has no element-wise form and runs the scalar kernels.
+//
+// Key Features:
+//   - SSE4.1: 16 trits per instruction, AVX2: 32, AVX-512BW: 64
+//   - out may equal an input (in place); partial overlap is not allowed
+//   - Same results as the per-call functions for every valid trit
+//
+// Philosophy: A table of nine answers is an instruction in disguise.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: string.h (memmove)
+//   - Internal: trit.h (trit_t, backend enum), dimension.h (direction_t),
+//     simd.c (trit_backend_active)
+//   - Compiler: immintrin.h + target attributes (GCC/Clang, x86 only)
+//
+// What Uses This:
+//   - Callers processing trit_t buffers; bench/array_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None. The backend choice lives in simd.c.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <string.h>     // memmove
+
+//--- Project Headers ---
+#include "trit.h"       // trit_t, backend dispatch, prototypes
+#include "dimension.h"  // direction_t, trit_navigate_array
+#include "simd_internal.h" // TRIT_X86_SIMD, intrinsics
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// clamp(s, -1, +1) for s = -3..+3, indexed by s + 3. A load instead of a
+// compare keeps the scalar kernels branch-free on random data.
+static const trit_t CLAMP_TABLE[7] = { -1, -1, -1, 0, 1, 1, 1 };
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static void negate_scalar(const trit_t *a, size_t n, trit_t *out);
+static void add_scalar(const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+static void multiply_scalar(const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+static void shift_scalar(const trit_t *a, size_t n, int d, trit_t *out);
+
+#if TRIT_X86_SIMD
+static void negate_sse41(const trit_t *a, size_t n, trit_t *out);
+static void add_sse41(const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+static void multiply_sse41(const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+static void shift_sse41(const trit_t *a, size_t n, int d, trit_t *out);
+static void negate_avx2(const trit_t *a, size_t n, trit_t *out);
+static void add_avx2(const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+static void multiply_avx2(const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+static void shift_avx2(const trit_t *a, size_t n, int d, trit_t *out);
+static void negate_avx512(const trit_t *a, size_t n, trit_t *out);
+static void add_avx512(const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+static void multiply_avx512(const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+static void shift_avx512(const trit_t *a, size_t n, int d, trit_t *out);
+#endif
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── trit_negate_array()   → negate_{avx512, avx2, sse41, scalar}
+//   ├── trit_add_array()      → add_{...}
+//   ├── trit_multiply_array() → multiply_{...}
+//   └── trit_navigate_array() → shift_{...}, or memmove for DIR_ANCHOR
+//
+//   Kernels (Bottom Rungs): one vector loop each, scalar kernel for the tail
+//
+// Baton Flow:
+//   Entry → trit_backend_active() → kernel → vector steps → scalar tail
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Scalar Kernels (portable reference, vector tails)
+// ────────────────────────────────────────────────────────────────
+
+static void negate_scalar(const trit_t *a, size_t n, trit_t *out) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (trit_t)-a[i];
+    }
+}
+
+static void add_scalar(const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = CLAMP_TABLE[a[i] + b[i] + 3];
+    }
+}
+
+static void multiply_scalar(const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (trit_t)(a[i] * b[i]);
+    }
+}
+
+// shift_scalar adds d (|d| ≤ 2) to every trit and clamps.
+static void shift_scalar(const trit_t *a, size_t n, int d, trit_t *out) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = CLAMP_TABLE[a[i] + d + 3];
+    }
+}
+
+#if TRIT_X86_SIMD
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - SSE4.1 Kernels (16 trits per instruction)
+// ────────────────────────────────────────────────────────────────
+
+__attribute__((target("sse4.1")))
+static void negate_sse41(const trit_t *a, size_t n, trit_t *out) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(const void *)(a + i));
+        _mm_storeu_si128((__m128i *)(void *)(out + i), _mm_sub_epi8(zero, va));
+    }
+    negate_scalar(a + i, n - i, out + i);
+}
+
+__attribute__((target("sse4.1")))
+static void add_sse41(const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    const __m128i lo = _mm_set1_epi8(-1);
+    const __m128i hi = _mm_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(const void *)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(const void *)(b + i));
+        __m128i s = _mm_min_epi8(_mm_max_epi8(_mm_add_epi8(va, vb), lo), hi);
+        _mm_storeu_si128((__m128i *)(void *)(out + i), s);
+    }
+    add_scalar(a + i, b + i, n - i, out + i);
+}
+
+__attribute__((target("sse4.1")))
+static void multiply_sse41(const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(const void *)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(const void *)(b + i));
+        _mm_storeu_si128((__m128i *)(void *)(out + i), _mm_sign_epi8(vb, va));
+    }
+    multiply_scalar(a + i, b + i, n - i, out + i);
+}
+
+__attribute__((target("sse4.1")))
+static void shift_sse41(const trit_t *a, size_t n, int d, trit_t *out) {
+    const __m128i vd = _mm_set1_epi8((char)d);
+    const __m128i lo = _mm_set1_epi8(-1);
+    const __m128i hi = _mm_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(const void *)(a + i));
+        __m128i s = _mm_min_epi8(_mm_max_epi8(_mm_add_epi8(va, vd), lo), hi);
+        _mm_storeu_si128((__m128i *)(void *)(out + i), s);
+    }
+    shift_scalar(a + i, n - i, d, out + i);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - AVX2 Kernels (32 trits per instruction)
+// ────────────────────────────────────────────────────────────────
+
+__attribute__((target("avx2")))
+static void negate_avx2(const trit_t *a, size_t n, trit_t *out) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)(a + i));
+        _mm256_storeu_si256((__m256i *)(void *)(out + i), _mm256_sub_epi8(zero, va));
+    }
+    negate_scalar(a + i, n - i, out + i);
+}
+
+__attribute__((target("avx2")))
+static void add_avx2(const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    const __m256i lo = _mm256_set1_epi8(-1);
+    const __m256i hi = _mm256_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)(b + i));
+        __m256i s = _mm256_min_epi8(_mm256_max_epi8(_mm256_add_epi8(va, vb), lo), hi);
+        _mm256_storeu_si256((__m256i *)(void *)(out + i), s);
+    }
+    add_scalar(a + i, b + i, n - i, out + i);
+}
+
+__attribute__((target("avx2")))
+static void multiply_avx2(const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)(b + i));
+        _mm256_storeu_si256((__m256i *)(void *)(out + i), _mm256_sign_epi8(vb, va));
+    }
+    multiply_scalar(a + i, b + i, n - i, out + i);
+}
+
+__attribute__((target("avx2")))
+static void shift_avx2(const trit_t *a, size_t n, int d, trit_t *out) {
+    const __m256i vd = _mm256_set1_epi8((char)d);
+    const __m256i lo = _mm256_set1_epi8(-1);
+    const __m256i hi = _mm256_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)(a + i));
+        __m256i s = _mm256_min_epi8(_mm256_max_epi8(_mm256_add_epi8(va, vd), lo), hi);
+        _mm256_storeu_si256((__m256i *)(void *)(out + i), s);
+    }
+    shift_scalar(a + i, n - i, d, out + i);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - AVX-512BW Kernels (64 trits per instruction)
+// ────────────────────────────────────────────────────────────────
+
+__attribute__((target("avx512f,avx512bw")))
+static void negate_avx512(const trit_t *a, size_t n, trit_t *out) {
+    const __m512i zero = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m512i va = _mm512_loadu_si512((const void *)(a + i));
+        _mm512_storeu_si512((void *)(out + i), _mm512_sub_epi8(zero, va));
+    }
+    negate_scalar(a + i, n - i, out + i);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static void add_avx512(const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    const __m512i lo = _mm512_set1_epi8(-1);
+    const __m512i hi = _mm512_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m512i va = _mm512_loadu_si512((const void *)(a + i));
+        __m512i vb = _mm512_loadu_si512((const void *)(b + i));
+        __m512i s = _mm512_min_epi8(_mm512_max_epi8(_mm512_add_epi8(va, vb), lo), hi);
+        _mm512_storeu_si512((void *)(out + i), s);
+    }
+    add_scalar(a + i, b + i, n - i, out + i);
+}
+
+// AVX-512 has no psignb: negate b where a < 0 (sign-bit mask), then zero
+// the lanes where a == 0.
+__attribute__((target("avx512f,avx512bw")))
+static void multiply_avx512(const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    const __m512i zero = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m512i va = _mm512_loadu_si512((const void *)(a + i));
+        __m512i vb = _mm512_loadu_si512((const void *)(b + i));
+        __mmask64 neg = _mm512_movepi8_mask(va);
+        __mmask64 nonzero = _mm512_test_epi8_mask(va, va);
+        __m512i p = _mm512_mask_sub_epi8(vb, neg, zero, vb);
+        _mm512_storeu_si512((void *)(out + i), _mm512_maskz_mov_epi8(nonzero, p));
+    }
+    multiply_scalar(a + i, b + i, n - i, out + i);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static void shift_avx512(const trit_t *a, size_t n, int d, trit_t *out) {
+    const __m512i vd = _mm512_set1_epi8((char)d);
+    const __m512i lo = _mm512_set1_epi8(-1);
+    const __m512i hi = _mm512_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m512i va = _mm512_loadu_si512((const void *)(a + i));
+        __m512i s = _mm512_min_epi8(_mm512_max_epi8(_mm512_add_epi8(va, vd), lo), hi);
+        _mm512_storeu_si512((void *)(out + i), s);
+    }
+    shift_scalar(a + i, n - i, d, out + i);
+}
+
+#endif // TRIT_X86_SIMD
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+// trit_negate_array sets out[i] = trit_negate(in[i]).
+//
+// Parameters:
+//   in  - n valid trits
+//   n   - element count
+//   out - n trits (may equal in)
+void trit_negate_array(const trit_t *in, size_t n, trit_t *out) {
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: negate_avx512(in, n, out); return;
+    case TRIT_BACKEND_AVX2:   negate_avx2(in, n, out);   return;
+    case TRIT_BACKEND_SSE41:  negate_sse41(in, n, out);  return;
+#endif
+    default:                  negate_scalar(in, n, out); return;
+    }
+}
+
+// trit_add_array sets out[i] = trit_add(a[i], b[i]) (clamped, no carry).
+//
+// Parameters:
+//   a, b - n valid trits each
+//   n    - element count
+//   out  - n trits (may equal a or b)
+void trit_add_array(const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: add_avx512(a, b, n, out); return;
+    case TRIT_BACKEND_AVX2:   add_avx2(a, b, n, out);   return;
+    case TRIT_BACKEND_SSE41:  add_sse41(a, b, n, out);  return;
+#endif
+    default:                  add_scalar(a, b, n, out); return;
+    }
+}
+
+// trit_multiply_array sets out[i] = trit_multiply(a[i], b[i]).
+//
+// Parameters:
+//   a, b - n valid trits each
+//   n    - element count
+//   out  - n trits (may equal a or b)
+void trit_multiply_array(const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: multiply_avx512(a, b, n, out); return;
+    case TRIT_BACKEND_AVX2:   multiply_avx2(a, b, n, out);   return;
+    case TRIT_BACKEND_SSE41:  multiply_sse41(a, b, n, out);  return;
+#endif
+    default:                  multiply_scalar(a, b, n, out); return;
+    }
+}
+
+// trit_navigate_array sets out[i] = trit_navigate(in[i], dir).
+//
+// DIR_ANCHOR copies. Any other direction adds dir and clamps; values past
+// ±2 move exactly as ±2 would, since the clamp absorbs the rest.
+//
+// Parameters:
+//   in  - n valid trits
+//   n   - element count
+//   dir - direction applied to every element
+//   out - n trits (may equal in)
+void trit_navigate_array(const trit_t *in, size_t n, direction_t dir, trit_t *out) {
+    if (dir == DIR_ANCHOR) {
+        if (out != in) {
+            memmove(out, in, n);
+        }
+        return;
+    }
+    int d = ((int)dir > 2) ? 2 : ((int)dir < -2) ? -2 : (int)dir;
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: shift_avx512(in, n, d, out); return;
+    case TRIT_BACKEND_AVX2:   shift_avx2(in, n, d, out);   return;
+    case TRIT_BACKEND_SSE41:  shift_sse41(in, n, d, out);  return;
+#endif
+    default:                  shift_scalar(in, n, d, out); return;
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// Inputs are assumed valid, as for trit_add/trit_multiply: the scalar
+// kernels index CLAMP_TABLE by the sum, exactly as the per-call functions
+// index their tables by the operands.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-array   # every backend vs the per-call functions, all
+//                     # lengths 0-200 (vector body + tail), in place
+//
+// Benchmark:
+//   make bench-array  # per-call loop vs each backend, 4M trits
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// No allocation, no state.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Unrolling the vector loops (results must not change)
+//   ✅ New element-wise operations (one kernel per backend + dispatch)
+//
+// Modify with Extreme Care:
+//   ⚠️ Clamp order: max then min, with a ±1 bound in each
+//   ⚠️ Navigate's clamp of dir to ±2 (int8 lanes must not wrap)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Results must equal trit_add / trit_multiply / trit_negate /
+//      trit_navigate for every valid input on every backend
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Each kernel is one load per input, two to four ALU ops and one store
+// per vector, so arrays beyond cache run at memory bandwidth.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Of one heart and of one soul." — Acts 4:32
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,474 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// bitslice.c - Bitsliced 64-Lane Trit Vectors (BCT)
+// Key: B-word-work-pkg-trit-src-bitslice
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 2: BCT Parallel]
+// See: word/research/ternary/ternary-conversion-algorithms.adoc [Frieder-Luk]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Frieder-Luk paired-binary trit vectors: 64 trits as two bit-planes, and
+// the logic that runs on all 64 lanes at once.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Two are better than one; because they have a good reward for
+//            their labour." — Ecclesiastes 4:9
+//
+// Principle: Two plain binary words, working together, carry what one
+//            ternary word carries - and each bit operation moves 64 trits.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Data-parallel trit logic - AND/OR/XOR across 64 lanes instead of
+//       one table lookup per trit.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: trit64b_t operations and transcoding to/from trit_t arrays and
+//          t5b1 byte streams.
+//
+// Core Design: Lane i of a trit64b_t is bit i of both planes.
+//   - pos bit set → +1, neg bit set → -1, neither → 0, both → invalid
+//   - Every operation is branch-free bit logic on the two planes
+//   - trit_t arrays: 8 trits per 64-bit load/store (byte-lane gather/spread)
+//   - t5b1 streams: one BCT5_MASKS load per byte, one TRIT5_WEIGHTS pair back
+//
+// Key Features:
+//   - trit64b_negate/add/multiply: same results as trit_negate/add/multiply
+//   - trit64b_and/or: Kleene min/max (negate is Kleene NOT)
+//   - trit64b_from_trits/to_trits, trit5_to_trit64b_array/trit64b_to_trit5_array
+//
+// Philosophy: Same answers as the scalar tables, 64 at a time.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Internal: trit.h
+//
+// What Uses This:
+//   - Bulk trit logic and arithmetic on in-memory vectors
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// [OMIT: Pure functions - no state, no blocking]
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "trit.h"    // trit64b_t, trit5 constants
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+//--- Byte-Lane Constants ---
+// A uint64 read from 8 trit_t bytes holds one trit per byte lane:
+// +1 = 0x01, 0 = 0x00, -1 = 0xFF. Bit 0 of a lane is "nonzero",
+// bit 1 is "negative".
+#define LANE_LSB       0x0101010101010101ULL
+// Multiplier gathering bit 0 of byte i into bit 56+i (no carries)
+#define LANE_GATHER    0x0102040810204080ULL
+// Multiplier spreading bit i (i < 7) into bit 8i (no carries)
+#define LANE_SPREAD    0x0002040810204081ULL
+
+//--- t5b1 Mask Generators ---
+// Digit of v at place value p, balanced (as in table.c)
+#define B_DIGIT(v, p)  (((v) / (p)) % 3 - 1)
+// 5-bit plane mask of byte v: bit j is trit j (MST first), digit == d
+#define B_MASK(v, d)   ((B_DIGIT(v, 81) == (d)) << 0 | (B_DIGIT(v, 27) == (d)) << 1 | \
+                        (B_DIGIT(v, 9) == (d)) << 2 | (B_DIGIT(v, 3) == (d)) << 3 | \
+                        (B_DIGIT(v, 1) == (d)) << 4)
+// Entry: pos mask in bits 0-4, neg mask in bits 8-12
+#define B_ROW(v)       (uint16_t)(B_MASK(v, 1) | B_MASK(v, -1) << 8)
+#define B_ROWS3(v)     B_ROW(v), B_ROW((v) + 1), B_ROW((v) + 2)
+#define B_ROWS9(v)     B_ROWS3(v), B_ROWS3((v) + 3), B_ROWS3((v) + 6)
+#define B_ROWS27(v)    B_ROWS9(v), B_ROWS9((v) + 9), B_ROWS9((v) + 18)
+#define B_ROWS81(v)    B_ROWS27(v), B_ROWS27((v) + 27), B_ROWS27((v) + 54)
+#define B_ROWS243(v)   B_ROWS81(v), B_ROWS81((v) + 81), B_ROWS81((v) + 162)
+
+// Place-value sum of a 5-bit mask (bit j weighs 3^(4-j))
+#define B_WEIGHT(m)    (((m) & 1) * 81 + ((m) >> 1 & 1) * 27 + ((m) >> 2 & 1) * 9 + \
+                        ((m) >> 3 & 1) * 3 + ((m) >> 4 & 1))
+#define B_WEIGHTS4(m)  B_WEIGHT(m), B_WEIGHT((m) + 1), B_WEIGHT((m) + 2), B_WEIGHT((m) + 3)
+#define B_WEIGHTS16(m) B_WEIGHTS4(m), B_WEIGHTS4((m) + 4), B_WEIGHTS4((m) + 8), B_WEIGHTS4((m) + 12)
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// BCT5_MASKS[v]: the 5 trits of byte v as plane masks (pos | neg << 8).
+// Spare bytes 243-255 map to all zero trits.
+static const uint16_t BCT5_MASKS[256] = {
+    B_ROWS243(0)
+};
+
+// TRIT5_WEIGHTS[m]: value a 5-bit plane mask adds to a packed byte.
+// byte = 121 + TRIT5_WEIGHTS[pos5] - TRIT5_WEIGHTS[neg5]
+static const uint8_t TRIT5_WEIGHTS[32] = {
+    B_WEIGHTS16(0), B_WEIGHTS16(16)
+};
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Internal helpers
+static uint64_t load_lanes(const trit_t *in);
+static void store_lanes(trit_t *out, uint64_t lanes);
+static uint64_t lane_mask(size_t n);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── trit64b_valid/get          → plane bits
+//   ├── trit64b_negate/add/multiply/and/or → plane logic
+//   ├── trit64b_from_trits()       → load_lanes() + LANE_GATHER
+//   ├── trit64b_to_trits()         → LANE_SPREAD + store_lanes()
+//   ├── trit5_to_trit64b_array()   → BCT5_MASKS
+//   └── trit64b_to_trit5_array()   → TRIT5_WEIGHTS
+//
+//   Helpers
+//   ├── load_lanes() / store_lanes() → 8 trit_t bytes ↔ uint64 (byte i = lane i)
+//   └── lane_mask()                  → low n bits set
+
+// ────────────────────────────────────────────────────────────────
+// Helpers/Utilities - Internal Support
+// ────────────────────────────────────────────────────────────────
+
+// load_lanes reads 8 trits into a uint64, trit i in byte lane i.
+// Written with shifts so the lane order holds on any byte order; compilers
+// fold it into one load on little-endian targets.
+static uint64_t load_lanes(const trit_t *in) {
+    const uint8_t *b = (const uint8_t *)in;
+    return (uint64_t)b[0] | (uint64_t)b[1] << 8 | (uint64_t)b[2] << 16 |
+           (uint64_t)b[3] << 24 | (uint64_t)b[4] << 32 | (uint64_t)b[5] << 40 |
+           (uint64_t)b[6] << 48 | (uint64_t)b[7] << 56;
+}
+
+// store_lanes writes byte lane i of a uint64 to out[i].
+static void store_lanes(trit_t *out, uint64_t lanes) {
+    uint8_t *b = (uint8_t *)out;
+    for (int i = 0; i < 8; i++) {
+        b[i] = (uint8_t)(lanes >> (8 * i));
+    }
+}
+
+// lane_mask returns a mask of the low n lanes (n ≤ 64).
+static uint64_t lane_mask(size_t n) {
+    return (n >= 64) ? ~0ULL : ((1ULL << n) - 1);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+//--- Lane Access ---
+
+// trit64b_valid checks that no lane is both positive and negative.
+bool trit64b_valid(trit64b_t v) {
+    return (v.pos & v.neg) == 0;
+}
+
+// trit64b_get reads lane i (0-63). Out-of-range lanes read as TRIT_ZERO.
+trit_t trit64b_get(trit64b_t v, unsigned lane) {
+    if (lane >= 64) {
+        return TRIT_ZERO;
+    }
+    return (trit_t)((int)(v.pos >> lane & 1) - (int)(v.neg >> lane & 1));
+}
+
+//--- Lane-Parallel Operations ---
+
+// trit64b_negate flips every lane (also Kleene NOT): swap the planes.
+trit64b_t trit64b_negate(trit64b_t a) {
+    trit64b_t r = { a.neg, a.pos };
+    return r;
+}
+
+// trit64b_add adds lane-wise, clamping like trit_add (no carry).
+//
+// A lane is positive when one side is +1 and the other is not -1:
+// +1 + -1 cancels, +1 + +1 clamps to +1.
+trit64b_t trit64b_add(trit64b_t a, trit64b_t b) {
+    trit64b_t r;
+    r.pos = (a.pos & ~b.neg) | (b.pos & ~a.neg);
+    r.neg = (a.neg & ~b.pos) | (b.neg & ~a.pos);
+    return r;
+}
+
+// trit64b_multiply multiplies lane-wise, as trit_multiply.
+//
+// Like signs give +1, unlike signs give -1, any zero gives 0.
+trit64b_t trit64b_multiply(trit64b_t a, trit64b_t b) {
+    trit64b_t r;
+    r.pos = (a.pos & b.pos) | (a.neg & b.neg);
+    r.neg = (a.pos & b.neg) | (a.neg & b.pos);
+    return r;
+}
+
+// trit64b_and is Kleene AND (lane-wise minimum).
+trit64b_t trit64b_and(trit64b_t a, trit64b_t b) {
+    trit64b_t r = { a.pos & b.pos, a.neg | b.neg };
+    return r;
+}
+
+// trit64b_or is Kleene OR (lane-wise maximum).
+trit64b_t trit64b_or(trit64b_t a, trit64b_t b) {
+    trit64b_t r = { a.pos | b.pos, a.neg & b.neg };
+    return r;
+}
+
+//--- trit_t Arrays ---
+
+// trit64b_from_trits loads up to 64 trits into lanes 0..n-1.
+//
+// Eight trits per step: in each byte lane bit 0 means nonzero and bit 1
+// means negative; one multiply gathers the 8 lane bits into a byte.
+// Lanes n..63 are zero. n > 64 is treated as 64.
+//
+// Parameters:
+//   in - n trit values (-1, 0, +1)
+//   n  - number of trits (0-64)
+//
+// Returns: bitsliced vector
+trit64b_t trit64b_from_trits(const trit_t *in, size_t n) {
+    trit64b_t r = { 0, 0 };
+    if (n > 64) {
+        n = 64;
+    }
+    size_t full = n / 8;
+    for (size_t k = 0; k < full; k++) {
+        uint64_t x = load_lanes(in + 8 * k);
+        uint64_t nonzero = x & LANE_LSB;
+        uint64_t negative = (x >> 1) & LANE_LSB;
+        r.pos |= ((nonzero & ~negative) * LANE_GATHER >> 56) << (8 * k);
+        r.neg |= (negative * LANE_GATHER >> 56) << (8 * k);
+    }
+    for (size_t i = 8 * full; i < n; i++) {
+        r.pos |= (uint64_t)(in[i] == TRIT_POS) << i;
+        r.neg |= (uint64_t)(in[i] == TRIT_NEG) << i;
+    }
+    return r;
+}
+
+// trit64b_to_trits writes lanes 0..n-1 as trit values.
+//
+// Eight lanes per step: one multiply spreads 8 plane bits into byte lanes;
+// negative lanes become 0xFF (-1). n > 64 is treated as 64.
+//
+// Parameters:
+//   v   - bitsliced vector
+//   n   - number of trits to write (0-64)
+//   out - n trit values
+void trit64b_to_trits(trit64b_t v, size_t n, trit_t *out) {
+    if (n > 64) {
+        n = 64;
+    }
+    size_t full = n / 8;
+    for (size_t k = 0; k < full; k++) {
+        unsigned p = (unsigned)(v.pos >> (8 * k)) & 0xFF;
+        unsigned q = (unsigned)(v.neg >> (8 * k)) & 0xFF;
+        uint64_t pos = (((p & 0x7F) * LANE_SPREAD) & LANE_LSB) | (uint64_t)(p >> 7) << 56;
+        uint64_t neg = (((q & 0x7F) * LANE_SPREAD) & LANE_LSB) | (uint64_t)(q >> 7) << 56;
+        store_lanes(out + 8 * k, pos | neg * 0xFF);
+    }
+    for (size_t i = 8 * full; i < n; i++) {
+        out[i] = trit64b_get(v, (unsigned)i);
+    }
+}
+
+//--- t5b1 Streams ---
+
+// trit5_to_trit64b_array converts n trits of t5b1 bytes to bitsliced vectors.
+//
+// Trit i lands in lane i%64 of vector i/64. Each vector is built in
+// registers from the bytes that overlap its 64 lanes, one BCT5_MASKS load
+// each: the first may start below lane 0 (shifted right), the last may
+// run past lane 63 (those lanes shift out). Lanes past n are zero.
+//
+// Parameters:
+//   in  - TRIT5_PACKED_SIZE(n) bytes
+//   n   - number of trits
+//   out - TRIT64B_COUNT(n) vectors
+//
+// Returns: vectors written (TRIT64B_COUNT(n))
+size_t trit5_to_trit64b_array(const uint8_t *in, size_t n, trit64b_t *out) {
+    size_t nvec = TRIT64B_COUNT(n);
+    size_t nbytes = TRIT5_PACKED_SIZE(n);
+
+    for (size_t k = 0; k < nvec; k++) {
+        size_t lo = 64 * k;
+        size_t b = lo / 5;
+        size_t end = (lo + 64 + 4) / 5 < nbytes ? (lo + 64 + 4) / 5 : nbytes;
+        uint16_t m = BCT5_MASKS[in[b]];
+        unsigned skip = (unsigned)(lo - 5 * b);
+        uint64_t pos = (uint64_t)(m & 0x1F) >> skip;
+        uint64_t neg = (uint64_t)(m >> 8) >> skip;
+        for (b++; b < end; b++) {
+            unsigned off = (unsigned)(5 * b - lo);
+            m = BCT5_MASKS[in[b]];
+            pos |= (uint64_t)(m & 0x1F) << off;
+            neg |= (uint64_t)(m >> 8) << off;
+        }
+        out[k].pos = pos;
+        out[k].neg = neg;
+    }
+    if (nvec != 0) {
+        uint64_t keep = lane_mask(n - 64 * (nvec - 1));
+        out[nvec - 1].pos &= keep;
+        out[nvec - 1].neg &= keep;
+    }
+    return nvec;
+}
+
+// trit64b_to_trit5_array converts n trits of bitsliced vectors to t5b1 bytes.
+//
+// Exact inverse of trit5_to_trit64b_array. Each byte takes 5 lanes from
+// each plane and rebuilds its value from place-value weights:
+// byte = 121 + TRIT5_WEIGHTS[pos5] - TRIT5_WEIGHTS[neg5]. Lanes past n
+// are ignored, so a short final byte is padded with TRIT_ZERO.
+//
+// Parameters:
+//   in  - TRIT64B_COUNT(n) vectors
+//   n   - number of trits
+//   out - TRIT5_PACKED_SIZE(n) bytes
+//
+// Returns: bytes written (TRIT5_PACKED_SIZE(n))
+size_t trit64b_to_trit5_array(const trit64b_t *in, size_t n, uint8_t *out) {
+    size_t nvec = TRIT64B_COUNT(n);
+    size_t nbytes = TRIT5_PACKED_SIZE(n);
+
+    for (size_t b = 0; b < nbytes; b++) {
+        size_t bit = 5 * b;
+        size_t k = bit / 64;
+        unsigned off = (unsigned)(bit % 64);
+        uint64_t keep = (k + 1 == nvec) ? lane_mask(n - 64 * k) : ~0ULL;
+        uint64_t pos = (in[k].pos & keep) >> off;
+        uint64_t neg = (in[k].neg & keep) >> off;
+        if (off > 59 && k + 1 < nvec) {
+            uint64_t next_keep = (k + 2 == nvec) ? lane_mask(n - 64 * (k + 1)) : ~0ULL;
+            pos |= (in[k + 1].pos & next_keep) << (64 - off);
+            neg |= (in[k + 1].neg & next_keep) << (64 - off);
+        }
+        out[b] = (uint8_t)(TRIT5_BIAS + TRIT5_WEIGHTS[pos & 0x1F] - TRIT5_WEIGHTS[neg & 0x1F]);
+    }
+    return nbytes;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-bitslice   # Every op vs the scalar tables, transcoding roundtrips
+//
+// Benchmark:
+//   make bench-bitslice  # trit_add per trit vs trit64b_add per 64 lanes
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// [OMIT: Value types and const tables - nothing to release.]
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add lane-parallel operations (derive from the scalar truth table)
+//
+// Modify with Extreme Care:
+//   ⚠️ LANE_GATHER / LANE_SPREAD - carry-free only for the ranges used
+//   ⚠️ Lane order (lane i = trit i) - t5b1 transcoding depends on it
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Results must equal trit_negate/trit_add/trit_multiply lane for lane
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Each operation is 2-6 bit instructions for 64 trits. Validity is the
+// caller's contract (trit64b_valid); invalid lanes give unspecified lanes.
+// Array loads/stores move 8 trits per multiply; t5b1 transcoding costs
+// one 512-byte table load per byte.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Two are better than one." — Ecclesiastes 4:9
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,266 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// logic.c - Three-Valued (Kleene) Logic, Bulk Forms
+// Key: B-word-work-pkg-trit-src-logic
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: logic.h, tritop.h, trit.h)
+//   Array forms dispatch through tritop.c; no intrinsics of its own.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-logic-algorithms.adoc [Dyadic Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Kleene connectives over whole bool3 arrays and bitsliced masks.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: Test every value, keep the verdict - and keep "not proven"
+//            as its own answer.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Predicate masks at array scale for logic.h.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Replace per-value branches in three-valued predicate
+//          evaluation with straight-line bulk operations.
+//
+// Core Design:
+//   bool3_apply: a bool3_op_t is a truth-table ID, so a bool3_t array op
+//   is trit_op2_apply - one pshufb lookup per 16/32/64 values on the
+//   active backend. NOT passes a as both operands (its table ignores b).
+//
+//   bool3x64_apply: one loop per connective around the logic.h inline
+//   form. A loop of 1-6 word operations beats a compiled program
+//   (trit64b_op_run) on short runs and matches it on long ones, where
+//   memory is the limit. IDs that are not connectives fall back to
+//   trit_op2_compile + trit64b_op_run.
+//
+// Key Features:
+//   - Every connective, scalar-identical results on every backend
+//   - out may equal an input
+//
+// Philosophy: The simplest loop that is as fast as the clever one.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Internal: logic.h (bool3 types, inline connectives), tritop.h
+//     (trit_op2_apply, trit_op2_compile, trit64b_op_run)
+//
+// What Uses This:
+//   - logic.h consumers; bench/logic_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "logic.h"      // bool3 types, inline connectives, prototypes
+#include "tritop.h"     // trit_op2_apply, trit_op2_compile, trit64b_op_run
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── bool3_apply()    → trit_op2_apply (backend-dispatched lookup)
+//   └── bool3x64_apply() → per-connective loop over bool3x64_* (logic.h)
+//                          └── other IDs: trit_op2_compile → trit64b_op_run
+//
+// Baton Flow:
+//   Entry → connective → straight-line loop → out
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs
+// ────────────────────────────────────────────────────────────────
+
+// bool3_apply sets out[i] = op(a[i], b[i]) over bool3_t arrays.
+//
+// Parameters:
+//   op  - connective
+//   a   - n valid values
+//   b   - n valid values; NULL for BOOL3_OP_NOT
+//   n   - element count
+//   out - n values (may equal a or b)
+void bool3_apply(bool3_op_t op, const bool3_t *a, const bool3_t *b, size_t n, bool3_t *out) {
+    (void)trit_op2_apply((trit9_t)op, a, b ? b : a, n, out);
+}
+
+// bool3x64_apply sets out[i] = op(a[i], b[i]) over bitsliced words.
+//
+// Parameters:
+//   op  - connective, or any dyadic truth-table ID
+//   a   - n words
+//   b   - n words; NULL for BOOL3_OP_NOT
+//   n   - word count (64 values each)
+//   out - n words (may equal a or b)
+void bool3x64_apply(bool3_op_t op, const bool3x64_t *a, const bool3x64_t *b, size_t n,
+                    bool3x64_t *out) {
+    size_t i;
+    switch (op) {
+    case BOOL3_OP_NOT:
+        for (i = 0; i < n; i++) out[i] = bool3x64_not(a[i]);
+        return;
+    case BOOL3_OP_AND:
+        for (i = 0; i < n; i++) out[i] = bool3x64_and(a[i], b[i]);
+        return;
+    case BOOL3_OP_OR:
+        for (i = 0; i < n; i++) out[i] = bool3x64_or(a[i], b[i]);
+        return;
+    case BOOL3_OP_NAND:
+        for (i = 0; i < n; i++) out[i] = bool3x64_nand(a[i], b[i]);
+        return;
+    case BOOL3_OP_NOR:
+        for (i = 0; i < n; i++) out[i] = bool3x64_nor(a[i], b[i]);
+        return;
+    case BOOL3_OP_XOR:
+        for (i = 0; i < n; i++) out[i] = bool3x64_xor(a[i], b[i]);
+        return;
+    case BOOL3_OP_CONSENSUS:
+        for (i = 0; i < n; i++) out[i] = bool3x64_consensus(a[i], b[i]);
+        return;
+    case BOOL3_OP_EQUAL:
+        for (i = 0; i < n; i++) out[i] = bool3x64_equal(a[i], b[i]);
+        return;
+    case BOOL3_OP_IMPLIES:
+        for (i = 0; i < n; i++) out[i] = bool3x64_implies(a[i], b[i]);
+        return;
+    case BOOL3_OP_COMPARE:
+        for (i = 0; i < n; i++) out[i] = bool3x64_compare(a[i], b[i]);
+        return;
+    default: {
+        trit_op_t prog;
+        if (trit_op2_compile((trit9_t)op, &prog)) {
+            trit64b_op_run(&prog, a, b ? b : a, n, out);
+        }
+        return;
+    }
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// None reported: every connective is total. An op outside the
+// truth-table range (not reachable through the enum) leaves out
+// untouched. Invalid operands give unspecified results, as in logic.h.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-logic    # scalar vs the logic doc's tables and the truth-table
+//                      # IDs, bitsliced vs scalar lane-wise, bulk per backend
+//
+// Benchmark:
+//   make bench-logic   # branchy emulation vs inline, array and bitsliced
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// Nothing allocated.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add a case per new connective in bool3x64_apply
+//
+// Modify with Extreme Care:
+//   ⚠️ Loops must read a[i] and b[i] before writing out[i] (in place)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Results must equal the logic.h scalar forms
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Bitsliced masks move 2 bits per value against 8 for bool3_t arrays, so
+// bool3x64_apply does about four times the values per byte of bandwidth.
+// Compiling a program costs ~0.2 µs per call, which loses on short
+// masks; the connective loops have no setup.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Let your communication be, Yea, yea; Nay, nay." — Matthew 5:37
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -51,7 +51,7 @@
 //
 // # Purpose & Function
 //
-// Purpose: Pack/unpack operations for trit5, trit9, and trit27 types
+// Purpose: Pack/unpack operations for trit5, trit9, trit27, and trit40 types
 //
 // Core Design: Table-driven algorithms from ternary-math.toml
 //   - Pack: Horner's method (MST first, O(n))
@@ -61,7 +61,10 @@
 //   - trit5_pack/unpack: 5 trits ↔ 1 byte
 //   - trit9_pack/unpack: 9 trits ↔ 2 bytes
 //   - trit27_pack/unpack: 27 trits ↔ 6 bytes
+//   - trit40_pack/unpack: 40 trits ↔ 8 bytes (full word)
 //   - trit5_is_spare: Detect Bible Rail range (243-255)
+//   - trit5_pack_array/unpack_array: whole trit streams ↔ t5b1 bytes
+//   - trit5_to_trit40_array/trit40_to_trit5_array: t5b1 bytes ↔ trit40 words
 //
 // Philosophy: Faithful preservation - what goes in comes out unchanged.
 //
@@ -73,7 +76,7 @@
 //
 // What This Needs:
 //   - Standard Library: stdint.h, stdbool.h
-//   - Internal: trit.h
+//   - Internal: trit.h, simd.c (trit5_unpack_groups for bulk decode)
 //
 // What Uses This:
 //   - Higher-level trit operations (trit_byte, message encoding)
@@ -108,7 +111,11 @@
 // Defines
 // ────────────────────────────────────────────────────────────────
 
-// [Reserved: All constants defined in trit.h]
+//--- trit5 ↔ trit40 Conversion ---
+// A trit40 word is 8 t5b1 bytes read as base-243 digits, MST byte first.
+
+#define TRIT5_PER_TRIT40   8                // 40 / 5
+#define TRIT20_STATES      3486784401ULL    // 3^20 = 243^4, half a trit40 word
 
 // ────────────────────────────────────────────────────────────────
 // Static Variables
@@ -155,29 +162,54 @@
 //   ├── trit9_unpack()   → uses UNSIGNED_TO_TRIT macro
 //   ├── trit27_pack()    → uses TRIT_TO_UNSIGNED macro
 //   ├── trit27_unpack()  → uses UNSIGNED_TO_TRIT macro
-//   └── trit5_is_spare() → uses TRIT5_STATES constant
-//
-//   Helpers (Bottom Rungs - none, macros from trit.h serve this role)
-//   └── [All conversion via TRIT_TO_UNSIGNED / UNSIGNED_TO_TRIT macros]
+//   ├── trit40_pack()    → uses TRIT_TO_UNSIGNED macro
+//   ├── trit40_unpack()  → uses UNSIGNED_TO_TRIT macro
+//   ├── trit5_is_spare() → uses TRIT5_STATES constant
+//   ├── trit5_pack_array()   → unrolled Horner per group, trit5_pack for tail
+//   ├── trit5_unpack_array() → trit5_unpack_groups (simd.c), trit5_unpack for tail
+//   ├── trit5_to_trit40_array() → base-243 Horner over 8 bytes
+//   └── trit40_to_trit5_array() → trit40_split_bytes()
+//
+//   Helpers (Bottom Rungs - macros from trit.h serve most of this role)
+//   ├── [Trit conversion via TRIT_TO_UNSIGNED / UNSIGNED_TO_TRIT macros]
+//   └── trit40_split_bytes() → one word into 8 base-243 bytes
 //
 // Baton Flow (Execution Paths):
 //
 //   Pack path:   Entry → trit*_pack() → loop with TRIT_TO_UNSIGNED → return packed
 //   Unpack path: Entry → trit*_unpack() → loop with UNSIGNED_TO_TRIT → return (via array)
 //   Spare check: Entry → trit5_is_spare() → compare with TRIT5_STATES → return bool
+//   Array path:  Entry → trit5_*_array() → full groups inline → tail via trit5_pack/unpack
+//   Word path:   Entry → trit5_to_trit40_array() / trit40_to_trit5_array() → no trit expansion
 //
 // APUs (Available Processing Units):
-//   - 7 functions total
-//   - 0 helpers (macros from trit.h)
+//   - 14 functions total
+//   - 1 helper (trit40_split_bytes)
 //   - 0 core operations (functions ARE the core operations)
-//   - 7 public APIs (all exported)
+//   - 13 public APIs (all exported)
 
 // ────────────────────────────────────────────────────────────────
 // Helpers/Utilities - Internal Support
 // ────────────────────────────────────────────────────────────────
 //
-// [Reserved: No static helpers needed - conversion handled by
-// TRIT_TO_UNSIGNED and UNSIGNED_TO_TRIT macros from trit.h]
+// Trit conversion is handled by TRIT_TO_UNSIGNED and UNSIGNED_TO_TRIT
+// macros from trit.h. The one helper below serves the word path.
+
+// trit40_split_bytes writes the 8 base-243 digits of a word, MST first.
+//
+// One 64-bit division by 3^20 splits the word into two halves < 2^32;
+// each half then splits into 4 bytes with 32-bit constant divisions,
+// which the compiler turns into multiply-shifts.
+static void trit40_split_bytes(uint64_t word, uint8_t bytes[8]) {
+    uint32_t hi = (uint32_t)(word / TRIT20_STATES);
+    uint32_t lo = (uint32_t)(word - (uint64_t)hi * TRIT20_STATES);
+    for (int i = 3; i >= 0; i--) {
+        bytes[i] = (uint8_t)(hi % TRIT5_STATES);
+        bytes[4 + i] = (uint8_t)(lo % TRIT5_STATES);
+        hi /= TRIT5_STATES;
+        lo /= TRIT5_STATES;
+    }
+}
 
 // ────────────────────────────────────────────────────────────────
 // Core Operations - Business Logic
@@ -199,7 +231,8 @@
 // Public APIs - Exported Interface
 // ────────────────────────────────────────────────────────────────
 //
-// All 7 functions are public. Organized by trit width.
+// All 13 exported functions, organized by trit width. The one helper,
+// trit40_split_bytes, sits above with the other internal support.
 
 //--- trit5 Operations ---
 
@@ -280,6 +313,30 @@ void trit27_unpack(trit27_t packed, trit_t trits[27]) {
     }
 }
 
+//--- trit40 Operations ---
+
+// trit40_pack converts 40 trits to a full uint64 word using Horner's method.
+//
+// 3^40 - 1 < 2^64, so the running value never overflows.
+trit40_t trit40_pack(const trit_t trits[40]) {
+    uint64_t result = 0;
+    for (int i = 0; i < 40; i++) {
+        result = result * 3 + (uint64_t)TRIT_TO_UNSIGNED(trits[i]);
+    }
+    return (trit40_t)result;
+}
+
+// trit40_unpack converts a uint64 word to 40 trits using repeated division.
+//
+// Note: Values ≥ TRIT40_STATES produce undefined trit values in trits[0].
+void trit40_unpack(trit40_t packed, trit_t trits[40]) {
+    uint64_t value = packed;
+    for (int i = 39; i >= 0; i--) {
+        trits[i] = UNSIGNED_TO_TRIT(value % 3);
+        value = value / 3;
+    }
+}
+
 //--- Spare State Detection ---
 
 // trit5_is_spare checks if value is in Bible Rail range (243-255).
@@ -292,6 +349,153 @@ bool trit5_is_spare(trit5_t value) {
     return value >= TRIT5_STATES;
 }
 
+//--- trit5 Array Operations ---
+
+// trit5_pack_array packs a trit stream into t5b1 bytes in one call.
+//
+// Layout: ternary-storage-algorithms.adoc "Array Packing" - byte i holds
+// trits [5i, 5i+5), MST first (same order as trit5_pack). A short final
+// group is padded with TRIT_ZERO so the byte stays a valid 0-242 state.
+//
+// The full-group loop is Horner's method written out for 5 trits so the
+// compiler keeps everything in registers - no per-group call or loop.
+//
+// Parameters:
+//   in  - n trit values
+//   n   - number of trits
+//   out - TRIT5_PACKED_SIZE(n) bytes
+//
+// Returns: bytes written (TRIT5_PACKED_SIZE(n))
+size_t trit5_pack_array(const trit_t *in, size_t n, uint8_t *out) {
+    size_t full = n / 5;
+    size_t rem = n % 5;
+
+    for (size_t i = 0; i < full; i++) {
+        const trit_t *t = in + 5 * i;
+        unsigned v = (unsigned)TRIT_TO_UNSIGNED(t[0]);
+        v = v * 3 + (unsigned)TRIT_TO_UNSIGNED(t[1]);
+        v = v * 3 + (unsigned)TRIT_TO_UNSIGNED(t[2]);
+        v = v * 3 + (unsigned)TRIT_TO_UNSIGNED(t[3]);
+        v = v * 3 + (unsigned)TRIT_TO_UNSIGNED(t[4]);
+        out[i] = (uint8_t)v;
+    }
+
+    if (rem != 0) {
+        trit_t tail[5] = { TRIT_ZERO, TRIT_ZERO, TRIT_ZERO, TRIT_ZERO, TRIT_ZERO };
+        for (size_t j = 0; j < rem; j++) {
+            tail[j] = in[5 * full + j];
+        }
+        out[full] = trit5_pack(tail);
+        full++;
+    }
+    return full;
+}
+
+// trit5_unpack_array expands t5b1 bytes back into a trit stream.
+//
+// Whole bytes go through trit5_unpack_groups (src/simd.c), which runs the
+// widest division-free kernel this CPU supports. Only n trits are written -
+// the padding trits of a short final byte are dropped.
+//
+// Parameters:
+//   in  - TRIT5_PACKED_SIZE(n) bytes (0-242 each)
+//   n   - number of trits to produce
+//   out - n trit values
+//
+// Returns: bytes consumed (TRIT5_PACKED_SIZE(n))
+//
+// Note: Spare bytes (243-255) produce undefined trit values, as trit5_unpack.
+size_t trit5_unpack_array(const uint8_t *in, size_t n, trit_t *out) {
+    size_t full = n / 5;
+    size_t rem = n % 5;
+
+    trit5_unpack_groups(in, full, out);
+
+    if (rem != 0) {
+        trit_t tail[5];
+        trit5_unpack(in[full], tail);
+        for (size_t j = 0; j < rem; j++) {
+            out[5 * full + j] = tail[j];
+        }
+        full++;
+    }
+    return full;
+}
+
+//--- trit5 ↔ trit40 Stream Conversion ---
+
+// trit5_to_trit40_array regroups t5b1 bytes into trit40 words.
+//
+// Eight bytes hold exactly 40 trits, so each word is the 8 bytes read as
+// base-243 digits (Horner's method, MST byte first) - the same value
+// trit40_pack gives for those 40 trits, without expanding a single trit.
+// Bytes missing from a short final word count as TRIT5_BIAS so the
+// padding trits are TRIT_ZERO, as in trit5_pack_array.
+//
+// Parameters:
+//   in  - TRIT5_PACKED_SIZE(n) bytes (0-242 each)
+//   n   - number of trits in the stream
+//   out - TRIT40_PACKED_SIZE(n) words
+//
+// Returns: words written (TRIT40_PACKED_SIZE(n))
+//
+// Note: Spare bytes (243-255) produce undefined words.
+size_t trit5_to_trit40_array(const uint8_t *in, size_t n, trit40_t *out) {
+    size_t nbytes = TRIT5_PACKED_SIZE(n);
+    size_t full = nbytes / TRIT5_PER_TRIT40;
+    size_t rem = nbytes % TRIT5_PER_TRIT40;
+
+    for (size_t w = 0; w < full; w++) {
+        const uint8_t *b = in + TRIT5_PER_TRIT40 * w;
+        uint64_t v = b[0];
+        for (int i = 1; i < TRIT5_PER_TRIT40; i++) {
+            v = v * TRIT5_STATES + b[i];
+        }
+        out[w] = (trit40_t)v;
+    }
+
+    if (rem != 0) {
+        const uint8_t *b = in + TRIT5_PER_TRIT40 * full;
+        uint64_t v = 0;
+        for (size_t i = 0; i < TRIT5_PER_TRIT40; i++) {
+            v = v * TRIT5_STATES + (i < rem ? b[i] : TRIT5_BIAS);
+        }
+        out[full] = (trit40_t)v;
+        full++;
+    }
+    return full;
+}
+
+// trit40_to_trit5_array splits trit40 words back into t5b1 bytes.
+//
+// Exact inverse of trit5_to_trit40_array: only TRIT5_PACKED_SIZE(n) bytes
+// are written; the padding bytes of a short final word are dropped.
+//
+// Parameters:
+//   in  - TRIT40_PACKED_SIZE(n) words (each < TRIT40_STATES)
+//   n   - number of trits in the stream
+//   out - TRIT5_PACKED_SIZE(n) bytes
+//
+// Returns: bytes written (TRIT5_PACKED_SIZE(n))
+size_t trit40_to_trit5_array(const trit40_t *in, size_t n, uint8_t *out) {
+    size_t nbytes = TRIT5_PACKED_SIZE(n);
+    size_t full = nbytes / TRIT5_PER_TRIT40;
+    size_t rem = nbytes % TRIT5_PER_TRIT40;
+
+    for (size_t w = 0; w < full; w++) {
+        trit40_split_bytes(in[w], out + TRIT5_PER_TRIT40 * w);
+    }
+
+    if (rem != 0) {
+        uint8_t tail[TRIT5_PER_TRIT40];
+        trit40_split_bytes(in[full], tail);
+        for (size_t i = 0; i < rem; i++) {
+            out[TRIT5_PER_TRIT40 * full + i] = tail[i];
+        }
+    }
+    return nbytes;
+}
+
 // ============================================================================
 // END BODY
 // ============================================================================
@@ -341,7 +545,9 @@ bool trit5_is_spare(trit5_t value) {
 //   - trit5_pack/unpack: 5 trits ↔ 1 byte
 //   - trit9_pack/unpack: 9 trits ↔ 2 bytes
 //   - trit27_pack/unpack: 27 trits ↔ 6 bytes
+//   - trit40_pack/unpack: 40 trits ↔ 8 bytes
 //   - trit5_is_spare: Detect Bible Rail range (243-255)
+//   - trit5_pack_array/unpack_array: n trits ↔ ceil(n/5) bytes (t5b1 streams)
 //
 // Architecture: LADDER component - foundational building block
 //   Other components build on these pack/unpack operations.
@@ -391,7 +597,8 @@ bool trit5_is_spare(trit5_t value) {
 // No memory allocation. Pure computation with small loop overhead.
 //
 // For trit5: 5 iterations with integer multiply/divide
-// For trit27: 27 iterations - consider unrolling if performance-critical
+// For trit27: 27 dependent iterations - trit27_unpack_table (table.c) is the
+// fast path when decoding many words
 //
 // ────────────────────────────────────────────────────────────────
 // Troubleshooting Guide
@@ -430,12 +637,13 @@ bool trit5_is_spare(trit5_t value) {
 //   ✓ trit9 pack/unpack - COMPLETED
 //   ✓ trit27 pack/unpack - COMPLETED
 //   ✓ Spare state detection - COMPLETED
-//   ⏳ Batch pack operations (array of trit arrays → array of packed)
-//   ⏳ SIMD-optimized versions for large batches
+//   ✓ Batch pack operations (trit5_pack_array/unpack_array) - COMPLETED
+//   ✓ SIMD-optimized unpack for large batches (src/simd.c) - COMPLETED
+//   ✓ trit40 full-word type and t5b1 ↔ trit40 stream conversion - COMPLETED
 //
 // Known Limitations:
 //   - No validation of input array contents (assumes valid trits)
-//   - Spare state detection only for trit5 (not trit9/trit27)
+//   - Spare state detection only for trit5 (not trit9/trit27/trit40)
 //   - No endianness handling (assumes native byte order)
 //
 // Version History:
@@ -0,0 +1,758 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// radix.c - Binary ↔ Balanced Ternary Radix Conversion
+// Key: B-word-work-pkg-trit-src-radix
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritbig.h, trit.h)
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-conversion-algorithms.adoc [Binary Conversions]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Divide-and-conquer conversion between multi-limb binary integers and
+// balanced ternary (tritbig_t, trit27 arrays, trit5 arrays).
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Every one that asketh receiveth." — Matthew 7:8
+//
+// Principle: Conversion preserves value, not representation. A number
+//            asked for in another radix should come back whole.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Bridge between binary big integers and tritbig.c.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Convert n-limb binary integers to and from balanced ternary in
+//          O(M(n) log n) instead of one trit (one "% 3" pass) at a time.
+//
+// Core Design: Split in the source radix, where splitting is free, and
+// recombine in the target radix with a power tree:
+//
+//   binary → ternary:  x = hi·2^(64s) + lo     (s = 2^k limbs)
+//                      convert hi and lo, then hi·P[k] + lo in tritbig,
+//                      P[k] = 2^(64·2^k) = P[k-1]²
+//
+//   ternary → binary:  x = hi·3^(27s) + lo     (s = 2^k limbs)
+//                      convert hi and lo, then hi·Q[k] + lo in binary,
+//                      Q[k] = 3^(27·2^k) = Q[k-1]², Q[0] = 3 · TRIT27_POWERS[26]
+//
+// Each tree level costs O(M(n)); there are log n levels. The trees are
+// built per call (their cost is one more level). Below RADIX_TO_BIN_BASECASE
+// and RADIX_TO_TERN_BASECASE limbs, Horner's method on whole limbs is faster.
+//
+// The binary side needs its own multiplier: unsigned 64-bit limbs,
+// schoolbook with 128-bit products (__int128 where the compiler has it,
+// four 32-bit products otherwise), Karatsuba above BIN_KARATSUBA_LIMBS.
+//
+// Key Features:
+//   - Binary limbs are little-endian uint64_t, read as unsigned
+//   - Negative ternary values convert to two's complement (and report
+//     that they did not fit)
+//
+// Philosophy: Division is expensive in any radix. Split where the
+//             split is free; multiply where the work must be done.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: stdlib.h (malloc, calloc, free), string.h (memcpy, memset)
+//   - Internal: tritbig.h (tritbig_t, tritbig_mul, tritbig_add), trit.h
+//     (TRIT27_POWERS, TRIT27_STATES, trit5_pack_array, trit5_unpack_array)
+//
+// What Uses This:
+//   - tritbig.h consumers that exchange numbers with binary code
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None. Power trees live for one call.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdlib.h>   // malloc, calloc, free
+#include <string.h>   // memcpy, memset
+
+//--- Project Headers ---
+#include "tritbig.h"  // tritbig_t, trit27 constants
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define TERN_BASE  (TRIT27_POWERS[26] * 3)      // 3^27, one ternary limb
+#define TERN_BIAS  ((uint64_t)TRIT27_BIAS)      // (3^27 - 1) / 2
+
+// Horner below these sizes, in source limbs (tuned with make bench-radix).
+// Horner by 3^27 is one multiply per limb pair; Horner into 3^27 digits
+// takes four 16-bit steps per limb, so it hands over to the tree sooner.
+#define RADIX_TO_BIN_BASECASE  96    // ternary limbs
+#define RADIX_TO_TERN_BASECASE 24    // binary limbs
+
+// Binary Karatsuba crossover, in limbs
+#define BIN_KARATSUBA_LIMBS 32
+
+// Tree levels: 2^64 limbs is more than any address space holds
+#define TREE_LEVELS 64
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 radix_uwide;
+#endif
+
+// bin_num is a binary power-tree node (little-endian, no zero top limb).
+typedef struct {
+    uint64_t *limb;
+    size_t len;
+} bin_num;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Binary limb layer
+static uint64_t mul_add(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t *hi);
+static uint64_t bin_add_to(uint64_t *r, size_t n, const uint64_t *b, size_t m);
+static uint64_t bin_sub_from(uint64_t *r, size_t n, const uint64_t *b, size_t m);
+static void bin_mul_basecase(uint64_t *r, const uint64_t *a, size_t na, const uint64_t *b, size_t nb);
+static bool bin_mul(uint64_t *r, const uint64_t *a, size_t na, const uint64_t *b, size_t nb);
+
+// Conversion layer
+static size_t bin_width(size_t tern_limbs);
+static size_t tern_width(size_t bin_limbs);
+static size_t floor_log2(size_t n);
+static bool tern_to_bin(uint64_t *out, size_t w, const uint64_t *u, size_t n, const bin_num *tree);
+static bool bin_to_tern(tritbig_t *x, const uint64_t *in, size_t n, const tritbig_t *tree);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── tritbig_from_binary()  → bin_to_tern()
+//   │                            ├── Horner in 16-bit steps (basecase)
+//   │                            └── tritbig_mul/add() with P[k] = 2^(64·2^k)
+//   ├── tritbig_to_binary()    → unsigned digits of |x| → tern_to_bin()
+//   │                            ├── Horner by 3^27 (basecase)
+//   │                            └── bin_mul() with Q[k] = 3^(27·2^k)
+//   └── binary_to_trit27/trit5_array(), trit27/trit5_to_binary_array()
+//                              → tritbig_* conversions around the two above
+
+// ────────────────────────────────────────────────────────────────
+// Binary Limb Layer - Internal Support
+// ────────────────────────────────────────────────────────────────
+
+// bin_add_to adds b (m limbs) into r (n ≥ m limbs).
+//
+// Returns: carry out of limb n-1
+static uint64_t bin_add_to(uint64_t *r, size_t n, const uint64_t *b, size_t m) {
+    uint64_t carry = 0;
+    size_t i = 0;
+    for (; i < m; i++) {
+        uint64_t s = r[i] + carry;
+        carry = (s < carry);
+        s += b[i];
+        carry += (s < b[i]);
+        r[i] = s;
+    }
+    for (; carry && i < n; i++) {
+        r[i]++;
+        carry = (r[i] == 0);
+    }
+    return carry;
+}
+
+// bin_sub_from subtracts b (m limbs) from r (n ≥ m limbs).
+//
+// Returns: borrow out of limb n-1
+static uint64_t bin_sub_from(uint64_t *r, size_t n, const uint64_t *b, size_t m) {
+    uint64_t borrow = 0;
+    size_t i = 0;
+    for (; i < m; i++) {
+        uint64_t s = r[i] - b[i];
+        uint64_t bo = (s > r[i]);
+        r[i] = s - borrow;
+        borrow = bo + (r[i] > s);
+    }
+    for (; borrow && i < n; i++) {
+        borrow = (r[i] == 0);
+        r[i]--;
+    }
+    return borrow;
+}
+
+// mul_add returns the low word of a·b + c + d and puts the high word in
+// *hi (the sum always fits in 128 bits). Without 128-bit integers the
+// product is assembled from four 32×32 products.
+static uint64_t mul_add(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t *hi) {
+#if defined(__SIZEOF_INT128__)
+    radix_uwide t = (radix_uwide)a * b + c + d;
+    *hi = (uint64_t)(t >> 64);
+    return (uint64_t)t;
+#else
+    uint64_t a0 = a & 0xFFFFFFFFu, a1 = a >> 32;
+    uint64_t b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0;
+    uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+    uint64_t lo = mid << 32 | (p00 & 0xFFFFFFFFu);
+    uint64_t h = a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    lo += c;
+    h += lo < c;
+    lo += d;
+    h += lo < d;
+    *hi = h;
+    return lo;
+#endif
+}
+
+// bin_mul_basecase is row-wise schoolbook: one 64×64→128 product per pair.
+static void bin_mul_basecase(uint64_t *r, const uint64_t *a, size_t na, const uint64_t *b, size_t nb) {
+    memset(r, 0, (na + nb) * sizeof(uint64_t));
+    for (size_t i = 0; i < na; i++) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < nb; j++) {
+            r[i + j] = mul_add(a[i], b[j], r[i + j], carry, &carry);
+        }
+        r[i + nb] = carry;
+    }
+}
+
+// bin_mul multiplies unsigned limb arrays: schoolbook, slices or Karatsuba.
+//
+// Parameters:
+//   r    - receives na + nb limbs (must not overlap a or b)
+//   a, b - little-endian limbs, na ≥ 1, nb ≥ 1
+//
+// Returns: false on allocation failure
+static bool bin_mul(uint64_t *r, const uint64_t *a, size_t na, const uint64_t *b, size_t nb) {
+    if (na < nb) {
+        const uint64_t *t = a; a = b; b = t;
+        size_t tn = na; na = nb; nb = tn;
+    }
+    if (nb < BIN_KARATSUBA_LIMBS) {
+        bin_mul_basecase(r, a, na, b, nb);
+        return true;
+    }
+
+    // Unbalanced: nb-limb slices of a, partial products added in place
+    if (2 * nb <= na) {
+        uint64_t *tmp = malloc(2 * nb * sizeof(uint64_t));
+        if (!tmp) {
+            return false;
+        }
+        memset(r, 0, (na + nb) * sizeof(uint64_t));
+        for (size_t off = 0; off < na; off += nb) {
+            size_t m = (na - off < nb) ? na - off : nb;
+            if (!bin_mul(tmp, a + off, m, b, nb)) {
+                free(tmp);
+                return false;
+            }
+            bin_add_to(r + off, na + nb - off, tmp, m + nb);
+        }
+        free(tmp);
+        return true;
+    }
+
+    // Karatsuba at h = na/2: z1 = (a0 + a1)(b0 + b1) - z0 - z2 ≥ 0
+    size_t h = na / 2;
+    size_t na1 = na - h;
+    size_t nb1 = nb - h;
+    size_t ns = na1 + 1;
+    size_t nt = ((nb1 > h) ? nb1 : h) + 1;
+    size_t nz = ns + nt;
+    uint64_t *buf = malloc((ns + nt + nz) * sizeof(uint64_t));
+    if (!buf) {
+        return false;
+    }
+    uint64_t *sa = buf;
+    uint64_t *sb = sa + ns;
+    uint64_t *z1 = sb + nt;
+
+    memset(sa, 0, (ns + nt) * sizeof(uint64_t));
+    memcpy(sa, a + h, na1 * sizeof(uint64_t));
+    bin_add_to(sa, ns, a, h);
+    if (nb1 >= h) {
+        memcpy(sb, b + h, nb1 * sizeof(uint64_t));
+        bin_add_to(sb, nt, b, h);
+    } else {
+        memcpy(sb, b, h * sizeof(uint64_t));
+        bin_add_to(sb, nt, b + h, nb1);
+    }
+
+    if (!bin_mul(r, a, h, b, h) ||
+        !bin_mul(r + 2 * h, a + h, na1, b + h, nb1) ||
+        !bin_mul(z1, sa, ns, sb, nt)) {
+        free(buf);
+        return false;
+    }
+    bin_sub_from(z1, nz, r, 2 * h);
+    bin_sub_from(z1, nz, r + 2 * h, na1 + nb1);
+
+    // z1 < 2^(64(na + nb - h)); any limbs above that are zero
+    size_t room = na + nb - h;
+    bin_add_to(r + h, room, z1, (nz < room) ? nz : room);
+    free(buf);
+    return true;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Conversion Layer - Internal Support
+// ────────────────────────────────────────────────────────────────
+
+// bin_width returns binary limbs enough for any value below 3^(27n).
+// 27·log2(3) < 42.8, rounded up to 43 bits per ternary limb.
+static size_t bin_width(size_t tern_limbs) {
+    return (43 * tern_limbs) / 64 + 1;
+}
+
+// tern_width returns ternary limbs enough for any value below 2^(64n).
+// 64·log3(2) < 40.38, rounded up to 41 trits per binary limb.
+static size_t tern_width(size_t bin_limbs) {
+    return (41 * bin_limbs) / TRITBIG_LIMB_TRITS + 1;
+}
+
+// floor_log2 returns ⌊log2 n⌋ for n ≥ 1.
+static size_t floor_log2(size_t n) {
+    size_t k = 0;
+    while (n >>= 1) {
+        k++;
+    }
+    return k;
+}
+
+// tern_to_bin converts unsigned ternary digits to binary.
+//
+// Parameters:
+//   out  - receives w limbs, w ≥ bin_width(n)
+//   u    - n digits in [0, 3^27), least significant first
+//   tree - Q[k] = 3^(27·2^k) for every level the split needs
+//
+// Returns: false on allocation failure
+static bool tern_to_bin(uint64_t *out, size_t w, const uint64_t *u, size_t n, const bin_num *tree) {
+    while (n > 0 && u[n - 1] == 0) {
+        n--;
+    }
+    memset(out, 0, w * sizeof(uint64_t));
+
+    // Horner: out = out·3^27 + digit, top digit first
+    if (n <= RADIX_TO_BIN_BASECASE) {
+        size_t len = 0;
+        for (size_t i = n; i-- > 0;) {
+            uint64_t carry = u[i];
+            for (size_t j = 0; j < len; j++) {
+                out[j] = mul_add(out[j], TERN_BASE, carry, 0, &carry);
+            }
+            if (carry) {
+                out[len++] = carry;
+            }
+        }
+        return true;
+    }
+
+    // x = hi·Q[k] + lo with s = 2^k < n digits in lo
+    size_t k = floor_log2(n - 1);
+    size_t s = (size_t)1 << k;
+    size_t wh = bin_width(n - s);
+    size_t wp = wh + tree[k].len;
+    uint64_t *buf = malloc((wh + wp) * sizeof(uint64_t));
+    if (!buf) {
+        return false;
+    }
+    uint64_t *hi = buf;
+    uint64_t *prod = hi + wh;
+    if (!tern_to_bin(hi, wh, u + s, n - s, tree)) {
+        free(buf);
+        return false;
+    }
+    while (wh > 1 && hi[wh - 1] == 0) {
+        wh--;
+    }
+    if (!bin_mul(prod, hi, wh, tree[k].limb, tree[k].len)) {
+        free(buf);
+        return false;
+    }
+    wp = wh + tree[k].len;
+    memcpy(out, prod, ((wp < w) ? wp : w) * sizeof(uint64_t));
+    free(buf);
+
+    size_t wl = bin_width(s);
+    uint64_t *lo = malloc(wl * sizeof(uint64_t));
+    if (!lo || !tern_to_bin(lo, wl, u, s, tree)) {
+        free(lo);
+        return false;
+    }
+    bin_add_to(out, w, lo, wl);
+    free(lo);
+    return true;
+}
+
+// bin_to_tern converts an unsigned binary integer to a tritbig.
+//
+// Parameters:
+//   x    - receives the value
+//   in   - n limbs, least significant first
+//   tree - P[k] = 2^(64·2^k) for every level the split needs
+//
+// Returns: false on allocation failure
+static bool bin_to_tern(tritbig_t *x, const uint64_t *in, size_t n, const tritbig_t *tree) {
+    while (n > 0 && in[n - 1] == 0) {
+        n--;
+    }
+
+    // Horner in 16-bit steps keeps digit·2^16 + carry inside uint64
+    if (n <= RADIX_TO_TERN_BASECASE) {
+        size_t cap = tern_width(n) + 1;
+        uint64_t *d = malloc(cap * sizeof(uint64_t));
+        int64_t *limb = malloc(cap * sizeof(int64_t));
+        if (!d || !limb) {
+            free(d);
+            free(limb);
+            return false;
+        }
+        size_t len = 0;
+        for (size_t i = n; i-- > 0;) {
+            for (int shift = 48; shift >= 0; shift -= 16) {
+                uint64_t carry = (in[i] >> shift) & 0xFFFFu;
+                for (size_t j = 0; j < len; j++) {
+                    uint64_t t = (d[j] << 16) + carry;
+                    d[j] = t % TERN_BASE;
+                    carry = t / TERN_BASE;
+                }
+                if (carry) {
+                    d[len++] = carry;
+                }
+            }
+        }
+
+        // Unsigned digits → balanced: digits above the bias borrow from 3^27
+        uint64_t carry = 0;
+        for (size_t j = 0; j < len; j++) {
+            uint64_t v = d[j] + carry;
+            carry = (v > TERN_BIAS);
+            limb[j] = carry ? (int64_t)v - (int64_t)TERN_BASE : (int64_t)v;
+        }
+        if (carry) {
+            limb[len++] = 1;
+        }
+        free(d);
+        tritbig_free(x);
+        x->limb = limb;
+        x->len = len;
+        x->cap = cap;
+        return true;
+    }
+
+    // x = hi·P[k] + lo with s = 2^k < n limbs in lo
+    size_t k = floor_log2(n - 1);
+    size_t s = (size_t)1 << k;
+    tritbig_t hi = TRITBIG_INIT, lo = TRITBIG_INIT;
+    bool ok = bin_to_tern(&hi, in + s, n - s, tree) &&
+              bin_to_tern(&lo, in, s, tree) &&
+              tritbig_mul(&hi, &hi, &tree[k]) &&
+              tritbig_add(x, &hi, &lo);
+    tritbig_free(&hi);
+    tritbig_free(&lo);
+    return ok;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+// tritbig_from_binary sets x from an unsigned binary integer.
+//
+// Parameters:
+//   x     - receives the value
+//   limbs - n limbs, least significant first
+//
+// Returns: false on allocation failure (x unchanged)
+bool tritbig_from_binary(tritbig_t *x, const uint64_t *limbs, size_t n) {
+    while (n > 0 && limbs[n - 1] == 0) {
+        n--;
+    }
+    size_t levels = (n > RADIX_TO_TERN_BASECASE) ? floor_log2(n - 1) + 1 : 0;
+    tritbig_t tree[TREE_LEVELS];
+    for (size_t k = 0; k < TREE_LEVELS; k++) {
+        tritbig_init(&tree[k]);
+    }
+
+    // P[0] = 2^64 via the basecase, then repeated squaring
+    static const uint64_t two64[2] = { 0, 1 };
+    bool ok = true;
+    for (size_t k = 0; ok && k < levels; k++) {
+        ok = (k == 0) ? bin_to_tern(&tree[0], two64, 2, tree)
+                      : tritbig_mul(&tree[k], &tree[k - 1], &tree[k - 1]);
+    }
+
+    tritbig_t r = TRITBIG_INIT;
+    ok = ok && bin_to_tern(&r, limbs, n, tree);
+    if (ok) {
+        tritbig_free(x);
+        *x = r;
+    } else {
+        tritbig_free(&r);
+    }
+    for (size_t k = 0; k < levels; k++) {
+        tritbig_free(&tree[k]);
+    }
+    return ok;
+}
+
+// tritbig_to_binary writes x modulo 2^(64n) as n binary limbs.
+//
+// Negative values come out in two's complement.
+//
+// Parameters:
+//   x   - value to convert
+//   out - receives n limbs, least significant first
+//   n   - output limbs
+//
+// Returns: true if 0 ≤ x < 2^(64n); false otherwise or on allocation
+//          failure (out unchanged only in the allocation case)
+bool tritbig_to_binary(const tritbig_t *x, uint64_t *out, size_t n) {
+    size_t len = x->len;
+    if (len == 0) {
+        memset(out, 0, n * sizeof(uint64_t));
+        return true;
+    }
+    int sign = tritbig_sign(x);
+    size_t w = bin_width(len);
+    size_t levels = (len > RADIX_TO_BIN_BASECASE) ? floor_log2(len - 1) + 1 : 0;
+    uint64_t *u = malloc(len * sizeof(uint64_t));
+    uint64_t *bin = malloc(w * sizeof(uint64_t));
+    bin_num tree[TREE_LEVELS];
+    memset(tree, 0, sizeof(tree));
+    bool ok = (u != NULL && bin != NULL);
+
+    // |x| as unsigned digits: a negative balanced digit borrows 3^27
+    if (ok) {
+        int64_t borrow = 0;
+        for (size_t i = 0; i < len; i++) {
+            int64_t v = sign * x->limb[i] + borrow;
+            borrow = (v < 0) ? -1 : 0;
+            u[i] = (uint64_t)(v < 0 ? v + (int64_t)TERN_BASE : v);
+        }
+    }
+
+    // Q[0] = 3^27, then repeated squaring
+    for (size_t k = 0; ok && k < levels; k++) {
+        size_t cap = k ? 2 * tree[k - 1].len : 1;
+        tree[k].limb = malloc(cap * sizeof(uint64_t));
+        if (!tree[k].limb) {
+            ok = false;
+            break;
+        }
+        if (k == 0) {
+            tree[0].limb[0] = TERN_BASE;
+        } else if (!bin_mul(tree[k].limb, tree[k - 1].limb, tree[k - 1].len,
+                            tree[k - 1].limb, tree[k - 1].len)) {
+            ok = false;
+            break;
+        }
+        tree[k].len = cap;
+        while (tree[k].len > 1 && tree[k].limb[tree[k].len - 1] == 0) {
+            tree[k].len--;
+        }
+    }
+
+    ok = ok && tern_to_bin(bin, w, u, len, tree);
+    bool fits = ok && sign > 0;
+    if (ok) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = (i < w) ? bin[i] : 0;
+        }
+        for (size_t i = n; i < w; i++) {
+            fits = fits && bin[i] == 0;
+        }
+        if (sign < 0) {
+            // Two's complement: invert and add one
+            uint64_t carry = 1;
+            for (size_t i = 0; i < n; i++) {
+                out[i] = ~out[i] + carry;
+                carry = carry && out[i] == 0;
+            }
+        }
+    }
+    free(u);
+    free(bin);
+    for (size_t k = 0; k < levels; k++) {
+        free(tree[k].limb);
+    }
+    return fits;
+}
+
+// binary_to_trit27_array converts n binary limbs to packed trit27 words.
+//
+// Returns: true if the value fits in `words` words (most significant first)
+bool binary_to_trit27_array(const uint64_t *in, size_t n, trit27_t *out, size_t words) {
+    tritbig_t x = TRITBIG_INIT;
+    bool ok = tritbig_from_binary(&x, in, n) && tritbig_to_trit27_array(&x, out, words);
+    tritbig_free(&x);
+    return ok;
+}
+
+// trit27_to_binary_array converts packed trit27 words (most significant
+// first) to n binary limbs.
+//
+// Returns: true if 0 ≤ value < 2^(64n)
+bool trit27_to_binary_array(const trit27_t *in, size_t words, uint64_t *out, size_t n) {
+    tritbig_t x = TRITBIG_INIT;
+    bool ok = tritbig_from_trit27_array(&x, in, words) && tritbig_to_binary(&x, out, n);
+    tritbig_free(&x);
+    return ok;
+}
+
+// binary_to_trit5_array converts n binary limbs to `trits` trits packed
+// as TRIT5_PACKED_SIZE(trits) t5b1 bytes (MST first).
+//
+// Returns: true if the value fits in `trits` trits
+bool binary_to_trit5_array(const uint64_t *in, size_t n, uint8_t *out, size_t trits) {
+    tritbig_t x = TRITBIG_INIT;
+    trit_t *tmp = malloc(trits ? trits : 1);
+    bool ok = tmp && tritbig_from_binary(&x, in, n);
+    if (ok) {
+        ok = tritbig_to_trits(&x, tmp, trits);
+        trit5_pack_array(tmp, trits, out);
+    }
+    free(tmp);
+    tritbig_free(&x);
+    return ok;
+}
+
+// trit5_to_binary_array converts `trits` trits of t5b1 bytes (MST first)
+// to n binary limbs.
+//
+// Returns: true if 0 ≤ value < 2^(64n)
+bool trit5_to_binary_array(const uint8_t *in, size_t trits, uint64_t *out, size_t n) {
+    tritbig_t x = TRITBIG_INIT;
+    trit_t *tmp = malloc(trits ? trits : 1);
+    bool ok = tmp != NULL;
+    if (ok) {
+        trit5_unpack_array(in, trits, tmp);
+        ok = tritbig_from_trits(&x, tmp, trits) && tritbig_to_binary(&x, out, n);
+    }
+    free(tmp);
+    tritbig_free(&x);
+    return ok;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-radix   # vs per-trit % 3 reference, round trips past
+//                     # several tree levels, two's complement, fits flags
+//
+// Benchmark:
+//   make bench-radix  # per-trit loop vs limb Horner vs power tree, 1K-1M bits
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// Trees and scratch are freed on every path. tritbig results are built
+// in temporaries and moved into the caller's value only on success.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ RADIX_TO_*_BASECASE, BIN_KARATSUBA_LIMBS (re-run make bench-radix)
+//   ✅ Caching the trees across calls (needs a thread-safety story)
+//
+// Modify with Extreme Care:
+//   ⚠️ bin_width / tern_width - every scratch buffer is sized from them
+//   ⚠️ Split point s = 2^k < n - the tree is indexed by k
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Limb order (binary and tritbig limbs are least significant first;
+//      trit27 and trit5 arrays are most significant first)
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// The top level does one multiplication of n/2 × n/2 limbs; level j does
+// 2^j multiplications of n/2^(j+1). With Karatsuba or Toom-3 underneath,
+// the sum is O(M(n) log n). The binary→ternary direction reuses tritbig_mul
+// (Toom-3 at the top); ternary→binary uses bin_mul (Karatsuba).
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Every one that asketh receiveth." — Matthew 7:8
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
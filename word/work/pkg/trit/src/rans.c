@@ -0,0 +1,700 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// rans.c - Entropy-Coded Trit Streams
+// Key: B-word-work-pkg-trit-src-rans
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritrans.h, tritreduce.h, trit.h)
+//   Portable C99. Histograms and t5b1 staging go through reduce.c and
+//   pack.c, which pick their own backend.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Range asymmetric numeral system (rANS) coding of trit sequences, with
+// a frequency model per block - cold storage below t5b1's 1.6 bits/trit.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "He telleth the number of the stars; he calleth them all by
+//            their names." — Psalm 147:4
+//
+// Principle: What is common is named briefly, what is rare at length -
+//            and every one is still called back by name.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Archive format for trit data: as few bits per trit as the
+//       block's statistics allow, decoded at hundreds of MB/s.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Spend -log2(p) bits on a trit of probability p. Uniform trits
+//          cost log2(3) ≈ 1.585 bits (t5b1: 1.6); a block that is 95%
+//          zeros costs about 0.34.
+//
+// Core Design:
+//
+//   Model. Each block of TRIT_RANS_BLOCK trits is counted (reduce.c) and
+//   its frequencies scaled to sum to 4096, every trit that occurs
+//   keeping at least 1. The block header carries f(-1) and f(+1).
+//
+//   Coder. Byte-wise rANS with 32-bit states in [2^23, 2^31): encoding
+//   trit s maps x to (x / f) · 4096 + x mod f + start(s), after shifting
+//   out low bytes until x < 2^19 · f; decoding inverts it from the low 12
+//   bits of x. Trit i of a block uses state i mod 8, so eight dependency
+//   chains run side by side and share one byte stream. The encoder
+//   divides by a per-symbol reciprocal multiply; the decoder reads one
+//   4096-entry table (frequency, start, trit) per trit.
+//
+//   Stream. u64 trit count, then per block a mode byte:
+//     0  raw:  TRIT5_PACKED_SIZE(bn) bytes of t5b1
+//     1  rANS: u16 f(-1), u16 f(+1), u32 payload bytes, payload =
+//              8 final states (u32) then the renormalization bytes
+//   All integers little-endian. A block is stored raw when rANS would
+//   not be smaller, so no stream exceeds TRIT_RANS_BOUND(n).
+//
+//   t5b1 staging. Packed input is unpacked CHUNK trits at a time into a
+//   stack buffer, last chunk first (rANS encodes backwards); packed
+//   output is decoded a chunk at a time and repacked (pack.c).
+//
+// Key Features:
+//   - Within 0.01 bits/trit of the block entropy for blocks of 40960
+//   - Same stream from trit_t or t5b1 input; either decoder reads it
+//   - Decoding never reads past the stream and checks the final states
+//
+// Philosophy: The cost of a trit is how surprising it is.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: string.h (memcpy, memmove)
+//   - Internal: tritrans.h (TRIT_RANS_*, prototypes), trit.h (trit_t),
+//     tritreduce.h / reduce.c (trit_count_array, trit5_count_array), pack.c (trit5_pack_array,
+//     trit5_unpack_array)
+//
+// What Uses This:
+//   - Archives of trit data; bench/rans_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: Reentrant - frequency tables and coder states are per call.
+//   One stream decodes serially: its blocks are independent, but a
+//   block's offset is known only after walking the ones before it. Data
+//   meant for parallel decode is encoded as one stream per piece.
+//
+// State: None. Tables and states live on the stack (about 21 KB).
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <string.h>     // memcpy, memmove
+
+//--- Project Headers ---
+#include "tritrans.h"   // TRIT_RANS_*, prototypes
+#include "tritreduce.h" // trit_count_array
+#include "trit.h"       // trit_t, pack/unpack
+
+// ────────────────────────────────────────────────────────────────
+// Constants
+// ────────────────────────────────────────────────────────────────
+
+#define SCALE_BITS   12                  // frequencies sum to 2^12
+#define SCALE        (1u << SCALE_BITS)
+#define SCALE_MASK   (SCALE - 1)
+#define RANS_L       (1u << 23)          // lower bound of a state
+#define LANES        8                   // interleaved states
+#define CHUNK        5120                // t5b1 staging (multiple of 5 and LANES)
+
+#define STREAM_HEAD  8                   // u64 trit count
+#define BLOCK_HEAD   9                   // mode, f(-1), f(+1), payload bytes
+#define MODE_RAW     0
+#define MODE_RANS    1
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// enc_sym_t encodes one trit value without a division (ryg_rans style):
+// q = ⌊x · rcp / 2^32⌋ >> shift equals ⌊x / f⌋, and x + bias + q · cmpl
+// equals ⌊x / f⌋ · SCALE + x mod f + start.
+typedef struct {
+    uint32_t x_max;         // shift out bytes while x ≥ x_max
+    uint32_t rcp;           // reciprocal of f
+    uint32_t bias;          // start (start + SCALE - 1 when f = 1)
+    uint32_t cmpl;          // SCALE - f
+    uint32_t shift;         // reciprocal shift
+} enc_sym_t;
+
+// encoder_t writes one block's payload backwards from hi down to lo.
+typedef struct {
+    uint32_t x[LANES];
+    enc_sym_t sym[3];       // by TRIT_TO_UNSIGNED(t)
+    uint8_t *ptr;           // bytes written so far start here
+    uint8_t *lo;            // lowest byte the payload may use
+    int full;               // payload reached lo: store the block raw
+} encoder_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static void scale_freqs(const uint64_t count[3], size_t n, uint32_t f[3]);
+static void enc_init(encoder_t *e, const uint32_t f[3], uint8_t *lo, uint8_t *hi);
+static void enc_put(encoder_t *e, const trit_t *t, size_t count);
+static void enc_flush(encoder_t *e);
+static size_t encode_block(const trit_t *t, const uint8_t *t5, size_t bn, uint8_t *out);
+static void build_table(const uint32_t f[3], uint32_t *tab);
+static const uint8_t *dec_get(const uint32_t *tab, uint32_t x[LANES], const uint8_t *p,
+                              const uint8_t *end, trit_t *out, size_t count);
+static size_t decode_block(const uint8_t *in, size_t len, size_t bn, trit_t *t, uint8_t *t5);
+static size_t decode(const uint8_t *in, size_t len, trit_t *t, uint8_t *t5, size_t cap);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── trit_rans_encode() / trit5_rans_encode() → encode_block per block
+//   ├── trit_rans_count()                        → get64
+//   └── trit_rans_decode() / trit5_rans_decode() → decode → decode_block
+//
+//   Middle Rungs
+//   ├── encode_block() → counts → scale_freqs → enc_init, enc_put, enc_flush
+//   │                    (or t5b1 when rANS is not smaller)
+//   └── decode_block() → build_table → dec_get → final state check
+//
+//   Bottom Rungs
+//   └── put16/32/64, get16/32/64 (little-endian)
+//
+// Baton Flow:
+//   Encode: count → model → trits last to first → flush states → header
+//   Decode: header → table → states → trits first to last
+
+// ────────────────────────────────────────────────────────────────
+// Helpers - Little-Endian Fields
+// ────────────────────────────────────────────────────────────────
+
+static void put16(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v) {
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static void put64(uint8_t *p, uint64_t v) {
+    put32(p, (uint32_t)v);
+    put32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint32_t get16(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8;
+}
+
+static uint32_t get32(const uint8_t *p) {
+    return get16(p) | get16(p + 2) << 16;
+}
+
+static uint64_t get64(const uint8_t *p) {
+    return (uint64_t)get32(p) | (uint64_t)get32(p + 4) << 32;
+}
+
+static size_t min_size(size_t a, size_t b) {
+    return a < b ? a : b;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Model
+// ────────────────────────────────────────────────────────────────
+
+// scale_freqs maps counts of n trits to frequencies summing to SCALE,
+// keeping every occurring trit at 1 or more; the most common trit
+// absorbs the rounding.
+static void scale_freqs(const uint64_t count[3], size_t n, uint32_t f[3]) {
+    uint32_t sum = 0;
+    int big = 0;
+    for (int s = 0; s < 3; s++) {
+        f[s] = (uint32_t)(count[s] * SCALE / n);
+        if (count[s] > 0 && f[s] == 0) {
+            f[s] = 1;
+        }
+        sum += f[s];
+        if (count[s] > count[big]) {
+            big = s;
+        }
+    }
+    f[big] = f[big] + SCALE - sum;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Encoder
+// ────────────────────────────────────────────────────────────────
+
+static void enc_init(encoder_t *e, const uint32_t f[3], uint8_t *lo, uint8_t *hi) {
+    uint32_t start = 0;
+    for (int s = 0; s < 3; s++) {
+        enc_sym_t *y = &e->sym[s];
+        y->x_max = ((RANS_L >> SCALE_BITS) << 8) * f[s];
+        y->cmpl = SCALE - f[s];
+        if (f[s] < 2) {
+            y->rcp = ~0u;
+            y->shift = 0;
+            y->bias = start + SCALE - 1;
+        } else {
+            uint32_t shift = 0;
+            while (f[s] > (1u << shift)) {
+                shift++;
+            }
+            y->rcp = (uint32_t)(((1ULL << (shift + 31)) + f[s] - 1) / f[s]);
+            y->shift = shift - 1;
+            y->bias = start;
+        }
+        start += f[s];
+    }
+    for (int l = 0; l < LANES; l++) {
+        e->x[l] = RANS_L;
+    }
+    e->ptr = hi;
+    e->lo = lo;
+    e->full = 0;
+}
+
+// enc_step pushes trit value s (0-2) onto state x. The caller has made
+// room for two bytes, the most one step emits.
+static inline void enc_step(encoder_t *e, uint32_t *x, unsigned s) {
+    const enc_sym_t *y = &e->sym[s];
+    uint32_t v = *x;
+    while (v >= y->x_max) {
+        *--e->ptr = (uint8_t)v;
+        v >>= 8;
+    }
+    uint32_t q = (uint32_t)(((uint64_t)v * y->rcp) >> 32) >> y->shift;
+    *x = v + y->bias + q * y->cmpl;
+}
+
+// enc_put encodes t[count - 1] down to t[0], trit j on state j mod LANES;
+// t must start on a multiple of LANES within its block.
+static void enc_put(encoder_t *e, const trit_t *t, size_t count) {
+    size_t j = count;
+    while (j % LANES != 0) {
+        if (e->ptr - e->lo < 2) {
+            e->full = 1;
+            return;
+        }
+        j--;
+        enc_step(e, &e->x[j % LANES], (unsigned)TRIT_TO_UNSIGNED(t[j]));
+    }
+    while (j > 0) {
+        if (e->ptr - e->lo < 2 * LANES) {
+            e->full = 1;
+            return;
+        }
+        j -= LANES;
+        for (int l = LANES - 1; l >= 0; l--) {
+            enc_step(e, &e->x[l], (unsigned)TRIT_TO_UNSIGNED(t[j + (size_t)l]));
+        }
+    }
+}
+
+// enc_flush writes the final states, lane 0 first in the stream.
+static void enc_flush(encoder_t *e) {
+    if (e->full || e->ptr - e->lo < 4 * LANES) {
+        e->full = 1;
+        return;
+    }
+    for (int l = LANES - 1; l >= 0; l--) {
+        e->ptr -= 4;
+        put32(e->ptr, e->x[l]);
+    }
+}
+
+// encode_block writes one block of bn trits - from t, or from the t5b1
+// bytes t5 - and returns its size: rANS when smaller, else raw t5b1.
+static size_t encode_block(const trit_t *t, const uint8_t *t5, size_t bn, uint8_t *out) {
+    size_t raw = TRIT5_PACKED_SIZE(bn);
+    uint64_t count[3];
+    uint32_t f[3];
+
+    if (raw + 1 > BLOCK_HEAD + 4 * LANES) {
+        if (t) {
+            trit_count_array(t, bn, count);
+        } else {
+            trit5_count_array(t5, bn, count);
+        }
+        scale_freqs(count, bn, f);
+
+        encoder_t e;
+        uint8_t *hi = out + 1 + raw;
+        enc_init(&e, f, out + BLOCK_HEAD, hi);
+        if (t) {
+            enc_put(&e, t, bn);
+        } else {
+            trit_t stage[CHUNK];
+            for (size_t at = (bn - 1) / CHUNK * CHUNK; !e.full; at -= CHUNK) {
+                size_t cn = min_size(CHUNK, bn - at);
+                trit5_unpack_array(t5 + at / 5, cn, stage);
+                enc_put(&e, stage, cn);
+                if (at == 0) {
+                    break;
+                }
+            }
+        }
+        enc_flush(&e);
+
+        if (!e.full) {
+            size_t len = (size_t)(hi - e.ptr);
+            out[0] = MODE_RANS;
+            put16(out + 1, f[TRIT_TO_UNSIGNED(TRIT_NEG)]);
+            put16(out + 3, f[TRIT_TO_UNSIGNED(TRIT_POS)]);
+            put32(out + 5, (uint32_t)len);
+            memmove(out + BLOCK_HEAD, e.ptr, len);
+            return BLOCK_HEAD + len;
+        }
+    }
+
+    out[0] = MODE_RAW;
+    if (t) {
+        trit5_pack_array(t, bn, out + 1);
+    } else {
+        memcpy(out + 1, t5, raw);
+    }
+    return 1 + raw;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Decoder
+// ────────────────────────────────────────────────────────────────
+
+// build_table fills slot → (f << 16) | (start << 2) | value for the
+// SCALE slots; f[0] + f[1] + f[2] must equal SCALE.
+static void build_table(const uint32_t f[3], uint32_t *tab) {
+    uint32_t start = 0;
+    for (uint32_t s = 0; s < 3; s++) {
+        uint32_t entry = (f[s] << 16) | (start << 2) | s;
+        for (uint32_t k = 0; k < f[s]; k++) {
+            tab[start + k] = entry;
+        }
+        start += f[s];
+    }
+}
+
+// dec_step pops one trit off state x, refilling from p (never past end).
+static inline trit_t dec_step(const uint32_t *tab, uint32_t *x, const uint8_t **p,
+                              const uint8_t *end) {
+    uint32_t v = *x;
+    uint32_t e = tab[v & SCALE_MASK];
+    v = (e >> 16) * (v >> SCALE_BITS) + (v & SCALE_MASK) - ((e >> 2) & SCALE_MASK);
+    while (v < RANS_L && *p < end) {
+        v = (v << 8) | *(*p)++;
+    }
+    *x = v;
+    return (trit_t)((int)(e & 3) - 1);
+}
+
+// dec_step_fast is dec_step for when at least 2 bytes remain: a state
+// never needs more than 2 (it falls at most 2^11 below RANS_L), so both
+// refills are taken without branches.
+static inline trit_t dec_step_fast(const uint32_t *tab, uint32_t *x, const uint8_t **p) {
+    uint32_t v = *x;
+    uint32_t e = tab[v & SCALE_MASK];
+    v = (e >> 16) * (v >> SCALE_BITS) + (v & SCALE_MASK) - ((e >> 2) & SCALE_MASK);
+    const uint8_t *q = *p;
+    uint32_t take = v < RANS_L;
+    v = take ? (v << 8) | q[0] : v;
+    q += take;
+    take = v < RANS_L;
+    v = take ? (v << 8) | q[0] : v;
+    *p = q + take;
+    *x = v;
+    return (trit_t)((int)(e & 3) - 1);
+}
+
+// dec_get decodes count trits, trit j from state j mod LANES; returns
+// the advanced stream pointer. out must start on a multiple of LANES
+// within its block.
+static const uint8_t *dec_get(const uint32_t *tab, uint32_t x[LANES], const uint8_t *p,
+                              const uint8_t *end, trit_t *out, size_t count) {
+    size_t j = 0;
+    for (; j + LANES <= count && end - p >= 2 * LANES; j += LANES) {
+        for (int l = 0; l < LANES; l++) {
+            out[j + (size_t)l] = dec_step_fast(tab, &x[l], &p);
+        }
+    }
+    for (; j + LANES <= count; j += LANES) {
+        for (int l = 0; l < LANES; l++) {
+            out[j + (size_t)l] = dec_step(tab, &x[l], &p, end);
+        }
+    }
+    for (; j < count; j++) {
+        out[j] = dec_step(tab, &x[j % LANES], &p, end);
+    }
+    return p;
+}
+
+// decode_block reads one block of bn trits into t or the t5b1 bytes t5;
+// returns bytes consumed, or TRIT_RANS_ERROR.
+static size_t decode_block(const uint8_t *in, size_t len, size_t bn, trit_t *t, uint8_t *t5) {
+    size_t raw = TRIT5_PACKED_SIZE(bn);
+    if (len < 1) {
+        return TRIT_RANS_ERROR;
+    }
+    if (in[0] == MODE_RAW) {
+        if (len - 1 < raw) {
+            return TRIT_RANS_ERROR;
+        }
+        if (t) {
+            trit5_unpack_array(in + 1, bn, t);
+        } else {
+            memcpy(t5, in + 1, raw);
+        }
+        return 1 + raw;
+    }
+    if (in[0] != MODE_RANS || len < BLOCK_HEAD) {
+        return TRIT_RANS_ERROR;
+    }
+
+    uint32_t f[3];
+    f[TRIT_TO_UNSIGNED(TRIT_NEG)] = get16(in + 1);
+    f[TRIT_TO_UNSIGNED(TRIT_POS)] = get16(in + 3);
+    size_t plen = get32(in + 5);
+    if (f[0] + f[2] > SCALE || plen < 4 * LANES || plen > len - BLOCK_HEAD) {
+        return TRIT_RANS_ERROR;
+    }
+    f[TRIT_TO_UNSIGNED(TRIT_ZERO)] = SCALE - f[0] - f[2];
+
+    uint32_t tab[SCALE];
+    uint32_t x[LANES];
+    build_table(f, tab);
+    const uint8_t *p = in + BLOCK_HEAD;
+    const uint8_t *end = p + plen;
+    for (int l = 0; l < LANES; l++, p += 4) {
+        x[l] = get32(p);
+    }
+
+    if (t) {
+        p = dec_get(tab, x, p, end, t, bn);
+    } else {
+        trit_t stage[CHUNK];
+        for (size_t at = 0; at < bn; at += CHUNK) {
+            size_t cn = min_size(CHUNK, bn - at);
+            p = dec_get(tab, x, p, end, stage, cn);
+            trit5_pack_array(stage, cn, t5 + at / 5);
+        }
+    }
+
+    // A well-formed payload ends exactly where the states return to RANS_L
+    int ok = p == end;
+    for (int l = 0; l < LANES; l++) {
+        ok = ok && x[l] == RANS_L;
+    }
+    return ok ? BLOCK_HEAD + plen : TRIT_RANS_ERROR;
+}
+
+// decode walks the stream into t or t5.
+static size_t decode(const uint8_t *in, size_t len, trit_t *t, uint8_t *t5, size_t cap) {
+    size_t n = trit_rans_count(in, len);
+    if (n == TRIT_RANS_ERROR || n > cap) {
+        return TRIT_RANS_ERROR;
+    }
+    size_t o = STREAM_HEAD;
+    for (size_t bs = 0; bs < n; bs += TRIT_RANS_BLOCK) {
+        size_t bn = min_size(TRIT_RANS_BLOCK, n - bs);
+        size_t used = t ? decode_block(in + o, len - o, bn, t + bs, NULL)
+                        : decode_block(in + o, len - o, bn, NULL, t5 + bs / 5);
+        if (used == TRIT_RANS_ERROR) {
+            return TRIT_RANS_ERROR;
+        }
+        o += used;
+    }
+    return o == len ? n : TRIT_RANS_ERROR;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+// trit_rans_encode writes n trits as an entropy-coded stream.
+//
+// Parameters:
+//   in  - n valid trits
+//   out - TRIT_RANS_BOUND(n) bytes
+//
+// Returns: bytes written.
+size_t trit_rans_encode(const trit_t *in, size_t n, uint8_t *out) {
+    size_t o = STREAM_HEAD;
+    put64(out, n);
+    for (size_t bs = 0; bs < n; bs += TRIT_RANS_BLOCK) {
+        o += encode_block(in + bs, NULL, min_size(TRIT_RANS_BLOCK, n - bs), out + o);
+    }
+    return o;
+}
+
+// trit5_rans_encode writes the first n trits of a t5b1 buffer as an
+// entropy-coded stream. Bytes must be valid (0-242).
+size_t trit5_rans_encode(const uint8_t *in, size_t n, uint8_t *out) {
+    size_t o = STREAM_HEAD;
+    put64(out, n);
+    for (size_t bs = 0; bs < n; bs += TRIT_RANS_BLOCK) {
+        o += encode_block(NULL, in + bs / 5, min_size(TRIT_RANS_BLOCK, n - bs), out + o);
+    }
+    return o;
+}
+
+// trit_rans_count reads the trit count from a stream header.
+size_t trit_rans_count(const uint8_t *in, size_t len) {
+    if (len < STREAM_HEAD) {
+        return TRIT_RANS_ERROR;
+    }
+    uint64_t n = get64(in);
+    return n >= (uint64_t)TRIT_RANS_ERROR ? TRIT_RANS_ERROR : (size_t)n;
+}
+
+// trit_rans_decode expands a stream into trit_t values.
+//
+// Parameters:
+//   in  - len bytes from trit_rans_encode or trit5_rans_encode
+//   out - cap trits
+//
+// Returns: trits written, or TRIT_RANS_ERROR if the stream is malformed
+// (bad mode or frequencies, cut short, trailing bytes, states that do
+// not close) or holds more than cap trits. out may then be partly written.
+size_t trit_rans_decode(const uint8_t *in, size_t len, trit_t *out, size_t cap) {
+    return decode(in, len, out, NULL, cap);
+}
+
+// trit5_rans_decode expands a stream into t5b1 bytes
+// (TRIT5_PACKED_SIZE(cap) available; the last byte is zero-padded).
+size_t trit5_rans_decode(const uint8_t *in, size_t len, uint8_t *out, size_t cap) {
+    return decode(in, len, NULL, out, cap);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// Encoding cannot fail: the encoder watches the room left below the
+// raw size and falls back to t5b1. Decoding validates every header
+// field before use, never refills a state past the payload, and accepts
+// a block only if its payload is used up exactly and all states return
+// to RANS_L - the value the encoder started from.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-rans   # round-trips at many lengths and skews, trit_t and
+//                    # t5b1 paths interchangeable, raw fallback, sizes
+//                    # near the entropy, malformed streams
+//
+// Benchmark:
+//   make bench-rans  # bits/trit and MB/s at several zero fractions
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// No allocation, no state.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ CHUNK (multiple of 5 and LANES)
+//   ✅ How frequencies are rounded (scale_freqs) - streams carry them
+//
+// Modify with Extreme Care:
+//   ⚠️ LANES, SCALE_BITS, RANS_L, TRIT_RANS_BLOCK - each changes the
+//      stream format; archives written before would no longer decode
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Stream layout and byte order (see Core Design)
+//   ❌ Every stream must decode to exactly the trits encoded
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Decoding is a table load, a multiply-add and a predictable refill
+// branch per trit, with eight independent states to hide the latency.
+// Encoding adds a 64-bit multiply per trit. Both are a few cycles per
+// trit, so MB/s of trit_t output is in the hundreds; t5b1 paths add an
+// unpack or pack pass over L1-resident chunks.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "He telleth the number of the stars; he calleth them all by their
+// names." — Psalm 147:4
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
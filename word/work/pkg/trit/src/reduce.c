@@ -0,0 +1,887 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// reduce.c - Sum, Histogram and Balance Reductions
+// Key: B-word-work-pkg-trit-src-reduce
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritreduce.h, trit.h)
+//   Without TRIT_X86_SIMD (simd_internal.h) counts run the generic
+//   kernels: SWAR over trit_t, one summary-table row per t5b1 byte.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Signed sum, -1/0/+1 counts and min/max running balance of trit_t arrays
+// and t5b1 buffers, without unpacking the packed bytes.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Thou art weighed in the balances, and art found wanting."
+//            — Daniel 5:27
+//
+// Principle: A reckoning reads every entry once and keeps only the totals.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Monitoring statistics over buffers of many GB, at the speed the
+//       bytes can be read.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Reduce a trit sequence to its sum, histogram and balance
+//          extremes without paying for trit5_unpack_array first.
+//
+// Core Design: Everything is built from two counts, pos and neg:
+//   sum = pos - neg, zeros = n - pos - neg.
+//
+//   trit_t arrays:  compare each lane with +1 and -1 and subtract the
+//                   all-ones result from byte counters; psadbw folds the
+//                   counters into 64-bit totals before they can wrap.
+//   t5b1 bytes:     REDUCE5_TABLE[v] holds the byte's sum, nonzero count
+//                   and in-byte balance extremes (generic kernel: one
+//                   load per 5 trits). Vector kernels split each byte as
+//                   v = 27h + 9m + k with two mulhi per 16-bit lane, then
+//                   look up the packed pos | neg << 4 counts of the
+//                   2-trit digits h and k and the 1-trit digit m with
+//                   pshufb.
+//
+//   The running-balance extremes need order, so *_stats_array walks the
+//   sequence, one table row per t5b1 byte or per 4 trit_t (QUAD_TABLE).
+//   Whenever the balance sits at least s away from both extremes, the
+//   next s trits cannot set a new one: that run goes to the count
+//   kernel, and only its sum matters. On long buffers the extremes
+//   spread apart and most of the walk is skipped this way.
+//
+// Key Features:
+//   - No expansion of packed bytes, no allocation
+//   - SSE4.1: 16 bytes per step, AVX2: 32, AVX-512BW: 64
+//   - trit_stats_merge joins pieces in order, so callers may split work
+//
+// Philosophy: What cannot change the answer need not be looked at twice.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: string.h (memcpy)
+//   - Internal: tritreduce.h (trit_stats_t, prototypes), trit.h (trit_t,
+//     TRIT5_DECODE_TABLE, backend dispatch), simd.c (trit_backend_active)
+//   - Compiler: immintrin.h + target attributes (GCC/Clang, x86 only)
+//
+// What Uses This:
+//   - Monitoring over packed trit stores; bench/reduce_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None. REDUCE5_TABLE and QUAD_TABLE are built by the compiler.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <string.h>     // memcpy
+
+//--- Project Headers ---
+#include "tritreduce.h" // trit_stats_t, prototypes
+#include "trit.h"       // trit_t, backend dispatch
+#include "simd_internal.h" // TRIT_X86_SIMD, intrinsics
+
+// ────────────────────────────────────────────────────────────────
+// Constants
+// ────────────────────────────────────────────────────────────────
+
+// Walks hand a run to the count kernel only when it is at least this
+// long (shorter calls cost more than they save), and otherwise walk this
+// many items before looking again.
+#define SKIP_MIN_TRITS   256
+#define SKIP_MIN_BYTES   64
+#define WALK_RUN         64
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// step_t summarizes one step of a walk (a t5b1 byte, or 4 trit_t): its
+// trits' sum, how many are nonzero, and the lowest / highest balance
+// within the step (0 included).
+typedef struct {
+    int8_t sum;
+    uint8_t nonzero;
+    int8_t lo;
+    int8_t hi;
+} step_t;
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Row builders, as table.c: R_D(v, p) is the trit of byte v at place p.
+// Extremes fold from the last trit back, lo = min(0, d + lo(rest)).
+#define R_D(v, p)       ((((v) / (p)) % 3) - 1)
+#define R_MIN0(x)       ((x) < 0 ? (x) : 0)
+#define R_MAX0(x)       ((x) > 0 ? (x) : 0)
+#define R_LO(v)         R_MIN0(R_D(v, 81) + R_MIN0(R_D(v, 27) + R_MIN0(R_D(v, 9) + \
+                        R_MIN0(R_D(v, 3) + R_MIN0(R_D(v, 1))))))
+#define R_HI(v)         R_MAX0(R_D(v, 81) + R_MAX0(R_D(v, 27) + R_MAX0(R_D(v, 9) + \
+                        R_MAX0(R_D(v, 3) + R_MAX0(R_D(v, 1))))))
+#define R_SUM(v)        (R_D(v, 81) + R_D(v, 27) + R_D(v, 9) + R_D(v, 3) + R_D(v, 1))
+#define R_NZ(v)         (R_D(v, 81) * R_D(v, 81) + R_D(v, 27) * R_D(v, 27) + \
+                         R_D(v, 9) * R_D(v, 9) + R_D(v, 3) * R_D(v, 3) + R_D(v, 1) * R_D(v, 1))
+#define R_ROW(v)        { R_SUM(v), R_NZ(v), R_LO(v), R_HI(v) }
+#define R_ROWS3(v)      R_ROW(v), R_ROW((v) + 1), R_ROW((v) + 2)
+#define R_ROWS9(v)      R_ROWS3(v), R_ROWS3((v) + 3), R_ROWS3((v) + 6)
+#define R_ROWS27(v)     R_ROWS9(v), R_ROWS9((v) + 9), R_ROWS9((v) + 18)
+#define R_ROWS81(v)     R_ROWS27(v), R_ROWS27((v) + 27), R_ROWS27((v) + 54)
+#define R_ROWS243(v)    R_ROWS81(v), R_ROWS81((v) + 81), R_ROWS81((v) + 162)
+#define R_SPARE         { 0, 0, 0, 0 }
+
+// QUAD_TABLE rows: index = t0 | t1 << 2 | t2 << 4 | t3 << 6 with each
+// trit as its low two bits (0 → 0, +1 → 1, -1 → 3; 2 never occurs).
+#define Q_T(v, k)       ((((v) >> (2 * (k))) & 3) == 1 ? 1 : (((v) >> (2 * (k))) & 3) == 3 ? -1 : 0)
+#define Q_ROW(v)        { Q_T(v, 0) + Q_T(v, 1) + Q_T(v, 2) + Q_T(v, 3), \
+                          (Q_T(v, 0) != 0) + (Q_T(v, 1) != 0) + (Q_T(v, 2) != 0) + (Q_T(v, 3) != 0), \
+                          R_MIN0(Q_T(v, 0) + R_MIN0(Q_T(v, 1) + R_MIN0(Q_T(v, 2) + R_MIN0(Q_T(v, 3))))), \
+                          R_MAX0(Q_T(v, 0) + R_MAX0(Q_T(v, 1) + R_MAX0(Q_T(v, 2) + R_MAX0(Q_T(v, 3))))) }
+#define Q_ROWS4(v)      Q_ROW(v), Q_ROW((v) + 1), Q_ROW((v) + 2), Q_ROW((v) + 3)
+#define Q_ROWS16(v)     Q_ROWS4(v), Q_ROWS4((v) + 4), Q_ROWS4((v) + 8), Q_ROWS4((v) + 12)
+#define Q_ROWS64(v)     Q_ROWS16(v), Q_ROWS16((v) + 16), Q_ROWS16((v) + 32), Q_ROWS16((v) + 48)
+
+// REDUCE5_TABLE[v] summarizes byte v; spare bytes 243-255 read as five
+// zeros.
+static const step_t REDUCE5_TABLE[256] = {
+    R_ROWS243(0),
+    R_SPARE, R_SPARE, R_SPARE, R_SPARE, R_SPARE, R_SPARE, R_SPARE,
+    R_SPARE, R_SPARE, R_SPARE, R_SPARE, R_SPARE, R_SPARE
+};
+
+// QUAD_TABLE[q] summarizes 4 consecutive trit_t (see Q_T for q).
+static const step_t QUAD_TABLE[256] = {
+    Q_ROWS64(0), Q_ROWS64(64), Q_ROWS64(128), Q_ROWS64(192)
+};
+
+#if TRIT_X86_SIMD
+// pshufb rows: pos | neg << 4 for a 2-trit digit (0-8) and a 1-trit
+// digit (0-2). Indices past the last digit (spare bytes) count nothing.
+static const uint8_t COUNT2_LUT[16] = {
+    0x20, 0x10, 0x11, 0x10, 0x00, 0x01, 0x11, 0x01, 0x02, 0, 0, 0, 0, 0, 0, 0
+};
+static const uint8_t COUNT1_LUT[16] = {
+    0x10, 0x00, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+#endif
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static void count_generic(const trit_t *in, size_t n, uint64_t *pos, uint64_t *neg);
+static void count5_generic(const uint8_t *in, size_t bytes, uint64_t *pos, uint64_t *neg);
+
+#if TRIT_X86_SIMD
+static void count_sse41(const trit_t *in, size_t n, uint64_t *pos, uint64_t *neg);
+static void count_avx2(const trit_t *in, size_t n, uint64_t *pos, uint64_t *neg);
+static void count_avx512(const trit_t *in, size_t n, uint64_t *pos, uint64_t *neg);
+static void count5_sse41(const uint8_t *in, size_t bytes, uint64_t *pos, uint64_t *neg);
+static void count5_avx2(const uint8_t *in, size_t bytes, uint64_t *pos, uint64_t *neg);
+static void count5_avx512(const uint8_t *in, size_t bytes, uint64_t *pos, uint64_t *neg);
+#endif
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── trit_sum_array() / trit_count_array()   → count_trits()
+//   ├── trit_stats_array()                      → walk, count_trits() for skipped runs
+//   ├── trit5_sum_array() / trit5_count_array() → count_bytes() + tail byte
+//   ├── trit5_stats_array()                     → REDUCE5_TABLE walk, count_bytes()
+//   │                                             for skipped runs, tail byte
+//   └── trit_stats_merge()                      → sums add, extremes shift
+//
+//   Middle Rungs
+//   ├── count_trits() → count_{avx512, avx2, sse41, generic}
+//   └── count_bytes() → count5_{avx512, avx2, sse41, generic}
+//
+// Baton Flow:
+//   Entry → trit_backend_active() → kernel → vector steps → generic tail
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static uint64_t min_u64(uint64_t a, uint64_t b) {
+    return a < b ? a : b;
+}
+
+// skip_len is how many trits from balance bal cannot reach a value below
+// lo or above hi: the distance to the nearer extreme.
+static uint64_t skip_len(int64_t bal, int64_t lo, int64_t hi) {
+    return min_u64((uint64_t)(bal - lo), (uint64_t)(hi - bal));
+}
+
+// stats_from_counts fills the totals of a run whose extremes are known.
+static void stats_from_counts(trit_stats_t *s, uint64_t n, uint64_t pos, uint64_t neg) {
+    s->sum = (int64_t)pos - (int64_t)neg;
+    s->count[TRIT_TO_UNSIGNED(TRIT_NEG)] = neg;
+    s->count[TRIT_TO_UNSIGNED(TRIT_ZERO)] = n - pos - neg;
+    s->count[TRIT_TO_UNSIGNED(TRIT_POS)] = pos;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Generic Kernels (portable reference, vector tails)
+// ────────────────────────────────────────────────────────────────
+
+// count_generic: +1 is 0x01 and -1 is 0xFF, so of each byte bit 0 marks
+// nonzero and bit 1 marks negative; eight trits per word, one popcount
+// per plane (SWAR fold without a builtin).
+static void count_generic(const trit_t *in, size_t n, uint64_t *pos, uint64_t *neg) {
+    const uint64_t ones = 0x0101010101010101ULL;
+    uint64_t nz = 0;
+    uint64_t ng = 0;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w;
+        memcpy(&w, in + i, 8);
+        // Bytes of 0/1 fold to their count with one multiply.
+        nz += ((w & ones) * ones) >> 56;
+        ng += (((w >> 1) & ones) * ones) >> 56;
+    }
+    for (; i < n; i++) {
+        nz += (uint64_t)(in[i] != 0);
+        ng += (uint64_t)(in[i] < 0);
+    }
+    *pos += nz - ng;
+    *neg += ng;
+}
+
+static void count5_generic(const uint8_t *in, size_t bytes, uint64_t *pos, uint64_t *neg) {
+    int64_t sum = 0;
+    uint64_t nz = 0;
+    for (size_t i = 0; i < bytes; i++) {
+        sum += REDUCE5_TABLE[in[i]].sum;
+        nz += REDUCE5_TABLE[in[i]].nonzero;
+    }
+    *pos += (uint64_t)(((int64_t)nz + sum) / 2);
+    *neg += (uint64_t)(((int64_t)nz - sum) / 2);
+}
+
+#if TRIT_X86_SIMD
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - SSE4.1 Kernels (16 bytes per step)
+// ────────────────────────────────────────────────────────────────
+//
+// Byte counters grow by at most 1 (trit_t) or 5 (t5b1) per step, so they
+// are folded with psadbw every 255 or 51 steps.
+
+// hsum2_sse41 adds the two 64-bit lanes (through memory, so 32-bit x86
+// builds too).
+__attribute__((target("sse4.1")))
+static uint64_t hsum2_sse41(__m128i v) {
+    uint64_t lane[2];
+    _mm_storeu_si128((__m128i *)(void *)lane, v);
+    return lane[0] + lane[1];
+}
+
+__attribute__((target("sse4.1")))
+static void count_sse41(const trit_t *in, size_t n, uint64_t *pos, uint64_t *neg) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi8(1);
+    __m128i ptot = zero;
+    __m128i ntot = zero;
+    size_t i = 0;
+    while (i + 16 <= n) {
+        size_t steps = min_u64((n - i) / 16, 255);
+        __m128i pc = zero;
+        __m128i nc = zero;
+        for (size_t s = 0; s < steps; s++, i += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(in + i));
+            pc = _mm_sub_epi8(pc, _mm_cmpeq_epi8(v, one));
+            nc = _mm_sub_epi8(nc, _mm_cmpgt_epi8(zero, v));
+        }
+        ptot = _mm_add_epi64(ptot, _mm_sad_epu8(pc, zero));
+        ntot = _mm_add_epi64(ntot, _mm_sad_epu8(nc, zero));
+    }
+    *pos += hsum2_sse41(ptot);
+    *neg += hsum2_sse41(ntot);
+    count_generic(in + i, n - i, pos, neg);
+}
+
+// split5_sse41 returns the packed pos | neg << 4 counts of 16 bytes. Each
+// byte is worked in a 16-bit lane (even and odd bytes apart): h = v/27 and
+// m = r/9 by mulhi with ceil(65536/d), exact for v < 256.
+__attribute__((target("sse4.1")))
+static __m128i split5_sse41(__m128i v, __m128i lut2, __m128i lut1) {
+    const __m128i low = _mm_set1_epi16(0x00FF);
+    const __m128i inv27 = _mm_set1_epi16(2428);
+    const __m128i inv9 = _mm_set1_epi16(7282);
+    const __m128i d27 = _mm_set1_epi16(27);
+    const __m128i d9 = _mm_set1_epi16(9);
+    __m128i e = _mm_and_si128(v, low);
+    __m128i o = _mm_srli_epi16(v, 8);
+    __m128i he = _mm_mulhi_epu16(e, inv27);
+    __m128i ho = _mm_mulhi_epu16(o, inv27);
+    e = _mm_sub_epi16(e, _mm_mullo_epi16(he, d27));
+    o = _mm_sub_epi16(o, _mm_mullo_epi16(ho, d27));
+    __m128i me = _mm_mulhi_epu16(e, inv9);
+    __m128i mo = _mm_mulhi_epu16(o, inv9);
+    e = _mm_sub_epi16(e, _mm_mullo_epi16(me, d9));
+    o = _mm_sub_epi16(o, _mm_mullo_epi16(mo, d9));
+    __m128i h = _mm_or_si128(he, _mm_slli_epi16(ho, 8));
+    __m128i m = _mm_or_si128(me, _mm_slli_epi16(mo, 8));
+    __m128i k = _mm_or_si128(e, _mm_slli_epi16(o, 8));
+    return _mm_add_epi8(_mm_add_epi8(_mm_shuffle_epi8(lut2, h), _mm_shuffle_epi8(lut1, m)),
+                        _mm_shuffle_epi8(lut2, k));
+}
+
+__attribute__((target("sse4.1")))
+static void count5_sse41(const uint8_t *in, size_t bytes, uint64_t *pos, uint64_t *neg) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i nib = _mm_set1_epi8(0x0F);
+    const __m128i lut2 = _mm_loadu_si128((const __m128i *)(const void *)COUNT2_LUT);
+    const __m128i lut1 = _mm_loadu_si128((const __m128i *)(const void *)COUNT1_LUT);
+    __m128i ptot = zero;
+    __m128i ntot = zero;
+    size_t i = 0;
+    while (i + 16 <= bytes) {
+        size_t steps = min_u64((bytes - i) / 16, 51);
+        __m128i pc = zero;
+        __m128i nc = zero;
+        for (size_t s = 0; s < steps; s++, i += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(in + i));
+            __m128i c = split5_sse41(v, lut2, lut1);
+            pc = _mm_add_epi8(pc, _mm_and_si128(c, nib));
+            nc = _mm_add_epi8(nc, _mm_and_si128(_mm_srli_epi16(c, 4), nib));
+        }
+        ptot = _mm_add_epi64(ptot, _mm_sad_epu8(pc, zero));
+        ntot = _mm_add_epi64(ntot, _mm_sad_epu8(nc, zero));
+    }
+    *pos += hsum2_sse41(ptot);
+    *neg += hsum2_sse41(ntot);
+    count5_generic(in + i, bytes - i, pos, neg);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - AVX2 Kernels (32 bytes per step)
+// ────────────────────────────────────────────────────────────────
+
+// hsum4_avx2 adds the four 64-bit lanes.
+__attribute__((target("avx2")))
+static uint64_t hsum4_avx2(__m256i v) {
+    uint64_t lane[4];
+    _mm256_storeu_si256((__m256i *)(void *)lane, v);
+    return lane[0] + lane[1] + lane[2] + lane[3];
+}
+
+__attribute__((target("avx2")))
+static void count_avx2(const trit_t *in, size_t n, uint64_t *pos, uint64_t *neg) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi8(1);
+    __m256i ptot = zero;
+    __m256i ntot = zero;
+    size_t i = 0;
+    while (i + 32 <= n) {
+        size_t steps = min_u64((n - i) / 32, 255);
+        __m256i pc = zero;
+        __m256i nc = zero;
+        for (size_t s = 0; s < steps; s++, i += 32) {
+            __m256i v = _mm256_loadu_si256((const __m256i *)(const void *)(in + i));
+            pc = _mm256_sub_epi8(pc, _mm256_cmpeq_epi8(v, one));
+            nc = _mm256_sub_epi8(nc, _mm256_cmpgt_epi8(zero, v));
+        }
+        ptot = _mm256_add_epi64(ptot, _mm256_sad_epu8(pc, zero));
+        ntot = _mm256_add_epi64(ntot, _mm256_sad_epu8(nc, zero));
+    }
+    *pos += hsum4_avx2(ptot);
+    *neg += hsum4_avx2(ntot);
+    count_generic(in + i, n - i, pos, neg);
+}
+
+__attribute__((target("avx2")))
+static __m256i split5_avx2(__m256i v, __m256i lut2, __m256i lut1) {
+    const __m256i low = _mm256_set1_epi16(0x00FF);
+    const __m256i inv27 = _mm256_set1_epi16(2428);
+    const __m256i inv9 = _mm256_set1_epi16(7282);
+    const __m256i d27 = _mm256_set1_epi16(27);
+    const __m256i d9 = _mm256_set1_epi16(9);
+    __m256i e = _mm256_and_si256(v, low);
+    __m256i o = _mm256_srli_epi16(v, 8);
+    __m256i he = _mm256_mulhi_epu16(e, inv27);
+    __m256i ho = _mm256_mulhi_epu16(o, inv27);
+    e = _mm256_sub_epi16(e, _mm256_mullo_epi16(he, d27));
+    o = _mm256_sub_epi16(o, _mm256_mullo_epi16(ho, d27));
+    __m256i me = _mm256_mulhi_epu16(e, inv9);
+    __m256i mo = _mm256_mulhi_epu16(o, inv9);
+    e = _mm256_sub_epi16(e, _mm256_mullo_epi16(me, d9));
+    o = _mm256_sub_epi16(o, _mm256_mullo_epi16(mo, d9));
+    __m256i h = _mm256_or_si256(he, _mm256_slli_epi16(ho, 8));
+    __m256i m = _mm256_or_si256(me, _mm256_slli_epi16(mo, 8));
+    __m256i k = _mm256_or_si256(e, _mm256_slli_epi16(o, 8));
+    return _mm256_add_epi8(_mm256_add_epi8(_mm256_shuffle_epi8(lut2, h),
+                                           _mm256_shuffle_epi8(lut1, m)),
+                           _mm256_shuffle_epi8(lut2, k));
+}
+
+__attribute__((target("avx2")))
+static void count5_avx2(const uint8_t *in, size_t bytes, uint64_t *pos, uint64_t *neg) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i nib = _mm256_set1_epi8(0x0F);
+    const __m256i lut2 = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)(const void *)COUNT2_LUT));
+    const __m256i lut1 = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)(const void *)COUNT1_LUT));
+    __m256i ptot = zero;
+    __m256i ntot = zero;
+    size_t i = 0;
+    while (i + 32 <= bytes) {
+        size_t steps = min_u64((bytes - i) / 32, 51);
+        __m256i pc = zero;
+        __m256i nc = zero;
+        for (size_t s = 0; s < steps; s++, i += 32) {
+            __m256i v = _mm256_loadu_si256((const __m256i *)(const void *)(in + i));
+            __m256i c = split5_avx2(v, lut2, lut1);
+            pc = _mm256_add_epi8(pc, _mm256_and_si256(c, nib));
+            nc = _mm256_add_epi8(nc, _mm256_and_si256(_mm256_srli_epi16(c, 4), nib));
+        }
+        ptot = _mm256_add_epi64(ptot, _mm256_sad_epu8(pc, zero));
+        ntot = _mm256_add_epi64(ntot, _mm256_sad_epu8(nc, zero));
+    }
+    *pos += hsum4_avx2(ptot);
+    *neg += hsum4_avx2(ntot);
+    count5_generic(in + i, bytes - i, pos, neg);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - AVX-512BW Kernels (64 bytes per step)
+// ────────────────────────────────────────────────────────────────
+
+__attribute__((target("avx512f,avx512bw")))
+static void count_avx512(const trit_t *in, size_t n, uint64_t *pos, uint64_t *neg) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i one = _mm512_set1_epi8(1);
+    __m512i ptot = zero;
+    __m512i ntot = zero;
+    size_t i = 0;
+    while (i + 64 <= n) {
+        size_t steps = min_u64((n - i) / 64, 255);
+        __m512i pc = zero;
+        __m512i nc = zero;
+        for (size_t s = 0; s < steps; s++, i += 64) {
+            __m512i v = _mm512_loadu_si512((const void *)(in + i));
+            pc = _mm512_mask_add_epi8(pc, _mm512_cmpeq_epi8_mask(v, one), pc, one);
+            nc = _mm512_mask_add_epi8(nc, _mm512_movepi8_mask(v), nc, one);
+        }
+        ptot = _mm512_add_epi64(ptot, _mm512_sad_epu8(pc, zero));
+        ntot = _mm512_add_epi64(ntot, _mm512_sad_epu8(nc, zero));
+    }
+    *pos += (uint64_t)_mm512_reduce_add_epi64(ptot);
+    *neg += (uint64_t)_mm512_reduce_add_epi64(ntot);
+    count_generic(in + i, n - i, pos, neg);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static __m512i split5_avx512(__m512i v, __m512i lut2, __m512i lut1) {
+    const __m512i low = _mm512_set1_epi16(0x00FF);
+    const __m512i inv27 = _mm512_set1_epi16(2428);
+    const __m512i inv9 = _mm512_set1_epi16(7282);
+    const __m512i d27 = _mm512_set1_epi16(27);
+    const __m512i d9 = _mm512_set1_epi16(9);
+    __m512i e = _mm512_and_si512(v, low);
+    __m512i o = _mm512_srli_epi16(v, 8);
+    __m512i he = _mm512_mulhi_epu16(e, inv27);
+    __m512i ho = _mm512_mulhi_epu16(o, inv27);
+    e = _mm512_sub_epi16(e, _mm512_mullo_epi16(he, d27));
+    o = _mm512_sub_epi16(o, _mm512_mullo_epi16(ho, d27));
+    __m512i me = _mm512_mulhi_epu16(e, inv9);
+    __m512i mo = _mm512_mulhi_epu16(o, inv9);
+    e = _mm512_sub_epi16(e, _mm512_mullo_epi16(me, d9));
+    o = _mm512_sub_epi16(o, _mm512_mullo_epi16(mo, d9));
+    __m512i h = _mm512_or_si512(he, _mm512_slli_epi16(ho, 8));
+    __m512i m = _mm512_or_si512(me, _mm512_slli_epi16(mo, 8));
+    __m512i k = _mm512_or_si512(e, _mm512_slli_epi16(o, 8));
+    return _mm512_add_epi8(_mm512_add_epi8(_mm512_shuffle_epi8(lut2, h),
+                                           _mm512_shuffle_epi8(lut1, m)),
+                           _mm512_shuffle_epi8(lut2, k));
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static void count5_avx512(const uint8_t *in, size_t bytes, uint64_t *pos, uint64_t *neg) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i nib = _mm512_set1_epi8(0x0F);
+    const __m512i lut2 = _mm512_broadcast_i32x4(
+        _mm_loadu_si128((const __m128i *)(const void *)COUNT2_LUT));
+    const __m512i lut1 = _mm512_broadcast_i32x4(
+        _mm_loadu_si128((const __m128i *)(const void *)COUNT1_LUT));
+    __m512i ptot = zero;
+    __m512i ntot = zero;
+    size_t i = 0;
+    while (i + 64 <= bytes) {
+        size_t steps = min_u64((bytes - i) / 64, 51);
+        __m512i pc = zero;
+        __m512i nc = zero;
+        for (size_t s = 0; s < steps; s++, i += 64) {
+            __m512i v = _mm512_loadu_si512((const void *)(in + i));
+            __m512i c = split5_avx512(v, lut2, lut1);
+            pc = _mm512_add_epi8(pc, _mm512_and_si512(c, nib));
+            nc = _mm512_add_epi8(nc, _mm512_and_si512(_mm512_srli_epi16(c, 4), nib));
+        }
+        ptot = _mm512_add_epi64(ptot, _mm512_sad_epu8(pc, zero));
+        ntot = _mm512_add_epi64(ntot, _mm512_sad_epu8(nc, zero));
+    }
+    *pos += (uint64_t)_mm512_reduce_add_epi64(ptot);
+    *neg += (uint64_t)_mm512_reduce_add_epi64(ntot);
+    count5_generic(in + i, bytes - i, pos, neg);
+}
+
+#endif // TRIT_X86_SIMD
+
+// ────────────────────────────────────────────────────────────────
+// Middle Rungs - Dispatch
+// ────────────────────────────────────────────────────────────────
+
+// count_trits adds the +1 and -1 counts of n trit_t to *pos / *neg.
+static void count_trits(const trit_t *in, size_t n, uint64_t *pos, uint64_t *neg) {
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: count_avx512(in, n, pos, neg); return;
+    case TRIT_BACKEND_AVX2:   count_avx2(in, n, pos, neg);   return;
+    case TRIT_BACKEND_SSE41:  count_sse41(in, n, pos, neg);  return;
+#endif
+    default:                  count_generic(in, n, pos, neg); return;
+    }
+}
+
+// count_bytes adds the +1 and -1 counts of whole t5b1 bytes.
+static void count_bytes(const uint8_t *in, size_t bytes, uint64_t *pos, uint64_t *neg) {
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: count5_avx512(in, bytes, pos, neg); return;
+    case TRIT_BACKEND_AVX2:   count5_avx2(in, bytes, pos, neg);   return;
+    case TRIT_BACKEND_SSE41:  count5_sse41(in, bytes, pos, neg);  return;
+#endif
+    default:                  count5_generic(in, bytes, pos, neg); return;
+    }
+}
+
+// count_packed counts n trits of a t5b1 buffer: whole bytes, then the
+// first n % 5 trits of a short final byte (its padding is not counted).
+static void count_packed(const uint8_t *in, size_t n, uint64_t *pos, uint64_t *neg) {
+    size_t full = n / 5;
+    count_bytes(in, full, pos, neg);
+    for (size_t j = 0; j < n % 5; j++) {
+        trit_t t = TRIT5_DECODE_TABLE[in[full]][j];
+        *pos += (uint64_t)(t > 0);
+        *neg += (uint64_t)(t < 0);
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+// trit_sum_array returns Σ in[i] (pos - neg).
+int64_t trit_sum_array(const trit_t *in, size_t n) {
+    uint64_t pos = 0;
+    uint64_t neg = 0;
+    count_trits(in, n, &pos, &neg);
+    return (int64_t)pos - (int64_t)neg;
+}
+
+// trit_count_array sets counts[TRIT_TO_UNSIGNED(t)] to the number of
+// elements equal to t.
+void trit_count_array(const trit_t *in, size_t n, uint64_t counts[3]) {
+    trit_stats_t s;
+    uint64_t pos = 0;
+    uint64_t neg = 0;
+    count_trits(in, n, &pos, &neg);
+    stats_from_counts(&s, n, pos, neg);
+    counts[0] = s.count[0];
+    counts[1] = s.count[1];
+    counts[2] = s.count[2];
+}
+
+// trit_stats_array walks the running balance of in[0..n-1].
+//
+// Runs that cannot reach a new extreme (skip_len) are counted in bulk;
+// the rest is walked 4 trits per QUAD_TABLE row, WALK_RUN trits between
+// checks, and the last n % 4 one at a time.
+//
+// Parameters:
+//   in - n valid trits
+//   n  - element count
+//
+// Returns: sum, counts and balance extremes (all zero for n = 0)
+trit_stats_t trit_stats_array(const trit_t *in, size_t n) {
+    trit_stats_t s;
+    int64_t bal = 0;
+    int64_t lo = 0;
+    int64_t hi = 0;
+    uint64_t pos = 0;
+    uint64_t neg = 0;
+    int64_t sum = 0;            // walked trits
+    uint64_t nonzero = 0;       // walked trits
+    size_t i = 0;
+    while (i < n) {
+        uint64_t skip = min_u64(skip_len(bal, lo, hi), n - i);
+        if (skip >= SKIP_MIN_TRITS) {
+            uint64_t p = 0;
+            uint64_t q = 0;
+            count_trits(in + i, (size_t)skip, &p, &q);
+            bal += (int64_t)p - (int64_t)q;
+            pos += p;
+            neg += q;
+            i += (size_t)skip;
+            continue;
+        }
+        size_t end = i + ((size_t)min_u64(WALK_RUN, n - i) & ~(size_t)3);
+        if (end == i) {
+            break;              // under 4 trits left
+        }
+        for (; i < end; i += 4) {
+            unsigned q = ((unsigned)in[i] & 3u) | ((unsigned)in[i + 1] & 3u) << 2 |
+                         ((unsigned)in[i + 2] & 3u) << 4 | ((unsigned)in[i + 3] & 3u) << 6;
+            step_t r = QUAD_TABLE[q];
+            lo = bal + r.lo < lo ? bal + r.lo : lo;
+            hi = bal + r.hi > hi ? bal + r.hi : hi;
+            bal += r.sum;
+            sum += r.sum;
+            nonzero += r.nonzero;
+        }
+    }
+    for (; i < n; i++) {
+        bal += in[i];
+        lo = bal < lo ? bal : lo;
+        hi = bal > hi ? bal : hi;
+        sum += in[i];
+        nonzero += (uint64_t)(in[i] != 0);
+    }
+    pos += (uint64_t)(((int64_t)nonzero + sum) / 2);
+    neg += (uint64_t)(((int64_t)nonzero - sum) / 2);
+    stats_from_counts(&s, n, pos, neg);
+    s.min_prefix = lo;
+    s.max_prefix = hi;
+    return s;
+}
+
+// trit5_sum_array returns the sum of the first n trits of a t5b1 buffer.
+int64_t trit5_sum_array(const uint8_t *in, size_t n) {
+    uint64_t pos = 0;
+    uint64_t neg = 0;
+    count_packed(in, n, &pos, &neg);
+    return (int64_t)pos - (int64_t)neg;
+}
+
+// trit5_count_array sets counts[TRIT_TO_UNSIGNED(t)] for the first n
+// trits of a t5b1 buffer.
+void trit5_count_array(const uint8_t *in, size_t n, uint64_t counts[3]) {
+    trit_stats_t s;
+    uint64_t pos = 0;
+    uint64_t neg = 0;
+    count_packed(in, n, &pos, &neg);
+    stats_from_counts(&s, n, pos, neg);
+    counts[0] = s.count[0];
+    counts[1] = s.count[1];
+    counts[2] = s.count[2];
+}
+
+// trit5_stats_array walks the running balance of the first n trits of a
+// t5b1 buffer, one REDUCE5_TABLE row per byte.
+//
+// A byte moves the balance by at most 5, so from balance bal the next
+// skip_len / 5 bytes are counted in bulk. The short final byte is walked
+// trit by trit.
+//
+// Parameters:
+//   in - TRIT5_PACKED_SIZE(n) bytes (0-242 each)
+//   n  - trit count
+//
+// Returns: sum, counts and balance extremes (all zero for n = 0)
+trit_stats_t trit5_stats_array(const uint8_t *in, size_t n) {
+    trit_stats_t s;
+    size_t full = n / 5;
+    int64_t bal = 0;
+    int64_t lo = 0;
+    int64_t hi = 0;
+    uint64_t pos = 0;
+    uint64_t neg = 0;
+    int64_t sum = 0;            // walked bytes
+    uint64_t nonzero = 0;       // walked bytes
+    size_t i = 0;
+    while (i < full) {
+        uint64_t skip = min_u64(skip_len(bal, lo, hi) / 5, full - i);
+        if (skip >= SKIP_MIN_BYTES) {
+            uint64_t p = 0;
+            uint64_t q = 0;
+            count_bytes(in + i, (size_t)skip, &p, &q);
+            bal += (int64_t)p - (int64_t)q;
+            pos += p;
+            neg += q;
+            i += (size_t)skip;
+            continue;
+        }
+        size_t end = (size_t)min_u64(i + WALK_RUN, full);
+        for (; i < end; i++) {
+            step_t r = REDUCE5_TABLE[in[i]];
+            lo = bal + r.lo < lo ? bal + r.lo : lo;
+            hi = bal + r.hi > hi ? bal + r.hi : hi;
+            bal += r.sum;
+            sum += r.sum;
+            nonzero += r.nonzero;
+        }
+    }
+    pos += (uint64_t)(((int64_t)nonzero + sum) / 2);
+    neg += (uint64_t)(((int64_t)nonzero - sum) / 2);
+    for (size_t j = 0; j < n % 5; j++) {
+        trit_t t = TRIT5_DECODE_TABLE[in[full]][j];
+        bal += t;
+        lo = bal < lo ? bal : lo;
+        hi = bal > hi ? bal : hi;
+        pos += (uint64_t)(t > 0);
+        neg += (uint64_t)(t < 0);
+    }
+    stats_from_counts(&s, n, pos, neg);
+    s.min_prefix = lo;
+    s.max_prefix = hi;
+    return s;
+}
+
+// trit_stats_merge returns the stats of sequence a followed by b: b's
+// walk starts where a's ended, so its extremes shift by a.sum.
+trit_stats_t trit_stats_merge(trit_stats_t a, trit_stats_t b) {
+    trit_stats_t s;
+    int64_t lo = a.sum + b.min_prefix;
+    int64_t hi = a.sum + b.max_prefix;
+    s.sum = a.sum + b.sum;
+    for (int t = 0; t < 3; t++) {
+        s.count[t] = a.count[t] + b.count[t];
+    }
+    s.min_prefix = lo < a.min_prefix ? lo : a.min_prefix;
+    s.max_prefix = hi > a.max_prefix ? hi : a.max_prefix;
+    return s;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// Nothing can fail. Inputs are assumed valid, as for trit5_unpack_array:
+// spare bytes (243-255) count as at most five trits of unspecified sign,
+// so counts stay consistent (zeros never underflow) but differ between
+// backends. Totals are 64-bit; a walk cannot overflow before n does.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-reduce   # every backend vs unpack-and-loop, all lengths
+//                      # 0-400 (vector body, tails, short byte), long
+//                      # walks that skip, merge of split buffers
+//
+// Benchmark:
+//   make bench-reduce  # trit5_unpack_array + loop vs each reduction
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// No allocation, no state.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ SKIP_MIN_* / WALK_RUN (re-run make bench-reduce)
+//   ✅ Unrolling the vector loops (results must not change)
+//
+// Modify with Extreme Care:
+//   ⚠️ Counter fold intervals: 255 steps of +1, 51 steps of +5 per byte
+//   ⚠️ mulhi constants 2428 / 7282 are exact only for lanes below 256
+//   ⚠️ Skip lengths: a run of s trits may move the balance by s, so it
+//      must not exceed the distance to either extreme
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ The empty prefix is part of the walk (min ≤ 0 ≤ max)
+//   ❌ Padding trits of a short final byte are never counted
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Sums and counts read each byte once and run at memory bandwidth on
+// every vector backend. Stats cost one table row per byte while the walk
+// is near an extreme; once the extremes are far apart (on a random walk,
+// after about the first million trits) almost all of a buffer is counted
+// in bulk instead.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Weighed in the balances." — Daniel 5:27
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
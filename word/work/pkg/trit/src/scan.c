@@ -0,0 +1,808 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// scan.c - Prefix Sums and Navigation Scans
+// Key: B-word-work-pkg-trit-src-scan
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritscan.h, tritreduce.h, trit.h, dimension.h)
+//   Without TRIT_X86_SIMD (simd_internal.h) sums and navigation step
+//   one trit at a time. The _mt scans need POSIX threads (thread.c;
+//   link with -pthread).
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Carry Propagation]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Inclusive / exclusive prefix sums of trit_t arrays into int32 / int64,
+// and trit_navigate folded along a sequence of directions - scanned in
+// blocks so long inputs can be split across threads.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Line upon line, line upon line; here a little, and there a
+//            little." — Isaiah 28:10
+//
+// Principle: Each step stands on all the steps before it; the whole is
+//            only ever the last step plus what came first.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Running totals of trit sequences, and the running position of
+//       trit_navigate, for buffers of 100M+ elements.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Turn a serial fold into a blocked scan: SIMD within a block,
+//          and a carry per block so blocks are independent.
+//
+// Core Design:
+//
+//   Prefix sums. Sixteen trits are scanned as int8 lanes in four
+//   shift-and-add steps (|sum| ≤ 16 fits), widened to int32 / int64
+//   lanes (pmovsx), and offset by the carry broadcast to every lane. The
+//   carry then grows by lane 15. Exclusive sums subtract the input
+//   before widening.
+//
+//   Navigation. One step x → trit_navigate(x, d) is a map on {-1, 0, +1},
+//   held as its three images (lo, mid, hi) = (max(d - 1, -1), d,
+//   min(d + 1, 1)). Maps compose: (A ∘ B)(x) = A(B(x)), one image at a
+//   time by two blends. Kogge-Stone over 16 lanes (shift 1, 2, 4, 8,
+//   identity shifted in) leaves lane i holding the map of steps 0..i, as
+//   adder.c does for carries. Applying the maps to the broadcast start
+//   gives 16 outputs; lane 15 is the next start.
+//
+//   Blocked use. Pass one summarizes each block (trit_sum_array, or
+//   trit_navigate_map for the 3-entry end map); chaining the summaries in
+//   order gives every block's carry or start; pass two scans each block
+//   with it. Both passes are independent across blocks. The _mt forms cut
+//   the input into one block per thread (at least SCAN_MT_MIN_BLOCK
+//   trits) and run both passes through thread.c.
+//
+// Key Features:
+//   - Prefix sums: SSE4.1 / AVX2 / AVX-512BW widen 16 trits per step
+//   - Navigation: 16 trits per step (SSE4.1 kernel on every x86 backend)
+//   - Every function returns the carry or position for the next block
+//   - _mt forms run both passes on up to `threads` threads
+//
+// Philosophy: A fold is a scan that forgot its middle.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Internal: tritscan.h (prefix sum prototypes), trit.h (trit_t,
+//     backend dispatch), dimension.h (trit_navigate_scan/map prototypes),
+//     simd.c (trit_backend_active), tritreduce.h / reduce.c
+//     (trit_sum_array), thread.c
+//     (trit_threads_run)
+//   - Compiler: immintrin.h + target attributes (GCC/Clang, x86 only)
+//
+// What Uses This:
+//   - Callers indexing or monitoring long trit streams; bench/scan_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: The plain scans run on the calling thread. The _mt scans
+//   run the blocked form below on up to `threads` threads through
+//   thread.c, started and joined inside the call; callers with their own
+//   threads can run the same two passes themselves.
+//
+// State: None. The backend choice lives in simd.c.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "tritscan.h"   // prefix sum prototypes
+#include "tritreduce.h" // trit_sum_array
+#include "trit.h"       // trit_t, backend dispatch
+#include "dimension.h"  // trit_navigate_scan, trit_navigate_map
+#include "simd_internal.h" // TRIT_X86_SIMD, intrinsics
+#include "thread_internal.h" // trit_threads_run, TRIT_THREADS_MAX
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+// Fewest trits an _mt scan gives one thread: below this, starting and
+// joining the thread costs more than the block.
+#define SCAN_MT_MIN_BLOCK ((size_t)1 << 16)
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// trit_navigate(x, d) for x + d = -2..+2, indexed by x + d + 2.
+static const trit_t NAV_TABLE[5] = { -1, -1, 0, 1, 1 };
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// scan_job_t is one _mt scan cut into blocks of `per` trits. width is 32
+// or 64 for prefix sums, 0 for navigation. Pass one fills sum / map for
+// every block but the last; the caller chains them into carry / start;
+// pass two scans each block and the last one sets end.
+typedef struct {
+    const trit_t *in;
+    size_t n, per;
+    int width, excl;
+    void *out;
+    uint64_t sum[TRIT_THREADS_MAX], carry[TRIT_THREADS_MAX];
+    trit_t map[TRIT_THREADS_MAX][3], start[TRIT_THREADS_MAX];
+    uint64_t end;
+} scan_job_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static uint32_t sum32_scalar(const trit_t *in, size_t n, uint32_t carry, int excl, int32_t *out);
+static uint64_t sum64_scalar(const trit_t *in, size_t n, uint64_t carry, int excl, int64_t *out);
+static trit_t nav_scalar(const trit_t *d, size_t n, trit_t s, trit_t *out);
+static void map_scalar(const trit_t *d, size_t n, trit_t map[3]);
+static unsigned scan_split(scan_job_t *j, unsigned threads);
+static void scan_pass1(void *ctx, unsigned i);
+static void scan_pass2(void *ctx, unsigned i);
+static uint64_t sum_mt(scan_job_t *j, uint64_t carry, unsigned threads);
+
+#if TRIT_X86_SIMD
+static uint32_t sum32_sse41(const trit_t *in, size_t n, uint32_t carry, int excl, int32_t *out);
+static uint32_t sum32_avx2(const trit_t *in, size_t n, uint32_t carry, int excl, int32_t *out);
+static uint32_t sum32_avx512(const trit_t *in, size_t n, uint32_t carry, int excl, int32_t *out);
+static uint64_t sum64_sse41(const trit_t *in, size_t n, uint64_t carry, int excl, int64_t *out);
+static uint64_t sum64_avx2(const trit_t *in, size_t n, uint64_t carry, int excl, int64_t *out);
+static uint64_t sum64_avx512(const trit_t *in, size_t n, uint64_t carry, int excl, int64_t *out);
+static trit_t nav_sse41(const trit_t *d, size_t n, trit_t s, trit_t *out);
+static void map_sse41(const trit_t *d, size_t n, trit_t map[3]);
+#endif
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── trit_prefix_sum_i32() / _excl_i32() → sum32_{avx512, avx2, sse41, scalar}
+//   ├── trit_prefix_sum_i64() / _excl_i64() → sum64_{avx512, avx2, sse41, scalar}
+//   ├── trit_navigate_scan()                → nav_{sse41, scalar}
+//   ├── trit_navigate_map()                 → map_{sse41, scalar}
+//   ├── trit_prefix_sum_*_mt()              → sum_mt()
+//   └── trit_navigate_scan_mt()             → scan_split(), pass one,
+//                                             chain the maps, pass two
+//
+//   Middle Rungs (x86)
+//   ├── prefix16_sse41() → int8 inclusive scan of 16 lanes
+//   └── maps16_sse41()   → step maps of 16 lanes, Kogge-Stone composed
+//
+//   Threaded Driver
+//   ├── sum_mt()     → trit_threads_run(scan_pass1), chain carries,
+//   │                  trit_threads_run(scan_pass2)
+//   └── scan_pass1() → trit_sum_array / trit_navigate_map per block;
+//       scan_pass2() → sum32 / sum64 / trit_navigate_scan per block
+//
+// Baton Flow:
+//   Entry → trit_backend_active() → kernel → 16-trit steps → scalar tail
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Scalar Kernels (portable reference, vector tails)
+// ────────────────────────────────────────────────────────────────
+//
+// Sums run in unsigned arithmetic so int32 results wrap instead of
+// overflowing.
+
+static uint32_t sum32_scalar(const trit_t *in, size_t n, uint32_t carry, int excl, int32_t *out) {
+    if (excl) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = (int32_t)carry;
+            carry += (uint32_t)(int32_t)in[i];
+        }
+        return carry;
+    }
+    for (size_t i = 0; i < n; i++) {
+        carry += (uint32_t)(int32_t)in[i];
+        out[i] = (int32_t)carry;
+    }
+    return carry;
+}
+
+static uint64_t sum64_scalar(const trit_t *in, size_t n, uint64_t carry, int excl, int64_t *out) {
+    if (excl) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = (int64_t)carry;
+            carry += (uint64_t)(int64_t)in[i];
+        }
+        return carry;
+    }
+    for (size_t i = 0; i < n; i++) {
+        carry += (uint64_t)(int64_t)in[i];
+        out[i] = (int64_t)carry;
+    }
+    return carry;
+}
+
+static trit_t nav_scalar(const trit_t *d, size_t n, trit_t s, trit_t *out) {
+    for (size_t i = 0; i < n; i++) {
+        s = NAV_TABLE[s + d[i] + 2];
+        out[i] = s;
+    }
+    return s;
+}
+
+// map_scalar runs the three starts side by side.
+static void map_scalar(const trit_t *d, size_t n, trit_t map[3]) {
+    trit_t lo = map[0];
+    trit_t mid = map[1];
+    trit_t hi = map[2];
+    for (size_t i = 0; i < n; i++) {
+        lo = NAV_TABLE[lo + d[i] + 2];
+        mid = NAV_TABLE[mid + d[i] + 2];
+        hi = NAV_TABLE[hi + d[i] + 2];
+    }
+    map[0] = lo;
+    map[1] = mid;
+    map[2] = hi;
+}
+
+#if TRIT_X86_SIMD
+
+// ────────────────────────────────────────────────────────────────
+// Middle Rungs - 16-Lane Scans (SSE4.1)
+// ────────────────────────────────────────────────────────────────
+
+// prefix16_sse41 returns the inclusive int8 scan of 16 lanes.
+__attribute__((target("sse4.1")))
+static __m128i prefix16_sse41(__m128i v) {
+    v = _mm_add_epi8(v, _mm_slli_si128(v, 1));
+    v = _mm_add_epi8(v, _mm_slli_si128(v, 2));
+    v = _mm_add_epi8(v, _mm_slli_si128(v, 4));
+    return _mm_add_epi8(v, _mm_slli_si128(v, 8));
+}
+
+// map_at_sse41 evaluates the maps (lo, mid, hi) lane-wise at x.
+__attribute__((target("sse4.1")))
+static __m128i map_at_sse41(__m128i lo, __m128i mid, __m128i hi, __m128i x) {
+    __m128i r = _mm_blendv_epi8(mid, lo, x);
+    return _mm_blendv_epi8(r, hi, _mm_cmpgt_epi8(x, _mm_setzero_si128()));
+}
+
+// MAPS16_STEP composes each lane's map with the map k lanes below it;
+// the lowest k lanes compose with the identity (-1, 0, +1) shifted in.
+#define MAPS16_STEP(k)                                                      \
+    do {                                                                    \
+        __m128i bl = _mm_alignr_epi8(l, neg, 16 - (k));                     \
+        __m128i bm = _mm_alignr_epi8(m, zero, 16 - (k));                    \
+        __m128i bh = _mm_alignr_epi8(h, one, 16 - (k));                     \
+        __m128i nl = map_at_sse41(l, m, h, bl);                             \
+        __m128i nm = map_at_sse41(l, m, h, bm);                             \
+        h = map_at_sse41(l, m, h, bh);                                      \
+        l = nl;                                                             \
+        m = nm;                                                             \
+    } while (0)
+
+// maps16_sse41 sets lane i of *lo / *mid / *hi to where steps 0..i end
+// from -1 / 0 / +1.
+__attribute__((target("sse4.1")))
+static void maps16_sse41(__m128i d, __m128i *lo, __m128i *mid, __m128i *hi) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi8(1);
+    const __m128i neg = _mm_set1_epi8(-1);
+    __m128i l = _mm_max_epi8(_mm_sub_epi8(d, one), neg);
+    __m128i m = d;
+    __m128i h = _mm_min_epi8(_mm_add_epi8(d, one), one);
+    MAPS16_STEP(1);
+    MAPS16_STEP(2);
+    MAPS16_STEP(4);
+    MAPS16_STEP(8);
+    *lo = l;
+    *mid = m;
+    *hi = h;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - SSE4.1 Kernels
+// ────────────────────────────────────────────────────────────────
+
+__attribute__((target("sse4.1")))
+static uint32_t sum32_sse41(const trit_t *in, size_t n, uint32_t carry, int excl, int32_t *out) {
+    const __m128i last = _mm_set1_epi8(15);
+    __m128i c = _mm_set1_epi32((int32_t)carry);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(in + i));
+        __m128i p = prefix16_sse41(v);
+        __m128i q = excl ? _mm_sub_epi8(p, v) : p;
+        __m128i *o = (__m128i *)(void *)(out + i);
+        _mm_storeu_si128(o, _mm_add_epi32(c, _mm_cvtepi8_epi32(q)));
+        _mm_storeu_si128(o + 1, _mm_add_epi32(c, _mm_cvtepi8_epi32(_mm_srli_si128(q, 4))));
+        _mm_storeu_si128(o + 2, _mm_add_epi32(c, _mm_cvtepi8_epi32(_mm_srli_si128(q, 8))));
+        _mm_storeu_si128(o + 3, _mm_add_epi32(c, _mm_cvtepi8_epi32(_mm_srli_si128(q, 12))));
+        c = _mm_add_epi32(c, _mm_cvtepi8_epi32(_mm_shuffle_epi8(p, last)));
+    }
+    carry = (uint32_t)_mm_cvtsi128_si32(c);
+    return sum32_scalar(in + i, n - i, carry, excl, out + i);
+}
+
+__attribute__((target("sse4.1")))
+static uint64_t sum64_sse41(const trit_t *in, size_t n, uint64_t carry, int excl, int64_t *out) {
+    const __m128i last = _mm_set1_epi8(15);
+    __m128i c = _mm_set1_epi64x((int64_t)carry);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(in + i));
+        __m128i p = prefix16_sse41(v);
+        __m128i q = excl ? _mm_sub_epi8(p, v) : p;
+        __m128i *o = (__m128i *)(void *)(out + i);
+        for (int k = 0; k < 8; k++) {
+            _mm_storeu_si128(o + k, _mm_add_epi64(c, _mm_cvtepi8_epi64(q)));
+            q = _mm_srli_si128(q, 2);
+        }
+        c = _mm_add_epi64(c, _mm_cvtepi8_epi64(_mm_shuffle_epi8(p, last)));
+    }
+    int64_t lane[2];
+    _mm_storeu_si128((__m128i *)(void *)lane, c);
+    return sum64_scalar(in + i, n - i, (uint64_t)lane[0], excl, out + i);
+}
+
+// nav_sse41 carries the start as a broadcast vector, so the only chain
+// between steps is two blends and a shuffle.
+__attribute__((target("sse4.1")))
+static trit_t nav_sse41(const trit_t *d, size_t n, trit_t s, trit_t *out) {
+    const __m128i last = _mm_set1_epi8(15);
+    __m128i x = _mm_set1_epi8(s);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i lo, mid, hi;
+        maps16_sse41(_mm_loadu_si128((const __m128i *)(const void *)(d + i)), &lo, &mid, &hi);
+        __m128i r = map_at_sse41(lo, mid, hi, x);
+        _mm_storeu_si128((__m128i *)(void *)(out + i), r);
+        x = _mm_shuffle_epi8(r, last);
+    }
+    s = (trit_t)_mm_cvtsi128_si32(x);
+    return nav_scalar(d + i, n - i, s, out + i);
+}
+
+// map_sse41 evaluates each 16-step map at the running ends (three
+// starts at once in lanes 0-2).
+__attribute__((target("sse4.1")))
+static void map_sse41(const trit_t *d, size_t n, trit_t map[3]) {
+    const __m128i last = _mm_set1_epi8(15);
+    __m128i x = _mm_setr_epi8(map[0], map[1], map[2], 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i lo, mid, hi;
+        maps16_sse41(_mm_loadu_si128((const __m128i *)(const void *)(d + i)), &lo, &mid, &hi);
+        x = map_at_sse41(_mm_shuffle_epi8(lo, last), _mm_shuffle_epi8(mid, last),
+                         _mm_shuffle_epi8(hi, last), x);
+    }
+    map[0] = (trit_t)_mm_extract_epi8(x, 0);
+    map[1] = (trit_t)_mm_extract_epi8(x, 1);
+    map[2] = (trit_t)_mm_extract_epi8(x, 2);
+    map_scalar(d + i, n - i, map);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - AVX2 Kernels (16 trits per step, wider stores)
+// ────────────────────────────────────────────────────────────────
+
+__attribute__((target("avx2")))
+static uint32_t sum32_avx2(const trit_t *in, size_t n, uint32_t carry, int excl, int32_t *out) {
+    const __m128i last = _mm_set1_epi8(15);
+    __m256i c = _mm256_set1_epi32((int32_t)carry);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(in + i));
+        __m128i p = prefix16_sse41(v);
+        __m128i q = excl ? _mm_sub_epi8(p, v) : p;
+        __m256i *o = (__m256i *)(void *)(out + i);
+        _mm256_storeu_si256(o, _mm256_add_epi32(c, _mm256_cvtepi8_epi32(q)));
+        _mm256_storeu_si256(o + 1, _mm256_add_epi32(c, _mm256_cvtepi8_epi32(_mm_srli_si128(q, 8))));
+        c = _mm256_add_epi32(c, _mm256_cvtepi8_epi32(_mm_shuffle_epi8(p, last)));
+    }
+    carry = (uint32_t)_mm_cvtsi128_si32(_mm256_castsi256_si128(c));
+    return sum32_scalar(in + i, n - i, carry, excl, out + i);
+}
+
+__attribute__((target("avx2")))
+static uint64_t sum64_avx2(const trit_t *in, size_t n, uint64_t carry, int excl, int64_t *out) {
+    const __m128i last = _mm_set1_epi8(15);
+    __m256i c = _mm256_set1_epi64x((int64_t)carry);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(in + i));
+        __m128i p = prefix16_sse41(v);
+        __m128i q = excl ? _mm_sub_epi8(p, v) : p;
+        __m256i *o = (__m256i *)(void *)(out + i);
+        _mm256_storeu_si256(o, _mm256_add_epi64(c, _mm256_cvtepi8_epi64(q)));
+        _mm256_storeu_si256(o + 1, _mm256_add_epi64(c, _mm256_cvtepi8_epi64(_mm_srli_si128(q, 4))));
+        _mm256_storeu_si256(o + 2, _mm256_add_epi64(c, _mm256_cvtepi8_epi64(_mm_srli_si128(q, 8))));
+        _mm256_storeu_si256(o + 3, _mm256_add_epi64(c, _mm256_cvtepi8_epi64(_mm_srli_si128(q, 12))));
+        c = _mm256_add_epi64(c, _mm256_cvtepi8_epi64(_mm_shuffle_epi8(p, last)));
+    }
+    int64_t lane[4];
+    _mm256_storeu_si256((__m256i *)(void *)lane, c);
+    return sum64_scalar(in + i, n - i, (uint64_t)lane[0], excl, out + i);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - AVX-512BW Kernels (16 trits per step, one store)
+// ────────────────────────────────────────────────────────────────
+
+__attribute__((target("avx512f,avx512bw")))
+static uint32_t sum32_avx512(const trit_t *in, size_t n, uint32_t carry, int excl, int32_t *out) {
+    const __m128i last = _mm_set1_epi8(15);
+    __m512i c = _mm512_set1_epi32((int32_t)carry);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(in + i));
+        __m128i p = prefix16_sse41(v);
+        __m128i q = excl ? _mm_sub_epi8(p, v) : p;
+        _mm512_storeu_si512((void *)(out + i), _mm512_add_epi32(c, _mm512_cvtepi8_epi32(q)));
+        c = _mm512_add_epi32(c, _mm512_cvtepi8_epi32(_mm_shuffle_epi8(p, last)));
+    }
+    carry = (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(c));
+    return sum32_scalar(in + i, n - i, carry, excl, out + i);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static uint64_t sum64_avx512(const trit_t *in, size_t n, uint64_t carry, int excl, int64_t *out) {
+    const __m128i last = _mm_set1_epi8(15);
+    __m512i c = _mm512_set1_epi64((int64_t)carry);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(in + i));
+        __m128i p = prefix16_sse41(v);
+        __m128i q = excl ? _mm_sub_epi8(p, v) : p;
+        _mm512_storeu_si512((void *)(out + i), _mm512_add_epi64(c, _mm512_cvtepi8_epi64(q)));
+        _mm512_storeu_si512((void *)(out + i + 8),
+                            _mm512_add_epi64(c, _mm512_cvtepi8_epi64(_mm_srli_si128(q, 8))));
+        c = _mm512_add_epi64(c, _mm512_cvtepi8_epi64(_mm_shuffle_epi8(p, last)));
+    }
+    int64_t lane[8];
+    _mm512_storeu_si512((void *)lane, c);
+    return sum64_scalar(in + i, n - i, (uint64_t)lane[0], excl, out + i);
+}
+
+#endif // TRIT_X86_SIMD
+
+// ────────────────────────────────────────────────────────────────
+// Middle Rungs - Dispatch
+// ────────────────────────────────────────────────────────────────
+
+static uint32_t sum32(const trit_t *in, size_t n, uint32_t carry, int excl, int32_t *out) {
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: return sum32_avx512(in, n, carry, excl, out);
+    case TRIT_BACKEND_AVX2:   return sum32_avx2(in, n, carry, excl, out);
+    case TRIT_BACKEND_SSE41:  return sum32_sse41(in, n, carry, excl, out);
+#endif
+    default:                  return sum32_scalar(in, n, carry, excl, out);
+    }
+}
+
+static uint64_t sum64(const trit_t *in, size_t n, uint64_t carry, int excl, int64_t *out) {
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: return sum64_avx512(in, n, carry, excl, out);
+    case TRIT_BACKEND_AVX2:   return sum64_avx2(in, n, carry, excl, out);
+    case TRIT_BACKEND_SSE41:  return sum64_sse41(in, n, carry, excl, out);
+#endif
+    default:                  return sum64_scalar(in, n, carry, excl, out);
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Threaded Driver
+// ────────────────────────────────────────────────────────────────
+
+// scan_split picks the block size for j->n trits over at most `threads`
+// threads (whole 64-trit steps, at least SCAN_MT_MIN_BLOCK each) and
+// returns the block count, 1 or more.
+static unsigned scan_split(scan_job_t *j, unsigned threads) {
+    size_t parts = threads < TRIT_THREADS_MAX ? threads : TRIT_THREADS_MAX;
+    size_t most = j->n / SCAN_MT_MIN_BLOCK;
+    if (parts > most) {
+        parts = most;
+    }
+    if (parts <= 1) {
+        j->per = j->n;
+        return 1;
+    }
+    j->per = ((j->n + parts - 1) / parts + 63) & ~(size_t)63;
+    return (unsigned)((j->n + j->per - 1) / j->per);
+}
+
+// scan_pass1 summarizes block i: its sum, or its end map.
+static void scan_pass1(void *ctx, unsigned i) {
+    scan_job_t *j = ctx;
+    size_t lo = (size_t)i * j->per;
+    size_t len = j->n - lo < j->per ? j->n - lo : j->per;
+
+    if (j->width == 0) {
+        trit_navigate_map(j->in + lo, len, j->map[i]);
+    } else {
+        j->sum[i] = (uint64_t)trit_sum_array(j->in + lo, len);
+    }
+}
+
+// scan_pass2 scans block i from its carry or start.
+static void scan_pass2(void *ctx, unsigned i) {
+    scan_job_t *j = ctx;
+    size_t lo = (size_t)i * j->per;
+    size_t len = j->n - lo < j->per ? j->n - lo : j->per;
+    uint64_t end;
+
+    if (j->width == 32) {
+        end = sum32(j->in + lo, len, (uint32_t)j->carry[i], j->excl, (int32_t *)j->out + lo);
+    } else if (j->width == 64) {
+        end = sum64(j->in + lo, len, j->carry[i], j->excl, (int64_t *)j->out + lo);
+    } else {
+        end = (uint64_t)(int64_t)trit_navigate_scan(j->in + lo, len, j->start[i],
+                                                    (trit_t *)j->out + lo);
+    }
+    if (lo + len == j->n) {
+        j->end = end;
+    }
+}
+
+// sum_mt runs a threaded prefix sum. Carries chain in uint64_t; int32
+// scans keep the low 32 bits, which is the same wrap as one pass.
+static uint64_t sum_mt(scan_job_t *j, uint64_t carry, unsigned threads) {
+    unsigned parts = scan_split(j, threads);
+
+    trit_threads_run(parts - 1, scan_pass1, j);
+    j->carry[0] = carry;
+    for (unsigned i = 1; i < parts; i++) {
+        j->carry[i] = j->carry[i - 1] + j->sum[i - 1];
+    }
+    trit_threads_run(parts, scan_pass2, j);
+    return j->end;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+// trit_prefix_sum_i32 sets out[i] = carry + in[0] + ... + in[i].
+//
+// Parameters:
+//   in    - n valid trits
+//   n     - element count
+//   carry - total of everything before in[0]
+//   out   - n int32 values
+//
+// Returns: carry + Σ in (wrapped modulo 2^32)
+int32_t trit_prefix_sum_i32(const trit_t *in, size_t n, int32_t carry, int32_t *out) {
+    return (int32_t)sum32(in, n, (uint32_t)carry, 0, out);
+}
+
+// trit_prefix_sum_excl_i32 sets out[i] = carry + in[0] + ... + in[i - 1].
+int32_t trit_prefix_sum_excl_i32(const trit_t *in, size_t n, int32_t carry, int32_t *out) {
+    return (int32_t)sum32(in, n, (uint32_t)carry, 1, out);
+}
+
+// trit_prefix_sum_i64 is trit_prefix_sum_i32 into int64.
+int64_t trit_prefix_sum_i64(const trit_t *in, size_t n, int64_t carry, int64_t *out) {
+    return (int64_t)sum64(in, n, (uint64_t)carry, 0, out);
+}
+
+// trit_prefix_sum_excl_i64 is trit_prefix_sum_excl_i32 into int64.
+int64_t trit_prefix_sum_excl_i64(const trit_t *in, size_t n, int64_t carry, int64_t *out) {
+    return (int64_t)sum64(in, n, (uint64_t)carry, 1, out);
+}
+
+// trit_navigate_scan sets out[i] = trit_navigate(out[i - 1], dirs[i]),
+// starting from start. Every x86 backend runs the SSE4.1 kernel: each
+// step waits on the previous step's end, so wider registers do not help.
+//
+// Parameters:
+//   dirs  - n valid trits used as directions
+//   n     - element count
+//   start - position before dirs[0]
+//   out   - n trits (may equal dirs)
+//
+// Returns: the final position
+trit_t trit_navigate_scan(const trit_t *dirs, size_t n, trit_t start, trit_t *out) {
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512:
+    case TRIT_BACKEND_AVX2:
+    case TRIT_BACKEND_SSE41:  return nav_sse41(dirs, n, start, out);
+#endif
+    default:                  return nav_scalar(dirs, n, start, out);
+    }
+}
+
+// trit_navigate_map sets map[s + 1] to where trit_navigate_scan from s
+// ends.
+//
+// Parameters:
+//   dirs - n valid trits used as directions
+//   n    - element count
+//   map  - 3 trits, written
+void trit_navigate_map(const trit_t *dirs, size_t n, trit_t map[3]) {
+    map[0] = TRIT_NEG;
+    map[1] = TRIT_ZERO;
+    map[2] = TRIT_POS;
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512:
+    case TRIT_BACKEND_AVX2:
+    case TRIT_BACKEND_SSE41:  map_sse41(dirs, n, map); return;
+#endif
+    default:                  map_scalar(dirs, n, map); return;
+    }
+}
+
+// trit_prefix_sum_i32_mt is trit_prefix_sum_i32 split across up to
+// `threads` threads (the caller's included): pass one sums every block
+// but the last, the carries are chained in order, and pass two scans the
+// blocks. Results match trit_prefix_sum_i32 exactly. threads 0 or 1, or
+// fewer than 2·SCAN_MT_MIN_BLOCK trits, runs on the caller alone.
+int32_t trit_prefix_sum_i32_mt(const trit_t *in, size_t n, int32_t carry, int32_t *out,
+                               unsigned threads) {
+    scan_job_t j = { .in = in, .n = n, .width = 32, .excl = 0, .out = out };
+    return (int32_t)(uint32_t)sum_mt(&j, (uint32_t)carry, threads);
+}
+
+// trit_prefix_sum_excl_i32_mt is trit_prefix_sum_excl_i32 on threads.
+int32_t trit_prefix_sum_excl_i32_mt(const trit_t *in, size_t n, int32_t carry, int32_t *out,
+                                    unsigned threads) {
+    scan_job_t j = { .in = in, .n = n, .width = 32, .excl = 1, .out = out };
+    return (int32_t)(uint32_t)sum_mt(&j, (uint32_t)carry, threads);
+}
+
+// trit_prefix_sum_i64_mt is trit_prefix_sum_i64 on threads.
+int64_t trit_prefix_sum_i64_mt(const trit_t *in, size_t n, int64_t carry, int64_t *out,
+                               unsigned threads) {
+    scan_job_t j = { .in = in, .n = n, .width = 64, .excl = 0, .out = out };
+    return (int64_t)sum_mt(&j, (uint64_t)carry, threads);
+}
+
+// trit_prefix_sum_excl_i64_mt is trit_prefix_sum_excl_i64 on threads.
+int64_t trit_prefix_sum_excl_i64_mt(const trit_t *in, size_t n, int64_t carry, int64_t *out,
+                                    unsigned threads) {
+    scan_job_t j = { .in = in, .n = n, .width = 64, .excl = 1, .out = out };
+    return (int64_t)sum_mt(&j, (uint64_t)carry, threads);
+}
+
+// trit_navigate_scan_mt is trit_navigate_scan split across up to
+// `threads` threads: pass one maps every block but the last
+// (trit_navigate_map), the starts are chained through the maps, and pass
+// two scans the blocks. Pass one costs about as much as the scan, so p
+// threads give at most p/2 times one.
+trit_t trit_navigate_scan_mt(const trit_t *dirs, size_t n, trit_t start, trit_t *out,
+                             unsigned threads) {
+    scan_job_t j = { .in = dirs, .n = n, .width = 0, .excl = 0, .out = out };
+    unsigned parts = scan_split(&j, threads);
+
+    trit_threads_run(parts - 1, scan_pass1, &j);
+    j.start[0] = start;
+    for (unsigned i = 1; i < parts; i++) {
+        j.start[i] = j.map[i - 1][TRIT_TO_UNSIGNED(j.start[i - 1])];
+    }
+    trit_threads_run(parts, scan_pass2, &j);
+    return (trit_t)(int64_t)j.end;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// Nothing can fail. Inputs are assumed valid, as for trit_navigate_array:
+// the scalar kernels index NAV_TABLE by position + direction. Sums never
+// overflow in C terms - int32 results wrap in unsigned arithmetic.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-scan   # every backend vs serial folds, lengths 0-300,
+//                    # carries and starts, int32 wrap, blocked two-pass,
+//                    # _mt at 0-64 threads
+//
+// Benchmark:
+//   make bench-scan  # serial folds vs each backend, 100M trits, and
+//                    # the two-pass blocked form, _mt at 1-8 threads
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// No allocation, no state.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Scanning 32 or 64 trits per step (int8 lanes hold |sum| ≤ 127)
+//   ✅ Unrolling the vector loops (results must not change)
+//
+// Modify with Extreme Care:
+//   ⚠️ Composition order: a lane's own map applies after the one below
+//   ⚠️ Identity fill (-1, 0, +1) for lanes below each shift
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Results must equal the serial fold of trit_navigate / + for every
+//      input, carry and start, on every backend
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Prefix sums write 4 or 8 bytes per trit, so beyond cache they run at
+// store bandwidth; the blocked form adds one read pass (trit_sum_array),
+// and _mt scales only as far as memory bandwidth does.
+// The navigation scan is compute-bound at about 50 vector ops per 16
+// trits, against a 3-deep dependent chain per trit for the serial fold.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Line upon line, line upon line." — Isaiah 28:10
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,617 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// simd.c - Vectorized Kernels and Runtime Backend Dispatch
+// Key: B-word-work-pkg-trit-src-simd
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//   Without TRIT_X86_SIMD (simd_internal.h) SCALAR and TABLE are the
+//   only backends; selecting a vector one returns false.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-storage-algorithms.adoc [unpacking]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Division-free trit5 unpack kernels (scalar, SSE4.1, AVX2, AVX-512) and the
+// cpuid-based dispatcher that picks one when the library loads.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Now there are diversities of gifts, but the same Spirit."
+//            — 1 Corinthians 12:4
+//
+// Principle: Every machine has different gifts. One library, one result,
+//            many ways of reaching it - the answer never depends on the path.
+//
+// Anchor: "Let all things be done decently and in order." — 1 Cor 14:40
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Bulk trit5 decode at memory bandwidth. Chooses the widest kernel
+//       the running CPU supports so one libtrit.a serves every machine.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Decode whole trit5 groups without division, many bytes per step.
+//
+// Core Design: Multiply-shift extraction in output order.
+//   Trit j (MST first) of byte v is the j-th base-3 digit of the fraction
+//   v/243. Scaling by 270 (≈ 65536/243) gives a 16-bit fixed-point fraction,
+//   so digit j = (3 · (v · 270 · 3^j mod 2^16)) >> 16 - one mullo and one
+//   mulhi per output lane, exact for all 243 states.
+//
+//   Each vector of outputs is built directly in stream order: a byte
+//   shuffle replicates input byte o/5 into lane o, and a per-lane multiplier
+//   (270 · 3^(o mod 5)) selects which trit that lane extracts. No
+//   transposes, no division.
+//
+// Key Features:
+//   - trit5_unpack_groups: backend-dispatched bulk decode (pack.c uses it)
+//   - Kernels: scalar (constant division), table (one load per byte),
+//              SSE4.1 (80 trits/step),
+//              AVX2 (160 trits/step), AVX-512BW (320 trits/step)
+//   - trit_backend_*: query, select, and name the active backend
+//
+// Philosophy: Same answer everywhere; speed is a property of the machine.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Internal: trit.h, table.c (TRIT5_DECODE_TABLE for the table kernel)
+//   - Compiler: immintrin.h + __builtin_cpu_supports (GCC/Clang, x86 only)
+//
+// What Uses This:
+//   - pack.c: trit5_unpack_array full-group path
+//   - Benchmarks: bench/pack_bench.c (per-backend throughput)
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: one resolved kernel pointer plus the constant vectors the x86
+// kernels load. Resolved once when the library loads (constructor) and
+// again only when a caller explicitly selects a backend.
+//
+// Threading: The pointer and backend are stored and loaded atomically
+// (GCC/Clang builtins), so trit_backend_select may run while other
+// threads decode; each call uses the old or the new kernel. The constant
+// vectors are built before the first store and never change.
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <string.h>  // memcpy (table kernel)
+
+//--- Project Headers ---
+#include "trit.h"  // Trit types, backend enum, prototypes, decode tables
+#include "simd_internal.h" // TRIT_X86_SIMD, intrinsics
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+//--- Fixed-Point Extraction ---
+// 270/65536 slightly exceeds 1/243; the excess stays below one unit of the
+// final digit for every v ≤ 242, so floor() never rounds into the next trit.
+#define TRIT5_FRAC_SCALE  270u
+
+//--- Kernel Geometry ---
+// A kernel step of width W consumes W packed bytes and writes 5 output
+// vectors of W trits. Output vector k reads a 16-byte window starting at
+// byte W·k/5, so a step touches bytes [0, W·4/5 + 16).
+#define SIMD_CHUNKS       5
+#define SIMD_READ_SPAN(w) (((w) * 4) / 5 + 16)
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// Kernel signature: decode `groups` bytes into 5·groups trits.
+typedef void (*unpack_groups_fn)(const uint8_t *in, size_t groups, trit_t *out);
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+//--- Dispatch State ---
+// Read by every decoding thread and written by trit_backend_select at
+// any time, so both go through DISPATCH_LOAD / DISPATCH_STORE. A reader
+// sees the old or the new backend, and every backend gives the same
+// results.
+static unpack_groups_fn unpack_kernel = NULL;              // resolved kernel
+static trit_backend_t active_backend = TRIT_BACKEND_AUTO;  // what it is
+
+#if defined(__GNUC__)
+#define DISPATCH_LOAD(v)      __atomic_load_n(&(v), __ATOMIC_ACQUIRE)
+#define DISPATCH_STORE(v, x)  __atomic_store_n(&(v), (x), __ATOMIC_RELEASE)
+#else
+// C99 has no atomics: elsewhere, select before starting threads
+#define DISPATCH_LOAD(v)      (v)
+#define DISPATCH_STORE(v, x)  ((v) = (x))
+#endif
+
+#if TRIT_X86_SIMD
+//--- Kernel Constants ---
+// Built once by build_kernel_constants(). For width W (16/32/64 bytes):
+//   shuf[k][h] - pshufb control: u16 lane m of half h ← window byte, hi = 0
+//   mul[k][h]  - per-lane multiplier 270·3^(o mod 5) mod 2^16
+// Half 0 holds outputs [0, W/2) of chunk k, half 1 holds [W/2, W); after
+// packus + lane fix-up the bytes land in stream order.
+static uint8_t  shuf16[SIMD_CHUNKS][2][16];
+static uint16_t mul16[SIMD_CHUNKS][2][8];
+static uint8_t  shuf32[SIMD_CHUNKS][2][32];
+static uint16_t mul32[SIMD_CHUNKS][2][16];
+static uint8_t  shuf64[SIMD_CHUNKS][2][64];
+static uint16_t mul64[SIMD_CHUNKS][2][32];
+static bool kernel_constants_ready = false;
+#endif
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static void unpack_groups_scalar(const uint8_t *in, size_t groups, trit_t *out);
+static void unpack_groups_table(const uint8_t *in, size_t groups, trit_t *out);
+static bool backend_cpu_has(trit_backend_t backend);
+static trit_backend_t backend_best(void);
+static void backend_install(trit_backend_t backend);
+
+#if TRIT_X86_SIMD
+static void build_kernel_constants(void);
+static void unpack_groups_sse41(const uint8_t *in, size_t groups, trit_t *out);
+static void unpack_groups_avx2(const uint8_t *in, size_t groups, trit_t *out);
+static void unpack_groups_avx512(const uint8_t *in, size_t groups, trit_t *out);
+static void backend_load(void) __attribute__((constructor));
+#endif
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+// Ladder Structure (Dependencies):
+//
+//   Public APIs (Top Rungs)
+//   ├── trit5_unpack_groups()    → unpack_kernel (resolved pointer)
+//   ├── trit_backend_active()    → backend_install() if unresolved
+//   ├── trit_backend_select()    → backend_cpu_has(), backend_install()
+//   ├── trit_backend_supported() → backend_cpu_has()
+//   └── trit_backend_name()      → (pure)
+//
+//   Kernels (Middle Rungs)
+//   ├── unpack_groups_scalar()   → constant division (portable reference)
+//   ├── unpack_groups_table()    → TRIT5_DECODE_TABLE rows (table.c)
+//   ├── unpack_groups_sse41()    → 16 bytes/step, scalar tail
+//   ├── unpack_groups_avx2()     → 32 bytes/step, scalar tail
+//   └── unpack_groups_avx512()   → 64 bytes/step, scalar tail
+//
+//   Helpers (Bottom Rungs)
+//   ├── build_kernel_constants() → shuffle/multiplier vectors
+//   ├── backend_cpu_has()        → __builtin_cpu_supports
+//   ├── backend_best()           → widest supported kernel
+//   └── backend_install()        → set unpack_kernel + active_backend
+//
+// Baton Flow (Execution Paths):
+//
+//   Load:   constructor → backend_load() → backend_install(AUTO)
+//   Decode: trit5_unpack_groups() → unpack_kernel() → SIMD steps → scalar tail
+
+// ────────────────────────────────────────────────────────────────
+// Helpers/Utilities - Internal Support
+// ────────────────────────────────────────────────────────────────
+
+// backend_cpu_has reports whether the running CPU can execute a backend.
+static bool backend_cpu_has(trit_backend_t backend) {
+    switch (backend) {
+    case TRIT_BACKEND_AUTO:
+    case TRIT_BACKEND_SCALAR:
+    case TRIT_BACKEND_TABLE:
+        return true;
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_SSE41:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.1") != 0;
+    case TRIT_BACKEND_AVX2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    case TRIT_BACKEND_AVX512:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f") != 0 &&
+               __builtin_cpu_supports("avx512bw") != 0;
+#endif
+    default:
+        return false;
+    }
+}
+
+// backend_best returns the widest kernel this CPU supports. Without SIMD
+// the table kernel wins over division; SCALAR stays available as reference.
+static trit_backend_t backend_best(void) {
+    if (backend_cpu_has(TRIT_BACKEND_AVX512)) return TRIT_BACKEND_AVX512;
+    if (backend_cpu_has(TRIT_BACKEND_AVX2))   return TRIT_BACKEND_AVX2;
+    if (backend_cpu_has(TRIT_BACKEND_SSE41))  return TRIT_BACKEND_SSE41;
+    return TRIT_BACKEND_TABLE;
+}
+
+// backend_install points the dispatcher at one kernel (AUTO = best).
+// Caller guarantees the backend is supported.
+static void backend_install(trit_backend_t backend) {
+    if (backend == TRIT_BACKEND_AUTO) {
+        backend = backend_best();
+    }
+#if TRIT_X86_SIMD
+    if (!kernel_constants_ready) {
+        build_kernel_constants();
+    }
+#endif
+    unpack_groups_fn kernel;
+    switch (backend) {
+    case TRIT_BACKEND_TABLE:  kernel = unpack_groups_table;  break;
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_SSE41:  kernel = unpack_groups_sse41;  break;
+    case TRIT_BACKEND_AVX2:   kernel = unpack_groups_avx2;   break;
+    case TRIT_BACKEND_AVX512: kernel = unpack_groups_avx512; break;
+#endif
+    default:
+        backend = TRIT_BACKEND_SCALAR;
+        kernel = unpack_groups_scalar;
+        break;
+    }
+    // Backend first: a thread that finds the kernel installed then reads
+    // a real backend, never AUTO
+    DISPATCH_STORE(active_backend, backend);
+    DISPATCH_STORE(unpack_kernel, kernel);
+}
+
+#if TRIT_X86_SIMD
+// backend_load resolves the kernel when the library is loaded, so the
+// first decode call never pays for cpuid.
+static void backend_load(void) {
+    backend_install(TRIT_BACKEND_AUTO);
+}
+
+// fill_width builds the shuffle and multiplier vectors for width w.
+//
+// Output o of chunk k is trit (o mod 5) of packed byte o/5. The byte comes
+// from a 16-byte window broadcast to every 128-bit lane, starting at
+// w·k/5; pshufb picks it into the low byte of a u16 lane (0x80 zeroes the
+// high byte). packus later interleaves halves per 128-bit lane, so u16 lane
+// m of half h must hold output h·w/2 + m.
+static void fill_width(size_t w, uint8_t *shuf, uint16_t *mul) {
+    static const uint16_t frac_pow[5] = {
+        (uint16_t)(TRIT5_FRAC_SCALE * 1u),  (uint16_t)(TRIT5_FRAC_SCALE * 3u),
+        (uint16_t)(TRIT5_FRAC_SCALE * 9u),  (uint16_t)(TRIT5_FRAC_SCALE * 27u),
+        (uint16_t)(TRIT5_FRAC_SCALE * 81u)
+    };
+    for (size_t k = 0; k < SIMD_CHUNKS; k++) {
+        size_t window = (w * k) / 5;
+        for (size_t h = 0; h < 2; h++) {
+            uint8_t *s = shuf + (k * 2 + h) * w;
+            uint16_t *m = mul + (k * 2 + h) * (w / 2);
+            for (size_t lane = 0; lane < w / 2; lane++) {
+                size_t o = w * k + h * (w / 2) + lane;
+                s[2 * lane]     = (uint8_t)(o / 5 - window);
+                s[2 * lane + 1] = 0x80;
+                m[lane] = frac_pow[o % 5];
+            }
+        }
+    }
+}
+
+// build_kernel_constants fills every width's vectors (idempotent).
+static void build_kernel_constants(void) {
+    fill_width(16, &shuf16[0][0][0], &mul16[0][0][0]);
+    fill_width(32, &shuf32[0][0][0], &mul32[0][0][0]);
+    fill_width(64, &shuf64[0][0][0], &mul64[0][0][0]);
+    kernel_constants_ready = true;
+}
+#endif
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Kernels
+// ────────────────────────────────────────────────────────────────
+
+//--- Scalar (portable reference) ---
+
+// unpack_groups_scalar decodes byte by byte with constant division
+// (the compiler lowers v / 3 to multiply-shift). Also the tail for the
+// vector kernels.
+static void unpack_groups_scalar(const uint8_t *in, size_t groups, trit_t *out) {
+    for (size_t i = 0; i < groups; i++) {
+        unsigned v = in[i];
+        trit_t *t = out + 5 * i;
+        unsigned q;
+        q = v / 3; t[4] = (trit_t)UNSIGNED_TO_TRIT((int)(v - 3 * q)); v = q;
+        q = v / 3; t[3] = (trit_t)UNSIGNED_TO_TRIT((int)(v - 3 * q)); v = q;
+        q = v / 3; t[2] = (trit_t)UNSIGNED_TO_TRIT((int)(v - 3 * q)); v = q;
+        q = v / 3; t[1] = (trit_t)UNSIGNED_TO_TRIT((int)(v - 3 * q)); v = q;
+        t[0] = (trit_t)UNSIGNED_TO_TRIT((int)v);
+    }
+}
+
+//--- Table (portable) ---
+
+// unpack_groups_table copies one 8-byte TRIT5_DECODE_TABLE row per byte.
+// Rows overlap by 3 trits; the next row overwrites the padding. The last
+// row copies only its 5 real trits so nothing lands past the output.
+static void unpack_groups_table(const uint8_t *in, size_t groups, trit_t *out) {
+    if (groups == 0) {
+        return;
+    }
+    for (size_t i = 0; i + 1 < groups; i++) {
+        memcpy(out + 5 * i, TRIT5_DECODE_TABLE[in[i]], 8);
+    }
+    memcpy(out + 5 * (groups - 1), TRIT5_DECODE_TABLE[in[groups - 1]], 5);
+}
+
+#if TRIT_X86_SIMD
+
+//--- SSE4.1: 16 bytes → 80 trits per step ---
+
+__attribute__((target("sse4.1")))
+static void unpack_groups_sse41(const uint8_t *in, size_t groups, trit_t *out) {
+    const __m128i three = _mm_set1_epi16(3);
+    const __m128i one = _mm_set1_epi8(1);
+    size_t g = 0;
+
+    for (; g + SIMD_READ_SPAN(16) <= groups; g += 16) {
+        const uint8_t *src = in + g;
+        trit_t *dst = out + 5 * g;
+        for (int k = 0; k < SIMD_CHUNKS; k++) {
+            __m128i win = _mm_loadu_si128((const __m128i *)(const void *)(src + (16 * k) / 5));
+            __m128i lo = _mm_shuffle_epi8(win, _mm_loadu_si128((const __m128i *)(const void *)shuf16[k][0]));
+            __m128i hi = _mm_shuffle_epi8(win, _mm_loadu_si128((const __m128i *)(const void *)shuf16[k][1]));
+            lo = _mm_mullo_epi16(lo, _mm_loadu_si128((const __m128i *)(const void *)mul16[k][0]));
+            hi = _mm_mullo_epi16(hi, _mm_loadu_si128((const __m128i *)(const void *)mul16[k][1]));
+            lo = _mm_mulhi_epu16(lo, three);
+            hi = _mm_mulhi_epu16(hi, three);
+            __m128i d = _mm_sub_epi8(_mm_packus_epi16(lo, hi), one);
+            _mm_storeu_si128((__m128i *)(void *)(dst + 16 * k), d);
+        }
+    }
+    unpack_groups_scalar(in + g, groups - g, out + 5 * g);
+}
+
+//--- AVX2: 32 bytes → 160 trits per step ---
+
+__attribute__((target("avx2")))
+static void unpack_groups_avx2(const uint8_t *in, size_t groups, trit_t *out) {
+    const __m256i three = _mm256_set1_epi16(3);
+    const __m256i one = _mm256_set1_epi8(1);
+    size_t g = 0;
+
+    for (; g + SIMD_READ_SPAN(32) <= groups; g += 32) {
+        const uint8_t *src = in + g;
+        trit_t *dst = out + 5 * g;
+        for (int k = 0; k < SIMD_CHUNKS; k++) {
+            __m256i win = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128((const __m128i *)(const void *)(src + (32 * k) / 5)));
+            __m256i lo = _mm256_shuffle_epi8(win, _mm256_loadu_si256((const __m256i *)(const void *)shuf32[k][0]));
+            __m256i hi = _mm256_shuffle_epi8(win, _mm256_loadu_si256((const __m256i *)(const void *)shuf32[k][1]));
+            lo = _mm256_mullo_epi16(lo, _mm256_loadu_si256((const __m256i *)(const void *)mul32[k][0]));
+            hi = _mm256_mullo_epi16(hi, _mm256_loadu_si256((const __m256i *)(const void *)mul32[k][1]));
+            lo = _mm256_mulhi_epu16(lo, three);
+            hi = _mm256_mulhi_epu16(hi, three);
+            // packus interleaves per 128-bit lane: [lo0 hi0 | lo1 hi1] → [lo0 lo1 hi0 hi1]
+            __m256i d = _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8);
+            d = _mm256_sub_epi8(d, one);
+            _mm256_storeu_si256((__m256i *)(void *)(dst + 32 * k), d);
+        }
+    }
+    unpack_groups_scalar(in + g, groups - g, out + 5 * g);
+}
+
+//--- AVX-512BW: 64 bytes → 320 trits per step ---
+
+__attribute__((target("avx512f,avx512bw")))
+static void unpack_groups_avx512(const uint8_t *in, size_t groups, trit_t *out) {
+    const __m512i three = _mm512_set1_epi16(3);
+    const __m512i one = _mm512_set1_epi8(1);
+    const __m512i lane_fix = _mm512_set_epi64(7, 5, 3, 1, 6, 4, 2, 0);
+    size_t g = 0;
+
+    for (; g + SIMD_READ_SPAN(64) <= groups; g += 64) {
+        const uint8_t *src = in + g;
+        trit_t *dst = out + 5 * g;
+        for (int k = 0; k < SIMD_CHUNKS; k++) {
+            __m512i win = _mm512_broadcast_i32x4(
+                _mm_loadu_si128((const __m128i *)(const void *)(src + (64 * k) / 5)));
+            __m512i lo = _mm512_shuffle_epi8(win, _mm512_loadu_si512((const void *)shuf64[k][0]));
+            __m512i hi = _mm512_shuffle_epi8(win, _mm512_loadu_si512((const void *)shuf64[k][1]));
+            lo = _mm512_mullo_epi16(lo, _mm512_loadu_si512((const void *)mul64[k][0]));
+            hi = _mm512_mullo_epi16(hi, _mm512_loadu_si512((const void *)mul64[k][1]));
+            lo = _mm512_mulhi_epu16(lo, three);
+            hi = _mm512_mulhi_epu16(hi, three);
+            // packus interleaves per 128-bit lane; gather lo lanes then hi lanes
+            __m512i d = _mm512_permutexvar_epi64(lane_fix, _mm512_packus_epi16(lo, hi));
+            d = _mm512_sub_epi8(d, one);
+            _mm512_storeu_si512((void *)(dst + 64 * k), d);
+        }
+    }
+    unpack_groups_scalar(in + g, groups - g, out + 5 * g);
+}
+
+#endif // TRIT_X86_SIMD
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// Unsupported backend requests are refused (trit_backend_select returns
+// false) and the current kernel stays installed - never a SIGILL.
+// Spare bytes (243-255) decode to undefined trits on every backend, as
+// trit5_unpack; callers check trit5_is_spare() first.
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+//--- Bulk Decode ---
+
+// trit5_unpack_groups decodes whole t5b1 bytes with the active backend.
+//
+// Parameters:
+//   in     - groups packed bytes (0-242)
+//   groups - number of bytes; 5·groups trits are written
+//   out    - 5·groups trit values
+void trit5_unpack_groups(const uint8_t *in, size_t groups, trit_t *out) {
+    unpack_groups_fn kernel = DISPATCH_LOAD(unpack_kernel);
+    if (kernel == NULL) {
+        backend_install(TRIT_BACKEND_AUTO);
+        kernel = DISPATCH_LOAD(unpack_kernel);
+    }
+    kernel(in, groups, out);
+}
+
+//--- Backend Selection ---
+
+// trit_backend_active returns the backend currently decoding (never AUTO).
+trit_backend_t trit_backend_active(void) {
+    if (DISPATCH_LOAD(unpack_kernel) == NULL) {
+        backend_install(TRIT_BACKEND_AUTO);
+    }
+    return DISPATCH_LOAD(active_backend);
+}
+
+// trit_backend_supported reports whether this CPU can run a backend.
+bool trit_backend_supported(trit_backend_t backend) {
+    return backend_cpu_has(backend);
+}
+
+// trit_backend_select installs a backend (AUTO = best for this CPU).
+//
+// Returns: true if installed; false if unsupported (current one kept).
+bool trit_backend_select(trit_backend_t backend) {
+    if (!backend_cpu_has(backend)) {
+        return false;
+    }
+    backend_install(backend);
+    return true;
+}
+
+// trit_backend_name returns a static display name for a backend.
+const char *trit_backend_name(trit_backend_t backend) {
+    switch (backend) {
+    case TRIT_BACKEND_AUTO:   return "auto";
+    case TRIT_BACKEND_SCALAR: return "scalar";
+    case TRIT_BACKEND_TABLE:  return "table";
+    case TRIT_BACKEND_SSE41:  return "sse4.1";
+    case TRIT_BACKEND_AVX2:   return "avx2";
+    case TRIT_BACKEND_AVX512: return "avx512";
+    default:                  return "unknown";
+    }
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-simd    # Every supported backend vs trit5_unpack, all states
+//
+// Benchmark:
+//   make bench-pack   # Per-backend unpack throughput
+
+// ────────────────────────────────────────────────────────────────
+// Code Execution
+// ────────────────────────────────────────────────────────────────
+//
+// [OMIT: Library file - no entry point. Constructor only resolves a pointer.]
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// [OMIT: No allocations - all state is static.]
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add kernels (new target attribute + case in backend_install)
+//   ✅ Tune step widths (keep SIMD_READ_SPAN in sync with loads)
+//
+// Modify with Extreme Care:
+//   ⚠️ TRIT5_FRAC_SCALE - 270 is verified exact for 0-242 (test-simd)
+//   ⚠️ Loop bounds - vector loads read SIMD_READ_SPAN(w) bytes per step
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Output order (MST first per byte, identical to trit5_unpack)
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Per output vector: 1 window load, 2 pshufb, 2 mullo, 2 mulhi, 1 packus,
+// 1 subtract, 1 store. Throughput is bound by the store stream (5 bytes
+// written per byte read), which is what "memory bandwidth" means here.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Now there are diversities of gifts, but the same Spirit." — 1 Cor 12:4
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,194 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - SIMD Platform Detection (internal)
+// Key: B-word-work-pkg-trit-src-simd-internal
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: PURE (needs: stdint.h)
+//   Private to src/; never installed or included from include/
+//   x86 kernels use compiler intrinsics only when built with GCC/Clang
+//   on x86; every other toolchain builds each file's portable kernels.
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: src/simd.c (backend selection)
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_SIMD_INTERNAL_H
+#define BERESHIT_SIMD_INTERNAL_H
+
+// The one place the kernels learn whether x86 intrinsics exist, plus the
+// bit-scan helpers their mask loops share.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Let all things be done decently and in order."
+//            — 1 Corinthians 14:40
+//
+// Principle: Decide a thing once, in one place.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (internal support)
+//
+// Role: Shared platform test for every file with SSE4.1 / AVX2 / AVX-512
+//       kernels.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Define TRIT_X86_SIMD and pull in <immintrin.h> when it is 1,
+//          so a change to the platform test (a new compiler, a new
+//          architecture) is one edit instead of one per kernel file.
+//
+// Core Design: TRIT_X86_SIMD is 1 on x86/x86-64 under GCC or Clang,
+//   which compile per-function target attributes; 0 everywhere else,
+//   where the kernel files build only their scalar paths. popcount64
+//   and ctz64 use the builtins where TRIT_X86_SIMD's compilers have
+//   them and portable loops otherwise.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//
+//   - Standard Library: stdint.h
+//   - Compiler: immintrin.h + target attributes (GCC/Clang, x86 only)
+//
+// What Uses This:
+//
+//   - src/*.c files with backend kernels (simd.c, array.c, reduce.c,
+//     rle.c, scan.c, tritdot.c, tritfilter.c, tritmat.c, tritop.c,
+//     tritvote.c, vartrit.c)
+//
+// # Usage & Integration
+//
+// Import (after the public headers):
+//
+//    #include "simd_internal.h"
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None. Macros and static inline helpers only.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdint.h>     // uint64_t
+
+//--- Platform Detection ---
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define TRIT_X86_SIMD 1
+#include <immintrin.h>  // SSE4.1 / AVX2 / AVX-512 intrinsics
+#else
+#define TRIT_X86_SIMD 0
+#endif
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Bit Helpers
+// ────────────────────────────────────────────────────────────────
+
+// popcount64 counts set bits: the builtin on GCC/Clang (a libgcc call
+// without a POPCNT target), SWAR elsewhere.
+static inline int popcount64(uint64_t v) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(v);
+#else
+    v = v - ((v >> 1) & 0x5555555555555555ULL);
+    v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+    v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (int)((v * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// ctz64 is the index of the lowest set bit of a non-zero v.
+static inline unsigned ctz64(uint64_t v) {
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctzll(v);
+#else
+    unsigned k = 0;
+    while (!(v & 1)) {
+        v >>= 1;
+        k++;
+    }
+    return k;
+#endif
+}
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   TRIT_X86_SIMD (+ <immintrin.h> when 1)
+//   popcount64, ctz64
+//
+// Declared Units:
+// - 1 #define constant
+// - 2 inline functions
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ The platform test - every kernel file follows it
+//   ✅ Add bit helpers more than one kernel file needs
+//
+// Never Modify:
+//   ❌ TRIT_X86_SIMD's meaning: 1 only where the target-attribute
+//      kernels compile; the scalar paths must build when it is 0
+//   ❌ Include guard (BERESHIT_SIMD_INTERNAL_H)
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_SIMD_INTERNAL_H
@@ -0,0 +1,310 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// table.c - Precomputed Decode Tables
+// Key: B-word-work-pkg-trit-src-table
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: trit.h)
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/constants/ternary-math.toml [powers]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Compile-time decode tables for trit5 and trit9, and the table-driven
+// unpack functions built on them.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Write the vision, and make it plain upon tables, that he may
+//            run that readeth it." — Habakkuk 2:2
+//
+// Principle: Work done once and written down plainly lets every reader run.
+//            Each decode is computed by the compiler, never at run time.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Table-driven decode path - one load replaces the div/mod loop.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Decode trit5 bytes and trit9 words by lookup instead of division.
+//
+// Core Design: Tables are static initializers expanded by macros, so they
+//   live in .rodata with no runtime init and no first-call cost.
+//   - TRIT5_DECODE_TABLE[256][8]: byte → 5 trits (MST first), 3 pad bytes
+//     so a whole row moves with one 8-byte copy. 2 KB - L1 resident.
+//   - TRIT4_DECODE_TABLE[81][4]: 0-80 → 4 trits (MST first). 324 bytes.
+//   - trit9 decodes in two stages: v = hi·81 + lo, hi (0-242) through the
+//     trit5 table and lo (0-80) through the trit4 table. One constant
+//     division, two loads - 2.3 KB of tables instead of 177 KB for a flat
+//     19683-row table that would fall out of L1.
+//
+// Key Features:
+//   - trit5_unpack_table: one load per byte
+//   - trit9_unpack_table: one division + two loads per word
+//   - trit27_unpack_table: two reciprocal multiplies + three trit9 decodes
+//   - TRIT_BACKEND_TABLE: bulk decode through the table (simd.c)
+//
+// Philosophy: Compute once, at build time; read many times.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: string.h (memcpy)
+//   - Internal: trit.h
+//
+// What Uses This:
+//   - simd.c: table kernel for TRIT_BACKEND_TABLE
+//   - Callers decoding single values on hot paths
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// [OMIT: Pure functions over const tables - no state, no blocking]
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <string.h>  // memcpy
+
+//--- Project Headers ---
+#include "trit.h"    // Trit types, table declarations
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+//--- Table Generators ---
+// Digit of v at place value p, balanced. Place values are the entries of
+// TRIT5_POWERS / TRIT9_POWERS written as literals - C99 initializers must
+// be constant expressions, which a static const array element is not.
+// test/table_test.c checks every row against the power arrays.
+#define T_DIGIT(v, p)  ((trit_t)(((v) / (p)) % 3 - 1))
+
+// trit5 row: 5 trits MST first, 3 zero pad trits
+#define T5_ROW(v) { T_DIGIT(v, 81), T_DIGIT(v, 27), T_DIGIT(v, 9), \
+                    T_DIGIT(v, 3), T_DIGIT(v, 1), 0, 0, 0 }
+#define T5_ROWS3(v)    T5_ROW(v), T5_ROW((v) + 1), T5_ROW((v) + 2)
+#define T5_ROWS9(v)    T5_ROWS3(v), T5_ROWS3((v) + 3), T5_ROWS3((v) + 6)
+#define T5_ROWS27(v)   T5_ROWS9(v), T5_ROWS9((v) + 9), T5_ROWS9((v) + 18)
+#define T5_ROWS81(v)   T5_ROWS27(v), T5_ROWS27((v) + 27), T5_ROWS27((v) + 54)
+#define T5_ROWS243(v)  T5_ROWS81(v), T5_ROWS81((v) + 81), T5_ROWS81((v) + 162)
+
+// Spare states (243-255) have no trit meaning; they decode to all zero
+#define T5_SPARE       { 0, 0, 0, 0, 0, 0, 0, 0 }
+
+// trit4 row: 4 trits MST first
+#define T4_ROW(v) { T_DIGIT(v, 27), T_DIGIT(v, 9), T_DIGIT(v, 3), T_DIGIT(v, 1) }
+#define T4_ROWS3(v)    T4_ROW(v), T4_ROW((v) + 1), T4_ROW((v) + 2)
+#define T4_ROWS9(v)    T4_ROWS3(v), T4_ROWS3((v) + 3), T4_ROWS3((v) + 6)
+#define T4_ROWS27(v)   T4_ROWS9(v), T4_ROWS9((v) + 9), T4_ROWS9((v) + 18)
+#define T4_ROWS81(v)   T4_ROWS27(v), T4_ROWS27((v) + 27), T4_ROWS27((v) + 54)
+
+//--- trit27 Chunk Split ---
+// Reciprocals for exact floor division by 3^18 and 3^9 (Granlund-Montgomery):
+// for n < 2^N and k = N + ceil(log2 d), M = ceil(2^k / d) gives
+// floor(n·M / 2^k) == floor(n / d) for every n. trit27 values are < 2^43,
+// the remainder after 3^18 is < 2^29.
+#define TRIT18         387420489ULL           // 3^18
+#define TRIT18_MAGIC   12189253322815ULL      // ceil(2^72 / 3^18), N = 43
+#define TRIT18_SHIFT   72
+#define TRIT9          19683ULL               // 3^9
+#define TRIT9_MAGIC    893775647ULL           // ceil(2^44 / 3^9), N = 29
+#define TRIT9_SHIFT    44
+
+// 43 × 44 bit product needs 128 bits; without them the compiler lowers the
+// constant division itself (the same multiply, chosen by the compiler)
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 table_u128;
+#define TRIT27_HI(v)   ((uint64_t)(((table_u128)(v) * TRIT18_MAGIC) >> TRIT18_SHIFT))
+#else
+#define TRIT27_HI(v)   ((v) / TRIT18)
+#endif
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// [Reserved: Tables are exported - see Public Tables below]
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public Tables
+//   ├── TRIT5_DECODE_TABLE[256][8] ← T5_ROWS243 + 13 × T5_SPARE
+//   └── TRIT4_DECODE_TABLE[81][4]  ← T4_ROWS81
+//
+//   Public APIs
+//   ├── trit5_unpack_table() → TRIT5_DECODE_TABLE
+//   ├── trit9_unpack_table() → TRIT5_DECODE_TABLE + TRIT4_DECODE_TABLE
+//   └── trit27_unpack_table() → TRIT27_HI + TRIT9_MAGIC → trit9_unpack_table() × 3
+
+// ────────────────────────────────────────────────────────────────
+// Public Tables
+// ────────────────────────────────────────────────────────────────
+
+// TRIT5_DECODE_TABLE[v] holds the 5 trits of byte v, MST first.
+// 256 rows so any byte indexes safely; rows 243-255 are all zero.
+const trit_t TRIT5_DECODE_TABLE[256][8] = {
+    T5_ROWS243(0),
+    T5_SPARE, T5_SPARE, T5_SPARE, T5_SPARE, T5_SPARE, T5_SPARE, T5_SPARE,
+    T5_SPARE, T5_SPARE, T5_SPARE, T5_SPARE, T5_SPARE, T5_SPARE
+};
+
+// TRIT4_DECODE_TABLE[v] holds the 4 trits of v (0-80), MST first.
+const trit_t TRIT4_DECODE_TABLE[81][4] = {
+    T4_ROWS81(0)
+};
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+// trit5_unpack_table decodes a byte with one table load.
+//
+// Same output as trit5_unpack for 0-242. Spare states (243-255) decode to
+// all TRIT_ZERO instead of undefined values.
+void trit5_unpack_table(trit5_t packed, trit_t trits[5]) {
+    memcpy(trits, TRIT5_DECODE_TABLE[packed], 5);
+}
+
+// trit9_unpack_table decodes a trit9 word in two table stages.
+//
+// Algorithm: hi = v / 81 (top 5 trits), lo = v - 81·hi (bottom 4 trits)
+// Same output as trit9_unpack for 0-19682; larger values are undefined.
+void trit9_unpack_table(trit9_t packed, trit_t trits[9]) {
+    unsigned v = packed;
+    unsigned hi = v / 81;
+    unsigned lo = v - 81 * hi;
+    memcpy(trits, TRIT5_DECODE_TABLE[hi & 0xFF], 5);
+    memcpy(trits + 5, TRIT4_DECODE_TABLE[lo], 4);
+}
+
+// trit27_unpack_table decodes a trit27 word as three trit9 chunks.
+//
+// Algorithm: hi = v / 3^18, rest = v - hi·3^18, mid = rest / 3^9,
+//            lo = rest - mid·3^9; each division is one reciprocal multiply.
+// The chunks are independent, so the three trit9 decodes overlap instead
+// of running trit27_unpack's 27-step dependent division chain.
+// Same output as trit27_unpack for 0 to TRIT27_STATES-1.
+void trit27_unpack_table(trit27_t packed, trit_t trits[27]) {
+    uint64_t v = packed;
+    uint64_t hi = TRIT27_HI(v);
+    uint64_t rest = v - hi * TRIT18;
+    uint64_t mid = (rest * TRIT9_MAGIC) >> TRIT9_SHIFT;
+    uint64_t lo = rest - mid * TRIT9;
+    trit9_unpack_table((trit9_t)hi, trits);
+    trit9_unpack_table((trit9_t)mid, trits + 9);
+    trit9_unpack_table((trit9_t)lo, trits + 18);
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-table   # Every row vs TRIT5_POWERS/TRIT9_POWERS, all states
+//
+// Benchmark:
+//   make bench-pack   # table vs division, per call and bulk
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// [OMIT: Const tables in .rodata - nothing to release.]
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add tables for other widths (follow the T*_ROWS pattern)
+//
+// Modify with Extreme Care:
+//   ⚠️ Row stride 8 of TRIT5_DECODE_TABLE - the table kernel copies 8 bytes
+//   ⚠️ Place values in T5_ROW/T4_ROW - must match the power arrays
+//   ⚠️ TRIT18/TRIT9 magic constants - re-derive if the input range changes
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ MST-first row order (must equal trit5_unpack output)
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// trit5: 1 load (2 KB table, L1). trit9: 1 multiply-shift + 2 loads.
+// trit27: 2 multiply-shifts + 3 × trit9 (no dependent chain between chunks).
+// Tables cost nothing at startup - they are part of the binary image.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Write the vision, and make it plain upon tables." — Habakkuk 2:2
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
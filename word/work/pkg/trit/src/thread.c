@@ -0,0 +1,263 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// thread.c - Worker Threads
+// Key: B-word-work-pkg-trit-src-thread
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: thread_internal.h, trit.h)
+//   C99 plus POSIX threads (pthread_create, pthread_join); link with
+//   -pthread.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: src/thread_internal.h
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Fork-join for the threaded drivers (tritmat.c, tritindex.c, scan.c,
+// tritvote.c).
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Two are better than one; because they have a good reward
+//            for their labour." — Ecclesiastes 4:9
+//
+// Principle: Split the work, then wait for every hand before going on.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (internal support)
+//
+// Role: Thread start and join for thread_internal.h.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Start up to TRIT_THREADS_MAX - 1 threads for one job, run a
+//          share on the caller, join.
+//
+// Core Design: Thread t of nt runs parts t, t + nt, t + 2·nt, ... The
+//   caller is thread 0 and starts its own share only after creating the
+//   others. If pthread_create fails for thread t, the caller runs t's
+//   share itself after its own, so a job never loses a part. The kernel
+//   backend is installed before any thread starts (simd.c installs it
+//   lazily on first use), so workers never race to install it.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - POSIX: pthread.h
+//   - Internal: thread_internal.h, trit.h (trit_backend_active)
+//
+// What Uses This:
+//   - The *_mt functions of tritmat.c, tritindex.c, scan.c and tritvote.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None. Each call owns its threads and joins them before it
+//        returns.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 200809L  // pthread_create, pthread_join
+
+//--- Platform ---
+#include <pthread.h>             // pthread_t, pthread_create, pthread_join
+
+//--- Project Headers ---
+#include "thread_internal.h"     // trit_threads_run, TRIT_THREADS_MAX
+#include "trit.h"                // trit_backend_active
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// share_t is one thread's share of a job.
+typedef struct {
+    trit_part_fn fn;
+    void *ctx;
+    unsigned first;    // first part
+    unsigned step;     // threads in the job
+    unsigned parts;    // parts in the job
+} share_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static void run_share(const share_t *s);
+static void *share_main(void *arg);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public API (internal to libtrit)
+//   └── trit_threads_run() → pthread_create(share_main) per thread,
+//                            run_share() on the caller, pthread_join
+//
+//   Helpers: run_share(), share_main()
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static void run_share(const share_t *s) {
+    for (unsigned i = s->first; i < s->parts; i += s->step) {
+        s->fn(s->ctx, i);
+    }
+}
+
+static void *share_main(void *arg) {
+    run_share(arg);
+    return NULL;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public API
+// ────────────────────────────────────────────────────────────────
+
+// trit_threads_run calls fn(ctx, i) for every i < parts and returns when
+// all calls are done.
+//
+// Parameters:
+//   parts - number of parts (0 does nothing)
+//   fn    - part body; runs concurrently for different i
+//   ctx   - passed to every call
+void trit_threads_run(unsigned parts, trit_part_fn fn, void *ctx) {
+    share_t shares[TRIT_THREADS_MAX];
+    pthread_t tids[TRIT_THREADS_MAX];
+    int started[TRIT_THREADS_MAX];
+    unsigned nt = parts < TRIT_THREADS_MAX ? parts : TRIT_THREADS_MAX;
+
+    // Install the backend now: its first use writes the dispatch
+    // pointers, which workers then only read
+    (void)trit_backend_active();
+    for (unsigned t = 0; t < nt; t++) {
+        shares[t].fn = fn;
+        shares[t].ctx = ctx;
+        shares[t].first = t;
+        shares[t].step = nt;
+        shares[t].parts = parts;
+        started[t] = t > 0 && pthread_create(&tids[t], NULL, share_main, &shares[t]) == 0;
+    }
+    for (unsigned t = 0; t < nt; t++) {
+        if (!started[t]) {
+            run_share(&shares[t]);
+        }
+    }
+    for (unsigned t = 1; t < nt; t++) {
+        if (started[t]) {
+            pthread_join(tids[t], NULL);
+        }
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// pthread_create failure (thread limits, memory) is not an error: the
+// caller runs that share too, so results are the same, only slower.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing: through the *_mt functions - make test-tritmat, test-scan,
+//   test-tritvote and test-tritindex compare threaded results with the
+//   single-threaded ones for several thread counts.
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// Every started thread is joined before trit_threads_run returns.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Stack size or affinity attributes for new threads
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Joining before return - callers hand out stack pointers in ctx
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// A thread start and join costs tens of microseconds, so callers split
+// only jobs that take well over that (whole matrices, query batches,
+// 64K-trit scan blocks, vote batches), and never into more parts than
+// threads.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Two are better than one; because they have a good reward for their
+// labour." — Ecclesiastes 4:9
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,149 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit - Worker Threads (internal)
+// Key: B-word-work-pkg-trit-src-thread-internal
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: PURE (needs: nothing)
+//   Private to src/; implemented in src/thread.c on POSIX threads
+//
+// derives_from: bereshit/word/seed/code/c/header.h
+// See: src/thread.c
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef BERESHIT_THREAD_INTERNAL_H
+#define BERESHIT_THREAD_INTERNAL_H
+
+// Fork-join over a fixed number of parts, for the *_mt entry points.
+//
+// libtrit Library - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Two are better than one; because they have a good reward
+//            for their labour." — Ecclesiastes 4:9
+//
+// Principle: Split the work, then wait for every hand before going on.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (internal support)
+//
+// Role: The only place libtrit starts threads.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Run part i of a caller-sized job on its own thread and return
+//          when all parts are done. No pool: threads live for one call.
+//
+// Core Design: trit_threads_run(parts, fn, ctx) calls fn(ctx, i) once
+//   for every i < parts. Part 0 runs on the calling thread; the others
+//   each get a new thread (at most TRIT_THREADS_MAX in all, parts past
+//   that are dealt round-robin). A thread that cannot be created leaves
+//   its parts to the caller, so the job always completes.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// What Uses This:
+//
+//   - tritmat.c, tritindex.c, scan.c, tritvote.c (*_mt functions)
+//
+// Import:
+//
+//    #include "thread_internal.h"
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None between calls. fn must be safe to run concurrently for
+//   different i; parts usually write disjoint slices of one output.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+// Most threads one call runs on, the caller included
+#define TRIT_THREADS_MAX 64
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// One part of a job: ctx is shared, i picks the part.
+typedef void (*trit_part_fn)(void *ctx, unsigned i);
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Call fn(ctx, i) for every i < parts, across up to min(parts,
+// TRIT_THREADS_MAX) threads including the caller's; returns when all
+// have finished. parts 0 or 1 runs on the caller alone (src/thread.c).
+void trit_threads_run(unsigned parts, trit_part_fn fn, void *ctx);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+//
+// Declared Units:
+// - 1 #define constant, 1 type
+// - 1 function prototype
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ TRIT_THREADS_MAX
+//   ✅ Replacing per-call threads with a pool, as long as the call
+//      still returns only after every part has run
+//
+// Never Modify:
+//   ❌ Part 0 on the caller - with one part there is no thread at all
+//   ❌ Include guard (BERESHIT_THREAD_INTERNAL_H)
+
+// ============================================================================
+// END CLOSING
+// ============================================================================
+
+#endif // BERESHIT_THREAD_INTERNAL_H
@@ -0,0 +1,1076 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// tritbig.c - Arbitrary-Precision Balanced Ternary Integers
+// Key: B-word-work-pkg-trit-src-tritbig
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritbig.h, trit.h)
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Multiplication], [Division]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Integers of any length as signed int27 limbs: add, sub, Karatsuba and
+// Toom-3 multiplication, centered-remainder long division.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "He telleth the number of the stars; he calleth them all by
+//            their names." — Psalm 147:4
+//
+// Principle: No number is too large to be counted exactly.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Implements tritbig.h on top of the trit27 encoding.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Exact arithmetic on balanced ternary integers of any length.
+//
+// Core Design: Two layers.
+//   - Limb layer (static, limbs_* / mul_*): raw int64_t arrays. Limbs may
+//     go briefly out of range (sums of a few limbs fit easily in int64);
+//     limbs_normalize() restores balanced digits in one carry pass.
+//   - Public layer (tritbig_*): builds every result in a fresh buffer, then
+//     installs it, so results may alias operands and a failed allocation
+//     leaves outputs untouched.
+//
+// Multiplication (limbs, operands a ≥ b):
+//   - b < Karatsuba threshold:  column-wise schoolbook, 128-bit column sums
+//   - a ≥ 2b:                   b-sized slices of a, each product balanced
+//   - b ≥ Toom-3 threshold:     Toom-3 at 0, +1, -1, -2, ∞ (Bodrato)
+//   - otherwise:                Karatsuba
+// Signed limbs make the ±1 and -2 evaluations plain limb arithmetic; the
+// interpolation divides exactly by 2 and 3.
+//
+// Division: the research doc algorithm one limb at a time. Each step
+// estimates a quotient limb from the top three limbs of the remainder and
+// divisor in long double, subtracts q·b, and lets the next step absorb
+// any estimate error. A last step centers the remainder exactly.
+//
+// Key Features:
+//   - Limb value + TRIT27_BIAS is the packed trit27 word
+//   - Thresholds tunable at run time (tritbig_set_mul_thresholds)
+//
+// Philosophy: Signed digits all the way down - no sign-magnitude split.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: stdlib.h (malloc, realloc, free), string.h (memcpy, memset)
+//   - Internal: tritbig.h, trit.h (TRIT27_STATES, TRIT27_BIAS)
+//   - Internal: table.c (trit27_unpack_table for tritbig_to_trits)
+//
+// What Uses This:
+//   - tritbig.h consumers
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: Two process-wide multiplication thresholds (not thread-safe to
+//        change while multiplying).
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdlib.h>   // malloc, calloc, free
+#include <string.h>   // memcpy, memset
+
+//--- Project Headers ---
+#include "tritbig.h"  // tritbig_t, trit27 constants
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define LIMB_BASE  ((int64_t)TRIT27_STATES)   // 3^27
+#define LIMB_BIAS  ((int64_t)TRIT27_BIAS)     // (3^27 - 1) / 2
+
+// Below 4 limbs a Karatsuba split does not shrink the operands
+#define MUL_MIN_SPLIT 4
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// Limb products are 86 bits; column sums need a few more. Without a
+// native 128-bit type, a two's complement pair of words stands in.
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef __int128 tritbig_wide;
+#else
+typedef struct {
+    uint64_t lo;
+    uint64_t hi;
+} tritbig_wide;
+#endif
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+static size_t karatsuba_threshold = TRITBIG_KARATSUBA_THRESHOLD;
+static size_t toom3_threshold = TRITBIG_TOOM3_THRESHOLD;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Limb layer
+static int64_t limbs_normalize(int64_t *r, size_t n);
+static tritbig_wide wide_of(int64_t a);
+static tritbig_wide wide_mul(int64_t a, int64_t b);
+static tritbig_wide wide_add(tritbig_wide a, tritbig_wide b);
+static bool wide_fits64(tritbig_wide t);
+static int64_t split_wide(tritbig_wide t, int64_t *digit);
+static void limbs_divexact(int64_t *v, size_t n, int64_t d);
+static long double limbs_estimate(const int64_t *v, size_t n, long lo);
+static void limbs_submul(int64_t *r, size_t n, const int64_t *d, size_t nd, int64_t q);
+static void mul_basecase(int64_t *r, const int64_t *a, size_t na, const int64_t *b, size_t nb);
+static bool mul_unbalanced(int64_t *r, const int64_t *a, size_t na, const int64_t *b, size_t nb);
+static bool mul_karatsuba(int64_t *r, const int64_t *a, size_t na, const int64_t *b, size_t nb);
+static bool mul_toom3(int64_t *r, const int64_t *a, size_t na, const int64_t *b, size_t nb);
+static bool mul_limbs(int64_t *r, const int64_t *a, size_t na, const int64_t *b, size_t nb);
+
+// Public-layer helpers
+static int64_t *alloc_limbs(size_t n);
+static void install(tritbig_t *x, int64_t *buf, size_t len);
+static bool add_signed(tritbig_t *r, const tritbig_t *a, const tritbig_t *b, int64_t sign);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs
+//   ├── lifetime / conversion → alloc_limbs() + install()
+//   ├── tritbig_add/sub()     → add_signed() → limbs_normalize()
+//   ├── tritbig_mul()         → mul_limbs()
+//   │                           ├── mul_basecase()   → wide_mul/add(), split_wide()
+//   │                           ├── mul_unbalanced() → mul_limbs() per slice
+//   │                           ├── mul_karatsuba()  → 3 × mul_limbs()
+//   │                           └── mul_toom3()      → 5 × mul_limbs() + limbs_divexact()
+//   └── tritbig_divmod()      → limbs_estimate() + limbs_submul() per limb
+//                               → tritbig_add/sub/cmp() to center the remainder
+
+// ────────────────────────────────────────────────────────────────
+// Limb Layer - Internal Support
+// ────────────────────────────────────────────────────────────────
+
+// limbs_normalize propagates carries so every limb is a balanced digit.
+//
+// Limbs may hold any value below about 2^62 in magnitude on entry.
+//
+// Returns: carry out of limb n-1 (0 when the value fits in n limbs)
+static int64_t limbs_normalize(int64_t *r, size_t n) {
+    int64_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        int64_t t = r[i] + carry;
+        int64_t q = t / LIMB_BASE;
+        int64_t d = t - q * LIMB_BASE;
+        if (d > LIMB_BIAS) {
+            d -= LIMB_BASE;
+            q++;
+        } else if (d < -LIMB_BIAS) {
+            d += LIMB_BASE;
+            q--;
+        }
+        r[i] = d;
+        carry = q;
+    }
+    return carry;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Wide Values - Internal Support
+// ────────────────────────────────────────────────────────────────
+//
+// Column sums and limb products go through wide_of / wide_mul / wide_add,
+// so the limb layer reads the same with or without __int128. The
+// fallback multiplies 32-bit halves and divides by 3^27 as 3^13 · 3^14,
+// both exact.
+
+#if defined(__SIZEOF_INT128__)
+
+static tritbig_wide wide_of(int64_t a) {
+    return a;
+}
+
+static tritbig_wide wide_mul(int64_t a, int64_t b) {
+    return (tritbig_wide)a * b;
+}
+
+static tritbig_wide wide_add(tritbig_wide a, tritbig_wide b) {
+    return a + b;
+}
+
+static bool wide_fits64(tritbig_wide t) {
+    return t >= INT64_MIN && t <= INT64_MAX;
+}
+
+// split_wide splits a 128-bit value into a balanced digit and a carry:
+// t = carry · 3^27 + digit. |t| must stay below 2^100.
+//
+// The long double quotient is within one of the true one; the loops fix it.
+static int64_t split_wide(tritbig_wide t, int64_t *digit) {
+    int64_t q = (int64_t)((long double)t / (long double)LIMB_BASE);
+    int64_t d = (int64_t)(t - (tritbig_wide)q * LIMB_BASE);
+    while (d > LIMB_BIAS) {
+        d -= LIMB_BASE;
+        q++;
+    }
+    while (d < -LIMB_BIAS) {
+        d += LIMB_BASE;
+        q--;
+    }
+    *digit = d;
+    return q;
+}
+
+#else
+
+static tritbig_wide wide_neg(tritbig_wide t) {
+    t.lo = ~t.lo + 1;
+    t.hi = ~t.hi + (t.lo == 0);
+    return t;
+}
+
+static tritbig_wide wide_of(int64_t a) {
+    tritbig_wide t;
+    t.lo = (uint64_t)a;
+    t.hi = a < 0 ? UINT64_MAX : 0;
+    return t;
+}
+
+// wide_mul multiplies the magnitudes from 32-bit halves, then applies the
+// sign.
+static tritbig_wide wide_mul(int64_t a, int64_t b) {
+    uint64_t ua = a < 0 ? 0 - (uint64_t)a : (uint64_t)a;
+    uint64_t ub = b < 0 ? 0 - (uint64_t)b : (uint64_t)b;
+    uint64_t a0 = ua & 0xFFFFFFFFu, a1 = ua >> 32;
+    uint64_t b0 = ub & 0xFFFFFFFFu, b1 = ub >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0;
+    uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+    tritbig_wide t;
+    t.lo = mid << 32 | (p00 & 0xFFFFFFFFu);
+    t.hi = a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return (a < 0) != (b < 0) ? wide_neg(t) : t;
+}
+
+static tritbig_wide wide_add(tritbig_wide a, tritbig_wide b) {
+    a.lo += b.lo;
+    a.hi += b.hi + (a.lo < b.lo);
+    return a;
+}
+
+static bool wide_fits64(tritbig_wide t) {
+    return t.hi == (t.lo >> 63 ? UINT64_MAX : 0);
+}
+
+// wide_divmod_small divides the 32-bit words w (most significant first)
+// by d < 2^32 in place and returns the remainder.
+static uint64_t wide_divmod_small(uint64_t w[4], uint64_t d) {
+    uint64_t r = 0;
+    for (int i = 0; i < 4; i++) {
+        uint64_t cur = r << 32 | w[i];
+        w[i] = cur / d;
+        r = cur % d;
+    }
+    return r;
+}
+
+// split_wide splits a 128-bit value into a balanced digit and a carry:
+// t = carry · 3^27 + digit. |t| must stay below 2^100.
+//
+// |t| is divided exactly by 3^13 and then 3^14; the sign and the
+// balancing step come after.
+static int64_t split_wide(tritbig_wide t, int64_t *digit) {
+    bool neg = t.hi >> 63;
+    tritbig_wide m = neg ? wide_neg(t) : t;
+    uint64_t w[4] = { m.hi >> 32, m.hi & 0xFFFFFFFFu, m.lo >> 32, m.lo & 0xFFFFFFFFu };
+    uint64_t r13 = wide_divmod_small(w, TRIT27_POWERS[13]);
+    uint64_t r14 = wide_divmod_small(w, TRIT27_POWERS[14]);
+    int64_t q = (int64_t)(w[2] << 32 | w[3]);
+    int64_t d = (int64_t)(r13 + TRIT27_POWERS[13] * r14);
+    if (neg) {
+        q = -q;
+        d = -d;
+    }
+    if (d > LIMB_BIAS) {
+        d -= LIMB_BASE;
+        q++;
+    } else if (d < -LIMB_BIAS) {
+        d += LIMB_BASE;
+        q--;
+    }
+    *digit = d;
+    return q;
+}
+
+#endif
+
+// limbs_divexact divides v by a small d that is known to divide it.
+//
+// Horner from the top with a running remainder; the remainder ends at 0.
+// The quotient is normalized before returning.
+static void limbs_divexact(int64_t *v, size_t n, int64_t d) {
+    int64_t rem = 0;
+    for (size_t i = n; i-- > 0;) {
+        int64_t t = rem * LIMB_BASE + v[i];
+        int64_t q = t / d;
+        rem = t - q * d;
+        v[i] = q;
+    }
+    limbs_normalize(v, n);
+}
+
+// limbs_estimate approximates v / 3^(27·lo) from its limbs at lo and above
+// (lo may be negative: missing low limbs count as zero).
+static long double limbs_estimate(const int64_t *v, size_t n, long lo) {
+    long double acc = 0.0L;
+    long stop = (lo > 0) ? lo : 0;
+    for (long i = (long)n - 1; i >= stop; i--) {
+        acc = acc * (long double)LIMB_BASE + (long double)v[i];
+    }
+    for (long i = lo; i < 0; i++) {
+        acc *= (long double)LIMB_BASE;
+    }
+    return acc;
+}
+
+// limbs_submul subtracts q · d from r (n limbs available), carrying as far
+// as needed. The result must fit in n limbs.
+static void limbs_submul(int64_t *r, size_t n, const int64_t *d, size_t nd, int64_t q) {
+    int64_t carry = 0;
+    size_t i = 0;
+    for (; i < nd; i++) {
+        carry = split_wide(wide_add(wide_mul(q, -d[i]), wide_of(r[i] + carry)), &r[i]);
+    }
+    for (; carry != 0 && i < n; i++) {
+        carry = split_wide(wide_of(r[i] + carry), &r[i]);
+    }
+}
+
+// mul_basecase is column-wise schoolbook multiplication.
+//
+// Each output limb sums its column of products in 128 bits and splits
+// once, so the carry work is O(na + nb) rather than O(na · nb).
+//
+// Parameters:
+//   r      - receives na + nb normalized limbs (must not overlap a or b)
+//   a, b   - normalized limbs, na ≥ 1, nb ≥ 1
+static void mul_basecase(int64_t *r, const int64_t *a, size_t na, const int64_t *b, size_t nb) {
+    int64_t carry = 0;
+    for (size_t k = 0; k + 1 < na + nb; k++) {
+        size_t lo = (k >= nb) ? k - nb + 1 : 0;
+        size_t hi = (k < na) ? k : na - 1;
+        tritbig_wide acc = wide_of(carry);
+        for (size_t i = lo; i <= hi; i++) {
+            acc = wide_add(acc, wide_mul(a[i], b[k - i]));
+        }
+        carry = split_wide(acc, &r[k]);
+    }
+    r[na + nb - 1] = carry;
+}
+
+// mul_unbalanced handles na ≥ 2·nb: multiply nb-limb slices of a by b and
+// add the overlapping partial products.
+static bool mul_unbalanced(int64_t *r, const int64_t *a, size_t na, const int64_t *b, size_t nb) {
+    int64_t *tmp = alloc_limbs(2 * nb);
+    if (!tmp) {
+        return false;
+    }
+    memset(r, 0, (na + nb) * sizeof(int64_t));
+    for (size_t off = 0; off < na; off += nb) {
+        size_t m = (na - off < nb) ? na - off : nb;
+        if (!mul_limbs(tmp, a + off, m, b, nb)) {
+            free(tmp);
+            return false;
+        }
+        for (size_t i = 0; i < m + nb; i++) {
+            r[off + i] += tmp[i];
+        }
+    }
+    limbs_normalize(r, na + nb);
+    free(tmp);
+    return true;
+}
+
+// mul_karatsuba splits at h = na/2: a = a1·X + a0, b = b1·X + b0 (X = base^h).
+//
+//   z0 = a0·b0,  z2 = a1·b1,  z1 = (a0 + a1)(b0 + b1)
+//   a·b = z2·X² + (z1 - z0 - z2)·X + z0
+//
+// Requires na ≥ nb > na/2 and nb ≥ MUL_MIN_SPLIT.
+static bool mul_karatsuba(int64_t *r, const int64_t *a, size_t na, const int64_t *b, size_t nb) {
+    size_t h = na / 2;
+    size_t na1 = na - h;
+    size_t nb1 = nb - h;
+    size_t ns = na1 + 1;
+    size_t nt = ((nb1 > h) ? nb1 : h) + 1;
+    size_t nz = ns + nt;
+
+    int64_t *buf = alloc_limbs(ns + nt + nz);
+    if (!buf) {
+        return false;
+    }
+    int64_t *sa = buf;
+    int64_t *sb = sa + ns;
+    int64_t *z1 = sb + nt;
+
+    for (size_t i = 0; i < ns; i++) {
+        sa[i] = ((i < h) ? a[i] : 0) + ((i < na1) ? a[h + i] : 0);
+    }
+    for (size_t i = 0; i < nt; i++) {
+        sb[i] = ((i < h) ? b[i] : 0) + ((i < nb1) ? b[h + i] : 0);
+    }
+    limbs_normalize(sa, ns);
+    limbs_normalize(sb, nt);
+
+    // z0 and z2 land in place; z1 goes to scratch
+    if (!mul_limbs(r, a, h, b, h) ||
+        !mul_limbs(r + 2 * h, a + h, na1, b + h, nb1) ||
+        !mul_limbs(z1, sa, ns, sb, nt)) {
+        free(buf);
+        return false;
+    }
+
+    // Middle term a0·b1 + a1·b0 fits in na limbs once normalized
+    for (size_t i = 0; i < 2 * h; i++) {
+        z1[i] -= r[i];
+    }
+    for (size_t i = 0; i < na1 + nb1; i++) {
+        z1[i] -= r[2 * h + i];
+    }
+    limbs_normalize(z1, nz);
+    size_t nmid = (nz < na + nb - h) ? nz : na + nb - h;
+    for (size_t i = 0; i < nmid; i++) {
+        r[h + i] += z1[i];
+    }
+    limbs_normalize(r, na + nb);
+    free(buf);
+    return true;
+}
+
+// mul_toom3 splits both operands in three parts of k = ceil(na/3) limbs
+// and evaluates at 0, +1, -1, -2 and ∞.
+//
+//   p(0) = a0            p(1) = a0 + a1 + a2      p(-1) = a0 - a1 + a2
+//   p(-2) = a0 - 2a1 + 4a2                        p(∞) = a2
+//
+// Interpolation (Bodrato's sequence):
+//   r3 = (r(-2) - r(1)) / 3      r1 = (r(1) - r(-1)) / 2
+//   r2 = r(-1) - r(0)            r3 = (r2 - r3) / 2 + 2·r(∞)
+//   r2 = r2 + r1 - r(∞)          r1 = r1 - r3
+//   a·b = r(∞)·X⁴ + r3·X³ + r2·X² + r1·X + r(0)
+//
+// Requires na ≥ nb > 2k.
+static bool mul_toom3(int64_t *r, const int64_t *a, size_t na, const int64_t *b, size_t nb) {
+    size_t k = (na + 2) / 3;
+    size_t na2 = na - 2 * k;
+    size_t nb2 = nb - 2 * k;
+    size_t ne = k + 1;      // evaluated operand limbs
+    size_t w = 2 * ne;      // evaluated product limbs
+
+    int64_t *buf = alloc_limbs(6 * ne + 6 * w);
+    if (!buf) {
+        return false;
+    }
+    int64_t *a1p = buf,          *a1m = a1p + ne, *a2m = a1m + ne;
+    int64_t *b1p = a2m + ne,     *b1m = b1p + ne, *b2m = b1m + ne;
+    int64_t *r0 = b2m + ne,      *r1 = r0 + w,    *rm1 = r1 + w;
+    int64_t *rm2 = rm1 + w,      *rinf = rm2 + w, *r3 = rinf + w;
+
+    // Evaluate: the top limb starts at 0 and takes the carry
+    for (size_t i = 0; i < ne; i++) {
+        int64_t x0 = (i < k) ? a[i] : 0;
+        int64_t x1 = (i < k) ? a[k + i] : 0;
+        int64_t x2 = (i < na2) ? a[2 * k + i] : 0;
+        a1p[i] = x0 + x1 + x2;
+        a1m[i] = x0 - x1 + x2;
+        a2m[i] = x0 - 2 * x1 + 4 * x2;
+        int64_t y0 = (i < k) ? b[i] : 0;
+        int64_t y1 = (i < k) ? b[k + i] : 0;
+        int64_t y2 = (i < nb2) ? b[2 * k + i] : 0;
+        b1p[i] = y0 + y1 + y2;
+        b1m[i] = y0 - y1 + y2;
+        b2m[i] = y0 - 2 * y1 + 4 * y2;
+    }
+    limbs_normalize(a1p, ne);
+    limbs_normalize(a1m, ne);
+    limbs_normalize(a2m, ne);
+    limbs_normalize(b1p, ne);
+    limbs_normalize(b1m, ne);
+    limbs_normalize(b2m, ne);
+
+    // Pointwise products, zero-padded to w limbs
+    memset(r0, 0, 2 * w * sizeof(int64_t));
+    memset(rinf, 0, w * sizeof(int64_t));
+    if (!mul_limbs(r0, a, k, b, k) ||
+        !mul_limbs(r1, a1p, ne, b1p, ne) ||
+        !mul_limbs(rm1, a1m, ne, b1m, ne) ||
+        !mul_limbs(rm2, a2m, ne, b2m, ne) ||
+        !mul_limbs(rinf, a + 2 * k, na2, b + 2 * k, nb2)) {
+        free(buf);
+        return false;
+    }
+
+    // Interpolate; rm1 becomes r2
+    int64_t *r2 = rm1;
+    for (size_t i = 0; i < w; i++) r3[i] = rm2[i] - r1[i];
+    limbs_normalize(r3, w);
+    limbs_divexact(r3, w, 3);
+    for (size_t i = 0; i < w; i++) r1[i] -= rm1[i];
+    limbs_normalize(r1, w);
+    limbs_divexact(r1, w, 2);
+    for (size_t i = 0; i < w; i++) r2[i] -= r0[i];
+    limbs_normalize(r2, w);
+    for (size_t i = 0; i < w; i++) r3[i] = r2[i] - r3[i];
+    limbs_normalize(r3, w);
+    limbs_divexact(r3, w, 2);
+    for (size_t i = 0; i < w; i++) r3[i] += 2 * rinf[i];
+    limbs_normalize(r3, w);
+    for (size_t i = 0; i < w; i++) r2[i] += r1[i] - rinf[i];
+    limbs_normalize(r2, w);
+    for (size_t i = 0; i < w; i++) r1[i] -= r3[i];
+    limbs_normalize(r1, w);
+
+    // Recompose: coefficient j at offset j·k; each fits below na + nb
+    const int64_t *coef[5] = { r0, r1, r2, r3, rinf };
+    size_t n = na + nb;
+    memset(r, 0, n * sizeof(int64_t));
+    for (size_t j = 0; j < 5; j++) {
+        size_t off = j * k;
+        for (size_t i = 0; i < w && off + i < n; i++) {
+            r[off + i] += coef[j][i];
+        }
+    }
+    limbs_normalize(r, n);
+    free(buf);
+    return true;
+}
+
+// mul_limbs multiplies normalized limb arrays, choosing the algorithm.
+//
+// Parameters:
+//   r    - receives na + nb normalized limbs (must not overlap a or b)
+//   a, b - normalized limbs (may have zero top limbs), na ≥ 1, nb ≥ 1
+//
+// Returns: false on allocation failure
+static bool mul_limbs(int64_t *r, const int64_t *a, size_t na, const int64_t *b, size_t nb) {
+    if (na < nb) {
+        const int64_t *t = a; a = b; b = t;
+        size_t tn = na; na = nb; nb = tn;
+    }
+    if (nb < karatsuba_threshold) {
+        mul_basecase(r, a, na, b, nb);
+        return true;
+    }
+    if (2 * nb <= na) {
+        return mul_unbalanced(r, a, na, b, nb);
+    }
+    if (nb >= toom3_threshold && nb > 2 * ((na + 2) / 3)) {
+        return mul_toom3(r, a, na, b, nb);
+    }
+    return mul_karatsuba(r, a, na, b, nb);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public-Layer Helpers
+// ────────────────────────────────────────────────────────────────
+
+// alloc_limbs allocates n limbs (at least one, so NULL always means failure).
+static int64_t *alloc_limbs(size_t n) {
+    return malloc((n ? n : 1) * sizeof(int64_t));
+}
+
+// install gives buf (len limbs, normalized) to x, trimming zero top limbs
+// and freeing x's old storage. buf may be NULL when len is 0.
+static void install(tritbig_t *x, int64_t *buf, size_t len) {
+    while (len > 0 && buf[len - 1] == 0) {
+        len--;
+    }
+    free(x->limb);
+    x->limb = buf;
+    x->len = len;
+    x->cap = buf ? len : 0;
+}
+
+// add_signed computes r = a + sign·b (sign = ±1).
+static bool add_signed(tritbig_t *r, const tritbig_t *a, const tritbig_t *b, int64_t sign) {
+    size_t n = ((a->len > b->len) ? a->len : b->len) + 1;
+    int64_t *buf = alloc_limbs(n);
+    if (!buf) {
+        return false;
+    }
+    for (size_t i = 0; i < n; i++) {
+        int64_t x = (i < a->len) ? a->limb[i] : 0;
+        int64_t y = (i < b->len) ? b->limb[i] : 0;
+        buf[i] = x + sign * y;
+    }
+    limbs_normalize(buf, n);
+    install(r, buf, n);
+    return true;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+//--- Lifetime ---
+
+// tritbig_init sets x to zero without allocating.
+void tritbig_init(tritbig_t *x) {
+    x->limb = NULL;
+    x->len = 0;
+    x->cap = 0;
+}
+
+// tritbig_free releases x's limbs and leaves it as zero.
+void tritbig_free(tritbig_t *x) {
+    free(x->limb);
+    tritbig_init(x);
+}
+
+// tritbig_copy copies src into dst.
+//
+// Returns: false on allocation failure (dst unchanged)
+bool tritbig_copy(tritbig_t *dst, const tritbig_t *src) {
+    if (dst == src) {
+        return true;
+    }
+    int64_t *buf = alloc_limbs(src->len);
+    if (!buf) {
+        return false;
+    }
+    if (src->len) {
+        memcpy(buf, src->limb, src->len * sizeof(int64_t));
+    }
+    install(dst, buf, src->len);
+    return true;
+}
+
+//--- Conversion ---
+
+// tritbig_set_int64 sets x to value (two limbs cover all of int64).
+bool tritbig_set_int64(tritbig_t *x, int64_t value) {
+    int64_t *buf = alloc_limbs(3);
+    if (!buf) {
+        return false;
+    }
+    size_t n = 0;
+    // Never negates, so INT64_MIN is safe
+    while (value != 0) {
+        int64_t d = value % LIMB_BASE;
+        value /= LIMB_BASE;
+        if (d > LIMB_BIAS) {
+            d -= LIMB_BASE;
+            value++;
+        } else if (d < -LIMB_BIAS) {
+            d += LIMB_BASE;
+            value--;
+        }
+        buf[n++] = d;
+    }
+    install(x, buf, n);
+    return true;
+}
+
+// tritbig_to_int64 reads x as a signed 64-bit value.
+//
+// Parameters:
+//   x        - value to read
+//   overflow - set true if x is outside int64 (may be NULL)
+//
+// Returns: x, or x modulo 2^64 (two's complement) when it does not fit
+int64_t tritbig_to_int64(const tritbig_t *x, bool *overflow) {
+    uint64_t u = 0;
+    for (size_t i = x->len; i-- > 0;) {
+        u = u * (uint64_t)LIMB_BASE + (uint64_t)x->limb[i];
+    }
+    bool wrapped = x->len > 2;
+    if (x->len == 2) {
+        wrapped = !wide_fits64(wide_add(wide_mul(x->limb[1], LIMB_BASE), wide_of(x->limb[0])));
+    }
+    if (overflow) {
+        *overflow = wrapped;
+    }
+    return (u > (uint64_t)INT64_MAX) ? -(int64_t)(~u) - 1 : (int64_t)u;
+}
+
+// tritbig_from_trits sets x from n trits, most significant first.
+//
+// The last 27 trits become limb 0, the 27 before them limb 1, and so on.
+bool tritbig_from_trits(tritbig_t *x, const trit_t *trits, size_t n) {
+    size_t nl = (n + TRITBIG_LIMB_TRITS - 1) / TRITBIG_LIMB_TRITS;
+    int64_t *buf = alloc_limbs(nl);
+    if (!buf) {
+        return false;
+    }
+    for (size_t j = 0; j < nl; j++) {
+        size_t end = n - j * TRITBIG_LIMB_TRITS;
+        size_t start = (end > TRITBIG_LIMB_TRITS) ? end - TRITBIG_LIMB_TRITS : 0;
+        int64_t v = 0;
+        for (size_t i = start; i < end; i++) {
+            v = v * 3 + trits[i];
+        }
+        buf[j] = v;
+    }
+    install(x, buf, nl);
+    return true;
+}
+
+// tritbig_to_trits writes the low n trits of x, most significant first.
+//
+// Returns: true if x fits in n trits (otherwise out holds x mod 3^n)
+bool tritbig_to_trits(const tritbig_t *x, trit_t *out, size_t n) {
+    trit_t digits[TRITBIG_LIMB_TRITS];
+    for (size_t j = 0; j * TRITBIG_LIMB_TRITS < n; j++) {
+        int64_t limb = (j < x->len) ? x->limb[j] : 0;
+        trit27_unpack_table((trit27_t)(limb + LIMB_BIAS), digits);
+        // Limb j holds trits n-27(j+1) .. n-27j-1 of the output
+        size_t end = n - j * TRITBIG_LIMB_TRITS;
+        for (size_t i = 0; i < TRITBIG_LIMB_TRITS && i < end; i++) {
+            out[end - 1 - i] = digits[TRITBIG_LIMB_TRITS - 1 - i];
+        }
+    }
+    return tritbig_trits(x) <= n;
+}
+
+// tritbig_from_trit27_array sets x from packed words, most significant first.
+bool tritbig_from_trit27_array(tritbig_t *x, const trit27_t *words, size_t n) {
+    int64_t *buf = alloc_limbs(n);
+    if (!buf) {
+        return false;
+    }
+    for (size_t j = 0; j < n; j++) {
+        buf[j] = (int64_t)words[n - 1 - j] - LIMB_BIAS;
+    }
+    install(x, buf, n);
+    return true;
+}
+
+// tritbig_to_trit27_array writes the low n limbs as packed words, most
+// significant first.
+//
+// Returns: true if x fits in n words
+bool tritbig_to_trit27_array(const tritbig_t *x, trit27_t *out, size_t n) {
+    for (size_t j = 0; j < n; j++) {
+        int64_t limb = (j < x->len) ? x->limb[j] : 0;
+        out[n - 1 - j] = (trit27_t)(limb + LIMB_BIAS);
+    }
+    return x->len <= n;
+}
+
+// tritbig_trits counts significant trits: the full limbs plus the digits
+// of the top limb.
+size_t tritbig_trits(const tritbig_t *x) {
+    if (x->len == 0) {
+        return 0;
+    }
+    int64_t top = x->limb[x->len - 1];
+    uint64_t mag = (uint64_t)((top < 0) ? -top : top);
+    size_t digits = 0;
+    // m trits reach (3^m - 1) / 2
+    for (uint64_t p = 1; p < 2 * mag + 1; p *= 3) {
+        digits++;
+    }
+    return (x->len - 1) * TRITBIG_LIMB_TRITS + digits;
+}
+
+//--- Arithmetic ---
+
+// tritbig_sign returns the sign of the top limb.
+int tritbig_sign(const tritbig_t *x) {
+    if (x->len == 0) {
+        return 0;
+    }
+    int64_t top = x->limb[x->len - 1];
+    return (top > 0) - (top < 0);
+}
+
+// tritbig_cmp compares two values.
+//
+// Same sign and length: balanced digits order lexicographically from the
+// top, because the limbs below can never outweigh one unit of the limb
+// above. Longer means larger in magnitude.
+int tritbig_cmp(const tritbig_t *a, const tritbig_t *b) {
+    int sa = tritbig_sign(a);
+    int sb = tritbig_sign(b);
+    if (sa != sb) {
+        return (sa > sb) - (sa < sb);
+    }
+    if (a->len != b->len) {
+        return (a->len > b->len) ? sa : -sa;
+    }
+    for (size_t i = a->len; i-- > 0;) {
+        if (a->limb[i] != b->limb[i]) {
+            return (a->limb[i] > b->limb[i]) ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+// tritbig_neg sets r = -a (every limb negated, like flipping every trit).
+bool tritbig_neg(tritbig_t *r, const tritbig_t *a) {
+    int64_t *buf = alloc_limbs(a->len);
+    if (!buf) {
+        return false;
+    }
+    for (size_t i = 0; i < a->len; i++) {
+        buf[i] = -a->limb[i];
+    }
+    install(r, buf, a->len);
+    return true;
+}
+
+// tritbig_add sets r = a + b.
+bool tritbig_add(tritbig_t *r, const tritbig_t *a, const tritbig_t *b) {
+    return add_signed(r, a, b, 1);
+}
+
+// tritbig_sub sets r = a - b.
+bool tritbig_sub(tritbig_t *r, const tritbig_t *a, const tritbig_t *b) {
+    return add_signed(r, a, b, -1);
+}
+
+// tritbig_mul sets r = a · b.
+bool tritbig_mul(tritbig_t *r, const tritbig_t *a, const tritbig_t *b) {
+    if (a->len == 0 || b->len == 0) {
+        install(r, NULL, 0);
+        return true;
+    }
+    int64_t *buf = alloc_limbs(a->len + b->len);
+    if (!buf) {
+        return false;
+    }
+    if (!mul_limbs(buf, a->limb, a->len, b->limb, b->len)) {
+        free(buf);
+        return false;
+    }
+    install(r, buf, a->len + b->len);
+    return true;
+}
+
+// tritbig_divmod divides with a centered remainder.
+//
+// The research doc algorithm, one limb instead of one trit per step: the
+// quotient limb is the rounded ratio of the top limbs, so the remainder
+// stays near zero instead of in [0, |b|). Estimates may be off by one;
+// the next step absorbs it and the last step centers the remainder.
+//
+// Parameters:
+//   q   - receives round(a / b) (may be NULL)
+//   rem - receives a - q·b, in (-|b|/2, |b|/2] (may be NULL)
+//   a   - dividend
+//   b   - divisor
+//
+// Returns: false if b is zero or allocation fails (outputs unchanged)
+bool tritbig_divmod(tritbig_t *q, tritbig_t *rem, const tritbig_t *a, const tritbig_t *b) {
+    if (b->len == 0) {
+        return false;
+    }
+    size_t na = a->len;
+    size_t nb = b->len;
+    size_t nr = ((na > nb) ? na : nb) + 1;
+    size_t nq = ((na >= nb) ? na - nb + 1 : 1) + 1;
+    int64_t flip = (tritbig_sign(b) < 0) ? -1 : 1;
+
+    int64_t *d = alloc_limbs(nb);
+    int64_t *r = alloc_limbs(nr);
+    int64_t *qd = calloc(nq, sizeof(int64_t));
+    if (!d || !r || !qd) {
+        free(d);
+        free(r);
+        free(qd);
+        return false;
+    }
+
+    // Work with |b|; a = q·|b| + r becomes a = (flip·q)·b + r
+    for (size_t i = 0; i < nb; i++) d[i] = flip * b->limb[i];
+    memset(r, 0, nr * sizeof(int64_t));
+    if (na) {
+        memcpy(r, a->limb, na * sizeof(int64_t));
+    }
+
+    long double dtop = limbs_estimate(d, nb, (long)nb - 3);
+    size_t rlen = na;
+    for (size_t j = (na >= nb) ? na - nb + 1 : 0; j-- > 0;) {
+        long double ratio = limbs_estimate(r, rlen, (long)(j + nb) - 3) / dtop;
+        int64_t qhat = (int64_t)((ratio < 0) ? ratio - 0.5L : ratio + 0.5L);
+        if (qhat != 0) {
+            limbs_submul(r + j, nr - j, d, nb, qhat);
+            qd[j] += qhat;
+        }
+        rlen = nr;
+        while (rlen > 0 && r[rlen - 1] == 0) {
+            rlen--;
+        }
+    }
+    limbs_normalize(qd, nq);
+
+    // Center exactly: -|b| < 2r ≤ |b|
+    tritbig_t tq = TRITBIG_INIT, tr = TRITBIG_INIT, td = TRITBIG_INIT;
+    tritbig_t two_r = TRITBIG_INIT, one = TRITBIG_INIT, neg_d = TRITBIG_INIT;
+    install(&tq, qd, nq);
+    install(&tr, r, nr);
+    install(&td, d, nb);
+    bool ok = tritbig_set_int64(&one, 1) && tritbig_neg(&neg_d, &td);
+    while (ok) {
+        ok = tritbig_add(&two_r, &tr, &tr);
+        if (!ok) break;
+        if (tritbig_cmp(&two_r, &td) > 0) {
+            ok = tritbig_sub(&tr, &tr, &td) && tritbig_add(&tq, &tq, &one);
+        } else if (tritbig_cmp(&two_r, &neg_d) <= 0) {
+            ok = tritbig_add(&tr, &tr, &td) && tritbig_sub(&tq, &tq, &one);
+        } else {
+            break;
+        }
+    }
+    if (ok && flip < 0) {
+        ok = tritbig_neg(&tq, &tq);
+    }
+    if (ok) {
+        if (q) {
+            install(q, tq.limb, tq.len);
+            tritbig_init(&tq);
+        }
+        if (rem) {
+            install(rem, tr.limb, tr.len);
+            tritbig_init(&tr);
+        }
+    }
+    tritbig_free(&tq);
+    tritbig_free(&tr);
+    tritbig_free(&td);
+    tritbig_free(&two_r);
+    tritbig_free(&one);
+    tritbig_free(&neg_d);
+    return ok;
+}
+
+//--- Tuning ---
+
+// tritbig_set_mul_thresholds sets the multiplication crossovers in limbs.
+//
+// 0 restores the default; SIZE_MAX disables the algorithm. Values below
+// MUL_MIN_SPLIT are raised to it. Toom-3 is only tried at or above the
+// Karatsuba threshold.
+void tritbig_set_mul_thresholds(size_t karatsuba, size_t toom3) {
+    karatsuba_threshold = karatsuba ? karatsuba : TRITBIG_KARATSUBA_THRESHOLD;
+    toom3_threshold = toom3 ? toom3 : TRITBIG_TOOM3_THRESHOLD;
+    if (karatsuba_threshold < MUL_MIN_SPLIT) karatsuba_threshold = MUL_MIN_SPLIT;
+    if (toom3_threshold < MUL_MIN_SPLIT) toom3_threshold = MUL_MIN_SPLIT;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-tritbig   # vs __int128 reference, algorithm cross-checks,
+//                       # divmod identity and remainder bounds
+//
+// Benchmark:
+//   make bench-tritbig  # mul 1K-1M trits per algorithm, divmod
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// Every helper frees its scratch on all paths. Public results are
+// installed only on success.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Threshold defaults in tritbig.h (re-run make bench-tritbig)
+//   ✅ Scratch reuse across recursion levels (fewer mallocs)
+//
+// Modify with Extreme Care:
+//   ⚠️ Toom-3 interpolation order - each exact division needs the
+//      previous steps' values
+//   ⚠️ Headroom: limbs_normalize takes |limb| < 2^62, split_wide |t| < 2^100
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Build-then-install pattern (aliasing and failure safety rely on it)
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Basecase columns cost one 64×64→128 multiply-add per limb pair and one
+// split per column. Karatsuba and Toom-3 allocate scratch per call; above
+// the thresholds that is small next to the recursive work.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "He telleth the number of the stars." — Psalm 147:4
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
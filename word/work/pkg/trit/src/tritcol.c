@@ -0,0 +1,535 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// tritcol.c - Delta-Coded Integer Columns
+// Key: B-word-work-pkg-trit-src-tritcol
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritcol.h, vartrit.h, trit.h)
+//   Portable C99. Payloads go through vartrit.c, which picks its own
+//   backend.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/scripture/kjv-ordinal-index.adoc (monotone verse ordinals)
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Block encoder, header checks, running-sum decoders and range counts
+// for tritcol.h.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "So teach us to number our days, that we may apply our
+//            hearts unto wisdom." — Psalm 90:12
+//
+// Principle: A day is told from the day before it. Write down the step,
+//            not the whole count again.
+//
+// # CPI-SI Identity
+//
+// Component Type: Rungs (built on the vartrit layer)
+//
+// Role: Column layer for tritcol.h.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Turn int64 columns into differences small enough for one
+//          vartrit byte, and add them back up at scan speed.
+//
+// Core Design:
+//
+//   Block. Header (all integers little-endian):
+//     0   u8  transform (TRITCOL_DELTA = 1, TRITCOL_DOD = 2)
+//     1   u8  0
+//     2   u16 count (1 .. TRITCOL_BLOCK)
+//     4   u32 payload bytes
+//     8   i64 first value
+//     16  i64 min
+//     24  i64 max
+//   then count - 1 vartrit numbers. Differences are taken in uint64_t,
+//   so they wrap instead of overflowing and the running sums undo them
+//   exactly.
+//
+//   Encoding. One pass forms the deltas, min and max, and (for AUTO)
+//   the vartrit length of both transforms; DOD then differences the
+//   deltas in place, back to front, and trit_vartrit_encode_i64 writes
+//   the payload.
+//
+//   Decoding. A payload of exactly count - 1 bytes can only be count - 1
+//   one-byte numbers (each byte is a terminator: value = byte - 249), so
+//   the running sum reads the bytes directly. Any other payload is
+//   decoded by trit_vartrit_decode_i64 into the output first, then
+//   summed in place. Both paths track min and max and compare them with
+//   the header.
+//
+// Key Features:
+//   - Transform chosen per block from exact encoded lengths
+//   - One pass per block on the one-byte path
+//   - Headers validated before a block is offered, payloads after
+//
+// Philosophy: Trust a header only as far as it has been checked.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Internal: tritcol.h, vartrit.h (trit_vartrit_size,
+//     trit_vartrit_encode_i64, trit_vartrit_decode_i64), trit.h
+//     (TRIT5_STATES)
+//
+// What Uses This:
+//   - tritcol.h consumers; bench/tritcol_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None. Encoding and range counts keep one block of int64 on the
+//        stack (8 KB).
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Project Headers ---
+#include "tritcol.h"    // tritcol_*, TRITCOL_*
+#include "vartrit.h"    // trit_vartrit_*
+#include "trit.h"       // TRIT5_STATES
+
+// ────────────────────────────────────────────────────────────────
+// Constants
+// ────────────────────────────────────────────────────────────────
+
+#define ONE_BYTE_BIAS  249    // one-byte vartrit: byte = value + 249 (243-255)
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static size_t encode_block(const int64_t *in, size_t n, tritcol_transform_t transform,
+                           uint8_t *out);
+static int decode_block(const uint8_t *p, size_t len, const tritcol_block_t *b, int64_t *out);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── tritcol_encode()       → encode_block per TRITCOL_BLOCK values
+//   ├── tritcol_count()        → tritcol_next per block
+//   ├── tritcol_decode()       → tritcol_next, tritcol_read per block
+//   ├── tritcol_count_range()  → skip / whole / tritcol_read by min, max
+//   └── tritcol_reader_init(), tritcol_next(), tritcol_read()
+//
+//   Middle Rungs
+//   ├── encode_block() → deltas, lengths, DOD in place, vartrit payload
+//   └── decode_block() → one-byte running sums, or vartrit then sums
+//
+//   Bottom Rungs
+//   └── put16/32/64, get16/32/64 (little-endian)
+//
+// Baton Flow:
+//   Encode: values → differences → vartrit → header
+//   Decode: header checks → payload → running sums → min / max check
+
+// ────────────────────────────────────────────────────────────────
+// Helpers - Little-Endian Fields
+// ────────────────────────────────────────────────────────────────
+
+static void put16(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v) {
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static void put64(uint8_t *p, uint64_t v) {
+    put32(p, (uint32_t)v);
+    put32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint32_t get16(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8;
+}
+
+static uint32_t get32(const uint8_t *p) {
+    return get16(p) | get16(p + 2) << 16;
+}
+
+static uint64_t get64(const uint8_t *p) {
+    return (uint64_t)get32(p) | (uint64_t)get32(p + 4) << 32;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Blocks
+// ────────────────────────────────────────────────────────────────
+
+// encode_block writes n values (1 .. TRITCOL_BLOCK) as one block and
+// returns its size.
+static size_t encode_block(const int64_t *in, size_t n, tritcol_transform_t transform,
+                           uint8_t *out) {
+    int64_t d[TRITCOL_BLOCK];
+    int64_t lo = in[0];
+    int64_t hi = in[0];
+    uint64_t step = 0;
+    size_t delta_bytes = 0;
+    size_t dod_bytes = 0;
+
+    for (size_t i = 1; i < n; i++) {
+        uint64_t s = (uint64_t)in[i] - (uint64_t)in[i - 1];
+        d[i - 1] = (int64_t)s;
+        lo = in[i] < lo ? in[i] : lo;
+        hi = in[i] > hi ? in[i] : hi;
+        if (transform == TRITCOL_AUTO) {
+            delta_bytes += trit_vartrit_size((int64_t)s);
+            dod_bytes += trit_vartrit_size((int64_t)(s - step));
+        }
+        step = s;
+    }
+    if (transform == TRITCOL_AUTO) {
+        transform = dod_bytes < delta_bytes ? TRITCOL_DOD : TRITCOL_DELTA;
+    }
+    if (transform == TRITCOL_DOD) {
+        for (size_t i = n - 1; i-- > 1;) {
+            d[i] = (int64_t)((uint64_t)d[i] - (uint64_t)d[i - 1]);
+        }
+    }
+
+    size_t payload = trit_vartrit_encode_i64(d, n - 1, out + TRITCOL_HEAD);
+    out[0] = (uint8_t)transform;
+    out[1] = 0;
+    put16(out + 2, (uint32_t)n);
+    put32(out + 4, (uint32_t)payload);
+    put64(out + 8, (uint64_t)in[0]);
+    put64(out + 16, (uint64_t)lo);
+    put64(out + 24, (uint64_t)hi);
+    return TRITCOL_HEAD + payload;
+}
+
+// decode_block rebuilds b->count values from a payload of len bytes.
+// Returns 1 if the payload holds exactly count - 1 numbers and the
+// values reach b->min and b->max, else 0.
+static int decode_block(const uint8_t *p, size_t len, const tritcol_block_t *b, int64_t *out) {
+    size_t m = b->count - 1;
+    uint64_t v = (uint64_t)b->first;
+    uint64_t step = 0;
+    int64_t lo = b->first;
+    int64_t hi = b->first;
+    out[0] = b->first;
+
+    if (len == m) {
+        // Every byte must be a terminator; the smallest one tells
+        unsigned low = 255;
+        if (b->transform == TRITCOL_DELTA) {
+            for (size_t i = 0; i < m; i++) {
+                low = p[i] < low ? p[i] : low;
+                v += (uint64_t)((int64_t)p[i] - ONE_BYTE_BIAS);
+                int64_t x = (int64_t)v;
+                out[i + 1] = x;
+                lo = x < lo ? x : lo;
+                hi = x > hi ? x : hi;
+            }
+        } else {
+            for (size_t i = 0; i < m; i++) {
+                low = p[i] < low ? p[i] : low;
+                step += (uint64_t)((int64_t)p[i] - ONE_BYTE_BIAS);
+                v += step;
+                int64_t x = (int64_t)v;
+                out[i + 1] = x;
+                lo = x < lo ? x : lo;
+                hi = x > hi ? x : hi;
+            }
+        }
+        if (low < TRIT5_STATES) {
+            return 0;
+        }
+    } else {
+        if (trit_vartrit_decode_i64(p, len, out + 1, m) != len) {
+            return 0;
+        }
+        for (size_t i = 1; i <= m; i++) {
+            uint64_t e = (uint64_t)out[i];
+            step = b->transform == TRITCOL_DELTA ? e : step + e;
+            v += step;
+            int64_t x = (int64_t)v;
+            out[i] = x;
+            lo = x < lo ? x : lo;
+            hi = x > hi ? x : hi;
+        }
+    }
+    return lo == b->min && hi == b->max;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Streaming
+// ────────────────────────────────────────────────────────────────
+
+void tritcol_reader_init(tritcol_reader_t *r, const uint8_t *in, size_t len) {
+    r->in = in;
+    r->len = len;
+    r->pos = 0;
+    r->next = 0;
+    r->payload = 0;
+    r->block.row = 0;
+    r->block.count = 0;
+    r->block.transform = TRITCOL_DELTA;
+    r->block.first = 0;
+    r->block.min = 0;
+    r->block.max = 0;
+    r->error = false;
+}
+
+// tritcol_next checks the next header and makes it the current block.
+//
+// Returns: false at the end of the column, or with r->error set when the
+// header is malformed: unknown transform, count outside 1 ..
+// TRITCOL_BLOCK, a payload too short or too long for count - 1 numbers
+// or running past len, or first outside [min, max].
+bool tritcol_next(tritcol_reader_t *r) {
+    if (r->error || r->next == r->len) {
+        return false;
+    }
+    size_t left = r->len - r->next;
+    const uint8_t *h = r->in + r->next;
+    if (left < TRITCOL_HEAD) {
+        r->error = true;
+        return false;
+    }
+
+    size_t count = get16(h + 2);
+    size_t payload = get32(h + 4);
+    int64_t first = (int64_t)get64(h + 8);
+    int64_t lo = (int64_t)get64(h + 16);
+    int64_t hi = (int64_t)get64(h + 24);
+    if ((h[0] != TRITCOL_DELTA && h[0] != TRITCOL_DOD) || h[1] != 0 ||
+        count == 0 || count > TRITCOL_BLOCK ||
+        payload < count - 1 || payload > (count - 1) * TRIT_VARTRIT_MAX64 ||
+        payload > left - TRITCOL_HEAD || first < lo || first > hi) {
+        r->error = true;
+        return false;
+    }
+
+    r->block.row += r->block.count;
+    r->block.count = count;
+    r->block.transform = (tritcol_transform_t)h[0];
+    r->block.first = first;
+    r->block.min = lo;
+    r->block.max = hi;
+    r->pos = r->next + TRITCOL_HEAD;
+    r->payload = payload;
+    r->next = r->pos + payload;
+    return true;
+}
+
+// tritcol_read decodes the current block into out. Reading a block
+// again gives the same values; before the first tritcol_next, or after
+// an error, it returns TRITCOL_ERROR.
+size_t tritcol_read(tritcol_reader_t *r, int64_t *out) {
+    if (r->error || r->block.count == 0) {
+        return TRITCOL_ERROR;
+    }
+    if (!decode_block(r->in + r->pos, r->payload, &r->block, out)) {
+        r->error = true;
+        return TRITCOL_ERROR;
+    }
+    return r->block.count;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Whole Columns
+// ────────────────────────────────────────────────────────────────
+
+// tritcol_encode writes n values as blocks of TRITCOL_BLOCK.
+//
+// Parameters:
+//   in        - n values
+//   transform - TRITCOL_DELTA, TRITCOL_DOD, or TRITCOL_AUTO (per block)
+//   out       - TRITCOL_BOUND(n) bytes
+//
+// Returns: bytes written.
+size_t tritcol_encode(const int64_t *in, size_t n, tritcol_transform_t transform,
+                      uint8_t *out) {
+    if (transform != TRITCOL_DELTA && transform != TRITCOL_DOD) {
+        transform = TRITCOL_AUTO;
+    }
+    size_t o = 0;
+    for (size_t bs = 0; bs < n; bs += TRITCOL_BLOCK) {
+        size_t bn = n - bs < TRITCOL_BLOCK ? n - bs : TRITCOL_BLOCK;
+        o += encode_block(in + bs, bn, transform, out + o);
+    }
+    return o;
+}
+
+// tritcol_count adds up the counts of every header.
+size_t tritcol_count(const uint8_t *in, size_t len) {
+    tritcol_reader_t r;
+    size_t n = 0;
+    tritcol_reader_init(&r, in, len);
+    while (tritcol_next(&r)) {
+        n += r.block.count;
+    }
+    return r.error ? TRITCOL_ERROR : n;
+}
+
+// tritcol_decode reads every block straight into out.
+size_t tritcol_decode(const uint8_t *in, size_t len, int64_t *out, size_t cap) {
+    tritcol_reader_t r;
+    tritcol_reader_init(&r, in, len);
+    while (tritcol_next(&r)) {
+        if (r.block.count > cap - r.block.row) {
+            return TRITCOL_ERROR;
+        }
+        if (tritcol_read(&r, out + r.block.row) == TRITCOL_ERROR) {
+            return TRITCOL_ERROR;
+        }
+    }
+    return r.error ? TRITCOL_ERROR : r.block.row + r.block.count;
+}
+
+// tritcol_count_range counts values in [lo, hi], opening only blocks
+// that straddle a bound.
+size_t tritcol_count_range(const uint8_t *in, size_t len, int64_t lo, int64_t hi) {
+    tritcol_reader_t r;
+    int64_t vals[TRITCOL_BLOCK];
+    size_t c = 0;
+    tritcol_reader_init(&r, in, len);
+    while (tritcol_next(&r)) {
+        const tritcol_block_t *b = &r.block;
+        if (b->max < lo || b->min > hi) {
+            continue;
+        }
+        if (b->min >= lo && b->max <= hi) {
+            c += b->count;
+            continue;
+        }
+        size_t n = tritcol_read(&r, vals);
+        if (n == TRITCOL_ERROR) {
+            return TRITCOL_ERROR;
+        }
+        for (size_t i = 0; i < n; i++) {
+            c += (size_t)((vals[i] >= lo) & (vals[i] <= hi));
+        }
+    }
+    return r.error ? TRITCOL_ERROR : c;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// Encoding cannot fail. A reader never reads a byte past len: headers
+// are checked before their fields are used, payload decoding is bounded
+// by the header's length, and any mismatch latches r->error so later
+// calls stop. Blocks skipped by min / max are trusted unread - their
+// headers passed the checks, their payloads were never opened.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-tritcol   # round-trips per transform at block edges,
+//                       # wrapping differences, reader skips, range
+//                       # counts vs a plain loop, malformed columns
+//
+// Benchmark:
+//   make bench-tritcol  # bytes/value, full scans and range counts
+//                       # against plain int64 arrays
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// No allocation, no state.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ How AUTO chooses (any rule; the tag records the choice)
+//   ✅ Decode loops, as long as every value and the min / max check stay
+//
+// Modify with Extreme Care:
+//   ⚠️ TRITCOL_BLOCK - the stack buffers here and in readers' callers
+//      are sized by it, and older columns may hold larger blocks
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Header layout, byte order and transform tags (see Core Design)
+//   ❌ Every column must decode to exactly the values encoded
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// The one-byte path is a single loop of a byte load, one or two adds and
+// the min / max selects per value, bound by the running-sum chain. The
+// general path pays vartrit's per-value cost first. AUTO encoding calls
+// trit_vartrit_size twice per value; a fixed transform skips that.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "So teach us to number our days, that we may apply our hearts unto
+// wisdom." — Psalm 90:12
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,587 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// tritdot.c - Ternary × Ternary Products by Popcount
+// Key: B-word-work-pkg-trit-src-tritdot
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritmat.h, trit.h)
+//   Without TRIT_X86_SIMD (simd_internal.h) every backend counts with
+//   popcount64 (builtin or SWAR), one vector at a time.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 2: BCT Parallel]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Dot products, GEMV and GEMM where both sides are trit64b_t bit-planes -
+// 64 trit products per pair of popcounts - and Hamming distances the same
+// way.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Can two walk together, except they be agreed?" — Amos 3:3
+//
+// Principle: Count where two vectors agree, count where they disagree;
+//            the difference is their product.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Ternary × ternary half of the matrix layer (tritmat.h).
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Σ trit_multiply(a[i], b[i]) without looking at single trits.
+//
+// Core Design: trit_multiply(a, b) is +1 when the signs agree, -1 when
+//   they differ and 0 when either is 0. Per 64-lane word:
+//
+//     agree    = (Pa & Pb) | (Na & Nb)
+//     disagree = (Pa & Nb) | (Na & Pb)
+//     Σ        = popcount(agree) - popcount(disagree)
+//
+//   A trit64b_t array is stored pos, neg, pos, neg, ... so in vector
+//   registers A & B gives both agree halves and A & swap(B) (pos/neg
+//   exchanged within each 16-byte vector) both disagree halves. The
+//   halves never overlap, so popcounting them separately equals
+//   popcounting the OR.
+//
+//   Hamming distance counts lanes where the trits differ:
+//
+//     differ   = (Pa ^ Pb) | (Na ^ Nb)
+//
+//   In vector registers X = A ^ B holds both halves, and X | swap(X)
+//   holds differ twice, so its popcount is halved.
+//
+//   Kernels by backend:
+//     SCALAR, TABLE   portable popcount (builtin or SWAR)
+//     SSE41           POPCNT instruction
+//     AVX2            nibble lookup (vpshufb) + vpsadbw, 2 vectors per step
+//     AVX512          VPOPCNTDQ, 4 vectors per step, when the CPU has it;
+//                     otherwise the AVX2 kernel
+//
+// Key Features:
+//   - Same results as a trit_multiply loop on every kernel
+//   - Hamming kernels share the backend ladder and GEMM driver
+//   - GEMM reuses a block of query vectors across every weight row
+//   - No decode step: the planes are the compute format
+//
+// Philosophy: Agreement is something you can count.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: string.h (memset)
+//   - Internal: tritmat.h, trit.h (trit64b_t, trit64b_from_trits,
+//     trit5_to_trit64b_array), simd.c (trit_backend_active)
+//   - Compiler: immintrin.h + target attributes + __builtin_cpu_supports
+//     (GCC/Clang, x86 only)
+//
+// What Uses This:
+//   - Similarity scoring over ternary vector collections (tritindex.c);
+//     bench/tritdot_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None. The backend choice lives in simd.c.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <string.h>     // memset
+
+//--- Project Headers ---
+#include "tritmat.h"    // prototypes, TRITMAT_ROW_VECTORS
+#include "trit.h"       // trit64b_t, conversions, backend dispatch
+#include "simd_internal.h" // TRIT_X86_SIMD, intrinsics, popcount64
+
+// ────────────────────────────────────────────────────────────────
+// Constants
+// ────────────────────────────────────────────────────────────────
+
+// GEMM blocks: 16 query vectors × 64 vectors (4096 trits) of each = 16 KB,
+// held in L1 while every weight row passes over it.
+#define TRITDOT_BATCH_BLOCK  16
+#define TRITDOT_COL_BLOCK    64      // trit64b_t vectors
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// Dot or distance kernel over n whole vectors.
+typedef int64_t (*dot_t64b_fn)(const trit64b_t *a, const trit64b_t *b, size_t n);
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static int64_t dot_scalar(const trit64b_t *a, const trit64b_t *b, size_t n);
+
+#if TRIT_X86_SIMD
+static int64_t dot_popcnt(const trit64b_t *a, const trit64b_t *b, size_t n);
+static int64_t dot_avx2(const trit64b_t *a, const trit64b_t *b, size_t n);
+static int64_t dot_vpopcntdq(const trit64b_t *a, const trit64b_t *b, size_t n);
+#endif
+
+static int64_t dist_scalar(const trit64b_t *a, const trit64b_t *b, size_t n);
+
+#if TRIT_X86_SIMD
+static int64_t dist_popcnt(const trit64b_t *a, const trit64b_t *b, size_t n);
+static int64_t dist_avx2(const trit64b_t *a, const trit64b_t *b, size_t n);
+static int64_t dist_vpopcntdq(const trit64b_t *a, const trit64b_t *b, size_t n);
+#endif
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── tritmat_pack_t64b()  → trit64b_from_trits per 64 trits
+//   ├── tritmat_t5_to_t64b() → trit5_to_trit64b_array per row
+//   ├── tritmat_dot_t64b()   → select_dot()
+//   ├── tritmat_gemv_t64b()  → gemm_t64b(batch = 1)
+//   ├── tritmat_gemm_t64b()  → gemm_t64b()
+//   ├── tritmat_hamming_t64b()      → select_dist()
+//   └── tritmat_gemm_hamming_t64b() → gemm_t64b(select_dist())
+//
+//   Kernels (Bottom Rungs)
+//   ├── dot_{vpopcntdq, avx2, popcnt, scalar}  → popcount64 for tails
+//   └── dist_{vpopcntdq, avx2, popcnt, scalar} → popcount64 for tails
+//
+// Baton Flow:
+//   Entry → select_dot/select_dist → batch/column blocks → kernel per
+//   (row, vector)
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static size_t min_size(size_t a, size_t b) {
+    return a < b ? a : b;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Kernels
+// ────────────────────────────────────────────────────────────────
+
+static int64_t dot_scalar(const trit64b_t *a, const trit64b_t *b, size_t n) {
+    int64_t acc = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t agree = (a[i].pos & b[i].pos) | (a[i].neg & b[i].neg);
+        uint64_t disagree = (a[i].pos & b[i].neg) | (a[i].neg & b[i].pos);
+        acc += popcount64(agree) - popcount64(disagree);
+    }
+    return acc;
+}
+
+#if TRIT_X86_SIMD
+
+// Same loop with the builtin compiled to the POPCNT instruction.
+__attribute__((target("popcnt")))
+static int64_t dot_popcnt(const trit64b_t *a, const trit64b_t *b, size_t n) {
+    int64_t acc = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t agree = (a[i].pos & b[i].pos) | (a[i].neg & b[i].neg);
+        uint64_t disagree = (a[i].pos & b[i].neg) | (a[i].neg & b[i].pos);
+        acc += __builtin_popcountll(agree) - __builtin_popcountll(disagree);
+    }
+    return acc;
+}
+
+// popcount_bytes_avx2 counts bits per byte with a 16-entry nibble table.
+__attribute__((target("avx2")))
+static __m256i popcount_bytes_avx2(__m256i v) {
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(v, low));
+    __m256i hi = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+    return _mm256_add_epi8(lo, hi);
+}
+
+// Two vectors per step. Byte counts (≤ 8 per step) are summed for up to
+// 31 steps before vpsadbw widens them into 64-bit lanes.
+__attribute__((target("avx2")))
+static int64_t dot_avx2(const trit64b_t *a, const trit64b_t *b, size_t n) {
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i agree = zero, disagree = zero;
+    size_t i = 0;
+    while (i + 2 <= n) {
+        __m256i ca = zero, cd = zero;
+        size_t end = min_size(n & ~(size_t)1, i + 2 * 31);
+        for (; i < end; i += 2) {
+            __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)(a + i));
+            __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)(b + i));
+            __m256i vs = _mm256_shuffle_epi32(vb, 0x4E);      // swap pos/neg
+            ca = _mm256_add_epi8(ca, popcount_bytes_avx2(_mm256_and_si256(va, vb)));
+            cd = _mm256_add_epi8(cd, popcount_bytes_avx2(_mm256_and_si256(va, vs)));
+        }
+        agree = _mm256_add_epi64(agree, _mm256_sad_epu8(ca, zero));
+        disagree = _mm256_add_epi64(disagree, _mm256_sad_epu8(cd, zero));
+    }
+    __m256i d = _mm256_sub_epi64(agree, disagree);
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)(void *)lanes, d);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + dot_scalar(a + i, b + i, n - i);
+}
+
+// Four vectors per step with one vpopcntq per product half.
+__attribute__((target("avx512f,avx512vpopcntdq")))
+static int64_t dot_vpopcntdq(const trit64b_t *a, const trit64b_t *b, size_t n) {
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m512i va = _mm512_loadu_si512((const void *)(a + i));
+        __m512i vb = _mm512_loadu_si512((const void *)(b + i));
+        __m512i vs = _mm512_shuffle_epi32(vb, _MM_PERM_BADC);   // swap pos/neg
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(_mm512_and_si512(va, vb)));
+        acc = _mm512_sub_epi64(acc, _mm512_popcnt_epi64(_mm512_and_si512(va, vs)));
+    }
+    return (int64_t)_mm512_reduce_add_epi64(acc) + dot_scalar(a + i, b + i, n - i);
+}
+
+#endif // TRIT_X86_SIMD
+
+static int64_t dist_scalar(const trit64b_t *a, const trit64b_t *b, size_t n) {
+    int64_t acc = 0;
+    for (size_t i = 0; i < n; i++) {
+        acc += popcount64((a[i].pos ^ b[i].pos) | (a[i].neg ^ b[i].neg));
+    }
+    return acc;
+}
+
+#if TRIT_X86_SIMD
+
+__attribute__((target("popcnt")))
+static int64_t dist_popcnt(const trit64b_t *a, const trit64b_t *b, size_t n) {
+    int64_t acc = 0;
+    for (size_t i = 0; i < n; i++) {
+        acc += __builtin_popcountll((a[i].pos ^ b[i].pos) | (a[i].neg ^ b[i].neg));
+    }
+    return acc;
+}
+
+// Counts X | swap(X) - every differing lane twice - so the sum is halved.
+__attribute__((target("avx2")))
+static int64_t dist_avx2(const trit64b_t *a, const trit64b_t *b, size_t n) {
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i total = zero;
+    size_t i = 0;
+    while (i + 2 <= n) {
+        __m256i c = zero;
+        size_t end = min_size(n & ~(size_t)1, i + 2 * 31);
+        for (; i < end; i += 2) {
+            __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)(a + i));
+            __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)(b + i));
+            __m256i x = _mm256_xor_si256(va, vb);
+            x = _mm256_or_si256(x, _mm256_shuffle_epi32(x, 0x4E));
+            c = _mm256_add_epi8(c, popcount_bytes_avx2(x));
+        }
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(c, zero));
+    }
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)(void *)lanes, total);
+    return (lanes[0] + lanes[1] + lanes[2] + lanes[3]) / 2 + dist_scalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx512f,avx512vpopcntdq")))
+static int64_t dist_vpopcntdq(const trit64b_t *a, const trit64b_t *b, size_t n) {
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m512i va = _mm512_loadu_si512((const void *)(a + i));
+        __m512i vb = _mm512_loadu_si512((const void *)(b + i));
+        __m512i x = _mm512_xor_si512(va, vb);
+        x = _mm512_or_si512(x, _mm512_shuffle_epi32(x, _MM_PERM_BADC));
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(x));
+    }
+    return (int64_t)_mm512_reduce_add_epi64(acc) / 2 + dist_scalar(a + i, b + i, n - i);
+}
+
+#endif // TRIT_X86_SIMD
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Kernel Selection
+// ────────────────────────────────────────────────────────────────
+
+// select_dot maps the active backend to a kernel. POPCNT and VPOPCNTDQ
+// are separate CPUID bits from the backend's own, so they are checked
+// here.
+static dot_t64b_fn select_dot(void) {
+#if TRIT_X86_SIMD
+    switch (trit_backend_active()) {
+    case TRIT_BACKEND_AVX512:
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512vpopcntdq")) {
+            return dot_vpopcntdq;
+        }
+        return dot_avx2;
+    case TRIT_BACKEND_AVX2:
+        return dot_avx2;
+    case TRIT_BACKEND_SSE41:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("popcnt") ? dot_popcnt : dot_scalar;
+    default:
+        return dot_scalar;
+    }
+#else
+    return dot_scalar;
+#endif
+}
+
+// select_dist is select_dot for the Hamming kernels.
+static dot_t64b_fn select_dist(void) {
+#if TRIT_X86_SIMD
+    switch (trit_backend_active()) {
+    case TRIT_BACKEND_AVX512:
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512vpopcntdq")) {
+            return dist_vpopcntdq;
+        }
+        return dist_avx2;
+    case TRIT_BACKEND_AVX2:
+        return dist_avx2;
+    case TRIT_BACKEND_SSE41:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("popcnt") ? dist_popcnt : dist_scalar;
+    default:
+        return dist_scalar;
+    }
+#else
+    return dist_scalar;
+#endif
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Blocked Driver
+// ────────────────────────────────────────────────────────────────
+
+// gemm_t64b loops batch block, column block, row, vector, accumulating
+// partial dots into y.
+static void gemm_t64b(const trit64b_t *w, size_t rows, size_t cols,
+                      const trit64b_t *x, size_t batch, int32_t *y, dot_t64b_fn dot) {
+    size_t nv = TRITMAT_ROW_VECTORS(cols);
+
+    memset(y, 0, rows * batch * sizeof(*y));
+    for (size_t b0 = 0; b0 < batch; b0 += TRITDOT_BATCH_BLOCK) {
+        size_t b1 = min_size(batch, b0 + TRITDOT_BATCH_BLOCK);
+        for (size_t v0 = 0; v0 < nv; v0 += TRITDOT_COL_BLOCK) {
+            size_t kv = min_size(TRITDOT_COL_BLOCK, nv - v0);
+            for (size_t r = 0; r < rows; r++) {
+                const trit64b_t *wr = w + r * nv + v0;
+                for (size_t b = b0; b < b1; b++) {
+                    y[r * batch + b] += (int32_t)dot(wr, x + b * nv + v0, kv);
+                }
+            }
+        }
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+// tritmat_pack_t64b packs a row-major rows × cols trit matrix into
+// bitsliced rows of TRITMAT_ROW_VECTORS(cols) vectors, zero past cols.
+//
+// Parameters:
+//   w    - rows·cols valid trits, row-major
+//   rows - row count
+//   cols - trits per row
+//   out  - rows·TRITMAT_ROW_VECTORS(cols) vectors
+//
+// Returns: vectors written
+size_t tritmat_pack_t64b(const trit_t *w, size_t rows, size_t cols, trit64b_t *out) {
+    size_t nv = TRITMAT_ROW_VECTORS(cols);
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t v = 0; v < nv; v++) {
+            size_t c = v * 64;
+            out[r * nv + v] = trit64b_from_trits(w + r * cols + c, min_size(64, cols - c));
+        }
+    }
+    return rows * nv;
+}
+
+// tritmat_t5_to_t64b converts a tritmat_pack matrix (t5b1 rows) into
+// bitsliced rows.
+//
+// Parameters:
+//   w    - rows·TRITMAT_ROW_BYTES(cols) bytes
+//   rows - row count
+//   cols - trits per row
+//   out  - rows·TRITMAT_ROW_VECTORS(cols) vectors
+//
+// Returns: vectors written
+size_t tritmat_t5_to_t64b(const uint8_t *w, size_t rows, size_t cols, trit64b_t *out) {
+    size_t nv = TRITMAT_ROW_VECTORS(cols);
+    for (size_t r = 0; r < rows; r++) {
+        trit5_to_trit64b_array(w + r * TRITMAT_ROW_BYTES(cols), cols, out + r * nv);
+    }
+    return rows * nv;
+}
+
+// tritmat_dot_t64b returns Σ trit_multiply(a[i], b[i]) over n trits.
+//
+// Parameters:
+//   a, b - TRIT64B_COUNT(n) valid vectors each, zero past lane n
+//   n    - trit count
+int64_t tritmat_dot_t64b(const trit64b_t *a, const trit64b_t *b, size_t n) {
+    return select_dot()(a, b, TRIT64B_COUNT(n));
+}
+
+// tritmat_gemv_t64b sets y[r] = Σ_c W[r][c]·x[c].
+//
+// Parameters:
+//   w    - rows·TRITMAT_ROW_VECTORS(cols) vectors
+//   rows - output rows
+//   cols - trits per row
+//   x    - TRITMAT_ROW_VECTORS(cols) vectors
+//   y    - rows results
+void tritmat_gemv_t64b(const trit64b_t *w, size_t rows, size_t cols,
+                       const trit64b_t *x, int32_t *y) {
+    gemm_t64b(w, rows, cols, x, 1, y, select_dot());
+}
+
+// tritmat_gemm_t64b sets y[r·batch + b] = Σ_c W[r][c]·x_b[c], where x_b
+// starts at x + b·TRITMAT_ROW_VECTORS(cols).
+void tritmat_gemm_t64b(const trit64b_t *w, size_t rows, size_t cols,
+                       const trit64b_t *x, size_t batch, int32_t *y) {
+    gemm_t64b(w, rows, cols, x, batch, y, select_dot());
+}
+
+// tritmat_hamming_t64b returns the number of lanes i < n where a[i] != b[i].
+//
+// Parameters:
+//   a, b - TRIT64B_COUNT(n) valid vectors each, zero past lane n
+//   n    - trit count
+int64_t tritmat_hamming_t64b(const trit64b_t *a, const trit64b_t *b, size_t n) {
+    return select_dist()(a, b, TRIT64B_COUNT(n));
+}
+
+// tritmat_gemm_hamming_t64b sets y[r·batch + b] to the Hamming distance
+// between row r and x_b, laid out as in tritmat_gemm_t64b.
+void tritmat_gemm_hamming_t64b(const trit64b_t *w, size_t rows, size_t cols,
+                               const trit64b_t *x, size_t batch, int32_t *y) {
+    gemm_t64b(w, rows, cols, x, batch, y, select_dist());
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// Inputs are assumed valid. A lane set in both planes of one operand
+// counts as both agreeing and disagreeing; nonzero lanes past n are
+// counted like real trits, in products and distances alike.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-tritdot   # every backend vs a trit_multiply loop (and a
+//                       # trit-compare loop for Hamming), lengths across
+//                       # vector and block edges, GEMV/GEMM shapes
+//
+// Benchmark:
+//   make bench-tritdot  # trit_multiply loop vs each kernel
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// No allocation, no state.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ TRITDOT_*_BLOCK sizes (re-run make bench-tritdot)
+//   ✅ Unrolling the kernels (results must not change)
+//
+// Modify with Extreme Care:
+//   ⚠️ AVX2 flush interval: 31 steps × 8 ≤ 255 per byte lane (both
+//      dot and dist kernels)
+//   ⚠️ The pos/neg swap shuffles depend on trit64b_t being { pos, neg }
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Results must equal Σ trit_multiply (or the count of differing
+//      trits) on every kernel
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// A trit64b_t is 16 bytes for 64 trits, so a dot product reads 4 bits
+// per trit pair and does no per-trit work. Large collections are bound
+// by memory bandwidth once the query block is in L1.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Can two walk together, except they be agreed?" — Amos 3:3
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
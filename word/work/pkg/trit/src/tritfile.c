@@ -0,0 +1,543 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// tritfile.c - Memory-Mapped .t5 Trit Files
+// Key: B-word-work-pkg-trit-src-tritfile
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritfile.h, trit.h)
+//   C99 plus POSIX file mapping (open, fstat, mmap). Unpacking goes
+//   through trit5_unpack_array, which picks its own backend.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Memory Alignment]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Writer, header checks, mapping and range reads for tritfile.h.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "But thou, O Daniel, shut up the words, and seal the book,
+//            even to the time of the end: many shall run to and fro, and
+//            knowledge shall be increased." — Daniel 12:4
+//
+// Principle: A sealed book can still be opened at any page. Check the
+//            seal once, then read where you need to.
+//
+// # CPI-SI Identity
+//
+// Component Type: Rungs (built on the t5b1 layer)
+//
+// Role: File layer for tritfile.h.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Put t5b1 bytes on disk so that mapping the file gives back
+//          the packed array, with enough header to refuse anything else.
+//
+// Core Design:
+//
+//   File. Header (all integers little-endian):
+//     0   8   magic TRITFILE_MAGIC ("TRIT5\r\n\032")
+//     8   u16 version (TRITFILE_VERSION)
+//     10  u16 header bytes (TRITFILE_HEAD)
+//     12  u32 chunk bytes (1 .. SIZE_MAX / 5)
+//     16  u64 trit count
+//     24  u64 chunk count (payload bytes / chunk bytes, rounded up)
+//     32  u64 payload offset (64 + 4 · chunks, rounded up to 64)
+//     40  u64 payload bytes (TRIT5_PACKED_SIZE(count))
+//     48  u32 header checksum
+//     52  12 bytes 0
+//   then one u32 Adler-32 per chunk, zeros up to the payload offset, and
+//   the payload. The header checksum is Adler-32 over the 64 header bytes
+//   (with its own field as 0) followed by the chunk table. The file ends
+//   exactly at the end of the payload.
+//
+//   Writing. The header goes out as zeros first; the chunk table is
+//   streamed while the checksums are taken, then the payload, and the
+//   finished header is written over the zeros.
+//
+//   Opening. Magic, version and the table's fit in the file come first,
+//   then the checksum, then every field against the others and the file
+//   size. Only then are data and sums set.
+//
+// Key Features:
+//   - One checksum pass over the payload to write, none to open
+//   - Payload on a 64-byte boundary (page-aligned mapping + 64)
+//   - Slices split into a table-read head and whole bytes
+//
+// Philosophy: Refuse a file before handing out a pointer into it.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: stdio.h (writer), string.h
+//   - POSIX: fcntl.h, sys/mman.h, sys/stat.h, unistd.h (reader)
+//   - Internal: tritfile.h, trit.h (TRIT5_DECODE_TABLE,
+//     trit5_unpack_array)
+//
+// What Uses This:
+//   - tritfile.h consumers; bench/tritfile_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None beyond the caller's tritfile_t. The file descriptor is
+//        closed as soon as the mapping exists.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 200809L  // open, fstat, mmap
+
+//--- Standard Library ---
+#include <stdio.h>        // fopen, fwrite, fseek, remove
+#include <string.h>       // memcpy, memset
+
+//--- Platform ---
+#include <fcntl.h>        // open
+#include <sys/mman.h>     // mmap, munmap
+#include <sys/stat.h>     // fstat
+#include <unistd.h>       // close
+
+//--- Project Headers ---
+#include "tritfile.h"     // tritfile_*, TRITFILE_*
+#include "trit.h"         // TRIT5_PACKED_SIZE, trit5_unpack_array
+
+// ────────────────────────────────────────────────────────────────
+// Constants
+// ────────────────────────────────────────────────────────────────
+
+#define MAGIC_BYTES   8
+#define SUM_FIELD     48        // header checksum offset
+#define ALIGN         64        // payload offset boundary
+#define ADLER_MOD     65521     // largest prime below 2^16
+#define ADLER_NMAX    5552      // bytes before the sums could overflow 32 bits
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static uint32_t adler32(uint32_t sum, const uint8_t *p, size_t n);
+static tritfile_status_t check_header(tritfile_t *f, const uint8_t *m, size_t len);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── tritfile_write()  → layout, adler32 per chunk, stdio
+//   ├── tritfile_open()   → mmap, check_header
+//   ├── tritfile_close()  → munmap
+//   ├── tritfile_slice()  → table reads to a byte boundary,
+//   │                       trit5_unpack_array for the rest
+//   ├── tritfile_chunk()  → pointer arithmetic
+//   └── tritfile_verify() → adler32 against the table
+//
+//   Middle Rungs
+//   ├── layout()       → chunk count and payload offset for a count
+//   └── check_header() → magic, version, checksum, fields vs size
+//
+//   Bottom Rungs
+//   ├── adler32()
+//   └── put16/32/64, get16/32/64 (little-endian)
+//
+// Baton Flow:
+//   Write: chunk sums → table → payload → header
+//   Open:  map → header checks → data / sums pointers
+
+// ────────────────────────────────────────────────────────────────
+// Helpers - Little-Endian Fields
+// ────────────────────────────────────────────────────────────────
+
+static void put16(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v) {
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static void put64(uint8_t *p, uint64_t v) {
+    put32(p, (uint32_t)v);
+    put32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint32_t get16(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8;
+}
+
+static uint32_t get32(const uint8_t *p) {
+    return get16(p) | get16(p + 2) << 16;
+}
+
+static uint64_t get64(const uint8_t *p) {
+    return (uint64_t)get32(p) | (uint64_t)get32(p + 4) << 32;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Helpers - Checksum and Layout
+// ────────────────────────────────────────────────────────────────
+
+// adler32 continues an Adler-32 sum (start with 1) over n bytes,
+// reducing once per ADLER_NMAX bytes.
+static uint32_t adler32(uint32_t sum, const uint8_t *p, size_t n) {
+    uint32_t a = sum & 0xFFFF;
+    uint32_t b = sum >> 16;
+    while (n > 0) {
+        size_t k = n < ADLER_NMAX ? n : ADLER_NMAX;
+        for (size_t i = 0; i < k; i++) {
+            a += p[i];
+            b += a;
+        }
+        a %= ADLER_MOD;
+        b %= ADLER_MOD;
+        p += k;
+        n -= k;
+    }
+    return b << 16 | a;
+}
+
+// layout gives the chunk count and payload offset for bytes of payload
+// in chunks of chunk bytes.
+static void layout(uint64_t bytes, uint64_t chunk, uint64_t *chunks, uint64_t *offset) {
+    *chunks = bytes / chunk + (bytes % chunk != 0);
+    *offset = (TRITFILE_HEAD + 4 * *chunks + ALIGN - 1) / ALIGN * ALIGN;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Header Checks
+// ────────────────────────────────────────────────────────────────
+
+// check_header validates the len-byte mapping m and fills f from it.
+//
+// Returns: TRITFILE_OK, or the first failure in order - magic (FORMAT),
+// version (VERSION), chunk table inside the file (FORMAT), checksum
+// (CHECKSUM), then header size, reserved bytes, chunk size, and count,
+// chunks, offset and payload bytes against each other and len (FORMAT).
+static tritfile_status_t check_header(tritfile_t *f, const uint8_t *m, size_t len) {
+    if (memcmp(m, TRITFILE_MAGIC, MAGIC_BYTES) != 0) {
+        return TRITFILE_ERR_FORMAT;
+    }
+    if (get16(m + 8) != TRITFILE_VERSION) {
+        return TRITFILE_ERR_VERSION;
+    }
+
+    uint64_t chunks = get64(m + 24);
+    if (chunks > (len - TRITFILE_HEAD) / 4) {
+        return TRITFILE_ERR_FORMAT;
+    }
+    uint8_t head[TRITFILE_HEAD];
+    memcpy(head, m, TRITFILE_HEAD);
+    put32(head + SUM_FIELD, 0);
+    uint32_t sum = adler32(1, head, TRITFILE_HEAD);
+    sum = adler32(sum, m + TRITFILE_HEAD, (size_t)chunks * 4);
+    if (sum != get32(m + SUM_FIELD)) {
+        return TRITFILE_ERR_CHECKSUM;
+    }
+
+    uint64_t chunk = get32(m + 12);
+    uint64_t count = get64(m + 16);
+    uint64_t offset = get64(m + 32);
+    uint64_t bytes = get64(m + 40);
+    uint64_t want_chunks;
+    uint64_t want_offset;
+    if (get16(m + 10) != TRITFILE_HEAD || chunk == 0 || chunk > SIZE_MAX / 5) {
+        return TRITFILE_ERR_FORMAT;
+    }
+    for (size_t i = SUM_FIELD + 4; i < TRITFILE_HEAD; i++) {
+        if (m[i] != 0) {
+            return TRITFILE_ERR_FORMAT;
+        }
+    }
+    layout(bytes, chunk, &want_chunks, &want_offset);
+    if (bytes != count / 5 + (count % 5 != 0) || chunks != want_chunks ||
+        offset != want_offset || offset > len || bytes != len - offset) {
+        return TRITFILE_ERR_FORMAT;
+    }
+
+    f->map = m;
+    f->map_len = len;
+    f->data = m + offset;
+    f->sums = m + TRITFILE_HEAD;
+    f->count = count;
+    f->chunk = (size_t)chunk;
+    f->chunks = (size_t)chunks;
+    return TRITFILE_OK;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Files
+// ────────────────────────────────────────────────────────────────
+
+// tritfile_write lays out n trits of t5b1 bytes as a .t5 file.
+//
+// Parameters:
+//   path  - file to create or replace
+//   t5    - TRIT5_PACKED_SIZE(n) bytes (trit5_pack_array layout)
+//   n     - trit count
+//   chunk - payload bytes per checksum (0: TRITFILE_CHUNK)
+//
+// Returns: TRITFILE_OK; TRITFILE_ERR_FORMAT if chunk exceeds a u32 or
+// SIZE_MAX / 5, or the payload would not fit in memory; TRITFILE_ERR_IO
+// if a write fails (the partial file is removed).
+tritfile_status_t tritfile_write(const char *path, const uint8_t *t5, uint64_t n,
+                                 size_t chunk) {
+    if (chunk == 0) {
+        chunk = TRITFILE_CHUNK;
+    }
+    uint64_t bytes = n / 5 + (n % 5 != 0);
+    if ((uint64_t)chunk > UINT32_MAX || chunk > SIZE_MAX / 5 || bytes > SIZE_MAX) {
+        return TRITFILE_ERR_FORMAT;
+    }
+    uint64_t chunks;
+    uint64_t offset;
+    layout(bytes, chunk, &chunks, &offset);
+
+    uint8_t head[TRITFILE_HEAD];
+    memset(head, 0, sizeof head);
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL) {
+        return TRITFILE_ERR_IO;
+    }
+    bool ok = fwrite(head, 1, TRITFILE_HEAD, fp) == TRITFILE_HEAD;
+
+    memcpy(head, TRITFILE_MAGIC, MAGIC_BYTES);
+    put16(head + 8, TRITFILE_VERSION);
+    put16(head + 10, TRITFILE_HEAD);
+    put32(head + 12, (uint32_t)chunk);
+    put64(head + 16, n);
+    put64(head + 24, chunks);
+    put64(head + 32, offset);
+    put64(head + 40, bytes);
+    uint32_t sum = adler32(1, head, TRITFILE_HEAD);
+
+    for (uint64_t k = 0; k < chunks && ok; k++) {
+        size_t at = (size_t)k * chunk;
+        size_t len = (size_t)bytes - at < chunk ? (size_t)bytes - at : chunk;
+        uint8_t entry[4];
+        put32(entry, adler32(1, t5 + at, len));
+        sum = adler32(sum, entry, 4);
+        ok = fwrite(entry, 1, 4, fp) == 4;
+    }
+    for (uint64_t at = TRITFILE_HEAD + 4 * chunks; at < offset && ok; at++) {
+        ok = fputc(0, fp) != EOF;
+    }
+    ok = ok && fwrite(t5, 1, (size_t)bytes, fp) == (size_t)bytes;
+
+    put32(head + SUM_FIELD, sum);
+    ok = ok && fseek(fp, 0, SEEK_SET) == 0 && fwrite(head, 1, TRITFILE_HEAD, fp) == TRITFILE_HEAD;
+    ok = fclose(fp) == 0 && ok;
+    if (!ok) {
+        remove(path);
+        return TRITFILE_ERR_IO;
+    }
+    return TRITFILE_OK;
+}
+
+// tritfile_open maps path read-only and checks it (see check_header).
+// Only the header and chunk table are read.
+tritfile_status_t tritfile_open(tritfile_t *f, const char *path) {
+    memset(f, 0, sizeof *f);
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return TRITFILE_ERR_IO;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return TRITFILE_ERR_IO;
+    }
+    if (st.st_size < TRITFILE_HEAD || (uint64_t)st.st_size > SIZE_MAX) {
+        close(fd);
+        return TRITFILE_ERR_FORMAT;
+    }
+
+    size_t len = (size_t)st.st_size;
+    void *m = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (m == MAP_FAILED) {
+        return TRITFILE_ERR_IO;
+    }
+    tritfile_status_t s = check_header(f, m, len);
+    if (s != TRITFILE_OK) {
+        munmap(m, len);
+    }
+    return s;
+}
+
+void tritfile_close(tritfile_t *f) {
+    if (f->map != NULL) {
+        munmap((void *)f->map, f->map_len);
+    }
+    memset(f, 0, sizeof *f);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Access
+// ────────────────────────────────────────────────────────────────
+
+// tritfile_slice reads trits up to the next byte boundary one at a time,
+// then hands the rest to trit5_unpack_array, which writes exactly the
+// trits asked for.
+size_t tritfile_slice(const tritfile_t *f, uint64_t i, size_t n, trit_t *out) {
+    if (i >= f->count) {
+        return 0;
+    }
+    if (n > f->count - i) {
+        n = (size_t)(f->count - i);
+    }
+    size_t head = (size_t)((5 - i % 5) % 5);
+    head = head < n ? head : n;
+    for (size_t k = 0; k < head; k++) {
+        out[k] = tritfile_get(f, i + k);
+    }
+    trit5_unpack_array(f->data + (i + head) / 5, n - head, out + head);
+    return n;
+}
+
+// tritfile_chunk points into the payload; every chunk but the last holds
+// 5 · f->chunk trits.
+const uint8_t *tritfile_chunk(const tritfile_t *f, size_t k, size_t *n) {
+    if (k >= f->chunks) {
+        return NULL;
+    }
+    uint64_t per = (uint64_t)f->chunk * 5;
+    uint64_t left = f->count - (uint64_t)k * per;
+    *n = (size_t)(left < per ? left : per);
+    return f->data + k * f->chunk;
+}
+
+bool tritfile_verify(const tritfile_t *f, size_t k) {
+    size_t n;
+    const uint8_t *p = tritfile_chunk(f, k, &n);
+    if (p == NULL) {
+        return false;
+    }
+    return adler32(1, p, TRIT5_PACKED_SIZE(n)) == get32(f->sums + 4 * k);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// Nothing past the mapping is ever read: the chunk table's length is
+// bounded by the file size before it is summed, and data / sums are set
+// only once every field agrees with the others and with the size. A
+// failed open unmaps and leaves f zeroed, so tritfile_close on it is
+// harmless. A failed write removes what it wrote.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-tritfile   # byte layout, get / slice / chunk against the
+//                        # source at chunk edges, damaged and truncated
+//                        # files
+//
+// Benchmark:
+//   make bench-tritfile  # open vs fread + unpack, random gets, chunk
+//                        # sums
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// tritfile_close unmaps; the writer closes its stream on every path.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Writer buffering, mapping flags and access hints
+//   ✅ The checksum loop, as long as it computes Adler-32
+//
+// Modify with Extreme Care:
+//   ⚠️ check_header order - tests pin which status each damage gives
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Header layout, byte order, alignment and checksum for version 1
+//      (see Core Design); change TRITFILE_VERSION instead
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Opening sums 64 + 4 · chunks bytes. Slices spend at most four table
+// reads before reaching whole bytes. Adler-32 here is a plain byte loop
+// (about one byte per cycle), so verifying costs about as much as a
+// checksum pass in the writer; it is never done implicitly.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "But thou, O Daniel, shut up the words, and seal the book, even to the
+// time of the end: many shall run to and fro, and knowledge shall be
+// increased." — Daniel 12:4
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,549 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// tritfilter.c - Three-Valued Column Filters
+// Key: B-word-work-pkg-trit-src-tritfilter
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritfilter.h, logic.h, tritop.h, trit.h)
+//   Without TRIT_X86_SIMD (simd_internal.h) columns split into
+//   bit-planes 8 trits per SWAR step.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-logic-algorithms.adoc [Dyadic Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Chunked evaluation of three-valued predicate trees over columns.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Gather ye together first the tares, and bind them in
+//            bundles to burn them: but gather the wheat into my barn."
+//            — Matthew 13:30
+//
+// Principle: Sort by what is known; do not guess at the rest.
+//
+// # CPI-SI Identity
+//
+// Component Type: Rungs (built on the logic layer)
+//
+// Role: Turns a tritfilter_t and its columns into bitmaps or selection
+//       vectors.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Evaluate predicate trees a chunk at a time with bitsliced
+//          Kleene logic, skipping subtrees a chunk cannot need.
+//
+// Core Design: Per chunk of TRITFILTER_CHUNK rows (CHUNK_WORDS bool3x64_t
+//   words), eval_node walks the tree recursively. A node's result lands
+//   in the scratch slot for its depth: the left operand of AND / OR
+//   shares its parent's slot, the right one takes the next, so the slots
+//   needed equal the tree's depth (at most TRITFILTER_MAX_NODES, since
+//   operands index earlier nodes).
+//
+//   COLUMN nodes split trit_t bytes into planes: neg = sign bits
+//   (movemask), pos = bytes equal to +1 (compare + movemask; AVX-512BW
+//   gives both as mask registers), then map the planes through the
+//   node's monadic table. Rows past n are set false so they never
+//   satisfy AND, and are masked off again at output (NOT flips them).
+//
+// Key Features:
+//   - One split kernel per backend, the tree itself is word logic
+//   - AND / OR skip the right subtree on an all-false / all-true chunk
+//   - Bitmaps and selection vectors from the same root planes
+//
+// Philosophy: Read a column only when the answer can still change.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Internal: tritfilter.h (tritfilter_t, prototypes), logic.h
+//     (bool3x64_* connectives), tritop.h (trit_op1_eval), trit.h
+//     (trit64b_from_trits, backend enum), simd.c (trit_backend_active)
+//   - Compiler: immintrin.h + target attributes (GCC/Clang, x86 only)
+//
+// What Uses This:
+//   - tritfilter.h consumers; bench/tritfilter_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None. Chunk scratch lives on the evaluating call's stack.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <string.h>       // memset
+
+//--- Project Headers ---
+#include "tritfilter.h"   // tritfilter_t, prototypes
+#include "logic.h"        // bool3x64_* connectives
+#include "trit.h"         // trit64b_from_trits, backend dispatch
+#include "tritop.h"       // trit_op1_eval
+#include "simd_internal.h" // TRIT_X86_SIMD, intrinsics, popcount64, ctz64
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define CHUNK_WORDS  (TRITFILTER_CHUNK / 64)
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// chunk_t is one chunk's evaluation state: the rows it covers and one
+// scratch slot of planes per tree depth.
+typedef struct {
+    const trit_t *const *columns;
+    size_t row;                 // first row
+    size_t rows;                // rows in this chunk (≤ TRITFILTER_CHUNK)
+    size_t words;               // ceil(rows / 64)
+    bool3x64_t slot[TRITFILTER_MAX_NODES][CHUNK_WORDS];
+} chunk_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static void split_generic(const trit_t *in, size_t words, bool3x64_t *out);
+static void load_column(const trit_t *col, size_t rows, uint8_t table, bool3x64_t *out);
+static void eval_node(const tritfilter_t *f, size_t idx, size_t depth, chunk_t *c);
+static const bool3x64_t *eval_chunk(const tritfilter_t *f, chunk_t *c, size_t row, size_t n);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── tritfilter_init/column/not/and/or() → add_node()
+//   ├── tritfilter_bitmap() → eval_chunk() per chunk → masked root planes
+//   └── tritfilter_select() → eval_chunk() per chunk → ctz per set bit
+//
+//   Evaluation (Middle Rungs)
+//   ├── eval_chunk() → eval_node(root, depth 0), tail mask
+//   └── eval_node()  → COLUMN: load_column() → split_*() (backend)
+//                      NOT / AND / OR: children, all_false / all_true skip
+//
+//   Helpers (Bottom Rungs)
+//   └── all_false, all_true, valid_mask (+ popcount64, ctz64 from
+//       simd_internal.h)
+//
+// Baton Flow:
+//   Entry → chunk → tree (skipping dead subtrees) → root planes → output
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+// valid_mask has a bit for each of the rows lanes of a word (rows ≥ 64:
+// all of them).
+static uint64_t valid_mask(size_t rows) {
+    return rows >= 64 ? ~0ULL : ((1ULL << rows) - 1);
+}
+
+static int all_false(const bool3x64_t *v, size_t words) {
+    uint64_t neg = ~0ULL;
+    for (size_t w = 0; w < words; w++) {
+        neg &= v[w].neg;
+    }
+    return neg == ~0ULL;
+}
+
+static int all_true(const bool3x64_t *v, size_t words) {
+    uint64_t pos = ~0ULL;
+    for (size_t w = 0; w < words; w++) {
+        pos &= v[w].pos;
+    }
+    return pos == ~0ULL;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Column Split Kernels
+// ────────────────────────────────────────────────────────────────
+//
+// Each turns words × 64 valid trit_t bytes into bit-planes: a byte is -1
+// iff its sign bit is set, +1 iff it equals 1.
+
+// split_generic is the portable kernel (SWAR, 8 bytes per step).
+static void split_generic(const trit_t *in, size_t words, bool3x64_t *out) {
+    for (size_t w = 0; w < words; w++) {
+        out[w] = trit64b_from_trits(in + 64 * w, 64);
+    }
+}
+
+#if TRIT_X86_SIMD
+__attribute__((target("sse4.1")))
+static void split_sse41(const trit_t *in, size_t words, bool3x64_t *out) {
+    const __m128i one = _mm_set1_epi8(1);
+    for (size_t w = 0; w < words; w++) {
+        uint64_t pos = 0, neg = 0;
+        for (int k = 0; k < 4; k++) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(in + 64 * w + 16 * k));
+            neg |= (uint64_t)(uint32_t)_mm_movemask_epi8(v) << (16 * k);
+            pos |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, one)) << (16 * k);
+        }
+        out[w].pos = pos;
+        out[w].neg = neg;
+    }
+}
+
+__attribute__((target("avx2")))
+static void split_avx2(const trit_t *in, size_t words, bool3x64_t *out) {
+    const __m256i one = _mm256_set1_epi8(1);
+    for (size_t w = 0; w < words; w++) {
+        __m256i lo = _mm256_loadu_si256((const __m256i *)(const void *)(in + 64 * w));
+        __m256i hi = _mm256_loadu_si256((const __m256i *)(const void *)(in + 64 * w + 32));
+        out[w].neg = (uint64_t)(uint32_t)_mm256_movemask_epi8(lo) |
+                     (uint64_t)(uint32_t)_mm256_movemask_epi8(hi) << 32;
+        out[w].pos = (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, one)) |
+                     (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, one)) << 32;
+    }
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static void split_avx512(const trit_t *in, size_t words, bool3x64_t *out) {
+    const __m512i one = _mm512_set1_epi8(1);
+    for (size_t w = 0; w < words; w++) {
+        __m512i v = _mm512_loadu_si512((const void *)(in + 64 * w));
+        out[w].neg = (uint64_t)_mm512_movepi8_mask(v);
+        out[w].pos = (uint64_t)_mm512_cmpeq_epi8_mask(v, one);
+    }
+}
+#endif // TRIT_X86_SIMD
+
+// load_column fills out with table(col[0..rows)) as planes, rows past
+// rows (up to the word boundary) false.
+static void load_column(const trit_t *col, size_t rows, uint8_t table, bool3x64_t *out) {
+    size_t full = rows / 64, tail = rows % 64;
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: split_avx512(col, full, out); break;
+    case TRIT_BACKEND_AVX2:   split_avx2(col, full, out);   break;
+    case TRIT_BACKEND_SSE41:  split_sse41(col, full, out);  break;
+#endif
+    default:                  split_generic(col, full, out); break;
+    }
+    if (tail) {
+        out[full] = trit64b_from_trits(col + 64 * full, tail);
+    }
+    size_t words = full + (tail != 0);
+
+    if (table != TRIT_OP1_IDENTITY) {
+        // Plane masks per input value: all ones where table(v) = +1 / -1
+        uint64_t p[3], q[3];
+        for (int v = 0; v < 3; v++) {
+            trit_t r = trit_op1_eval(table, (trit_t)(v - 1));
+            p[v] = r == TRIT_POS ? ~0ULL : 0;
+            q[v] = r == TRIT_NEG ? ~0ULL : 0;
+        }
+        for (size_t w = 0; w < words; w++) {
+            uint64_t neg = out[w].neg, pos = out[w].pos, zero = ~(neg | pos);
+            out[w].pos = (neg & p[0]) | (zero & p[1]) | (pos & p[2]);
+            out[w].neg = (neg & q[0]) | (zero & q[1]) | (pos & q[2]);
+        }
+    }
+    if (tail) {
+        uint64_t pad = ~valid_mask(tail);
+        out[full].pos &= ~pad;
+        out[full].neg |= pad;
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Tree Evaluation
+// ────────────────────────────────────────────────────────────────
+
+// eval_node writes node idx's planes for the chunk to c->slot[depth].
+static void eval_node(const tritfilter_t *f, size_t idx, size_t depth, chunk_t *c) {
+    const tritfilter_node_t *nd = &f->node[idx];
+    bool3x64_t *r = c->slot[depth];
+    size_t w;
+
+    switch (nd->kind) {
+    case TRITFILTER_COLUMN:
+        load_column(c->columns[nd->a] + c->row, c->rows, nd->table, r);
+        return;
+    case TRITFILTER_NOT:
+        eval_node(f, nd->a, depth, c);
+        for (w = 0; w < c->words; w++) r[w] = bool3x64_not(r[w]);
+        return;
+    case TRITFILTER_AND:
+        eval_node(f, nd->a, depth, c);
+        if (all_false(r, c->words)) {
+            return;
+        }
+        eval_node(f, nd->b, depth + 1, c);
+        for (w = 0; w < c->words; w++) r[w] = bool3x64_and(r[w], c->slot[depth + 1][w]);
+        return;
+    default:   // TRITFILTER_OR
+        eval_node(f, nd->a, depth, c);
+        if (all_true(r, c->words)) {
+            return;
+        }
+        eval_node(f, nd->b, depth + 1, c);
+        for (w = 0; w < c->words; w++) r[w] = bool3x64_or(r[w], c->slot[depth + 1][w]);
+        return;
+    }
+}
+
+// eval_chunk evaluates rows [row, min(row + TRITFILTER_CHUNK, n)) and
+// returns the root planes (rows past n: any value - mask at output).
+static const bool3x64_t *eval_chunk(const tritfilter_t *f, chunk_t *c, size_t row, size_t n) {
+    c->row = row;
+    c->rows = n - row < TRITFILTER_CHUNK ? n - row : TRITFILTER_CHUNK;
+    c->words = (c->rows + 63) / 64;
+    if (f->count == 0) {
+        for (size_t w = 0; w < c->words; w++) {
+            c->slot[0][w].pos = ~0ULL;
+            c->slot[0][w].neg = 0;
+        }
+    } else {
+        eval_node(f, f->count - 1, 0, c);
+    }
+    return c->slot[0];
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Building
+// ────────────────────────────────────────────────────────────────
+
+void tritfilter_init(tritfilter_t *f) {
+    memset(f, 0, sizeof(*f));
+}
+
+// add_node appends a node and returns its index, or -1 if full.
+static int add_node(tritfilter_t *f, tritfilter_kind_t kind, uint8_t table, size_t a, size_t b) {
+    if (f->count >= TRITFILTER_MAX_NODES) {
+        return -1;
+    }
+    tritfilter_node_t *nd = &f->node[f->count];
+    nd->kind = (uint8_t)kind;
+    nd->table = table;
+    nd->a = (uint16_t)a;
+    nd->b = (uint16_t)b;
+    return (int)f->count++;
+}
+
+static int is_node(const tritfilter_t *f, int i) {
+    return i >= 0 && (size_t)i < f->count;
+}
+
+int tritfilter_column(tritfilter_t *f, size_t column, uint8_t table) {
+    if (column > UINT16_MAX || table >= TRIT_OP1_STATES) {
+        return -1;
+    }
+    return add_node(f, TRITFILTER_COLUMN, table, column, 0);
+}
+
+int tritfilter_not(tritfilter_t *f, int a) {
+    if (!is_node(f, a)) {
+        return -1;
+    }
+    return add_node(f, TRITFILTER_NOT, 0, (size_t)a, 0);
+}
+
+int tritfilter_and(tritfilter_t *f, int a, int b) {
+    if (!is_node(f, a) || !is_node(f, b)) {
+        return -1;
+    }
+    return add_node(f, TRITFILTER_AND, 0, (size_t)a, (size_t)b);
+}
+
+int tritfilter_or(tritfilter_t *f, int a, int b) {
+    if (!is_node(f, a) || !is_node(f, b)) {
+        return -1;
+    }
+    return add_node(f, TRITFILTER_OR, 0, (size_t)a, (size_t)b);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Evaluation
+// ────────────────────────────────────────────────────────────────
+
+// tritfilter_bitmap sets is_true / is_unknown bits per row.
+//
+// Parameters:
+//   f          - filter
+//   columns    - columns[c] holds n valid values for every referenced c
+//   n          - row count
+//   is_true    - TRITFILTER_BITMAP_WORDS(n) words, or NULL
+//   is_unknown - TRITFILTER_BITMAP_WORDS(n) words, or NULL
+void tritfilter_bitmap(const tritfilter_t *f, const trit_t *const *columns, size_t n,
+                       uint64_t *is_true, uint64_t *is_unknown) {
+    chunk_t c;
+    c.columns = columns;
+    for (size_t row = 0; row < n; row += TRITFILTER_CHUNK) {
+        const bool3x64_t *r = eval_chunk(f, &c, row, n);
+        size_t base = row / 64;
+        for (size_t w = 0; w < c.words; w++) {
+            uint64_t valid = valid_mask(c.rows - 64 * w);
+            if (is_true) is_true[base + w] = r[w].pos & valid;
+            if (is_unknown) is_unknown[base + w] = ~(r[w].pos | r[w].neg) & valid;
+        }
+    }
+}
+
+// tritfilter_select lists true and unknown row indices.
+//
+// Parameters:
+//   f           - filter
+//   columns     - columns[c] holds n valid values for every referenced c
+//   n           - row count (≤ UINT32_MAX)
+//   sel_true    - room for n indices, or NULL to count only
+//   sel_unknown - room for n indices, or NULL to count only
+//   n_unknown   - receives the unknown count, or NULL
+//
+// Returns:
+//   number of true rows
+size_t tritfilter_select(const tritfilter_t *f, const trit_t *const *columns, size_t n,
+                         uint32_t *sel_true, uint32_t *sel_unknown, size_t *n_unknown) {
+    chunk_t c;
+    size_t nt = 0, nu = 0;
+    c.columns = columns;
+    for (size_t row = 0; row < n; row += TRITFILTER_CHUNK) {
+        const bool3x64_t *r = eval_chunk(f, &c, row, n);
+        for (size_t w = 0; w < c.words; w++) {
+            uint64_t valid = valid_mask(c.rows - 64 * w);
+            uint64_t t = r[w].pos & valid;
+            uint64_t u = ~(r[w].pos | r[w].neg) & valid;
+            uint32_t base = (uint32_t)(row + 64 * w);
+            if (sel_true) {
+                for (; t; t &= t - 1) sel_true[nt++] = base + ctz64(t);
+            } else {
+                nt += (size_t)popcount64(t);
+            }
+            if (sel_unknown) {
+                for (; u; u &= u - 1) sel_unknown[nu++] = base + ctz64(u);
+            } else {
+                nu += (size_t)popcount64(u);
+            }
+        }
+    }
+    if (n_unknown) {
+        *n_unknown = nu;
+    }
+    return nt;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// Builders are the only failure point and change nothing when they fail.
+// Evaluation trusts the tree (builders only link earlier nodes, so the
+// recursion ends and depth < TRITFILTER_MAX_NODES) and the columns.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-tritfilter   # random trees vs per-row bool3 evaluation,
+//                          # every backend, lengths 0-300 and chunk
+//                          # edges; all-false runs exercise the skips
+//
+// Benchmark:
+//   make bench-tritfilter  # per-row branching vs filter per backend,
+//                          # selective vs non-selective first operand
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// Nothing allocated.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ TRITFILTER_CHUNK (scratch is TRITFILTER_MAX_NODES × chunk / 4 bytes)
+//   ✅ Split kernels (tests compare every backend)
+//
+// Modify with Extreme Care:
+//   ⚠️ Slot assignment: left operand reuses the parent's slot, right
+//      takes depth + 1 - a NOT or AND must not overwrite a live slot
+//   ⚠️ Rows past n are false at the leaves and masked at output; both
+//      are needed (AND skips rely on the first, NOT breaks it)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Skips must not change results - only work
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// A chunk's slots are 512 bytes each, so a deep tree's working set stays
+// in L1. Splitting a column is one or two vector ops per 16-64 rows and
+// dominates when nothing is skipped; the tree adds 1-2 word ops per 64
+// rows per node. Selection costs one ctz per selected row.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Let both grow together until the harvest." — Matthew 13:30
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,815 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// tritindex.c - Nearest-Neighbour Search over Ternary Vectors
+// Key: B-word-work-pkg-trit-src-tritindex
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritindex.h, tritmat.h, trit.h)
+//   All scoring goes through the tritdot.c GEMM kernels; no SIMD here.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 2: BCT Parallel]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Exhaustive and coarse-list top-k search over bitsliced ternary vectors.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Seek, and ye shall find." — Matthew 7:7
+//
+// Principle: Score everything once, keep only the best, and never lose
+//            track of which answer is exact.
+//
+// # CPI-SI Identity
+//
+// Component Type: Rungs (built on the matrix layer)
+//
+// Role: Search layer over tritmat_gemm_t64b / tritmat_gemm_hamming_t64b.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Top-k by inner product or Hamming distance, exhaustive or over
+//          the nprobe best coarse lists.
+//
+// Core Design: Every score is a key where higher is better - the dot
+//   product, or minus the distance - so one heap serves both metrics.
+//   Each query keeps a k-entry min-heap of (key, id) with the worst
+//   entry at the root; a row that does not beat the root costs one
+//   compare. Ties order by id, so results never depend on scan order.
+//
+//   Scans score SCAN_ROWS stored rows against a block of up to
+//   QUERY_BLOCK queries per GEMM call, then push the scores into the
+//   heaps. The heaps live in the caller's hits array; finishing sorts
+//   each heap in place, best first.
+//
+//   Training samples up to TRAIN_SAMPLE vectors per list, runs k-means
+//   with ternary centroids (sign of the vote for DOT, the most common
+//   trit for HAMMING), then assigns every vector and regroups the planes
+//   by list with a counting sort.
+//
+// Key Features:
+//   - nprobe = 0 is exactly the exhaustive answer
+//   - List layout keeps each list's rows contiguous for the GEMM kernels
+//   - Everything allocating builds aside and installs on success
+//
+// Philosophy: The heap is small; the rows are many. Make the common
+//             case - "not better" - cost one compare.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: stdlib.h (malloc, calloc, realloc, free),
+//     string.h (memcpy)
+//   - Internal: tritindex.h, tritmat.h (tritmat_gemm_t64b,
+//     tritmat_gemm_hamming_t64b, tritmat_pack_t64b), trit.h
+//     (trit5_to_trit64b_array), thread.c (trit_threads_run)
+//
+// What Uses This:
+//   - tritindex.h consumers; bench/tritindex_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None outside each tritindex_t. Searches take a const index and
+//        allocate their own scratch - one per thread for the _mt forms.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdlib.h>      // malloc, calloc, realloc, free
+#include <string.h>      // memcpy
+
+//--- Project Headers ---
+#include "tritindex.h"   // tritindex_t, prototypes
+#include "tritmat.h"     // GEMM kernels, row sizes
+#include "trit.h"        // trit5_to_trit64b_array
+#include "thread_internal.h" // trit_threads_run, TRIT_THREADS_MAX
+
+// ────────────────────────────────────────────────────────────────
+// Constants
+// ────────────────────────────────────────────────────────────────
+
+// Queries per pass over the stored rows (tritdot.c's GEMM batch block)
+#define QUERY_BLOCK   16
+
+// Stored rows per GEMM call: 256 rows × 16 queries of int32 = 16 KB
+#define SCAN_ROWS     256
+
+// Training vectors sampled per list
+#define TRAIN_SAMPLE  64
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// GEMM-shaped scorer: tritmat_gemm_t64b or tritmat_gemm_hamming_t64b.
+typedef void (*score_fn)(const trit64b_t *w, size_t rows, size_t cols,
+                         const trit64b_t *x, size_t batch, int32_t *y);
+
+// heap_t is one query's best-so-far: hit[0..len) is a min-heap on key
+// (stored in hit.score) with the worst entry at the root.
+typedef struct {
+    tritindex_hit_t *hit;
+    size_t len;
+    size_t k;
+} heap_t;
+
+// scratch_t holds a search's working memory.
+typedef struct {
+    int32_t *scores;           // max(SCAN_ROWS, nlist) × QUERY_BLOCK
+    tritindex_hit_t *probe;    // nprobe × QUERY_BLOCK (list choice)
+    trit64b_t *query;          // QUERY_BLOCK query rows (t5b1 input only)
+} scratch_t;
+
+// search_job_t is one search call: t5b1 queries in t5, or bitsliced in
+// t64b. Part i answers query blocks [i·per, (i + 1)·per) with scratch[i].
+typedef struct {
+    const tritindex_t *idx;
+    const uint8_t *t5;
+    const trit64b_t *t64b;
+    size_t nq;
+    tritindex_metric_t metric;
+    size_t k;
+    size_t nprobe;
+    tritindex_hit_t *hits;
+    size_t per;
+    scratch_t *scratch;
+} search_job_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static void heap_push(heap_t *h, size_t id, int32_t key);
+static void heap_finish(heap_t *h, tritindex_metric_t metric);
+static void scan(const tritindex_t *idx, const trit64b_t *rows, const size_t *ids, size_t base,
+                 size_t n, const trit64b_t *q, size_t qb, tritindex_metric_t metric,
+                 heap_t *heaps, int32_t *scores);
+static void search_block(const tritindex_t *idx, const trit64b_t *q, size_t qb,
+                         tritindex_metric_t metric, size_t k, size_t nprobe,
+                         tritindex_hit_t *hits, const scratch_t *s);
+static bool scratch_alloc(scratch_t *s, const tritindex_t *idx, size_t nprobe, bool query);
+static void scratch_free(scratch_t *s);
+static void search_part(void *ctx, unsigned i);
+static bool search_mt(search_job_t *j, unsigned threads);
+static void assign(const trit64b_t *centroid, size_t nlist, size_t cols, const trit64b_t *vec,
+                   size_t n, tritindex_metric_t metric, size_t *out, int32_t *scores);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── tritindex_add_t5/add_trits() → grow() + row conversion
+//   ├── tritindex_train()            → assign() per round → centroid votes
+//   │                                  → assign() all → counting sort
+//   └── tritindex_search/_t64b/_mt() → search_mt() → scratch per part,
+//                                      trit_threads_run(search_part)
+//                                      → search_block() per 16 queries
+//                                      ├── centroid GEMM → heap_push() (lists)
+//                                      ├── scan() per list / untrained tail
+//                                      │   or scan() over everything
+//                                      └── heap_finish()
+//
+//   Helpers (Bottom Rungs)
+//   └── heap_push, heap_finish, score_for, key_of, worse
+//
+// Baton Flow:
+//   Entry → query block → GEMM scores → heaps → sorted hits
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static size_t min_size(size_t a, size_t b) {
+    return a < b ? a : b;
+}
+
+static score_fn score_for(tritindex_metric_t metric) {
+    return metric == TRITINDEX_HAMMING ? tritmat_gemm_hamming_t64b : tritmat_gemm_t64b;
+}
+
+// key_of turns a score into "higher is better".
+static int32_t key_of(int32_t score, tritindex_metric_t metric) {
+    return metric == TRITINDEX_HAMMING ? -score : score;
+}
+
+// worse reports whether a ranks below b: lower key, or equal key and
+// higher id.
+static int worse(const tritindex_hit_t *a, const tritindex_hit_t *b) {
+    return a->score < b->score || (a->score == b->score && a->id > b->id);
+}
+
+static void sift_down(tritindex_hit_t *h, size_t len, size_t i) {
+    for (;;) {
+        size_t l = 2 * i + 1, m = i;
+        if (l < len && worse(&h[l], &h[m])) m = l;
+        if (l + 1 < len && worse(&h[l + 1], &h[m])) m = l + 1;
+        if (m == i) return;
+        tritindex_hit_t t = h[i];
+        h[i] = h[m];
+        h[m] = t;
+        i = m;
+    }
+}
+
+// heap_push offers (id, key) to h, replacing the worst entry when full.
+static void heap_push(heap_t *h, size_t id, int32_t key) {
+    tritindex_hit_t c = { id, key };
+    if (h->len < h->k) {
+        size_t i = h->len++;
+        while (i > 0 && worse(&c, &h->hit[(i - 1) / 2])) {
+            h->hit[i] = h->hit[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        h->hit[i] = c;
+    } else if (worse(&h->hit[0], &c)) {
+        h->hit[0] = c;
+        sift_down(h->hit, h->len, 0);
+    }
+}
+
+// heap_finish sorts h best first, turns keys back into scores and pads
+// unused slots.
+static void heap_finish(heap_t *h, tritindex_metric_t metric) {
+    for (size_t end = h->len; end > 1; end--) {
+        tritindex_hit_t t = h->hit[0];       // worst of [0, end) to the back
+        h->hit[0] = h->hit[end - 1];
+        h->hit[end - 1] = t;
+        sift_down(h->hit, end - 1, 0);
+    }
+    for (size_t i = 0; i < h->len; i++) {
+        h->hit[i].score = key_of(h->hit[i].score, metric);
+    }
+    for (size_t i = h->len; i < h->k; i++) {
+        h->hit[i].id = TRITINDEX_NO_ID;
+        h->hit[i].score = 0;
+    }
+}
+
+// grow makes room for count + n vectors (doubling).
+static bool grow(tritindex_t *idx, size_t n) {
+    size_t need = idx->count + n;
+    if (need <= idx->cap) {
+        return true;
+    }
+    size_t cap = idx->cap ? idx->cap : 64;
+    while (cap < need) {
+        cap *= 2;
+    }
+    size_t nv = TRITMAT_ROW_VECTORS(idx->cols);
+    trit64b_t *vec = realloc(idx->vec, (cap * nv + 1) * sizeof(*vec));
+    if (!vec) {
+        return false;
+    }
+    idx->vec = vec;
+    idx->cap = cap;
+    return true;
+}
+
+// drop_lists frees the coarse layer.
+static void drop_lists(tritindex_t *idx) {
+    free(idx->centroid);
+    free(idx->list_start);
+    free(idx->list_id);
+    free(idx->list_vec);
+    idx->centroid = NULL;
+    idx->list_start = NULL;
+    idx->list_id = NULL;
+    idx->list_vec = NULL;
+    idx->nlist = 0;
+    idx->trained = 0;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Scan
+// ────────────────────────────────────────────────────────────────
+
+// scan scores n rows (ids[i], or base + i when ids is NULL) against qb
+// queries and pushes every score into the queries' heaps.
+static void scan(const tritindex_t *idx, const trit64b_t *rows, const size_t *ids, size_t base,
+                 size_t n, const trit64b_t *q, size_t qb, tritindex_metric_t metric,
+                 heap_t *heaps, int32_t *scores) {
+    size_t nv = TRITMAT_ROW_VECTORS(idx->cols);
+    score_fn score = score_for(metric);
+
+    for (size_t r0 = 0; r0 < n; r0 += SCAN_ROWS) {
+        size_t rn = min_size(SCAN_ROWS, n - r0);
+        score(rows + r0 * nv, rn, idx->cols, q, qb, scores);
+        for (size_t r = 0; r < rn; r++) {
+            size_t id = ids ? ids[r0 + r] : base + r0 + r;
+            for (size_t b = 0; b < qb; b++) {
+                heap_push(&heaps[b], id, key_of(scores[r * qb + b], metric));
+            }
+        }
+    }
+}
+
+// search_block answers qb ≤ QUERY_BLOCK queries into hits[0 .. qb·k).
+static void search_block(const tritindex_t *idx, const trit64b_t *q, size_t qb,
+                         tritindex_metric_t metric, size_t k, size_t nprobe,
+                         tritindex_hit_t *hits, const scratch_t *s) {
+    size_t nv = TRITMAT_ROW_VECTORS(idx->cols);
+    heap_t heaps[QUERY_BLOCK];
+    for (size_t b = 0; b < qb; b++) {
+        heaps[b].hit = hits + b * k;
+        heaps[b].len = 0;
+        heaps[b].k = k;
+    }
+
+    if (nprobe == 0 || idx->nlist == 0) {
+        scan(idx, idx->vec, NULL, 0, idx->count, q, qb, metric, heaps, s->scores);
+    } else {
+        // Choose every query's lists before the scans reuse the scores
+        size_t np = min_size(nprobe, idx->nlist);
+        score_for(metric)(idx->centroid, idx->nlist, idx->cols, q, qb, s->scores);
+        for (size_t b = 0; b < qb; b++) {
+            heap_t probe = { s->probe + b * np, 0, np };
+            for (size_t l = 0; l < idx->nlist; l++) {
+                heap_push(&probe, l, key_of(s->scores[l * qb + b], metric));
+            }
+        }
+        for (size_t b = 0; b < qb; b++) {
+            for (size_t p = 0; p < np; p++) {
+                size_t l = s->probe[b * np + p].id, start = idx->list_start[l];
+                scan(idx, idx->list_vec + start * nv, idx->list_id + start, 0,
+                     idx->list_start[l + 1] - start, q + b * nv, 1, metric,
+                     &heaps[b], s->scores);
+            }
+        }
+        scan(idx, idx->vec + idx->trained * nv, NULL, idx->trained,
+             idx->count - idx->trained, q, qb, metric, heaps, s->scores);
+    }
+
+    for (size_t b = 0; b < qb; b++) {
+        heap_finish(&heaps[b], metric);
+    }
+}
+
+// scratch_alloc sizes s for idx; query rows only when needed.
+static bool scratch_alloc(scratch_t *s, const tritindex_t *idx, size_t nprobe, bool query) {
+    size_t rows = idx->nlist > SCAN_ROWS ? idx->nlist : SCAN_ROWS;
+    size_t np = min_size(nprobe, idx->nlist);
+    s->scores = malloc(rows * QUERY_BLOCK * sizeof(*s->scores));
+    s->probe = malloc((np ? np : 1) * QUERY_BLOCK * sizeof(*s->probe));
+    s->query = query ? malloc((QUERY_BLOCK * TRITMAT_ROW_VECTORS(idx->cols) + 1) *
+                              sizeof(*s->query))
+                     : NULL;
+    if (!s->scores || !s->probe || (query && !s->query)) {
+        free(s->scores);
+        free(s->probe);
+        free(s->query);
+        return false;
+    }
+    return true;
+}
+
+static void scratch_free(scratch_t *s) {
+    free(s->scores);
+    free(s->probe);
+    free(s->query);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Search Drivers
+// ────────────────────────────────────────────────────────────────
+
+// search_part answers query blocks [i·per, (i + 1)·per) of the job with
+// scratch[i]; t5b1 queries are converted a block at a time.
+static void search_part(void *ctx, unsigned i) {
+    const search_job_t *j = ctx;
+    const scratch_t *s = &j->scratch[i];
+    size_t nv = TRITMAT_ROW_VECTORS(j->idx->cols);
+    size_t q0 = (size_t)i * j->per * QUERY_BLOCK;
+    size_t q1 = min_size(j->nq, q0 + j->per * QUERY_BLOCK);
+
+    for (; q0 < q1; q0 += QUERY_BLOCK) {
+        size_t qb = min_size(QUERY_BLOCK, q1 - q0);
+        const trit64b_t *q = j->t64b + q0 * nv;
+        if (j->t5 != NULL) {
+            tritmat_t5_to_t64b(j->t5 + q0 * TRITMAT_ROW_BYTES(j->idx->cols), qb,
+                               j->idx->cols, s->query);
+            q = s->query;
+        }
+        search_block(j->idx, q, qb, j->metric, j->k, j->nprobe, j->hits + q0 * j->k, s);
+    }
+}
+
+// search_mt splits the job into at most `threads` runs of whole query
+// blocks, allocates every part's scratch, then runs the parts.
+static bool search_mt(search_job_t *j, unsigned threads) {
+    scratch_t scratch[TRIT_THREADS_MAX];
+    size_t blocks = (j->nq + QUERY_BLOCK - 1) / QUERY_BLOCK;
+    size_t parts = threads > 1 ? threads : 1;
+
+    if (j->nq == 0 || j->k == 0) {
+        return true;
+    }
+    parts = min_size(min_size(parts, blocks), TRIT_THREADS_MAX);
+    j->per = (blocks + parts - 1) / parts;
+    parts = (blocks + j->per - 1) / j->per;
+    for (size_t i = 0; i < parts; i++) {
+        if (!scratch_alloc(&scratch[i], j->idx, j->nprobe, j->t5 != NULL)) {
+            while (i > 0) {
+                scratch_free(&scratch[--i]);
+            }
+            return false;
+        }
+    }
+    j->scratch = scratch;
+    trit_threads_run((unsigned)parts, search_part, j);
+    for (size_t i = 0; i < parts; i++) {
+        scratch_free(&scratch[i]);
+    }
+    return true;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Training
+// ────────────────────────────────────────────────────────────────
+
+// assign sets out[i] to the best-scoring centroid for each of n vectors
+// (ties to the lower list). scores holds nlist × QUERY_BLOCK.
+static void assign(const trit64b_t *centroid, size_t nlist, size_t cols, const trit64b_t *vec,
+                   size_t n, tritindex_metric_t metric, size_t *out, int32_t *scores) {
+    size_t nv = TRITMAT_ROW_VECTORS(cols);
+    score_fn score = score_for(metric);
+
+    for (size_t i0 = 0; i0 < n; i0 += QUERY_BLOCK) {
+        size_t qb = min_size(QUERY_BLOCK, n - i0);
+        score(centroid, nlist, cols, vec + i0 * nv, qb, scores);
+        for (size_t b = 0; b < qb; b++) {
+            size_t best = 0;
+            int32_t best_key = key_of(scores[b], metric);
+            for (size_t l = 1; l < nlist; l++) {
+                int32_t key = key_of(scores[l * qb + b], metric);
+                if (key > best_key) {
+                    best = l;
+                    best_key = key;
+                }
+            }
+            out[i0 + b] = best;
+        }
+    }
+}
+
+// update_centroids recomputes each non-empty list's centroid from its
+// members' votes: sign(pos - neg) for DOT, the most common trit for
+// HAMMING. Empty lists keep their centroid. votes holds 2·nlist·cols.
+static void update_centroids(trit64b_t *centroid, size_t nlist, size_t cols,
+                             const trit64b_t *vec, size_t n, const size_t *list,
+                             tritindex_metric_t metric, uint32_t *votes, size_t *members) {
+    size_t nv = TRITMAT_ROW_VECTORS(cols);
+    memset(votes, 0, 2 * nlist * cols * sizeof(*votes));
+    memset(members, 0, nlist * sizeof(*members));
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t *pos = votes + 2 * list[i] * cols, *neg = pos + cols;
+        members[list[i]]++;
+        for (size_t v = 0; v < nv; v++) {
+            uint64_t p = vec[i * nv + v].pos, m = vec[i * nv + v].neg;
+            size_t lanes = min_size(64, cols - v * 64);
+            for (size_t j = 0; j < lanes; j++) {
+                pos[v * 64 + j] += (uint32_t)((p >> j) & 1);
+                neg[v * 64 + j] += (uint32_t)((m >> j) & 1);
+            }
+        }
+    }
+
+    for (size_t l = 0; l < nlist; l++) {
+        if (members[l] == 0) {
+            continue;
+        }
+        const uint32_t *pos = votes + 2 * l * cols, *neg = pos + cols;
+        for (size_t v = 0; v < nv; v++) {
+            uint64_t p = 0, m = 0;
+            size_t lanes = min_size(64, cols - v * 64);
+            for (size_t j = 0; j < lanes; j++) {
+                size_t c = v * 64 + j;
+                size_t zero = members[l] - pos[c] - neg[c];
+                int up, down;
+                if (metric == TRITINDEX_HAMMING) {
+                    up = pos[c] > neg[c] && pos[c] > zero;
+                    down = neg[c] > pos[c] && neg[c] > zero;
+                } else {
+                    up = pos[c] > neg[c];
+                    down = neg[c] > pos[c];
+                }
+                p |= (uint64_t)up << j;
+                m |= (uint64_t)down << j;
+            }
+            centroid[l * nv + v].pos = p;
+            centroid[l * nv + v].neg = m;
+        }
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+//--- Lifetime ---
+
+// tritindex_init sets idx to an empty index of cols-trit vectors.
+void tritindex_init(tritindex_t *idx, size_t cols) {
+    idx->cols = cols;
+    idx->count = 0;
+    idx->cap = 0;
+    idx->vec = NULL;
+    idx->nlist = 0;
+    idx->trained = 0;
+    idx->centroid = NULL;
+    idx->list_start = NULL;
+    idx->list_id = NULL;
+    idx->list_vec = NULL;
+}
+
+// tritindex_free releases idx's storage and leaves it empty.
+void tritindex_free(tritindex_t *idx) {
+    drop_lists(idx);
+    free(idx->vec);
+    tritindex_init(idx, idx->cols);
+}
+
+//--- Adding ---
+
+// tritindex_add_t5 appends n t5b1 rows; they get ids count .. count + n - 1.
+bool tritindex_add_t5(tritindex_t *idx, const uint8_t *rows, size_t n) {
+    if (!grow(idx, n)) {
+        return false;
+    }
+    tritmat_t5_to_t64b(rows, n, idx->cols, idx->vec + idx->count * TRITMAT_ROW_VECTORS(idx->cols));
+    idx->count += n;
+    return true;
+}
+
+// tritindex_add_trits appends n row-major trit vectors.
+bool tritindex_add_trits(tritindex_t *idx, const trit_t *trits, size_t n) {
+    if (!grow(idx, n)) {
+        return false;
+    }
+    tritmat_pack_t64b(trits, n, idx->cols, idx->vec + idx->count * TRITMAT_ROW_VECTORS(idx->cols));
+    idx->count += n;
+    return true;
+}
+
+//--- Coarse Lists ---
+
+// tritindex_train builds min(nlist, count) coarse lists over the vectors
+// stored now.
+//
+// Centroids start at evenly spaced vectors and are refined for iters
+// rounds on a sample of up to TRAIN_SAMPLE vectors per list, then every
+// vector is assigned to its best centroid under metric.
+//
+// Returns: false on allocation failure (existing lists kept)
+bool tritindex_train(tritindex_t *idx, size_t nlist, size_t iters, tritindex_metric_t metric) {
+    size_t n = idx->count, cols = idx->cols, nv = TRITMAT_ROW_VECTORS(cols);
+    if (nlist > n) {
+        nlist = n;
+    }
+    if (nlist == 0) {
+        drop_lists(idx);
+        return true;
+    }
+    if (iters == 0) {
+        iters = TRITINDEX_TRAIN_ITERS;
+    }
+
+    size_t ns = nlist <= n / TRAIN_SAMPLE ? nlist * TRAIN_SAMPLE : n;
+    size_t stride = n / ns;
+    trit64b_t *centroid = malloc((nlist * nv + 1) * sizeof(*centroid));
+    trit64b_t *sample = malloc((ns * nv + 1) * sizeof(*sample));
+    size_t *list = malloc(n * sizeof(*list));
+    uint32_t *votes = malloc((2 * nlist * cols + 1) * sizeof(*votes));
+    size_t *members = malloc(nlist * sizeof(*members));
+    int32_t *scores = malloc(nlist * QUERY_BLOCK * sizeof(*scores));
+    size_t *list_start = calloc(nlist + 1, sizeof(*list_start));
+    size_t *list_id = malloc(n * sizeof(*list_id));
+    trit64b_t *list_vec = malloc((n * nv + 1) * sizeof(*list_vec));
+    bool ok = centroid && sample && list && votes && members && scores &&
+              list_start && list_id && list_vec;
+
+    if (ok) {
+        for (size_t i = 0; i < ns; i++) {
+            memcpy(sample + i * nv, idx->vec + i * stride * nv, nv * sizeof(*sample));
+        }
+        for (size_t l = 0; l < nlist; l++) {
+            memcpy(centroid + l * nv, sample + (l * ns / nlist) * nv, nv * sizeof(*centroid));
+        }
+        for (size_t it = 0; it < iters; it++) {
+            assign(centroid, nlist, cols, sample, ns, metric, list, scores);
+            update_centroids(centroid, nlist, cols, sample, ns, list, metric, votes, members);
+        }
+
+        // Final assignment, then a counting sort into list order
+        assign(centroid, nlist, cols, idx->vec, n, metric, list, scores);
+        for (size_t i = 0; i < n; i++) {
+            list_start[list[i] + 1]++;
+        }
+        for (size_t l = 0; l < nlist; l++) {
+            list_start[l + 1] += list_start[l];
+            members[l] = list_start[l];          // reused as fill cursors
+        }
+        for (size_t i = 0; i < n; i++) {
+            size_t at = members[list[i]]++;
+            list_id[at] = i;
+            memcpy(list_vec + at * nv, idx->vec + i * nv, nv * sizeof(*list_vec));
+        }
+
+        drop_lists(idx);
+        idx->nlist = nlist;
+        idx->trained = n;
+        idx->centroid = centroid;
+        idx->list_start = list_start;
+        idx->list_id = list_id;
+        idx->list_vec = list_vec;
+    } else {
+        free(centroid);
+        free(list_start);
+        free(list_id);
+        free(list_vec);
+    }
+    free(sample);
+    free(list);
+    free(votes);
+    free(members);
+    free(scores);
+    return ok;
+}
+
+//--- Search ---
+
+// tritindex_search answers nq t5b1 queries, QUERY_BLOCK at a time.
+//
+// Parameters:
+//   idx     - index to search (read only)
+//   queries - nq·TRITMAT_ROW_BYTES(cols) bytes
+//   nq      - query count
+//   metric  - TRITINDEX_DOT or TRITINDEX_HAMMING
+//   k       - results per query
+//   nprobe  - lists to scan per query (0: exhaustive)
+//   hits    - nq·k results, best first per query
+//
+// Returns: false on allocation failure (hits unchanged)
+bool tritindex_search(const tritindex_t *idx, const uint8_t *queries, size_t nq,
+                      tritindex_metric_t metric, size_t k, size_t nprobe,
+                      tritindex_hit_t *hits) {
+    search_job_t j = { idx, queries, NULL, nq, metric, k, nprobe, hits, 0, NULL };
+    return search_mt(&j, 1);
+}
+
+// tritindex_search_t64b is tritindex_search with bitsliced queries of
+// TRITMAT_ROW_VECTORS(cols) vectors each.
+bool tritindex_search_t64b(const tritindex_t *idx, const trit64b_t *queries, size_t nq,
+                           tritindex_metric_t metric, size_t k, size_t nprobe,
+                           tritindex_hit_t *hits) {
+    search_job_t j = { idx, NULL, queries, nq, metric, k, nprobe, hits, 0, NULL };
+    return search_mt(&j, 1);
+}
+
+// tritindex_search_mt is tritindex_search with the queries split across
+// up to `threads` threads (the caller's included), whole query blocks
+// per thread. Each thread gets its own scratch, allocated before any
+// thread starts, so hits are unchanged on failure as before. Results
+// equal tritindex_search. threads 0 or 1 runs on the caller alone.
+bool tritindex_search_mt(const tritindex_t *idx, const uint8_t *queries, size_t nq,
+                         tritindex_metric_t metric, size_t k, size_t nprobe,
+                         tritindex_hit_t *hits, unsigned threads) {
+    search_job_t j = { idx, queries, NULL, nq, metric, k, nprobe, hits, 0, NULL };
+    return search_mt(&j, threads);
+}
+
+// tritindex_search_t64b_mt is tritindex_search_mt with bitsliced queries.
+bool tritindex_search_t64b_mt(const tritindex_t *idx, const trit64b_t *queries, size_t nq,
+                              tritindex_metric_t metric, size_t k, size_t nprobe,
+                              tritindex_hit_t *hits, unsigned threads) {
+    search_job_t j = { idx, NULL, queries, nq, metric, k, nprobe, hits, 0, NULL };
+    return search_mt(&j, threads);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// Allocation failure returns false before anything visible changes:
+// adds grow first, training builds new lists aside, searches allocate
+// scratch before writing hits. Scores past int32 cannot occur (|score|
+// ≤ cols).
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-tritindex   # exhaustive vs a full sort, both metrics, every
+//                         # backend; lists with nprobe = nlist are exact;
+//                         # query slices and _mt at 1-100 threads
+//                         # equal one call
+//
+// Benchmark:
+//   make bench-tritindex  # 1M × 256 trits: exhaustive per backend,
+//                         # batched, recall/time by nprobe, and
+//                         # _mt scaling at 1-8 threads
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// tritindex_free releases rows and lists. Search scratch is freed
+// before returning.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ QUERY_BLOCK, SCAN_ROWS, TRAIN_SAMPLE (re-run make bench-tritindex)
+//   ✅ Centroid initialization (results must stay deterministic)
+//
+// Modify with Extreme Care:
+//   ⚠️ worse(): the tie order is what makes list search with
+//      nprobe = nlist equal the exhaustive result
+//   ⚠️ Keys are scores negated for HAMMING - heap_finish undoes it
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ nprobe = 0 must be exhaustive
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Exhaustive search is GEMM-bound: each stored row is read once per 16
+// queries. Once a heap is full, a row that does not beat the root costs
+// one compare, so k has little effect until it approaches the row count.
+// List search scans each query's lists on their own (batch 1), so its
+// gain is the nlist/nprobe reduction in rows, not query batching.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Seek, and ye shall find." — Matthew 7:7
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,852 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// tritmat.c - Ternary-Weight Matrix Products
+// Key: B-word-work-pkg-trit-src-tritmat
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritmat.h, trit.h)
+//   Without TRIT_X86_SIMD (simd_internal.h) dot products are the scalar
+//   sign-select loops.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 1: t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// GEMV/GEMM over t5b1 weight rows - decode a block, then add, subtract or
+// skip each activation.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Let your communication be, Yea, yea; Nay, nay: for whatsoever
+//            is more than these cometh of evil." — Matthew 5:37
+//
+// Principle: A weight that can only say yes, no or nothing needs no
+//            multiplier.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Matrix layer over packed trit5 storage.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: y = W·x for ternary W kept in t5b1 form, with int8, int16 or
+//          float activations.
+//
+// Core Design: Three nested blocks, outermost first:
+//
+//   batch block   up to TRITMAT_BATCH_BLOCK activation vectors
+//   row block     TRITMAT_ROW_BLOCK rows
+//   column block  TRITMAT_COL_BLOCK columns (a multiple of 5, so every
+//                 block starts on a byte boundary inside a row), decoded
+//                 into a stack buffer with trit5_unpack_array (active
+//                 backend)
+//
+//   Each decoded block is dotted against every vector of the batch
+//   block, and partial sums accumulate in a row block × batch block
+//   tile (int64 for integer activations), stored to y once the row
+//   block's columns are done. Integer results saturate to int32.
+//
+//   The _mt drivers cut the rows into one slice per thread (whole row
+//   blocks) and run the same driver on each through thread.c.
+//
+//   The dot kernels never multiply by a weight. Scalar code masks and
+//   conditionally negates; SSE4.1/AVX2 use psign on widened lanes (so
+//   -128 and -32768 negate exactly); AVX-512 uses masked add and masked
+//   subtract. Float kernels flip the sign bit and clear zero lanes.
+//
+// Key Features:
+//   - Dispatches on trit_backend_active(), like the decode kernels
+//   - No allocation; ~14 KB of stack per call (per thread for _mt)
+//   - Identical int32 results on every backend and thread count
+//
+// Philosophy: Decode once, use many times.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: string.h (memset, memcpy)
+//   - Internal: tritmat.h, trit.h (trit5_unpack_array, backend enum),
+//     simd.c (trit_backend_active), thread.c (trit_threads_run)
+//   - Compiler: immintrin.h + target attributes (GCC/Clang, x86 only)
+//
+// What Uses This:
+//   - Ternary-weight model layers; bench/tritmat_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None. The backend choice lives in simd.c and is read once per
+//   call, on the calling thread. The _mt drivers start and join their
+//   own threads.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <string.h>     // memset, memcpy
+
+//--- Project Headers ---
+#include "tritmat.h"    // prototypes, TRITMAT_ROW_BYTES
+#include "trit.h"       // trit5_unpack_array, backend dispatch
+#include "simd_internal.h" // TRIT_X86_SIMD, intrinsics
+#include "thread_internal.h" // trit_threads_run
+
+// ────────────────────────────────────────────────────────────────
+// Constants
+// ────────────────────────────────────────────────────────────────
+
+// Block sizes (from make bench-tritmat). ROW_BLOCK × COL_BLOCK decoded
+// trits = 10 KB, which leaves room in a 32 KB L1 for activations.
+#define TRITMAT_ROW_BLOCK    8
+#define TRITMAT_COL_BLOCK    1280     // multiple of 5 (byte-aligned blocks)
+#define TRITMAT_BATCH_BLOCK  64
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// Dot kernels: Σ w[i]·x[i] over n decoded trits.
+typedef int32_t (*dot_i8_fn)(const trit_t *w, const int8_t *x, size_t n);
+typedef int32_t (*dot_i16_fn)(const trit_t *w, const int16_t *x, size_t n);
+typedef float (*dot_f32_fn)(const trit_t *w, const float *x, size_t n);
+
+// gemm_job_t is one GEMM split into row slices of `step` rows (a
+// multiple of TRITMAT_ROW_BLOCK). Exactly one dot is set, chosen on the
+// calling thread.
+typedef struct {
+    const uint8_t *w;
+    size_t rows, cols, batch, step;
+    const void *x;
+    void *y;
+    dot_i8_fn dot_i8;
+    dot_i16_fn dot_i16;
+    dot_f32_fn dot_f32;
+} gemm_job_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static int32_t dot_i8_scalar(const trit_t *w, const int8_t *x, size_t n);
+static int32_t dot_i16_scalar(const trit_t *w, const int16_t *x, size_t n);
+static float dot_f32_scalar(const trit_t *w, const float *x, size_t n);
+
+#if TRIT_X86_SIMD
+static int32_t dot_i8_sse41(const trit_t *w, const int8_t *x, size_t n);
+static int32_t dot_i16_sse41(const trit_t *w, const int16_t *x, size_t n);
+static float dot_f32_sse41(const trit_t *w, const float *x, size_t n);
+static int32_t dot_i8_avx2(const trit_t *w, const int8_t *x, size_t n);
+static int32_t dot_i16_avx2(const trit_t *w, const int16_t *x, size_t n);
+static float dot_f32_avx2(const trit_t *w, const float *x, size_t n);
+static int32_t dot_i8_avx512(const trit_t *w, const int8_t *x, size_t n);
+static int32_t dot_i16_avx512(const trit_t *w, const int16_t *x, size_t n);
+static float dot_f32_avx512(const trit_t *w, const float *x, size_t n);
+#endif
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── tritmat_pack()                 → trit5_pack_array per row
+//   ├── tritmat_gemv_{i8,i16,f32}()    → tritmat_gemm_* with batch = 1
+//   ├── tritmat_gemm_{i8,i16,f32}()    → gemm_*(select_dot_*())
+//   └── tritmat_gem{m,v}_{i8,i16,f32}_mt() → gemm_mt() → trit_threads_run(gemm_part)
+//
+//   Drivers (Middle Rungs)
+//   ├── gemm_{i8,i16,f32}()   → block loops, decode_block()
+//   └── gemm_mt(), gemm_part() → gemm_* per row slice
+//
+//   Kernels (Bottom Rungs): dot_{i8,i16,f32}_{avx512, avx2, sse41, scalar}
+//
+// Baton Flow:
+//   Entry → select_dot → batch/row/column blocks → decode_block →
+//   dot per (row, vector) → tile += partial → y = saturate(tile)
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+// decode_block unpacks kc columns from c0 of rows [r0, r0 + mr) into
+// buf, one row per TRITMAT_COL_BLOCK trits.
+static void decode_block(const uint8_t *w, size_t row_bytes, size_t r0, size_t mr,
+                         size_t c0, size_t kc, trit_t *buf) {
+    for (size_t r = 0; r < mr; r++) {
+        trit5_unpack_array(w + (r0 + r) * row_bytes + c0 / 5, kc,
+                           buf + r * TRITMAT_COL_BLOCK);
+    }
+}
+
+static size_t min_size(size_t a, size_t b) {
+    return a < b ? a : b;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Scalar Kernels (portable reference, vector tails)
+// ────────────────────────────────────────────────────────────────
+
+// Integer sign-select: neg is all ones for -1, nz all ones for ±1, so
+// ((v ^ neg) - neg) & nz is v, -v or 0 without a multiply or branch.
+static int32_t dot_i8_scalar(const trit_t *w, const int8_t *x, size_t n) {
+    int32_t acc = 0;
+    for (size_t i = 0; i < n; i++) {
+        int32_t neg = -(int32_t)(w[i] < 0);
+        int32_t nz = -(int32_t)(w[i] != 0);
+        acc += (((int32_t)x[i] ^ neg) - neg) & nz;
+    }
+    return acc;
+}
+
+static int32_t dot_i16_scalar(const trit_t *w, const int16_t *x, size_t n) {
+    int32_t acc = 0;
+    for (size_t i = 0; i < n; i++) {
+        int32_t neg = -(int32_t)(w[i] < 0);
+        int32_t nz = -(int32_t)(w[i] != 0);
+        acc += (((int32_t)x[i] ^ neg) - neg) & nz;
+    }
+    return acc;
+}
+
+// Float sign-select on the bit pattern: xor in the sign bit where w = -1,
+// clear the word where w = 0.
+static float dot_f32_scalar(const trit_t *w, const float *x, size_t n) {
+    float acc = 0.0f;
+    for (size_t i = 0; i < n; i++) {
+        uint32_t bits;
+        float v;
+        memcpy(&bits, x + i, sizeof(bits));
+        bits ^= (uint32_t)(w[i] < 0) << 31;
+        bits &= -(uint32_t)(w[i] != 0);
+        memcpy(&v, &bits, sizeof(v));
+        acc += v;
+    }
+    return acc;
+}
+
+#if TRIT_X86_SIMD
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - SSE4.1 Kernels
+// ────────────────────────────────────────────────────────────────
+
+__attribute__((target("sse4.1")))
+static int32_t hsum_epi32_sse41(__m128i v) {
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0x4E));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0xB1));
+    return _mm_cvtsi128_si32(v);
+}
+
+__attribute__((target("sse4.1")))
+static float hsum_ps_sse41(__m128 v) {
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 0x55));
+    return _mm_cvtss_f32(v);
+}
+
+// 16 activations per step: widen to int16, psignw by the weights, then
+// pmaddwd by 1 to add adjacent pairs into int32.
+__attribute__((target("sse4.1")))
+static int32_t dot_i8_sse41(const trit_t *w, const int8_t *x, size_t n) {
+    const __m128i ones = _mm_set1_epi16(1);
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i vx = _mm_loadu_si128((const __m128i *)(const void *)(x + i));
+        __m128i vw = _mm_loadu_si128((const __m128i *)(const void *)(w + i));
+        __m128i lo = _mm_sign_epi16(_mm_cvtepi8_epi16(vx), _mm_cvtepi8_epi16(vw));
+        __m128i hi = _mm_sign_epi16(_mm_cvtepi8_epi16(_mm_srli_si128(vx, 8)),
+                                    _mm_cvtepi8_epi16(_mm_srli_si128(vw, 8)));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(lo, ones));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(hi, ones));
+    }
+    return hsum_epi32_sse41(acc) + dot_i8_scalar(w + i, x + i, n - i);
+}
+
+// 4 activations per step, widened to int32 before psignd.
+__attribute__((target("sse4.1")))
+static int32_t dot_i16_sse41(const trit_t *w, const int16_t *x, size_t n) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int32_t w4;
+        memcpy(&w4, w + i, 4);
+        __m128i vx = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)(const void *)(x + i)));
+        __m128i vw = _mm_cvtepi8_epi32(_mm_cvtsi32_si128(w4));
+        acc = _mm_add_epi32(acc, _mm_sign_epi32(vx, vw));
+    }
+    return hsum_epi32_sse41(acc) + dot_i16_scalar(w + i, x + i, n - i);
+}
+
+// 4 activations per step: xor the sign bit in where w = -1, clear the
+// lanes where w = 0.
+__attribute__((target("sse4.1")))
+static float dot_f32_sse41(const trit_t *w, const float *x, size_t n) {
+    const __m128i sign = _mm_set1_epi32(INT32_MIN);
+    const __m128i zero = _mm_setzero_si128();
+    __m128 acc = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int32_t w4;
+        memcpy(&w4, w + i, 4);
+        __m128i vw = _mm_cvtepi8_epi32(_mm_cvtsi32_si128(w4));
+        __m128 neg = _mm_castsi128_ps(_mm_and_si128(vw, sign));
+        __m128 zmask = _mm_castsi128_ps(_mm_cmpeq_epi32(vw, zero));
+        __m128 vx = _mm_xor_ps(_mm_loadu_ps(x + i), neg);
+        acc = _mm_add_ps(acc, _mm_andnot_ps(zmask, vx));
+    }
+    return hsum_ps_sse41(acc) + dot_f32_scalar(w + i, x + i, n - i);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - AVX2 Kernels
+// ────────────────────────────────────────────────────────────────
+
+__attribute__((target("avx2")))
+static int32_t hsum_epi32_avx2(__m256i v) {
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+    return _mm_cvtsi128_si32(s);
+}
+
+__attribute__((target("avx2")))
+static float hsum_ps_avx2(__m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+    return _mm_cvtss_f32(s);
+}
+
+// 32 activations per step, as dot_i8_sse41 with 16-lane int16 vectors.
+__attribute__((target("avx2")))
+static int32_t dot_i8_avx2(const trit_t *w, const int8_t *x, size_t n) {
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m128i x0 = _mm_loadu_si128((const __m128i *)(const void *)(x + i));
+        __m128i x1 = _mm_loadu_si128((const __m128i *)(const void *)(x + i + 16));
+        __m128i w0 = _mm_loadu_si128((const __m128i *)(const void *)(w + i));
+        __m128i w1 = _mm_loadu_si128((const __m128i *)(const void *)(w + i + 16));
+        __m256i s0 = _mm256_sign_epi16(_mm256_cvtepi8_epi16(x0), _mm256_cvtepi8_epi16(w0));
+        __m256i s1 = _mm256_sign_epi16(_mm256_cvtepi8_epi16(x1), _mm256_cvtepi8_epi16(w1));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(s0, ones));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(s1, ones));
+    }
+    return hsum_epi32_avx2(acc) + dot_i8_scalar(w + i, x + i, n - i);
+}
+
+// 16 activations per step, widened to int32 before psignd.
+__attribute__((target("avx2")))
+static int32_t dot_i16_avx2(const trit_t *w, const int16_t *x, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i vw = _mm_loadu_si128((const __m128i *)(const void *)(w + i));
+        __m256i x0 = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(const void *)(x + i)));
+        __m256i x1 = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(const void *)(x + i + 8)));
+        __m256i w0 = _mm256_cvtepi8_epi32(vw);
+        __m256i w1 = _mm256_cvtepi8_epi32(_mm_srli_si128(vw, 8));
+        acc = _mm256_add_epi32(acc, _mm256_sign_epi32(x0, w0));
+        acc = _mm256_add_epi32(acc, _mm256_sign_epi32(x1, w1));
+    }
+    return hsum_epi32_avx2(acc) + dot_i16_scalar(w + i, x + i, n - i);
+}
+
+// 16 activations per step in two independent accumulators.
+__attribute__((target("avx2")))
+static float dot_f32_avx2(const trit_t *w, const float *x, size_t n) {
+    const __m256i sign = _mm256_set1_epi32(INT32_MIN);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i vw = _mm_loadu_si128((const __m128i *)(const void *)(w + i));
+        __m256i w0 = _mm256_cvtepi8_epi32(vw);
+        __m256i w1 = _mm256_cvtepi8_epi32(_mm_srli_si128(vw, 8));
+        __m256 x0 = _mm256_xor_ps(_mm256_loadu_ps(x + i),
+                                  _mm256_castsi256_ps(_mm256_and_si256(w0, sign)));
+        __m256 x1 = _mm256_xor_ps(_mm256_loadu_ps(x + i + 8),
+                                  _mm256_castsi256_ps(_mm256_and_si256(w1, sign)));
+        acc0 = _mm256_add_ps(acc0, _mm256_andnot_ps(
+                   _mm256_castsi256_ps(_mm256_cmpeq_epi32(w0, zero)), x0));
+        acc1 = _mm256_add_ps(acc1, _mm256_andnot_ps(
+                   _mm256_castsi256_ps(_mm256_cmpeq_epi32(w1, zero)), x1));
+    }
+    return hsum_ps_avx2(_mm256_add_ps(acc0, acc1)) + dot_f32_scalar(w + i, x + i, n - i);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - AVX-512BW Kernels
+// ────────────────────────────────────────────────────────────────
+
+// 32 activations per step. AVX-512 has no psign: negate under the sign
+// mask, then zero the lanes whose weight is 0.
+__attribute__((target("avx512f,avx512bw")))
+static int32_t dot_i8_avx512(const trit_t *w, const int8_t *x, size_t n) {
+    const __m512i ones = _mm512_set1_epi16(1);
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m512i vx = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(const void *)(x + i)));
+        __m512i vw = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(const void *)(w + i)));
+        __mmask32 neg = _mm512_movepi16_mask(vw);
+        __mmask32 nz = _mm512_test_epi16_mask(vw, vw);
+        __m512i s = _mm512_maskz_mov_epi16(nz, _mm512_mask_sub_epi16(vx, neg, zero, vx));
+        acc = _mm512_add_epi32(acc, _mm512_madd_epi16(s, ones));
+    }
+    return _mm512_reduce_add_epi32(acc) + dot_i8_scalar(w + i, x + i, n - i);
+}
+
+// 16 activations per step: masked add where w = +1, masked subtract where
+// w = -1.
+__attribute__((target("avx512f,avx512bw")))
+static int32_t dot_i16_avx512(const trit_t *w, const int16_t *x, size_t n) {
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i vx = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *)(const void *)(x + i)));
+        __m512i vw = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i *)(const void *)(w + i)));
+        __mmask16 pos = _mm512_cmpgt_epi32_mask(vw, zero);
+        __mmask16 neg = _mm512_cmplt_epi32_mask(vw, zero);
+        acc = _mm512_mask_add_epi32(acc, pos, acc, vx);
+        acc = _mm512_mask_sub_epi32(acc, neg, acc, vx);
+    }
+    return _mm512_reduce_add_epi32(acc) + dot_i16_scalar(w + i, x + i, n - i);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static float dot_f32_avx512(const trit_t *w, const float *x, size_t n) {
+    const __m512i zero = _mm512_setzero_si512();
+    __m512 acc = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 vx = _mm512_loadu_ps(x + i);
+        __m512i vw = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i *)(const void *)(w + i)));
+        __mmask16 pos = _mm512_cmpgt_epi32_mask(vw, zero);
+        __mmask16 neg = _mm512_cmplt_epi32_mask(vw, zero);
+        acc = _mm512_mask_add_ps(acc, pos, acc, vx);
+        acc = _mm512_mask_sub_ps(acc, neg, acc, vx);
+    }
+    return _mm512_reduce_add_ps(acc) + dot_f32_scalar(w + i, x + i, n - i);
+}
+
+#endif // TRIT_X86_SIMD
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Kernel Selection
+// ────────────────────────────────────────────────────────────────
+
+static dot_i8_fn select_dot_i8(void) {
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: return dot_i8_avx512;
+    case TRIT_BACKEND_AVX2:   return dot_i8_avx2;
+    case TRIT_BACKEND_SSE41:  return dot_i8_sse41;
+#endif
+    default:                  return dot_i8_scalar;
+    }
+}
+
+static dot_i16_fn select_dot_i16(void) {
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: return dot_i16_avx512;
+    case TRIT_BACKEND_AVX2:   return dot_i16_avx2;
+    case TRIT_BACKEND_SSE41:  return dot_i16_sse41;
+#endif
+    default:                  return dot_i16_scalar;
+    }
+}
+
+static dot_f32_fn select_dot_f32(void) {
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: return dot_f32_avx512;
+    case TRIT_BACKEND_AVX2:   return dot_f32_avx2;
+    case TRIT_BACKEND_SSE41:  return dot_f32_sse41;
+#endif
+    default:                  return dot_f32_scalar;
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Blocked Drivers
+// ────────────────────────────────────────────────────────────────
+
+// The three drivers differ only in element types. Loop order: batch
+// block, row block, column block (decode), vector, row. Each (row,
+// vector) sum builds up in a stack tile over the column blocks - int64
+// for the integer drivers, so no cols can overflow it - and is stored
+// once. A kernel call covers at most TRITMAT_COL_BLOCK columns, which
+// int32 always holds (1280 · 32768 < 2^26).
+
+static int32_t saturate_i32(int64_t v) {
+    return v > INT32_MAX ? INT32_MAX : v < INT32_MIN ? INT32_MIN : (int32_t)v;
+}
+
+static void gemm_i8(const uint8_t *w, size_t rows, size_t cols,
+                    const int8_t *x, size_t batch, int32_t *y, dot_i8_fn dot) {
+    trit_t buf[TRITMAT_ROW_BLOCK * TRITMAT_COL_BLOCK];
+    int64_t acc[TRITMAT_ROW_BLOCK][TRITMAT_BATCH_BLOCK];
+    size_t row_bytes = TRITMAT_ROW_BYTES(cols);
+
+    for (size_t b0 = 0; b0 < batch; b0 += TRITMAT_BATCH_BLOCK) {
+        size_t nb = min_size(TRITMAT_BATCH_BLOCK, batch - b0);
+        for (size_t r0 = 0; r0 < rows; r0 += TRITMAT_ROW_BLOCK) {
+            size_t mr = min_size(TRITMAT_ROW_BLOCK, rows - r0);
+            memset(acc, 0, sizeof(acc));
+            for (size_t c0 = 0; c0 < cols; c0 += TRITMAT_COL_BLOCK) {
+                size_t kc = min_size(TRITMAT_COL_BLOCK, cols - c0);
+                decode_block(w, row_bytes, r0, mr, c0, kc, buf);
+                for (size_t b = 0; b < nb; b++) {
+                    const int8_t *xb = x + (b0 + b) * cols + c0;
+                    for (size_t r = 0; r < mr; r++) {
+                        acc[r][b] += dot(buf + r * TRITMAT_COL_BLOCK, xb, kc);
+                    }
+                }
+            }
+            for (size_t r = 0; r < mr; r++) {
+                for (size_t b = 0; b < nb; b++) {
+                    y[(r0 + r) * batch + b0 + b] = saturate_i32(acc[r][b]);
+                }
+            }
+        }
+    }
+}
+
+static void gemm_i16(const uint8_t *w, size_t rows, size_t cols,
+                     const int16_t *x, size_t batch, int32_t *y, dot_i16_fn dot) {
+    trit_t buf[TRITMAT_ROW_BLOCK * TRITMAT_COL_BLOCK];
+    int64_t acc[TRITMAT_ROW_BLOCK][TRITMAT_BATCH_BLOCK];
+    size_t row_bytes = TRITMAT_ROW_BYTES(cols);
+
+    for (size_t b0 = 0; b0 < batch; b0 += TRITMAT_BATCH_BLOCK) {
+        size_t nb = min_size(TRITMAT_BATCH_BLOCK, batch - b0);
+        for (size_t r0 = 0; r0 < rows; r0 += TRITMAT_ROW_BLOCK) {
+            size_t mr = min_size(TRITMAT_ROW_BLOCK, rows - r0);
+            memset(acc, 0, sizeof(acc));
+            for (size_t c0 = 0; c0 < cols; c0 += TRITMAT_COL_BLOCK) {
+                size_t kc = min_size(TRITMAT_COL_BLOCK, cols - c0);
+                decode_block(w, row_bytes, r0, mr, c0, kc, buf);
+                for (size_t b = 0; b < nb; b++) {
+                    const int16_t *xb = x + (b0 + b) * cols + c0;
+                    for (size_t r = 0; r < mr; r++) {
+                        acc[r][b] += dot(buf + r * TRITMAT_COL_BLOCK, xb, kc);
+                    }
+                }
+            }
+            for (size_t r = 0; r < mr; r++) {
+                for (size_t b = 0; b < nb; b++) {
+                    y[(r0 + r) * batch + b0 + b] = saturate_i32(acc[r][b]);
+                }
+            }
+        }
+    }
+}
+
+static void gemm_f32(const uint8_t *w, size_t rows, size_t cols,
+                     const float *x, size_t batch, float *y, dot_f32_fn dot) {
+    trit_t buf[TRITMAT_ROW_BLOCK * TRITMAT_COL_BLOCK];
+    float acc[TRITMAT_ROW_BLOCK][TRITMAT_BATCH_BLOCK];
+    size_t row_bytes = TRITMAT_ROW_BYTES(cols);
+
+    for (size_t b0 = 0; b0 < batch; b0 += TRITMAT_BATCH_BLOCK) {
+        size_t nb = min_size(TRITMAT_BATCH_BLOCK, batch - b0);
+        for (size_t r0 = 0; r0 < rows; r0 += TRITMAT_ROW_BLOCK) {
+            size_t mr = min_size(TRITMAT_ROW_BLOCK, rows - r0);
+            for (size_t r = 0; r < mr; r++) {
+                for (size_t b = 0; b < nb; b++) {
+                    acc[r][b] = 0.0f;
+                }
+            }
+            for (size_t c0 = 0; c0 < cols; c0 += TRITMAT_COL_BLOCK) {
+                size_t kc = min_size(TRITMAT_COL_BLOCK, cols - c0);
+                decode_block(w, row_bytes, r0, mr, c0, kc, buf);
+                for (size_t b = 0; b < nb; b++) {
+                    const float *xb = x + (b0 + b) * cols + c0;
+                    for (size_t r = 0; r < mr; r++) {
+                        acc[r][b] += dot(buf + r * TRITMAT_COL_BLOCK, xb, kc);
+                    }
+                }
+            }
+            for (size_t r = 0; r < mr; r++) {
+                for (size_t b = 0; b < nb; b++) {
+                    y[(r0 + r) * batch + b0 + b] = acc[r][b];
+                }
+            }
+        }
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Threaded Driver
+// ────────────────────────────────────────────────────────────────
+
+// gemm_part runs slice i: rows [i·step, i·step + step) of the job.
+static void gemm_part(void *ctx, unsigned i) {
+    const gemm_job_t *j = ctx;
+    size_t r0 = (size_t)i * j->step;
+    size_t mr = min_size(j->step, j->rows - r0);
+    const uint8_t *w = j->w + r0 * TRITMAT_ROW_BYTES(j->cols);
+    size_t y0 = r0 * j->batch;
+
+    if (j->dot_i8 != NULL) {
+        gemm_i8(w, mr, j->cols, j->x, j->batch, (int32_t *)j->y + y0, j->dot_i8);
+    } else if (j->dot_i16 != NULL) {
+        gemm_i16(w, mr, j->cols, j->x, j->batch, (int32_t *)j->y + y0, j->dot_i16);
+    } else {
+        gemm_f32(w, mr, j->cols, j->x, j->batch, (float *)j->y + y0, j->dot_f32);
+    }
+}
+
+// gemm_mt splits the job's rows into at most `threads` slices and runs
+// them with trit_threads_run.
+static void gemm_mt(gemm_job_t *j, unsigned threads) {
+    size_t parts = threads > 0 ? threads : 1;
+    size_t step = (j->rows + parts - 1) / parts;
+    step = (step + TRITMAT_ROW_BLOCK - 1) / TRITMAT_ROW_BLOCK * TRITMAT_ROW_BLOCK;
+    if (j->rows == 0 || step == 0) {
+        return;
+    }
+    j->step = step;
+    trit_threads_run((unsigned)((j->rows + step - 1) / step), gemm_part, j);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+// tritmat_pack packs a row-major rows × cols trit matrix, one t5b1 row at
+// a time, so every row starts on a byte boundary.
+//
+// Parameters:
+//   w    - rows·cols valid trits, row-major
+//   rows - row count
+//   cols - trits per row
+//   out  - rows·TRITMAT_ROW_BYTES(cols) bytes
+//
+// Returns: bytes written
+size_t tritmat_pack(const trit_t *w, size_t rows, size_t cols, uint8_t *out) {
+    size_t row_bytes = TRITMAT_ROW_BYTES(cols);
+    for (size_t r = 0; r < rows; r++) {
+        trit5_pack_array(w + r * cols, cols, out + r * row_bytes);
+    }
+    return rows * row_bytes;
+}
+
+// tritmat_gemm_i8 sets y[r·batch + b] = Σ_c W[r][c]·x[b·cols + c].
+//
+// Parameters:
+//   w     - packed weights (tritmat_pack layout)
+//   rows  - output rows
+//   cols  - trits per weight row = elements per activation vector
+//   x     - batch vectors of cols elements, back to back
+//   batch - vector count
+//   y     - rows·batch results
+void tritmat_gemm_i8(const uint8_t *w, size_t rows, size_t cols,
+                     const int8_t *x, size_t batch, int32_t *y) {
+    gemm_i8(w, rows, cols, x, batch, y, select_dot_i8());
+}
+
+// tritmat_gemm_i16 is tritmat_gemm_i8 for int16 activations.
+void tritmat_gemm_i16(const uint8_t *w, size_t rows, size_t cols,
+                      const int16_t *x, size_t batch, int32_t *y) {
+    gemm_i16(w, rows, cols, x, batch, y, select_dot_i16());
+}
+
+// tritmat_gemm_f32 is tritmat_gemm_i8 for float activations. Sums are
+// reassociated per backend, so results may differ in the last bits.
+void tritmat_gemm_f32(const uint8_t *w, size_t rows, size_t cols,
+                      const float *x, size_t batch, float *y) {
+    gemm_f32(w, rows, cols, x, batch, y, select_dot_f32());
+}
+
+// tritmat_gemv_i8 sets y[r] = Σ_c W[r][c]·x[c] (tritmat_gemm_i8, batch 1).
+void tritmat_gemv_i8(const uint8_t *w, size_t rows, size_t cols, const int8_t *x, int32_t *y) {
+    gemm_i8(w, rows, cols, x, 1, y, select_dot_i8());
+}
+
+// tritmat_gemv_i16 is tritmat_gemv_i8 for int16 activations.
+void tritmat_gemv_i16(const uint8_t *w, size_t rows, size_t cols, const int16_t *x, int32_t *y) {
+    gemm_i16(w, rows, cols, x, 1, y, select_dot_i16());
+}
+
+// tritmat_gemv_f32 is tritmat_gemv_i8 for float activations.
+void tritmat_gemv_f32(const uint8_t *w, size_t rows, size_t cols, const float *x, float *y) {
+    gemm_f32(w, rows, cols, x, 1, y, select_dot_f32());
+}
+
+// tritmat_gemm_i8_mt is tritmat_gemm_i8 with the rows split across up to
+// `threads` threads (the caller's included). Each thread runs the
+// single-threaded driver on its own row slice, so results match
+// tritmat_gemm_i8 exactly. threads 0 or 1 runs on the caller alone.
+void tritmat_gemm_i8_mt(const uint8_t *w, size_t rows, size_t cols,
+                        const int8_t *x, size_t batch, int32_t *y, unsigned threads) {
+    gemm_job_t j = { w, rows, cols, batch, 0, x, y, select_dot_i8(), NULL, NULL };
+    gemm_mt(&j, threads);
+}
+
+// tritmat_gemm_i16_mt is tritmat_gemm_i8_mt for int16 activations.
+void tritmat_gemm_i16_mt(const uint8_t *w, size_t rows, size_t cols,
+                         const int16_t *x, size_t batch, int32_t *y, unsigned threads) {
+    gemm_job_t j = { w, rows, cols, batch, 0, x, y, NULL, select_dot_i16(), NULL };
+    gemm_mt(&j, threads);
+}
+
+// tritmat_gemm_f32_mt is tritmat_gemm_i8_mt for float activations. Row
+// slices do not change any row's summation order, so results match
+// tritmat_gemm_f32 bit for bit.
+void tritmat_gemm_f32_mt(const uint8_t *w, size_t rows, size_t cols,
+                         const float *x, size_t batch, float *y, unsigned threads) {
+    gemm_job_t j = { w, rows, cols, batch, 0, x, y, NULL, NULL, select_dot_f32() };
+    gemm_mt(&j, threads);
+}
+
+// tritmat_gemv_i8_mt is tritmat_gemv_i8 with the rows split across up to
+// `threads` threads (tritmat_gemm_i8_mt, batch 1).
+void tritmat_gemv_i8_mt(const uint8_t *w, size_t rows, size_t cols,
+                        const int8_t *x, int32_t *y, unsigned threads) {
+    gemm_job_t j = { w, rows, cols, 1, 0, x, y, select_dot_i8(), NULL, NULL };
+    gemm_mt(&j, threads);
+}
+
+// tritmat_gemv_i16_mt is tritmat_gemv_i8_mt for int16 activations.
+void tritmat_gemv_i16_mt(const uint8_t *w, size_t rows, size_t cols,
+                         const int16_t *x, int32_t *y, unsigned threads) {
+    gemm_job_t j = { w, rows, cols, 1, 0, x, y, NULL, select_dot_i16(), NULL };
+    gemm_mt(&j, threads);
+}
+
+// tritmat_gemv_f32_mt is tritmat_gemv_i8_mt for float activations.
+void tritmat_gemv_f32_mt(const uint8_t *w, size_t rows, size_t cols,
+                         const float *x, float *y, unsigned threads) {
+    gemm_job_t j = { w, rows, cols, 1, 0, x, y, NULL, NULL, select_dot_f32() };
+    gemm_mt(&j, threads);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// None needed: every weight byte decodes to some trit, and block sizes
+// are compile-time, so there is nothing to allocate or fail.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-tritmat   # every backend vs a naive trit_multiply loop,
+//                       # shapes across block edges, extreme activations,
+//                       # int16 saturation, row slices, threaded
+//                       # drivers vs single-threaded
+//
+// Benchmark:
+//   make bench-tritmat  # unpack + trit_multiply loop vs each backend
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// No allocation, no state.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ TRITMAT_*_BLOCK sizes (COL_BLOCK must stay a multiple of 5)
+//   ✅ Unrolling the dot kernels (int32 results must not change)
+//
+// Modify with Extreme Care:
+//   ⚠️ Widening before psign (int8 -128 and int16 -32768 would wrap)
+//   ⚠️ Sums stay in the int64 tile until a row block is done; int32
+//      partials are only exact per column block
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Results must equal Σ trit_multiply-style products on every backend
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// A GEMV streams 1.6-bit weights once and decodes each byte once, so it
+// runs near memory bandwidth for large W. A GEMM decodes each weight block
+// once per batch block, so decode cost shrinks by up to 64x and the dot
+// kernels dominate. The _mt drivers split rows, so each thread streams
+// its own weights and shares the activations; a GEMV scales until
+// memory bandwidth runs out.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Let your communication be, Yea, yea; Nay, nay." — Matthew 5:37
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,709 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// tritop.c - Truth-Table Operators
+// Key: B-word-work-pkg-trit-src-tritop
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritop.h, trit.h)
+//   Without TRIT_X86_SIMD (simd_internal.h) arrays take one table load
+//   per trit and programs run on plain uint64 planes.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-logic-algorithms.adoc [Dyadic Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Any monadic or dyadic ternary operator, named by its truth table, run
+// over trit_t arrays or bitsliced vectors at hand-written kernel speed.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "And out of the ground the LORD God formed every beast of
+//            the field, and every fowl of the air; and brought them unto
+//            Adam to see what he would call them." — Genesis 2:19
+//
+// Principle: A thing is known by its name. Name the table and the
+//            operation follows.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: One engine behind every truth table - ADDITION_TABLE,
+//       MULTIPLICATION_TABLE, the Kleene connectives and the 19,000
+//       tables nobody has named yet.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Run an operator given only its ID, without a kernel written
+//          for it.
+//
+// Core Design: A dyadic operator is a 3×3 table, i.e. one trit9_t (see
+//   TRIT_OP2_ID in tritop.h); a monadic one is a trit3 ID and runs as the
+//   dyadic table f(a, b) = f(a).
+//
+//   Bitsliced (trit64b_op_run): each output plane is a boolean function
+//   of the four input planes, but only over the nine valid (a, b) pairs -
+//   a 9-bit truth vector, one of 512. A level-by-level search over
+//   formula size finds the smallest AND / OR / XOR / AND-NOT formula for
+//   all 512 once per process (leaves: the four planes, zeros, ones).
+//   Compiling a table emits both planes' formulas as one straight-line
+//   program, sharing repeated subformulas. trit_add compiles to the same
+//   six operations as trit64b_add, AND/OR to one per plane.
+//
+//   trit_t arrays (trit_op2_apply): the nine-entry table is a pshufb
+//   lookup indexed by 3a + b + 4 - three adds and one shuffle per 16, 32
+//   or 64 trits, whatever the table. Arrays do not run the compiled
+//   program: that would split every byte into planes and merge them back,
+//   several operations per trit against one shuffle. The program is the
+//   path for data already bitsliced (trit64b_t).
+//
+// Key Features:
+//   - All 19,683 dyadic and 27 monadic operators, one code path
+//   - Programs run over blocks of 32 vectors per instruction
+//   - Backend-dispatched (trit_backend_select pins SSE4.1/AVX2/AVX-512)
+//   - out may equal an input in every bulk call
+//
+// Philosophy: A table of nine answers is a circuit of a few gates.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: string.h (memset, memcpy)
+//   - POSIX: pthread.h (pthread_once for the formula table)
+//   - Internal: tritop.h (trit_op_t, TRIT_OP*, prototypes), trit.h
+//     (trit9_pack/unpack, TRIT9_POWERS, trit64b_t, backend enum),
+//     simd.c (trit_backend_active)
+//   - Compiler: immintrin.h + target attributes (GCC/Clang, x86 only)
+//
+// What Uses This:
+//   - Callers with operators beyond the built-in ones; bench/tritop_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: the 512-entry formula table, built under pthread_once by the
+// first compile, so threads compiling at once never race on it. Read-only
+// afterwards; compiled operators belong to the caller.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Feature Test ---
+#define _POSIX_C_SOURCE 200809L  // pthread_once
+
+//--- Standard Library ---
+#include <string.h>     // memset, memcpy
+
+//--- Platform ---
+#include <pthread.h>    // pthread_once
+
+//--- Project Headers ---
+#include "tritop.h"     // trit_op_t, TRIT_OP*, prototypes
+#include "trit.h"       // trit types, backend dispatch
+#include "simd_internal.h" // TRIT_X86_SIMD, intrinsics
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PLANE_FUNCS  512        // 9-bit truth vectors over the valid (a, b) pairs
+#define PLANE_ALL    0x1FFu     // all nine pairs
+#define OP_BLOCK     32         // vectors per program pass (one register row)
+#define LEVEL_MAX    16         // formula sizes searched (all 512 appear well before)
+#define REG_NONE     0xFF       // compile memo: function not emitted yet
+
+// The program body is inlined into each target-specific runner so every
+// backend gets its own vectorization of the same loops.
+#if defined(__GNUC__)
+#define OP_INLINE inline __attribute__((always_inline))
+#else
+#define OP_INLINE inline
+#endif
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// Instruction opcodes (trit_op_t code[i][0]); OP_LEAF marks a register.
+enum { OP_AND, OP_OR, OP_XOR, OP_ANDN, OP_KINDS, OP_LEAF = OP_KINDS };
+
+// Fixed registers of every program.
+enum { REG_AP, REG_AN, REG_BP, REG_BN, REG_ZERO, REG_ONES, REG_FIRST };
+
+// formula_t is the smallest formula for one plane function: op(x, y) over
+// two smaller functions, or a leaf register when op is OP_LEAF.
+typedef struct {
+    uint8_t cost;   // operations in the formula (tree size)
+    uint8_t op;     // OP_AND..OP_ANDN, or OP_LEAF
+    uint16_t x;     // left function (leaf: register number)
+    uint16_t y;     // right function
+} formula_t;
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Truth vector of each leaf register: bit 3·(a+1) + (b+1) is set where
+// the plane is set.
+static const uint16_t LEAF_MASK[REG_FIRST] = {
+    0x1C0,  // a.pos: a = +1
+    0x007,  // a.neg: a = -1
+    0x124,  // b.pos: b = +1
+    0x049,  // b.neg: b = -1
+    0x000,  // zeros
+    0x1FF   // ones
+};
+
+static formula_t formulas[PLANE_FUNCS];
+static pthread_once_t formulas_once = PTHREAD_ONCE_INIT;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static void build_formulas(void);
+static uint8_t emit(trit_op_t *op, uint8_t *reg, uint16_t f);
+static void apply_scalar(const trit_t *lut, const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+static void run_generic(const trit_op_t *op, const trit64b_t *a, const trit64b_t *b,
+                        size_t n, trit64b_t *out);
+
+#if TRIT_X86_SIMD
+static void apply_sse41(const trit_t *lut, const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+static void apply_avx2(const trit_t *lut, const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+static void apply_avx512(const trit_t *lut, const trit_t *a, const trit_t *b, size_t n, trit_t *out);
+static void run_avx2(const trit_op_t *op, const trit64b_t *a, const trit64b_t *b,
+                     size_t n, trit64b_t *out);
+static void run_avx512(const trit_op_t *op, const trit64b_t *a, const trit64b_t *b,
+                       size_t n, trit64b_t *out);
+#endif
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── trit_op2_eval() / trit_op1_eval()       → TRIT9_POWERS digit
+//   ├── trit_op2_compile()                      → pthread_once(build_formulas), emit() per plane
+//   ├── trit_op1_compile()                      → op1_as_op2() → trit_op2_compile()
+//   ├── trit64b_op_run()                        → run_{avx512, avx2, generic}
+//   ├── trit_op2_apply()                        → build_lut() → apply_{avx512, avx2, sse41, scalar}
+//   └── trit_op1_apply()                        → op1_as_op2() → trit_op2_apply(b = in)
+//
+//   Middle Rungs
+//   ├── build_formulas() → minimal formula for each 9-bit plane function
+//   ├── emit()           → post-order emission with a shared-subformula memo
+//   └── run_program()    → register file of OP_BLOCK words per register
+//
+// Baton Flow:
+//   First:   trit_op2_compile → pthread_once → build_formulas()
+//   Compile: table → two 9-bit plane functions → emit() → trit_op_t
+//   Run:     block of 32 vectors → planes → program → planes → block
+
+// ────────────────────────────────────────────────────────────────
+// Helpers/Utilities - Tables and Formulas
+// ────────────────────────────────────────────────────────────────
+
+// build_lut spreads a dyadic table over a 16-byte pshufb table: entry
+// 3a + b + 4 is f(a, b), entries 9-15 are never indexed.
+static void build_lut(trit9_t table, trit_t lut[16]) {
+    memset(lut, 0, 16);
+    trit9_unpack(table, lut);
+}
+
+// op1_as_op2 is the dyadic table f(a, b) = g(a) of a monadic g.
+static trit9_t op1_as_op2(uint8_t table) {
+    trit_t f[9];
+    for (int i = 0; i < 9; i++) {
+        f[i] = trit_op1_eval(table, (trit_t)(i / 3 - 1));
+    }
+    return trit9_pack(f);
+}
+
+// build_formulas finds the smallest formula of every plane function.
+//
+// Level k holds the functions whose smallest formula has k operations;
+// each is op(x, y) with x from level i and y from level k-1-i. Ordered
+// pairs cover both AND-NOT directions. The first formula found at a level
+// is kept, so the table is the same on every run.
+static void build_formulas(void) {
+    uint16_t order[PLANE_FUNCS];
+    size_t start[LEVEL_MAX + 1];
+    size_t found = 0;
+
+    for (size_t f = 0; f < PLANE_FUNCS; f++) {
+        formulas[f].cost = REG_NONE;
+    }
+    for (uint16_t r = 0; r < REG_FIRST; r++) {
+        formula_t leaf = { 0, OP_LEAF, r, 0 };
+        formulas[LEAF_MASK[r]] = leaf;
+        order[found++] = LEAF_MASK[r];
+    }
+    start[0] = 0;
+
+    for (size_t k = 1; k < LEVEL_MAX && found < PLANE_FUNCS; k++) {
+        start[k] = found;
+        for (size_t i = 0; i < k; i++) {
+            size_t j = k - 1 - i;
+            for (size_t xi = start[i]; xi < start[i + 1]; xi++) {
+                for (size_t yi = start[j]; yi < start[j + 1]; yi++) {
+                    uint16_t x = order[xi], y = order[yi];
+                    uint16_t g[OP_KINDS];
+                    g[OP_AND] = x & y;
+                    g[OP_OR] = x | y;
+                    g[OP_XOR] = x ^ y;
+                    g[OP_ANDN] = (uint16_t)(x & ~y & PLANE_ALL);
+                    for (uint8_t o = 0; o < OP_KINDS; o++) {
+                        if (formulas[g[o]].cost == REG_NONE) {
+                            formula_t node = { (uint8_t)k, o, x, y };
+                            formulas[g[o]] = node;
+                            order[found++] = g[o];
+                        }
+                    }
+                }
+            }
+        }
+        start[k + 1] = found;
+    }
+}
+
+// emit appends function f's formula to op (children first) and returns
+// the register holding it. reg memoizes functions already emitted, so a
+// subformula both planes need is computed once.
+static uint8_t emit(trit_op_t *op, uint8_t *reg, uint16_t f) {
+    if (reg[f] != REG_NONE) {
+        return reg[f];
+    }
+    const formula_t *node = &formulas[f];
+    uint8_t x = emit(op, reg, node->x);
+    uint8_t y = emit(op, reg, node->y);
+    op->code[op->len][0] = node->op;
+    op->code[op->len][1] = x;
+    op->code[op->len][2] = y;
+    reg[f] = (uint8_t)(REG_FIRST + op->len++);
+    return reg[f];
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Program Runner (bitsliced)
+// ────────────────────────────────────────────────────────────────
+
+static OP_INLINE void plane_and(uint64_t *restrict d, const uint64_t *restrict x,
+                                const uint64_t *restrict y) {
+    for (size_t j = 0; j < OP_BLOCK; j++) d[j] = x[j] & y[j];
+}
+
+static OP_INLINE void plane_or(uint64_t *restrict d, const uint64_t *restrict x,
+                               const uint64_t *restrict y) {
+    for (size_t j = 0; j < OP_BLOCK; j++) d[j] = x[j] | y[j];
+}
+
+static OP_INLINE void plane_xor(uint64_t *restrict d, const uint64_t *restrict x,
+                                const uint64_t *restrict y) {
+    for (size_t j = 0; j < OP_BLOCK; j++) d[j] = x[j] ^ y[j];
+}
+
+static OP_INLINE void plane_andn(uint64_t *restrict d, const uint64_t *restrict x,
+                                 const uint64_t *restrict y) {
+    for (size_t j = 0; j < OP_BLOCK; j++) d[j] = x[j] & ~y[j];
+}
+
+// plane_split loads OP_BLOCK vectors of a and b into the input registers.
+static OP_INLINE void plane_split(uint64_t (*r)[OP_BLOCK], const trit64b_t *restrict a,
+                                  const trit64b_t *restrict b) {
+    for (size_t j = 0; j < OP_BLOCK; j++) {
+        r[REG_AP][j] = a[j].pos;
+        r[REG_AN][j] = a[j].neg;
+        r[REG_BP][j] = b[j].pos;
+        r[REG_BN][j] = b[j].neg;
+    }
+}
+
+// plane_merge stores OP_BLOCK result vectors from two registers.
+static OP_INLINE void plane_merge(trit64b_t *restrict out, const uint64_t *restrict pos,
+                                  const uint64_t *restrict neg) {
+    for (size_t j = 0; j < OP_BLOCK; j++) {
+        out[j].pos = pos[j];
+        out[j].neg = neg[j];
+    }
+}
+
+// plane_exec runs every instruction across one block of registers.
+static OP_INLINE void plane_exec(const trit_op_t *op, uint64_t (*r)[OP_BLOCK]) {
+    for (size_t i = 0; i < op->len; i++) {
+        const uint8_t *c = op->code[i];
+        uint64_t *d = r[REG_FIRST + i];
+        switch (c[0]) {
+        case OP_AND:  plane_and(d, r[c[1]], r[c[2]]);  break;
+        case OP_OR:   plane_or(d, r[c[1]], r[c[2]]);   break;
+        case OP_XOR:  plane_xor(d, r[c[1]], r[c[2]]);  break;
+        default:      plane_andn(d, r[c[1]], r[c[2]]); break;
+        }
+    }
+}
+
+// run_program splits the vectors into planes OP_BLOCK at a time, runs
+// the program across the block, and reassembles the result. Full blocks
+// use fixed-length loops so they vectorize; the tail goes through a
+// zero-padded copy. A block is read completely before it is written, so
+// out may equal a or b.
+static OP_INLINE void run_program(const trit_op_t *op, const trit64b_t *a, const trit64b_t *b,
+                                  size_t n, trit64b_t *out) {
+    uint64_t r[REG_FIRST + TRIT_OP_CODE_MAX][OP_BLOCK];
+
+    for (size_t j = 0; j < OP_BLOCK; j++) {
+        r[REG_ZERO][j] = 0;
+        r[REG_ONES][j] = ~(uint64_t)0;
+    }
+    size_t k = 0;
+    for (; k + OP_BLOCK <= n; k += OP_BLOCK) {
+        plane_split(r, a + k, b + k);
+        plane_exec(op, r);
+        plane_merge(out + k, r[op->pos], r[op->neg]);
+    }
+    if (k < n) {
+        trit64b_t ta[OP_BLOCK], tb[OP_BLOCK], tout[OP_BLOCK];
+        memset(ta, 0, sizeof(ta));
+        memset(tb, 0, sizeof(tb));
+        memcpy(ta, a + k, (n - k) * sizeof(trit64b_t));
+        memcpy(tb, b + k, (n - k) * sizeof(trit64b_t));
+        plane_split(r, ta, tb);
+        plane_exec(op, r);
+        plane_merge(tout, r[op->pos], r[op->neg]);
+        memcpy(out + k, tout, (n - k) * sizeof(trit64b_t));
+    }
+}
+
+static void run_generic(const trit_op_t *op, const trit64b_t *a, const trit64b_t *b,
+                        size_t n, trit64b_t *out) {
+    run_program(op, a, b, n, out);
+}
+
+#if TRIT_X86_SIMD
+__attribute__((target("avx2")))
+static void run_avx2(const trit_op_t *op, const trit64b_t *a, const trit64b_t *b,
+                     size_t n, trit64b_t *out) {
+    run_program(op, a, b, n, out);
+}
+
+__attribute__((target("avx512f")))
+static void run_avx512(const trit_op_t *op, const trit64b_t *a, const trit64b_t *b,
+                       size_t n, trit64b_t *out) {
+    run_program(op, a, b, n, out);
+}
+#endif
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Table Lookup Kernels (trit_t arrays)
+// ────────────────────────────────────────────────────────────────
+
+// apply_scalar is the portable kernel and the vector tail.
+static void apply_scalar(const trit_t *lut, const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = lut[3 * a[i] + b[i] + 4];
+    }
+}
+
+#if TRIT_X86_SIMD
+__attribute__((target("sse4.1")))
+static void apply_sse41(const trit_t *lut, const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    const __m128i t = _mm_loadu_si128((const __m128i *)(const void *)lut);
+    const __m128i four = _mm_set1_epi8(4);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(const void *)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(const void *)(b + i));
+        __m128i idx = _mm_add_epi8(_mm_add_epi8(_mm_add_epi8(va, va), va), _mm_add_epi8(vb, four));
+        _mm_storeu_si128((__m128i *)(void *)(out + i), _mm_shuffle_epi8(t, idx));
+    }
+    apply_scalar(lut, a + i, b + i, n - i, out + i);
+}
+
+// vpshufb looks up within each 128-bit lane, so the table is broadcast.
+__attribute__((target("avx2")))
+static void apply_avx2(const trit_t *lut, const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    const __m256i t = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(const void *)lut));
+    const __m256i four = _mm256_set1_epi8(4);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)(b + i));
+        __m256i idx = _mm256_add_epi8(_mm256_add_epi8(_mm256_add_epi8(va, va), va),
+                                      _mm256_add_epi8(vb, four));
+        _mm256_storeu_si256((__m256i *)(void *)(out + i), _mm256_shuffle_epi8(t, idx));
+    }
+    apply_scalar(lut, a + i, b + i, n - i, out + i);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static void apply_avx512(const trit_t *lut, const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    const __m512i t = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(const void *)lut));
+    const __m512i four = _mm512_set1_epi8(4);
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m512i va = _mm512_loadu_si512((const void *)(a + i));
+        __m512i vb = _mm512_loadu_si512((const void *)(b + i));
+        __m512i idx = _mm512_add_epi8(_mm512_add_epi8(_mm512_add_epi8(va, va), va),
+                                      _mm512_add_epi8(vb, four));
+        _mm512_storeu_si512((void *)(out + i), _mm512_shuffle_epi8(t, idx));
+    }
+    apply_scalar(lut, a + i, b + i, n - i, out + i);
+}
+#endif // TRIT_X86_SIMD
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+// trit_op2_eval returns f(a, b): digit 3·(a+1) + (b+1) of the table, MST
+// first. TRIT_ZERO for an ID above TRIT9_MAX.
+trit_t trit_op2_eval(trit9_t table, trit_t a, trit_t b) {
+    if (table > TRIT9_MAX) {
+        return TRIT_ZERO;
+    }
+    int digit = 8 - (3 * TRIT_TO_UNSIGNED(a) + TRIT_TO_UNSIGNED(b));
+    return (trit_t)UNSIGNED_TO_TRIT((table / TRIT9_POWERS[digit]) % 3);
+}
+
+// trit_op1_eval returns f(a) for a trit3 ID. TRIT_ZERO for an ID above 26.
+trit_t trit_op1_eval(uint8_t table, trit_t a) {
+    if (table >= TRIT_OP1_STATES) {
+        return TRIT_ZERO;
+    }
+    int digit = 2 - TRIT_TO_UNSIGNED(a);
+    return (trit_t)UNSIGNED_TO_TRIT((table / TRIT5_POWERS[digit]) % 3);
+}
+
+// trit_op2_compile builds the bit-plane program of a dyadic table.
+//
+// The output's pos plane is the 9-bit function "f(a, b) = +1", its neg
+// plane "f(a, b) = -1"; each is emitted from its smallest formula, with
+// any subformula the two share emitted once.
+//
+// Parameters:
+//   table - dyadic truth-table ID (0 to TRIT9_MAX)
+//   op    - receives the program
+//
+// Returns:
+//   false if table is out of range (op untouched)
+bool trit_op2_compile(trit9_t table, trit_op_t *op) {
+    if (table > TRIT9_MAX) {
+        return false;
+    }
+    pthread_once(&formulas_once, build_formulas);
+    trit_t f[9];
+    uint16_t pos = 0, neg = 0;
+    trit9_unpack(table, f);
+    for (int i = 0; i < 9; i++) {
+        if (f[i] == TRIT_POS) pos |= (uint16_t)(1u << i);
+        if (f[i] == TRIT_NEG) neg |= (uint16_t)(1u << i);
+    }
+
+    uint8_t reg[PLANE_FUNCS];
+    memset(reg, REG_NONE, sizeof(reg));
+    for (uint8_t r = 0; r < REG_FIRST; r++) {
+        reg[LEAF_MASK[r]] = r;
+    }
+    op->len = 0;
+    op->pos = emit(op, reg, pos);
+    op->neg = emit(op, reg, neg);
+    return true;
+}
+
+// trit_op1_compile builds the program of a monadic table (run it with
+// b = NULL). false if table > 26.
+bool trit_op1_compile(uint8_t table, trit_op_t *op) {
+    if (table >= TRIT_OP1_STATES) {
+        return false;
+    }
+    return trit_op2_compile(op1_as_op2(table), op);
+}
+
+// trit64b_op_run applies a compiled operator lane-wise:
+// out[i] = op(a[i], b[i]).
+//
+// Parameters:
+//   op  - from trit_op2_compile / trit_op1_compile
+//   a   - n vectors
+//   b   - n vectors, or NULL to use a (monadic operators)
+//   n   - vector count
+//   out - n vectors (may equal a or b)
+void trit64b_op_run(const trit_op_t *op, const trit64b_t *a, const trit64b_t *b,
+                    size_t n, trit64b_t *out) {
+    if (b == NULL) {
+        b = a;
+    }
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: run_avx512(op, a, b, n, out); return;
+    case TRIT_BACKEND_AVX2:   run_avx2(op, a, b, n, out);   return;
+#endif
+    default:                  run_generic(op, a, b, n, out); return;
+    }
+}
+
+// trit_op2_apply sets out[i] = f(a[i], b[i]) for the dyadic table.
+//
+// Parameters:
+//   table - dyadic truth-table ID (0 to TRIT9_MAX)
+//   a, b  - n valid trits each
+//   n     - element count
+//   out   - n trits (may equal a or b)
+//
+// Returns:
+//   false if table is out of range (out untouched)
+bool trit_op2_apply(trit9_t table, const trit_t *a, const trit_t *b, size_t n, trit_t *out) {
+    if (table > TRIT9_MAX) {
+        return false;
+    }
+    trit_t lut[16];
+    build_lut(table, lut);
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: apply_avx512(lut, a, b, n, out); return true;
+    case TRIT_BACKEND_AVX2:   apply_avx2(lut, a, b, n, out);   return true;
+    case TRIT_BACKEND_SSE41:  apply_sse41(lut, a, b, n, out);  return true;
+#endif
+    default:                  apply_scalar(lut, a, b, n, out); return true;
+    }
+}
+
+// trit_op1_apply sets out[i] = f(in[i]) for the monadic table. With
+// b = a the lookup index is 4a + 4, the table's diagonal.
+//
+// Parameters:
+//   table - monadic truth-table ID (0-26)
+//   in    - n valid trits
+//   n     - element count
+//   out   - n trits (may equal in)
+//
+// Returns:
+//   false if table is out of range (out untouched)
+bool trit_op1_apply(uint8_t table, const trit_t *in, size_t n, trit_t *out) {
+    if (table >= TRIT_OP1_STATES) {
+        return false;
+    }
+    return trit_op2_apply(op1_as_op2(table), in, in, n, out);
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// Out-of-range IDs are the only reported error. Operands are assumed
+// valid, as for trit_add: an invalid trit indexes outside the nine live
+// table entries (still inside the 16-byte table), and an invalid lane
+// (both planes set) gives an unspecified but valid-bit result.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-tritop   # all 19,683 dyadic and 27 monadic tables: compiled
+//                      # programs and table lookups vs the table digits,
+//                      # named IDs vs trit_add / trit64b_and / ...
+//
+// Benchmark:
+//   make bench-tritop  # compiled add/multiply vs trit64b_add/multiply,
+//                      # trit_op2_apply vs trit_add_array
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// No allocation. The formula table is static and lives for the process.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ OP_BLOCK (register file is (6 + TRIT_OP_CODE_MAX) × OP_BLOCK words)
+//   ✅ New opcodes (add to the search, the runner switch and the test)
+//
+// Modify with Extreme Care:
+//   ⚠️ TRIT_OP_CODE_MAX must cover the longest program; the test checks
+//   ⚠️ Table ID digit order (MST = f(-1, -1)) is public via TRIT_OP2_ID
+//   ⚠️ LEAF_MASK bit order must match the digit order
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Results must equal the table's digits for every valid pair, on
+//      every backend and both paths
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// The formula search is about a million 9-bit operations, done once.
+// Compiling walks two formulas (microseconds). A program of k
+// instructions costs k plane operations per vector plus the plane
+// split/merge, the same work a hand-written trit64b kernel does.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Whatsoever Adam called every living creature, that was the name
+// thereof." — Genesis 2:19
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
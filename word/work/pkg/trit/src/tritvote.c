@@ -0,0 +1,672 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// tritvote.c - Majority and Consensus Votes across Ternary Vectors
+// Key: B-word-work-pkg-trit-src-tritvote
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: tritvote.h, trit.h)
+//   The adder tree is plain C inlined into target-specific runners
+//   (AVX2 / AVX-512 with GCC/Clang on x86); other toolchains get the
+//   portable runner only. The _mt adds need POSIX threads (thread.c).
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-logic-algorithms.adoc [CONSENSUS (Agreement)]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Bitsliced vote counters fed by a carry-save adder tree, and verdicts
+// read straight from the counter planes.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "In the mouth of two or three witnesses shall every word be
+//            established." — 2 Corinthians 13:1
+//
+// Principle: Every witness is counted, none is clamped away. The verdict
+//            is read from the full tally.
+//
+// # CPI-SI Identity
+//
+// Component Type: Rungs (built on the bitsliced layer)
+//
+// Role: Tally layer for tritvote.h.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Add vectors to per-position +1 / -1 counters at a handful of
+//          word operations per 64 positions, and answer majority,
+//          consensus and counts from the counters.
+//
+// Core Design: A vector's pos plane is one bit of "+1 votes" per
+//   position, its neg plane one bit of "-1 votes", so both counters are
+//   sums of bit-planes. Counting them one vector at a time would ripple
+//   through every counter bit per vector. Instead VOTE_GROUP = 15
+//   vectors go through a carry-save tree: 11 full adders (sum = a^b^c,
+//   carry = majority) reduce 15 planes to a 4-bit count (ones, twos,
+//   fours, eights), and one ripple pass adds it to the counter planes.
+//   Pos and neg words are interleaved exactly as in trit64b_t, so one
+//   tree serves both counters.
+//
+//   Work runs VOTE_BLOCK vectors of positions at a time over fixed-length
+//   arrays, so each runner gets its own vectorization of the same loops
+//   (tritop.c's program runner does the same).
+//
+//   The _mt adds give each thread a slice of whole groups and its own
+//   tritvote_t, then merge the slices into the caller's tally.
+//
+//   Verdicts compare counters on the planes, most significant bit first:
+//   P > N for majority; P = V, N = V and P + N = V for consensus.
+//
+// Key Features:
+//   - No per-position work while adding
+//   - Counters grow by one plane when V needs another bit
+//   - merge adds two tallies plane by plane
+//   - _mt adds tally slices on up to `threads` threads
+//
+// Philosophy: Fifteen witnesses cost eleven adders and one trip to the
+//             ledger.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: stdlib.h (malloc, realloc, free), string.h
+//     (memcpy, memset)
+//   - Internal: tritvote.h, trit.h (trit5_to_trit64b_array, backend
+//     dispatch), thread.c (trit_threads_run)
+//
+// What Uses This:
+//   - tritvote.h consumers; bench/tritvote_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// State: None outside each tritvote_t. Adding t5b1 rows allocates its
+//        own scratch; _mt adds allocate one tally per slice.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdlib.h>      // malloc, realloc, free
+#include <string.h>      // memcpy, memset
+
+//--- Project Headers ---
+#include "tritvote.h"    // tritvote_t, prototypes
+#include "trit.h"        // trit5_to_trit64b_array, backend dispatch
+#include "simd_internal.h" // TRIT_X86_SIMD, intrinsics
+#include "thread_internal.h" // trit_threads_run, TRIT_THREADS_MAX
+
+// ────────────────────────────────────────────────────────────────
+// Constants
+// ────────────────────────────────────────────────────────────────
+
+#define VOTE_GROUP   15                  // vectors per adder tree (4-bit count)
+#define VOTE_BLOCK   16                  // trit64b_t vectors of positions per pass
+#define BLOCK_WORDS  (2 * VOTE_BLOCK)    // pos + neg words per pass
+#define VOTE_BITS_MIN 4                  // planes the 4-bit group count needs
+
+// The tree is inlined into each target-specific runner so every backend
+// gets its own vectorization of the same loops.
+#if defined(__GNUC__)
+#define VOTE_INLINE inline __attribute__((always_inline))
+#else
+#define VOTE_INLINE inline
+#endif
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// vote_job_t is one _mt add split into slices of `per` vectors (whole
+// groups), each tallied into its own part[i]. Exactly one of vecs / rows
+// is set.
+typedef struct {
+    const trit64b_t *vecs;
+    const uint8_t *rows;
+    size_t count, per;
+    tritvote_t part[TRIT_THREADS_MAX];
+    bool ok[TRIT_THREADS_MAX];
+} vote_job_t;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static bool reserve(tritvote_t *v, size_t count);
+static void vote_part(void *ctx, unsigned i);
+static bool add_mt(tritvote_t *v, vote_job_t *j, unsigned threads);
+static void add_group(tritvote_t *v, const trit64b_t *const *in, size_t g);
+static void run_generic(uint64_t *count, size_t stride, unsigned bits, size_t nv,
+                        const trit64b_t *const *in, size_t g);
+
+#if TRIT_X86_SIMD
+static void run_avx2(uint64_t *count, size_t stride, unsigned bits, size_t nv,
+                     const trit64b_t *const *in, size_t g);
+static void run_avx512(uint64_t *count, size_t stride, unsigned bits, size_t nv,
+                       const trit64b_t *const *in, size_t g);
+#endif
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── tritvote_add_t64b/_t5() → reserve() → add_group() per 15 vectors
+//   │                             → run_{avx512, avx2, generic}()
+//   │                               → tally_group() per VOTE_BLOCK
+//   │                                 → fa() tree → add_digits()
+//   ├── tritvote_add_t64b_mt/_t5_mt() → add_mt() → reserve(),
+//   │                             trit_threads_run(vote_part), merge
+//   ├── tritvote_merge()        → reserve() → plane-by-plane ripple add
+//   ├── tritvote_majority()     → MSB-first compare P vs N
+//   ├── tritvote_consensus()    → P = V, N = V, P + N = V
+//   └── tritvote_counts()       → per-position bit gather
+//
+// Baton Flow:
+//   Entry → reserve planes → 15 vectors → 4-bit count → counter planes
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static size_t min_size(size_t a, size_t b) {
+    return a < b ? a : b;
+}
+
+// plane_words is the padded plane length: whole VOTE_BLOCKs of pos, neg.
+static size_t plane_words(size_t n) {
+    size_t nv = TRIT64B_COUNT(n);
+    return 2 * ((nv + VOTE_BLOCK - 1) / VOTE_BLOCK * VOTE_BLOCK);
+}
+
+// reserve widens the counters so V + count fits, zeroing new planes.
+static bool reserve(tritvote_t *v, size_t count) {
+    if (count > TRITVOTE_MAX_VOTES - v->votes) {
+        return false;
+    }
+    uint64_t total = v->votes + count;
+    unsigned need = VOTE_BITS_MIN;
+    while ((total >> need) != 0) {
+        need++;
+    }
+    if (need <= v->bits) {
+        return true;
+    }
+    size_t stride = plane_words(v->n);
+    uint64_t *c = realloc(v->count, ((size_t)need * stride + 1) * sizeof(*c));
+    if (!c) {
+        return false;
+    }
+    memset(c + (size_t)v->bits * stride, 0, (size_t)(need - v->bits) * stride * sizeof(*c));
+    v->count = c;
+    v->bits = need;
+    v->stride = stride;
+    return true;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Carry-Save Tree (inlined per backend)
+// ────────────────────────────────────────────────────────────────
+
+// fa is a full adder across one block: s = a ^ b ^ d (same weight),
+// c = majority(a, b, d) (next weight).
+static VOTE_INLINE void fa(uint64_t *restrict s, uint64_t *restrict c, const uint64_t *restrict a,
+                           const uint64_t *restrict b, const uint64_t *restrict d) {
+    for (size_t j = 0; j < BLOCK_WORDS; j++) {
+        uint64_t t = a[j] ^ b[j];
+        s[j] = t ^ d[j];
+        c[j] = (a[j] & b[j]) | (t & d[j]);
+    }
+}
+
+// add_digits adds the 4-bit count (one, two, four, eight) to the counter
+// planes at cnt (stride words apart), rippling the carry up every plane.
+static VOTE_INLINE void add_digits(uint64_t *cnt, size_t stride, unsigned bits,
+                                   const uint64_t *const digit[4]) {
+    uint64_t carry[BLOCK_WORDS];
+    for (size_t j = 0; j < BLOCK_WORDS; j++) {
+        carry[j] = 0;
+    }
+    for (unsigned b = 0; b < bits; b++, cnt += stride) {
+        if (b < 4) {
+            const uint64_t *x = digit[b];
+            for (size_t j = 0; j < BLOCK_WORDS; j++) {
+                uint64_t c = cnt[j], t = c ^ x[j];
+                cnt[j] = t ^ carry[j];
+                carry[j] = (c & x[j]) | (t & carry[j]);
+            }
+        } else {
+            for (size_t j = 0; j < BLOCK_WORDS; j++) {
+                uint64_t c = cnt[j];
+                cnt[j] = c ^ carry[j];
+                carry[j] = c & carry[j];
+            }
+        }
+    }
+}
+
+// tally_group counts VOTE_GROUP planes x[0..14] of one block into the
+// counters: five adders take the inputs, six more fold the sums and
+// carries down to one digit per weight.
+static VOTE_INLINE void tally_group(uint64_t (*x)[BLOCK_WORDS], uint64_t *cnt, size_t stride,
+                                    unsigned bits) {
+    uint64_t s[7][BLOCK_WORDS];    // weight 1 partial sums
+    uint64_t c2[7][BLOCK_WORDS];   // weight 2 carries
+    uint64_t t2[2][BLOCK_WORDS];   // weight 2 partial sums
+    uint64_t c4[3][BLOCK_WORDS];   // weight 4 carries
+    uint64_t one[BLOCK_WORDS], two[BLOCK_WORDS], four[BLOCK_WORDS], eight[BLOCK_WORDS];
+
+    for (int k = 0; k < 5; k++) {
+        fa(s[k], c2[k], x[3 * k], x[3 * k + 1], x[3 * k + 2]);
+    }
+    fa(s[5], c2[5], s[0], s[1], s[2]);
+    fa(one, c2[6], s[3], s[4], s[5]);
+    fa(t2[0], c4[0], c2[0], c2[1], c2[2]);
+    fa(t2[1], c4[1], c2[3], c2[4], c2[5]);
+    fa(two, c4[2], t2[0], t2[1], c2[6]);
+    fa(four, eight, c4[0], c4[1], c4[2]);
+
+    const uint64_t *const digit[4] = { one, two, four, eight };
+    add_digits(cnt, stride, bits, digit);
+}
+
+// run_group adds g ≤ VOTE_GROUP vectors of nv planes each, one block of
+// positions at a time; missing vectors and positions read as zero.
+static VOTE_INLINE void run_group(uint64_t *count, size_t stride, unsigned bits, size_t nv,
+                                  const trit64b_t *const *in, size_t g) {
+    uint64_t x[VOTE_GROUP][BLOCK_WORDS];
+    for (size_t w0 = 0; w0 < nv; w0 += VOTE_BLOCK) {
+        size_t len = min_size(VOTE_BLOCK, nv - w0);
+        for (size_t k = 0; k < VOTE_GROUP; k++) {
+            size_t have = k < g ? len : 0;
+            memcpy(x[k], in[k < g ? k : 0] + w0, have * sizeof(trit64b_t));
+            memset(x[k] + 2 * have, 0, (VOTE_BLOCK - have) * sizeof(trit64b_t));
+        }
+        tally_group(x, count + 2 * w0, stride, bits);
+    }
+}
+
+static void run_generic(uint64_t *count, size_t stride, unsigned bits, size_t nv,
+                        const trit64b_t *const *in, size_t g) {
+    run_group(count, stride, bits, nv, in, g);
+}
+
+#if TRIT_X86_SIMD
+__attribute__((target("avx2")))
+static void run_avx2(uint64_t *count, size_t stride, unsigned bits, size_t nv,
+                     const trit64b_t *const *in, size_t g) {
+    run_group(count, stride, bits, nv, in, g);
+}
+
+__attribute__((target("avx512f")))
+static void run_avx512(uint64_t *count, size_t stride, unsigned bits, size_t nv,
+                       const trit64b_t *const *in, size_t g) {
+    run_group(count, stride, bits, nv, in, g);
+}
+#endif
+
+// add_group dispatches one group to the active backend's runner.
+static void add_group(tritvote_t *v, const trit64b_t *const *in, size_t g) {
+    size_t nv = TRIT64B_COUNT(v->n);
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: run_avx512(v->count, v->stride, v->bits, nv, in, g); return;
+    case TRIT_BACKEND_AVX2:   run_avx2(v->count, v->stride, v->bits, nv, in, g);   return;
+#endif
+    default:                  run_generic(v->count, v->stride, v->bits, nv, in, g); return;
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Threaded Driver
+// ────────────────────────────────────────────────────────────────
+
+// vote_part tallies slice i: vectors [i·per, i·per + per) into part[i].
+static void vote_part(void *ctx, unsigned i) {
+    vote_job_t *j = ctx;
+    tritvote_t *t = &j->part[i];
+    size_t k0 = (size_t)i * j->per;
+    size_t len = min_size(j->per, j->count - k0);
+
+    if (j->vecs != NULL) {
+        j->ok[i] = tritvote_add_t64b(t, j->vecs + k0 * TRIT64B_COUNT(t->n), len);
+    } else {
+        j->ok[i] = tritvote_add_t5(t, j->rows + k0 * TRIT5_PACKED_SIZE(t->n), len);
+    }
+}
+
+// add_mt splits the job into at most `threads` slices of whole groups,
+// tallies each on its own thread, then merges the slices into v in order.
+// v is widened for the whole job first, so no merge can fail.
+static bool add_mt(tritvote_t *v, vote_job_t *j, unsigned threads) {
+    size_t parts = threads < TRIT_THREADS_MAX ? threads : TRIT_THREADS_MAX;
+    size_t groups = (j->count + VOTE_GROUP - 1) / VOTE_GROUP;
+    bool ok = true;
+
+    if (parts > groups) {
+        parts = groups;
+    }
+    if (parts <= 1) {
+        return j->vecs != NULL ? tritvote_add_t64b(v, j->vecs, j->count)
+                               : tritvote_add_t5(v, j->rows, j->count);
+    }
+    if (!reserve(v, j->count)) {
+        return false;
+    }
+    j->per = (groups + parts - 1) / parts * VOTE_GROUP;
+    parts = (j->count + j->per - 1) / j->per;
+    for (size_t i = 0; i < parts; i++) {
+        tritvote_init(&j->part[i], v->n);
+    }
+    trit_threads_run((unsigned)parts, vote_part, j);
+    for (size_t i = 0; i < parts; i++) {
+        ok = ok && j->ok[i];
+    }
+    for (size_t i = 0; i < parts; i++) {
+        if (ok) {
+            tritvote_merge(v, &j->part[i]);
+        }
+        tritvote_free(&j->part[i]);
+    }
+    return ok;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+//--- Lifetime ---
+
+// tritvote_init sets v to an empty tally of n-trit vectors.
+void tritvote_init(tritvote_t *v, size_t n) {
+    v->n = n;
+    v->votes = 0;
+    v->bits = 0;
+    v->stride = 0;
+    v->count = NULL;
+}
+
+// tritvote_free releases v's counters and leaves it empty.
+void tritvote_free(tritvote_t *v) {
+    free(v->count);
+    tritvote_init(v, v->n);
+}
+
+// tritvote_clear zeroes the tally; the planes stay allocated.
+void tritvote_clear(tritvote_t *v) {
+    if (v->count) {
+        memset(v->count, 0, (size_t)v->bits * v->stride * sizeof(*v->count));
+    }
+    v->votes = 0;
+}
+
+//--- Adding ---
+
+// tritvote_add_t64b adds count vectors of TRIT64B_COUNT(n) planes each.
+bool tritvote_add_t64b(tritvote_t *v, const trit64b_t *vecs, size_t count) {
+    if (!reserve(v, count)) {
+        return false;
+    }
+    size_t nv = TRIT64B_COUNT(v->n);
+    const trit64b_t *in[VOTE_GROUP];
+    for (size_t k0 = 0; k0 < count; k0 += VOTE_GROUP) {
+        size_t g = min_size(VOTE_GROUP, count - k0);
+        for (size_t k = 0; k < g; k++) {
+            in[k] = vecs + (k0 + k) * nv;
+        }
+        add_group(v, in, g);
+    }
+    v->votes += count;
+    return true;
+}
+
+// tritvote_add_t5 adds count t5b1 rows, converting one group at a time.
+bool tritvote_add_t5(tritvote_t *v, const uint8_t *rows, size_t count) {
+    size_t nv = TRIT64B_COUNT(v->n), rb = TRIT5_PACKED_SIZE(v->n);
+    trit64b_t *scratch = malloc((VOTE_GROUP * nv + 1) * sizeof(*scratch));
+    if (!scratch || !reserve(v, count)) {
+        free(scratch);
+        return false;
+    }
+    const trit64b_t *in[VOTE_GROUP];
+    for (size_t k0 = 0; k0 < count; k0 += VOTE_GROUP) {
+        size_t g = min_size(VOTE_GROUP, count - k0);
+        for (size_t k = 0; k < g; k++) {
+            trit5_to_trit64b_array(rows + (k0 + k) * rb, v->n, scratch + k * nv);
+            in[k] = scratch + k * nv;
+        }
+        add_group(v, in, g);
+    }
+    free(scratch);
+    v->votes += count;
+    return true;
+}
+
+// tritvote_add_t64b_mt is tritvote_add_t64b with the vectors split across
+// up to `threads` threads (the caller's included), each into its own
+// tally, merged into v afterwards. Counts match tritvote_add_t64b exactly.
+// threads 0 or 1, or 15 vectors or fewer, runs on the caller alone.
+bool tritvote_add_t64b_mt(tritvote_t *v, const trit64b_t *vecs, size_t count,
+                          unsigned threads) {
+    vote_job_t j;
+    j.vecs = vecs;
+    j.rows = NULL;
+    j.count = count;
+    return add_mt(v, &j, threads);
+}
+
+// tritvote_add_t5_mt is tritvote_add_t5 on threads; each thread converts
+// its own rows.
+bool tritvote_add_t5_mt(tritvote_t *v, const uint8_t *rows, size_t count, unsigned threads) {
+    vote_job_t j;
+    j.vecs = NULL;
+    j.rows = rows;
+    j.count = count;
+    return add_mt(v, &j, threads);
+}
+
+// tritvote_merge adds src's counters to dst's, one word column at a time.
+bool tritvote_merge(tritvote_t *dst, const tritvote_t *src) {
+    if (!reserve(dst, (size_t)src->votes)) {
+        return false;
+    }
+    for (size_t j = 0; j < src->stride; j++) {
+        uint64_t carry = 0;
+        for (unsigned b = 0; b < dst->bits; b++) {
+            uint64_t *c = dst->count + (size_t)b * dst->stride + j;
+            uint64_t x = b < src->bits ? src->count[(size_t)b * src->stride + j] : 0;
+            uint64_t t = *c ^ x;
+            uint64_t next = (*c & x) | (t & carry);
+            *c = t ^ carry;
+            carry = next;
+        }
+    }
+    dst->votes += src->votes;
+    return true;
+}
+
+//--- Verdicts ---
+
+// tritvote_majority compares P and N from the top plane down: the first
+// plane where they differ decides, and no difference is a tie.
+void tritvote_majority(const tritvote_t *v, trit64b_t *out) {
+    size_t nv = TRIT64B_COUNT(v->n);
+    for (size_t w = 0; w < nv; w++) {
+        uint64_t pgt = 0, ngt = 0, eq = ~(uint64_t)0;
+        for (unsigned b = v->bits; b-- > 0;) {
+            uint64_t p = v->count[(size_t)b * v->stride + 2 * w];
+            uint64_t m = v->count[(size_t)b * v->stride + 2 * w + 1];
+            pgt |= eq & p & ~m;
+            ngt |= eq & m & ~p;
+            eq &= ~(p ^ m);
+        }
+        out[w].pos = pgt;
+        out[w].neg = ngt;
+    }
+}
+
+// tritvote_consensus tests P = V and N = V (all agree) and P + N = V (no
+// zero vote) against V's bits, adding P + N on the way.
+void tritvote_consensus(const tritvote_t *v, trit64b_t *out) {
+    size_t nv = TRIT64B_COUNT(v->n);
+    if (v->votes == 0) {
+        memset(out, 0, nv * sizeof(*out));
+        return;
+    }
+    for (size_t w = 0; w < nv; w++) {
+        uint64_t eqp = ~(uint64_t)0, eqn = ~(uint64_t)0, full = ~(uint64_t)0, carry = 0;
+        for (unsigned b = 0; b < v->bits; b++) {
+            uint64_t vb = ((v->votes >> b) & 1) ? ~(uint64_t)0 : 0;
+            uint64_t p = v->count[(size_t)b * v->stride + 2 * w];
+            uint64_t m = v->count[(size_t)b * v->stride + 2 * w + 1];
+            uint64_t t = p ^ m;
+            eqp &= ~(p ^ vb);
+            eqn &= ~(m ^ vb);
+            full &= ~(t ^ carry ^ vb);
+            carry = (p & m) | (t & carry);
+        }
+        out[w].pos = eqp | eqn;
+        out[w].neg = full & ~(eqp | eqn);
+    }
+}
+
+//--- Counts ---
+
+// tritvote_counts gathers each position's bits from the planes.
+void tritvote_counts(const tritvote_t *v, uint32_t *pos, uint32_t *neg) {
+    for (size_t i = 0; i < v->n; i++) {
+        size_t w = i / 64;
+        unsigned lane = (unsigned)(i % 64);
+        uint32_t p = 0, m = 0;
+        for (unsigned b = 0; b < v->bits; b++) {
+            const uint64_t *c = v->count + (size_t)b * v->stride + 2 * w;
+            p |= (uint32_t)((c[0] >> lane) & 1) << b;
+            m |= (uint32_t)((c[1] >> lane) & 1) << b;
+        }
+        pos[i] = p;
+        neg[i] = m;
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// reserve() runs before any counter changes, so a failed add leaves the
+// tally as it was. The _mt adds tally into private tallies and merge
+// only when every slice succeeded. Counters never wrap: V < 2^bits is kept by reserve,
+// and P, N ≤ V.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-tritvote   # counts, majority, consensus vs per-position
+//                        # tallies on every backend; group and block
+//                        # edges; t5b1 = planes; merge = one tally;
+//                        # _mt = one thread at 0-64 threads
+//
+// Benchmark:
+//   make bench-tritvote  # 512 vectors × 4096 trits: per-position
+//                        # counting loop vs the tally per backend, and
+//                        # _mt at 1-8 threads
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// tritvote_free releases the counters. t5b1 scratch and the _mt slice
+// tallies are freed before returning.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ VOTE_BLOCK (re-run make bench-tritvote)
+//   ✅ A larger tree (31 vectors → 5-bit count) with VOTE_BITS_MIN to match
+//
+// Modify with Extreme Care:
+//   ⚠️ reserve() before adding - the ripple drops the top carry
+//   ⚠️ Interleaved pos / neg words - verdicts and merge index by 2·w
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Counts must equal a per-position tally for every input
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Per 15 vectors and 64 positions: 11 full adders (5 operations each,
+// 2 with AVX-512 ternary logic) on pos and neg words, plus a ripple over
+// the counter planes - a few operations per vector-word, so adding is
+// bound by reading the vectors. The t5b1 path converts each row with
+// trit5_to_trit64b_array first, which costs more than the tally.
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "In the mouth of two or three witnesses." — 2 Corinthians 13:1
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,693 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// vartrit.c - Variable-Length Balanced-Ternary Integers
+// Key: B-word-work-pkg-trit-src-vartrit
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: vartrit.h, trit.h)
+//   Without TRIT_X86_SIMD (simd_internal.h) terminators are found one
+//   byte at a time.
+//
+// derives_from: bereshit/word/seed/code/c/source.c
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+// See: word/scripture/web-variant-index.adoc (spare states 243-255)
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Signed integers as t5b1 groups closed by a spare state: no sign
+// mapping, and the end of every value is one byte compare away.
+//
+// libtrit - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Let your communication be, Yea, yea; Nay, nay: for
+//            whatsoever is more than these cometh of evil." — Matthew 5:37
+//
+// Principle: Say a small number in few bytes, and mark plainly where it
+//            ends.
+//
+// # CPI-SI Identity
+//
+// Component Type: Ladder (foundational building block)
+//
+// Role: Serialize signed integers (deltas, IDs) in as many bytes as their
+//       size needs, with value boundaries found by vector compare.
+//
+// Paradigm: CPI-SI framework component
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Write v in balanced base 243, lowest group first. Every group
+//          but the last is a plain t5b1 byte (its 5 balanced trits, MST
+//          first, as trit5_pack writes them); the last is a spare state.
+//
+// Core Design: For k continuation bytes g_0..g_{k-1} and terminator t:
+//
+//     v = Σ (g_i - 121) · 243^i  +  (t - 249) · 243^k
+//
+//   g_i in 0-242 (5 trits), t in 243-255 (a top digit -6..+6, a little
+//   over 2 trits). The encoder writes the shortest form:
+//
+//     bytes   |v| up to          bytes   |v| up to
+//       1     6                    5     22,664,098,606
+//       2     1,579                ...
+//       3     383,818              9     int64 range
+//       4     93,267,895
+//
+//   int32 values take at most 5 bytes (TRIT_VARTRIT_MAX32), int64 at
+//   most 9 (TRIT_VARTRIT_MAX64).
+//
+//   Decoding. A vector kernel marks the bytes >= 243 in a 64-byte
+//   window (max_epu8 / cmpge_epu8_mask). Each set bit ends a value, so
+//   value lengths come from ctz of the mask, and every value is one
+//   Horner pass over bytes already known to be groups.
+//
+// Key Features:
+//   - Sign needs no zig-zag mapping: -v is v with every group mirrored
+//   - Bulk int32 / int64 encode and decode; single-value calls
+//   - Terminator counts (trit_vartrit_count) by compare and popcount
+//   - Decoding checks length and range and never reads past len
+//
+// Philosophy: Continuation bytes stay plain trits; only the end is
+//   special.
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Dependencies
+//
+// What This Needs:
+//   - Standard Library: stdint.h (INT32_*, INT64_*), string.h (memcpy)
+//   - Internal: vartrit.h (TRIT_VARTRIT_*, prototypes), trit.h (backend
+//     dispatch), simd.c (trit_backend_active)
+//   - Compiler: immintrin.h + target attributes (GCC/Clang, x86 only)
+//
+// What Uses This:
+//   - Serialized deltas and IDs; bench/vartrit_bench.c
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Threading: Reentrant; calls share nothing they write. Values are
+//   self-delimiting, so buffers encoded on different threads concatenate,
+//   but one buffer decodes front to back (a value's start is known only
+//   once the one before it is read).
+//
+// State: None. The backend choice lives in simd.c.
+
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdint.h>     // INT32_MIN/MAX, INT64_MAX
+#include <string.h>     // memcpy
+
+//--- Project Headers ---
+#include "vartrit.h"    // TRIT_VARTRIT_*, prototypes
+#include "trit.h"       // TRIT5_*, backend dispatch
+#include "simd_internal.h" // TRIT_X86_SIMD, intrinsics, popcount64, ctz64
+
+// ────────────────────────────────────────────────────────────────
+// Constants
+// ────────────────────────────────────────────────────────────────
+
+#define GROUP       243                     // radix of a continuation byte
+#define TOP_MAX     6                       // terminator digit is -6..+6
+#define TOP_BIAS    (TRIT5_STATES + TOP_MAX) // terminator byte of digit 0 (249)
+#define VT_WINDOW   64                      // bytes marked per kernel call
+#define RUN_MIN     8                       // one-byte values converted as a run
+
+// 243^8 - INT64_MAX (243^8 = 12157665459056928801): a 9-byte int64 has
+// top digit ±1 and a low part within this much of the far end of its
+// range.
+#define POW8_OVER   INT64_C(2934293422202152994)
+
+#define POW2        UINT64_C(59049)         // 243^2
+#define POW4        UINT64_C(3486784401)    // 243^4
+
+// POW[k] = 243^k: the terminator's 243 at byte k - 1, taken back out.
+static const uint64_t POW[TRIT_VARTRIT_MAX64] = {
+    UINT64_C(1), UINT64_C(243), UINT64_C(59049), UINT64_C(14348907), UINT64_C(3486784401),
+    UINT64_C(847288609443), UINT64_C(205891132094649), UINT64_C(50031545098999707),
+    UINT64_C(12157665459056928801)
+};
+
+// REACH[k]: largest |v| written with k groups, (243^k - 1) / 2 + 6 · 243^k.
+static const uint64_t REACH[TRIT_VARTRIT_MAX64 - 1] = {
+    UINT64_C(6), UINT64_C(1579), UINT64_C(383818), UINT64_C(93267895),
+    UINT64_C(22664098606), UINT64_C(5507375961379), UINT64_C(1338292358615218),
+    UINT64_C(325205043143498095)
+};
+
+// ────────────────────────────────────────────────────────────────
+// Types
+// ────────────────────────────────────────────────────────────────
+
+// terms_fn returns bit i set for each in[i] >= 243, i < min(n, 64).
+typedef uint64_t (*terms_fn)(const uint8_t *in, size_t n);
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+static uint64_t terms_scalar(const uint8_t *in, size_t n);
+
+#if TRIT_X86_SIMD
+static uint64_t terms_sse41(const uint8_t *in, size_t n);
+static uint64_t terms_avx2(const uint8_t *in, size_t n);
+static uint64_t terms_avx512(const uint8_t *in, size_t n);
+#endif
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart - Internal Structure
+// ────────────────────────────────────────────────────────────────
+//
+//   Public APIs (Top Rungs)
+//   ├── trit_vartrit_encode()                    → put
+//   ├── trit_vartrit_size()                      → REACH compares
+//   ├── trit_vartrit_encode_i32/_i64()           → put per value
+//   ├── trit_vartrit_decode()                    → byte scan, value
+//   ├── trit_vartrit_decode_i32/_i64()           → decode
+//   └── trit_vartrit_count()                     → terms, popcount
+//
+//   Middle Rungs
+//   ├── terms()   → terms_{avx512, avx2, sse41, scalar}
+//   ├── decode()  → window mask → ctz per value → value4 / value8 / value
+//   └── value()   → Horner over groups, range checks
+//
+//   Bottom Rungs
+//   └── put, load32 / load64, horner4 (+ ctz64, popcount64 from
+//       simd_internal.h)
+//
+// Baton Flow:
+//   Entry → terms → mask → value lengths → value → out
+
+// ────────────────────────────────────────────────────────────────
+// Helpers
+// ────────────────────────────────────────────────────────────────
+
+static size_t min_size(size_t a, size_t b) {
+    return a < b ? a : b;
+}
+
+// put_long writes v digit by digit: balanced remainder, then the
+// quotient, until what is left fits the terminator. Used for 9-byte
+// values, whose offset form (below) would pass 2^64.
+static size_t put_long(int64_t v, uint8_t *out) {
+    size_t o = 0;
+    while (v < -TOP_MAX || v > TOP_MAX) {
+        // Balanced remainder in -121..121; q * 243 + r = v never overflows
+        int64_t q = v / GROUP;
+        int64_t r = v % GROUP;
+        if (r > TRIT5_BIAS) {
+            r -= GROUP;
+            q++;
+        } else if (r < -TRIT5_BIAS) {
+            r += GROUP;
+            q--;
+        }
+        out[o++] = (uint8_t)(r + TRIT5_BIAS);
+        v = q;
+    }
+    out[o++] = (uint8_t)(v + TOP_BIAS);
+    return o;
+}
+
+// Every form below 9 bytes is an offset: with k groups, u = v + REACH[k]
+// has plain base-243 digits that are the bytes themselves - groups 0-242
+// (121 + balanced digit), then 243 + top digit. digits_* build every
+// digit of u (0 above the top one) in registers, add 243 at byte k and
+// store them all, with no branch on k.
+
+// digits5 writes the 5 digits of u < 13 · 243^4.
+static void digits5(uint64_t u, size_t k, uint8_t *out) {
+    uint32_t hi = (uint32_t)(u / POW2);
+    uint32_t lo = (uint32_t)(u - (uint64_t)hi * POW2);
+    uint8_t d[5] = {
+        (uint8_t)(lo % GROUP), (uint8_t)(lo / GROUP), (uint8_t)(hi % GROUP),
+        (uint8_t)(hi / GROUP % GROUP), (uint8_t)(hi / POW2)
+    };
+    d[k] = (uint8_t)(d[k] + TRIT5_STATES);
+    memcpy(out, d, sizeof(d));
+}
+
+// digits8 writes the 8 digits of u < 13 · 243^7, two 4-digit halves in
+// parallel.
+static void digits8(uint64_t u, size_t k, uint8_t *out) {
+    uint32_t hi = (uint32_t)(u / POW4);
+    uint32_t lo = (uint32_t)(u - (uint64_t)hi * POW4);
+    uint8_t d[8];
+    for (size_t i = 0; i < 4; i++) {
+        d[i] = (uint8_t)(lo % GROUP);
+        d[i + 4] = (uint8_t)(hi % GROUP);
+        lo /= GROUP;
+        hi /= GROUP;
+    }
+    d[k] = (uint8_t)(d[k] + TRIT5_STATES);
+    memcpy(out, d, sizeof(d));
+}
+
+// put32 writes v (|v| <= REACH[4]) in its shortest form; stores 5 bytes
+// and returns the length.
+static size_t put32(int64_t v, uint8_t *out) {
+    uint64_t a = v < 0 ? 0 - (uint64_t)v : (uint64_t)v;
+    size_t k = (size_t)(a > REACH[0]) + (a > REACH[1]) + (a > REACH[2]) + (a > REACH[3]);
+    digits5((uint64_t)v + REACH[k], k, out);
+    return k + 1;
+}
+
+// put writes v in its shortest form; stores up to TRIT_VARTRIT_MAX64
+// bytes and returns the length. One byte and up to four bytes (u below
+// 2^32) are the common cases and take the short paths.
+static size_t put(int64_t v, uint8_t *out) {
+    uint64_t a = v < 0 ? 0 - (uint64_t)v : (uint64_t)v;
+    if (a <= REACH[0]) {
+        out[0] = (uint8_t)(v + TOP_BIAS);
+        return 1;
+    }
+    if (a <= REACH[3]) {
+        size_t k = 1 + (size_t)(a > REACH[1]) + (a > REACH[2]);
+        uint32_t u = (uint32_t)((uint64_t)v + REACH[k]);
+        uint8_t d[4] = {
+            (uint8_t)(u % GROUP), (uint8_t)(u / GROUP % GROUP),
+            (uint8_t)(u / POW2 % GROUP), (uint8_t)(u / (POW2 * GROUP))
+        };
+        d[k] = (uint8_t)(d[k] + TRIT5_STATES);
+        memcpy(out, d, sizeof(d));
+        return k + 1;
+    }
+    if (a > REACH[7]) {
+        return put_long(v, out);
+    }
+    size_t k = 4 + (size_t)(a > REACH[4]) + (a > REACH[5]) + (a > REACH[6]);
+    digits8((uint64_t)v + REACH[k], k, out);
+    return k + 1;
+}
+
+// load32 / load64 read 4 / 8 bytes, first byte lowest (one load on
+// little-endian targets).
+static uint32_t load32(const uint8_t *in) {
+    return (uint32_t)in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24;
+}
+
+static uint64_t load64(const uint8_t *in) {
+    return (uint64_t)load32(in) | (uint64_t)load32(in + 4) << 32;
+}
+
+// horner4 weighs the four bytes of w (lowest first) by 1, 243, 243^2,
+// 243^3; the result is below 256 · 243^3 < 2^32.
+static uint32_t horner4(uint32_t w) {
+    return (w & 0xFF) + GROUP * ((w >> 8 & 0xFF) + GROUP * ((w >> 16 & 0xFF) + GROUP * (w >> 24)));
+}
+
+// value4 / value8 are value for len <= 4 / len <= 8 when 4 / 8 bytes at
+// in are readable: bytes past the value are masked to 0, so nothing
+// branches on len.
+static int64_t value4(const uint8_t *in, size_t len) {
+    uint32_t u = horner4(load32(in) & (UINT32_C(0xFFFFFFFF) >> (32 - 8 * len)));
+    return (int64_t)(u - (uint32_t)POW[len]) - (int64_t)REACH[len - 1];
+}
+
+static int64_t value8(const uint8_t *in, size_t len) {
+    uint64_t w = load64(in) & (~UINT64_C(0) >> (64 - 8 * len));
+    uint64_t u = (uint64_t)horner4((uint32_t)(w >> 32)) * POW4 + horner4((uint32_t)w);
+    return (int64_t)(u - POW[len]) - (int64_t)REACH[len - 1];
+}
+
+// value reads the len-byte value at in (len - 1 groups, then a
+// terminator) into *v. Returns 0 if len > TRIT_VARTRIT_MAX64 or the
+// value does not fit in int64.
+static int value(const uint8_t *in, size_t len, int64_t *v) {
+    if (len < TRIT_VARTRIT_MAX64) {
+        uint64_t u = (uint64_t)in[len - 1] - TRIT5_STATES;
+        for (size_t i = len - 1; i-- > 0;) {
+            u = u * GROUP + in[i];
+        }
+        *v = (int64_t)u - (int64_t)REACH[len - 1];
+        return 1;
+    }
+    if (len > TRIT_VARTRIT_MAX64) {
+        return 0;
+    }
+
+    // 9 bytes: the 8 groups fit (|low| < 243^8 / 2); top · 243^8 only
+    // for top = ±1 and a low part leaning the other way
+    int64_t top = (int64_t)in[len - 1] - TOP_BIAS;
+    int64_t low = 0;
+    for (size_t i = len - 1; i-- > 0;) {
+        low = low * GROUP + ((int64_t)in[i] - TRIT5_BIAS);
+    }
+    if (top == 0) {
+        *v = low;
+    } else if (top == 1 && low <= -POW8_OVER) {
+        *v = (low + POW8_OVER) + INT64_MAX;
+    } else if (top == -1 && low >= POW8_OVER - 1) {
+        *v = (low - POW8_OVER) - INT64_MAX;
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+// singles writes the r one-byte values at in (terminators only) to
+// o32 or o64. The bytes are copied first so the compiler need not
+// assume the stores reach them.
+static void singles(const uint8_t *in, size_t r, int32_t *o32, int64_t *o64) {
+    uint8_t b[VT_WINDOW];
+    memcpy(b, in, r);
+    if (o32) {
+        for (size_t i = 0; i < r; i++) {
+            o32[i] = (int32_t)b[i] - TOP_BIAS;
+        }
+    } else {
+        for (size_t i = 0; i < r; i++) {
+            o64[i] = (int64_t)b[i] - TOP_BIAS;
+        }
+    }
+}
+
+// ────────────────────────────────────────────────────────────────
+// Core Operations - Terminator Kernels
+// ────────────────────────────────────────────────────────────────
+
+static uint64_t terms_scalar(const uint8_t *in, size_t n) {
+    uint64_t m = 0;
+    n = min_size(n, VT_WINDOW);
+    for (size_t i = 0; i < n; i++) {
+        m |= (uint64_t)(in[i] >= TRIT5_STATES) << i;
+    }
+    return m;
+}
+
+#if TRIT_X86_SIMD
+
+// No unsigned byte compare before AVX-512: b >= 243 ⟺ max(b, 243) = b.
+
+//--- SSE4.1: 16 bytes per step ---
+
+__attribute__((target("sse4.1")))
+static uint64_t terms_sse41(const uint8_t *in, size_t n) {
+    const __m128i spare = _mm_set1_epi8((char)TRIT5_STATES);
+    n = min_size(n, VT_WINDOW);
+    uint64_t m = 0;
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(in + i));
+        m |= (uint64_t)(unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(a, spare), a)) << i;
+    }
+    return i < n ? m | terms_scalar(in + i, n - i) << i : m;
+}
+
+//--- AVX2: 32 bytes per step ---
+
+__attribute__((target("avx2")))
+static uint64_t terms_avx2(const uint8_t *in, size_t n) {
+    const __m256i spare = _mm256_set1_epi8((char)TRIT5_STATES);
+    n = min_size(n, VT_WINDOW);
+    uint64_t m = 0;
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(in + i));
+        m |= (uint64_t)(uint32_t)_mm256_movemask_epi8(
+                 _mm256_cmpeq_epi8(_mm256_max_epu8(a, spare), a)) << i;
+    }
+    return i < n ? m | terms_scalar(in + i, n - i) << i : m;
+}
+
+//--- AVX-512BW: 64 bytes, masked load for a short window ---
+
+__attribute__((target("avx512f,avx512bw")))
+static uint64_t terms_avx512(const uint8_t *in, size_t n) {
+    __mmask64 k = n >= VT_WINDOW ? ~(__mmask64)0 : ((__mmask64)1 << n) - 1;
+    __m512i a = _mm512_maskz_loadu_epi8(k, (const void *)in);
+    return _mm512_mask_cmpge_epu8_mask(k, a, _mm512_set1_epi8((char)TRIT5_STATES));
+}
+
+#endif // TRIT_X86_SIMD
+
+// ────────────────────────────────────────────────────────────────
+// Middle Rungs - Dispatch and Bulk Decode
+// ────────────────────────────────────────────────────────────────
+
+static terms_fn terms(void) {
+    switch (trit_backend_active()) {
+#if TRIT_X86_SIMD
+    case TRIT_BACKEND_AVX512: return terms_avx512;
+    case TRIT_BACKEND_AVX2:   return terms_avx2;
+    case TRIT_BACKEND_SSE41:  return terms_sse41;
+#endif
+    default:                  return terms_scalar;
+    }
+}
+
+// decode reads n values into o32 or o64. Each window's mask gives the
+// end of every value that finishes inside it; a value cut by the window
+// edge starts the next window. Runs of RUN_MIN or more one-byte values
+// (consecutive set bits) are converted together; shorter runs take the
+// per-value path, which costs less than a mispredicted run. Returns
+// bytes consumed or TRIT_VARTRIT_ERROR.
+static size_t decode(const uint8_t *in, size_t len, int32_t *o32, int64_t *o64, size_t n) {
+    const terms_fn k = terms();
+    size_t max = o32 ? TRIT_VARTRIT_MAX32 : TRIT_VARTRIT_MAX64;
+    size_t p = 0, j = 0;
+
+    while (j < n) {
+        size_t base = p;
+        uint64_t m = k(in + base, len - base);
+        if (m == 0) {
+            return TRIT_VARTRIT_ERROR;      // cut short, or longer than any value
+        }
+        while (m && j < n) {
+            // m has a bit at or past p - base, so the shift is < 64
+            uint64_t gaps = ~(m >> (p - base));
+            size_t r = gaps ? ctz64(gaps) : VT_WINDOW;
+            if (r >= RUN_MIN) {
+                r = min_size(r, n - j);
+                singles(in + p, r, o32 ? o32 + j : NULL, o64 ? o64 + j : NULL);
+                p += r;
+                j += r;
+                m = p - base < VT_WINDOW ? m & (~UINT64_C(0) << (p - base)) : 0;
+                continue;
+            }
+
+            size_t end = base + ctz64(m) + 1;
+            int64_t v;
+            if (end - p > max) {
+                return TRIT_VARTRIT_ERROR;
+            }
+            if (end - p <= 4 && len - p >= 4) {
+                v = value4(in + p, end - p);
+            } else if (end - p < TRIT_VARTRIT_MAX64 && len - p >= 8) {
+                v = value8(in + p, end - p);
+            } else if (!value(in + p, end - p, &v)) {
+                return TRIT_VARTRIT_ERROR;
+            }
+            if (o32) {
+                if (v < INT32_MIN || v > INT32_MAX) {
+                    return TRIT_VARTRIT_ERROR;
+                }
+                o32[j] = (int32_t)v;
+            } else {
+                o64[j] = v;
+            }
+            m &= m - 1;
+            j++;
+            p = end;
+        }
+    }
+    return p;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Public APIs - Exported Interface
+// ────────────────────────────────────────────────────────────────
+
+// trit_vartrit_encode writes v in its shortest form: 1 byte for -6..+6,
+// up to TRIT_VARTRIT_MAX64. Returns bytes written.
+size_t trit_vartrit_encode(int64_t v, uint8_t *out) {
+    return put(v, out);
+}
+
+// trit_vartrit_size is the length trit_vartrit_encode gives v, without
+// writing it.
+size_t trit_vartrit_size(int64_t v) {
+    uint64_t a = v < 0 ? 0 - (uint64_t)v : (uint64_t)v;
+    size_t k = 0;
+    for (size_t i = 0; i < TRIT_VARTRIT_MAX64 - 1; i++) {
+        k += a > REACH[i];
+    }
+    return k + 1;
+}
+
+// trit_vartrit_encode_i32 / _i64 write n values back to back.
+//
+// Parameters:
+//   in  - n values
+//   out - room for n · TRIT_VARTRIT_MAX32 (or _MAX64) bytes
+//
+// Returns: bytes written.
+size_t trit_vartrit_encode_i32(const int32_t *in, size_t n, uint8_t *out) {
+    size_t o = 0;
+    for (size_t i = 0; i < n; i++) {
+        o += put32(in[i], out + o);
+    }
+    return o;
+}
+
+size_t trit_vartrit_encode_i64(const int64_t *in, size_t n, uint8_t *out) {
+    size_t o = 0;
+    for (size_t i = 0; i < n; i++) {
+        o += put(in[i], out + o);
+    }
+    return o;
+}
+
+// trit_vartrit_decode reads the value at the start of in (len bytes).
+//
+// Returns: bytes consumed, or TRIT_VARTRIT_ERROR if no terminator comes
+// within len and TRIT_VARTRIT_MAX64 bytes, or the value overflows int64.
+size_t trit_vartrit_decode(const uint8_t *in, size_t len, int64_t *v) {
+    size_t lim = min_size(len, TRIT_VARTRIT_MAX64);
+    for (size_t i = 0; i < lim; i++) {
+        if (in[i] >= TRIT5_STATES) {
+            return value(in, i + 1, v) ? i + 1 : TRIT_VARTRIT_ERROR;
+        }
+    }
+    return TRIT_VARTRIT_ERROR;
+}
+
+// trit_vartrit_decode_i32 / _i64 read n values from in (len bytes).
+//
+// Returns: bytes consumed (later bytes are left alone), or
+// TRIT_VARTRIT_ERROR if in ends first or a value is too long or out of
+// range for the element type (out then holds a partial result).
+size_t trit_vartrit_decode_i32(const uint8_t *in, size_t len, int32_t *out, size_t n) {
+    return decode(in, len, out, NULL, n);
+}
+
+size_t trit_vartrit_decode_i64(const uint8_t *in, size_t len, int64_t *out, size_t n) {
+    return decode(in, len, NULL, out, n);
+}
+
+// trit_vartrit_count is the number of terminators in in: the values a
+// well-formed buffer holds.
+size_t trit_vartrit_count(const uint8_t *in, size_t len) {
+    const terms_fn k = terms();
+    size_t c = 0;
+    for (size_t p = 0; p < len; p += VT_WINDOW) {
+        c += popcount64(k(in + p, len - p));
+    }
+    return c;
+}
+
+// ────────────────────────────────────────────────────────────────
+// Error Handling/Recovery Patterns
+// ────────────────────────────────────────────────────────────────
+//
+// Encoding cannot fail. Decoding returns TRIT_VARTRIT_ERROR for a value
+// with no terminator before len, longer than the element type allows
+// (5 / 9 bytes), or outside its range; it never reads past in[len - 1].
+// Non-shortest forms within those limits decode to their value.
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 1: CODING
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Code Validation
+// ────────────────────────────────────────────────────────────────
+//
+// Testing:
+//   make test-vartrit   # every length boundary, int32/int64 extremes,
+//                       # groups as trit5_pack digits, bulk decode per
+//                       # backend, overlong, out-of-range, cut-short input
+//
+// Benchmark:
+//   make bench-vartrit  # bytes/value and M values/s vs zig-zag LEB128
+
+// ────────────────────────────────────────────────────────────────
+// Code Cleanup
+// ────────────────────────────────────────────────────────────────
+//
+// No allocation, no state.
+
+// ════════════════════════════════════════════════════════════════
+// GROUP 2: FINAL DOCUMENTATION
+// ════════════════════════════════════════════════════════════════
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Per-backend encode kernels (output must stay the shortest form)
+//   ✅ Fast paths in decode (same values, same errors)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Byte format: low group first, TOP_BIAS, GROUP - written data
+//      depends on it
+//
+// ────────────────────────────────────────────────────────────────
+// Performance Considerations
+// ────────────────────────────────────────────────────────────────
+//
+// Decoding costs one vector compare per 64 bytes plus, per value, a ctz
+// and one masked word load with a fixed Horner (4 or 8 bytes) - no
+// per-byte branch on where a value ends. Encoding divides by the constant 243 (a multiply)
+// once per continuation byte.
+//
+// Size against zig-zag LEB128: a terminator holds 3.7 bits where a LEB
+// byte holds 7, and a continuation byte 7.9 bits. Both take 1 byte for
+// |v| <= 6; LEB128 is a byte shorter for 7-63, 1,580-8,191,
+// 383,819-1,048,575 and 93,267,896-134,217,727, the same length
+// elsewhere below 2^34, and a byte longer above (9 bytes for any int64,
+// LEB128 needs 10).
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Let your communication be, Yea, yea; Nay, nay" — Matthew 5:37
\ No newline at end of file
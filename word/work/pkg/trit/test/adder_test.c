@@ -0,0 +1,402 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Multi-Trit Adders
+// Key: B-word-work-pkg-trit-adder-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Full Adder]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for adder.c - designed to FAIL MEANINGFULLY.
+// The lookahead network must agree with the ripple adder, digit for digit.
+//
+// adder_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: A carry is easy to get right once and hard to get right in parallel.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH adder (or width) loses a carry.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check the full adder table, ripple adder and carry-lookahead adder.
+//
+// Key Features:
+//   - Full adder: all 27 inputs against integer arithmetic
+//   - Ripple: int9 pairs against trit9_add and the overflow flag
+//   - Lookahead: every width 1-64 against the ripple adder, long carry chains
+//   - int27 lanes against trit27_add
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-adder
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>   // printf
+#include <stdint.h>  // uint64_t
+
+//--- Project Headers ---
+#include "trit.h"    // full adder, ripple, lookahead
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_adder_run_all(void);                    // Run all tests, return failure count
+int test_adder_unpacked(void);     // Full adder and ripple
+int test_adder_lookahead(void);    // Bitsliced carry-lookahead
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_adder_run_all()
+//   ├── test_adder_unpacked()  → trit_full_add, trit_ripple_add
+//   └── test_adder_lookahead() → trit64b_add_carry, trit64b_from/to_trit27
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// test_adder_unpacked: Full adder and ripple over trit arrays
+// ────────────────────────────────────────────────────────────────
+
+// next_rand steps a 64-bit LCG.
+static uint64_t next_rand(uint64_t *seed) {
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *seed >> 11;
+}
+
+// rand_trit draws -1, 0 or +1.
+static trit_t rand_trit(uint64_t *seed) {
+    return (trit_t)((int)(next_rand(seed) % 3) - 1);
+}
+
+int test_adder_unpacked(void) {
+    print_header("Adder Unit Tests: trit_full_add, trit_ripple_add");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Full adder - all 27 inputs
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing full adder (27 inputs):\n");
+
+    int fa_ok = 1, null_ok = 1;
+    for (int a = -1; a <= 1; a++) {
+        for (int b = -1; b <= 1; b++) {
+            for (int c = -1; c <= 1; c++) {
+                trit_t co = 7;
+                trit_t s = trit_full_add((trit_t)a, (trit_t)b, (trit_t)c, &co);
+                if (!trit_valid(s) || !trit_valid(co) || 3 * co + s != a + b + c) fa_ok = 0;
+                if (trit_full_add((trit_t)a, (trit_t)b, (trit_t)c, NULL) != s) null_ok = 0;
+            }
+        }
+    }
+    test_assert(fa_ok, "a + b + c_in == 3·c_out + sum for all 27 inputs");
+    test_assert(null_ok, "NULL carry_out accepted, same sum");
+
+    trit_t co;
+    test_assert(trit_full_add(TRIT_POS, TRIT_POS, TRIT_ZERO, &co) == TRIT_NEG && co == TRIT_POS,
+                "1 + 1 = 1T (research doc)");
+    test_assert(trit_full_add(TRIT_NEG, TRIT_NEG, TRIT_NEG, &co) == TRIT_ZERO && co == TRIT_NEG,
+                "T + T + T = T0");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Ripple adder vs packed int9 arithmetic
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing ripple adder (int9, all carry-ins):\n");
+
+    int ripple_ok = 1, carry_ok = 1;
+    for (int a = 0; a < TRIT9_STATES; a += 7) {
+        for (int b = 0; b < TRIT9_STATES; b += 13) {
+            for (int c = -1; c <= 1; c++) {
+                trit_t ta[9], tb[9], tr[9];
+                trit9_unpack((trit9_t)a, ta);
+                trit9_unpack((trit9_t)b, tb);
+                trit_t cout = trit_ripple_add(ta, tb, 9, (trit_t)c, tr);
+                long long want = (long long)(a - TRIT9_BIAS) + (b - TRIT9_BIAS) + c;
+                long long got = trit9_to_int(trit9_pack(tr)) + (long long)cout * TRIT9_STATES;
+                if (got != want) ripple_ok = 0;
+                if (c == 0) {
+                    bool of;
+                    if (trit9_pack(tr) != trit9_add((trit9_t)a, (trit9_t)b, &of) || of != (cout != 0)) carry_ok = 0;
+                }
+            }
+        }
+    }
+    test_assert(ripple_ok, "sum + 3^9·carry_out == a + b + carry_in");
+    test_assert(carry_ok, "carry_in 0: sum == trit9_add, carry_out != 0 iff overflow");
+
+    trit_t ta[9], tb[9];
+    trit9_unpack(TRIT9_MAX, ta);
+    trit9_unpack(TRIT9_BIAS, tb);
+    test_assert(trit_ripple_add(ta, tb, 9, TRIT_POS, ta) == TRIT_POS && trit9_pack(ta) == 0,
+                "MAX + 0 + 1 carries out of every trit (out aliases a)");
+    test_assert(trit_ripple_add(ta, tb, 0, TRIT_NEG, ta) == TRIT_NEG, "n = 0 returns carry_in");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_adder_lookahead: Bitsliced carry-lookahead
+// ────────────────────────────────────────────────────────────────
+
+// rand_lanes fills lanes 0..width-1 with random trits (lane order).
+static trit64b_t rand_lanes(uint64_t *seed, unsigned width, trit_t *lanes) {
+    for (unsigned i = 0; i < width; i++) lanes[i] = rand_trit(seed);
+    return trit64b_from_trits(lanes, width);
+}
+
+int test_adder_lookahead(void) {
+    print_header("Adder Unit Tests: trit64b_add_carry");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Every width 1-64 vs the ripple adder
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing widths 1-64 × carry-ins × 300 pairs:\n");
+
+    uint64_t seed = 2025u;
+    int cla_ok = 1, cout_ok = 1;
+    for (unsigned width = 1; width <= 64 && cla_ok; width++) {
+        for (int pair = 0; pair < 300; pair++) {
+            trit_t la[64], lb[64], lr[64];
+            trit64b_t a = rand_lanes(&seed, width, la);
+            trit64b_t b = rand_lanes(&seed, width, lb);
+            if (pair % 3 == 0) {
+                // Long carry chains: b = -a except lane 0
+                for (unsigned i = 1; i < width; i++) lb[i] = (trit_t)-la[i];
+                b = trit64b_from_trits(lb, width);
+            }
+            // Reference wants MST-first: reverse lanes
+            trit_t ma[64], mb[64], mr[64];
+            for (unsigned i = 0; i < width; i++) {
+                ma[i] = la[width - 1 - i];
+                mb[i] = lb[width - 1 - i];
+            }
+            trit_t cin = (trit_t)(pair % 3 - 1);
+            trit_t want_cout = trit_ripple_add(ma, mb, width, cin, mr);
+            trit_t got_cout = 7;
+            trit64b_t r = trit64b_add_carry(a, b, width, cin, &got_cout);
+            trit64b_to_trits(r, 64, lr);
+            for (unsigned i = 0; i < 64; i++) {
+                trit_t want = (i < width) ? mr[width - 1 - i] : TRIT_ZERO;
+                if (lr[i] != want) cla_ok = 0;
+            }
+            if (!trit64b_valid(r)) cla_ok = 0;
+            if (got_cout != want_cout) cout_ok = 0;
+        }
+    }
+    test_assert(cla_ok, "sum lanes == trit_ripple_add, lanes ≥ width zero");
+    test_assert(cout_ok, "carry_out == ripple carry out");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: int27 lanes vs packed trit27_add
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing int27 in lanes 0-26:\n");
+
+    int rt_ok = 1, add_ok = 1, of_ok = 1;
+    for (int i = 0; i < 20000; i++) {
+        trit27_t a = next_rand(&seed) % TRIT27_STATES;
+        trit27_t b = (i & 1) ? TRIT27_MAX - a + (i % 5) : next_rand(&seed) % TRIT27_STATES;
+        if (b > TRIT27_MAX) b = TRIT27_MAX;
+        trit64b_t va = trit64b_from_trit27(a);
+        trit64b_t vb = trit64b_from_trit27(b);
+        if (trit64b_to_trit27(va) != a || (va.pos | va.neg) >> 27) rt_ok = 0;
+        bool of;
+        trit_t cout;
+        trit27_t want = trit27_add(a, b, &of);
+        if (trit64b_to_trit27(trit64b_add_carry(va, vb, 27, TRIT_ZERO, &cout)) != want) add_ok = 0;
+        if (of != (cout != 0)) of_ok = 0;
+    }
+    test_assert(rt_ok, "trit64b_to_trit27(from_trit27(x)) == x, lanes 27-63 zero");
+    test_assert(add_ok, "add_carry(width 27) == trit27_add");
+    test_assert(of_ok, "carry_out != 0 exactly when trit27_add overflows");
+
+    trit64b_t lo = trit64b_from_trit27(0);
+    trit64b_t hi = trit64b_from_trit27(TRIT27_MAX);
+    test_assert(trit64b_get(lo, 0) == TRIT_NEG && trit64b_get(hi, 26) == TRIT_POS,
+                "lane 0 is the least significant trit");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: Edge widths
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing edge widths:\n");
+
+    trit64b_t ones = { ~(uint64_t)0, 0 };
+    trit64b_t zero = { 0, 0 };
+    trit_t cout = 7;
+    trit64b_t r = trit64b_add_carry(ones, zero, 0, TRIT_POS, &cout);
+    test_assert(r.pos == 0 && r.neg == 0 && cout == TRIT_POS, "width 0: zero sum, carry passes through");
+    r = trit64b_add_carry(ones, zero, 200, TRIT_POS, &cout);
+    test_assert(r.pos == 0 && r.neg == ~(uint64_t)0 && cout == TRIT_POS,
+                "width > 64 clamps: 1…1 + 1 = T…T carry 1");
+    r = trit64b_add_carry(ones, ones, 10, TRIT_ZERO, NULL);
+    trit64b_t r2 = trit64b_add_carry(trit64b_from_trits((const trit_t[]){1,1,1,1,1,1,1,1,1,1}, 10),
+                                     trit64b_from_trits((const trit_t[]){1,1,1,1,1,1,1,1,1,1}, 10),
+                                     10, TRIT_ZERO, NULL);
+    test_assert(r.pos == r2.pos && r.neg == r2.neg && (r.pos | r.neg) >> 10 == 0,
+                "lanes ≥ width ignored on input, NULL carry_out accepted");
+
+    return tests_failed;
+}
+
+
+// ────────────────────────────────────────────────────────────────
+// test_adder_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_adder_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Multi-Trit Adders\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_adder_unpacked();
+    test_adder_lookahead();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_adder_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add widths or chain tests (multi-word carries)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = trit_ripple_add (the research doc algorithm)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Bear ye one another's burdens." — Galatians 6:2
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
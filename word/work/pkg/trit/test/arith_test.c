@@ -0,0 +1,372 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Packed-Domain Arithmetic
+// Key: B-word-work-pkg-trit-arith-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/core/primitives.toml [int9], [int27]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for arith.c - designed to FAIL MEANINGFULLY.
+// Every result must equal plain integer arithmetic, wrapped modulo 3^n.
+//
+// arith_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: A just weight: packed results must weigh the same as integers.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH width or operation breaks the bias contract.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Verify trit5/trit9/trit27 add, sub, neg, cmp and int conversion.
+//
+// Key Features:
+//   - int5: every pair of the 243 states
+//   - int9: every a against a stride of b
+//   - int27: range edges and 200k random pairs vs int64
+//   - Overflow flag set exactly when the result wraps
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-arith
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>   // printf
+#include <stdbool.h> // bool
+
+//--- Project Headers ---
+#include "trit.h"    // packed arithmetic
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_arith_run_all(void);                    // Run all tests, return failure count
+int test_arith_small(void);        // int5 exhaustive, int9 near-exhaustive
+int test_arith_int27(void);        // int27 vs int64 reference
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_arith_run_all()
+//   ├── test_arith_small() → trit5_*, trit9_*
+//   └── test_arith_int27() → trit27_*
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// test_arith_small: int5 exhaustive, int9 near-exhaustive
+// ────────────────────────────────────────────────────────────────
+
+// wrap_ref reduces v to the centered range [-bias, bias] modulo 2·bias+1.
+static long long wrap_ref(long long v, long long bias, int *wrapped) {
+    long long states = 2 * bias + 1;
+    *wrapped = (v > bias || v < -bias);
+    while (v > bias) v -= states;
+    while (v < -bias) v += states;
+    return v;
+}
+
+int test_arith_small(void) {
+    print_header("Arithmetic Unit Tests: int5 and int9");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: int5 - every pair of the 243 states
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing int5 (all 243 × 243 pairs):\n");
+
+    int add_ok = 1, sub_ok = 1, cmp_ok = 1, of_ok = 1;
+    for (int a = 0; a < TRIT5_STATES; a++) {
+        for (int b = 0; b < TRIT5_STATES; b++) {
+            int va = a - TRIT5_BIAS, vb = b - TRIT5_BIAS, w;
+            bool of;
+            long long want = wrap_ref(va + vb, TRIT5_BIAS, &w);
+            if (trit5_to_int(trit5_add((trit5_t)a, (trit5_t)b, &of)) != want) add_ok = 0;
+            if (of != (bool)w) of_ok = 0;
+            want = wrap_ref(va - vb, TRIT5_BIAS, &w);
+            if (trit5_to_int(trit5_sub((trit5_t)a, (trit5_t)b, &of)) != want) sub_ok = 0;
+            if (of != (bool)w) of_ok = 0;
+            if (trit5_cmp((trit5_t)a, (trit5_t)b) != (va > vb) - (va < vb)) cmp_ok = 0;
+        }
+    }
+    test_assert(add_ok, "trit5_add == (a + b) wrapped to [-121, 121]");
+    test_assert(sub_ok, "trit5_sub == (a - b) wrapped to [-121, 121]");
+    test_assert(of_ok, "overflow flag set exactly when the result wrapped");
+    test_assert(cmp_ok, "trit5_cmp orders by signed value");
+
+    // Packed value must equal the balanced digits' value
+    int digits_ok = 1;
+    for (int a = 0; a < TRIT5_STATES; a++) {
+        trit_t t[5];
+        trit5_unpack((trit5_t)a, t);
+        int v = 0;
+        for (int i = 0; i < 5; i++) v = v * 3 + t[i];
+        if (v != trit5_to_int((trit5_t)a) || trit5_neg((trit5_t)a) != trit5_from_int(-v, NULL)) digits_ok = 0;
+    }
+    test_assert(digits_ok, "trit5_to_int == Σ trit·3^k, trit5_neg == from_int(-v)");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: int9 - every a against a stride of b
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing int9 (19,683 × 1,094 pairs):\n");
+
+    add_ok = 1; sub_ok = 1; of_ok = 1;
+    for (int a = 0; a < TRIT9_STATES; a++) {
+        for (int b = 0; b < TRIT9_STATES; b += 18) {
+            int va = a - TRIT9_BIAS, vb = b - TRIT9_BIAS, w;
+            bool of;
+            long long want = wrap_ref(va + vb, TRIT9_BIAS, &w);
+            if (trit9_to_int(trit9_add((trit9_t)a, (trit9_t)b, &of)) != want) add_ok = 0;
+            if (of != (bool)w) of_ok = 0;
+            want = wrap_ref(va - vb, TRIT9_BIAS, &w);
+            if (trit9_to_int(trit9_sub((trit9_t)a, (trit9_t)b, &of)) != want) sub_ok = 0;
+            if (of != (bool)w) of_ok = 0;
+        }
+    }
+    test_assert(add_ok, "trit9_add == (a + b) wrapped to [-9841, 9841]");
+    test_assert(sub_ok, "trit9_sub == (a - b) wrapped to [-9841, 9841]");
+    test_assert(of_ok, "int9 overflow flag exact");
+
+    bool of;
+    test_assert(trit9_from_int(9842, &of) == 0 && of, "trit9_from_int(9842) wraps to -9841, overflow");
+    test_assert(trit9_from_int(-5, &of) == TRIT9_BIAS - 5 && !of, "trit9_from_int(-5) exact");
+    test_assert(trit9_add(1, 2, NULL) == trit9_add(1, 2, &of) && of,
+                "NULL overflow pointer accepted (MIN+1 + MIN+2 wraps)");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_arith_int27: int27 vs int64 reference
+// ────────────────────────────────────────────────────────────────
+
+int test_arith_int27(void) {
+    print_header("Arithmetic Unit Tests: int27");
+
+    const long long bias = (long long)TRIT27_BIAS;
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Edges of the range
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing int27 edges:\n");
+
+    bool of;
+    trit27_t max = trit27_from_int64(bias, &of);
+    test_assert(max == TRIT27_MAX && !of, "from_int64(+BIAS) == TRIT27_MAX");
+    test_assert(trit27_from_int64(-bias, &of) == 0 && !of, "from_int64(-BIAS) == 0");
+    test_assert(trit27_from_int64(0, NULL) == TRIT27_BIAS, "from_int64(0) == BIAS (all zero trits)");
+    trit27_t one = trit27_from_int64(1, NULL);
+    test_assert(trit27_to_int64(trit27_add(max, one, &of)) == -bias && of,
+                "MAX + 1 wraps to MIN with overflow");
+    test_assert(trit27_to_int64(trit27_sub(0, one, &of)) == bias && of,
+                "MIN - 1 wraps to MAX with overflow");
+    test_assert(trit27_neg(0) == TRIT27_MAX && trit27_neg(TRIT27_BIAS) == TRIT27_BIAS,
+                "neg(MIN) == MAX, neg(0) == 0");
+    test_assert(trit27_to_int64(trit27_from_int64(3 * bias + 5, &of)) == 3 - bias && of,
+                "from_int64(3·BIAS + 5) keeps the low 27 trits");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: Random pairs vs int64 arithmetic
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing int27 random pairs:\n");
+
+    int add_ok = 1, sub_ok = 1, cmp_ok = 1, neg_ok = 1, of_ok = 1;
+    unsigned long long seed = 9u;
+    for (int i = 0; i < 200000; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        trit27_t a = (seed >> 11) % TRIT27_STATES;
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        trit27_t b = (seed >> 11) % TRIT27_STATES;
+        if (i % 4 == 0) b = TRIT27_MAX - (b % 1000);   // near the top edge
+        long long va = trit27_to_int64(a), vb = trit27_to_int64(b);
+        int w;
+        long long want = wrap_ref(va + vb, bias, &w);
+        if (trit27_to_int64(trit27_add(a, b, &of)) != want) add_ok = 0;
+        if (of != (bool)w) of_ok = 0;
+        want = wrap_ref(va - vb, bias, &w);
+        if (trit27_to_int64(trit27_sub(a, b, &of)) != want) sub_ok = 0;
+        if (of != (bool)w) of_ok = 0;
+        if (trit27_cmp(a, b) != (va > vb) - (va < vb)) cmp_ok = 0;
+        if (trit27_to_int64(trit27_neg(a)) != -va) neg_ok = 0;
+    }
+    test_assert(add_ok, "trit27_add == int64 sum, wrapped (200k pairs)");
+    test_assert(sub_ok, "trit27_sub == int64 difference, wrapped");
+    test_assert(of_ok, "int27 overflow flag exact");
+    test_assert(cmp_ok, "trit27_cmp orders by signed value");
+    test_assert(neg_ok, "trit27_neg == -value");
+
+    // Packed add must agree with the balanced digits
+    trit_t t[27];
+    trit27_t v = trit27_from_int64(-1234567890123LL, NULL);
+    trit27_unpack(v, t);
+    long long digits = 0;
+    for (int i = 0; i < 27; i++) digits = digits * 3 + t[i];
+    test_assert(digits == -1234567890123LL, "trit27_unpack digits of from_int64(v) sum to v");
+
+    return tests_failed;
+}
+
+
+// ────────────────────────────────────────────────────────────────
+// test_arith_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_arith_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Packed-Domain Arithmetic\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_arith_small();
+    test_arith_int27();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_arith_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add widths (reference = int64 arithmetic wrapped to the balanced range)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = plain integer arithmetic (the definition of truth)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "A just weight is his delight." — Proverbs 11:1
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,369 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Element-wise Array Kernels
+// Key: B-word-work-pkg-trit-array-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Single-Trit Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for array.c - designed to FAIL MEANINGFULLY.
+// Every backend must agree with the per-call operation on every trit.
+//
+// array_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: One rule for one trit or a million.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH backend, operation or length diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check the bulk array kernels against trit_negate/add/multiply/navigate.
+//
+// Key Features:
+//   - All nine input pairs and out-of-range navigate directions
+//   - Every supported backend, every length 0-200 (vector body + scalar tail)
+//   - No writes past n; in-place chains over 100,003 trits
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-array
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>   // printf
+#include <string.h>  // memcmp
+
+//--- Project Headers ---
+#include "trit.h"    // trit types, array kernels, backends
+#include "dimension.h" // trit_navigate, trit_navigate_array
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_array_run_all(void);                    // Run all tests, return failure count
+int test_array_truth(void);        // All pairs, navigation
+int test_array_backends(void);     // Each backend vs per-call ops
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_array_run_all()
+//   ├── test_array_truth()    → nine pairs, navigate directions
+//   └── test_array_backends() → check_backend() per supported backend
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (per-call reference, backend loop)
+// ────────────────────────────────────────────────────────────────
+
+#define BIG_TRITS 100003               // odd: every backend ends in a tail
+
+static trit_t big_a[BIG_TRITS], big_b[BIG_TRITS];
+static trit_t big_out[BIG_TRITS + 1], big_ref[BIG_TRITS];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+// fill_random sets n pseudo-random trits.
+static void fill_random(trit_t *out, size_t n, uint32_t seed) {
+    for (size_t i = 0; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        out[i] = (trit_t)((int)((seed >> 20) % 3) - 1);
+    }
+}
+
+// check_backend runs all four array ops on one backend against the
+// per-call functions: every length 0-200, a big buffer, and in place.
+// Returns 1 if everything matched.
+static int check_backend(trit_backend_t backend) {
+    if (!trit_backend_select(backend)) {
+        return 0;
+    }
+    static const direction_t dirs[] = { DIR_BREAK_DOWN, DIR_ANCHOR, DIR_BUILD_UP };
+
+    for (size_t n = 0; n <= 200; n++) {
+        fill_random(big_a, n, 7u + (uint32_t)n);
+        fill_random(big_b, n, 11u * (uint32_t)n + 3u);
+        for (int op = 0; op < 6; op++) {
+            memset(big_out, 7, n + 1);
+            switch (op) {
+            case 0: trit_negate_array(big_a, n, big_out); break;
+            case 1: trit_add_array(big_a, big_b, n, big_out); break;
+            case 2: trit_multiply_array(big_a, big_b, n, big_out); break;
+            default: trit_navigate_array(big_a, n, dirs[op - 3], big_out); break;
+            }
+            for (size_t i = 0; i < n; i++) {
+                trit_t ref = (op == 0) ? trit_negate(big_a[i])
+                           : (op == 1) ? trit_add(big_a[i], big_b[i])
+                           : (op == 2) ? trit_multiply(big_a[i], big_b[i])
+                           : trit_navigate(big_a[i], dirs[op - 3]);
+                if (big_out[i] != ref) {
+                    printf("    %s: op %d, length %zu, element %zu differs\n",
+                           trit_backend_name(backend), op, n, i);
+                    return 0;
+                }
+            }
+            if (big_out[n] != 7) {
+                printf("    %s: op %d wrote past %zu trits\n", trit_backend_name(backend), op, n);
+                return 0;
+            }
+        }
+    }
+
+    // Large buffer, in place: a = a·b, then a = a + b, then a = -a
+    fill_random(big_a, BIG_TRITS, 2025u);
+    fill_random(big_b, BIG_TRITS, 1225u);
+    for (size_t i = 0; i < BIG_TRITS; i++) {
+        big_ref[i] = trit_negate(trit_add(trit_multiply(big_a[i], big_b[i]), big_b[i]));
+    }
+    trit_multiply_array(big_a, big_b, BIG_TRITS, big_a);
+    trit_add_array(big_a, big_b, BIG_TRITS, big_a);
+    trit_negate_array(big_a, BIG_TRITS, big_a);
+    if (memcmp(big_a, big_ref, BIG_TRITS) != 0) {
+        printf("    %s: in-place chain differs\n", trit_backend_name(backend));
+        return 0;
+    }
+    return 1;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_array_truth: All nine input pairs on the active backend
+// ────────────────────────────────────────────────────────────────
+
+int test_array_truth(void) {
+    print_header("Array Unit Tests: Truth Tables");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: All nine pairs, repeated across a vector width
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing all input pairs (active backend: %s):\n", trit_backend_name(trit_backend_active()));
+
+    trit_t a[99], b[99], sum[99], prod[99], neg[99];
+    for (int i = 0; i < 99; i++) {
+        a[i] = (trit_t)(i % 3 - 1);
+        b[i] = (trit_t)((i / 3) % 3 - 1);
+    }
+    trit_add_array(a, b, 99, sum);
+    trit_multiply_array(a, b, 99, prod);
+    trit_negate_array(a, 99, neg);
+    test_assert(sum[0] == TRIT_NEG && sum[2] == TRIT_ZERO && sum[8] == TRIT_POS,
+                "add: -1+-1 = -1 (clamped), +1+-1 = 0, +1+1 = +1 (clamped)");
+    test_assert(prod[0] == TRIT_POS && prod[2] == TRIT_NEG && prod[4] == TRIT_ZERO && prod[8] == TRIT_POS,
+                "multiply: -·- = +, +·- = -, 0·0 = 0, +·+ = +");
+    test_assert(neg[0] == TRIT_POS && neg[1] == TRIT_ZERO && neg[2] == TRIT_NEG, "negate: -1 ↔ +1, 0 fixed");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Navigation, including out-of-range directions
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing navigation:\n");
+
+    trit_t moved[99];
+    int nav_ok = 1;
+    static const int dirs[] = { -7, -2, -1, 0, 1, 2, 5 };
+    for (size_t d = 0; d < sizeof(dirs) / sizeof(dirs[0]); d++) {
+        trit_navigate_array(a, 99, (direction_t)dirs[d], moved);
+        for (int i = 0; i < 99; i++) {
+            if (moved[i] != trit_navigate(a[i], (direction_t)dirs[d])) nav_ok = 0;
+        }
+    }
+    test_assert(nav_ok, "navigate matches trit_navigate for dir -7..5");
+    trit_navigate_array(a, 99, DIR_ANCHOR, a);
+    test_assert(a[0] == TRIT_NEG && a[98] == TRIT_POS, "DIR_ANCHOR in place leaves the array unchanged");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_array_backends: Each backend vs the per-call functions
+// ────────────────────────────────────────────────────────────────
+
+int test_array_backends(void) {
+    print_header("Array Unit Tests: Backends");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Every supported backend
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing each supported backend against the per-call ops:\n");
+
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        char name[96];
+        if (!trit_backend_supported(backends[i])) {
+            printf("    (skip %s: not supported on this CPU)\n", trit_backend_name(backends[i]));
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s: 4 ops, lengths 0-200, %d trits in place",
+                 trit_backend_name(backends[i]), BIG_TRITS);
+        test_assert(check_backend(backends[i]), name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+
+// ────────────────────────────────────────────────────────────────
+// test_array_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_array_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Element-wise Array Kernels\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_array_truth();
+    test_array_backends();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_array_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add operations to check_backend as kernels are added
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = the per-call single-trit functions
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Of one heart and of one soul." — Acts 4:32
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
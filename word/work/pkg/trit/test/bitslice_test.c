@@ -0,0 +1,346 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Bitsliced Vectors
+// Key: B-word-work-pkg-trit-bitslice-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 2: BCT Parallel]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for bitslice.c - designed to FAIL MEANINGFULLY.
+// Every lane of every operation must agree with the scalar trit tables.
+//
+// bitslice_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: 64 lanes at once must give 64 scalar answers. Check each lane.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH operation or transcoding path diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Verify trit64b_t operations and transcoding.
+//
+// Key Features:
+//   - All 9 input pairs in every lane position vs trit_add/multiply/negate
+//   - Kleene AND/OR vs min/max
+//   - trit_t arrays ↔ planes at every length 0-64
+//   - t5b1 ↔ planes at lengths around vector and byte boundaries
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-bitslice
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>   // printf
+#include <string.h>  // memcmp, memset
+
+//--- Project Headers ---
+#include "trit.h"    // trit64b_t and scalar reference ops
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_bitslice_run_all(void);   // Run all tests, return failure count
+int test_bitslice_ops(void);       // Lane-parallel ops vs scalar tables
+int test_bitslice_transcode(void); // trit_t arrays and t5b1 ↔ planes
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_bitslice_run_all()
+//   ├── test_bitslice_ops()       → trit64b_negate/add/multiply/and/or
+//   └── test_bitslice_transcode() → from/to_trits, trit5 ↔ trit64b arrays
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// test_bitslice_ops: Lane-parallel ops vs scalar tables
+// ────────────────────────────────────────────────────────────────
+
+int test_bitslice_ops(void) {
+    print_header("Bitslice Unit Tests: lane-parallel operations");
+
+    // Lane i holds pair (i % 9): a = i%9/3 - 1, b = i%9%3 - 1. Shifting the
+    // pattern by s moves every pair through every lane position.
+    int add_ok = 1, mul_ok = 1, neg_ok = 1, and_ok = 1, or_ok = 1, valid_ok = 1;
+    for (int s = 0; s < 9; s++) {
+        trit_t a[64], b[64];
+        for (int i = 0; i < 64; i++) {
+            int pair = (i + s) % 9;
+            a[i] = (trit_t)(pair / 3 - 1);
+            b[i] = (trit_t)(pair % 3 - 1);
+        }
+        trit64b_t va = trit64b_from_trits(a, 64);
+        trit64b_t vb = trit64b_from_trits(b, 64);
+        trit64b_t sum = trit64b_add(va, vb);
+        trit64b_t prod = trit64b_multiply(va, vb);
+        trit64b_t neg = trit64b_negate(va);
+        trit64b_t kand = trit64b_and(va, vb);
+        trit64b_t kor = trit64b_or(va, vb);
+        valid_ok &= trit64b_valid(sum) && trit64b_valid(prod) && trit64b_valid(kand) && trit64b_valid(kor);
+        for (unsigned i = 0; i < 64; i++) {
+            trit_t lo = (a[i] < b[i]) ? a[i] : b[i];
+            trit_t hi = (a[i] > b[i]) ? a[i] : b[i];
+            if (trit64b_get(sum, i) != trit_add(a[i], b[i])) add_ok = 0;
+            if (trit64b_get(prod, i) != trit_multiply(a[i], b[i])) mul_ok = 0;
+            if (trit64b_get(neg, i) != trit_negate(a[i])) neg_ok = 0;
+            if (trit64b_get(kand, i) != lo) and_ok = 0;
+            if (trit64b_get(kor, i) != hi) or_ok = 0;
+        }
+    }
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Arithmetic matches trit.c tables lane for lane
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing arithmetic (all 9 pairs × 64 lanes):\n");
+
+    test_assert(add_ok, "trit64b_add == trit_add in every lane (clamped, no carry)");
+    test_assert(mul_ok, "trit64b_multiply == trit_multiply in every lane");
+    test_assert(neg_ok, "trit64b_negate == trit_negate in every lane");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Kleene logic
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing Kleene logic:\n");
+
+    test_assert(and_ok, "trit64b_and == min(a, b) in every lane");
+    test_assert(or_ok, "trit64b_or == max(a, b) in every lane");
+    test_assert(valid_ok, "results never set both planes");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Lane access and validity
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing lane access:\n");
+
+    trit64b_t v = { 1ULL << 63, 1ULL };
+    test_assert(trit64b_get(v, 63) == TRIT_POS && trit64b_get(v, 0) == TRIT_NEG &&
+                trit64b_get(v, 5) == TRIT_ZERO, "trit64b_get reads lanes 0, 5, 63");
+    test_assert(trit64b_get(v, 64) == TRIT_ZERO, "trit64b_get(lane 64) → TRIT_ZERO (safe default)");
+    trit64b_t bad = { 4ULL, 4ULL };
+    test_assert(!trit64b_valid(bad), "trit64b_valid rejects a lane with both planes set");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_bitslice_transcode: trit_t arrays and t5b1 ↔ planes
+// ────────────────────────────────────────────────────────────────
+
+int test_bitslice_transcode(void) {
+    print_header("Bitslice Unit Tests: transcoding");
+
+    trit_t stream[1000];
+    for (int i = 0; i < 1000; i++) {
+        stream[i] = (trit_t)((i * 7 + i / 11) % 3 - 1);
+    }
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: trit_t arrays ↔ planes, every length 0-64
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing trit64b_from_trits/to_trits:\n");
+
+    int load_ok = 1, store_ok = 1;
+    for (size_t n = 0; n <= 64; n++) {
+        trit64b_t v = trit64b_from_trits(stream + n, n);
+        for (unsigned i = 0; i < 64; i++) {
+            trit_t want = (i < n) ? stream[n + i] : TRIT_ZERO;
+            if (trit64b_get(v, i) != want) load_ok = 0;
+        }
+        trit_t out[65];
+        memset(out, 9, sizeof(out));
+        trit64b_to_trits(v, n, out);
+        if (memcmp(out, stream + n, n) != 0 || out[n] != 9) store_ok = 0;
+    }
+    test_assert(load_ok, "from_trits sets lanes 0..n-1, zeros the rest (n = 0..64)");
+    test_assert(store_ok, "to_trits writes exactly n trits (n = 0..64)");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: t5b1 ↔ planes across byte and vector boundaries
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing trit5_to_trit64b_array/trit64b_to_trit5_array:\n");
+
+    int t5_ok = 1, back_ok = 1;
+    for (size_t n = 0; n <= 1000; n += (n < 200) ? 1 : 97) {
+        uint8_t bytes[TRIT5_PACKED_SIZE(1000)];
+        uint8_t again[TRIT5_PACKED_SIZE(1000) + 1];
+        trit64b_t vec[TRIT64B_COUNT(1000)];
+        size_t nb = trit5_pack_array(stream, n, bytes);
+        if (trit5_to_trit64b_array(bytes, n, vec) != TRIT64B_COUNT(n)) t5_ok = 0;
+        for (size_t i = 0; i < 64 * TRIT64B_COUNT(n); i++) {
+            trit_t want = (i < n) ? stream[i] : TRIT_ZERO;
+            if (trit64b_get(vec[i / 64], (unsigned)(i % 64)) != want) t5_ok = 0;
+        }
+        memset(again, 0xEE, sizeof(again));
+        if (trit64b_to_trit5_array(vec, n, again) != nb) back_ok = 0;
+        if (memcmp(again, bytes, nb) != 0 || again[nb] != 0xEE) back_ok = 0;
+    }
+    test_assert(t5_ok, "t5b1 → planes: trit i in lane i%64 of vector i/64, tail zero");
+    test_assert(back_ok, "planes → t5b1 reproduces trit5_pack_array bytes exactly");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_bitslice_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_bitslice_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Bitsliced Vectors\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_bitslice_ops();
+    test_bitslice_transcode();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_bitslice_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add checks for new lane-parallel operations (compare every lane)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = scalar trit.c operations (the definition of truth)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Two are better than one." — Ecclesiastes 4:9
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,513 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Three-Valued Logic
+// Key: B-word-work-pkg-trit-logic-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/tritop_test.c (structure)
+// See: word/research/ternary/ternary-logic-algorithms.adoc [Dyadic Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for logic.h / logic.c - designed to FAIL MEANINGFULLY.
+// Each connective, in each form, must give the logic doc's truth table.
+//
+// logic_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "But let your yea be yea; and your nay, nay." — James 5:12
+//
+// Principle: Yea must come out yea in every form, and unknown unknown.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH connective, form, backend or lane diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check the bool3_* scalar, bool3x64_* bitsliced and bulk forms.
+//
+// Key Features:
+//   - Scalar connectives vs the doc's truth tables (written out here)
+//   - bool3_op_t IDs vs the scalar connectives; De Morgan's laws
+//   - Bitsliced connectives lane-wise vs scalar on random masks
+//   - bool3_apply per backend and bool3x64_apply: lengths 0-200, in place
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-logic
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>   // printf
+#include <string.h>  // memcmp, memset
+
+//--- Project Headers ---
+#include "logic.h"   // bool3 types, connectives, bulk forms
+#include "trit.h"    // trit64b helpers, backends
+#include "tritop.h"  // trit_op2_eval
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+#define CONNECTIVES 10
+#define BIG_VALUES  100003             // odd: every backend ends in a tail
+#define BIG_WORDS   1001
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_logic_run_all(void);      // Run all tests, return failure count
+int test_logic_scalar(void);       // Truth tables, IDs, laws
+int test_logic_bitsliced(void);    // bool3x64_* and bool3x64_apply
+int test_logic_bulk(void);         // bool3_apply per backend
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_logic_run_all()
+//   ├── test_logic_scalar()    → doc tables, enum IDs, De Morgan
+//   ├── test_logic_bitsliced() → lane-wise vs scalar, check_words()
+//   └── test_logic_bulk()      → check_bulk() per backend
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (connective table, references, backend loop)
+// ────────────────────────────────────────────────────────────────
+
+#define F BOOL3_FALSE
+#define U BOOL3_UNKNOWN
+#define T BOOL3_TRUE
+
+// connective_t ties one connective's forms together. doc[3(a+1) + (b+1)]
+// is the logic doc's truth table, copied row by row (NOT: row a).
+typedef struct {
+    const char *name;
+    bool3_op_t op;
+    bool3_t (*scalar)(bool3_t, bool3_t);
+    bool3x64_t (*sliced)(bool3x64_t, bool3x64_t);
+    bool3_t doc[9];
+} connective_t;
+
+static bool3_t not2(bool3_t a, bool3_t b) { (void)b; return bool3_not(a); }
+static bool3x64_t not2x64(bool3x64_t a, bool3x64_t b) { (void)b; return bool3x64_not(a); }
+
+static const connective_t connectives[CONNECTIVES] = {
+    { "NOT",       BOOL3_OP_NOT,       not2,            not2x64,
+      { T, T, T,  U, U, U,  F, F, F } },
+    { "AND",       BOOL3_OP_AND,       bool3_and,       bool3x64_and,
+      { F, F, F,  F, U, U,  F, U, T } },
+    { "OR",        BOOL3_OP_OR,        bool3_or,        bool3x64_or,
+      { F, U, T,  U, U, T,  T, T, T } },
+    { "NAND",      BOOL3_OP_NAND,      bool3_nand,      bool3x64_nand,
+      { T, T, T,  T, U, U,  T, U, F } },
+    { "NOR",       BOOL3_OP_NOR,       bool3_nor,       bool3x64_nor,
+      { T, U, F,  U, U, F,  F, F, F } },
+    { "XOR",       BOOL3_OP_XOR,       bool3_xor,       bool3x64_xor,
+      { F, U, T,  U, U, U,  T, U, F } },
+    { "CONSENSUS", BOOL3_OP_CONSENSUS, bool3_consensus, bool3x64_consensus,
+      { T, U, F,  U, U, U,  F, U, T } },
+    { "EQUALITY",  BOOL3_OP_EQUAL,     bool3_equal,     bool3x64_equal,
+      { T, F, F,  F, T, F,  F, F, T } },
+    { "IMPLIES",   BOOL3_OP_IMPLIES,   bool3_implies,   bool3x64_implies,
+      { T, T, T,  U, U, T,  F, U, T } },
+    { "COMPARE",   BOOL3_OP_COMPARE,   bool3_compare,   bool3x64_compare,
+      { U, F, F,  T, U, F,  T, T, U } }
+};
+
+static bool3_t big_a[BIG_VALUES], big_b[BIG_VALUES], big_out[BIG_VALUES + 1], big_ref[BIG_VALUES];
+static bool3x64_t word_a[BIG_WORDS], word_b[BIG_WORDS], word_out[BIG_WORDS + 1], word_ref[BIG_WORDS];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+// fill_random sets n pseudo-random values.
+static void fill_random(bool3_t *out, size_t n, uint32_t seed) {
+    for (size_t i = 0; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        out[i] = (bool3_t)((int)((seed >> 20) % 3) - 1);
+    }
+}
+
+// fill_words sets n pseudo-random valid bitsliced words.
+static void fill_words(bool3x64_t *out, size_t n, uint32_t seed) {
+    bool3_t lanes[64];
+    for (size_t i = 0; i < n; i++) {
+        fill_random(lanes, 64, seed + 977u * (uint32_t)i);
+        out[i] = trit64b_from_trits(lanes, 64);
+    }
+}
+
+// words_match checks out = c(a, b) lane-wise against the scalar form.
+static int words_match(const connective_t *c, const bool3x64_t *a, const bool3x64_t *b,
+                       const bool3x64_t *out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (!trit64b_valid(out[i])) {
+            return 0;
+        }
+        for (unsigned l = 0; l < 64; l++) {
+            if (trit64b_get(out[i], l) != c->scalar(trit64b_get(a[i], l), trit64b_get(b[i], l))) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+// check_words runs bool3x64_apply for one connective at every word count
+// 0-40 and over BIG_WORDS in place. Returns 1 if everything matched.
+static int check_words(const connective_t *c) {
+    fill_words(word_a, BIG_WORDS, 17u);
+    fill_words(word_b, BIG_WORDS, 29u);
+    for (size_t n = 0; n <= 40; n++) {
+        memset(word_out, 0x5A, sizeof(word_out));
+        bool3x64_apply(c->op, word_a, c->op == BOOL3_OP_NOT ? NULL : word_b, n, word_out);
+        if (!words_match(c, word_a, word_b, word_out, n) || word_out[n].pos != 0x5A5A5A5A5A5A5A5AULL) {
+            printf("    %s: %zu words differ\n", c->name, n);
+            return 0;
+        }
+    }
+    memcpy(word_ref, word_a, sizeof(word_ref));
+    bool3x64_apply(c->op, word_a, word_b, BIG_WORDS, word_a);
+    if (!words_match(c, word_ref, word_b, word_a, BIG_WORDS)) {
+        printf("    %s: in place differs\n", c->name);
+        return 0;
+    }
+    return 1;
+}
+
+// check_bulk runs bool3_apply for every connective on one backend at
+// every length 0-200, then chains three connectives in place over
+// BIG_VALUES. Returns 1 if everything matched.
+static int check_bulk(trit_backend_t backend) {
+    if (!trit_backend_select(backend)) {
+        return 0;
+    }
+    for (size_t n = 0; n <= 200; n++) {
+        fill_random(big_a, n, 7u + (uint32_t)n);
+        fill_random(big_b, n, 11u * (uint32_t)n + 3u);
+        for (int k = 0; k < CONNECTIVES; k++) {
+            const connective_t *c = &connectives[k];
+            memset(big_out, 7, n + 1);
+            bool3_apply(c->op, big_a, c->op == BOOL3_OP_NOT ? NULL : big_b, n, big_out);
+            for (size_t i = 0; i < n; i++) {
+                if (big_out[i] != c->scalar(big_a[i], big_b[i])) {
+                    printf("    %s: %s, length %zu, element %zu differs\n",
+                           trit_backend_name(backend), c->name, n, i);
+                    return 0;
+                }
+            }
+            if (big_out[n] != 7) {
+                printf("    %s: %s wrote past %zu values\n", trit_backend_name(backend), c->name, n);
+                return 0;
+            }
+        }
+    }
+
+    // Large buffer, in place: a = NOT (a → b) EQ b
+    fill_random(big_a, BIG_VALUES, 2025u);
+    fill_random(big_b, BIG_VALUES, 1225u);
+    for (size_t i = 0; i < BIG_VALUES; i++) {
+        big_ref[i] = bool3_equal(bool3_not(bool3_implies(big_a[i], big_b[i])), big_b[i]);
+    }
+    bool3_apply(BOOL3_OP_IMPLIES, big_a, big_b, BIG_VALUES, big_a);
+    bool3_apply(BOOL3_OP_NOT, big_a, NULL, BIG_VALUES, big_a);
+    bool3_apply(BOOL3_OP_EQUAL, big_a, big_b, BIG_VALUES, big_a);
+    if (memcmp(big_a, big_ref, BIG_VALUES) != 0) {
+        printf("    %s: in-place chain differs\n", trit_backend_name(backend));
+        return 0;
+    }
+    return 1;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_logic_scalar: Truth tables, IDs, laws
+// ────────────────────────────────────────────────────────────────
+
+int test_logic_scalar(void) {
+    print_header("Logic Unit Tests: Scalar Connectives");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Truth values are primitives.toml's
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing truth values:\n");
+
+    test_assert(BOOL3_FALSE == -1 && BOOL3_UNKNOWN == 0 && BOOL3_TRUE == 1 && sizeof(bool3_t) == 1,
+                "false = -1, unknown = 0, true = +1, one byte");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Each connective is the doc's table and its own ID
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing each connective on all nine pairs:\n");
+
+    for (int k = 0; k < CONNECTIVES; k++) {
+        const connective_t *c = &connectives[k];
+        int doc_ok = 1, id_ok = 1;
+        for (int i = 0; i < 9; i++) {
+            bool3_t a = (bool3_t)(i / 3 - 1), b = (bool3_t)(i % 3 - 1);
+            if (c->scalar(a, b) != c->doc[i]) doc_ok = 0;
+            if (trit_op2_eval((trit9_t)c->op, a, b) != c->doc[i]) id_ok = 0;
+        }
+        char name[96];
+        snprintf(name, sizeof(name), "%s: scalar form and table ID = the doc's table", c->name);
+        test_assert(doc_ok && id_ok, name);
+    }
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Laws of the logic
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing laws:\n");
+
+    int demorgan_ok = 1, implies_ok = 1, unknown_ok = 1;
+    for (int i = 0; i < 9; i++) {
+        bool3_t a = (bool3_t)(i / 3 - 1), b = (bool3_t)(i % 3 - 1);
+        if (bool3_not(bool3_and(a, b)) != bool3_or(bool3_not(a), bool3_not(b)) ||
+            bool3_not(bool3_or(a, b)) != bool3_and(bool3_not(a), bool3_not(b))) {
+            demorgan_ok = 0;
+        }
+        if (bool3_implies(a, b) != bool3_or(bool3_not(a), b)) implies_ok = 0;
+        if (bool3_and(a, U) == T || bool3_or(a, U) == F || bool3_xor(a, U) != U) unknown_ok = 0;
+    }
+    test_assert(demorgan_ok, "De Morgan: ¬(a∧b) = ¬a∨¬b, ¬(a∨b) = ¬a∧¬b");
+    test_assert(implies_ok, "a → b = ¬a ∨ b");
+    test_assert(unknown_ok, "unknown never makes AND true, OR false, or XOR definite");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_logic_bitsliced: bool3x64_* and bool3x64_apply
+// ────────────────────────────────────────────────────────────────
+
+int test_logic_bitsliced(void) {
+    print_header("Logic Unit Tests: Bitsliced Masks");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: Inline forms lane-wise
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing bool3x64_* lane-wise against scalar:\n");
+
+    fill_words(word_a, 256, 3u);
+    fill_words(word_b, 256, 41u);
+    for (int k = 0; k < CONNECTIVES; k++) {
+        const connective_t *c = &connectives[k];
+        for (size_t i = 0; i < 256; i++) {
+            word_out[i] = c->sliced(word_a[i], word_b[i]);
+        }
+        char name[96];
+        snprintf(name, sizeof(name), "%s: 256 random words, every lane valid", c->name);
+        test_assert(words_match(c, word_a, word_b, word_out, 256), name);
+    }
+
+    // Lanes past the data are unknown in both operands
+    bool3x64_t none = { 0, 0 };
+    bool3x64_t eq = bool3x64_equal(none, none);
+    test_assert(eq.pos == ~0ULL && eq.neg == 0, "EQUALITY of unknown lanes is true");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: bool3x64_apply
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing bool3x64_apply:\n");
+
+    int all_ok = 1;
+    for (int k = 0; k < CONNECTIVES; k++) {
+        if (!check_words(&connectives[k])) all_ok = 0;
+    }
+    test_assert(all_ok, "every connective: 0-40 words, 1001 words in place");
+
+    // Any other table ID runs as a compiled program
+    fill_words(word_a, 8, 5u);
+    fill_words(word_b, 8, 6u);
+    bool3x64_apply((bool3_op_t)TRIT_OP2_ADD, word_a, word_b, 8, word_out);
+    int add_ok = 1;
+    for (size_t i = 0; i < 8; i++) {
+        trit64b_t ref = trit64b_add(word_a[i], word_b[i]);
+        if (word_out[i].pos != ref.pos || word_out[i].neg != ref.neg) add_ok = 0;
+    }
+    test_assert(add_ok, "non-connective ID (TRIT_OP2_ADD) = trit64b_add");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_logic_bulk: bool3_apply per backend
+// ────────────────────────────────────────────────────────────────
+
+int test_logic_bulk(void) {
+    print_header("Logic Unit Tests: bool3_t Arrays");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 6: Every supported backend
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing each supported backend against scalar:\n");
+
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        char name[96];
+        if (!trit_backend_supported(backends[i])) {
+            printf("    (skip %s: not supported on this CPU)\n", trit_backend_name(backends[i]));
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s: every connective, lengths 0-200, %d values in place",
+                 trit_backend_name(backends[i]), BIG_VALUES);
+        test_assert(check_bulk(backends[i]), name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_logic_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_logic_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Three-Valued Logic\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_logic_scalar();
+    test_logic_bitsliced();
+    test_logic_bulk();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_logic_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add a connectives[] row per new connective (doc table included)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = the doc tables as written and the scalar forms
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Lest ye fall into condemnation." — James 5:12
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
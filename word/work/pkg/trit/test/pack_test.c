@@ -114,6 +114,7 @@
 
 //--- Standard Library ---
 #include <stdio.h>   // printf
+#include <string.h>  // memcmp, memset
 
 //--- Project Headers ---
 #include "trit.h"       // MATTER layer: trit types and operations
@@ -438,6 +439,104 @@ int test_trit_space(void) {
     for (int i = 0; i < 27; i++) t27_neg[i] = TRIT_NEG;
     test_assert(trit27_pack(t27_neg) == 0, "trit27_pack(all -1) == 0");
 
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 6: trit5_pack_array/unpack_array (t5b1 streams)
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing trit5_pack_array/unpack_array:\n");
+
+    // Deterministic trit stream covering every state and odd tail lengths
+    trit_t stream[1003];
+    for (int i = 0; i < 1003; i++) {
+        stream[i] = (trit_t)((i * 7 + i / 5) % 3 - 1);
+    }
+
+    // Full groups must match trit5_pack byte for byte
+    uint8_t bytes[TRIT5_PACKED_SIZE(1003)];
+    size_t written = trit5_pack_array(stream, 1000, bytes);
+    int array_pack_ok = (written == 200);
+    for (int g = 0; g < 200 && array_pack_ok; g++) {
+        if (bytes[g] != trit5_pack(stream + 5 * g)) array_pack_ok = 0;
+    }
+    test_assert(array_pack_ok, "trit5_pack_array matches trit5_pack per group");
+
+    // Roundtrip at every tail length 0-4
+    int array_roundtrip_ok = 1;
+    for (size_t n = 995; n <= 1003; n++) {
+        trit_t back[1003];
+        size_t nb = trit5_pack_array(stream, n, bytes);
+        if (nb != TRIT5_PACKED_SIZE(n)) array_roundtrip_ok = 0;
+        if (trit5_unpack_array(bytes, n, back) != nb) array_roundtrip_ok = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (back[i] != stream[i]) array_roundtrip_ok = 0;
+        }
+    }
+    test_assert(array_roundtrip_ok, "trit5 array roundtrip: n = 995..1003 (all tail sizes)");
+
+    // Tail group is padded with TRIT_ZERO at the low positions
+    trit_t two[2] = {TRIT_POS, TRIT_NEG};
+    uint8_t tail_byte = 0;
+    trit5_pack_array(two, 2, &tail_byte);
+    test_assert(tail_byte == 2 * 81 + 0 * 27 + 1 * 9 + 1 * 3 + 1,
+                "pack_array([+1,-1]) pads to [+1,-1,0,0,0] == 175");
+
+    // Unpack writes exactly n trits - nothing past the end
+    trit_t guard[6] = {9, 9, 9, 9, 9, 9};
+    trit5_unpack_array(&tail_byte, 2, guard);
+    test_assert(guard[0] == TRIT_POS && guard[1] == TRIT_NEG && guard[2] == 9,
+                "unpack_array writes only n trits");
+
+    // Empty input is a no-op
+    test_assert(trit5_pack_array(stream, 0, bytes) == 0, "trit5_pack_array(n=0) writes 0 bytes");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 7: trit40_pack/unpack and t5b1 ↔ trit40 conversion
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing trit40 (40 trits per uint64):\n");
+
+    trit_t all_pos40[40], all_neg40[40], all_zero40[40], back40[40];
+    for (int i = 0; i < 40; i++) {
+        all_pos40[i] = TRIT_POS;
+        all_neg40[i] = TRIT_NEG;
+        all_zero40[i] = TRIT_ZERO;
+    }
+    test_assert(trit40_pack(all_neg40) == 0, "trit40_pack([-1]*40) == 0");
+    test_assert(trit40_pack(all_pos40) == TRIT40_MAX, "trit40_pack([+1]*40) == 3^40-1 (fits in uint64)");
+    test_assert(trit40_pack(all_zero40) == TRIT40_BIAS, "trit40_pack([0]*40) == TRIT40_BIAS");
+
+    int t40_roundtrip_ok = 1;
+    for (int w = 0; w + 40 <= 1003; w += 37) {
+        trit40_unpack(trit40_pack(stream + w), back40);
+        for (int i = 0; i < 40; i++) {
+            if (back40[i] != stream[w + i]) t40_roundtrip_ok = 0;
+        }
+    }
+    trit40_unpack(TRIT40_MAX, back40);
+    if (back40[0] != TRIT_POS || back40[39] != TRIT_POS) t40_roundtrip_ok = 0;
+    test_assert(t40_roundtrip_ok, "trit40 roundtrip (26 windows + max)");
+
+    // Every word equals trit40_pack of its 40 trits, for every tail length
+    int t40_stream_ok = 1;
+    for (size_t n = 960; n <= 1003; n++) {
+        trit40_t words[TRIT40_PACKED_SIZE(1003)];
+        uint8_t again[TRIT5_PACKED_SIZE(1003)];
+        size_t nb = trit5_pack_array(stream, n, bytes);
+        size_t nw = trit5_to_trit40_array(bytes, n, words);
+        if (nw != TRIT40_PACKED_SIZE(n)) t40_stream_ok = 0;
+        for (size_t w = 0; w < nw; w++) {
+            trit_t chunk[40];
+            for (size_t i = 0; i < 40; i++) {
+                size_t at = 40 * w + i;
+                chunk[i] = (at < n) ? stream[at] : TRIT_ZERO;
+            }
+            if (words[w] != trit40_pack(chunk)) t40_stream_ok = 0;
+        }
+        memset(again, 0xEE, sizeof(again));
+        if (trit40_to_trit5_array(words, n, again) != nb) t40_stream_ok = 0;
+        if (memcmp(again, bytes, nb) != 0) t40_stream_ok = 0;
+        if (nb < sizeof(again) && again[nb] != 0xEE) t40_stream_ok = 0;
+    }
+    test_assert(t40_stream_ok, "t5b1 → trit40 → t5b1 exact, words == trit40_pack (n = 960..1003)");
+
     return tests_failed;
 }
 
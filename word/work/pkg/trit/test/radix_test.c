@@ -0,0 +1,442 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Binary ↔ Ternary Radix Conversion
+// Key: B-word-work-pkg-trit-radix-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/research/ternary/ternary-conversion-algorithms.adoc [Binary Conversions]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for radix.c - designed to FAIL MEANINGFULLY.
+// Every conversion must return the same value the slow way does.
+//
+// radix_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: Conversion preserves value, not representation.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH direction, size or pattern breaks.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check power-tree radix conversion against the per-trit reference.
+//
+// Key Features:
+//   - Binary → ternary vs one "% 3" pass per trit, 1-257 limbs
+//   - Random, all-ones and single-bit patterns (worst-case carries)
+//   - Round trips in both directions up to 4100 limbs (several tree levels)
+//   - Two's complement for negatives, fit flags, trit27 and trit5 arrays
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-radix
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>   // printf
+#include <string.h>  // memcmp, memcpy
+
+//--- Project Headers ---
+#include "tritbig.h" // radix conversion, tritbig_t
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_radix_run_all(void);                    // Run all tests, return failure count
+int test_radix_from_binary(void);  // Binary → ternary
+int test_radix_to_binary(void);    // Ternary → binary
+int test_radix_arrays(void);       // trit27 / trit5 arrays
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_radix_run_all()
+//   ├── test_radix_from_binary() → small values, per-trit reference
+//   ├── test_radix_to_binary()   → round trips, two's complement, fit
+//   └── test_radix_arrays()      → trit27 words, trit5 bytes
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (per-trit reference, operand patterns)
+// ────────────────────────────────────────────────────────────────
+
+#define MAX_LIMBS 4200
+
+static uint64_t buf_a[MAX_LIMBS], buf_b[MAX_LIMBS], buf_c[MAX_LIMBS];
+static trit_t ref_trits[MAX_LIMBS * 41 + 1], got_trits[MAX_LIMBS * 41 + 1];
+
+// next_rand steps a 64-bit LCG.
+static uint64_t next_rand(uint64_t *seed) {
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *seed;
+}
+
+// ref_to_trits is the O(n^2) conversion this module replaces: one
+// "% 3" pass over all limbs per trit. Writes `count` trits MST-first.
+static void ref_to_trits(const uint64_t *in, size_t n, trit_t *out, size_t count) {
+    static uint64_t v[MAX_LIMBS];
+    memcpy(v, in, n * sizeof(uint64_t));
+    for (size_t t = count; t-- > 0;) {
+        uint64_t rem = 0;
+        for (size_t i = n; i-- > 0;) {
+            __extension__ unsigned __int128 cur = ((unsigned __int128)rem << 64) | v[i];
+            v[i] = (uint64_t)(cur / 3);
+            rem = (uint64_t)(cur % 3);
+        }
+        // Remainder 2 is digit -1 with a carry into the quotient
+        out[t] = (rem == 2) ? TRIT_NEG : (trit_t)rem;
+        if (rem == 2) {
+            for (size_t i = 0; i < n && ++v[i] == 0; i++) {
+            }
+        }
+    }
+}
+
+// fill sets n limbs: 0 random, 1 all ones (2^(64n) - 1), 2 top bit only
+static void fill(uint64_t *out, size_t n, int pattern, uint64_t *seed) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (pattern == 0) ? next_rand(seed) : (pattern == 1) ? UINT64_MAX : 0;
+    }
+    if (pattern == 2 && n) out[n - 1] = 1ULL << 63;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_radix_from_binary: binary → balanced ternary
+// ────────────────────────────────────────────────────────────────
+
+int test_radix_from_binary(void) {
+    print_header("radix Unit Tests: Binary → Ternary");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Small values
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing small values:\n");
+
+    tritbig_t x = TRITBIG_INIT;
+    uint64_t v1[2] = { 5, 0 };
+    tritbig_from_binary(&x, v1, 2);
+    test_assert(tritbig_to_int64(&x, NULL) == 5 && x.len == 1, "{5, 0} → 5 (zero top limb ignored)");
+    tritbig_from_binary(&x, v1, 0);
+    test_assert(x.len == 0, "0 limbs → zero");
+    uint64_t max1 = UINT64_MAX;
+    tritbig_from_binary(&x, &max1, 1);
+    test_assert(tritbig_trits(&x) == 42 && TRITBIG_TRITS_FOR_BINARY(1) >= 42,
+                "2^64 - 1 needs 42 trits ((3^41 - 1)/2 < 2^64 - 1), macro covers it");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Against the per-trit reference
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing against per-trit %% 3 reference:\n");
+
+    static const size_t sizes[] = { 1, 2, 3, 23, 24, 25, 26, 33, 48, 49, 64, 65, 97, 128, 129, 200, 257 };
+    uint64_t seed = 2718u;
+    int ok[3] = { 1, 1, 1 };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (int pattern = 0; pattern < 3; pattern++) {
+            size_t n = sizes[s];
+            size_t t = TRITBIG_TRITS_FOR_BINARY(n);
+            fill(buf_a, n, pattern, &seed);
+            ref_to_trits(buf_a, n, ref_trits, t);
+            bool fits = tritbig_from_binary(&x, buf_a, n) && tritbig_to_trits(&x, got_trits, t);
+            if (!fits || memcmp(ref_trits, got_trits, t) != 0) ok[pattern] = 0;
+        }
+    }
+    test_assert(ok[0], "random values, 1-257 limbs (basecase and 1-4 tree levels)");
+    test_assert(ok[1], "2^(64n) - 1 (all carries)");
+    test_assert(ok[2], "2^(64n - 1) (single bit)");
+
+    tritbig_free(&x);
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_radix_to_binary: balanced ternary → binary, round trips
+// ────────────────────────────────────────────────────────────────
+
+int test_radix_to_binary(void) {
+    print_header("radix Unit Tests: Ternary → Binary");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Round trips
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing round trips:\n");
+
+    static const size_t sizes[] = { 1, 2, 24, 25, 31, 64, 100, 333, 1024, 1025, 4100 };
+    tritbig_t x = TRITBIG_INIT, y = TRITBIG_INIT;
+    uint64_t seed = 31415u;
+    int bin_ok = 1, tern_ok = 1, width_ok = 1;
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (int pattern = 0; pattern < 3; pattern++) {
+            size_t n = sizes[s];
+            fill(buf_a, n, pattern, &seed);
+            if (!tritbig_from_binary(&x, buf_a, n) || !tritbig_to_binary(&x, buf_b, n) ||
+                memcmp(buf_a, buf_b, n * sizeof(uint64_t)) != 0) {
+                bin_ok = 0;
+            }
+            if (TRITBIG_BINARY_FOR_TRITS(tritbig_trits(&x)) < n) width_ok = 0;
+
+            // Random balanced trits, positive: ternary → binary → ternary
+            size_t t = n * 40;
+            for (size_t i = 0; i < t; i++) got_trits[i] = (trit_t)((int)((next_rand(&seed) >> 33) % 3) - 1);
+            got_trits[0] = TRIT_POS;
+            size_t w = TRITBIG_BINARY_FOR_TRITS(t);
+            tritbig_from_trits(&x, got_trits, t);
+            if (!tritbig_to_binary(&x, buf_b, w) || !tritbig_from_binary(&y, buf_b, w) ||
+                tritbig_cmp(&x, &y) != 0) {
+                tern_ok = 0;
+            }
+        }
+    }
+    test_assert(bin_ok, "binary → ternary → binary, 1-4100 limbs");
+    test_assert(tern_ok, "ternary → binary → ternary, 40-164,000 trits");
+    test_assert(width_ok, "TRITBIG_BINARY_FOR_TRITS covers the value");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: Wrap and fit
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing two's complement and fit flags:\n");
+
+    tritbig_set_int64(&x, -1);
+    bool fits = tritbig_to_binary(&x, buf_b, 3);
+    test_assert(!fits && buf_b[0] == UINT64_MAX && buf_b[1] == UINT64_MAX && buf_b[2] == UINT64_MAX,
+                "-1 → all ones, reports not fitting");
+
+    fill(buf_a, 300, 0, &seed);
+    tritbig_from_binary(&x, buf_a, 300);
+    tritbig_neg(&x, &x);
+    tritbig_to_binary(&x, buf_b, 300);
+    uint64_t carry = 1;
+    int neg_ok = 1;
+    for (size_t i = 0; i < 300; i++) {
+        uint64_t v = ~buf_b[i] + carry;      // negate back
+        carry = carry && v == 0;
+        if (v != buf_a[i]) neg_ok = 0;
+    }
+    test_assert(neg_ok, "-x (300 limbs) is the two's complement of x");
+
+    uint64_t two64[2] = { 0, 1 };
+    tritbig_from_binary(&x, two64, 2);
+    buf_b[0] = 7;
+    test_assert(!tritbig_to_binary(&x, buf_b, 1) && buf_b[0] == 0, "2^64 into 1 limb: false, low limb 0");
+    tritbig_set_int64(&x, 0);
+    test_assert(tritbig_to_binary(&x, buf_b, 2) && buf_b[0] == 0 && buf_b[1] == 0, "zero → zero limbs");
+
+    tritbig_free(&x);
+    tritbig_free(&y);
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_radix_arrays: trit27 and trit5 array forms
+// ────────────────────────────────────────────────────────────────
+
+int test_radix_arrays(void) {
+    print_header("radix Unit Tests: trit27 / trit5 Arrays");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: Array round trips
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing array conversions:\n");
+
+    static trit27_t words[MAX_LIMBS * 2];
+    static uint8_t bytes[MAX_LIMBS * 9];
+    static uint8_t ref_bytes[MAX_LIMBS * 9];
+    uint64_t seed = 1618u;
+    int w_ok = 1, t5_ok = 1, ref_ok = 1;
+    static const size_t sizes[] = { 1, 5, 24, 40, 100, 700 };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t n = sizes[s];
+        size_t t = TRITBIG_TRITS_FOR_BINARY(n);
+        size_t nw = (t + 26) / 27;
+        fill(buf_a, n, 0, &seed);
+        if (!binary_to_trit27_array(buf_a, n, words, nw) || !trit27_to_binary_array(words, nw, buf_b, n) ||
+            memcmp(buf_a, buf_b, n * sizeof(uint64_t)) != 0) {
+            w_ok = 0;
+        }
+        if (!binary_to_trit5_array(buf_a, n, bytes, t) || !trit5_to_binary_array(bytes, t, buf_c, n) ||
+            memcmp(buf_a, buf_c, n * sizeof(uint64_t)) != 0) {
+            t5_ok = 0;
+        }
+        if (n <= 100) {
+            ref_to_trits(buf_a, n, ref_trits, t);
+            trit5_pack_array(ref_trits, t, ref_bytes);
+            if (memcmp(bytes, ref_bytes, TRIT5_PACKED_SIZE(t)) != 0) ref_ok = 0;
+        }
+    }
+    test_assert(w_ok, "binary → trit27 words → binary");
+    test_assert(t5_ok, "binary → trit5 bytes → binary");
+    test_assert(ref_ok, "trit5 bytes == trit5_pack_array(per-trit reference)");
+
+    uint64_t max2[2] = { UINT64_MAX, UINT64_MAX };
+    test_assert(!binary_to_trit27_array(max2, 2, words, 1), "2^128 - 1 into 1 trit27 word: false");
+    test_assert(!binary_to_trit5_array(max2, 2, bytes, 81), "2^128 - 1 into 81 trits: false (needs 82)");
+    test_assert(binary_to_trit5_array(max2, 2, bytes, 82), "2^128 - 1 into 82 trits: true");
+
+    return tests_failed;
+}
+
+
+// ────────────────────────────────────────────────────────────────
+// test_radix_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_radix_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Binary ↔ Ternary Radix Conversion\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_radix_from_binary();
+    test_radix_to_binary();
+    test_radix_arrays();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_radix_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add sizes around RADIX_TO_*_BASECASE when they are retuned
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = one % 3 pass per trit (the O(n^2) method)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Every one that asketh receiveth." — Matthew 7:8
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,491 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Entropy-Coded Trit Streams
+// Key: B-word-work-pkg-trit-rans-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/rle_test.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for rans.c - designed to FAIL MEANINGFULLY.
+// Every stream must decode to exactly the trits encoded, in about as
+// many bits as their entropy.
+//
+// rans_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "He telleth the number of the stars; he calleth them all by
+//            their names." — Psalm 147:4
+//
+// Principle: However short the name, it must call back the same trit.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH length, skew, input form or stream fault diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check trit_rans_encode / trit5_rans_encode, trit_rans_count
+//          and trit_rans_decode / trit5_rans_decode.
+//
+// Key Features:
+//   - Sizes: empty, constant, uniform (< 1.6 bits/trit), skewed (near
+//     entropy), tiny blocks stored raw
+//   - trit_t and t5b1 encoders write the same stream; both decoders
+//     read it
+//   - Lengths 0-300 and around block edges, several skews, every backend
+//   - Truncated, padded, corrupted and oversized streams
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-rans
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>        // printf
+#include <string.h>       // memcmp, memset
+
+//--- Project Headers ---
+#include "tritrans.h"     // trit_rans_*
+#include "trit.h"         // trit5_pack_array, backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+#define BIG_TRITS  (2 * TRIT_RANS_BLOCK + 3001)   // three blocks, last one short
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_rans_run_all(void);       // Run all tests, return failure count
+int test_rans_sizes(void);         // Compressed sizes
+int test_rans_forms(void);         // trit_t and t5b1 paths agree
+int test_rans_lengths(void);       // Round-trips per length, per backend
+int test_rans_errors(void);        // Malformed streams, capacity
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_rans_run_all()
+//   ├── test_rans_sizes()   → bits per trit vs entropy
+//   ├── test_rans_forms()   → trit_t / t5b1 streams byte-identical
+//   ├── test_rans_lengths() → round_trip() per length, skew, backend
+//   └── test_rans_errors()  → damaged streams
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (data, round-trips)
+// ────────────────────────────────────────────────────────────────
+
+static trit_t trits[BIG_TRITS];
+static trit_t back[BIG_TRITS];
+static uint8_t packed[TRIT5_PACKED_SIZE(BIG_TRITS)];
+static uint8_t packed_back[TRIT5_PACKED_SIZE(BIG_TRITS)];
+static uint8_t enc[TRIT_RANS_BOUND(BIG_TRITS)];
+static uint8_t enc5[TRIT_RANS_BOUND(BIG_TRITS)];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+static uint32_t rng_state = 1u;
+
+static uint32_t rng(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+
+// fill writes n trits that are zero with probability zero_ppm / 10^6,
+// else ±1 with equal odds.
+static void fill(trit_t *t, size_t n, uint32_t zero_ppm) {
+    for (size_t i = 0; i < n; i++) {
+        t[i] = rng() % 1000000u < zero_ppm ? TRIT_ZERO
+             : (rng() & 1) ? TRIT_POS : TRIT_NEG;
+    }
+}
+
+// fill_uniform writes n uniform trits.
+static void fill_uniform(trit_t *t, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        t[i] = (trit_t)((int)(rng() % 3) - 1);
+    }
+}
+
+// round_trip encodes t[0..n) both ways, checks the two streams match and
+// fit the bound, and decodes them both ways. Returns the stream length,
+// or 0 on any mismatch.
+static size_t round_trip(const trit_t *t, size_t n) {
+    trit5_pack_array(t, n, packed);
+    size_t en = trit_rans_encode(t, n, enc);
+    size_t en5 = trit5_rans_encode(packed, n, enc5);
+    if (en != en5 || memcmp(enc, enc5, en) != 0 || en > TRIT_RANS_BOUND(n)) {
+        printf("    n = %zu: streams differ (%zu / %zu bytes)\n", n, en, en5);
+        return 0;
+    }
+    memset(packed_back, 0xEE, TRIT5_PACKED_SIZE(n));
+    if (trit_rans_count(enc, en) != n ||
+        trit_rans_decode(enc, en, back, n) != n || memcmp(back, t, n) != 0 ||
+        trit5_rans_decode(enc, en, packed_back, n) != n ||
+        memcmp(packed_back, packed, TRIT5_PACKED_SIZE(n)) != 0) {
+        printf("    n = %zu: decode differs\n", n);
+        return 0;
+    }
+    return en;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_rans_sizes: Compressed Sizes
+// ────────────────────────────────────────────────────────────────
+
+int test_rans_sizes(void) {
+    print_header("TEST: Stream Sizes");
+    char name[128];
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Empty, constant, tiny
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing edge inputs:\n");
+
+    size_t en = trit_rans_encode(trits, 0, enc);
+    test_assert(en == 8 && trit_rans_count(enc, en) == 0 && trit_rans_decode(enc, en, back, 0) == 0,
+                "0 trits → 8-byte header, decodes to 0 trits");
+
+    memset(trits, 0, BIG_TRITS);
+    en = round_trip(trits, BIG_TRITS);
+    snprintf(name, sizeof(name), "%d zero trits → %zu bytes (states and headers only)",
+             BIG_TRITS, en);
+    test_assert(en > 0 && en <= 8 + 3 * (9 + 32), name);
+
+    static const trit_t tiny[7] = { 1, -1, 0, 0, 1, 1, -1 };
+    en = round_trip(tiny, 7);
+    test_assert(en == 8 + 1 + TRIT5_PACKED_SIZE(7), "7 trits → stored raw (8 + 1 + 2 bytes)");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Bits per trit
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing bits per trit:\n");
+
+    fill_uniform(trits, BIG_TRITS);
+    en = round_trip(trits, BIG_TRITS);
+    double bits = 8.0 * (double)en / BIG_TRITS;
+    snprintf(name, sizeof(name), "uniform: %.4f bits/trit (log2 3 = 1.5850, t5b1 = 1.6)", bits);
+    test_assert(en > 0 && bits > 1.58 && bits < 1.6, name);
+
+    // H(0.95, 0.025, 0.025) = 0.3364
+    fill(trits, BIG_TRITS, 950000);
+    en = round_trip(trits, BIG_TRITS);
+    bits = 8.0 * (double)en / BIG_TRITS;
+    snprintf(name, sizeof(name), "95%% zeros: %.4f bits/trit (entropy 0.3364)", bits);
+    test_assert(en > 0 && bits < 0.3364 + 0.02, name);
+
+    // H(0.999, 0.0005, 0.0005) = 0.0114
+    fill(trits, BIG_TRITS, 999000);
+    en = round_trip(trits, BIG_TRITS);
+    bits = 8.0 * (double)en / BIG_TRITS;
+    snprintf(name, sizeof(name), "99.9%% zeros: %.4f bits/trit (entropy 0.0114)", bits);
+    test_assert(en > 0 && bits < 0.0114 + 0.02, name);
+
+    // Block 1 uniform, block 2 all +1: each block keeps its own model
+    fill_uniform(trits, TRIT_RANS_BLOCK);
+    memset(trits + TRIT_RANS_BLOCK, TRIT_POS, TRIT_RANS_BLOCK);
+    en = round_trip(trits, 2 * TRIT_RANS_BLOCK);
+    snprintf(name, sizeof(name), "uniform block + constant block → %zu bytes (≈ one block)", en);
+    test_assert(en > 0 && en < TRIT5_PACKED_SIZE(TRIT_RANS_BLOCK) + 100, name);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_rans_forms: trit_t and t5b1 Paths Agree
+// ────────────────────────────────────────────────────────────────
+
+int test_rans_forms(void) {
+    print_header("TEST: Input and Output Forms");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Same stream, cross decoding
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing trit_t ↔ t5b1:\n");
+
+    fill(trits, BIG_TRITS, 800000);
+    trit5_pack_array(trits, BIG_TRITS, packed);
+    size_t en = trit_rans_encode(trits, BIG_TRITS, enc);
+    size_t en5 = trit5_rans_encode(packed, BIG_TRITS, enc5);
+    test_assert(en == en5 && memcmp(enc, enc5, en) == 0,
+                "trit_rans_encode = trit5_rans_encode (byte-identical)");
+    test_assert(trit_rans_decode(enc5, en5, back, BIG_TRITS) == BIG_TRITS &&
+                memcmp(back, trits, BIG_TRITS) == 0,
+                "t5b1-encoded stream → trit_t");
+    test_assert(trit5_rans_decode(enc, en, packed_back, BIG_TRITS) == BIG_TRITS &&
+                memcmp(packed_back, packed, TRIT5_PACKED_SIZE(BIG_TRITS)) == 0,
+                "trit_t-encoded stream → t5b1 (= trit5_pack_array)");
+    test_assert(trit_rans_decode(enc, en, back, BIG_TRITS + 100) == BIG_TRITS,
+                "cap larger than the stream: returns the stream's count");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_rans_lengths: Round-Trips per Length and Backend
+// ────────────────────────────────────────────────────────────────
+
+int test_rans_lengths(void) {
+    print_header("TEST: Round-Trips per Backend");
+
+    static const uint32_t skews[] = { 333333, 900000, 999990, 1000000 };
+    static const size_t edges[] = {
+        TRIT_RANS_BLOCK - 1, TRIT_RANS_BLOCK, TRIT_RANS_BLOCK + 1,
+        TRIT_RANS_BLOCK + 5121, BIG_TRITS
+    };
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        char name[96];
+        const char *bn = trit_backend_name(backends[b]);
+        if (!trit_backend_supported(backends[b])) {
+            printf("    (skip %s: not supported on this CPU)\n", bn);
+            continue;
+        }
+        trit_backend_select(backends[b]);
+        printf("\n  Testing %s:\n", bn);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 4: Short lengths at several skews
+        // ════════════════════════════════════════════════════════════════
+        int ok = 1;
+        for (size_t k = 0; k < sizeof(skews) / sizeof(skews[0]) && ok; k++) {
+            fill(trits, 300, skews[k]);
+            for (size_t n = 1; n <= 300 && ok; n++) {
+                ok = round_trip(trits, n) > 0;
+            }
+        }
+        snprintf(name, sizeof(name), "%s: lengths 1-300, 4 skews", bn);
+        test_assert(ok, name);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 5: Block and chunk edges
+        // ════════════════════════════════════════════════════════════════
+        ok = 1;
+        for (size_t k = 0; k < sizeof(skews) / sizeof(skews[0]) && ok; k++) {
+            fill(trits, BIG_TRITS, skews[k]);
+            for (size_t e = 0; e < sizeof(edges) / sizeof(edges[0]) && ok; e++) {
+                ok = round_trip(trits, edges[e]) > 0;
+            }
+        }
+        snprintf(name, sizeof(name), "%s: block edges (%d ± 1, 2 blocks + chunk + 1, 3 blocks)",
+                 bn, TRIT_RANS_BLOCK);
+        test_assert(ok, name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_rans_errors: Malformed Streams and Capacity
+// ────────────────────────────────────────────────────────────────
+
+int test_rans_errors(void) {
+    print_header("TEST: Malformed Streams");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 6: Damage
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing errors:\n");
+
+    fill(trits, BIG_TRITS, 900000);
+    size_t en = trit_rans_encode(trits, BIG_TRITS, enc);
+
+    test_assert(trit_rans_count(enc, 7) == TRIT_RANS_ERROR &&
+                trit_rans_decode(enc, 7, back, BIG_TRITS) == TRIT_RANS_ERROR,
+                "header cut short → error");
+    test_assert(trit_rans_decode(enc, en, back, BIG_TRITS - 1) == TRIT_RANS_ERROR &&
+                trit5_rans_decode(enc, en, packed_back, BIG_TRITS - 1) == TRIT_RANS_ERROR,
+                "cap one trit short → error");
+    test_assert(trit_rans_decode(enc, en - 1, back, BIG_TRITS) == TRIT_RANS_ERROR,
+                "last byte missing → error");
+    enc[en] = 0;
+    test_assert(trit_rans_decode(enc, en + 1, back, BIG_TRITS) == TRIT_RANS_ERROR,
+                "trailing byte → error");
+
+    enc[8] = 7;
+    test_assert(trit_rans_decode(enc, en, back, BIG_TRITS) == TRIT_RANS_ERROR,
+                "unknown block mode → error");
+    enc[8] = 1;
+
+    uint8_t f0 = enc[9], f1 = enc[10];
+    enc[9] = 0xFF;
+    enc[10] = 0x0F;
+    test_assert(trit_rans_decode(enc, en, back, BIG_TRITS) == TRIT_RANS_ERROR,
+                "f(-1) + f(+1) > 4096 → error");
+    enc[9] = f0;
+    enc[10] = f1;
+
+    enc[100] ^= 0x5A;
+    test_assert(trit_rans_decode(enc, en, back, BIG_TRITS) == TRIT_RANS_ERROR,
+                "flipped payload byte → states do not close → error");
+    enc[100] ^= 0x5A;
+    test_assert(trit_rans_decode(enc, en, back, BIG_TRITS) == BIG_TRITS &&
+                memcmp(back, trits, BIG_TRITS) == 0,
+                "repaired stream decodes again");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_rans_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_rans_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Entropy-Coded Trit Streams\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_rans_sizes();
+    test_rans_forms();
+    test_rans_lengths();
+    test_rans_errors();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_rans_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ More skews and edge lengths in TEST GROUPs 4-5
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Size limits in TEST GROUP 2 (they pin the coder's efficiency)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "He telleth the number of the stars; he calleth them all by their
+// names." — Psalm 147:4
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,426 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Sum, Histogram and Balance Reductions
+// Key: B-word-work-pkg-trit-reduce-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/array_test.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for reduce.c - designed to FAIL MEANINGFULLY.
+// Every reduction must equal the buffer unpacked and walked trit by trit.
+//
+// reduce_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "A false balance is abomination to the LORD: but a just
+//            weight is his delight." — Proverbs 11:1
+//
+// Principle: A shortcut in the counting must never show in the count.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH reduction, backend or length diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check sums, counts and balance extremes of trit_t arrays and
+//          t5b1 buffers, and trit_stats_merge.
+//
+// Key Features:
+//   - Hand-checked sequences, empty input, merge identity
+//   - Every backend; lengths 0-400 (vector body, tails, short final byte)
+//   - Long walks whose extremes spread apart, so runs are skipped
+//   - Buffers split at random points and merged back
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-reduce
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>        // printf
+
+//--- Project Headers ---
+#include "tritreduce.h"   // reductions
+#include "trit.h"         // trit5_pack_array, backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+#define BIG_TRITS  300007     // long walk; not a multiple of 5
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_reduce_run_all(void);     // Run all tests, return failure count
+int test_reduce_fixed(void);       // Hand-checked values and merge
+int test_reduce_backends(void);    // Every backend vs the reference
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_reduce_run_all()
+//   ├── test_reduce_fixed()    → known sequences, empty input, merge laws
+//   └── test_reduce_backends() → check_all() per length, per backend;
+//                                split-and-merge
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (data, reference walk, comparison)
+// ────────────────────────────────────────────────────────────────
+
+static trit_t trits[BIG_TRITS];
+static uint8_t packed[TRIT5_PACKED_SIZE(BIG_TRITS)];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+static uint32_t rng_state = 1u;
+
+static uint32_t rng(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+
+// fill_walk writes a sequence that first swings to -1000 and +1000 and
+// then wanders: once the extremes are that far apart, long runs can be
+// skipped. Runs of one value and of zeros keep every counter lane busy.
+static void fill_walk(void) {
+    for (size_t i = 0; i < BIG_TRITS; i++) {
+        trit_t t;
+        if (i < 1000) {
+            t = TRIT_NEG;
+        } else if (i < 3000) {
+            t = TRIT_POS;
+        } else if (i < 4000) {
+            t = TRIT_NEG;
+        } else if ((i / 5000) % 7 == 3) {
+            t = TRIT_ZERO;
+        } else {
+            t = (trit_t)((int)(rng() % 3) - 1);
+        }
+        trits[i] = t;
+    }
+    trit5_pack_array(trits, BIG_TRITS, packed);
+}
+
+// reference walks t[0..n-1] one trit at a time.
+static trit_stats_t reference(const trit_t *t, size_t n) {
+    trit_stats_t s = { 0, { 0, 0, 0 }, 0, 0 };
+    for (size_t i = 0; i < n; i++) {
+        s.sum += t[i];
+        s.count[TRIT_TO_UNSIGNED(t[i])]++;
+        s.min_prefix = s.sum < s.min_prefix ? s.sum : s.min_prefix;
+        s.max_prefix = s.sum > s.max_prefix ? s.sum : s.max_prefix;
+    }
+    return s;
+}
+
+static int stats_equal(trit_stats_t a, trit_stats_t b) {
+    return a.sum == b.sum && a.count[0] == b.count[0] && a.count[1] == b.count[1] &&
+           a.count[2] == b.count[2] && a.min_prefix == b.min_prefix &&
+           a.max_prefix == b.max_prefix;
+}
+
+// check_all compares every reduction of trits[off..off+n) with the
+// reference; the packed forms read the same trits from a buffer packed
+// at off (a multiple of 5). Prints the first mismatch.
+static int check_all(size_t off, size_t n, const char *what) {
+    trit_stats_t want = reference(trits + off, n);
+    const uint8_t *p = packed + off / 5;
+    uint64_t c[3];
+    uint64_t c5[3];
+    trit_count_array(trits + off, n, c);
+    trit5_count_array(p, n, c5);
+    int ok = stats_equal(trit_stats_array(trits + off, n), want) &&
+             stats_equal(trit5_stats_array(p, n), want) &&
+             trit_sum_array(trits + off, n) == want.sum &&
+             trit5_sum_array(p, n) == want.sum;
+    for (int k = 0; k < 3; k++) {
+        ok = ok && c[k] == want.count[k] && c5[k] == want.count[k];
+    }
+    if (!ok) {
+        printf("    %s: mismatch at offset %zu, n = %zu\n", what, off, n);
+    }
+    return ok;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_reduce_fixed: Hand-Checked Values and Merge Laws
+// ────────────────────────────────────────────────────────────────
+
+int test_reduce_fixed(void) {
+    print_header("TEST: Known Sequences and Merge");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Known sequences
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing hand-checked sequences:\n");
+
+    trit_stats_t e = trit_stats_array(trits, 0);
+    test_assert(stats_equal(e, trit5_stats_array(packed, 0)) && e.sum == 0 &&
+                e.count[0] + e.count[1] + e.count[2] == 0 &&
+                e.min_prefix == 0 && e.max_prefix == 0,
+                "empty input: all zero (the empty prefix only)");
+
+    // + + - - - 0 + : balance 1 2 1 0 -1 -1 0
+    static const trit_t seq[7] = { 1, 1, -1, -1, -1, 0, 1 };
+    uint8_t seq5[TRIT5_PACKED_SIZE(7)];
+    trit5_pack_array(seq, 7, seq5);
+    trit_stats_t s = trit_stats_array(seq, 7);
+    test_assert(s.sum == 0 && s.count[0] == 3 && s.count[1] == 1 && s.count[2] == 3 &&
+                s.min_prefix == -1 && s.max_prefix == 2,
+                "+ + - - - 0 +: sum 0, counts 3/1/3, balance -1..2");
+    test_assert(stats_equal(trit5_stats_array(seq5, 7), s),
+                "same from t5b1 (one full byte + 2 trits)");
+
+    // The padding of a short byte is zeros; it must not count as zeros.
+    uint64_t c[3];
+    trit5_count_array(seq5, 6, c);
+    test_assert(c[0] == 3 && c[1] == 1 && c[2] == 2 && trit5_sum_array(seq5, 6) == -1,
+                "short final byte: padding trits not counted");
+
+    static const trit_t down[5] = { -1, -1, -1, -1, -1 };
+    trit_stats_t d = trit_stats_array(down, 5);
+    test_assert(d.sum == -5 && d.min_prefix == -5 && d.max_prefix == 0,
+                "all -1: min -5, max stays at the empty prefix");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Merge
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing trit_stats_merge:\n");
+
+    trit_stats_t ab = trit_stats_merge(trit_stats_array(seq, 3), trit_stats_array(seq + 3, 4));
+    test_assert(stats_equal(ab, s), "stats(+ + -) · stats(- - 0 +) = stats(whole)");
+    test_assert(stats_equal(trit_stats_merge(e, s), s) && stats_equal(trit_stats_merge(s, e), s),
+                "empty stats are the identity on both sides");
+
+    trit_stats_t x = trit_stats_array(seq, 2);
+    trit_stats_t y = trit_stats_array(seq + 2, 3);
+    trit_stats_t z = trit_stats_array(seq + 5, 2);
+    test_assert(stats_equal(trit_stats_merge(trit_stats_merge(x, y), z),
+                            trit_stats_merge(x, trit_stats_merge(y, z))),
+                "merge is associative");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_reduce_backends: Every Backend vs the Reference
+// ────────────────────────────────────────────────────────────────
+
+int test_reduce_backends(void) {
+    print_header("TEST: Reductions per Backend");
+
+    fill_walk();
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        char name[96];
+        const char *bn = trit_backend_name(backends[b]);
+        if (!trit_backend_supported(backends[b])) {
+            printf("    (skip %s: not supported on this CPU)\n", bn);
+            continue;
+        }
+        trit_backend_select(backends[b]);
+        printf("\n  Testing %s:\n", bn);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 3: All short lengths, at the start and mid-walk
+        // ════════════════════════════════════════════════════════════════
+        int ok = 1;
+        for (size_t n = 0; n <= 400 && ok; n++) {
+            ok = check_all(0, n, bn) && check_all(5000, n, bn) && check_all(20005, n, bn);
+        }
+        snprintf(name, sizeof(name), "%s: lengths 0-400 at three offsets", bn);
+        test_assert(ok, name);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 4: Long walks (runs skipped once extremes spread)
+        // ════════════════════════════════════════════════════════════════
+        ok = check_all(0, BIG_TRITS, bn) && check_all(0, BIG_TRITS - 3, bn) &&
+             check_all(4000, BIG_TRITS - 4000, bn) && check_all(0, 3000, bn);
+        snprintf(name, sizeof(name), "%s: %d-trit walk and sub-walks", bn, BIG_TRITS);
+        test_assert(ok, name);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 5: Split at random points, merged back
+        // ════════════════════════════════════════════════════════════════
+        trit_stats_t want = reference(trits, BIG_TRITS);
+        rng_state = 7u;
+        trit_stats_t acc = trit_stats_array(trits, 0);
+        trit_stats_t acc5 = acc;
+        size_t at = 0;
+        while (at < BIG_TRITS) {
+            size_t len = 5 * (size_t)(rng() % 4000);
+            if (len > BIG_TRITS - at) {
+                len = BIG_TRITS - at;
+            }
+            acc = trit_stats_merge(acc, trit_stats_array(trits + at, len));
+            acc5 = trit_stats_merge(acc5, trit5_stats_array(packed + at / 5, len));
+            at += len;
+        }
+        snprintf(name, sizeof(name), "%s: pieces merged in order = whole buffer", bn);
+        test_assert(stats_equal(acc, want) && stats_equal(acc5, want), name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_reduce_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_reduce_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Sum, Histogram and Balance Reductions\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_reduce_fixed();
+    test_reduce_backends();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_reduce_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ More offsets in TEST GROUP 3, other walk shapes in fill_walk
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = the trits walked one at a time, never a library kernel
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "A just weight is his delight." — Proverbs 11:1
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
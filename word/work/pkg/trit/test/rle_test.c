@@ -0,0 +1,531 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Run-Length Streams
+// Key: B-word-work-pkg-trit-rle-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/scan_test.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for rle.c - designed to FAIL MEANINGFULLY.
+// Every stream must decode to exactly the bytes that were encoded.
+//
+// rle_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Gather up the fragments that remain, that nothing be
+//            lost." — John 6:12
+//
+// Principle: What is folded must unfold to the same bytes, every one.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH token, escape, backend or boundary diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check trit5_rle_encode, trit5_rle_decoded_size and
+//          trit5_rle_decode.
+//
+// Key Features:
+//   - Exact token bytes at every run-length edge (2/3, 3/4, 257/258)
+//   - Plain t5b1 encodes and decodes to itself
+//   - Escape and other spare bytes in the input round-trip
+//   - Custom, single and disabled escapes
+//   - Truncated tokens and output capacity
+//   - Every backend produces the scalar stream, across window edges
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-rle
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>        // printf
+#include <string.h>       // memcmp, memset
+
+//--- Project Headers ---
+#include "tritrle.h"      // trit5_rle_*
+#include "trit.h"         // trit5_pack_array, backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+#define BIG_BYTES  40009      // spans several scan windows; odd length
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_rle_run_all(void);        // Run all tests, return failure count
+int test_rle_tokens(void);         // Exact encodings
+int test_rle_codecs(void);         // Custom and disabled escapes
+int test_rle_errors(void);         // Malformed streams, capacity
+int test_rle_backends(void);       // Every backend vs scalar
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_rle_run_all()
+//   ├── test_rle_tokens()   → encodes_to() per hand-written case
+//   ├── test_rle_codecs()   → round-trips under other escapes
+//   ├── test_rle_errors()   → truncation, cap
+//   └── test_rle_backends() → round_trip() per length, per backend
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (data, round-trips, comparison)
+// ────────────────────────────────────────────────────────────────
+
+static uint8_t data[BIG_BYTES];
+static uint8_t enc[2 * BIG_BYTES];
+static uint8_t ref[2 * BIG_BYTES];
+static uint8_t dec[BIG_BYTES + 1];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+static uint32_t rng_state = 1u;
+
+static uint32_t rng(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+
+// fill_data writes segments of random t5b1 bytes, runs of 121, runs of
+// other bytes and spare states, each 1-600 bytes long, so runs of every
+// length land on every window edge.
+static void fill_data(void) {
+    size_t i = 0;
+    while (i < BIG_BYTES) {
+        uint32_t span = rng() % 4 == 0 ? 600 : 12;
+        size_t len = 1 + rng() % span;
+        uint32_t kind = rng() % 4;
+        uint8_t v = kind == 1 ? TRIT5_BIAS
+                  : kind == 2 ? (uint8_t)(rng() % 243)
+                  : (uint8_t)(243 + rng() % 13);
+        for (size_t k = 0; k < len && i < BIG_BYTES; k++, i++) {
+            data[i] = kind == 0 ? (uint8_t)(rng() % 243) : v;
+        }
+    }
+}
+
+// encodes_to checks that in encodes to want and decodes back to in.
+static int encodes_to(const uint8_t *in, size_t n, const uint8_t *want, size_t wn,
+                      const trit5_rle_t *codec) {
+    size_t en = trit5_rle_encode(in, n, enc, codec);
+    if (en != wn || memcmp(enc, want, wn) != 0) {
+        printf("    encoded %zu bytes, want %zu\n", en, wn);
+        return 0;
+    }
+    return trit5_rle_decoded_size(enc, en, codec) == n &&
+           trit5_rle_decode(enc, en, dec, n, codec) == n && memcmp(dec, in, n) == 0;
+}
+
+// round_trip encodes n bytes at in within TRIT5_RLE_BOUND(n) and decodes
+// them back; *en_out (if given) receives the stream length.
+static int round_trip(const uint8_t *in, size_t n, const trit5_rle_t *codec, size_t *en_out) {
+    size_t en = trit5_rle_encode(in, n, enc, codec);
+    size_t dn = trit5_rle_decode(enc, en, dec, n, codec);
+    if (en_out) {
+        *en_out = en;
+    }
+    return en <= TRIT5_RLE_BOUND(n) && dn == n && memcmp(dec, in, n) == 0;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_rle_tokens: Exact Encodings
+// ────────────────────────────────────────────────────────────────
+
+int test_rle_tokens(void) {
+    print_header("TEST: Token Encodings (default escapes 255 / 254)");
+
+    uint8_t in[600] = { 0 };
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Plain t5b1
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing plain t5b1 pass-through:\n");
+
+    test_assert(trit5_rle_encode(in, 0, enc, NULL) == 0 &&
+                trit5_rle_decode(enc, 0, dec, 0, NULL) == 0,
+                "empty input → empty stream → empty output");
+
+    for (size_t i = 0; i < 243; i++) {
+        in[i] = (uint8_t)((i * 7) % 243);
+    }
+    test_assert(encodes_to(in, 243, in, 243, NULL),
+                "all 243 values, no repeats: stream = input");
+
+    trit_t trits[1000];
+    for (size_t i = 0; i < 1000; i++) {
+        trits[i] = (trit_t)((int)(rng() % 3) - 1);
+    }
+    trit5_pack_array(trits, 1000, in);
+    test_assert(encodes_to(in, 200, in, 200, NULL),
+                "random packed trits: stream = input");
+    test_assert(trit5_rle_decode(in, 200, dec, 200, NULL) == 200 && memcmp(dec, in, 200) == 0,
+                "plain t5b1 decodes to itself");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Zero runs (Z L)
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing runs of 121:\n");
+
+    memset(in, TRIT5_BIAS, sizeof(in));
+    static const uint8_t z2[] = { 121, 121 };
+    static const uint8_t z3[] = { 255, 1 };
+    static const uint8_t z10[] = { 255, 8 };
+    static const uint8_t z257[] = { 255, 255 };
+    static const uint8_t z258[] = { 255, 255, 121 };
+    static const uint8_t z260[] = { 255, 255, 255, 1 };
+    test_assert(encodes_to(in, 2, z2, 2, NULL), "121 × 2 → literal 121 121");
+    test_assert(encodes_to(in, 3, z3, 2, NULL), "121 × 3 → Z 1");
+    test_assert(encodes_to(in, 10, z10, 2, NULL), "121 × 10 → Z 8");
+    test_assert(encodes_to(in, 257, z257, 2, NULL), "121 × 257 → Z 255 (longest token)");
+    test_assert(encodes_to(in, 258, z258, 3, NULL), "121 × 258 → Z 255, 121");
+    test_assert(encodes_to(in, 260, z260, 4, NULL), "121 × 260 → Z 255, Z 1");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Other runs (R L V)
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing runs of other bytes:\n");
+
+    memset(in, 7, sizeof(in));
+    static const uint8_t r3[] = { 7, 7, 7 };
+    static const uint8_t r4[] = { 254, 1, 7 };
+    static const uint8_t r258[] = { 254, 255, 7 };
+    static const uint8_t r261[] = { 254, 255, 7, 7, 7, 7 };
+    static const uint8_t r262[] = { 254, 255, 7, 254, 1, 7 };
+    test_assert(encodes_to(in, 3, r3, 3, NULL), "7 × 3 → literal 7 7 7");
+    test_assert(encodes_to(in, 4, r4, 3, NULL), "7 × 4 → R 1 7");
+    test_assert(encodes_to(in, 258, r258, 3, NULL), "7 × 258 → R 255 7 (longest token)");
+    test_assert(encodes_to(in, 261, r261, 6, NULL), "7 × 261 → R 255 7, 7 7 7");
+    test_assert(encodes_to(in, 262, r262, 6, NULL), "7 × 262 → R 255 7, R 1 7");
+
+    static const uint8_t mix[] = { 5, 121, 121, 121, 121, 9, 9, 9, 9, 9, 3 };
+    static const uint8_t mix_enc[] = { 5, 255, 2, 254, 2, 9, 3 };
+    test_assert(encodes_to(mix, 11, mix_enc, 7, NULL), "5, 121 × 4, 9 × 5, 3 → 5 Z 2 R 2 9 3");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: Spare bytes in the input
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing spare states in the input:\n");
+
+    static const uint8_t e1[] = { 255 };
+    static const uint8_t e1_enc[] = { 255, 0 };
+    static const uint8_t e2[] = { 254, 254, 121 };
+    static const uint8_t e2_enc[] = { 254, 0, 254, 0, 121 };
+    static const uint8_t e5[] = { 255, 255, 255, 255, 255 };
+    static const uint8_t e5_enc[] = { 254, 2, 255 };
+    static const uint8_t rail[] = { 243, 244, 250, 253 };
+    test_assert(encodes_to(e1, 1, e1_enc, 2, NULL), "255 → Z 0 (escaped literal)");
+    test_assert(encodes_to(e2, 3, e2_enc, 5, NULL), "254 254 121 → R 0, R 0, 121");
+    test_assert(encodes_to(e5, 5, e5_enc, 3, NULL), "255 × 5 → R 2 255");
+    test_assert(encodes_to(rail, 4, rail, 4, NULL), "other rail bytes (243-253) pass through");
+
+    for (size_t i = 0; i < 256; i++) {
+        in[i] = (uint8_t)i;
+    }
+    size_t en = 0;
+    test_assert(round_trip(in, 256, NULL, &en) && en == 258, "all 256 byte values: 258 bytes");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_rle_codecs: Custom and Disabled Escapes
+// ────────────────────────────────────────────────────────────────
+
+int test_rle_codecs(void) {
+    print_header("TEST: Escape Choice");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: Other escape pairs
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing trit5_rle_t:\n");
+
+    static const uint8_t in[] = { 121, 121, 121, 121, 255, 243, 8, 8, 8, 8, 8 };
+    const trit5_rle_t low = { 243, 244 };
+    static const uint8_t low_enc[] = { 243, 2, 255, 243, 0, 244, 2, 8 };
+    test_assert(encodes_to(in, 11, low_enc, 8, &low), "escapes 243 / 244: 255 is a plain byte");
+
+    const trit5_rle_t off = { 0, 121 };
+    test_assert(encodes_to(in, 11, in, 11, &off), "no spare escapes: stream = input");
+    test_assert(trit5_rle_decode(in, 11, dec, 10, &off) == TRIT5_RLE_ERROR,
+                "no spare escapes: cap still checked");
+
+    const trit5_rle_t zero_only = { 250, 0 };
+    static const uint8_t z_enc[] = { 250, 2, 255, 243, 8, 8, 8, 8, 8 };
+    test_assert(encodes_to(in, 11, z_enc, 9, &zero_only), "zero escape only: other runs literal");
+
+    const trit5_rle_t run_only = { 0, 250 };
+    static const uint8_t r_enc[] = { 250, 1, 121, 255, 243, 250, 2, 8 };
+    test_assert(encodes_to(in, 11, r_enc, 8, &run_only), "run escape only: 121 runs use R");
+
+    const trit5_rle_t same = { 250, 250 };
+    test_assert(encodes_to(in, 11, z_enc, 9, &same), "equal escapes: R disabled");
+
+    const trit5_rle_t dflt = { TRIT5_RLE_ZERO_ESCAPE, TRIT5_RLE_RUN_ESCAPE };
+    size_t a = trit5_rle_encode(in, 11, enc, NULL);
+    size_t b = trit5_rle_encode(in, 11, ref, &dflt);
+    test_assert(a == b && memcmp(enc, ref, a) == 0, "NULL codec = the default escapes");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_rle_errors: Malformed Streams and Capacity
+// ────────────────────────────────────────────────────────────────
+
+int test_rle_errors(void) {
+    print_header("TEST: Malformed Streams");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 6: Truncated tokens, capacity
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing errors:\n");
+
+    static const uint8_t cut_z[] = { 3, 255 };
+    static const uint8_t cut_r[] = { 3, 254, 5 };
+    static const uint8_t ok_r[] = { 3, 254, 5, 9 };
+    test_assert(trit5_rle_decode(cut_z, 2, dec, 100, NULL) == TRIT5_RLE_ERROR &&
+                trit5_rle_decoded_size(cut_z, 2, NULL) == TRIT5_RLE_ERROR,
+                "escape as the last byte → error");
+    test_assert(trit5_rle_decode(cut_r, 3, dec, 100, NULL) == TRIT5_RLE_ERROR &&
+                trit5_rle_decoded_size(cut_r, 3, NULL) == TRIT5_RLE_ERROR,
+                "R token missing its value → error");
+    test_assert(trit5_rle_decoded_size(ok_r, 4, NULL) == 9, "3, R 5 9 → 9 bytes");
+
+    memset(dec, 0xAA, 16);
+    test_assert(trit5_rle_decode(ok_r, 4, dec, 8, NULL) == TRIT5_RLE_ERROR && dec[8] == 0xAA,
+                "cap 8 < 9 → error, nothing past cap written");
+    test_assert(trit5_rle_decode(ok_r, 4, dec, 9, NULL) == 9 && dec[0] == 3 && dec[8] == 9,
+                "cap 9 = exact fit");
+    test_assert(trit5_rle_decode(ok_r, 1, dec, 0, NULL) == TRIT5_RLE_ERROR,
+                "literal past cap 0 → error");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_rle_backends: Every Backend vs Scalar
+// ────────────────────────────────────────────────────────────────
+
+int test_rle_backends(void) {
+    print_header("TEST: Streams per Backend");
+
+    fill_data();
+    trit_backend_select(TRIT_BACKEND_SCALAR);
+    size_t ref_n = trit5_rle_encode(data, BIG_BYTES, ref, NULL);
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        char name[96];
+        const char *bn = trit_backend_name(backends[b]);
+        if (!trit_backend_supported(backends[b])) {
+            printf("    (skip %s: not supported on this CPU)\n", bn);
+            continue;
+        }
+        trit_backend_select(backends[b]);
+        printf("\n  Testing %s:\n", bn);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 7: Short lengths at several offsets
+        // ════════════════════════════════════════════════════════════════
+        int ok = 1;
+        for (size_t off = 0; off < 4000 && ok; off += 397) {
+            for (size_t n = 0; n <= 300 && ok; n++) {
+                ok = round_trip(data + off, n, NULL, NULL);
+                if (!ok) {
+                    printf("    mismatch at offset %zu, n = %zu\n", off, n);
+                }
+            }
+        }
+        snprintf(name, sizeof(name), "%s: lengths 0-300 round-trip", bn);
+        test_assert(ok, name);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 8: Long mixed buffer, every window edge
+        // ════════════════════════════════════════════════════════════════
+        size_t en = trit5_rle_encode(data, BIG_BYTES, enc, NULL);
+        snprintf(name, sizeof(name), "%s: %d bytes → %zu, same stream as scalar",
+                 bn, BIG_BYTES, en);
+        test_assert(en == ref_n && memcmp(enc, ref, en) == 0, name);
+
+        size_t dn = trit5_rle_decode(enc, en, dec, BIG_BYTES, NULL);
+        snprintf(name, sizeof(name), "%s: decodes to the input", bn);
+        test_assert(dn == BIG_BYTES && memcmp(dec, data, BIG_BYTES) == 0, name);
+
+        const trit5_rle_t low = { 243, 244 };
+        snprintf(name, sizeof(name), "%s: escapes 243 / 244 round-trip", bn);
+        test_assert(round_trip(data, BIG_BYTES, &low, NULL), name);
+
+        memset(dec, TRIT5_BIAS, BIG_BYTES);
+        en = trit5_rle_encode(dec, BIG_BYTES, enc, NULL);
+        snprintf(name, sizeof(name), "%s: %d zero groups → %zu bytes", bn, BIG_BYTES, en);
+        test_assert(en == 2 * ((BIG_BYTES + 256) / 257) && round_trip(dec, BIG_BYTES, NULL, NULL),
+                    name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_rle_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_rle_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Run-Length Streams\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_rle_tokens();
+    test_rle_codecs();
+    test_rle_errors();
+    test_rle_backends();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_rle_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ More segment kinds in fill_data, other offsets in TEST GROUP 7
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Token bytes in TEST GROUPs 2-5 (they pin the stream format)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Gather up the fragments that remain, that nothing be lost."
+// — John 6:12
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
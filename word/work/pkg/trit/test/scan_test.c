@@ -0,0 +1,530 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Prefix Sums and Navigation Scans
+// Key: B-word-work-pkg-trit-scan-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/reduce_test.c (structure)
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Carry Propagation]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for scan.c - designed to FAIL MEANINGFULLY.
+// Every scan must equal the serial fold, one trit at a time.
+//
+// scan_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Line upon line, line upon line; here a little, and there a
+//            little." — Isaiah 28:10
+//
+// Principle: However the steps are grouped, every line must land where
+//            the steps taken one by one would have put it.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH scan, backend, length or carry diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check inclusive / exclusive prefix sums (int32, int64),
+//          trit_navigate_scan / trit_navigate_map, and their _mt forms.
+//
+// Key Features:
+//   - Hand-checked sequences, empty input, int32 wrap
+//   - Every backend; lengths 0-300 (vector body and tails); every start
+//   - In-place navigation scan
+//   - Blocked two-pass scan at random block sizes = the whole scan
+//   - _mt scans at 0-64 threads = the single-threaded scans
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-scan
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>        // printf
+#include <string.h>       // memcpy
+
+//--- Project Headers ---
+#include "tritscan.h"     // prefix sums
+#include "tritreduce.h"   // trit_sum_array
+#include "trit.h"         // backends
+#include "dimension.h"    // trit_navigate, trit_navigate_scan / _map
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+#define BIG_TRITS  300007     // long sequence; not a multiple of 16, and
+                                // long enough for four _mt blocks
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_scan_run_all(void);       // Run all tests, return failure count
+int test_scan_fixed(void);         // Hand-checked values
+int test_scan_backends(void);      // Every backend vs the serial fold
+int test_scan_threads(void);       // _mt scans vs one thread
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_scan_run_all()
+//   ├── test_scan_fixed()    → known sequences, empty input, wrap
+//   └── test_scan_backends() → check_all() per length, per backend;
+//                              blocked two-pass scans
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (data, serial folds, comparison)
+// ────────────────────────────────────────────────────────────────
+
+static trit_t trits[BIG_TRITS];
+static trit_t nav_want[BIG_TRITS];
+static trit_t nav_got[BIG_TRITS];
+static int32_t sum32_want[BIG_TRITS];
+static int32_t sum32_got[BIG_TRITS];
+static int64_t sum64_want[BIG_TRITS];
+static int64_t sum64_got[BIG_TRITS];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+static uint32_t rng_state = 1u;
+
+static uint32_t rng(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+
+// fill_trits writes random trits with runs of one value mixed in, so
+// positions sit at both clamps for a while and sums drift.
+static void fill_trits(void) {
+    for (size_t i = 0; i < BIG_TRITS; i++) {
+        uint32_t phase = (uint32_t)(i / 700) % 5;
+        trits[i] = phase == 1 ? TRIT_POS
+                 : phase == 3 ? TRIT_NEG
+                 : (trit_t)((int)(rng() % 3) - 1);
+    }
+}
+
+// nav_serial folds trit_navigate one direction at a time.
+static trit_t nav_serial(const trit_t *d, size_t n, trit_t s, trit_t *out) {
+    for (size_t i = 0; i < n; i++) {
+        s = trit_navigate(s, (direction_t)d[i]);
+        out[i] = s;
+    }
+    return s;
+}
+
+// check_all compares every scan of trits[off..off+n) with the serial
+// folds, from carry and start. Prints the first mismatch.
+static int check_all(size_t off, size_t n, int64_t carry, trit_t start, const char *what) {
+    const trit_t *in = trits + off;
+    int ok = 1;
+
+    // Inclusive, then exclusive (out[i] = the inclusive value one back)
+    for (int excl = 0; excl <= 1 && ok; excl++) {
+        int64_t acc = carry;
+        for (size_t i = 0; i < n; i++) {
+            sum64_want[i] = excl ? acc : acc + in[i];
+            sum32_want[i] = (int32_t)sum64_want[i];
+            acc += in[i];
+        }
+        int32_t c32 = excl ? trit_prefix_sum_excl_i32(in, n, (int32_t)carry, sum32_got)
+                           : trit_prefix_sum_i32(in, n, (int32_t)carry, sum32_got);
+        int64_t c64 = excl ? trit_prefix_sum_excl_i64(in, n, carry, sum64_got)
+                           : trit_prefix_sum_i64(in, n, carry, sum64_got);
+        ok = c64 == acc && c32 == (int32_t)acc &&
+             memcmp(sum32_got, sum32_want, n * sizeof(int32_t)) == 0 &&
+             memcmp(sum64_got, sum64_want, n * sizeof(int64_t)) == 0;
+    }
+
+    trit_t end = nav_serial(in, n, start, nav_want);
+    ok = ok && trit_navigate_scan(in, n, start, nav_got) == end &&
+         memcmp(nav_got, nav_want, n) == 0;
+
+    trit_t map[3];
+    trit_navigate_map(in, n, map);
+    for (int s = -1; s <= 1 && ok; s++) {
+        ok = map[TRIT_TO_UNSIGNED(s)] == nav_serial(in, n, (trit_t)s, nav_want);
+    }
+    if (!ok) {
+        printf("    %s: mismatch at offset %zu, n = %zu, carry %lld, start %d\n",
+               what, off, n, (long long)carry, start);
+    }
+    return ok;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_scan_fixed: Hand-Checked Values
+// ────────────────────────────────────────────────────────────────
+
+int test_scan_fixed(void) {
+    print_header("TEST: Known Sequences");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Prefix sums
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing prefix sums:\n");
+
+    // + + - - - 0 + : inclusive 1 2 1 0 -1 -1 0
+    static const trit_t seq[7] = { 1, 1, -1, -1, -1, 0, 1 };
+    int32_t s32[7];
+    int64_t s64[7];
+    int32_t c32 = trit_prefix_sum_i32(seq, 7, 0, s32);
+    test_assert(c32 == 0 && s32[0] == 1 && s32[1] == 2 && s32[4] == -1 && s32[6] == 0,
+                "+ + - - - 0 +: inclusive 1 2 1 0 -1 -1 0");
+    int64_t c64 = trit_prefix_sum_excl_i64(seq, 7, 10, s64);
+    test_assert(c64 == 10 && s64[0] == 10 && s64[1] == 11 && s64[5] == 9 && s64[6] == 9,
+                "exclusive from carry 10: 10 11 12 11 10 9 9");
+    test_assert(trit_prefix_sum_i32(seq, 0, 42, s32) == 42 &&
+                trit_prefix_sum_excl_i64(seq, 0, -7, s64) == -7,
+                "empty input returns the carry");
+
+    static const trit_t ups[3] = { 1, 1, 1 };
+    c32 = trit_prefix_sum_i32(ups, 3, INT32_MAX - 1, s32);
+    test_assert(s32[0] == INT32_MAX && s32[1] == INT32_MIN && c32 == INT32_MIN + 1,
+                "int32 wraps modulo 2^32 past INT32_MAX");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Navigation
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing trit_navigate_scan / trit_navigate_map:\n");
+
+    // From 0: 1 1 0 -1 -1 -1 0 (clamped at +1 then -1)
+    trit_t nav[7];
+    trit_t end = trit_navigate_scan(seq, 7, TRIT_ZERO, nav);
+    test_assert(end == TRIT_ZERO && nav[0] == 1 && nav[1] == 1 && nav[2] == 0 &&
+                nav[3] == -1 && nav[4] == -1 && nav[5] == -1 && nav[6] == 0,
+                "+ + - - - 0 + from 0: 1 1 0 -1 -1 -1 0 (saturated)");
+
+    trit_t map[3];
+    trit_navigate_map(seq, 0, map);
+    test_assert(map[0] == TRIT_NEG && map[1] == TRIT_ZERO && map[2] == TRIT_POS,
+                "empty map is the identity");
+    trit_navigate_map(seq, 7, map);
+    test_assert(map[0] == TRIT_ZERO && map[1] == TRIT_ZERO && map[2] == TRIT_ZERO,
+                "three downs then one up: every start ends at 0");
+
+    trit_t inplace[7];
+    memcpy(inplace, seq, sizeof(inplace));
+    trit_navigate_scan(inplace, 7, TRIT_NEG, inplace);
+    trit_navigate_scan(seq, 7, TRIT_NEG, nav);
+    test_assert(memcmp(inplace, nav, sizeof(nav)) == 0, "out == dirs (in place)");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_scan_backends: Every Backend vs the Serial Fold
+// ────────────────────────────────────────────────────────────────
+
+int test_scan_backends(void) {
+    print_header("TEST: Scans per Backend");
+
+    fill_trits();
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        char name[96];
+        const char *bn = trit_backend_name(backends[b]);
+        if (!trit_backend_supported(backends[b])) {
+            printf("    (skip %s: not supported on this CPU)\n", bn);
+            continue;
+        }
+        trit_backend_select(backends[b]);
+        printf("\n  Testing %s:\n", bn);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 3: All short lengths, every start, several carries
+        // ════════════════════════════════════════════════════════════════
+        int ok = 1;
+        for (size_t n = 0; n <= 300 && ok; n++) {
+            ok = check_all(0, n, 0, TRIT_ZERO, bn) &&
+                 check_all(700, n, -5, TRIT_NEG, bn) &&
+                 check_all(2101, n, 123456789, TRIT_POS, bn);
+        }
+        snprintf(name, sizeof(name), "%s: lengths 0-300, three offsets and starts", bn);
+        test_assert(ok, name);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 4: Long sequences, carries near the int32 edge
+        // ════════════════════════════════════════════════════════════════
+        ok = check_all(0, BIG_TRITS, 0, TRIT_ZERO, bn) &&
+             check_all(3, BIG_TRITS - 3, INT32_MAX - 20, TRIT_POS, bn) &&
+             check_all(1, BIG_TRITS - 1, (int64_t)INT32_MIN + 5, TRIT_NEG, bn) &&
+             check_all(0, BIG_TRITS, (int64_t)1 << 40, TRIT_ZERO, bn);
+        snprintf(name, sizeof(name), "%s: %d-trit scans, carries at the edges", bn, BIG_TRITS);
+        test_assert(ok, name);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 5: Blocked two-pass scan = whole scan
+        // ════════════════════════════════════════════════════════════════
+        // Pass one: sum and map each block; chain them into carries and
+        // starts. Pass two: scan each block from its carry and start.
+        static int64_t carries[BIG_TRITS];
+        static trit_t starts[BIG_TRITS];
+        static size_t bounds[BIG_TRITS + 1];
+        size_t blocks = 0;
+        rng_state = 11u;
+        int64_t acc = -3;
+        trit_t pos = TRIT_POS;
+        for (size_t at = 0; at < BIG_TRITS; blocks++) {
+            size_t len = (size_t)(rng() % 3000);
+            if (len > BIG_TRITS - at) {
+                len = BIG_TRITS - at;
+            }
+            trit_t map[3];
+            bounds[blocks] = at;
+            carries[blocks] = acc;
+            starts[blocks] = pos;
+            acc += trit_sum_array(trits + at, len);
+            trit_navigate_map(trits + at, len, map);
+            pos = map[TRIT_TO_UNSIGNED(pos)];
+            at += len;
+        }
+        bounds[blocks] = BIG_TRITS;
+
+        ok = 1;
+        for (size_t k = 0; k < blocks; k++) {
+            size_t at = bounds[k];
+            size_t len = bounds[k + 1] - at;
+            int64_t c = trit_prefix_sum_i64(trits + at, len, carries[k], sum64_got + at);
+            trit_t e = trit_navigate_scan(trits + at, len, starts[k], nav_got + at);
+            ok = ok && c == (k + 1 < blocks ? carries[k + 1] : acc) &&
+                 e == (k + 1 < blocks ? starts[k + 1] : pos);
+        }
+        int64_t want = -3;
+        trit_t s = TRIT_POS;
+        for (size_t i = 0; i < BIG_TRITS && ok; i++) {
+            want += trits[i];
+            s = trit_navigate(s, (direction_t)trits[i]);
+            ok = sum64_got[i] == want && nav_got[i] == s;
+        }
+        snprintf(name, sizeof(name), "%s: %zu blocks, two passes = one scan", bn, blocks);
+        test_assert(ok, name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_scan_threads: _mt Scans vs One Thread
+// ────────────────────────────────────────────────────────────────
+
+int test_scan_threads(void) {
+    static const unsigned counts[] = { 0, 1, 2, 3, 7, 64 };
+    static const int64_t carries[] = { 0, INT32_MAX - 20, (int64_t)1 << 40 };
+    static int32_t one32[BIG_TRITS];
+    static int64_t one64[BIG_TRITS];
+    static trit_t one_nav[BIG_TRITS];
+
+    print_header("TEST: Threaded Scans");
+
+    fill_trits();
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 6: _mt = one thread, any thread count
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing _mt scans (%d trits, %s):\n", BIG_TRITS,
+           trit_backend_name(trit_backend_active()));
+    for (size_t t = 0; t < sizeof(counts) / sizeof(counts[0]); t++) {
+        unsigned th = counts[t];
+        char name[96];
+        int ok = 1;
+
+        // Offset 1 so blocks start off 16-trit boundaries of the buffer
+        for (size_t c = 0; c < sizeof(carries) / sizeof(carries[0]) && ok; c++) {
+            const trit_t *in = trits + c % 2;
+            size_t n = BIG_TRITS - c % 2;
+            int64_t carry = carries[c];
+            for (int excl = 0; excl <= 1 && ok; excl++) {
+                int32_t w32 = excl ? trit_prefix_sum_excl_i32(in, n, (int32_t)carry, one32)
+                                   : trit_prefix_sum_i32(in, n, (int32_t)carry, one32);
+                int32_t g32 = excl ? trit_prefix_sum_excl_i32_mt(in, n, (int32_t)carry, sum32_got, th)
+                                   : trit_prefix_sum_i32_mt(in, n, (int32_t)carry, sum32_got, th);
+                int64_t w64 = excl ? trit_prefix_sum_excl_i64(in, n, carry, one64)
+                                   : trit_prefix_sum_i64(in, n, carry, one64);
+                int64_t g64 = excl ? trit_prefix_sum_excl_i64_mt(in, n, carry, sum64_got, th)
+                                   : trit_prefix_sum_i64_mt(in, n, carry, sum64_got, th);
+                ok = g32 == w32 && g64 == w64 &&
+                     memcmp(sum32_got, one32, n * sizeof(int32_t)) == 0 &&
+                     memcmp(sum64_got, one64, n * sizeof(int64_t)) == 0;
+            }
+        }
+        snprintf(name, sizeof(name), "%u threads: prefix sums, carries to 2^40", th);
+        test_assert(ok, name);
+
+        ok = 1;
+        for (int s = -1; s <= 1 && ok; s++) {
+            trit_t want = trit_navigate_scan(trits, BIG_TRITS, (trit_t)s, one_nav);
+            trit_t got = trit_navigate_scan_mt(trits, BIG_TRITS, (trit_t)s, nav_got, th);
+            ok = got == want && memcmp(nav_got, one_nav, BIG_TRITS) == 0;
+        }
+        snprintf(name, sizeof(name), "%u threads: navigation, every start", th);
+        test_assert(ok, name);
+    }
+
+    int32_t c32 = trit_prefix_sum_i32_mt(trits, 0, 42, sum32_got, 4);
+    trit_t e = trit_navigate_scan_mt(trits, 0, TRIT_NEG, nav_got, 4);
+    test_assert(c32 == 42 && e == TRIT_NEG, "empty input returns the carry / start");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_scan_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_scan_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Prefix Sums and Navigation Scans\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_scan_fixed();
+    test_scan_backends();
+    test_scan_threads();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_scan_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ More offsets and carries in TEST GROUP 3, other block sizes
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = trit_navigate and + applied one trit at a time
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Line upon line, line upon line." — Isaiah 28:10
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,357 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Vectorized Kernels and Dispatch
+// Key: B-word-work-pkg-trit-simd-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [unpacking]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for simd.c - designed to FAIL MEANINGFULLY.
+// Every backend this CPU supports must decode exactly like trit5_unpack.
+//
+// simd_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: A faster path is only good if it gives the same answer.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH backend diverges from the scalar reference.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Cross-check each supported backend against trit5_unpack.
+//
+// Key Features:
+//   - All 243 states through every kernel
+//   - Every length 0-400 (exercises vector steps + scalar tails)
+//   - Large random buffer (many full vector steps)
+//   - Dispatch API: active/selected/refused backends, names
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-simd
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>   // printf
+#include <string.h>  // strcmp, memset
+
+//--- Project Headers ---
+#include "trit.h"    // trit5 kernels and dispatch
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+#define BIG_GROUPS 4099   // odd size: many vector steps plus a tail
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// Shared buffers
+static uint8_t big_in[BIG_GROUPS];
+static trit_t big_out[5 * BIG_GROUPS];
+static trit_t big_ref[5 * BIG_GROUPS];
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_simd_run_all(void);       // Run all tests, return failure count
+int test_simd_dispatch(void);      // Backend query/select API
+int test_simd_kernels(void);       // Each backend vs trit5_unpack
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+static int check_backend(trit_backend_t backend);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_simd_run_all()
+//   ├── test_simd_dispatch() → trit_backend_* API
+//   └── test_simd_kernels()  → check_backend() per supported backend
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// check_backend decodes states, lengths, and a big buffer with one backend.
+// Returns 1 if everything matched trit5_unpack.
+static int check_backend(trit_backend_t backend) {
+    if (!trit_backend_select(backend)) {
+        return 0;
+    }
+
+    // All 243 states, repeated so vector steps see every state in every lane
+    for (int i = 0; i < BIG_GROUPS; i++) {
+        big_in[i] = (uint8_t)((i * 97) % TRIT5_STATES);
+    }
+
+    // Every length 0-400: vector body + scalar tail boundaries
+    for (size_t groups = 0; groups <= 400; groups++) {
+        memset(big_out, 7, 5 * (groups + 1));
+        trit5_unpack_groups(big_in, groups, big_out);
+        for (size_t g = 0; g < groups; g++) {
+            trit_t ref[5];
+            trit5_unpack(big_in[g], ref);
+            if (memcmp(ref, big_out + 5 * g, 5) != 0) {
+                printf("    %s: length %zu, byte %zu (%u) differs\n",
+                       trit_backend_name(backend), groups, g, big_in[g]);
+                return 0;
+            }
+        }
+        if (big_out[5 * groups] != 7) {
+            printf("    %s: wrote past %zu groups\n", trit_backend_name(backend), groups);
+            return 0;
+        }
+    }
+
+    // Large pseudo-random buffer
+    uint32_t seed = 2025u;
+    for (int i = 0; i < BIG_GROUPS; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        big_in[i] = (uint8_t)((seed >> 20) % TRIT5_STATES);
+        trit5_unpack(big_in[i], big_ref + 5 * i);
+    }
+    trit5_unpack_groups(big_in, BIG_GROUPS, big_out);
+    if (memcmp(big_out, big_ref, sizeof(big_ref)) != 0) {
+        printf("    %s: random buffer differs\n", trit_backend_name(backend));
+        return 0;
+    }
+    return 1;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// test_simd_dispatch: Backend query/select API
+// ────────────────────────────────────────────────────────────────
+
+int test_simd_dispatch(void) {
+    print_header("Dispatch Unit Tests: trit_backend_*");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Load-time resolution
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing load-time resolution:\n");
+
+    trit_backend_t active = trit_backend_active();
+    printf("    active backend: %s\n", trit_backend_name(active));
+    test_assert(active != TRIT_BACKEND_AUTO, "active backend is resolved (not AUTO)");
+    test_assert(trit_backend_supported(active), "active backend is supported on this CPU");
+    test_assert(trit_backend_supported(TRIT_BACKEND_SCALAR), "scalar backend always supported");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Selection and refusal
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing selection:\n");
+
+    test_assert(trit_backend_select(TRIT_BACKEND_SCALAR) &&
+                trit_backend_active() == TRIT_BACKEND_SCALAR,
+                "select(SCALAR) installs scalar");
+    test_assert(!trit_backend_select((trit_backend_t)99) &&
+                trit_backend_active() == TRIT_BACKEND_SCALAR,
+                "select(invalid) refused, current backend kept");
+    test_assert(trit_backend_select(TRIT_BACKEND_AUTO) &&
+                trit_backend_active() == active,
+                "select(AUTO) restores load-time choice");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Names
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing names:\n");
+
+    test_assert(strcmp(trit_backend_name(TRIT_BACKEND_SCALAR), "scalar") == 0,
+                "name(SCALAR) == \"scalar\"");
+    test_assert(strcmp(trit_backend_name((trit_backend_t)99), "unknown") == 0,
+                "name(invalid) == \"unknown\"");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_simd_kernels: Each backend vs trit5_unpack
+// ────────────────────────────────────────────────────────────────
+
+int test_simd_kernels(void) {
+    print_header("Kernel Unit Tests: trit5_unpack_groups");
+
+    static const trit_backend_t backends[] = {
+        TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+    };
+
+    printf("\n  Testing each supported backend against trit5_unpack:\n");
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        char name[96];
+        if (!trit_backend_supported(backends[i])) {
+            printf("    (skip %s: not supported on this CPU)\n", trit_backend_name(backends[i]));
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s: all states, lengths 0-400, %d random bytes",
+                 trit_backend_name(backends[i]), BIG_GROUPS);
+        test_assert(check_backend(backends[i]), name);
+    }
+
+    // trit5_unpack_array goes through the dispatcher too
+    trit_backend_select(TRIT_BACKEND_AUTO);
+    trit_t stream[997];
+    uint8_t packed[TRIT5_PACKED_SIZE(997)];
+    trit_t back[997];
+    for (int i = 0; i < 997; i++) stream[i] = (trit_t)((i * 5 + i / 7) % 3 - 1);
+    trit5_pack_array(stream, 997, packed);
+    trit5_unpack_array(packed, 997, back);
+    test_assert(memcmp(stream, back, sizeof(stream)) == 0,
+                "trit5_unpack_array roundtrip through active backend");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_simd_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_simd_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Vectorized Kernels and Dispatch\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_simd_dispatch();
+    test_simd_kernels();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_simd_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add backends to the list in test_simd_kernels()
+//   ✅ Add lengths or buffers that stress new step widths
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = trit5_unpack (the scalar definition of truth)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Prove all things; hold fast that which is good." — 1 Thess 5:21
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
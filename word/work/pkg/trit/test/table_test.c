@@ -0,0 +1,381 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Precomputed Decode Tables
+// Key: B-word-work-pkg-trit-table-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/constants/ternary-math.toml [powers]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for table.c - designed to FAIL MEANINGFULLY.
+// Every table row must agree with the power arrays and the division path.
+//
+// table_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: A table is only as good as its worst row. Check them all.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH row of which table is wrong.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Verify TRIT5/TRIT4 decode tables and the table-driven unpacks.
+//
+// Key Features:
+//   - Every row rebuilt from TRIT5_POWERS (place values must match)
+//   - trit5_unpack_table vs trit5_unpack: all 243 states
+//   - trit9_unpack_table vs trit9_unpack: all 19,683 states
+//   - trit27_unpack_table vs trit27_unpack: every chunk boundary + random
+//   - Spare rows (243-255) decode to zero; TABLE backend matches reference
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-table
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>   // printf
+#include <string.h>  // memcmp
+
+//--- Project Headers ---
+#include "trit.h"    // decode tables, table-driven unpack
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_table_run_all(void);      // Run all tests, return failure count
+int test_table_rows(void);         // Table contents vs power arrays
+int test_table_decode(void);       // Table-driven unpack vs division path
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_table_run_all()
+//   ├── test_table_rows()   → TRIT5_DECODE_TABLE, TRIT4_DECODE_TABLE
+//   └── test_table_decode() → trit5/9/27_unpack_table, TABLE backend
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// test_table_rows: Table contents vs power arrays
+// ────────────────────────────────────────────────────────────────
+
+int test_table_rows(void) {
+    print_header("Table Unit Tests: row contents");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: TRIT5_DECODE_TABLE rebuilt from TRIT5_POWERS
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing TRIT5_DECODE_TABLE (243 valid rows):\n");
+
+    int bad_row = -1;
+    for (int v = 0; v < TRIT5_STATES && bad_row < 0; v++) {
+        for (int i = 0; i < 5; i++) {
+            int digit = (v / TRIT5_POWERS[4 - i]) % 3 - 1;
+            if (TRIT5_DECODE_TABLE[v][i] != digit) { bad_row = v; break; }
+        }
+    }
+    if (bad_row >= 0) printf("    First bad row: %d\n", bad_row);
+    test_assert(bad_row < 0, "every trit5 row matches TRIT5_POWERS place values");
+
+    int spare_ok = 1;
+    for (int v = TRIT5_STATES; v < 256; v++) {
+        for (int i = 0; i < 5; i++) {
+            if (TRIT5_DECODE_TABLE[v][i] != TRIT_ZERO) spare_ok = 0;
+        }
+    }
+    test_assert(spare_ok, "spare rows 243-255 are all TRIT_ZERO");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: TRIT4_DECODE_TABLE rebuilt from TRIT9_POWERS
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing TRIT4_DECODE_TABLE (81 rows):\n");
+
+    bad_row = -1;
+    for (int v = 0; v < 81 && bad_row < 0; v++) {
+        for (int i = 0; i < 4; i++) {
+            int digit = (v / TRIT9_POWERS[3 - i]) % 3 - 1;
+            if (TRIT4_DECODE_TABLE[v][i] != digit) { bad_row = v; break; }
+        }
+    }
+    if (bad_row >= 0) printf("    First bad row: %d\n", bad_row);
+    test_assert(bad_row < 0, "every trit4 row matches TRIT9_POWERS place values");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_table_decode: Table-driven unpack vs division path
+// ────────────────────────────────────────────────────────────────
+
+int test_table_decode(void) {
+    print_header("Table Unit Tests: decode paths");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: trit5_unpack_table == trit5_unpack
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing trit5_unpack_table (all 243 states):\n");
+
+    int first_bad = -1;
+    for (int v = 0; v < TRIT5_STATES && first_bad < 0; v++) {
+        trit_t ref[5], got[5];
+        trit5_unpack((trit5_t)v, ref);
+        trit5_unpack_table((trit5_t)v, got);
+        if (memcmp(ref, got, 5) != 0) first_bad = v;
+    }
+    if (first_bad >= 0) printf("    First mismatch at %d\n", first_bad);
+    test_assert(first_bad < 0, "trit5_unpack_table matches trit5_unpack");
+
+    trit_t spare[5];
+    trit5_unpack_table(250, spare);
+    test_assert(spare[0] == 0 && spare[4] == 0, "trit5_unpack_table(250) → zeros (no garbage)");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: trit9_unpack_table == trit9_unpack
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing trit9_unpack_table (all 19,683 states):\n");
+
+    first_bad = -1;
+    for (int v = 0; v < TRIT9_STATES && first_bad < 0; v++) {
+        trit_t ref[9], got[9];
+        trit9_unpack((trit9_t)v, ref);
+        trit9_unpack_table((trit9_t)v, got);
+        if (memcmp(ref, got, 9) != 0) first_bad = v;
+    }
+    if (first_bad >= 0) printf("    First mismatch at %d\n", first_bad);
+    test_assert(first_bad < 0, "trit9_unpack_table matches trit9_unpack");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: trit27_unpack_table == trit27_unpack
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing trit27_unpack_table (chunk boundaries + random):\n");
+
+    // Every 3^18 boundary (±1) exercises the reciprocal split exactly where
+    // a wrong magic constant would be off by one
+    uint64_t bad27 = 0;
+    int ok27 = 1;
+    for (uint64_t hi = 0; hi < TRIT9_STATES && ok27; hi++) {
+        for (int d = -1; d <= 1 && ok27; d++) {
+            uint64_t base = hi * TRIT27_POWERS[18];
+            if (base == 0 && d < 0) continue;
+            uint64_t v = base + (uint64_t)(int64_t)d;
+            trit_t ref[27], got[27];
+            trit27_unpack(v, ref);
+            trit27_unpack_table(v, got);
+            if (memcmp(ref, got, 27) != 0) { ok27 = 0; bad27 = v; }
+        }
+    }
+    // Every 3^9 boundary inside one chunk, then pseudo-random words
+    for (uint64_t mid = 0; mid < TRIT9_STATES && ok27; mid++) {
+        uint64_t v = TRIT27_STATES - 1 - mid * TRIT27_POWERS[9];
+        trit_t ref[27], got[27];
+        trit27_unpack(v, ref);
+        trit27_unpack_table(v, got);
+        if (memcmp(ref, got, 27) != 0) { ok27 = 0; bad27 = v; }
+    }
+    uint64_t seed = 27u;
+    for (int i = 0; i < 200000 && ok27; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint64_t v = (seed >> 11) % TRIT27_STATES;
+        trit_t ref[27], got[27];
+        trit27_unpack(v, ref);
+        trit27_unpack_table(v, got);
+        if (memcmp(ref, got, 27) != 0) { ok27 = 0; bad27 = v; }
+    }
+    if (!ok27) printf("    First mismatch at %llu\n", (unsigned long long)bad27);
+    test_assert(ok27, "trit27_unpack_table matches trit27_unpack (boundaries + 200k random)");
+
+    trit_t top[27];
+    trit27_unpack_table(TRIT27_STATES - 1, top);
+    test_assert(top[0] == TRIT_POS && top[26] == TRIT_POS, "trit27_unpack_table(3^27-1) → all +1");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 6: TRIT_BACKEND_TABLE bulk decode
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing TRIT_BACKEND_TABLE:\n");
+
+    test_assert(trit_backend_supported(TRIT_BACKEND_TABLE), "table backend supported everywhere");
+    test_assert(trit_backend_select(TRIT_BACKEND_TABLE) &&
+                trit_backend_active() == TRIT_BACKEND_TABLE,
+                "select(TABLE) installs table kernel");
+
+    uint8_t bytes[TRIT5_STATES];
+    trit_t out[5 * TRIT5_STATES + 1];
+    for (int v = 0; v < TRIT5_STATES; v++) bytes[v] = (uint8_t)v;
+    int bulk_ok = 1;
+    for (size_t groups = 0; groups <= TRIT5_STATES; groups += 11) {
+        out[5 * groups] = 9;
+        trit5_unpack_groups(bytes, groups, out);
+        for (size_t g = 0; g < groups; g++) {
+            if (memcmp(out + 5 * g, TRIT5_DECODE_TABLE[g], 5) != 0) bulk_ok = 0;
+        }
+        if (out[5 * groups] != 9) bulk_ok = 0;  // nothing written past the end
+    }
+    test_assert(bulk_ok, "table kernel decodes in order, never writes past n");
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_table_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_table_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Precomputed Decode Tables\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_table_rows();
+    test_table_decode();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_table_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add checks for new tables (rebuild rows from the power arrays)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Exhaustive coverage - tables are small enough to check every row
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Write the vision, and make it plain upon tables." — Habakkuk 2:2
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
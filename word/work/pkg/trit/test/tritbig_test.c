@@ -0,0 +1,546 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Arbitrary-Precision Integers
+// Key: B-word-work-pkg-trit-tritbig-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/pack_test.c (structure)
+// See: word/research/ternary/ternary-arithmetic-algorithms.adoc [Division]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for tritbig.c - designed to FAIL MEANINGFULLY.
+// Every algorithm must agree with 128-bit arithmetic and with each other.
+//
+// tritbig_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: A fast multiplier is worthless if one carry goes astray.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH operation or algorithm disagrees.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check tritbig conversion, arithmetic, multiplication algorithms and division.
+//
+// Key Features:
+//   - Conversions: int64 edges, trit and trit27 arrays, trit counts
+//   - add/sub/cmp/mul/neg against __int128 on 20,000 pairs
+//   - Schoolbook, Karatsuba and Toom-3 forced and compared on 1-900 limb operands
+//   - divmod identity and centered-remainder bounds, all sign combinations
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-tritbig
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>   // printf
+#include <string.h>  // memcmp, memset
+
+//--- Project Headers ---
+#include "tritbig.h" // tritbig_t and operations
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_tritbig_run_all(void);                    // Run all tests, return failure count
+int test_tritbig_convert(void);    // Conversions
+int test_tritbig_arith(void);      // add/sub/cmp/mul
+int test_tritbig_divmod(void);     // Centered division
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_tritbig_run_all()
+//   ├── test_tritbig_convert() → set/to int64, trits, trit27 arrays
+//   ├── test_tritbig_arith()   → add/sub/cmp/mul, algorithm cross-checks
+//   └── test_tritbig_divmod()  → divmod identity and bounds
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (128-bit reference values, random operands)
+// ────────────────────────────────────────────────────────────────
+
+__extension__ typedef __int128 wide_t;
+
+// next_rand steps a 64-bit LCG.
+static uint64_t next_rand(uint64_t *seed) {
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *seed;
+}
+
+// to_wide reads a small tritbig (≤ 4 limbs) as a 128-bit value.
+static wide_t to_wide(const tritbig_t *x) {
+    wide_t v = 0;
+    for (size_t i = x->len; i-- > 0;) v = v * (wide_t)TRIT27_STATES + x->limb[i];
+    return v;
+}
+
+// set_wide sets x from a 128-bit value via two int64 halves: hi·2^62 + lo.
+static void set_wide(tritbig_t *x, wide_t v) {
+    tritbig_t hi = TRITBIG_INIT, lo = TRITBIG_INIT, scale = TRITBIG_INIT;
+    tritbig_set_int64(&hi, (int64_t)(v >> 62));
+    tritbig_set_int64(&lo, (int64_t)(v & (((wide_t)1 << 62) - 1)));
+    tritbig_set_int64(&scale, (int64_t)1 << 62);
+    tritbig_mul(x, &hi, &scale);
+    tritbig_add(x, x, &lo);
+    tritbig_free(&hi);
+    tritbig_free(&lo);
+    tritbig_free(&scale);
+}
+
+// rand_big sets x to n random balanced trits (leading trits may be zero).
+static void rand_big(tritbig_t *x, size_t n, uint64_t *seed) {
+    static trit_t trits[40000];
+    for (size_t i = 0; i < n; i++) trits[i] = (trit_t)((int)((next_rand(seed) >> 33) % 3) - 1);
+    tritbig_from_trits(x, trits, n);
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritbig_convert: int64, trit and trit27 conversions
+// ────────────────────────────────────────────────────────────────
+
+int test_tritbig_convert(void) {
+    print_header("tritbig Unit Tests: Conversion");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: int64 round trip
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing int64 round trip:\n");
+
+    static const int64_t edges[] = {
+        0, 1, -1, 2, (int64_t)TRIT27_BIAS, -(int64_t)TRIT27_BIAS,
+        (int64_t)TRIT27_BIAS + 1, -(int64_t)TRIT27_BIAS - 1,
+        INT64_MAX, INT64_MIN, INT64_MAX - 1, INT64_MIN + 1
+    };
+    tritbig_t x = TRITBIG_INIT;
+    int rt_ok = 1, canon_ok = 1;
+    uint64_t seed = 7u;
+    for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]) + 5000; i++) {
+        int64_t v = (i < sizeof(edges) / sizeof(edges[0])) ? edges[i] : (int64_t)next_rand(&seed) >> (i % 60);
+        bool of = true;
+        tritbig_set_int64(&x, v);
+        if (tritbig_to_int64(&x, &of) != v || of) rt_ok = 0;
+        if (x.len && x.limb[x.len - 1] == 0) canon_ok = 0;
+        for (size_t k = 0; k < x.len; k++) {
+            if (x.limb[k] > (int64_t)TRIT27_BIAS || x.limb[k] < -(int64_t)TRIT27_BIAS) canon_ok = 0;
+        }
+        if (tritbig_sign(&x) != (v > 0) - (v < 0)) canon_ok = 0;
+    }
+    test_assert(rt_ok, "to_int64(set_int64(v)) == v (edges, INT64_MIN/MAX, random)");
+    test_assert(canon_ok, "limbs balanced, no zero top limb, sign = top limb sign");
+    int wide_ok = 1;
+    for (int i = 0; i < 2000; i++) {
+        wide_t v = ((wide_t)(int64_t)next_rand(&seed) * ((wide_t)1 << 56)) ^ (wide_t)next_rand(&seed);
+        set_wide(&x, v >> (i % 64));
+        if (to_wide(&x) != v >> (i % 64)) wide_ok = 0;
+    }
+    test_assert(wide_ok, "120-bit values survive hi·2^62 + lo construction");
+    tritbig_set_int64(&x, 0);
+    test_assert(x.len == 0 && tritbig_trits(&x) == 0, "zero has len 0 and 0 trits");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Trit and trit27 arrays
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing trit / trit27 arrays:\n");
+
+    int trits_ok = 1, words_ok = 1, count_ok = 1;
+    for (size_t n = 0; n <= 300; n++) {
+        trit_t in[300], out[300];
+        for (size_t i = 0; i < n; i++) in[i] = (trit_t)((int)((next_rand(&seed) >> 40) % 3) - 1);
+        tritbig_from_trits(&x, in, n);
+        if (!tritbig_to_trits(&x, out, n) || (n && memcmp(in, out, n) != 0)) trits_ok = 0;
+        size_t lead = 0;
+        while (lead < n && in[lead] == 0) lead++;
+        if (tritbig_trits(&x) != n - lead) count_ok = 0;
+
+        trit27_t words[12];
+        size_t nw = TRITBIG_LIMB_TRITS * 12 >= n ? (n + 26) / 27 : 0;
+        tritbig_t y = TRITBIG_INIT;
+        if (!tritbig_to_trit27_array(&x, words, nw) || !tritbig_from_trit27_array(&y, words, nw) ||
+            tritbig_cmp(&x, &y) != 0) {
+            words_ok = 0;
+        }
+        tritbig_free(&y);
+    }
+    test_assert(trits_ok, "from_trits/to_trits round trip, lengths 0-300");
+    test_assert(count_ok, "tritbig_trits == length without leading zeros");
+    test_assert(words_ok, "to_trit27_array/from_trit27_array round trip");
+
+    trit_t t5[5];
+    tritbig_set_int64(&x, 122);   // 1 T T T T T in 6 trits
+    test_assert(!tritbig_to_trits(&x, t5, 5) && t5[0] == -1 && t5[4] == -1,
+                "to_trits(122, 5) reports overflow, keeps low trits (-121)");
+    trit27_t w1;
+    tritbig_set_int64(&x, -5);
+    test_assert(tritbig_to_trit27_array(&x, &w1, 1) && w1 == trit27_from_int64(-5, NULL),
+                "limb + TRIT27_BIAS == packed trit27 word");
+    bool of = false;
+    tritbig_set_int64(&x, INT64_MAX);
+    tritbig_t one = TRITBIG_INIT;
+    tritbig_set_int64(&one, 1);
+    tritbig_add(&x, &x, &one);
+    test_assert(tritbig_to_int64(&x, &of) == INT64_MIN && of, "INT64_MAX + 1 wraps to INT64_MIN, overflow");
+
+    tritbig_free(&x);
+    tritbig_free(&one);
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritbig_arith: add/sub/cmp/mul vs 128-bit reference
+// ────────────────────────────────────────────────────────────────
+
+int test_tritbig_arith(void) {
+    print_header("tritbig Unit Tests: add, sub, cmp, mul");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Small values vs __int128
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing against 128-bit arithmetic:\n");
+
+    tritbig_t a = TRITBIG_INIT, b = TRITBIG_INIT, r = TRITBIG_INIT;
+    uint64_t seed = 99u;
+    int add_ok = 1, sub_ok = 1, cmp_ok = 1, mul_ok = 1, neg_ok = 1;
+    for (int i = 0; i < 20000; i++) {
+        int64_t va = (int64_t)next_rand(&seed) >> (i % 63);
+        int64_t vb = (int64_t)next_rand(&seed) >> ((i / 7) % 63);
+        if (i % 11 == 0) vb = va;
+        tritbig_set_int64(&a, va);
+        tritbig_set_int64(&b, vb);
+        tritbig_add(&r, &a, &b);
+        if (to_wide(&r) != (wide_t)va + vb) add_ok = 0;
+        tritbig_sub(&r, &a, &b);
+        if (to_wide(&r) != (wide_t)va - vb) sub_ok = 0;
+        if (tritbig_cmp(&a, &b) != (va > vb) - (va < vb)) cmp_ok = 0;
+        tritbig_mul(&r, &a, &b);
+        if (to_wide(&r) != (wide_t)va * vb) mul_ok = 0;
+        tritbig_neg(&r, &r);
+        if (to_wide(&r) != -((wide_t)va * vb)) neg_ok = 0;
+    }
+    test_assert(add_ok, "add == 128-bit a + b");
+    test_assert(sub_ok, "sub == 128-bit a - b");
+    test_assert(cmp_ok, "cmp orders by signed value");
+    test_assert(mul_ok, "mul == 128-bit a · b");
+    test_assert(neg_ok, "neg == -x");
+
+    // Aliasing: r is also an operand
+    tritbig_set_int64(&a, 123456789012LL);
+    tritbig_mul(&a, &a, &a);
+    tritbig_add(&a, &a, &a);
+    test_assert(to_wide(&a) == (wide_t)123456789012LL * 123456789012LL * 2,
+                "results may alias operands (a = a·a, a = a + a)");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: Schoolbook vs Karatsuba vs Toom-3
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing algorithms against each other:\n");
+
+    static const size_t sizes[][2] = {
+        { 1, 1 }, { 5, 5 }, { 31, 29 }, { 64, 64 }, { 97, 60 }, { 130, 128 },
+        { 200, 7 }, { 300, 299 }, { 401, 250 }, { 600, 600 }, { 900, 310 }
+    };
+    tritbig_t ref = TRITBIG_INIT;
+    int kara_ok = 1, toom_ok = 1, dflt_ok = 1;
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        rand_big(&a, sizes[s][0] * TRITBIG_LIMB_TRITS, &seed);
+        rand_big(&b, sizes[s][1] * TRITBIG_LIMB_TRITS, &seed);
+        if (s % 2) tritbig_neg(&b, &b);
+        tritbig_set_mul_thresholds(SIZE_MAX, SIZE_MAX);     // schoolbook only
+        tritbig_mul(&ref, &a, &b);
+        tritbig_set_mul_thresholds(4, SIZE_MAX);            // Karatsuba down to 4 limbs
+        tritbig_mul(&r, &a, &b);
+        if (tritbig_cmp(&r, &ref) != 0) kara_ok = 0;
+        tritbig_set_mul_thresholds(4, 4);                   // Toom-3 wherever it applies
+        tritbig_mul(&r, &a, &b);
+        if (tritbig_cmp(&r, &ref) != 0) toom_ok = 0;
+        tritbig_set_mul_thresholds(0, 0);                   // defaults
+        tritbig_mul(&r, &b, &a);
+        if (tritbig_cmp(&r, &ref) != 0) dflt_ok = 0;
+    }
+    test_assert(kara_ok, "Karatsuba == schoolbook (balanced and unbalanced sizes)");
+    test_assert(toom_ok, "Toom-3 == schoolbook");
+    test_assert(dflt_ok, "default thresholds == schoolbook, b·a == a·b");
+
+    // All-maximum limbs: every carry path at its limit
+    trit_t ones[3000];
+    memset(ones, 1, sizeof(ones));
+    tritbig_from_trits(&a, ones, 3000);
+    tritbig_set_mul_thresholds(SIZE_MAX, SIZE_MAX);
+    tritbig_mul(&ref, &a, &a);
+    tritbig_set_mul_thresholds(4, 4);
+    tritbig_mul(&r, &a, &a);
+    tritbig_set_mul_thresholds(0, 0);
+    test_assert(tritbig_cmp(&r, &ref) == 0, "(1…1)² agrees at maximal limbs");
+
+    tritbig_free(&a);
+    tritbig_free(&b);
+    tritbig_free(&r);
+    tritbig_free(&ref);
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritbig_divmod: Centered-remainder division
+// ────────────────────────────────────────────────────────────────
+
+// check_divmod verifies a = q·b + r and -|b| < 2r ≤ |b|.
+static int check_divmod(const tritbig_t *a, const tritbig_t *b) {
+    tritbig_t q = TRITBIG_INIT, r = TRITBIG_INIT, t = TRITBIG_INIT, absb = TRITBIG_INIT;
+    int ok = tritbig_divmod(&q, &r, a, b);
+    tritbig_mul(&t, &q, b);
+    tritbig_add(&t, &t, &r);
+    ok = ok && tritbig_cmp(&t, a) == 0;
+    if (tritbig_sign(b) < 0) tritbig_neg(&absb, b); else tritbig_copy(&absb, b);
+    tritbig_add(&t, &r, &r);
+    ok = ok && tritbig_cmp(&t, &absb) <= 0;
+    tritbig_neg(&absb, &absb);
+    ok = ok && tritbig_cmp(&t, &absb) > 0;
+    tritbig_free(&q);
+    tritbig_free(&r);
+    tritbig_free(&t);
+    tritbig_free(&absb);
+    return ok;
+}
+
+int test_tritbig_divmod(void) {
+    print_header("tritbig Unit Tests: divmod");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: Research doc examples and small values
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing small quotients:\n");
+
+    tritbig_t a = TRITBIG_INIT, b = TRITBIG_INIT, q = TRITBIG_INIT, r = TRITBIG_INIT;
+    tritbig_set_int64(&a, -7);
+    tritbig_set_int64(&b, 3);
+    tritbig_divmod(&q, &r, &a, &b);
+    test_assert(tritbig_to_int64(&q, NULL) == -2 && tritbig_to_int64(&r, NULL) == -1,
+                "-7 ÷ 3 = -2 rem -1 (research doc)");
+    tritbig_set_int64(&a, 35);
+    tritbig_set_int64(&b, 5);
+    tritbig_divmod(&q, &r, &a, &b);
+    test_assert(tritbig_to_int64(&q, NULL) == 7 && r.len == 0, "35 ÷ 5 = 7 rem 0");
+    tritbig_set_int64(&a, 7);
+    tritbig_set_int64(&b, 2);
+    tritbig_divmod(&q, &r, &a, &b);
+    test_assert(tritbig_to_int64(&q, NULL) == 3 && tritbig_to_int64(&r, NULL) == 1,
+                "7 ÷ 2 = 3 rem +1 (tie keeps r = +|b|/2)");
+
+    uint64_t seed = 4242u;
+    int small_ok = 1;
+    for (int i = 0; i < 20000; i++) {
+        int64_t va = (int64_t)next_rand(&seed) >> (i % 63);
+        int64_t vb = (int64_t)next_rand(&seed) >> (1 + (i / 3) % 62);
+        if (vb == 0) vb = 1;
+        tritbig_set_int64(&a, va);
+        tritbig_set_int64(&b, vb);
+        if (!check_divmod(&a, &b)) small_ok = 0;
+    }
+    test_assert(small_ok, "a == q·b + r, -|b| < 2r ≤ |b| (20,000 int64 pairs)");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 6: Multi-limb operands
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing multi-limb operands:\n");
+
+    static const size_t sizes[][2] = {
+        { 30, 1 }, { 30, 2 }, { 60, 3 }, { 100, 100 }, { 200, 81 }, { 2000, 700 },
+        { 5000, 4999 }, { 8100, 27 }, { 10000, 3333 }, { 20, 300 }
+    };
+    int big_ok = 1;
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (int sign = 0; sign < 4; sign++) {
+            rand_big(&a, sizes[s][0], &seed);
+            rand_big(&b, sizes[s][1], &seed);
+            if (b.len == 0) tritbig_set_int64(&b, 5);
+            if (sign & 1) tritbig_neg(&a, &a);
+            if (sign & 2) tritbig_neg(&b, &b);
+            if (!check_divmod(&a, &b)) big_ok = 0;
+        }
+    }
+    test_assert(big_ok, "identity and bounds hold up to 10,000-trit dividends, all signs");
+
+    // Exact division recovers the factor
+    rand_big(&a, 4000, &seed);
+    rand_big(&b, 1500, &seed);
+    tritbig_mul(&r, &a, &b);
+    tritbig_divmod(&r, &q, &r, &b);    // r = (a·b) / b, q = remainder; outputs alias input
+    test_assert(tritbig_cmp(&r, &a) == 0 && q.len == 0, "(a·b) ÷ b == a rem 0 (quotient aliases dividend)");
+
+    tritbig_t zero = TRITBIG_INIT;
+    tritbig_set_int64(&q, 77);
+    test_assert(!tritbig_divmod(&q, NULL, &a, &zero) && tritbig_to_int64(&q, NULL) == 77,
+                "divide by zero returns false, outputs unchanged");
+
+    tritbig_free(&a);
+    tritbig_free(&b);
+    tritbig_free(&q);
+    tritbig_free(&r);
+    return tests_failed;
+}
+
+
+// ────────────────────────────────────────────────────────────────
+// test_tritbig_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_tritbig_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Arbitrary-Precision Integers\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_tritbig_convert();
+    test_tritbig_arith();
+    test_tritbig_divmod();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_tritbig_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add sizes near the thresholds when they are retuned
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = __int128 arithmetic and schoolbook multiplication
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "He telleth the number of the stars." — Psalm 147:4
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,612 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Delta-Coded Integer Columns
+// Key: B-word-work-pkg-trit-tritcol-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for tritcol.h and backend dispatch.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/vartrit_test.c (structure)
+// See: word/scripture/kjv-ordinal-index.adoc (monotone verse ordinals)
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for tritcol.c - designed to FAIL MEANINGFULLY.
+// Every column must decode to exactly what was encoded, every skip must
+// agree with a plain loop, and every damaged column must be refused.
+//
+// tritcol_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "So teach us to number our days" — Psalm 90:12
+//
+// Principle: Counted by steps, the total must still come out right.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH transform, block edge, data shape or fault
+//       diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check tritcol_encode, tritcol_decode, tritcol_count,
+//          tritcol_count_range and the streaming reader.
+//
+// Key Features:
+//   - Header and payload bytes of small columns
+//   - Round-trips per transform at block edges, for sorted, walking,
+//     regular and full-width data (differences that wrap)
+//   - Reader rows, min / max and range counts vs plain loops
+//   - Cut-short, mislabelled and inconsistent blocks
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-tritcol
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>        // printf
+#include <string.h>       // memcmp, memcpy
+
+//--- Project Headers ---
+#include "tritcol.h"      // tritcol_*, TRITCOL_*
+#include "trit.h"         // backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+#define COL_VALUES  5000
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_tritcol_run_all(void);    // Run all tests, return failure count
+int test_tritcol_form(void);       // Header and payload bytes
+int test_tritcol_trips(void);      // Round-trips
+int test_tritcol_reader(void);     // Streaming and range counts
+int test_tritcol_errors(void);     // Malformed columns
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_tritcol_run_all()
+//   ├── test_tritcol_form()   → header fields, one-byte payloads, AUTO
+//   ├── test_tritcol_trips()  → shapes × transforms × lengths, backends
+//   ├── test_tritcol_reader() → rows, min / max, skips, range counts
+//   └── test_tritcol_errors() → damaged columns
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (data shapes, round-trips)
+// ────────────────────────────────────────────────────────────────
+
+static int64_t vals[COL_VALUES];
+static int64_t back[COL_VALUES + 1];
+static uint8_t col[TRITCOL_BOUND(COL_VALUES) + TRITCOL_BOUND(COL_VALUES)];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+static uint64_t rng_state = 1u;
+
+static uint64_t rng(void) {
+    rng_state = rng_state * 6364136223846793005u + 1442695040888963407u;
+    return rng_state >> 11;
+}
+
+// Data shapes: the columns tritcol is meant for, and the worst case.
+typedef enum {
+    SHAPE_POSTINGS = 0,   // sorted, gaps 1-40
+    SHAPE_WALK,           // scores drifting ±3
+    SHAPE_CLOCK,          // timestamps every 60 s, ±2 s jitter
+    SHAPE_WIDE,           // full-width random: differences wrap
+    SHAPE_EXTREMES,       // INT64_MIN / INT64_MAX / 0 in turn
+    SHAPE_COUNT
+} shape_t;
+
+static const char *const shape_names[SHAPE_COUNT] = {
+    "postings", "score walk", "timestamps", "full-width", "extremes"
+};
+
+static void fill(shape_t shape, int64_t *v, size_t n) {
+    int64_t x = shape == SHAPE_CLOCK ? INT64_C(1765670400) : 100;
+    for (size_t i = 0; i < n; i++) {
+        switch (shape) {
+        case SHAPE_POSTINGS:
+            x += 1 + (int64_t)(rng() % 40);
+            v[i] = x;
+            break;
+        case SHAPE_WALK:
+            x += (int64_t)(rng() % 7) - 3;
+            v[i] = x;
+            break;
+        case SHAPE_CLOCK:
+            v[i] = x + 60 * (int64_t)i + (int64_t)(rng() % 5) - 2;
+            break;
+        case SHAPE_WIDE:
+            v[i] = (int64_t)((rng() << 11) ^ rng());
+            break;
+        default:
+            v[i] = i % 3 == 0 ? INT64_MIN : i % 3 == 1 ? INT64_MAX : 0;
+            break;
+        }
+    }
+}
+
+// round_trip encodes n values of vals, checks the size bound and count,
+// and decodes into back. Returns the encoded length, or 0 on any mismatch.
+static size_t round_trip(size_t n, tritcol_transform_t t) {
+    size_t len = tritcol_encode(vals, n, t, col);
+    back[n] = 0x5a5a;
+    int ok = len <= TRITCOL_BOUND(n) && tritcol_count(col, len) == n &&
+             tritcol_decode(col, len, back, n) == n &&
+             memcmp(back, vals, n * sizeof(int64_t)) == 0 && back[n] == 0x5a5a;
+    return ok ? len : 0;
+}
+
+// count_plain is the range count tritcol_count_range must match.
+static size_t count_plain(size_t n, int64_t lo, int64_t hi) {
+    size_t c = 0;
+    for (size_t i = 0; i < n; i++) {
+        c += vals[i] >= lo && vals[i] <= hi;
+    }
+    return c;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritcol_form: Header and Payload Bytes
+// ────────────────────────────────────────────────────────────────
+
+int test_tritcol_form(void) {
+    print_header("TEST: Column Layout");
+    uint8_t b[TRITCOL_BOUND(8)];
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Header fields and one-byte payloads
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing layout:\n");
+
+    static const int64_t steps[4] = { 5, 6, 7, 9 };
+    size_t len = tritcol_encode(steps, 4, TRITCOL_DELTA, b);
+    static const uint8_t head[TRITCOL_HEAD] = {
+        TRITCOL_DELTA, 0, 4, 0, 3, 0, 0, 0,
+        5, 0, 0, 0, 0, 0, 0, 0,
+        5, 0, 0, 0, 0, 0, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0
+    };
+    test_assert(len == TRITCOL_HEAD + 3 && memcmp(b, head, TRITCOL_HEAD) == 0,
+                "{5, 6, 7, 9} DELTA → header: tag, 0, count 4, 3 bytes, first 5, min 5, max 9");
+    test_assert(b[32] == 250 && b[33] == 250 && b[34] == 251,
+                "payload = deltas +1 +1 +2 as one-byte vartrit [250, 250, 251]");
+
+    static const int64_t line[4] = { 10, 13, 16, 19 };
+    len = tritcol_encode(line, 4, TRITCOL_DOD, b);
+    test_assert(len == TRITCOL_HEAD + 3 && b[0] == TRITCOL_DOD &&
+                b[32] == 252 && b[33] == 249 && b[34] == 249,
+                "{10, 13, 16, 19} DOD → payload [+3, 0, 0] = [252, 249, 249]");
+
+    static const int64_t neg[3] = { -1, -8, INT64_MIN };
+    len = tritcol_encode(neg, 3, TRITCOL_DELTA, b);
+    test_assert(len > TRITCOL_HEAD && b[16] == 0 && b[23] == 0x80 && b[24] == 0xff && b[31] == 0xff,
+                "min INT64_MIN, max -1 stored two's complement, little-endian");
+
+    // AUTO: a straight line of step 1000 costs 2 bytes per delta, 1 per
+    // change of step; a walk is the other way round
+    int64_t l[8], w[8] = { 0, 3, 1, 4, 1, 5, 2, 6 };
+    for (int i = 0; i < 8; i++) {
+        l[i] = 1000 * i;
+    }
+    tritcol_encode(l, 8, TRITCOL_AUTO, b);
+    test_assert(b[0] == TRITCOL_DOD && b[4] == 2 + 6, "AUTO on a straight line → DOD (2 + 6 bytes)");
+    tritcol_encode(w, 8, TRITCOL_AUTO, b);
+    test_assert(b[0] == TRITCOL_DELTA && b[4] == 7, "AUTO on a walk → DELTA (7 bytes)");
+
+    test_assert(tritcol_encode(vals, 0, TRITCOL_AUTO, b) == 0 && tritcol_count(b, 0) == 0 &&
+                tritcol_decode(b, 0, back, 0) == 0 && tritcol_count_range(b, 0, INT64_MIN, INT64_MAX) == 0,
+                "n = 0 → empty column, count 0, decodes to nothing");
+
+    static const int64_t one = -42;
+    len = tritcol_encode(&one, 1, TRITCOL_DOD, b);
+    test_assert(len == TRITCOL_HEAD && tritcol_decode(b, len, back, 1) == 1 && back[0] == -42,
+                "n = 1 → header only");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritcol_trips: Round-Trips
+// ────────────────────────────────────────────────────────────────
+
+int test_tritcol_trips(void) {
+    print_header("TEST: Round-Trips");
+    char name[128];
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Shapes × transforms × block edges
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing shapes and lengths:\n");
+
+    static const size_t lengths[] = { 1, 2, 3, 1023, 1024, 1025, 2048, COL_VALUES };
+    static const tritcol_transform_t transforms[] = { TRITCOL_DELTA, TRITCOL_DOD, TRITCOL_AUTO };
+    static const char *const transform_names[] = { "DELTA", "DOD", "AUTO" };
+    for (int s = 0; s < SHAPE_COUNT; s++) {
+        fill((shape_t)s, vals, COL_VALUES);
+        for (size_t t = 0; t < 3; t++) {
+            int ok = 1;
+            for (size_t k = 0; k < sizeof(lengths) / sizeof(lengths[0]); k++) {
+                ok = ok && round_trip(lengths[k], transforms[t]) != 0;
+            }
+            snprintf(name, sizeof(name), "%s, %s: n = 1 .. %d round-trip", shape_names[s],
+                     transform_names[t], COL_VALUES);
+            test_assert(ok, name);
+        }
+    }
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Sizes
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing sizes:\n");
+
+    // Ordinals 1 .. 31102 (kjv-ordinal-index.csv): one byte per step
+    static int64_t ordinals[31102];
+    static uint8_t ord_col[TRITCOL_BOUND(31102)];
+    for (size_t i = 0; i < 31102; i++) {
+        ordinals[i] = (int64_t)i + 1;
+    }
+    size_t blocks = (31102 + TRITCOL_BLOCK - 1) / TRITCOL_BLOCK;
+    size_t len = tritcol_encode(ordinals, 31102, TRITCOL_AUTO, ord_col);
+    snprintf(name, sizeof(name), "ordinals 1..31102 → %zu bytes (%zu blocks + 1 byte per step)",
+             len, blocks);
+    test_assert(len == blocks * TRITCOL_HEAD + 31102 - blocks, name);
+
+    fill(SHAPE_WALK, vals, COL_VALUES);
+    len = tritcol_encode(vals, COL_VALUES, TRITCOL_DELTA, col);
+    blocks = (COL_VALUES + TRITCOL_BLOCK - 1) / TRITCOL_BLOCK;
+    test_assert(len == blocks * TRITCOL_HEAD + COL_VALUES - blocks,
+                "score walk (±3) DELTA → 1 byte per value + headers");
+
+    fill(SHAPE_CLOCK, vals, COL_VALUES);
+    size_t delta_len = tritcol_encode(vals, COL_VALUES, TRITCOL_DELTA, col);
+    size_t dod_len = tritcol_encode(vals, COL_VALUES, TRITCOL_DOD, col);
+    size_t auto_len = tritcol_encode(vals, COL_VALUES, TRITCOL_AUTO, col);
+    snprintf(name, sizeof(name), "timestamps: DELTA %zu, DOD %zu, AUTO %zu = the smaller",
+             delta_len, dod_len, auto_len);
+    test_assert(dod_len < delta_len && auto_len == dod_len, name);
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: Payload decoding per backend, concatenation
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing backends:\n");
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        if (!trit_backend_select(backends[b])) {
+            continue;
+        }
+        int ok = 1;
+        for (int s = 0; s < SHAPE_COUNT; s++) {
+            fill((shape_t)s, vals, COL_VALUES);
+            ok = ok && round_trip(COL_VALUES, TRITCOL_AUTO) != 0;
+        }
+        snprintf(name, sizeof(name), "%s: every shape round-trips", trit_backend_name(backends[b]));
+        test_assert(ok, name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    // Two columns back to back read as one
+    fill(SHAPE_POSTINGS, vals, COL_VALUES);
+    size_t a_len = tritcol_encode(vals, 1500, TRITCOL_DELTA, col);
+    size_t b_len = tritcol_encode(vals + 1500, COL_VALUES - 1500, TRITCOL_DOD, col + a_len);
+    test_assert(tritcol_decode(col, a_len + b_len, back, COL_VALUES) == COL_VALUES &&
+                memcmp(back, vals, sizeof(vals)) == 0,
+                "two encoded columns concatenated decode as one");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritcol_reader: Streaming and Range Counts
+// ────────────────────────────────────────────────────────────────
+
+int test_tritcol_reader(void) {
+    print_header("TEST: Reader and Range Counts");
+    char name[128];
+    int64_t block[TRITCOL_BLOCK];
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: Blocks as the reader reports them
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing reader:\n");
+
+    fill(SHAPE_WALK, vals, COL_VALUES);
+    size_t len = tritcol_encode(vals, COL_VALUES, TRITCOL_AUTO, col);
+    tritcol_reader_t r;
+    tritcol_reader_init(&r, col, len);
+    test_assert(tritcol_read(&r, block) == TRITCOL_ERROR, "read before next → TRITCOL_ERROR");
+    tritcol_reader_init(&r, col, len);
+
+    int heads_ok = 1, reads_ok = 1;
+    size_t blocks = 0, row = 0;
+    while (tritcol_next(&r)) {
+        const tritcol_block_t *b = &r.block;
+        int64_t lo = vals[row], hi = vals[row];
+        for (size_t i = row; i < row + b->count; i++) {
+            lo = vals[i] < lo ? vals[i] : lo;
+            hi = vals[i] > hi ? vals[i] : hi;
+        }
+        heads_ok = heads_ok && b->row == row && b->first == vals[row] && b->min == lo && b->max == hi &&
+                   b->count == (COL_VALUES - row < TRITCOL_BLOCK ? COL_VALUES - row : TRITCOL_BLOCK);
+        // Read every other block, twice
+        if (blocks % 2 == 0) {
+            reads_ok = reads_ok && tritcol_read(&r, block) == b->count &&
+                       memcmp(block, vals + row, b->count * sizeof(int64_t)) == 0 &&
+                       tritcol_read(&r, block) == b->count &&
+                       memcmp(block, vals + row, b->count * sizeof(int64_t)) == 0;
+        }
+        row += b->count;
+        blocks++;
+    }
+    test_assert(heads_ok && !r.error && row == COL_VALUES && blocks == 5,
+                "5 blocks: row, count, first, min, max match the values");
+    test_assert(reads_ok, "skipped blocks leave later reads intact; reading twice is the same");
+    test_assert(!tritcol_next(&r) && !r.error, "next after the end stays false, no error");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 6: Range counts vs a plain loop
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing range counts:\n");
+
+    for (int s = 0; s < SHAPE_COUNT; s++) {
+        fill((shape_t)s, vals, COL_VALUES);
+        len = tritcol_encode(vals, COL_VALUES, TRITCOL_AUTO, col);
+        int ok = tritcol_count_range(col, len, INT64_MIN, INT64_MAX) == COL_VALUES &&
+                 tritcol_count_range(col, len, 1, 0) == 0;
+        for (int q = 0; q < 200 && ok; q++) {
+            int64_t a = vals[rng() % COL_VALUES], c = vals[rng() % COL_VALUES];
+            int64_t lo = a < c ? a : c, hi = a < c ? c : a;
+            ok = tritcol_count_range(col, len, lo, hi) == count_plain(COL_VALUES, lo, hi) &&
+                 tritcol_count_range(col, len, lo, lo) == count_plain(COL_VALUES, lo, lo);
+        }
+        snprintf(name, sizeof(name), "%s: 400 ranges match a plain loop", shape_names[s]);
+        test_assert(ok, name);
+    }
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritcol_errors: Malformed Columns
+// ────────────────────────────────────────────────────────────────
+
+int test_tritcol_errors(void) {
+    print_header("TEST: Malformed Columns");
+    static uint8_t bad[TRITCOL_BOUND(COL_VALUES)];
+    char name[128];
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 7: Damaged headers and payloads
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing damage:\n");
+
+    // First block: one-byte payload (walk); second: full-width
+    fill(SHAPE_WALK, vals, TRITCOL_BLOCK);
+    fill(SHAPE_WIDE, vals + TRITCOL_BLOCK, TRITCOL_BLOCK);
+    size_t n = 2 * TRITCOL_BLOCK;
+    size_t len = tritcol_encode(vals, n, TRITCOL_DELTA, col);
+    size_t second = TRITCOL_HEAD + TRITCOL_BLOCK - 1;
+
+    static const char *const damage[] = {
+        "cut inside the last payload", "cut inside the second header", "transform 0",
+        "transform 3", "reserved byte set", "count 0", "count past TRITCOL_BLOCK",
+        "payload one byte longer", "payload one byte shorter", "first below min",
+        "max one too high (payload check)", "one-byte payload holds a group byte",
+        "wide payload: terminator turned group"
+    };
+    for (size_t c = 0; c < sizeof(damage) / sizeof(damage[0]); c++) {
+        size_t blen = len;
+        memcpy(bad, col, len);
+        switch (c) {
+        case 0:  blen = len - 1; break;
+        case 1:  blen = second + 5; break;
+        case 2:  bad[0] = 0; break;
+        case 3:  bad[0] = 3; break;
+        case 4:  bad[1] = 1; break;
+        case 5:  bad[2] = 0; bad[3] = 0; break;
+        case 6:  bad[2]++; break;
+        case 7:  bad[4]++; break;
+        case 8:  bad[4]--; break;
+        case 9:  memcpy(bad + 16, bad + 8, 8); bad[16]++; break;
+        case 10: bad[24]++; break;
+        case 11: bad[TRITCOL_HEAD + 10] = TRIT5_BIAS; break;
+        default: {
+            size_t p = second + TRITCOL_HEAD;
+            while (bad[p] < TRIT5_STATES) {
+                p++;
+            }
+            bad[p] = TRIT5_BIAS;
+            break;
+        }
+        }
+        // [vals[1], vals[1]] straddles both blocks, so both are decoded
+        int ok = tritcol_decode(bad, blen, back, n) == TRITCOL_ERROR &&
+                 tritcol_count_range(bad, blen, vals[1], vals[1]) == TRITCOL_ERROR;
+        snprintf(name, sizeof(name), "%s → TRITCOL_ERROR", damage[c]);
+        test_assert(ok, name);
+    }
+
+    // Trailing bytes shorter than a header; output too small
+    memcpy(bad, col, len);
+    bad[len] = 0;
+    test_assert(tritcol_count(bad, len + 1) == TRITCOL_ERROR &&
+                tritcol_decode(bad, len + 1, back, n) == TRITCOL_ERROR,
+                "a stray trailing byte → TRITCOL_ERROR");
+    test_assert(tritcol_decode(col, len, back, n - 1) == TRITCOL_ERROR &&
+                tritcol_decode(col, len, back, n) == n,
+                "cap one short → TRITCOL_ERROR, exact cap → n");
+
+    // The error latches
+    tritcol_reader_t r;
+    int64_t block[TRITCOL_BLOCK];
+    memcpy(bad, col, len);
+    bad[24]++;
+    tritcol_reader_init(&r, bad, len);
+    int ok = tritcol_next(&r) && tritcol_read(&r, block) == TRITCOL_ERROR && r.error &&
+             !tritcol_next(&r) && tritcol_read(&r, block) == TRITCOL_ERROR;
+    test_assert(ok, "after a failed read, next and read keep failing");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritcol_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_tritcol_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Delta-Coded Integer Columns\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_tritcol_form();
+    test_tritcol_trips();
+    test_tritcol_reader();
+    test_tritcol_errors();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_tritcol_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ More shapes, lengths, ranges and damaged columns
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Byte layouts in TEST GROUP 1 (they pin the stored format)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "So teach us to number our days" — Psalm 90:12
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
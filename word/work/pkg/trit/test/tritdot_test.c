@@ -0,0 +1,439 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Ternary × Ternary Products
+// Key: B-word-work-pkg-trit-tritdot-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/array_test.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 2: BCT Parallel]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for tritdot.c - designed to FAIL MEANINGFULLY.
+// Every kernel must equal a trit_multiply loop (or, for Hamming, a
+// trit-compare loop) over the same trits.
+//
+// tritdot_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: A count of agreements must equal the sum of products.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH backend, length or shape diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check tritmat_dot/gemv/gemm_t64b against Σ trit_multiply and
+//          tritmat_hamming/gemm_hamming_t64b against Σ (a[i] != b[i]).
+//
+// Key Features:
+//   - All nine trit pairs, all-agree and all-disagree vectors
+//   - Every supported backend, every length 0-600 trits (kernel body,
+//     scalar tail) and one 79,800-trit dot (AVX2 flush interval)
+//   - GEMV/GEMM shapes across the 16-vector and 64-word blocks
+//   - tritmat_t5_to_t64b equals tritmat_pack_t64b
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-tritdot
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>   // printf
+#include <string.h>  // memcmp, memcpy
+
+//--- Project Headers ---
+#include "trit.h"    // trit types, trit_multiply, backends
+#include "tritmat.h" // ternary × ternary products
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_tritdot_run_all(void);                  // Run all tests, return failure count
+int test_tritdot_basic(void);      // Nine pairs, extremes, conversions
+int test_tritdot_backends(void);   // Each backend vs trit_multiply loop
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_tritdot_run_all()
+//   ├── test_tritdot_basic()    → nine pairs, extremes, conversions
+//   └── test_tritdot_backends() → check_backend() per supported backend
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (trit_multiply reference, backend loop)
+// ────────────────────────────────────────────────────────────────
+
+#define MAX_LEN    600
+#define MAX_ROWS   19
+#define MAX_COLS   4200
+#define MAX_BATCH  33
+
+static trit_t a_trits[MAX_ROWS * MAX_COLS];
+static trit_t b_trits[MAX_BATCH * MAX_COLS];
+static trit64b_t a_vec[MAX_ROWS * TRITMAT_ROW_VECTORS(MAX_COLS)];
+static trit64b_t b_vec[MAX_BATCH * TRITMAT_ROW_VECTORS(MAX_COLS)];
+static int32_t y[MAX_ROWS * MAX_BATCH + 1];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+// Shapes straddle the 16-vector batch block and 64-word column block.
+static const size_t shapes[][3] = {   // rows, cols, batch
+    { 1, 1, 1 }, { 3, 63, 2 }, { 5, 64, 1 }, { 2, 65, 17 }, { 19, 4095, 3 },
+    { 4, 4096, 16 }, { 3, 4200, 33 }, { 0, 100, 2 }, { 2, 0, 2 }
+};
+
+// fill_random sets n pseudo-random trits.
+static void fill_random(trit_t *out, size_t n, uint32_t seed) {
+    for (size_t i = 0; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        out[i] = (trit_t)((int)((seed >> 20) % 3) - 1);
+    }
+}
+
+// reference returns Σ trit_multiply(a[i], b[i]).
+static int64_t reference(const trit_t *a, const trit_t *b, size_t n) {
+    int64_t s = 0;
+    for (size_t i = 0; i < n; i++) {
+        s += trit_multiply(a[i], b[i]);
+    }
+    return s;
+}
+
+// reference_hamming returns the number of positions where a and b differ.
+static int64_t reference_hamming(const trit_t *a, const trit_t *b, size_t n) {
+    int64_t s = 0;
+    for (size_t i = 0; i < n; i++) {
+        s += a[i] != b[i];
+    }
+    return s;
+}
+
+// check_backend runs dot over every length 0-MAX_LEN, then GEMV and GEMM
+// over every shape. Returns 1 if everything matched.
+static int check_backend(trit_backend_t backend) {
+    if (!trit_backend_select(backend)) {
+        return 0;
+    }
+
+    for (size_t n = 0; n <= MAX_LEN; n++) {
+        fill_random(a_trits, n, 3u * (uint32_t)n + 1u);
+        fill_random(b_trits, n, 7u * (uint32_t)n + 2u);
+        tritmat_pack_t64b(a_trits, 1, n, a_vec);
+        tritmat_pack_t64b(b_trits, 1, n, b_vec);
+        int64_t got = tritmat_dot_t64b(a_vec, b_vec, n);
+        if (got != reference(a_trits, b_trits, n)) {
+            printf("    %s: dot length %zu: %lld != %lld\n", trit_backend_name(backend), n,
+                   (long long)got, (long long)reference(a_trits, b_trits, n));
+            return 0;
+        }
+        got = tritmat_hamming_t64b(a_vec, b_vec, n);
+        if (got != reference_hamming(a_trits, b_trits, n)) {
+            printf("    %s: hamming length %zu: %lld != %lld\n", trit_backend_name(backend), n,
+                   (long long)got, (long long)reference_hamming(a_trits, b_trits, n));
+            return 0;
+        }
+    }
+
+    // One long dot crosses many AVX2 flush intervals
+    size_t big = MAX_ROWS * MAX_COLS;
+    fill_random(a_trits, big, 17u);
+    fill_random(b_trits, big / 4, 19u);
+    memcpy(b_trits + big / 4, a_trits + big / 4, big - big / 4);   // mostly agree
+    tritmat_pack_t64b(a_trits, 1, big, a_vec);
+    tritmat_pack_t64b(b_trits, 1, big, b_vec);
+    if (tritmat_dot_t64b(a_vec, b_vec, big) != reference(a_trits, b_trits, big)) {
+        printf("    %s: dot length %zu differs\n", trit_backend_name(backend), big);
+        return 0;
+    }
+    if (tritmat_hamming_t64b(a_vec, b_vec, big) != reference_hamming(a_trits, b_trits, big)) {
+        printf("    %s: hamming length %zu differs\n", trit_backend_name(backend), big);
+        return 0;
+    }
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        size_t rows = shapes[s][0], cols = shapes[s][1], batch = shapes[s][2];
+        fill_random(a_trits, rows * cols, 11u + (uint32_t)s);
+        fill_random(b_trits, batch * cols, 13u * (uint32_t)s);
+        tritmat_pack_t64b(a_trits, rows, cols, a_vec);
+        tritmat_pack_t64b(b_trits, batch, cols, b_vec);
+        // mode 0: gemm, 1: gemv, 2: gemm_hamming
+        for (int mode = 0; mode < 3; mode++) {
+            size_t nb = mode == 1 ? 1 : batch;
+            y[rows * nb] = 12345;
+            if (mode == 1) {
+                tritmat_gemv_t64b(a_vec, rows, cols, b_vec, y);
+            } else if (mode == 2) {
+                tritmat_gemm_hamming_t64b(a_vec, rows, cols, b_vec, nb, y);
+            } else {
+                tritmat_gemm_t64b(a_vec, rows, cols, b_vec, nb, y);
+            }
+            for (size_t r = 0; r < rows; r++) {
+                for (size_t b = 0; b < nb; b++) {
+                    const trit_t *ar = a_trits + r * cols, *bb = b_trits + b * cols;
+                    int64_t ref = mode == 2 ? reference_hamming(ar, bb, cols)
+                                            : reference(ar, bb, cols);
+                    if (y[r * nb + b] != ref) {
+                        static const char *const mode_name[] = { "gemm", "gemv", "gemm_hamming" };
+                        printf("    %s: %s %zu×%zu batch %zu, row %zu vector %zu: %d != %lld\n",
+                               trit_backend_name(backend), mode_name[mode],
+                               rows, cols, nb, r, b, y[r * nb + b], (long long)ref);
+                        return 0;
+                    }
+                }
+            }
+            if (y[rows * nb] != 12345) {
+                printf("    %s: wrote past %zu outputs\n", trit_backend_name(backend), rows * nb);
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritdot_basic: Truth Table, Extremes, Conversions
+// ────────────────────────────────────────────────────────────────
+
+int test_tritdot_basic(void) {
+    print_header("Ternary Dot Unit Tests: Basics");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Each of the nine trit pairs on its own
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing all input pairs (active backend: %s):\n",
+           trit_backend_name(trit_backend_active()));
+
+    int pairs_ok = 1;
+    for (int i = 0; i < 9; i++) {
+        trit_t a = (trit_t)(i % 3 - 1), b = (trit_t)(i / 3 - 1);
+        trit64b_t va = trit64b_from_trits(&a, 1), vb = trit64b_from_trits(&b, 1);
+        if (tritmat_dot_t64b(&va, &vb, 1) != trit_multiply(a, b)) pairs_ok = 0;
+        if (tritmat_hamming_t64b(&va, &vb, 1) != (a != b)) pairs_ok = 0;
+    }
+    test_assert(pairs_ok, "dot = trit_multiply and distance = (a != b) for all nine pairs");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: All agree, all disagree
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing extremes:\n");
+
+    size_t n = 1000;
+    for (size_t i = 0; i < n; i++) {
+        a_trits[i] = (i & 1) ? TRIT_POS : TRIT_NEG;
+        b_trits[i] = trit_negate(a_trits[i]);
+    }
+    tritmat_pack_t64b(a_trits, 1, n, a_vec);
+    tritmat_pack_t64b(b_trits, 1, n, b_vec);
+    test_assert(tritmat_dot_t64b(a_vec, a_vec, n) == 1000, "a·a = 1000 for 1000 nonzero trits");
+    test_assert(tritmat_dot_t64b(a_vec, b_vec, n) == -1000, "a·(-a) = -1000");
+    test_assert(tritmat_hamming_t64b(a_vec, a_vec, n) == 0, "d(a, a) = 0");
+    test_assert(tritmat_hamming_t64b(a_vec, b_vec, n) == 1000, "d(a, -a) = 1000");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: t5b1 rows convert to the same planes
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing tritmat_t5_to_t64b:\n");
+
+    static uint8_t packed[7 * TRITMAT_ROW_BYTES(301)];
+    static trit64b_t from_t5[7 * TRITMAT_ROW_VECTORS(301)];
+    fill_random(a_trits, 7 * 301, 99u);
+    tritmat_pack(a_trits, 7, 301, packed);
+    size_t nv = tritmat_t5_to_t64b(packed, 7, 301, from_t5);
+    tritmat_pack_t64b(a_trits, 7, 301, a_vec);
+    test_assert(nv == 7 * 5 && memcmp(from_t5, a_vec, nv * sizeof(trit64b_t)) == 0,
+                "7×301 t5b1 rows → 35 vectors, same as tritmat_pack_t64b");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritdot_backends: Every Backend vs trit_multiply Loop
+// ────────────────────────────────────────────────────────────────
+
+int test_tritdot_backends(void) {
+    print_header("Ternary Dot Unit Tests: Backends");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: Every supported backend
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing each supported backend against trit_multiply and compare loops:\n");
+
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        char name[96];
+        if (!trit_backend_supported(backends[i])) {
+            printf("    (skip %s: not supported on this CPU)\n", trit_backend_name(backends[i]));
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s: dot/hamming lengths 0-%d, gemv/gemm %zu shapes",
+                 trit_backend_name(backends[i]), MAX_LEN, sizeof(shapes) / sizeof(shapes[0]));
+        test_assert(check_backend(backends[i]), name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritdot_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_tritdot_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Ternary × Ternary Products\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_tritdot_basic();
+    test_tritdot_backends();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_tritdot_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add shapes (keep MAX_* in step)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = Σ trit_multiply (Σ a != b) over unpacked trits
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Can two walk together, except they be agreed?" — Amos 3:3
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,549 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Memory-Mapped .t5 Trit Files
+// Key: B-word-work-pkg-trit-tritfile-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for tritfile.h and backend dispatch. Writes
+//   and removes build/tritfile_test.t5 (run from the package directory,
+//   as make test-tritfile does).
+//
+// derives_from: bereshit/word/work/pkg/trit/test/tritcol_test.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Memory Alignment]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for tritfile.c - designed to FAIL MEANINGFULLY.
+// Every trit read back through the mapping must be the trit written, and
+// every damaged file must be refused with the status that names the
+// damage.
+//
+// tritfile_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "shut up the words, and seal the book" — Daniel 12:4
+//
+// Principle: A broken seal must be noticed before the book is read.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH field, chunk edge, access path or fault diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check tritfile_write, tritfile_open, tritfile_get,
+//          tritfile_slice, tritfile_chunk and tritfile_verify.
+//
+// Key Features:
+//   - Header, chunk table, padding and payload bytes of small files
+//   - get / slice / chunk against the source at chunk and byte edges,
+//     slices per backend
+//   - Missing, short, mislabelled, resealed-but-inconsistent and
+//     truncated files; payload damage found by tritfile_verify
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-tritfile
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>        // printf, fopen, remove
+#include <string.h>       // memcmp, memcpy
+
+//--- Project Headers ---
+#include "tritfile.h"     // tritfile_*, TRITFILE_*
+#include "trit.h"         // trit5_pack_array, backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+#define FILE_PATH    "build/tritfile_test.t5"
+#define FILE_TRITS   5000
+#define FILE_MAX     (TRITFILE_HEAD + 4 * FILE_TRITS + 64 + TRIT5_PACKED_SIZE(FILE_TRITS))
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_tritfile_run_all(void);    // Run all tests, return failure count
+int test_tritfile_form(void);       // Header, table and payload bytes
+int test_tritfile_access(void);     // get, slice, chunk
+int test_tritfile_errors(void);     // Damaged files
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_tritfile_run_all()
+//   ├── test_tritfile_form()   → field offsets, Adler-32, padding
+//   ├── test_tritfile_access() → lengths × chunk edges, slices, backends
+//   └── test_tritfile_errors() → missing, short, damaged, truncated
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (source trits, raw file bytes)
+// ────────────────────────────────────────────────────────────────
+
+static trit_t src[FILE_TRITS];
+static trit_t back[FILE_TRITS + 1];
+static uint8_t packed[TRIT5_PACKED_SIZE(FILE_TRITS)];
+static uint8_t raw[FILE_MAX + 1];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+static uint64_t rng_state = 1u;
+
+static uint64_t rng(void) {
+    rng_state = rng_state * 6364136223846793005u + 1442695040888963407u;
+    return rng_state >> 11;
+}
+
+static void fill(size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        src[i] = (trit_t)((int)(rng() % 3) - 1);
+    }
+    trit5_pack_array(src, n, packed);
+}
+
+// Whole file into raw; returns its length (0 if unreadable).
+static size_t get_file(void) {
+    FILE *fp = fopen(FILE_PATH, "rb");
+    if (fp == NULL) {
+        return 0;
+    }
+    size_t len = fread(raw, 1, sizeof(raw), fp);
+    fclose(fp);
+    return len;
+}
+
+static void put_file(size_t len) {
+    FILE *fp = fopen(FILE_PATH, "wb");
+    if (fp != NULL) {
+        fwrite(raw, 1, len, fp);
+        fclose(fp);
+    }
+}
+
+static uint32_t le32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint64_t le64(const uint8_t *p) {
+    return (uint64_t)le32(p) | (uint64_t)le32(p + 4) << 32;
+}
+
+// Textbook Adler-32 (one modulo per byte), independent of tritfile.c.
+static uint32_t adler(uint32_t sum, const uint8_t *p, size_t n) {
+    uint32_t a = sum & 0xFFFF;
+    uint32_t b = sum >> 16;
+    for (size_t i = 0; i < n; i++) {
+        a = (a + p[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return b << 16 | a;
+}
+
+// Recompute the header checksum of raw after editing fields, so the
+// edit reaches the field checks behind it.
+static void reseal(void) {
+    uint8_t head[TRITFILE_HEAD];
+    memcpy(head, raw, TRITFILE_HEAD);
+    memset(head + 48, 0, 4);
+    uint32_t s = adler(adler(1, head, TRITFILE_HEAD), raw + TRITFILE_HEAD, 4 * (size_t)le64(raw + 24));
+    raw[48] = (uint8_t)s;
+    raw[49] = (uint8_t)(s >> 8);
+    raw[50] = (uint8_t)(s >> 16);
+    raw[51] = (uint8_t)(s >> 24);
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritfile_form: Header, Table and Payload Bytes
+// ────────────────────────────────────────────────────────────────
+
+int test_tritfile_form(void) {
+    print_header("TEST: File Layout");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Field offsets, checksums and padding
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing layout:\n");
+
+    // 12 trits in 3 bytes, chunks of 2 bytes: table of 2, payload at 128
+    fill(12);
+    test_assert(tritfile_write(FILE_PATH, packed, 12, 2) == TRITFILE_OK, "write 12 trits, 2-byte chunks");
+    size_t len = get_file();
+    test_assert(len == 131, "file is 128 + 3 bytes");
+    test_assert(memcmp(raw, "TRIT5\r\n\032", 8) == 0, "magic");
+    test_assert(raw[8] == 1 && raw[9] == 0 && raw[10] == 64 && raw[11] == 0,
+                "version 1, header 64 bytes");
+    test_assert(le32(raw + 12) == 2 && le64(raw + 16) == 12 && le64(raw + 24) == 2 &&
+                le64(raw + 32) == 128 && le64(raw + 40) == 3,
+                "chunk 2, count 12, chunks 2, offset 128, payload 3");
+    int zero = 1;
+    for (size_t i = 52; i < 64; i++) {
+        zero &= raw[i] == 0;
+    }
+    for (size_t i = 72; i < 128; i++) {
+        zero &= raw[i] == 0;
+    }
+    test_assert(zero, "reserved bytes and padding are 0");
+    test_assert(le32(raw + 64) == adler(1, packed, 2) && le32(raw + 68) == adler(1, packed + 2, 1),
+                "chunk table: Adler-32 of bytes 0-1 and of byte 2");
+    uint8_t head[TRITFILE_HEAD];
+    memcpy(head, raw, TRITFILE_HEAD);
+    memset(head + 48, 0, 4);
+    test_assert(le32(raw + 48) == adler(adler(1, head, TRITFILE_HEAD), raw + 64, 8),
+                "header checksum covers header and table");
+    test_assert(memcmp(raw + 128, packed, 3) == 0, "payload is the t5b1 bytes");
+
+    // Adler-32 reference value; chunk 0 means TRITFILE_CHUNK
+    memcpy(packed, "Wikipedia", 9);
+    test_assert(tritfile_write(FILE_PATH, packed, 45, 0) == TRITFILE_OK && get_file() == 128 + 9 &&
+                le32(raw + 12) == TRITFILE_CHUNK && le32(raw + 64) == 0x11E60398u,
+                "\"Wikipedia\" chunk sums to 0x11E60398, default chunk size");
+
+    // Nothing but the header and padding
+    test_assert(tritfile_write(FILE_PATH, packed, 0, 0) == TRITFILE_OK && get_file() == 64 &&
+                le64(raw + 24) == 0 && le64(raw + 32) == 64,
+                "0 trits: 64-byte file, no chunks");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritfile_access: get, slice, chunk
+// ────────────────────────────────────────────────────────────────
+
+int test_tritfile_access(void) {
+    print_header("TEST: Mapped Access");
+    char name[128];
+    tritfile_t f;
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Lengths around chunk and byte edges
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing lengths (7-byte chunks = 35 trits):\n");
+
+    static const size_t lens[] = { 0, 1, 4, 5, 6, 34, 35, 36, 70, 71, 999, FILE_TRITS };
+    for (size_t c = 0; c < sizeof(lens) / sizeof(lens[0]); c++) {
+        size_t n = lens[c];
+        fill(n);
+        int ok = tritfile_write(FILE_PATH, packed, n, 7) == TRITFILE_OK &&
+                 tritfile_open(&f, FILE_PATH) == TRITFILE_OK &&
+                 f.count == n && f.chunk == 7 && f.chunks == (TRIT5_PACKED_SIZE(n) + 6) / 7;
+        for (size_t i = 0; ok && i < n; i++) {
+            ok = tritfile_get(&f, i) == src[i];
+        }
+        size_t total = 0;
+        for (size_t k = 0; ok && k < f.chunks; k++) {
+            size_t cn = 0;
+            const uint8_t *p = tritfile_chunk(&f, k, &cn);
+            ok = p == f.data + 7 * k && cn == (n - total < 35 ? n - total : 35) &&
+                 tritfile_verify(&f, k);
+            total += cn;
+        }
+        size_t cn = 0;
+        ok = ok && total == n && tritfile_chunk(&f, f.chunks, &cn) == NULL &&
+             !tritfile_verify(&f, f.chunks);
+        back[n] = 0x5a;
+        ok = ok && tritfile_slice(&f, 0, n, back) == n && memcmp(back, src, n) == 0 && back[n] == 0x5a;
+        tritfile_close(&f);
+        snprintf(name, sizeof(name), "%zu trits: get, chunks, verify and full slice", n);
+        test_assert(ok, name);
+    }
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Slices at every offset, clamping, backends
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing slices:\n");
+
+    fill(FILE_TRITS);
+    tritfile_write(FILE_PATH, packed, FILE_TRITS, 0);
+    test_assert(tritfile_open(&f, FILE_PATH) == TRITFILE_OK && f.chunks == 1, "open 5000 trits");
+    int ok = 1;
+    for (size_t i = 0; i < 12; i++) {
+        for (size_t n = 0; n <= 40; n++) {
+            memset(back, 0x5a, n + 1);
+            ok &= tritfile_slice(&f, i, n, back) == n && memcmp(back, src + i, n) == 0 &&
+                  back[n] == 0x5a;
+        }
+    }
+    test_assert(ok, "offsets 0-11 × lengths 0-40");
+    test_assert(tritfile_slice(&f, FILE_TRITS - 3, 10, back) == 3 &&
+                memcmp(back, src + FILE_TRITS - 3, 3) == 0,
+                "a slice past the end stops at the end");
+    test_assert(tritfile_slice(&f, FILE_TRITS, 10, back) == 0 &&
+                tritfile_slice(&f, UINT64_MAX, 10, back) == 0,
+                "a slice starting at or past the end is empty");
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        if (!trit_backend_select(backends[b])) {
+            continue;
+        }
+        ok = tritfile_slice(&f, 3, FILE_TRITS - 3, back) == FILE_TRITS - 3 &&
+             memcmp(back, src + 3, FILE_TRITS - 3) == 0;
+        snprintf(name, sizeof(name), "%s: slice from trit 3 to the end", trit_backend_name(backends[b]));
+        test_assert(ok, name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+    tritfile_close(&f);
+    test_assert(f.map == NULL && f.count == 0, "close zeroes the handle");
+
+    // A spare-state payload byte reads as zeros
+    packed[1] = 250;
+    tritfile_write(FILE_PATH, packed, 10, 0);
+    ok = tritfile_open(&f, FILE_PATH) == TRITFILE_OK;
+    for (size_t i = 5; ok && i < 10; i++) {
+        ok = tritfile_get(&f, i) == TRIT_ZERO;
+    }
+    tritfile_close(&f);
+    test_assert(ok, "spare byte 250 → five zero trits");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritfile_errors: Damaged Files
+// ────────────────────────────────────────────────────────────────
+
+int test_tritfile_errors(void) {
+    print_header("TEST: Damaged Files");
+    char name[128];
+    tritfile_t f;
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: Files the header checks refuse
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing damage:\n");
+
+    remove(FILE_PATH);
+    test_assert(tritfile_open(&f, FILE_PATH) == TRITFILE_ERR_IO && f.map == NULL,
+                "missing file → TRITFILE_ERR_IO");
+    test_assert(tritfile_write("build/no-such-dir/x.t5", packed, 5, 0) == TRITFILE_ERR_IO,
+                "unwritable path → TRITFILE_ERR_IO");
+    test_assert(tritfile_write(FILE_PATH, packed, 5, SIZE_MAX) == TRITFILE_ERR_FORMAT,
+                "chunk SIZE_MAX → TRITFILE_ERR_FORMAT");
+
+    // 100 trits in 20 bytes, 7-byte chunks: 3 chunks
+    fill(100);
+    tritfile_write(FILE_PATH, packed, 100, 7);
+    size_t len = get_file();
+    uint8_t good[FILE_MAX];
+    memcpy(good, raw, len);
+
+    static const struct {
+        const char *what;
+        tritfile_status_t want;
+    } damage[] = {
+        { "shorter than a header", TRITFILE_ERR_FORMAT },
+        { "magic changed", TRITFILE_ERR_FORMAT },
+        { "version 2", TRITFILE_ERR_VERSION },
+        { "chunk table past the end", TRITFILE_ERR_FORMAT },
+        { "count changed", TRITFILE_ERR_CHECKSUM },
+        { "reserved byte set", TRITFILE_ERR_CHECKSUM },
+        { "chunk table entry changed", TRITFILE_ERR_CHECKSUM },
+        { "resealed: count 5 more (payload too short)", TRITFILE_ERR_FORMAT },
+        { "resealed: header size 128", TRITFILE_ERR_FORMAT },
+        { "resealed: reserved byte set", TRITFILE_ERR_FORMAT },
+        { "resealed: chunk 0", TRITFILE_ERR_FORMAT },
+        { "resealed: chunk 10 (chunk count disagrees)", TRITFILE_ERR_FORMAT },
+        { "resealed: payload offset + 64", TRITFILE_ERR_FORMAT },
+        { "truncated by one byte", TRITFILE_ERR_FORMAT },
+        { "one trailing byte", TRITFILE_ERR_FORMAT }
+    };
+    for (size_t c = 0; c < sizeof(damage) / sizeof(damage[0]); c++) {
+        size_t blen = len;
+        memcpy(raw, good, len);
+        switch (c) {
+        case 0:  blen = 40; break;
+        case 1:  raw[0] = 't'; break;
+        case 2:  raw[8] = 2; break;
+        case 3:  raw[24] = 200; break;
+        case 4:  raw[16]++; break;
+        case 5:  raw[60] = 1; break;
+        case 6:  raw[64] ^= 1; break;
+        case 7:  raw[16] += 5; reseal(); break;
+        case 8:  raw[10] = 128; reseal(); break;
+        case 9:  raw[60] = 1; reseal(); break;
+        case 10: raw[12] = 0; reseal(); break;
+        case 11: raw[12] = 10; reseal(); break;
+        case 12: raw[32] += 64; reseal(); break;
+        case 13: blen = len - 1; break;
+        default: raw[len] = 0; blen = len + 1; break;
+        }
+        put_file(blen);
+        int ok = tritfile_open(&f, FILE_PATH) == damage[c].want && f.map == NULL && f.data == NULL;
+        tritfile_close(&f);
+        snprintf(name, sizeof(name), "%s → status %d", damage[c].what, (int)damage[c].want);
+        test_assert(ok, name);
+    }
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: Payload damage opens, and verify finds it
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing payload checks:\n");
+
+    memcpy(raw, good, len);
+    raw[le64(good + 32) + 9] ^= 1;    // byte 9: chunk 1
+    put_file(len);
+    int ok = tritfile_open(&f, FILE_PATH) == TRITFILE_OK &&
+             tritfile_verify(&f, 0) && !tritfile_verify(&f, 1) && tritfile_verify(&f, 2);
+    tritfile_close(&f);
+    test_assert(ok, "flipped payload bit: opens, only chunk 1 fails verify");
+
+    remove(FILE_PATH);
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritfile_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_tritfile_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Memory-Mapped .t5 Trit Files\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_tritfile_form();
+    test_tritfile_access();
+    test_tritfile_errors();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_tritfile_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ More lengths, chunk sizes, slices and damaged files
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Byte layouts in TEST GROUP 1 (they pin the stored format)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "shut up the words, and seal the book" — Daniel 12:4
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
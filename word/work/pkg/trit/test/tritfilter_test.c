@@ -0,0 +1,465 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Three-Valued Column Filters
+// Key: B-word-work-pkg-trit-tritfilter-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/logic_test.c (structure)
+// See: word/research/ternary/ternary-logic-algorithms.adoc [Dyadic Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for tritfilter.c - designed to FAIL MEANINGFULLY.
+// Every row's verdict must equal the tree evaluated row by row.
+//
+// tritfilter_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: A skip is only allowed if nobody can tell it happened.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH tree, backend, length or row diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check the tritfilter builders, bitmaps and selection vectors.
+//
+// Key Features:
+//   - Builder limits: full filter, bad operands, bad tables, -1 chaining
+//   - Fixed and random trees vs a per-row bool3 reference
+//   - Every backend; lengths 0-300 and around chunk edges
+//   - Columns with long all-false runs, so AND/OR skips are taken
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-tritfilter
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>        // printf
+#include <string.h>       // memset
+
+//--- Project Headers ---
+#include "tritfilter.h"   // tritfilter_t, builders, evaluation
+#include "logic.h"        // bool3 scalar connectives (reference)
+#include "trit.h"         // backends
+#include "tritop.h"       // trit_op1_eval
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+#define COLUMNS   4
+#define BIG_ROWS  (5 * TRITFILTER_CHUNK + 77)   // several chunks + a partial one
+#define TREES     40
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_tritfilter_run_all(void);     // Run all tests, return failure count
+int test_tritfilter_build(void);       // Builder limits
+int test_tritfilter_eval(void);        // Bitmaps and selections per backend
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_tritfilter_run_all()
+//   ├── test_tritfilter_build() → limits, -1 chaining, empty filter
+//   └── test_tritfilter_eval()  → check_filter() per tree, per backend
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (columns, reference evaluation, random trees)
+// ────────────────────────────────────────────────────────────────
+
+static trit_t column_data[COLUMNS][BIG_ROWS];
+static const trit_t *columns[COLUMNS];
+static uint64_t bits_true[TRITFILTER_BITMAP_WORDS(BIG_ROWS)];
+static uint64_t bits_unknown[TRITFILTER_BITMAP_WORDS(BIG_ROWS)];
+static uint32_t sel_true[BIG_ROWS + 1], sel_unknown[BIG_ROWS + 1];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+static uint32_t rng_state = 1u;
+
+static uint32_t rng(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+
+// fill_columns sets random values; columns 2 and 3 are mostly false in
+// runs longer than a chunk so AND skips (and OR on their negation) fire.
+static void fill_columns(void) {
+    for (int c = 0; c < COLUMNS; c++) {
+        for (size_t i = 0; i < BIG_ROWS; i++) {
+            int run_false = c >= 2 && (i / (TRITFILTER_CHUNK + 300)) % 2 == (size_t)(c - 2);
+            column_data[c][i] = run_false ? BOOL3_FALSE : (trit_t)((int)(rng() % 3) - 1);
+        }
+        columns[c] = column_data[c];
+    }
+}
+
+// reference evaluates node idx for one row with the scalar connectives.
+static bool3_t reference(const tritfilter_t *f, size_t idx, size_t row) {
+    const tritfilter_node_t *nd = &f->node[idx];
+    switch (nd->kind) {
+    case TRITFILTER_COLUMN: return trit_op1_eval(nd->table, columns[nd->a][row]);
+    case TRITFILTER_NOT:    return bool3_not(reference(f, nd->a, row));
+    case TRITFILTER_AND:    return bool3_and(reference(f, nd->a, row), reference(f, nd->b, row));
+    default:                return bool3_or(reference(f, nd->a, row), reference(f, nd->b, row));
+    }
+}
+
+static bool3_t reference_row(const tritfilter_t *f, size_t row) {
+    return f->count == 0 ? BOOL3_TRUE : reference(f, f->count - 1, row);
+}
+
+// random_tree builds a random tree of about 'size' nodes: a pool holds
+// the nodes not yet used as operands, each operator consumes from it.
+static void random_tree(tritfilter_t *f, int size) {
+    int pool[TRITFILTER_MAX_NODES], live = 0;
+    tritfilter_init(f);
+    while ((int)f->count < size || live > 1) {
+        uint32_t pick = live < 2 ? rng() % 2 : rng() % 5;
+        if ((int)f->count >= size) pick = 3 + rng() % 2;    // finish: combine the pool
+        if ((int)f->count == TRITFILTER_MAX_NODES) break;
+        if (pick == 0) {
+            uint8_t table = (rng() % 2) ? TRIT_OP1_IDENTITY : (uint8_t)(rng() % TRIT_OP1_STATES);
+            pool[live++] = tritfilter_column(f, rng() % COLUMNS, table);
+        } else if (pick <= 2 && live > 0) {
+            int k = (int)(rng() % (uint32_t)live);
+            pool[k] = pick == 1 ? tritfilter_not(f, pool[k]) : pool[k];
+            if (pick == 2) pool[live++] = tritfilter_column(f, rng() % COLUMNS, TRIT_OP1_IDENTITY);
+        } else if (live >= 2) {
+            int x = pool[--live], y = pool[--live];
+            pool[live++] = (pick == 3) ? tritfilter_and(f, x, y) : tritfilter_or(f, x, y);
+        } else {
+            pool[live++] = tritfilter_column(f, rng() % COLUMNS, TRIT_OP1_IDENTITY);
+        }
+    }
+}
+
+// check_filter evaluates f over n rows both ways and compares with the
+// reference. Returns 1 if every row matched.
+static int check_filter(const tritfilter_t *f, size_t n, const char *what) {
+    size_t words = TRITFILTER_BITMAP_WORDS(n);
+    memset(bits_true, 0xA5, sizeof(bits_true));
+    memset(bits_unknown, 0xA5, sizeof(bits_unknown));
+    tritfilter_bitmap(f, columns, n, bits_true, bits_unknown);
+    size_t nu = 12345, nt = tritfilter_select(f, columns, n, sel_true, sel_unknown, &nu);
+
+    size_t kt = 0, ku = 0;
+    for (size_t i = 0; i < n; i++) {
+        bool3_t want = reference_row(f, i);
+        int bt = (int)(bits_true[i / 64] >> (i % 64) & 1);
+        int bu = (int)(bits_unknown[i / 64] >> (i % 64) & 1);
+        if (bt != (want == BOOL3_TRUE) || bu != (want == BOOL3_UNKNOWN)) {
+            printf("    %s: %zu rows, bitmap row %zu differs\n", what, n, i);
+            return 0;
+        }
+        if (want == BOOL3_TRUE && (kt >= nt || sel_true[kt++] != i)) {
+            printf("    %s: %zu rows, sel_true misses row %zu\n", what, n, i);
+            return 0;
+        }
+        if (want == BOOL3_UNKNOWN && (ku >= nu || sel_unknown[ku++] != i)) {
+            printf("    %s: %zu rows, sel_unknown misses row %zu\n", what, n, i);
+            return 0;
+        }
+    }
+    if (kt != nt || ku != nu) {
+        printf("    %s: %zu rows, counts %zu/%zu, expected %zu/%zu\n", what, n, nt, nu, kt, ku);
+        return 0;
+    }
+    for (size_t w = 0; w < words; w++) {
+        if (n % 64 && w == words - 1 &&
+            ((bits_true[w] | bits_unknown[w]) >> (n % 64)) != 0) {
+            printf("    %s: %zu rows, bits set past n\n", what, n);
+            return 0;
+        }
+    }
+    if (words < TRITFILTER_BITMAP_WORDS(BIG_ROWS) && bits_true[words] != 0xA5A5A5A5A5A5A5A5ULL) {
+        printf("    %s: %zu rows, bitmap written past its words\n", what, n);
+        return 0;
+    }
+    // Count-only selection agrees
+    size_t cu = 0, ct = tritfilter_select(f, columns, n, NULL, NULL, &cu);
+    if (ct != nt || cu != nu) {
+        printf("    %s: %zu rows, count-only selection differs\n", what, n);
+        return 0;
+    }
+    return 1;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritfilter_build: Builder limits
+// ────────────────────────────────────────────────────────────────
+
+int test_tritfilter_build(void) {
+    print_header("Filter Unit Tests: Building");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Node indices and failures
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing builders:\n");
+
+    tritfilter_t f;
+    tritfilter_init(&f);
+    int a = tritfilter_column(&f, 0, TRIT_OP1_IDENTITY);
+    int b = tritfilter_column(&f, 1, TRIT_OP1_NEGATE);
+    int c = tritfilter_and(&f, a, b);
+    int d = tritfilter_not(&f, c);
+    test_assert(a == 0 && b == 1 && c == 2 && d == 3 && f.count == 4, "nodes numbered in build order");
+
+    test_assert(tritfilter_column(&f, 0, TRIT_OP1_STATES) == -1 &&
+                tritfilter_column(&f, 70000, TRIT_OP1_IDENTITY) == -1 &&
+                tritfilter_and(&f, a, 4) == -1 && tritfilter_or(&f, -1, a) == -1 &&
+                tritfilter_not(&f, -1) == -1 && f.count == 4,
+                "bad table, column or operand: -1, filter unchanged");
+    test_assert(tritfilter_and(&f, tritfilter_not(&f, -1), a) == -1 && f.count == 4,
+                "-1 passes through later builders");
+
+    tritfilter_init(&f);
+    int last = 0;
+    for (int k = 0; k < TRITFILTER_MAX_NODES; k++) {
+        last = tritfilter_column(&f, 0, TRIT_OP1_IDENTITY);
+    }
+    test_assert(last == TRITFILTER_MAX_NODES - 1 && tritfilter_column(&f, 0, TRIT_OP1_IDENTITY) == -1 &&
+                tritfilter_not(&f, 0) == -1 && f.count == TRITFILTER_MAX_NODES,
+                "full filter: -1");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Empty filter selects everything
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing the empty filter:\n");
+
+    tritfilter_init(&f);
+    fill_columns();
+    size_t nu = 9, nt = tritfilter_select(&f, columns, 1000, sel_true, sel_unknown, &nu);
+    test_assert(nt == 1000 && nu == 0 && sel_true[0] == 0 && sel_true[999] == 999,
+                "every row true, none unknown");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritfilter_eval: Bitmaps and selections per backend
+// ────────────────────────────────────────────────────────────────
+
+int test_tritfilter_eval(void) {
+    print_header("Filter Unit Tests: Evaluation");
+    fill_columns();
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Fixed trees (skips taken on the all-false runs)
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing fixed trees against the per-row reference:\n");
+
+    tritfilter_t f;
+    tritfilter_init(&f);
+    int rare = tritfilter_column(&f, 2, TRIT_OP1_IDENTITY);          // all false in runs
+    int pos = tritfilter_column(&f, 0, TRIT_OP1_ID(-1, -1, 1));      // trit == +1
+    int either = tritfilter_or(&f, pos, tritfilter_column(&f, 1, TRIT_OP1_IDENTITY));
+    tritfilter_and(&f, rare, either);
+    test_assert(check_filter(&f, BIG_ROWS, "rare AND (c0 = +1 OR c1)"), "rare AND (c0 = +1 OR c1)");
+
+    tritfilter_init(&f);
+    int never = tritfilter_not(&f, tritfilter_column(&f, 3, TRIT_OP1_IDENTITY));   // all true in runs
+    tritfilter_or(&f, never, tritfilter_column(&f, 0, TRIT_OP1_NEGATE));
+    test_assert(check_filter(&f, BIG_ROWS, "NOT rare OR NOT c0"), "NOT rare OR NOT c0 (OR skips)");
+
+    tritfilter_init(&f);
+    tritfilter_not(&f, tritfilter_column(&f, 1, TRIT_OP1_IDENTITY));
+    test_assert(check_filter(&f, 100, "NOT c1") && check_filter(&f, 63, "NOT c1"),
+                "NOT over a partial word selects no rows past n");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: Random trees on every backend
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing random trees per backend:\n");
+
+    static const size_t lengths[] = { TRITFILTER_CHUNK - 1, TRITFILTER_CHUNK, TRITFILTER_CHUNK + 1, BIG_ROWS };
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        char name[96];
+        if (!trit_backend_supported(backends[i])) {
+            printf("    (skip %s: not supported on this CPU)\n", trit_backend_name(backends[i]));
+            continue;
+        }
+        trit_backend_select(backends[i]);
+        int ok = 1;
+        rng_state = 99u;
+        for (int t = 0; t < TREES && ok; t++) {
+            random_tree(&f, 2 + t % (TRITFILTER_MAX_NODES - 1));
+            for (size_t n = 0; n <= 300 && ok; n += 1 + n / 16) {
+                ok = check_filter(&f, n, trit_backend_name(backends[i]));
+            }
+            for (size_t k = 0; k < sizeof(lengths) / sizeof(lengths[0]) && ok; k++) {
+                ok = check_filter(&f, lengths[k], trit_backend_name(backends[i]));
+            }
+        }
+        snprintf(name, sizeof(name), "%s: %d random trees, lengths 0-300 and chunk edges",
+                 trit_backend_name(backends[i]), TREES);
+        test_assert(ok, name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritfilter_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_tritfilter_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Three-Valued Column Filters\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_tritfilter_build();
+    test_tritfilter_eval();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_tritfilter_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add fixed trees to TEST GROUP 3, more random trees to GROUP 4
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = the tree evaluated row by row with logic.h scalars
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "By their fruits ye shall know them." — Matthew 7:20
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
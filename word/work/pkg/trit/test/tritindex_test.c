@@ -0,0 +1,562 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Nearest-Neighbour Search
+// Key: B-word-work-pkg-trit-tritindex-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/array_test.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 2: BCT Parallel]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for tritindex.c - designed to FAIL MEANINGFULLY.
+// Exhaustive search must equal a full sort of every score.
+//
+// tritindex_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: The k best are only the k best if every other one was
+//            looked at and found worse.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH metric, backend, k or list setting diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check tritindex search against a sorted trit-loop reference.
+//
+// Key Features:
+//   - Empty index, k past count, add_t5 = add_trits
+//   - Both metrics on every supported backend, k from 1 to past count
+//   - Lists: nprobe = nlist is exact, nprobe = 1 finds every stored
+//     vector by distance 0, vectors added after training are found
+//   - Query slices equal one call (the threading contract)
+//   - tritindex_search_mt / _t64b_mt equal one call at any thread count
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-tritindex
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>     // printf
+#include <stdlib.h>    // qsort
+#include <string.h>    // memcmp
+
+//--- Project Headers ---
+#include "trit.h"      // trit types, trit_multiply, backends
+#include "tritindex.h" // search index
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_tritindex_run_all(void);                   // Run all tests, return failure count
+int test_tritindex_basic(void);       // Empty index, padding, add paths
+int test_tritindex_exhaustive(void);  // Each backend vs sorted reference
+int test_tritindex_lists(void);       // Coarse lists, slices, threads
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_tritindex_run_all()
+//   ├── test_tritindex_basic()      → empty, padding, add_t5 = add_trits
+//   ├── test_tritindex_exhaustive() → check_exhaustive() per backend
+//   └── test_tritindex_lists()      → trained searches, slices, _mt
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (data, sorted reference, backend loop)
+// ────────────────────────────────────────────────────────────────
+
+#define COLS      150
+#define MAX_VECS  1200
+#define MAX_QUERY 37
+#define MAX_K     (MAX_VECS + 5)
+
+static trit_t vec_trits[MAX_VECS * COLS];
+static trit_t query_trits[MAX_QUERY * COLS];
+static uint8_t vec_t5[MAX_VECS * TRITMAT_ROW_BYTES(COLS)];
+static uint8_t query_t5[MAX_QUERY * TRITMAT_ROW_BYTES(COLS)];
+static tritindex_hit_t hits[MAX_QUERY * MAX_K];
+static tritindex_hit_t hits2[MAX_QUERY * MAX_K];
+static tritindex_hit_t expect[MAX_VECS];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+static const size_t ks[] = { 1, 10, 100, MAX_K };
+
+// fill_random sets n pseudo-random trits.
+static void fill_random(trit_t *out, size_t n, uint32_t seed) {
+    for (size_t i = 0; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        out[i] = (trit_t)((int)((seed >> 20) % 3) - 1);
+    }
+}
+
+// fill_clustered sets n vectors near 8 centers (about 1 trit in 10 changed),
+// so scores tie rarely and lists have structure.
+static void fill_clustered(trit_t *out, size_t n, uint32_t seed) {
+    static trit_t centers[8 * COLS];
+    fill_random(centers, 8 * COLS, seed);
+    fill_random(out, n * COLS, seed + 1u);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t c = 0; c < COLS; c++) {
+            seed = seed * 1664525u + 1013904223u;
+            if ((seed >> 24) % 10 != 0) {
+                out[i * COLS + c] = centers[(i % 8) * COLS + c];
+            }
+        }
+    }
+}
+
+static int32_t score_of(const trit_t *a, const trit_t *b, tritindex_metric_t metric) {
+    int32_t s = 0;
+    for (size_t c = 0; c < COLS; c++) {
+        s += metric == TRITINDEX_HAMMING ? (a[c] != b[c]) : trit_multiply(a[c], b[c]);
+    }
+    return s;
+}
+
+static tritindex_metric_t sort_metric;
+
+// Best first: higher dot / lower distance, then lower id.
+static int compare_hits(const void *pa, const void *pb) {
+    const tritindex_hit_t *a = pa, *b = pb;
+    if (a->score != b->score) {
+        int better = sort_metric == TRITINDEX_HAMMING ? a->score < b->score : a->score > b->score;
+        return better ? -1 : 1;
+    }
+    return a->id < b->id ? -1 : (a->id > b->id);
+}
+
+// check_hits compares one query's k hits with the sorted reference over
+// the first n stored vectors. Returns 1 on match.
+static int check_hits(const tritindex_hit_t *got, size_t n, size_t k, const trit_t *query,
+                      tritindex_metric_t metric) {
+    for (size_t i = 0; i < n; i++) {
+        expect[i].id = i;
+        expect[i].score = score_of(vec_trits + i * COLS, query, metric);
+    }
+    sort_metric = metric;
+    qsort(expect, n, sizeof(expect[0]), compare_hits);
+    for (size_t i = 0; i < k; i++) {
+        size_t id = i < n ? expect[i].id : TRITINDEX_NO_ID;
+        int32_t score = i < n ? expect[i].score : 0;
+        if (got[i].id != id || got[i].score != score) {
+            printf("    hit %zu of %zu: (%zu, %d) != (%zu, %d)\n", i, k,
+                   got[i].id, got[i].score, id, score);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// check_exhaustive searches MAX_QUERY queries for every k and both
+// metrics. Returns 1 if everything matched.
+static int check_exhaustive(const tritindex_t *idx, trit_backend_t backend) {
+    if (!trit_backend_select(backend)) {
+        return 0;
+    }
+    for (int m = 0; m < 2; m++) {
+        tritindex_metric_t metric = m ? TRITINDEX_HAMMING : TRITINDEX_DOT;
+        for (size_t ki = 0; ki < sizeof(ks) / sizeof(ks[0]); ki++) {
+            size_t k = ks[ki];
+            if (!tritindex_search(idx, query_t5, MAX_QUERY, metric, k, 0, hits)) {
+                return 0;
+            }
+            for (size_t q = 0; q < MAX_QUERY; q++) {
+                if (!check_hits(hits + q * k, idx->count, k, query_trits + q * COLS, metric)) {
+                    printf("    %s: %s k = %zu, query %zu\n", trit_backend_name(backend),
+                           m ? "hamming" : "dot", k, q);
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritindex_basic: Empty Index, Padding, Add Paths
+// ────────────────────────────────────────────────────────────────
+
+int test_tritindex_basic(void) {
+    print_header("Nearest-Neighbour Unit Tests: Basics");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Empty index and k past count
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing empty and small indexes:\n");
+
+    tritindex_t idx;
+    tritindex_init(&idx, COLS);
+    fill_random(query_trits, COLS, 5u);
+    tritmat_pack(query_trits, 1, COLS, query_t5);
+    test_assert(tritindex_search(&idx, query_t5, 1, TRITINDEX_DOT, 3, 0, hits) &&
+                hits[0].id == TRITINDEX_NO_ID && hits[2].id == TRITINDEX_NO_ID &&
+                hits[2].score == 0, "empty index: every slot TRITINDEX_NO_ID, score 0");
+
+    fill_random(vec_trits, 3 * COLS, 6u);
+    memcpy(vec_trits + 2 * COLS, query_trits, COLS);          // id 2 = the query
+    tritindex_add_trits(&idx, vec_trits, 3);
+    test_assert(tritindex_search(&idx, query_t5, 1, TRITINDEX_HAMMING, 5, 0, hits) &&
+                hits[0].id == 2 && hits[0].score == 0 && hits[3].id == TRITINDEX_NO_ID,
+                "3 vectors, k = 5: query itself first at distance 0, then padding");
+
+    int nonzero = 0;
+    for (size_t c = 0; c < COLS; c++) nonzero += query_trits[c] != 0;
+    test_assert(tritindex_search(&idx, query_t5, 1, TRITINDEX_DOT, 1, 0, hits) &&
+                hits[0].id == 2 && hits[0].score == nonzero,
+                "dot: query itself scores its nonzero count");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: add_t5 stores the same planes as add_trits
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing add paths:\n");
+
+    tritindex_t from_t5;
+    tritindex_init(&from_t5, COLS);
+    tritmat_pack(vec_trits, 3, COLS, vec_t5);
+    int ok = tritindex_add_t5(&from_t5, vec_t5, 1) && tritindex_add_t5(&from_t5, vec_t5 + TRITMAT_ROW_BYTES(COLS), 2);
+    test_assert(ok && from_t5.count == 3 &&
+                memcmp(from_t5.vec, idx.vec, 3 * TRITMAT_ROW_VECTORS(COLS) * sizeof(trit64b_t)) == 0,
+                "add_t5 in two calls = add_trits in one");
+    tritindex_free(&from_t5);
+    tritindex_free(&idx);
+    test_assert(idx.count == 0 && idx.vec == NULL && idx.cols == COLS,
+                "tritindex_free leaves an empty index of the same width");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritindex_exhaustive: Every Backend vs Sorted Reference
+// ────────────────────────────────────────────────────────────────
+
+int test_tritindex_exhaustive(void) {
+    print_header("Nearest-Neighbour Unit Tests: Exhaustive Search");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Every supported backend, both metrics
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing each supported backend against a full sort:\n");
+
+    tritindex_t idx;
+    tritindex_init(&idx, COLS);
+    fill_clustered(vec_trits, MAX_VECS, 21u);
+    fill_random(query_trits, MAX_QUERY * COLS, 22u);
+    memcpy(query_trits, vec_trits + 7 * COLS, COLS);          // one exact match
+    tritmat_pack(vec_trits, MAX_VECS, COLS, vec_t5);
+    tritmat_pack(query_trits, MAX_QUERY, COLS, query_t5);
+    tritindex_add_t5(&idx, vec_t5, MAX_VECS);
+
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        char name[96];
+        if (!trit_backend_supported(backends[i])) {
+            printf("    (skip %s: not supported on this CPU)\n", trit_backend_name(backends[i]));
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s: %d queries × %d vectors, dot/hamming, k 1-%d",
+                 trit_backend_name(backends[i]), MAX_QUERY, MAX_VECS, MAX_K);
+        test_assert(check_exhaustive(&idx, backends[i]), name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: Bitsliced queries
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing tritindex_search_t64b:\n");
+
+    static trit64b_t query_vec[MAX_QUERY * TRITMAT_ROW_VECTORS(COLS)];
+    tritmat_pack_t64b(query_trits, MAX_QUERY, COLS, query_vec);
+    tritindex_search(&idx, query_t5, MAX_QUERY, TRITINDEX_DOT, 10, 0, hits);
+    tritindex_search_t64b(&idx, query_vec, MAX_QUERY, TRITINDEX_DOT, 10, 0, hits2);
+    test_assert(memcmp(hits, hits2, MAX_QUERY * 10 * sizeof(hits[0])) == 0,
+                "search_t64b = search on the same queries");
+
+    tritindex_free(&idx);
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritindex_lists: Coarse Lists and Query Slices
+// ────────────────────────────────────────────────────────────────
+
+int test_tritindex_lists(void) {
+    print_header("Nearest-Neighbour Unit Tests: Coarse Lists");
+
+    tritindex_t idx;
+    tritindex_init(&idx, COLS);
+    fill_clustered(vec_trits, MAX_VECS, 31u);
+    fill_random(query_trits, MAX_QUERY * COLS, 32u);
+    tritmat_pack(vec_trits, MAX_VECS, COLS, vec_t5);
+    tritmat_pack(query_trits, MAX_QUERY, COLS, query_t5);
+    tritindex_add_t5(&idx, vec_t5, MAX_VECS - 50);           // last 50 added after training
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: Training shape
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing tritindex_train:\n");
+
+    int ok = 1;
+    for (int m = 0; m < 2; m++) {
+        tritindex_metric_t metric = m ? TRITINDEX_HAMMING : TRITINDEX_DOT;
+        ok = ok && tritindex_train(&idx, 16, 0, metric) && idx.nlist == 16 &&
+             idx.trained == idx.count && idx.list_start[16] == idx.count;
+        for (size_t i = 0; ok && i < idx.count; i++) {
+            size_t id = idx.list_id[i];
+            ok = id < idx.count && memcmp(idx.list_vec + i * TRITMAT_ROW_VECTORS(COLS),
+                                          idx.vec + id * TRITMAT_ROW_VECTORS(COLS),
+                                          TRITMAT_ROW_VECTORS(COLS) * sizeof(trit64b_t)) == 0;
+        }
+    }
+    test_assert(ok, "16 lists cover every vector once, rows copied in list order");
+
+    tritindex_t tiny;
+    tritindex_init(&tiny, COLS);
+    tritindex_add_trits(&tiny, vec_trits, 3);
+    test_assert(tritindex_train(&tiny, 10, 2, TRITINDEX_DOT) && tiny.nlist == 3,
+                "nlist above count is capped at count");
+    test_assert(tritindex_train(&tiny, 0, 0, TRITINDEX_DOT) && tiny.nlist == 0 && tiny.centroid == NULL,
+                "nlist = 0 drops the lists");
+    tritindex_free(&tiny);
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 6: nprobe = nlist is exact; nprobe = 1 finds itself
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing list search:\n");
+
+    tritindex_add_t5(&idx, vec_t5 + (MAX_VECS - 50) * TRITMAT_ROW_BYTES(COLS), 50);
+    for (int m = 0; m < 2; m++) {
+        tritindex_metric_t metric = m ? TRITINDEX_HAMMING : TRITINDEX_DOT;
+        char name[96];
+        tritindex_train(&idx, 16, 0, metric);
+        tritindex_add_t5(&idx, vec_t5, 0);                   // no-op add keeps lists
+        ok = tritindex_search(&idx, query_t5, MAX_QUERY, metric, 25, 16, hits) &&
+             tritindex_search(&idx, query_t5, MAX_QUERY, metric, 25, 0, hits2) &&
+             memcmp(hits, hits2, MAX_QUERY * 25 * sizeof(hits[0])) == 0;
+        snprintf(name, sizeof(name), "%s: nprobe = nlist equals exhaustive", m ? "hamming" : "dot");
+        test_assert(ok, name);
+    }
+
+    // Hamming lists: each vector's own list is its query's best centroid
+    tritindex_train(&idx, 16, 0, TRITINDEX_HAMMING);
+    tritindex_add_t5(&idx, vec_t5, 7);                       // ids 1200-1206, untrained
+    ok = tritindex_search(&idx, vec_t5, MAX_VECS, TRITINDEX_HAMMING, 1, 1, hits);
+    for (size_t i = 0; ok && i < MAX_VECS; i++) {
+        ok = hits[i].score == 0 && (hits[i].id == i || score_of(vec_trits + hits[i].id * COLS,
+                                                               vec_trits + i * COLS, TRITINDEX_HAMMING) == 0);
+    }
+    test_assert(ok, "hamming, nprobe = 1: every stored vector finds a distance-0 match");
+
+    ok = tritindex_search(&idx, vec_t5 + 3 * TRITMAT_ROW_BYTES(COLS), 1, TRITINDEX_HAMMING, 2, 1, hits) &&
+         hits[0].id == 3 && hits[1].id == MAX_VECS + 3 && hits[1].score == 0;
+    test_assert(ok, "vectors added after training are scanned (duplicate id 1203 found)");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 7: Query slices equal one call
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing query slices (threading contract):\n");
+
+    for (int probe = 0; probe < 2; probe++) {
+        size_t np = probe ? 3 : 0, split = 21, k = 9;
+        tritindex_search(&idx, query_t5, MAX_QUERY, TRITINDEX_DOT, k, np, hits);
+        tritindex_search(&idx, query_t5, split, TRITINDEX_DOT, k, np, hits2);
+        tritindex_search(&idx, query_t5 + split * TRITMAT_ROW_BYTES(COLS), MAX_QUERY - split,
+                         TRITINDEX_DOT, k, np, hits2 + split * k);
+        test_assert(memcmp(hits, hits2, MAX_QUERY * k * sizeof(hits[0])) == 0,
+                    probe ? "queries [0, 21) + [21, 37) = one call (nprobe 3)"
+                          : "queries [0, 21) + [21, 37) = one call (exhaustive)");
+    }
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 8: Threaded search equals one call
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing tritindex_search_mt / _t64b_mt:\n");
+
+    static const unsigned counts[] = { 0, 1, 2, 3, 7, 100 };
+    static trit64b_t vec_planes[MAX_VECS * TRITMAT_ROW_VECTORS(COLS)];
+    size_t k = 5;
+    tritmat_t5_to_t64b(vec_t5, MAX_VECS, COLS, vec_planes);
+    for (int probe = 0; probe < 2; probe++) {
+        size_t np = probe ? 3 : 0;
+        ok = tritindex_search(&idx, vec_t5, MAX_VECS, TRITINDEX_HAMMING, k, np, hits);
+        for (size_t t = 0; ok && t < sizeof(counts) / sizeof(counts[0]); t++) {
+            ok = tritindex_search_mt(&idx, vec_t5, MAX_VECS, TRITINDEX_HAMMING, k, np, hits2,
+                                     counts[t]) &&
+                 memcmp(hits, hits2, MAX_VECS * k * sizeof(hits[0])) == 0;
+            ok = ok && tritindex_search_t64b_mt(&idx, vec_planes, MAX_VECS, TRITINDEX_HAMMING, k,
+                                                np, hits2, counts[t]) &&
+                 memcmp(hits, hits2, MAX_VECS * k * sizeof(hits[0])) == 0;
+        }
+        test_assert(ok, probe ? "1200 queries, threads 0-100 = one call (nprobe 3)"
+                              : "1200 queries, threads 0-100 = one call (exhaustive)");
+    }
+
+    tritindex_free(&idx);
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritindex_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_tritindex_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Nearest-Neighbour Search\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_tritindex_basic();
+    test_tritindex_exhaustive();
+    test_tritindex_lists();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_tritindex_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Sizes (keep MAX_K past MAX_VECS so padding is exercised)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = qsort of trit-loop scores, ties to the lower id
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Seek, and ye shall find." — Matthew 7:7
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
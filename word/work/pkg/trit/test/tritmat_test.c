@@ -0,0 +1,541 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Ternary-Weight Matrix Products
+// Key: B-word-work-pkg-trit-tritmat-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/array_test.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [Layout 1: t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for tritmat.c - designed to FAIL MEANINGFULLY.
+// Every backend must match a naive multiply-accumulate over unpacked trits.
+//
+// tritmat_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: Skipping the multiply must not change the sum.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH backend, activation type or shape diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check tritmat_gemv_* and tritmat_gemm_* against a naive loop.
+//
+// Key Features:
+//   - Shapes on both sides of every block edge (rows 8, cols 1280,
+//     batch 64) and of every vector width
+//   - Extreme activations (-128, -32768) times -1
+//   - Row slices give the same rows as one whole call
+//   - int16 sums past int32 saturate; intermediate overflow is exact
+//   - Threaded GEMM equals the single-threaded call for any thread count
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-tritmat
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>   // printf
+
+//--- Project Headers ---
+#include "trit.h"    // trit types, backends
+#include "tritmat.h" // tritmat_pack, gemv, gemm
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_tritmat_run_all(void);                  // Run all tests, return failure count
+int test_tritmat_basic(void);      // Worked example, packing, extremes
+int test_tritmat_backends(void);   // Each backend vs naive loop
+int test_tritmat_slices(void);     // Row slices vs whole call
+int test_tritmat_threads(void);    // _mt drivers vs single thread
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_tritmat_run_all()
+//   ├── test_tritmat_basic()    → worked example, extremes
+//   ├── test_tritmat_backends() → check_backend() per supported backend
+//   ├── test_tritmat_slices()   → row slices on the active backend
+//   └── test_tritmat_threads()  → tritmat_gem{m,v}_*_mt per thread count
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (naive reference, backend loop)
+// ────────────────────────────────────────────────────────────────
+
+#define MAX_ROWS   17
+#define MAX_COLS   2600
+#define MAX_BATCH  65
+
+static trit_t w_trits[MAX_ROWS * MAX_COLS];
+static uint8_t w_packed[MAX_ROWS * TRITMAT_ROW_BYTES(MAX_COLS)];
+static int8_t x_i8[MAX_BATCH * MAX_COLS];
+static int16_t x_i16[MAX_BATCH * MAX_COLS];
+static float x_f32[MAX_BATCH * MAX_COLS];
+static int32_t y_i32[MAX_ROWS * MAX_BATCH + 1];
+static float y_f32[MAX_ROWS * MAX_BATCH + 1];
+static int64_t y_ref[MAX_ROWS * MAX_BATCH];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+// Shapes straddle ROW_BLOCK (8), COL_BLOCK (1280), BATCH_BLOCK (64) and
+// the 4/8/16/32-lane vector widths.
+static const size_t shapes[][3] = {   // rows, cols, batch
+    { 1, 1, 1 }, { 3, 4, 1 }, { 8, 5, 2 }, { 9, 31, 1 }, { 2, 33, 3 },
+    { 7, 100, 1 }, { 17, 1279, 2 }, { 9, 1280, 1 }, { 8, 1281, 65 },
+    { 5, 2600, 3 }, { 17, 64, 65 }, { 0, 10, 2 }, { 3, 0, 2 }
+};
+
+static uint32_t lcg(uint32_t *seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+// fill_problem sets random weights (packed) and activations. Floats hold
+// small integers so every summation order is exact.
+static void fill_problem(size_t rows, size_t cols, size_t batch, uint32_t seed) {
+    for (size_t i = 0; i < rows * cols; i++) {
+        w_trits[i] = (trit_t)((int)(lcg(&seed) % 3) - 1);
+    }
+    tritmat_pack(w_trits, rows, cols, w_packed);
+    for (size_t i = 0; i < batch * cols; i++) {
+        uint32_t v = lcg(&seed);
+        x_i8[i] = (int8_t)(int)((v & 0xFF) - 128);
+        x_i16[i] = (int16_t)(int32_t)((v & 0xFFFF) - 32768);
+        x_f32[i] = (float)((int)(v % 129) - 64);
+    }
+}
+
+// reference fills y_ref from one activation type (0 = i8, 1 = i16, 2 = f32).
+static void reference(size_t rows, size_t cols, size_t batch, int type) {
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t b = 0; b < batch; b++) {
+            int64_t s = 0;
+            for (size_t c = 0; c < cols; c++) {
+                int64_t x = (type == 0) ? x_i8[b * cols + c]
+                          : (type == 1) ? x_i16[b * cols + c]
+                          : (int64_t)x_f32[b * cols + c];
+                s += w_trits[r * cols + c] * x;
+            }
+            y_ref[r * batch + b] = s;
+        }
+    }
+}
+
+// check_backend runs all six entry points on one backend over every shape.
+// Returns 1 if everything matched.
+static int check_backend(trit_backend_t backend) {
+    if (!trit_backend_select(backend)) {
+        return 0;
+    }
+    static const char *types[] = { "i8", "i16", "f32" };
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        size_t rows = shapes[s][0], cols = shapes[s][1], batch = shapes[s][2];
+        fill_problem(rows, cols, batch, 31u * (uint32_t)s + 5u);
+        for (int type = 0; type < 3; type++) {
+            for (int gemv = 0; gemv < 2; gemv++) {
+                size_t nb = gemv ? 1 : batch;
+                reference(rows, cols, nb, type);
+                y_i32[rows * nb] = 12345;
+                y_f32[rows * nb] = 12345.0f;
+                switch (type * 2 + gemv) {
+                case 0: tritmat_gemm_i8(w_packed, rows, cols, x_i8, nb, y_i32); break;
+                case 1: tritmat_gemv_i8(w_packed, rows, cols, x_i8, y_i32); break;
+                case 2: tritmat_gemm_i16(w_packed, rows, cols, x_i16, nb, y_i32); break;
+                case 3: tritmat_gemv_i16(w_packed, rows, cols, x_i16, y_i32); break;
+                case 4: tritmat_gemm_f32(w_packed, rows, cols, x_f32, nb, y_f32); break;
+                default: tritmat_gemv_f32(w_packed, rows, cols, x_f32, y_f32); break;
+                }
+                for (size_t i = 0; i < rows * nb; i++) {
+                    int64_t got = (type == 2) ? (int64_t)y_f32[i] : y_i32[i];
+                    if (got != y_ref[i]) {
+                        printf("    %s: %s %s, %zu×%zu batch %zu, output %zu: %lld != %lld\n",
+                               trit_backend_name(backend), gemv ? "gemv" : "gemm", types[type],
+                               rows, cols, nb, i, (long long)got, (long long)y_ref[i]);
+                        return 0;
+                    }
+                }
+                if (y_i32[rows * nb] != 12345 || y_f32[rows * nb] != 12345.0f) {
+                    printf("    %s: %s wrote past %zu outputs\n",
+                           trit_backend_name(backend), types[type], rows * nb);
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritmat_basic: Worked Example and Extremes
+// ────────────────────────────────────────────────────────────────
+
+int test_tritmat_basic(void) {
+    print_header("Matrix Unit Tests: Basics");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Worked example from tritmat.h
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing the header example (active backend: %s):\n",
+           trit_backend_name(trit_backend_active()));
+
+    uint8_t w[2 * TRITMAT_ROW_BYTES(3)];
+    trit_t trits[6] = { 1, 0, -1,   -1, -1, 1 };
+    test_assert(tritmat_pack(trits, 2, 3, w) == 2, "pack 2×3: one byte per row");
+    int8_t x[3] = { 10, 20, 30 };
+    int32_t y[2];
+    tritmat_gemv_i8(w, 2, 3, x, y);
+    test_assert(y[0] == -20 && y[1] == 0, "gemv_i8: {10,20,30} → {-20, 0}");
+    float xf[3] = { 0.5f, 0.25f, 2.0f };
+    float yf[2];
+    tritmat_gemv_f32(w, 2, 3, xf, yf);
+    test_assert(yf[0] == -1.5f && yf[1] == 1.25f, "gemv_f32: {0.5,0.25,2} → {-1.5, 1.25}");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Extreme activations times -1 (no wraparound)
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing extreme activations:\n");
+
+    size_t cols = 1000;
+    for (size_t c = 0; c < cols; c++) {
+        w_trits[c] = TRIT_NEG;
+        x_i8[c] = INT8_MIN;
+        x_i16[c] = INT16_MIN;
+    }
+    tritmat_pack(w_trits, 1, cols, w_packed);
+    tritmat_gemv_i8(w_packed, 1, cols, x_i8, y);
+    test_assert(y[0] == 128 * 1000, "gemv_i8: 1000 × (-1)(-128) = 128,000");
+    tritmat_gemv_i16(w_packed, 1, cols, x_i16, y);
+    test_assert(y[0] == 32768 * 1000, "gemv_i16: 1000 × (-1)(-32768) = 32,768,000");
+
+    // Past 65,536 int16 columns the sum leaves int32: it must saturate,
+    // and a sum that only passes 2^31 on the way must still be exact.
+    enum { WIDE = 70000 };
+    static trit_t wide_w[WIDE];
+    static uint8_t wide_packed[TRITMAT_ROW_BYTES(WIDE)];
+    static int16_t wide_x[WIDE];
+    for (size_t c = 0; c < WIDE; c++) {
+        wide_w[c] = TRIT_NEG;
+        wide_x[c] = INT16_MIN;
+    }
+    tritmat_pack(wide_w, 1, WIDE, wide_packed);
+    tritmat_gemv_i16(wide_packed, 1, WIDE, wide_x, y);
+    test_assert(y[0] == INT32_MAX, "gemv_i16: 70,000 × (-1)(-32768) saturates to INT32_MAX");
+    for (size_t c = 0; c < WIDE; c++) {
+        wide_w[c] = TRIT_POS;
+    }
+    tritmat_pack(wide_w, 1, WIDE, wide_packed);
+    tritmat_gemv_i16(wide_packed, 1, WIDE, wide_x, y);
+    test_assert(y[0] == INT32_MIN, "gemv_i16: 70,000 × (+1)(-32768) saturates to INT32_MIN");
+    for (size_t c = 66000; c < WIDE; c++) {
+        wide_x[c] = INT16_MAX;
+    }
+    tritmat_gemv_i16(wide_packed, 1, WIDE, wide_x, y);
+    test_assert(y[0] == -2031620000, "gemv_i16: past INT32_MIN at column 65,536, back in range exactly");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritmat_backends: Every Backend vs Naive Loop
+// ────────────────────────────────────────────────────────────────
+
+int test_tritmat_backends(void) {
+    print_header("Matrix Unit Tests: Backends");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Every supported backend
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing each supported backend against a naive loop:\n");
+
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        char name[96];
+        if (!trit_backend_supported(backends[i])) {
+            printf("    (skip %s: not supported on this CPU)\n", trit_backend_name(backends[i]));
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s: gemv/gemm × i8/i16/f32, %zu shapes",
+                 trit_backend_name(backends[i]), sizeof(shapes) / sizeof(shapes[0]));
+        test_assert(check_backend(backends[i]), name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritmat_slices: Row Slices (threading contract)
+// ────────────────────────────────────────────────────────────────
+
+int test_tritmat_slices(void) {
+    print_header("Matrix Unit Tests: Row Slices");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: Slices [0,5), [5,6), [6,17) equal one whole call
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing row slices as a caller's threads would issue them:\n");
+
+    size_t rows = 17, cols = 1500, batch = 3;
+    size_t row_bytes = TRITMAT_ROW_BYTES(cols);
+    static const size_t cuts[] = { 0, 5, 6, 17 };
+    static int32_t whole[17 * 3];
+
+    fill_problem(rows, cols, batch, 77u);
+    tritmat_gemm_i16(w_packed, rows, cols, x_i16, batch, whole);
+    for (size_t s = 0; s + 1 < sizeof(cuts) / sizeof(cuts[0]); s++) {
+        size_t r0 = cuts[s], r1 = cuts[s + 1];
+        tritmat_gemm_i16(w_packed + r0 * row_bytes, r1 - r0, cols,
+                         x_i16, batch, y_i32 + r0 * batch);
+    }
+    int same = 1;
+    for (size_t i = 0; i < rows * batch; i++) {
+        if (y_i32[i] != whole[i]) same = 0;
+    }
+    test_assert(same, "gemm_i16 17×1500 batch 3: three slices = one call");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritmat_threads: Threaded Drivers
+// ────────────────────────────────────────────────────────────────
+
+int test_tritmat_threads(void) {
+    print_header("Matrix Unit Tests: Threads");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: tritmat_gem{m,v}_*_mt equal one single-threaded call
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing threaded GEMM and GEMV against the single-threaded call:\n");
+
+    static const unsigned counts[] = { 0, 1, 2, 3, 4, 16, 100 };
+    static const size_t tshapes[][3] = { { 17, 1500, 3 }, { 9, 40, 65 }, { 1, 7, 1 }, { 0, 5, 2 } };
+    static int32_t whole_i32[MAX_ROWS * MAX_BATCH];
+    static float whole_f32[MAX_ROWS * MAX_BATCH];
+
+    for (size_t s = 0; s < sizeof(tshapes) / sizeof(tshapes[0]); s++) {
+        size_t rows = tshapes[s][0], cols = tshapes[s][1], batch = tshapes[s][2];
+        fill_problem(rows, cols, batch, 91u + (uint32_t)s);
+        for (int type = 0; type < 3; type++) {
+            int same = 1;
+            char name[96];
+            switch (type) {
+            case 0: tritmat_gemm_i8(w_packed, rows, cols, x_i8, batch, whole_i32); break;
+            case 1: tritmat_gemm_i16(w_packed, rows, cols, x_i16, batch, whole_i32); break;
+            default: tritmat_gemm_f32(w_packed, rows, cols, x_f32, batch, whole_f32); break;
+            }
+            for (size_t t = 0; t < sizeof(counts) / sizeof(counts[0]); t++) {
+                y_i32[rows * batch] = 12345;
+                y_f32[rows * batch] = 12345.0f;
+                switch (type) {
+                case 0: tritmat_gemm_i8_mt(w_packed, rows, cols, x_i8, batch, y_i32, counts[t]); break;
+                case 1: tritmat_gemm_i16_mt(w_packed, rows, cols, x_i16, batch, y_i32, counts[t]); break;
+                default: tritmat_gemm_f32_mt(w_packed, rows, cols, x_f32, batch, y_f32, counts[t]); break;
+                }
+                for (size_t i = 0; i < rows * batch; i++) {
+                    if (type < 2 ? y_i32[i] != whole_i32[i] : y_f32[i] != whole_f32[i]) same = 0;
+                }
+                if (y_i32[rows * batch] != 12345 || y_f32[rows * batch] != 12345.0f) same = 0;
+            }
+            snprintf(name, sizeof(name), "gemm_%s_mt %zu×%zu batch %zu: threads 0-100 = one call",
+                     type == 0 ? "i8" : type == 1 ? "i16" : "f32", rows, cols, batch);
+            test_assert(same, name);
+
+            // GEMV: the first activation vector of the same problem
+            same = 1;
+            switch (type) {
+            case 0: tritmat_gemv_i8(w_packed, rows, cols, x_i8, whole_i32); break;
+            case 1: tritmat_gemv_i16(w_packed, rows, cols, x_i16, whole_i32); break;
+            default: tritmat_gemv_f32(w_packed, rows, cols, x_f32, whole_f32); break;
+            }
+            for (size_t t = 0; t < sizeof(counts) / sizeof(counts[0]); t++) {
+                y_i32[rows] = 12345;
+                y_f32[rows] = 12345.0f;
+                switch (type) {
+                case 0: tritmat_gemv_i8_mt(w_packed, rows, cols, x_i8, y_i32, counts[t]); break;
+                case 1: tritmat_gemv_i16_mt(w_packed, rows, cols, x_i16, y_i32, counts[t]); break;
+                default: tritmat_gemv_f32_mt(w_packed, rows, cols, x_f32, y_f32, counts[t]); break;
+                }
+                for (size_t i = 0; i < rows; i++) {
+                    if (type < 2 ? y_i32[i] != whole_i32[i] : y_f32[i] != whole_f32[i]) same = 0;
+                }
+                if (y_i32[rows] != 12345 || y_f32[rows] != 12345.0f) same = 0;
+            }
+            snprintf(name, sizeof(name), "gemv_%s_mt %zu×%zu: threads 0-100 = one call",
+                     type == 0 ? "i8" : type == 1 ? "i16" : "f32", rows, cols);
+            test_assert(same, name);
+        }
+    }
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritmat_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_tritmat_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Ternary-Weight Matrix Products\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_tritmat_basic();
+    test_tritmat_backends();
+    test_tritmat_slices();
+    test_tritmat_threads();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_tritmat_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add shapes (keep MAX_* in step)
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = naive int64 multiply-accumulate over unpacked trits
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Let your communication be, Yea, yea; Nay, nay." — Matthew 5:37
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
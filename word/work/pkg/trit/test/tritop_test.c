@@ -0,0 +1,594 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Truth-Table Operators
+// Key: B-word-work-pkg-trit-tritop-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/array_test.c (structure)
+// See: word/research/ternary/ternary-logic-algorithms.adoc [Dyadic Operations]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for tritop.c - designed to FAIL MEANINGFULLY.
+// Every table ID, on both paths and every backend, must give its digits.
+//
+// tritop_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Prove all things; hold fast that which is good."
+//            — 1 Thessalonians 5:21
+//
+// Principle: A name is only as good as what it answers to.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH table, path, backend or pair diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check trit_op{1,2}_eval/compile/apply and trit64b_op_run.
+//
+// Key Features:
+//   - Named IDs vs trit_add, trit_multiply, trit_negate and the Kleene tables
+//   - All 19,683 dyadic and 27 monadic programs on all nine pairs, per backend
+//   - Compiled add/multiply/and/or vs the hand-written trit64b kernels
+//   - Table lookups for every ID on every backend; lengths 0-200, in place
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-tritop
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>   // printf
+#include <string.h>  // memcmp, memset
+
+//--- Project Headers ---
+#include "tritop.h"  // operators, TRIT_OP*
+#include "trit.h"    // trit types, bitsliced kernels, backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_tritop_run_all(void);     // Run all tests, return failure count
+int test_tritop_eval(void);        // Digits, named IDs, invalid IDs
+int test_tritop_compile(void);     // Programs for every table
+int test_tritop_apply(void);       // Table lookups per backend
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_tritop_run_all()
+//   ├── test_tritop_eval()    → digits, named tables, out-of-range IDs
+//   ├── test_tritop_compile() → check_programs() per backend, trit64b kernels
+//   └── test_tritop_apply()   → check_apply() per backend
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (references, pair vectors, backend loop)
+// ────────────────────────────────────────────────────────────────
+
+#define BIG_TRITS 100003               // odd: every backend ends in a tail
+#define BIG_VECS  1001                 // 31 full blocks of 32 + a 9-vector tail
+
+static trit_t big_a[BIG_TRITS], big_b[BIG_TRITS];
+static trit_t big_out[BIG_TRITS + 1], big_ref[BIG_TRITS];
+static trit64b_t vec_a[BIG_VECS], vec_b[BIG_VECS], vec_out[BIG_VECS + 1], vec_ref[BIG_VECS];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+// fill_random sets n pseudo-random trits.
+static void fill_random(trit_t *out, size_t n, uint32_t seed) {
+    for (size_t i = 0; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        out[i] = (trit_t)((int)((seed >> 20) % 3) - 1);
+    }
+}
+
+// fill_vectors sets n pseudo-random valid bitsliced vectors.
+static void fill_vectors(trit64b_t *out, size_t n, uint32_t seed) {
+    trit_t lanes[64];
+    for (size_t i = 0; i < n; i++) {
+        fill_random(lanes, 64, seed + 977u * (uint32_t)i);
+        out[i] = trit64b_from_trits(lanes, 64);
+    }
+}
+
+// Lane l of pair_a/pair_b is pair l mod 9: a = l/3 - 1, b = l%3 - 1,
+// so lane l holds table digit l mod 9.
+static trit64b_t pair_a, pair_b;
+
+static void build_pairs(void) {
+    trit_t a[64], b[64];
+    for (int l = 0; l < 64; l++) {
+        a[l] = (trit_t)((l % 9) / 3 - 1);
+        b[l] = (trit_t)(l % 3 - 1);
+    }
+    pair_a = trit64b_from_trits(a, 64);
+    pair_b = trit64b_from_trits(b, 64);
+}
+
+// run_matches checks one compiled program on all nine pairs against
+// trit_op2_eval (monadic: b = a, lanes hold a only).
+static int run_matches(const trit_op_t *op, trit9_t table, int monadic) {
+    trit64b_t out;
+    trit64b_op_run(op, &pair_a, monadic ? NULL : &pair_b, 1, &out);
+    if (!trit64b_valid(out)) {
+        return 0;
+    }
+    for (unsigned l = 0; l < 64; l++) {
+        trit_t a = trit64b_get(pair_a, l);
+        trit_t b = monadic ? a : trit64b_get(pair_b, l);
+        trit_t want = monadic ? trit_op1_eval((uint8_t)table, a) : trit_op2_eval(table, a, b);
+        if (trit64b_get(out, l) != want) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// check_programs compiles and runs every dyadic and monadic table on one
+// backend. Returns 1 if every lane matched.
+static int check_programs(trit_backend_t backend) {
+    if (!trit_backend_select(backend)) {
+        return 0;
+    }
+    trit_op_t op;
+    for (uint32_t t = 0; t <= TRIT9_MAX; t++) {
+        if (!trit_op2_compile((trit9_t)t, &op) || !run_matches(&op, (trit9_t)t, 0)) {
+            printf("    %s: dyadic table %u differs\n", trit_backend_name(backend), t);
+            return 0;
+        }
+    }
+    for (uint8_t t = 0; t < TRIT_OP1_STATES; t++) {
+        if (!trit_op1_compile(t, &op) || !run_matches(&op, t, 1)) {
+            printf("    %s: monadic table %u differs\n", trit_backend_name(backend), t);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// check_kernels runs compiled add/multiply/and/or over BIG_VECS vectors
+// against the hand-written trit64b kernels, then chains them in place.
+static int check_kernels(trit_backend_t backend) {
+    if (!trit_backend_select(backend)) {
+        return 0;
+    }
+    static const trit9_t tables[4] = { TRIT_OP2_ADD, TRIT_OP2_MULTIPLY, TRIT_OP2_AND, TRIT_OP2_OR };
+    trit_op_t op[4];
+    fill_vectors(vec_a, BIG_VECS, 5u);
+    fill_vectors(vec_b, BIG_VECS, 9u);
+
+    for (int k = 0; k < 4; k++) {
+        trit_op2_compile(tables[k], &op[k]);
+        memset(vec_out, 0x5A, sizeof(vec_out));
+        trit64b_op_run(&op[k], vec_a, vec_b, BIG_VECS, vec_out);
+        for (size_t i = 0; i < BIG_VECS; i++) {
+            trit64b_t ref = (k == 0) ? trit64b_add(vec_a[i], vec_b[i])
+                          : (k == 1) ? trit64b_multiply(vec_a[i], vec_b[i])
+                          : (k == 2) ? trit64b_and(vec_a[i], vec_b[i])
+                          : trit64b_or(vec_a[i], vec_b[i]);
+            if (vec_out[i].pos != ref.pos || vec_out[i].neg != ref.neg) {
+                printf("    %s: table %d, vector %zu differs\n", trit_backend_name(backend), k, i);
+                return 0;
+            }
+        }
+        if (vec_out[BIG_VECS].pos != 0x5A5A5A5A5A5A5A5AULL) {
+            printf("    %s: table %d wrote past %d vectors\n", trit_backend_name(backend), k, BIG_VECS);
+            return 0;
+        }
+    }
+
+    // In place: a = -((a·b) + b)
+    trit_op_t negate;
+    trit_op1_compile(TRIT_OP1_NEGATE, &negate);
+    for (size_t i = 0; i < BIG_VECS; i++) {
+        vec_ref[i] = trit64b_negate(trit64b_add(trit64b_multiply(vec_a[i], vec_b[i]), vec_b[i]));
+    }
+    trit64b_op_run(&op[1], vec_a, vec_b, BIG_VECS, vec_a);
+    trit64b_op_run(&op[0], vec_a, vec_b, BIG_VECS, vec_a);
+    trit64b_op_run(&negate, vec_a, NULL, BIG_VECS, vec_a);
+    if (memcmp(vec_a, vec_ref, sizeof(vec_ref)) != 0) {
+        printf("    %s: in-place chain differs\n", trit_backend_name(backend));
+        return 0;
+    }
+    return 1;
+}
+
+// check_apply runs trit_op2_apply for every table on the 81-trit run of
+// all pairs, then named tables at every length 0-200 and a big in-place
+// chain. Returns 1 if everything matched.
+static int check_apply(trit_backend_t backend) {
+    if (!trit_backend_select(backend)) {
+        return 0;
+    }
+    trit_t a[81], b[81], out[81];
+    for (int i = 0; i < 81; i++) {
+        a[i] = (trit_t)((i % 9) / 3 - 1);
+        b[i] = (trit_t)(i % 3 - 1);
+    }
+    for (uint32_t t = 0; t <= TRIT9_MAX; t++) {
+        trit_op2_apply((trit9_t)t, a, b, 81, out);
+        for (int i = 0; i < 81; i++) {
+            if (out[i] != trit_op2_eval((trit9_t)t, a[i], b[i])) {
+                printf("    %s: dyadic table %u, pair %d differs\n", trit_backend_name(backend), t, i % 9);
+                return 0;
+            }
+        }
+    }
+    for (uint8_t t = 0; t < TRIT_OP1_STATES; t++) {
+        trit_op1_apply(t, a, 81, out);
+        for (int i = 0; i < 81; i++) {
+            if (out[i] != trit_op1_eval(t, a[i])) {
+                printf("    %s: monadic table %u differs\n", trit_backend_name(backend), t);
+                return 0;
+            }
+        }
+    }
+
+    static const trit9_t named[] = { TRIT_OP2_ADD, TRIT_OP2_IMPLIES, TRIT_OP2_COMPARE };
+    for (size_t n = 0; n <= 200; n++) {
+        fill_random(big_a, n, 7u + (uint32_t)n);
+        fill_random(big_b, n, 11u * (uint32_t)n + 3u);
+        for (size_t k = 0; k < sizeof(named) / sizeof(named[0]); k++) {
+            memset(big_out, 7, n + 1);
+            trit_op2_apply(named[k], big_a, big_b, n, big_out);
+            for (size_t i = 0; i < n; i++) {
+                if (big_out[i] != trit_op2_eval(named[k], big_a[i], big_b[i])) {
+                    printf("    %s: table %zu, length %zu, element %zu differs\n",
+                           trit_backend_name(backend), k, n, i);
+                    return 0;
+                }
+            }
+            if (big_out[n] != 7) {
+                printf("    %s: table %zu wrote past %zu trits\n", trit_backend_name(backend), k, n);
+                return 0;
+            }
+        }
+    }
+
+    // Large buffer, in place: a = -((a·b) + b)
+    fill_random(big_a, BIG_TRITS, 2025u);
+    fill_random(big_b, BIG_TRITS, 1225u);
+    for (size_t i = 0; i < BIG_TRITS; i++) {
+        big_ref[i] = trit_negate(trit_add(trit_multiply(big_a[i], big_b[i]), big_b[i]));
+    }
+    trit_op2_apply(TRIT_OP2_MULTIPLY, big_a, big_b, BIG_TRITS, big_a);
+    trit_op2_apply(TRIT_OP2_ADD, big_a, big_b, BIG_TRITS, big_a);
+    trit_op1_apply(TRIT_OP1_NEGATE, big_a, BIG_TRITS, big_a);
+    if (memcmp(big_a, big_ref, BIG_TRITS) != 0) {
+        printf("    %s: in-place chain differs\n", trit_backend_name(backend));
+        return 0;
+    }
+    return 1;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritop_eval: Digits, named tables, out-of-range IDs
+// ────────────────────────────────────────────────────────────────
+
+int test_tritop_eval(void) {
+    print_header("Operator Unit Tests: Table IDs");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: eval reads the table's digits
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing digit order:\n");
+
+    int digits_ok = 1;
+    for (uint32_t t = 0; t <= TRIT9_MAX; t++) {
+        trit_t f[9];
+        trit9_unpack((trit9_t)t, f);
+        for (int i = 0; i < 9; i++) {
+            if (trit_op2_eval((trit9_t)t, (trit_t)(i / 3 - 1), (trit_t)(i % 3 - 1)) != f[i]) digits_ok = 0;
+        }
+    }
+    test_assert(digits_ok, "trit_op2_eval(t, a, b) = trit9_unpack(t)[3(a+1) + (b+1)], all 19,683 IDs");
+    test_assert(TRIT_OP2_ID(-1, -1, -1, -1, -1, -1, -1, -1, -1) == 0 &&
+                TRIT_OP2_ID(1, 1, 1, 1, 1, 1, 1, 1, 1) == TRIT9_MAX,
+                "TRIT_OP2_ID spans 0 .. TRIT9_MAX");
+    test_assert(trit_op1_eval(TRIT_OP1_ID(1, -1, 0), -1) == TRIT_POS &&
+                trit_op1_eval(TRIT_OP1_ID(1, -1, 0), 0) == TRIT_NEG &&
+                trit_op1_eval(TRIT_OP1_ID(1, -1, 0), 1) == TRIT_ZERO,
+                "TRIT_OP1_ID digits are f(-1), f(0), f(+1)");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Named IDs are the library's operations
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing named tables:\n");
+
+    int add_ok = 1, mul_ok = 1, kleene_ok = 1, derived_ok = 1, mono_ok = 1;
+    for (int a = -1; a <= 1; a++) {
+        for (int b = -1; b <= 1; b++) {
+            trit_t ta = (trit_t)a, tb = (trit_t)b;
+            int lo = a < b ? a : b, hi = a > b ? a : b;
+            if (trit_op2_eval(TRIT_OP2_ADD, ta, tb) != trit_add(ta, tb)) add_ok = 0;
+            if (trit_op2_eval(TRIT_OP2_MULTIPLY, ta, tb) != trit_multiply(ta, tb)) mul_ok = 0;
+            if (trit_op2_eval(TRIT_OP2_AND, ta, tb) != lo || trit_op2_eval(TRIT_OP2_OR, ta, tb) != hi ||
+                trit_op2_eval(TRIT_OP2_NAND, ta, tb) != -lo || trit_op2_eval(TRIT_OP2_NOR, ta, tb) != -hi) {
+                kleene_ok = 0;
+            }
+            if (trit_op2_eval(TRIT_OP2_XOR, ta, tb) != -a * b ||
+                trit_op2_eval(TRIT_OP2_CONSENSUS, ta, tb) != a * b ||
+                trit_op2_eval(TRIT_OP2_EQUALITY, ta, tb) != (a == b ? 1 : -1) ||
+                trit_op2_eval(TRIT_OP2_IMPLIES, ta, tb) != (-a > b ? -a : b) ||
+                trit_op2_eval(TRIT_OP2_COMPARE, ta, tb) != (a > b) - (a < b)) {
+                derived_ok = 0;
+            }
+        }
+        trit_t ta = (trit_t)a;
+        if (trit_op1_eval(TRIT_OP1_NEGATE, ta) != trit_negate(ta) ||
+            trit_op1_eval(TRIT_OP1_IDENTITY, ta) != ta ||
+            trit_op1_eval(TRIT_OP1_INCREMENT, ta) != (a == 1 ? 1 : a + 1) ||
+            trit_op1_eval(TRIT_OP1_DECREMENT, ta) != (a == -1 ? -1 : a - 1) ||
+            trit_op1_eval(TRIT_OP1_ABSOLUTE, ta) != (a == 0 ? -1 : 1)) {
+            mono_ok = 0;
+        }
+    }
+    test_assert(add_ok, "TRIT_OP2_ADD = trit_add (ADDITION_TABLE)");
+    test_assert(mul_ok, "TRIT_OP2_MULTIPLY = trit_multiply (MULTIPLICATION_TABLE)");
+    test_assert(kleene_ok, "AND/OR/NAND/NOR = min/max/-min/-max");
+    test_assert(derived_ok, "XOR, CONSENSUS, EQUALITY, IMPLIES, COMPARE match the logic doc");
+    test_assert(mono_ok, "NEGATE/IDENTITY/INCREMENT/DECREMENT/ABSOLUTE");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Out-of-range IDs are rejected
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing invalid IDs:\n");
+
+    trit_op_t op;
+    memset(&op, 0x33, sizeof(op));
+    trit_t a[3] = { -1, 0, 1 }, out[3] = { 5, 5, 5 };
+    test_assert(!trit_op2_compile(TRIT9_MAX + 1, &op) && !trit_op1_compile(TRIT_OP1_STATES, &op) &&
+                op.len == 0x33, "compile: false, op untouched");
+    test_assert(!trit_op2_apply(TRIT9_MAX + 1, a, a, 3, out) && !trit_op1_apply(TRIT_OP1_STATES, a, 3, out) &&
+                out[0] == 5 && out[2] == 5, "apply: false, out untouched");
+    test_assert(trit_op2_eval(0xFFFF, 1, 1) == TRIT_ZERO && trit_op1_eval(200, -1) == TRIT_ZERO,
+                "eval: TRIT_ZERO");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritop_compile: Programs for every table
+// ────────────────────────────────────────────────────────────────
+
+int test_tritop_compile(void) {
+    print_header("Operator Unit Tests: Compiled Programs");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 4: Program sizes
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing program sizes:\n");
+
+    trit_op_t op;
+    unsigned longest = 0;
+    for (uint32_t t = 0; t <= TRIT9_MAX; t++) {
+        trit_op2_compile((trit9_t)t, &op);
+        if (op.len > longest) longest = op.len;
+    }
+    char name[96];
+    snprintf(name, sizeof(name), "longest program %u ≤ TRIT_OP_CODE_MAX (%d)", longest, TRIT_OP_CODE_MAX);
+    test_assert(longest <= TRIT_OP_CODE_MAX, name);
+    trit_op2_compile(TRIT_OP2_ADD, &op);
+    unsigned add_len = op.len;
+    trit_op2_compile(TRIT_OP2_MULTIPLY, &op);
+    unsigned mul_len = op.len;
+    test_assert(add_len <= 6 && mul_len <= 6, "add and multiply: ≤ 6 ops, as trit64b_add/multiply");
+    trit_op2_compile(TRIT_OP2_AND, &op);
+    unsigned and_len = op.len;
+    trit_op2_compile(TRIT_OP2_OR, &op);
+    test_assert(and_len <= 2 && op.len <= 2, "AND and OR: ≤ 2 ops, as trit64b_and/or");
+    trit_op1_compile(TRIT_OP1_IDENTITY, &op);
+    test_assert(op.len == 0 && op.pos == 0 && op.neg == 1, "identity: no ops, planes pass through");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: Every table on every backend
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing every program on all nine pairs:\n");
+
+    build_pairs();
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (!trit_backend_supported(backends[i])) {
+            printf("    (skip %s: not supported on this CPU)\n", trit_backend_name(backends[i]));
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s: 19,683 dyadic + 27 monadic programs", trit_backend_name(backends[i]));
+        test_assert(check_programs(backends[i]), name);
+        snprintf(name, sizeof(name), "%s: add/multiply/and/or = trit64b kernels, %d vectors, in place",
+                 trit_backend_name(backends[i]), BIG_VECS);
+        test_assert(check_kernels(backends[i]), name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritop_apply: Table lookups per backend
+// ────────────────────────────────────────────────────────────────
+
+int test_tritop_apply(void) {
+    print_header("Operator Unit Tests: trit_t Arrays");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 6: Every supported backend
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing each supported backend against trit_op2_eval:\n");
+
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        char name[96];
+        if (!trit_backend_supported(backends[i])) {
+            printf("    (skip %s: not supported on this CPU)\n", trit_backend_name(backends[i]));
+            continue;
+        }
+        snprintf(name, sizeof(name), "%s: every ID, lengths 0-200, %d trits in place",
+                 trit_backend_name(backends[i]), BIG_TRITS);
+        test_assert(check_apply(backends[i]), name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritop_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_tritop_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Truth-Table Operators\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_tritop_eval();
+    test_tritop_compile();
+    test_tritop_apply();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_tritop_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ Add named IDs to TEST GROUP 2 as trit.h gains them
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = the table's own digits (trit9_unpack) and the
+//      per-call / hand-written trit64b operations
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "That was the name thereof." — Genesis 2:19
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
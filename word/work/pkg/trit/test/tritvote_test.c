@@ -0,0 +1,515 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Majority and Consensus Votes
+// Key: B-word-work-pkg-trit-tritvote-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/tritindex_test.c (structure)
+// See: word/research/ternary/ternary-logic-algorithms.adoc [CONSENSUS (Agreement)]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for tritvote.c - designed to FAIL MEANINGFULLY.
+// Every count and verdict must equal a per-position tally of the trits.
+//
+// tritvote_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "In the mouth of two or three witnesses shall every word be
+//            established." — 2 Corinthians 13:1
+//
+// Principle: A tally is only as good as its smallest count. Check every
+//            witness at every position.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH verdict, backend, length or vector count diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check tritvote counts, majority and consensus, adding from
+//          planes and t5b1 rows, clear and merge, and the _mt adds.
+//
+// Key Features:
+//   - Hand-checked tallies; two votes = the CONSENSUS table
+//   - Every backend; lengths around 64-trit and block edges; vector
+//     counts around the 15-vector group and counter widening
+//   - Split tallies merged = one tally
+//   - _mt adds at 0-64 threads = one tally, added to a tally in use
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-tritvote
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>        // printf
+
+//--- Project Headers ---
+#include "tritvote.h"     // tritvote_t, prototypes
+#include "logic.h"        // bool3_consensus
+#include "trit.h"         // trit64b_from_trits, trit64b_get, trit5_pack_array
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+#define MAX_TRITS  1100      // past one 1024-position block
+#define MAX_VECS   300       // past 255 votes (a ninth counter plane)
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_tritvote_run_all(void);   // Run all tests, return failure count
+int test_tritvote_fixed(void);     // Hand-checked tallies
+int test_tritvote_backends(void);  // Every backend vs the reference
+int test_tritvote_threads(void);   // _mt adds vs the reference
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_tritvote_run_all()
+//   ├── test_tritvote_fixed()    → known tallies, CONSENSUS table, empty
+//   └── test_tritvote_backends() → check_tally() per shape, per backend;
+//                                  clear, merge
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (data, reference tally, comparison)
+// ────────────────────────────────────────────────────────────────
+
+static trit_t trits[MAX_VECS][MAX_TRITS];
+static trit64b_t planes[MAX_VECS * TRIT64B_COUNT(MAX_TRITS)];
+static uint8_t rows[MAX_VECS * TRIT5_PACKED_SIZE(MAX_TRITS)];
+static trit64b_t verdict[TRIT64B_COUNT(MAX_TRITS)];
+static uint32_t got_pos[MAX_TRITS], got_neg[MAX_TRITS];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+static uint32_t rng_state = 1u;
+
+static uint32_t rng(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+
+// fill writes nvec vectors of n trits, packed both ways. Position i
+// leans toward a hidden value; every 7th position is unanimous and every
+// 11th never holds 0, so all three consensus outcomes occur.
+static void fill(size_t nvec, size_t n) {
+    size_t nv = TRIT64B_COUNT(n), rb = TRIT5_PACKED_SIZE(n);
+    for (size_t k = 0; k < nvec; k++) {
+        for (size_t i = 0; i < n; i++) {
+            trit_t lean = (trit_t)((int)(((uint32_t)i * 2654435761u) >> 7) % 3 - 1);
+            trit_t t;
+            if (i % 7 == 0) {
+                t = lean != 0 ? lean : TRIT_POS;
+            } else if (i % 11 == 0) {
+                t = (rng() & 1) ? TRIT_POS : TRIT_NEG;
+            } else {
+                uint32_t r = rng() % 8;
+                t = r < 4 ? lean : (trit_t)((int)(r % 3) - 1);
+            }
+            trits[k][i] = t;
+        }
+        for (size_t w = 0; w < nv; w++) {
+            size_t lanes = n - 64 * w < 64 ? n - 64 * w : 64;
+            planes[k * nv + w] = trit64b_from_trits(trits[k] + 64 * w, lanes);
+        }
+        trit5_pack_array(trits[k], n, rows + k * rb);
+    }
+}
+
+// check_tally compares v (holding vectors first .. first + nvec - 1)
+// with a per-position tally. Prints the first mismatch.
+static int check_tally(const tritvote_t *v, size_t first, size_t nvec, const char *what) {
+    size_t n = v->n;
+    tritvote_counts(v, got_pos, got_neg);
+    int ok = v->votes == nvec;
+    for (int pass = 0; pass < 2 && ok; pass++) {
+        if (pass == 0) {
+            tritvote_majority(v, verdict);
+        } else {
+            tritvote_consensus(v, verdict);
+        }
+        for (size_t i = 0; i < TRIT64B_COUNT(n) * 64 && ok; i++) {
+            uint32_t p = 0, m = 0;
+            for (size_t k = first; k < first + nvec && i < n; k++) {
+                p += trits[k][i] == TRIT_POS;
+                m += trits[k][i] == TRIT_NEG;
+            }
+            trit_t want;
+            if (i >= n || nvec == 0) {
+                want = TRIT_ZERO;
+            } else if (pass == 0) {
+                want = p > m ? TRIT_POS : m > p ? TRIT_NEG : TRIT_ZERO;
+            } else {
+                want = p == nvec || m == nvec ? TRIT_POS
+                     : p + m == nvec ? TRIT_NEG : TRIT_ZERO;
+            }
+            ok = trit64b_get(verdict[i / 64], (unsigned)(i % 64)) == want &&
+                 (i >= n || (got_pos[i] == p && got_neg[i] == m));
+            if (!ok) {
+                printf("    %s: %s at position %zu (P %u N %u of %zu)\n", what,
+                       pass == 0 ? "majority" : "consensus", i, p, m, nvec);
+            }
+        }
+    }
+    return ok;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritvote_fixed: Hand-Checked Tallies
+// ────────────────────────────────────────────────────────────────
+
+int test_tritvote_fixed(void) {
+    print_header("TEST: Known Tallies");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Three witnesses
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing a three-vector tally:\n");
+
+    static const trit_t three[3][3] = { { 1, 1, 0 }, { 1, -1, 0 }, { 1, -1, -1 } };
+    trit64b_t in[3];
+    for (int k = 0; k < 3; k++) {
+        in[k] = trit64b_from_trits(three[k], 3);
+    }
+    tritvote_t v;
+    tritvote_init(&v, 3);
+    test_assert(tritvote_add_t64b(&v, in, 3) && v.votes == 3, "add 3 vectors of 3 trits");
+
+    uint32_t p[3], m[3];
+    tritvote_counts(&v, p, m);
+    test_assert(p[0] == 3 && p[1] == 1 && p[2] == 0 && m[0] == 0 && m[1] == 2 && m[2] == 1,
+                "counts: +1 votes 3 1 0, -1 votes 0 2 1");
+    trit64b_t out;
+    tritvote_majority(&v, &out);
+    test_assert(trit64b_get(out, 0) == 1 && trit64b_get(out, 1) == -1 && trit64b_get(out, 2) == -1 &&
+                trit64b_get(out, 3) == 0,
+                "majority: + - - (zeros abstain), lane 3 stays 0");
+    tritvote_consensus(&v, &out);
+    test_assert(trit64b_get(out, 0) == 1 && trit64b_get(out, 1) == -1 && trit64b_get(out, 2) == 0,
+                "consensus: + (all agree), - (disagree), 0 (a zero vote)");
+
+    tritvote_clear(&v);
+    tritvote_majority(&v, &out);
+    test_assert(v.votes == 0 && out.pos == 0 && out.neg == 0, "clear: no votes, majority 0");
+    tritvote_consensus(&v, &out);
+    test_assert(out.pos == 0 && out.neg == 0, "no votes: consensus 0");
+    tritvote_free(&v);
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Two witnesses = the CONSENSUS table
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing V = 2 against bool3_consensus:\n");
+
+    trit_t a[9], b[9];
+    for (int i = 0; i < 9; i++) {
+        a[i] = (trit_t)(i / 3 - 1);
+        b[i] = (trit_t)(i % 3 - 1);
+    }
+    in[0] = trit64b_from_trits(a, 9);
+    in[1] = trit64b_from_trits(b, 9);
+    tritvote_init(&v, 9);
+    tritvote_add_t64b(&v, in, 2);
+    tritvote_consensus(&v, &out);
+    int ok = 1;
+    for (int i = 0; i < 9; i++) {
+        ok = ok && trit64b_get(out, (unsigned)i) == bool3_consensus(a[i], b[i]);
+    }
+    tritvote_free(&v);
+    test_assert(ok, "all nine pairs match the CONSENSUS truth table");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritvote_backends: Every Backend vs the Reference
+// ────────────────────────────────────────────────────────────────
+
+int test_tritvote_backends(void) {
+    print_header("TEST: Tallies per Backend");
+
+    static const size_t lengths[] = { 1, 63, 64, 65, 1000, 1024, MAX_TRITS };
+    static const size_t counts[] = { 1, 2, 14, 15, 16, 31, 100, MAX_VECS };
+
+    for (size_t bk = 0; bk < sizeof(backends) / sizeof(backends[0]); bk++) {
+        char name[96];
+        const char *bn = trit_backend_name(backends[bk]);
+        if (!trit_backend_supported(backends[bk])) {
+            printf("    (skip %s: not supported on this CPU)\n", bn);
+            continue;
+        }
+        trit_backend_select(backends[bk]);
+        printf("\n  Testing %s:\n", bn);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 3: Lengths × vector counts, planes and t5b1
+        // ════════════════════════════════════════════════════════════════
+        int ok = 1;
+        for (size_t li = 0; li < sizeof(lengths) / sizeof(lengths[0]) && ok; li++) {
+            size_t n = lengths[li];
+            fill(MAX_VECS, n);
+            for (size_t ci = 0; ci < sizeof(counts) / sizeof(counts[0]) && ok; ci++) {
+                size_t nvec = counts[ci];
+                tritvote_t v5;
+                tritvote_t vb;
+                tritvote_init(&v5, n);
+                tritvote_init(&vb, n);
+                // Planes in uneven chunks (groups straddle calls); t5b1 at once
+                for (size_t at = 0; at < nvec;) {
+                    size_t len = 1 + rng() % 40;
+                    len = len < nvec - at ? len : nvec - at;
+                    ok = ok && tritvote_add_t64b(&vb, planes + at * TRIT64B_COUNT(n), len);
+                    at += len;
+                }
+                ok = ok && tritvote_add_t5(&v5, rows, nvec) &&
+                     check_tally(&vb, 0, nvec, bn) && check_tally(&v5, 0, nvec, bn);
+                tritvote_free(&v5);
+                tritvote_free(&vb);
+            }
+        }
+        snprintf(name, sizeof(name), "%s: lengths 1-%d × 1-%d vectors, planes and t5b1",
+                 bn, MAX_TRITS, MAX_VECS);
+        test_assert(ok, name);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 4: Clear and merge
+        // ════════════════════════════════════════════════════════════════
+        size_t n = 1000, nv = TRIT64B_COUNT(n);
+        fill(MAX_VECS, n);
+        tritvote_t v;
+        tritvote_init(&v, n);
+        ok = tritvote_add_t64b(&v, planes, MAX_VECS);
+        tritvote_clear(&v);
+        ok = ok && tritvote_add_t64b(&v, planes + 40 * nv, 17) && check_tally(&v, 40, 17, bn);
+        tritvote_free(&v);
+        snprintf(name, sizeof(name), "%s: clear keeps planes, counts restart", bn);
+        test_assert(ok, name);
+
+        // Three tallies of different sizes (and plane counts), merged
+        tritvote_t part[3];
+        static const size_t cut[4] = { 0, 7, 260, MAX_VECS };
+        ok = 1;
+        for (int k = 0; k < 3; k++) {
+            tritvote_init(&part[k], n);
+            ok = ok && tritvote_add_t64b(&part[k], planes + cut[k] * nv, cut[k + 1] - cut[k]);
+        }
+        ok = ok && tritvote_merge(&part[1], &part[2]) && tritvote_merge(&part[0], &part[1]) &&
+             check_tally(&part[0], 0, MAX_VECS, bn);
+        for (int k = 0; k < 3; k++) {
+            tritvote_free(&part[k]);
+        }
+        snprintf(name, sizeof(name), "%s: 7 + 253 + 40 vectors merged = one tally", bn);
+        test_assert(ok, name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritvote_threads: _mt Adds vs the Reference
+// ────────────────────────────────────────────────────────────────
+
+int test_tritvote_threads(void) {
+    static const unsigned threads[] = { 0, 1, 2, 3, 7, 64 };
+    static const size_t counts[] = { 1, 15, 16, 31, 100, MAX_VECS };
+    size_t n = 1000, nv = TRIT64B_COUNT(n), rb = TRIT5_PACKED_SIZE(n);
+
+    print_header("TEST: Threaded Tallies");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 5: _mt adds = one tally
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing _mt adds (%s):\n", trit_backend_name(trit_backend_active()));
+    fill(MAX_VECS, n);
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        char name[96];
+        int ok = 1;
+        for (size_t ci = 0; ci < sizeof(counts) / sizeof(counts[0]) && ok; ci++) {
+            size_t nvec = counts[ci];
+            tritvote_t vb;
+            tritvote_t v5;
+            tritvote_init(&vb, n);
+            tritvote_init(&v5, n);
+            ok = tritvote_add_t64b_mt(&vb, planes, nvec, threads[t]) &&
+                 tritvote_add_t5_mt(&v5, rows, nvec, threads[t]) &&
+                 check_tally(&vb, 0, nvec, "planes") && check_tally(&v5, 0, nvec, "t5b1");
+            tritvote_free(&vb);
+            tritvote_free(&v5);
+        }
+        snprintf(name, sizeof(name), "%u threads: 1-%d vectors, planes and t5b1",
+                 threads[t], MAX_VECS);
+        test_assert(ok, name);
+    }
+
+    // Onto a tally that already holds votes (and must widen)
+    tritvote_t v;
+    tritvote_init(&v, n);
+    int ok = tritvote_add_t64b(&v, planes, 9) &&
+             tritvote_add_t64b_mt(&v, planes + 9 * nv, 200, 4) &&
+             tritvote_add_t5_mt(&v, rows + 209 * rb, MAX_VECS - 209, 3) &&
+             check_tally(&v, 0, MAX_VECS, "appended");
+    tritvote_free(&v);
+    test_assert(ok, "9 + 200 (4 threads) + 91 (3 threads) = one tally");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_tritvote_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_tritvote_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Majority and Consensus Votes\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_tritvote_fixed();
+    test_tritvote_backends();
+    test_tritvote_threads();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_tritvote_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ More lengths and vector counts, other data shapes in fill()
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Reference = trits counted one position at a time
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Every word be established." — 2 Corinthians 13:1
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================
@@ -0,0 +1,542 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// libtrit Unit Tests - Variable-Length Balanced-Ternary Integers
+// Key: B-word-work-pkg-trit-vartrit-test
+// ═══════════════════════════════════════════════════════════════════════════
+//
+// DEPENDENCY CLASSIFICATION: DEPENDED (needs: libtrit.a)
+//   Links against libtrit.a for trit types and operations.
+//
+// derives_from: bereshit/word/work/pkg/trit/test/rle_test.c (structure)
+// See: word/research/ternary/ternary-storage-algorithms.adoc [t5b1]
+//
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Unit tests for vartrit.c - designed to FAIL MEANINGFULLY.
+// Every value must come back exact, in the shortest form, and every
+// damaged buffer must be refused.
+//
+// vartrit_test - CPI-SI Kingdom Technology
+//
+// ============================================================================
+// METADATA
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// CORE IDENTITY
+// ────────────────────────────────────────────────────────────────
+//
+// # Biblical Foundation
+//
+// Scripture: "Let your communication be, Yea, yea; Nay, nay" — Matthew 5:37
+//
+// Principle: A value said short must still be said exactly.
+//
+// # CPI-SI Identity
+//
+// Component Type: Baton (execution flow - diagnoses and reports)
+//
+// Role: Diagnose WHICH value, length boundary, backend or fault diverges.
+//
+// # Authorship & Lineage
+//
+//   - Architect: Seanje Lenox-Wise
+//   - Implementation: Nova Dawn
+//   - Created: 2025-12-14
+//   - Version: 0.1.0
+//
+// # Purpose & Function
+//
+// Purpose: Check trit_vartrit_encode{,_i32,_i64}, trit_vartrit_size,
+//          trit_vartrit_decode{,_i32,_i64} and trit_vartrit_count.
+//
+// Key Features:
+//   - Form: groups are trit5_pack of the value's balanced digits, one
+//     spare-state terminator, shortest length at every boundary
+//   - Values: -100000..100000, int32 / int64 extremes, random widths
+//   - Bulk decode per backend equals value-at-a-time decode
+//   - Cut-short, overlong and out-of-range input
+//
+// ────────────────────────────────────────────────────────────────
+// INTERFACE
+// ────────────────────────────────────────────────────────────────
+//
+// # Usage
+//
+// Build + run: make test-vartrit
+//
+// ────────────────────────────────────────────────────────────────
+// OPERATIONAL
+// ────────────────────────────────────────────────────────────────
+//
+// Exit codes:
+//   0 = All tests passed
+//   1 = One or more tests failed
+//
+// ============================================================================
+// END METADATA
+// ============================================================================
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Includes
+// ────────────────────────────────────────────────────────────────
+
+//--- Standard Library ---
+#include <stdio.h>        // printf
+#include <string.h>       // memcmp
+
+//--- Project Headers ---
+#include "vartrit.h"      // trit_vartrit_*
+#include "trit.h"         // trit5_unpack, backends
+
+// ────────────────────────────────────────────────────────────────
+// Defines
+// ────────────────────────────────────────────────────────────────
+
+#define PASS "✓"
+#define FAIL "✗"
+
+#define BULK_VALUES  20000
+
+// ────────────────────────────────────────────────────────────────
+// Static Variables
+// ────────────────────────────────────────────────────────────────
+
+// Test result tracking
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+// ────────────────────────────────────────────────────────────────
+// Function Prototypes
+// ────────────────────────────────────────────────────────────────
+
+// Primary API (run tests)
+int test_vartrit_run_all(void);    // Run all tests, return failure count
+int test_vartrit_form(void);       // Byte layout and lengths
+int test_vartrit_values(void);     // Single-value round-trips
+int test_vartrit_bulk(void);       // Arrays per backend
+int test_vartrit_errors(void);     // Malformed input
+
+// Internal helpers
+static void print_header(const char *title);
+static void test_assert(int condition, const char *test_name);
+
+// ============================================================================
+// END SETUP
+// ============================================================================
+
+// ============================================================================
+// BODY
+// ============================================================================
+
+// ────────────────────────────────────────────────────────────────
+// Organizational Chart
+// ────────────────────────────────────────────────────────────────
+//
+//   main() → test_vartrit_run_all()
+//   ├── test_vartrit_form()   → digits, terminator, length per boundary
+//   ├── test_vartrit_values() → encode → decode per value
+//   ├── test_vartrit_bulk()   → bulk encode/decode/count per backend
+//   └── test_vartrit_errors() → damaged buffers
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 1: INTERNAL HELPERS (static)
+// ════════════════════════════════════════════════════════════════
+
+static void print_header(const char *title) {
+    printf("\n────────────────────────────────────────────────────────────────\n");
+    printf("%s\n", title);
+    printf("────────────────────────────────────────────────────────────────\n");
+}
+
+// Helper: assert condition - PASS if true, FAIL if false (diagnostic)
+static void test_assert(int condition, const char *test_name) {
+    if (condition) {
+        printf("  %s %s\n", PASS, test_name);
+        tests_passed++;
+    } else {
+        printf("  %s %s  ← FAILURE POINT\n", FAIL, test_name);
+        tests_failed++;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 2: TEST GROUPS
+// ════════════════════════════════════════════════════════════════
+
+// ────────────────────────────────────────────────────────────────
+// Shared helpers (data, round-trips)
+// ────────────────────────────────────────────────────────────────
+
+static int32_t v32[BULK_VALUES];
+static int32_t back32[BULK_VALUES];
+static int64_t v64[BULK_VALUES];
+static int64_t back64[BULK_VALUES];
+static uint8_t buf[BULK_VALUES * TRIT_VARTRIT_MAX64 + 1];
+
+static const trit_backend_t backends[] = {
+    TRIT_BACKEND_SCALAR, TRIT_BACKEND_TABLE, TRIT_BACKEND_SSE41, TRIT_BACKEND_AVX2, TRIT_BACKEND_AVX512
+};
+
+static uint64_t rng_state = 1u;
+
+static uint64_t rng(void) {
+    rng_state = rng_state * 6364136223846793005u + 1442695040888963407u;
+    return rng_state >> 11;
+}
+
+// random_width returns a value of about `bits` significant bits, either
+// sign.
+static int64_t random_width(unsigned bits) {
+    uint64_t u = rng();
+    u = bits >= 63 ? (u << 11) ^ rng() : u & ((UINT64_C(1) << bits) - 1);
+    return (rng() & 1) ? (int64_t)u : -(int64_t)(u >> 1) - 1;
+}
+
+// one_trip encodes v and decodes it back; returns the length, or 0 if
+// the value, the length or trit_vartrit_size differs.
+static size_t one_trip(int64_t v) {
+    uint8_t b[TRIT_VARTRIT_MAX64];
+    int64_t w = 0;
+    size_t n = trit_vartrit_encode(v, b);
+    return trit_vartrit_decode(b, n, &w) == n && w == v && trit_vartrit_size(v) == n ? n : 0;
+}
+
+// shortest_len is the expected length: 1 for |v| <= 6, then one more byte
+// per factor 243 of range.
+static size_t shortest_len(int64_t v) {
+    size_t n = 1;
+    while (v < -6 || v > 6) {
+        int64_t q = v / 243, r = v % 243;
+        q += (r > 121) - (r < -121);
+        v = q;
+        n++;
+    }
+    return n;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_vartrit_form: Byte Layout and Lengths
+// ────────────────────────────────────────────────────────────────
+
+int test_vartrit_form(void) {
+    print_header("TEST: Byte Layout");
+    uint8_t b[TRIT_VARTRIT_MAX64] = { 0 };
+    char name[128];
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 1: Digits and terminator
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing layout:\n");
+
+    size_t n = trit_vartrit_encode(0, b);
+    test_assert(n == 1 && b[0] == 249, "0 → [249]");
+    n = trit_vartrit_encode(-6, b);
+    test_assert(n == 1 && b[0] == 243, "-6 → [243]");
+    n = trit_vartrit_encode(6, b);
+    test_assert(n == 1 && b[0] == 255, "+6 → [255]");
+
+    // 7 = 0·81 + 0·27 + 1·9 - 1·3 + 1 → group (0, 0, +1, -1, +1), top 0
+    static const trit_t seven[5] = { 0, 0, 1, -1, 1 };
+    trit_t t[5] = { 0 };
+    n = trit_vartrit_encode(7, b);
+    trit5_unpack(b[0], t);
+    test_assert(n == 2 && memcmp(t, seven, 5) == 0 && b[1] == 249,
+                "7 → [trit5_pack(0,0,+1,-1,+1), 249]");
+
+    n = trit_vartrit_encode(-7, b);
+    trit5_unpack(b[0], t);
+    test_assert(n == 2 && t[2] == -1 && t[3] == 1 && t[4] == -1 && b[1] == 249,
+                "-7 → every digit of 7 mirrored");
+
+    // 1000 = 4·243 + 28 → groups: 28, top 4
+    n = trit_vartrit_encode(1000, b);
+    test_assert(n == 2 && b[0] == 121 + 28 && b[1] == 249 + 4, "1000 → [121 + 28, 249 + 4]");
+
+    int only_last = 1;
+    for (int i = 0; i < 2000 && only_last; i++) {
+        int64_t v = random_width(1 + (unsigned)(rng() % 63));
+        n = trit_vartrit_encode(v, b);
+        for (size_t k = 0; k + 1 < n; k++) {
+            only_last = only_last && b[k] <= TRIT5_MAX;
+        }
+        only_last = only_last && trit5_is_spare(b[n - 1]);
+    }
+    test_assert(only_last, "groups are 0-242, only the last byte is a spare state");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 2: Length boundaries (shortest form)
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing length boundaries:\n");
+
+    static const int64_t edges[] = {
+        6, 1579, 383818, 93267895, INT64_C(22664098606), INT64_C(5507375961379),
+        INT64_C(1338292358615218), INT64_C(325205043143498095)
+    };
+    for (size_t k = 0; k < sizeof(edges) / sizeof(edges[0]); k++) {
+        int64_t e = edges[k];
+        int ok = one_trip(e) == k + 1 && one_trip(-e) == k + 1 &&
+                 one_trip(e + 1) == k + 2 && one_trip(-e - 1) == k + 2;
+        snprintf(name, sizeof(name), "±%lld → %zu bytes, ±%lld → %zu", (long long)e, k + 1,
+                 (long long)(e + 1), k + 2);
+        test_assert(ok, name);
+    }
+    test_assert(one_trip(INT32_MAX) == TRIT_VARTRIT_MAX32 && one_trip(INT32_MIN) == TRIT_VARTRIT_MAX32,
+                "INT32_MIN / INT32_MAX → TRIT_VARTRIT_MAX32 bytes");
+    test_assert(one_trip(INT64_MAX) == TRIT_VARTRIT_MAX64 && one_trip(INT64_MIN) == TRIT_VARTRIT_MAX64,
+                "INT64_MIN / INT64_MAX → TRIT_VARTRIT_MAX64 bytes");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_vartrit_values: Single-Value Round-Trips
+// ────────────────────────────────────────────────────────────────
+
+int test_vartrit_values(void) {
+    print_header("TEST: Single Values");
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 3: Dense and random values
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing round-trips:\n");
+
+    int ok = 1;
+    for (int64_t v = -100000; v <= 100000 && ok; v++) {
+        ok = one_trip(v) == shortest_len(v);
+    }
+    test_assert(ok, "-100000..100000 round-trip at shortest length");
+
+    ok = 1;
+    for (int i = 0; i < 200000 && ok; i++) {
+        int64_t v = random_width(1 + (unsigned)(rng() % 63));
+        ok = one_trip(v) == shortest_len(v);
+    }
+    test_assert(ok, "200000 random values of 1-63 bits");
+
+    static const int64_t extremes[] = {
+        INT64_MAX, INT64_MAX - 1, INT64_MIN, INT64_MIN + 1,
+        INT64_C(6078832729528464400), -INT64_C(6078832729528464400),   // ≈ 243^8 / 2
+        INT64_C(6078832729528464401), -INT64_C(6078832729528464401)
+    };
+    ok = 1;
+    for (size_t k = 0; k < sizeof(extremes) / sizeof(extremes[0]); k++) {
+        ok = ok && one_trip(extremes[k]) > 0;
+    }
+    test_assert(ok, "int64 extremes and the 8/9-byte edge (243^8 / 2)");
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_vartrit_bulk: Arrays per Backend
+// ────────────────────────────────────────────────────────────────
+
+int test_vartrit_bulk(void) {
+    print_header("TEST: Bulk Encode/Decode per Backend");
+
+    // Mixed widths: mostly small deltas, with runs of single bytes and
+    // every length up to 9
+    for (size_t i = 0; i < BULK_VALUES; i++) {
+        unsigned r = (unsigned)(rng() % 100);
+        unsigned bits = r < 50 ? 2 : r < 80 ? 8 : r < 95 ? 20 : 1 + (unsigned)(rng() % 63);
+        v64[i] = random_width(bits);
+        v32[i] = (int32_t)(bits < 32 ? v64[i] : random_width(1 + (unsigned)(rng() % 31)));
+    }
+
+    // Reference: value at a time
+    size_t len64 = 0;
+    for (size_t i = 0; i < BULK_VALUES; i++) {
+        len64 += trit_vartrit_encode(v64[i], buf + len64);
+    }
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        char name[96];
+        const char *bn = trit_backend_name(backends[b]);
+        if (!trit_backend_supported(backends[b])) {
+            printf("    (skip %s: not supported on this CPU)\n", bn);
+            continue;
+        }
+        trit_backend_select(backends[b]);
+        printf("\n  Testing %s:\n", bn);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 4: int64 arrays
+        // ════════════════════════════════════════════════════════════════
+        size_t n = trit_vartrit_encode_i64(v64, BULK_VALUES, buf);
+        memset(back64, 0, sizeof(back64));
+        int ok = n == len64 && trit_vartrit_count(buf, n) == BULK_VALUES &&
+                 trit_vartrit_decode_i64(buf, n, back64, BULK_VALUES) == n &&
+                 memcmp(back64, v64, sizeof(v64)) == 0;
+        snprintf(name, sizeof(name), "%s: %d int64 values, %zu bytes, count and decode", bn,
+                 BULK_VALUES, n);
+        test_assert(ok, name);
+
+        // Every prefix length and start offset crosses window edges
+        ok = 1;
+        for (size_t cnt = 0; cnt <= 200 && ok; cnt++) {
+            size_t at = trit_vartrit_encode_i64(v64, cnt % 7, buf);
+            size_t used = trit_vartrit_encode_i64(v64 + cnt % 7, cnt, buf + at);
+            ok = trit_vartrit_decode_i64(buf + at, used + 3, back64, cnt) == used &&
+                 memcmp(back64, v64 + cnt % 7, cnt * sizeof(int64_t)) == 0;
+        }
+        snprintf(name, sizeof(name), "%s: 0-200 values, later bytes left alone", bn);
+        test_assert(ok, name);
+
+        // ════════════════════════════════════════════════════════════════
+        // TEST GROUP 5: int32 arrays
+        // ════════════════════════════════════════════════════════════════
+        n = trit_vartrit_encode_i32(v32, BULK_VALUES, buf);
+        memset(back32, 0, sizeof(back32));
+        ok = n <= BULK_VALUES * TRIT_VARTRIT_MAX32 &&
+             trit_vartrit_decode_i32(buf, n, back32, BULK_VALUES) == n &&
+             memcmp(back32, v32, sizeof(v32)) == 0;
+        snprintf(name, sizeof(name), "%s: %d int32 values, %zu bytes", bn, BULK_VALUES, n);
+        test_assert(ok, name);
+
+        int32_t small[1000];
+        for (size_t i = 0; i < 1000; i++) {
+            small[i] = (int32_t)(i % 13) - 6;
+        }
+        n = trit_vartrit_encode_i32(small, 1000, buf);
+        ok = n == 1000 && trit_vartrit_decode_i32(buf, n, back32, 1000) == n &&
+             memcmp(back32, small, sizeof(small)) == 0;
+        snprintf(name, sizeof(name), "%s: 1000 values in -6..6 → 1000 bytes", bn);
+        test_assert(ok, name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_vartrit_errors: Malformed Input
+// ────────────────────────────────────────────────────────────────
+
+int test_vartrit_errors(void) {
+    print_header("TEST: Malformed Input");
+    int64_t v = 0;
+    int32_t w = 0;
+
+    // ════════════════════════════════════════════════════════════════
+    // TEST GROUP 6: Cut short, overlong, out of range
+    // ════════════════════════════════════════════════════════════════
+    printf("\n  Testing errors:\n");
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        if (!trit_backend_select(backends[b])) {
+            continue;
+        }
+        uint8_t in[80];
+        memset(in, TRIT5_BIAS, sizeof(in));
+        int ok = trit_vartrit_decode(in, 0, &v) == TRIT_VARTRIT_ERROR &&
+                 trit_vartrit_decode_i64(in, 0, &v, 1) == TRIT_VARTRIT_ERROR &&
+                 trit_vartrit_decode_i64(in, 0, &v, 0) == 0 &&
+                 trit_vartrit_decode_i64(in, sizeof(in), &v, 1) == TRIT_VARTRIT_ERROR &&
+                 trit_vartrit_count(in, sizeof(in)) == 0;
+
+        // Terminator one past len
+        size_t n = trit_vartrit_encode(1000000, in);
+        ok = ok && trit_vartrit_decode(in, n - 1, &v) == TRIT_VARTRIT_ERROR &&
+             trit_vartrit_decode_i32(in, n - 1, &w, 1) == TRIT_VARTRIT_ERROR;
+
+        // 9 groups then a terminator: too long for int64; 5 groups too
+        // long for int32
+        memset(in, TRIT5_BIAS, 9);
+        in[9] = 249;
+        ok = ok && trit_vartrit_decode(in, 10, &v) == TRIT_VARTRIT_ERROR &&
+             trit_vartrit_decode_i64(in, 10, &v, 1) == TRIT_VARTRIT_ERROR &&
+             trit_vartrit_decode_i32(in + 4, 6, &w, 1) == TRIT_VARTRIT_ERROR &&
+             trit_vartrit_decode_i32(in + 5, 5, &w, 1) == 5 && w == 0;
+
+        // 9 bytes, top digit 2 or top 1 with a low part that does not
+        // lean back: overflow. 5 bytes past INT32_MAX: out of range.
+        memset(in, TRIT5_BIAS, 8);
+        in[8] = 251;
+        ok = ok && trit_vartrit_decode(in, 9, &v) == TRIT_VARTRIT_ERROR;
+        in[8] = 250;
+        ok = ok && trit_vartrit_decode(in, 9, &v) == TRIT_VARTRIT_ERROR;
+        n = trit_vartrit_encode(INT64_MAX, in);
+        ok = ok && trit_vartrit_decode(in, n, &v) == n && v == INT64_MAX;
+        in[0]++;
+        ok = ok && trit_vartrit_decode(in, n, &v) == TRIT_VARTRIT_ERROR;
+        n = trit_vartrit_encode(INT64_MIN, in);
+        in[0]--;
+        ok = ok && trit_vartrit_decode(in, n, &v) == TRIT_VARTRIT_ERROR;
+        n = trit_vartrit_encode((int64_t)INT32_MAX + 1, in);
+        ok = ok && trit_vartrit_decode_i32(in, n, &w, 1) == TRIT_VARTRIT_ERROR &&
+             trit_vartrit_decode_i64(in, n, &v, 1) == n && v == (int64_t)INT32_MAX + 1;
+
+        char name[96];
+        snprintf(name, sizeof(name), "%s: cut short, overlong, overflow → error", trit_backend_name(backends[b]));
+        test_assert(ok, name);
+    }
+    trit_backend_select(TRIT_BACKEND_AUTO);
+
+    return tests_failed;
+}
+
+// ────────────────────────────────────────────────────────────────
+// test_vartrit_run_all: Run Complete Diagnostics (Orchestrator)
+// ────────────────────────────────────────────────────────────────
+
+int test_vartrit_run_all(void) {
+    tests_passed = 0;
+    tests_failed = 0;
+
+    printf("════════════════════════════════════════════════════════════════\n");
+    printf("libtrit Variable-Length Balanced-Ternary Integers\n");
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    test_vartrit_form();
+    test_vartrit_values();
+    test_vartrit_bulk();
+    test_vartrit_errors();
+
+    printf("\n════════════════════════════════════════════════════════════════\n");
+    printf("Diagnostics Complete: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("════════════════════════════════════════════════════════════════\n");
+
+    return tests_failed;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SECTION 3: ENTRY POINT
+// ════════════════════════════════════════════════════════════════
+
+int main(void) {
+    int failures = test_vartrit_run_all();
+    return (failures > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// END BODY
+// ============================================================================
+
+// ============================================================================
+// CLOSING
+// ============================================================================
+//
+// ────────────────────────────────────────────────────────────────
+// Modification Policy
+// ────────────────────────────────────────────────────────────────
+//
+// Safe to Modify:
+//   ✅ More values, widths and damaged buffers
+//
+// NEVER Modify:
+//   ❌ 4-block structure
+//   ❌ Byte layouts in TEST GROUP 1 (they pin the written format)
+//
+// ────────────────────────────────────────────────────────────────
+// Closing Note
+// ────────────────────────────────────────────────────────────────
+//
+// "Let your communication be, Yea, yea; Nay, nay" — Matthew 5:37
+//
+// ============================================================================
+// END CLOSING
+// ============================================================================